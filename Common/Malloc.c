@@ -31,54 +31,106 @@
 
 #include "globals.h"
 
+#undef Malloc
+#undef Calloc
+#undef Realloc
+#undef NewString
+
+uint64_t malloc_count;
+uint64_t malloc_bytes;
+
+/*
+ * Allocation accounting hook, called after each allocation and before each
+ * free.
+ */
+alloc_track_t *alloc_track;
+
 void *
-Malloc(size_t len)
+Malloc_at(size_t len, const char *file)
 {
     char *r;
 
+    malloc_count++;
+    malloc_bytes += len;
     r = malloc(len);
     if (r == NULL) {
 	Error("Out of memory");
     }
+    if (alloc_track != NULL) {
+	(*alloc_track)(NULL, r, len, file);
+    }
     return r;
 }
 
 void *
-Calloc(size_t nelem, size_t elsize)
+Calloc_at(size_t nelem, size_t elsize, const char *file)
 {
-    char *r;
-
-    r = malloc(nelem * elsize);
-    if (r == NULL) {
-	Error("Out of memory");
-    }
-    return memset(r, '\0', nelem * elsize);
+    return memset(Malloc_at(nelem * elsize, file), '\0', nelem * elsize);
 }
 
 void *
-Realloc(void *p, size_t len)
+Realloc_at(void *p, size_t len, const char *file)
 {
-    p = realloc(p, len);
-    if (p == NULL) {
+    void *r;
+
+    malloc_count++;
+    malloc_bytes += len;
+    if (alloc_track != NULL && p != NULL) {
+	(*alloc_track)(p, NULL, 0, NULL);
+    }
+    r = realloc(p, len);
+    if (r == NULL) {
 	Error("Out of memory");
     }
-    return p;
+    if (alloc_track != NULL) {
+	(*alloc_track)(NULL, r, len, file);
+    }
+    return r;
 }
 
 void
 Free(void *p)
 {
     if (p != NULL) {
+	if (alloc_track != NULL) {
+	    (*alloc_track)(p, NULL, 0, NULL);
+	}
 	free(p);
     }
 }
 
 char *
-NewString(const char *s)
+NewString_at(const char *s, const char *file)
 {
     if (s != NULL) {
-	return strcpy(Malloc(strlen(s) + 1), s);
+	return strcpy(Malloc_at(strlen(s) + 1, file), s);
     } else {
 	return NULL;
     }
 }
+
+/* Untagged versions, for code compiled without the tagging macros. */
+
+void *
+Malloc(size_t len)
+{
+    return Malloc_at(len, NULL);
+}
+
+void *
+Calloc(size_t nelem, size_t elsize)
+{
+    return Calloc_at(nelem, elsize, NULL);
+}
+
+void *
+Realloc(void *p, size_t len)
+{
+    return Realloc_at(p, len, NULL);
+}
+
+char *
+NewString(const char *s)
+{
+    return NewString_at(s, NULL);
+}
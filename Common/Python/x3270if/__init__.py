@@ -1,5 +1,8 @@
-__all__ = ['common', 'new_emulator', 'worker_connection', 'host_specification']
+__all__ = ['common', 'new_emulator', 'worker_connection', 'host_specification', 'session_pool', 'async_session', 'session_server']
 from x3270if.common import *
 from x3270if.new_emulator import *
 from x3270if.worker_connection import *
 from x3270if.host_specification import *
+from x3270if.session_pool import *
+from x3270if.async_session import *
+from x3270if.session_server import *
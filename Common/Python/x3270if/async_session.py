@@ -0,0 +1,437 @@
+#!/usr/bin/env python3
+# Asynchronous, pipelining x3270if sessions
+#
+# Copyright (c) 2026 Paul Mattes.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#     * Redistributions of source code must retain the above copyright
+#       notice, this list of conditions and the following disclaimer.
+#     * Redistributions in binary form must reproduce the above copyright
+#       notice, this list of conditions and the following disclaimer in the
+#       documentation and/or other materials provided with the distribution.
+#     * Neither the names of Paul Mattes nor the names of his contributors
+#       may be used to endorse or promote products derived from this software
+#       without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+# WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+# EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+# OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+# WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+# OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+# ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+"""Asynchronous, pipelining interface to x3270 emulators"""
+
+import asyncio
+import collections
+import json
+import os
+import socket
+import sys
+
+from x3270if.common import _action_string
+from x3270if.common import ActionFailException
+from x3270if.common import StartupException
+
+class _async_session():
+    """Abstract asyncio x3270if session base class
+
+       Unlike the synchronous classes, an action is written to the emulator
+       as soon as it is issued, without waiting for the previous one to
+       complete. The emulator runs the actions in the order it receives
+       them, so a single reader matches each response to the oldest
+       outstanding request. Many sessions can be driven from one event loop.
+    """
+    def __init__(self,debug=False):
+        """Initialize an instance
+
+           Args:
+              debug (bool): True to trace debug info to stderr.
+        """
+
+        # Debug flag
+        self._debug_enabled = debug
+
+        # Last prompt
+        self._prompt = ''
+
+        # Streams to/from the emulator
+        self._reader = None
+        self._writer = None
+        self._encoding = 'utf-8'
+
+        # Requests waiting for a response, oldest first
+        self._pending = collections.deque()
+        self._reader_task = None
+        self._eof = False
+
+    async def __aenter__(self):
+        await self.start()
+        return self
+
+    async def __aexit__(self,exc_type,exc,tb):
+        await self.close()
+
+    @classmethod
+    async def create(cls,*args,**kwargs):
+        """Create and start a session
+
+           Args:
+              Passed to the constructor.
+           Returns:
+              The started session.
+           Raises:
+              StartupException: Unable to connect to the emulator.
+        """
+        session = cls(*args, **kwargs)
+        await session.start()
+        return session
+
+    async def start(self):
+        """Connect to the emulator (implemented by subclasses)"""
+        raise NotImplementedError
+
+    def _start_reader(self):
+        """Start the task that reads responses from the emulator"""
+        self._reader_task = asyncio.ensure_future(self._read_responses())
+
+    @property
+    def prompt(self):
+        """Gets the last emulator prompt
+           str: Last emulator prompt
+
+        """
+        return self._prompt
+
+    @property
+    def pending(self):
+        """Gets the number of actions waiting for a response
+           int: Number of outstanding actions
+
+        """
+        return len(self._pending)
+
+    def send_action(self,cmd,*args):
+        """Send an action to the emulator without waiting for it
+
+           Args:
+              cmd (str): Action name
+                 Action name. If 'args' is omitted, this is the entire
+                 properly-formatted action name and arguments, and the text
+                 will be passed through unmodified.
+              args (iterable): Arguments
+           Returns:
+              asyncio.Future: Completes with the command output, or with
+                 ActionFailException or EOFError.
+        """
+        if (not isinstance(cmd, str)):
+            raise TypeError("First argument must be a string")
+        argstr = _action_string(cmd, args)
+        future = asyncio.get_event_loop().create_future()
+        if (self._eof or self._writer == None):
+            future.set_exception(EOFError('Emulator exited'))
+            return future
+        self._pending.append(future)
+        self._writer.write((argstr + '\n').encode(self._encoding))
+        self._debug('Sent ' + argstr)
+        return future
+
+    async def run_action(self,cmd,*args):
+        """Send an action to the emulator and wait for the result
+
+           Args:
+              Same as send_action().
+           Returns:
+              str: Command output
+                 Mulitiple lines are separated by newline characters.
+           Raises:
+              ActionFailException: Emulator returned an error.
+              EOFError: Emulator exited unexpectedly.
+        """
+        future = self.send_action(cmd, *args)
+        if (self._writer != None): await self._writer.drain()
+        return await future
+
+    async def run_actions(self,actions):
+        """Pipeline a list of actions and wait for all of them
+
+           Args:
+              actions (iterable): Actions, each a string or a tuple of
+                 action name and arguments.
+           Returns:
+              list of str: Output of each action, in order
+           Raises:
+              ActionFailException: An action failed. The remaining actions
+                 were still run.
+              EOFError: Emulator exited unexpectedly.
+        """
+        futures = []
+        for action in actions:
+            if (isinstance(action, str)):
+                futures.append(self.send_action(action))
+            else:
+                futures.append(self.send_action(*action))
+        if (self._writer != None): await self._writer.drain()
+        results = await asyncio.gather(*futures, return_exceptions=True)
+        for result in results:
+            if (isinstance(result, BaseException)): raise result
+        return results
+
+    async def _read_responses(self):
+        """Read responses and complete the matching requests"""
+        lines = []
+        try:
+            while (True):
+                raw = await self._reader.readline()
+                if (raw == b''): break
+                text = raw.decode(self._encoding).rstrip('\r\n')
+                self._debug("Got '" + text + "'")
+                if (text != 'ok' and text != 'error'):
+                    lines.append(text)
+                    continue
+
+                # The last line before ok/error is the prompt.
+                if (lines != []): self._prompt = lines.pop()
+                result = '\n'.join(l[6:] if l.startswith('data: ') else l
+                        for l in lines)
+                lines = []
+                if (self._pending):
+                    future = self._pending.popleft()
+                    if (future.done()): continue
+                    if (text == 'ok'): future.set_result(result)
+                    else: future.set_exception(ActionFailException(result))
+        except (ConnectionError, asyncio.CancelledError):
+            pass
+        finally:
+            self._eof = True
+            while (self._pending):
+                future = self._pending.popleft()
+                if (not future.done()):
+                    future.set_exception(EOFError('Emulator exited'))
+
+    async def close(self):
+        """Close the session"""
+        if (self._writer != None):
+            self._writer.close()
+            self._writer = None
+        if (self._reader_task != None):
+            self._reader_task.cancel()
+            try:
+                await self._reader_task
+            except asyncio.CancelledError:
+                pass
+            self._reader_task = None
+
+    def _debug(self,text):
+        """Debug output
+
+           Args:
+              text (str): Text to log. A Newline will be added.
+        """
+        if (self._debug_enabled):
+            if os.name != 'nt':
+                sys.stderr.write('[33m')
+            sys.stderr.write(text)
+            if os.name != 'nt':
+                sys.stderr.write('[0m')
+            sys.stderr.write('\n')
+
+class async_new_emulator(_async_session):
+    """Starts a new copy of s3270, driven asynchronously"""
+    def __init__(self,debug=False,emulator=None,extra_args=[]):
+        """Initialize the object. The emulator is started by start().
+
+           Args:
+              debug (bool): True to log debug information to stderr.
+              emulator (str): Name of the emulator to start, defaults to s3270
+              extra_args(list of str, optional): Extra arguments
+                 to pass in the s3270 command line.
+        """
+        _async_session.__init__(self, debug)
+        self._emulator = emulator if emulator != None else 's3270'
+        self._extra_args = extra_args
+        self._s3270 = None
+
+    async def start(self):
+        """Start the emulator and connect to it
+
+           Raises:
+              StartupException: Unable to start s3270.
+        """
+
+        # Create a temporary socket to find a unique local port.
+        tempsocket = socket.socket()
+        tempsocket.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        tempsocket.bind(('127.0.0.1', 0))
+        port = tempsocket.getsockname()[1]
+        tempsocket.close()
+        self._debug('Port is {0}'.format(port))
+
+        # Create the child process.
+        args = ['-utf8',
+                '-minversion', '3.6',
+                '-scriptport', str(port),
+                '-scriptportonce'] + self._extra_args
+        try:
+            self._s3270 = await asyncio.create_subprocess_exec(self._emulator,
+                    *args, stderr=asyncio.subprocess.PIPE)
+        except OSError as err:
+            raise StartupException(str(err))
+
+        # It might take a couple of tries to connect, as it takes time to
+        # start the process. We wait a maximum of half a second.
+        for tries in range(5):
+            try:
+                self._reader, self._writer = \
+                        await asyncio.open_connection('127.0.0.1', port)
+                break
+            except OSError:
+                await asyncio.sleep(0.1)
+        if (self._writer == None):
+            errmsg = 'Could not connect to emulator'
+            self._s3270.terminate()
+            r = (await self._s3270.stderr.readline()).decode().rstrip('\r\n')
+            await self._s3270.wait()
+            self._s3270 = None
+            if (r != ''): errmsg += ': ' + r
+            raise StartupException(errmsg)
+        self._debug('Connected')
+        self._start_reader()
+
+    async def close(self):
+        """Close the session and stop the emulator"""
+        await _async_session.close(self)
+        if (self._s3270 != None):
+            if (self._s3270.returncode == None): self._s3270.terminate()
+            await self._s3270.wait()
+            self._s3270 = None
+        self._debug('async_new_emulator closed')
+
+class async_worker_connection(_async_session):
+    """Asynchronous connection to the emulator from a worker script invoked
+       via the Script() action"""
+    def __init__(self,debug=False):
+        """Initialize the object. The connection is made by start().
+
+           Args:
+              debug (bool): True to log debug information to stderr.
+        """
+        _async_session.__init__(self, debug)
+
+    async def start(self):
+        """Connect to the emulator
+
+           Raises:
+              StartupException: Insufficient information in the environment to
+              connect to the emulator.
+        """
+
+        # Socket or pipes
+        port = os.getenv('X3270PORT')
+        if (port != None):
+            # Connect to a TCP port.
+            self._reader, self._writer = \
+                    await asyncio.open_connection('127.0.0.1', int(port))
+            self._debug('Connected')
+        else:
+            # Talk to pipe file descriptors.
+            infd = os.getenv('X3270INPUT')
+            outfd = os.getenv('X3270OUTPUT')
+            if (infd == None or outfd == None):
+                raise StartupException("No X3270PORT, X3270INPUT or X3270OUTPUT defined")
+            loop = asyncio.get_event_loop()
+            self._reader = asyncio.StreamReader()
+            await loop.connect_read_pipe(
+                    lambda: asyncio.StreamReaderProtocol(self._reader),
+                    os.fdopen(int(outfd), 'rb', 0))
+            transport, protocol = await loop.connect_write_pipe(
+                    asyncio.streams.FlowControlMixin,
+                    os.fdopen(int(infd), 'wb', 0))
+            self._writer = asyncio.StreamWriter(transport, protocol,
+                    None, loop)
+            self._debug('Pipes connected')
+        self._start_reader()
+        emulator_encoding = await self.run_action('Query(LocalEncoding)')
+        if (emulator_encoding != 'UTF-8'):
+            self._encoding = emulator_encoding
+
+    async def close(self):
+        """Close the connection"""
+        await _async_session.close(self)
+        self._debug('async_worker_connection closed')
+
+class async_peer_connection(_async_session):
+    """Asynchronous connection to an emulator that is already running with
+       a script port (-scriptport)"""
+    def __init__(self,port,host='127.0.0.1',debug=False):
+        """Initialize the object. The connection is made by start().
+
+           Args:
+              port (int): Emulator script port.
+              host (str): Address the emulator is listening on.
+              debug (bool): True to log debug information to stderr.
+        """
+        _async_session.__init__(self, debug)
+        self._port = port
+        self._host = host
+
+    async def start(self):
+        """Connect to the emulator
+
+           Raises:
+              StartupException: Unable to connect to the emulator.
+        """
+        try:
+            self._reader, self._writer = \
+                    await asyncio.open_connection(self._host, self._port)
+        except OSError as err:
+            raise StartupException(str(err))
+        self._debug('Connected')
+        self._start_reader()
+
+    async def close(self):
+        """Close the connection"""
+        await _async_session.close(self)
+        self._debug('async_peer_connection closed')
+
+async def capture_screens(sessions,out):
+    """Capture the screen and status of many sessions at once
+
+       Ascii() is sent to every session before any reply is awaited, so the
+       emulators render their screens in parallel. Each result carries the
+       status line of the same response, so the screen and status of a
+       session are consistent with each other. One JSON object is written
+       to 'out' per session, as each one completes:
+          {"session": key, "status": prompt, "screen": [rows]}
+       or, if the session failed:
+          {"session": key, "error": message}
+
+       Args:
+          sessions (dict or iterable): Sessions, keyed by name. An iterable
+             is keyed by position.
+          out (file): Text stream to write NDJSON to.
+       Returns:
+          int: Number of sessions that failed.
+    """
+    if (not isinstance(sessions, dict)):
+        sessions = dict(enumerate(sessions))
+
+    async def one(key, session):
+        try:
+            screen = await session.run_action('Ascii()')
+            record = { 'session': key, 'status': session.prompt,
+                    'screen': screen.split('\n') }
+        except (ActionFailException, EOFError, ConnectionError) as err:
+            record = { 'session': key, 'error': str(err) }
+        out.write(json.dumps(record) + '\n')
+        return 'error' not in record
+
+    results = await asyncio.gather(*(one(key, session)
+        for key, session in sessions.items()))
+    out.flush()
+    return results.count(False)
@@ -57,6 +57,22 @@ def quote(arg):
     if (x.endswith('\\')): x = x + '\\'
     return '"' + x + '"'
 
+def _action_string(cmd,args):
+    """Format an action and its arguments
+
+       Args:
+          cmd (str): Action name, or the entire action if args is empty
+          args (tuple): Arguments, or a tuple holding one iterable
+       Returns:
+          str: Formatted action
+    """
+    if (args == ()):
+        return cmd
+    if (len(args) == 1 and not isinstance(args[0], str)):
+        # One argument that can be iterated over.
+        args = args[0]
+    return cmd + '(' + ','.join(quote(str(arg)) for arg in args) + ')'
+
 class ActionFailException(Exception):
     """x3270if action failure"""
     def __init__(self,msg):
@@ -116,14 +132,7 @@ class _session():
         if (not isinstance(cmd, str)):
             raise TypeError("First argument must be a string")
         self._debug("args is {0}, len is {1}".format(args, len(args)))
-        if (args == ()):
-            argstr = cmd
-        elif (len(args) == 1 and not isinstance(args[0], str)):
-            # One argument that can be iterated over.
-            argstr = cmd + '(' + ','.join(quote(str(arg)) for arg in args[0]) + ')'
-        else:
-            # Multiple arguments.
-            argstr = cmd + '(' + ','.join(quote(str(arg)) for arg in args) + ')'
+        argstr = _action_string(cmd, args)
         self._to3270.write(argstr + '\n')
         self._to3270.flush()
         self._debug('Sent ' + argstr)
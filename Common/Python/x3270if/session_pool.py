@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+# Pool of pre-connected s3270 sessions
+#
+# Copyright (c) 2026 Paul Mattes.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#     * Redistributions of source code must retain the above copyright
+#       notice, this list of conditions and the following disclaimer.
+#     * Redistributions in binary form must reproduce the above copyright
+#       notice, this list of conditions and the following disclaimer in the
+#       documentation and/or other materials provided with the distribution.
+#     * Neither the names of Paul Mattes nor the names of his contributors
+#       may be used to endorse or promote products derived from this software
+#       without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+# WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+# EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+# OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+# WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+# OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+# ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Pool of pre-connected x3270 emulator sessions"""
+
+import threading
+import time
+
+from x3270if.common import ActionFailException
+from x3270if.common import StartupException
+from x3270if.new_emulator import new_emulator
+
+class session_pool():
+    """Keeps s3270 sessions connected to a host, ready to be claimed
+
+       Starting s3270, connecting and logging in can take most of the time
+       a short script runs for. The pool does that work in the background,
+       so claim() normally returns a session that is already connected.
+    """
+    def __init__(self,host,size=1,login=None,debug=False,emulator=None,extra_args=[]):
+        """Initialize the pool and start filling it.
+
+           Args:
+              host (str or host_specification): Host to connect to.
+              size (int, optional): Number of ready sessions to keep.
+              login (list of str, optional): Actions to run on each new
+                 session after it connects, e.g. to wait for and fill in
+                 a login screen.
+              debug (bool): True to log debug information to stderr.
+              emulator (str): Name of the emulator to start, defaults to s3270
+              extra_args(list of str, optional): Extra arguments
+                 to pass in the s3270 command line.
+        """
+        if (size < 1): raise ValueError('size must be at least 1')
+        self._host = str(host)
+        self._size = size
+        self._login = login if login != None else []
+        self._debug_enabled = debug
+        self._emulator = emulator
+        self._extra_args = extra_args
+        self._lock = threading.Lock()
+        self._ready = []
+        self._starting = 0
+        self._closed = False
+        for i in range(size): self._refill()
+
+    def __del__(self):
+        self.close()
+
+    def _quit(self,em):
+        """Shut down one session, ignoring errors."""
+        try:
+            em.run_action('Quit')
+        except (ActionFailException, EOFError):
+            pass
+
+    def _start(self):
+        """Start one session and connect it.
+
+           Returns:
+              new_emulator: Connected session.
+           Raises:
+              StartupException: Unable to start s3270.
+              ActionFailException: Connect or login failed.
+        """
+        em = new_emulator(self._debug_enabled, self._emulator, self._extra_args)
+        try:
+            em.run_action('Connect', [self._host])
+            for action in self._login: em.run_action(action)
+        except:
+            self._quit(em)
+            raise
+        return em
+
+    def _fill_one(self):
+        """Background thread body: add one session to the pool."""
+        em = None
+        try:
+            em = self._start()
+        except (StartupException, ActionFailException, EOFError):
+            pass
+        with self._lock:
+            self._starting -= 1
+            if (em != None and not self._closed):
+                self._ready.append(em)
+                em = None
+        if (em != None): self._quit(em)
+
+    def _refill(self):
+        """Start a background connect if the pool is short."""
+        with self._lock:
+            if (self._closed or len(self._ready) + self._starting >= self._size):
+                return
+            self._starting += 1
+        threading.Thread(target=self._fill_one, daemon=True).start()
+
+    def claim(self):
+        """Take a connected session out of the pool.
+
+           A replacement is started in the background. If no session is
+           ready, or the ready ones have been disconnected by the host,
+           a new one is connected before returning.
+
+           Returns:
+              new_emulator: Connected session, owned by the caller.
+           Raises:
+              StartupException: Unable to start s3270.
+              ActionFailException: Connect or login failed.
+        """
+        while (True):
+            with self._lock:
+                em = self._ready.pop(0) if self._ready else None
+            self._refill()
+            if (em == None): return self._start()
+            try:
+                if (em.run_action('Query', ['ConnectionState']) != 'not-connected'):
+                    return em
+            except (ActionFailException, EOFError):
+                pass
+            self._quit(em)
+
+    def close(self):
+        """Stop refilling the pool and shut down the ready sessions."""
+        with self._lock:
+            self._closed = True
+            ready = self._ready
+            self._ready = []
+        for em in ready: self._quit(em)
+
+def transfer_files(pool,manifest,parallel=2,retries=1):
+    """Run many file transfers in parallel over sessions from a pool
+
+       DFT transfers are stop-and-wait within one session, so the way to keep
+       a link busy is to run several sessions at once. Each of 'parallel'
+       worker threads claims a session from the pool and runs transfers from
+       the manifest until it is empty. A failed transfer is retried up to
+       'retries' more times, on a fresh session, in case the failure left the
+       old one in a bad state.
+
+       Args:
+          pool (session_pool): Pool to claim sessions from. Its login
+             actions should leave each session ready for IND$FILE.
+          manifest (iterable of dict): One entry per transfer, mapping
+             Transfer() keywords to values, e.g.
+             {'direction': 'send', 'localfile': 'a.txt', 'hostfile': 'a text'}.
+          parallel (int, optional): Number of transfers to run at once.
+          retries (int, optional): Extra attempts for a failed transfer.
+       Returns:
+          dict: 'files' (transfers that succeeded), 'failed' (list of
+             (entry, error message) for the ones that did not), 'bytes'
+             (total bytes transferred), 'seconds' (elapsed time) and
+             'bytes_per_sec' (aggregate throughput).
+    """
+    if (parallel < 1): raise ValueError('parallel must be at least 1')
+    lock = threading.Lock()
+    work = list(manifest)
+    totals = { 'files': 0, 'failed': [], 'bytes': 0 }
+
+    def transfer(em, entry):
+        """Run one transfer. Returns the byte count."""
+        em.run_action('Transfer',
+                ['{0}={1}'.format(k, v) for k, v in entry.items()])
+        stats = em.run_action('Query', ['TransferStats']).split()
+        try:
+            return int(stats[stats.index('bytes') + 1])
+        except (ValueError, IndexError):
+            return 0
+
+    def worker():
+        em = None
+        while (True):
+            with lock:
+                if (not work): break
+                entry = work.pop(0)
+            error = None
+            for attempt in range(retries + 1):
+                try:
+                    if (em == None): em = pool.claim()
+                    nbytes = transfer(em, entry)
+                    error = None
+                    break
+                except (StartupException, ActionFailException, EOFError) as err:
+                    error = str(err)
+                    if (em != None): pool._quit(em)
+                    em = None
+            with lock:
+                if (error == None):
+                    totals['files'] += 1
+                    totals['bytes'] += nbytes
+                else:
+                    totals['failed'].append((entry, error))
+        if (em != None): pool._quit(em)
+
+    start = time.monotonic()
+    threads = [threading.Thread(target=worker, daemon=True)
+            for i in range(parallel)]
+    for t in threads: t.start()
+    for t in threads: t.join()
+    totals['seconds'] = time.monotonic() - start
+    totals['bytes_per_sec'] = (totals['bytes'] / totals['seconds']
+            if totals['seconds'] > 0 else 0.0)
+    return totals
@@ -0,0 +1,382 @@
+#!/usr/bin/env python3
+# One REST endpoint for many emulator sessions
+#
+# Copyright (c) 2026 Paul Mattes.
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are met:
+#     * Redistributions of source code must retain the above copyright
+#       notice, this list of conditions and the following disclaimer.
+#     * Redistributions in binary form must reproduce the above copyright
+#       notice, this list of conditions and the following disclaimer in the
+#       documentation and/or other materials provided with the distribution.
+#     * Neither the names of Paul Mattes nor the names of his contributors
+#       may be used to endorse or promote products derived from this software
+#       without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+# WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+# MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+# EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+# PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+# OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+# WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+# OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+# ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""One HTTP listener routing REST requests to many emulator sessions"""
+
+import http.server
+import json
+import os
+import queue
+import threading
+import time
+import urllib.parse
+
+from x3270if.common import ActionFailException
+from x3270if.common import StartupException
+from x3270if.new_emulator import new_emulator
+
+class _server_session():
+    """One emulator session and its request queue
+
+       Requests for a session are run one at a time, in the order they
+       arrive, by the session's own worker thread. Requests for different
+       sessions run in parallel.
+    """
+    def __init__(self,id,em,depth):
+        self.id = id
+        self.em = em
+        self.queue = queue.Queue(depth)
+        self.actions = 0
+        self.busy = 0.0
+        self.bytes_in = 0
+        self.bytes_out = 0
+        self.thread = threading.Thread(target=self._worker, daemon=True)
+        self.thread.start()
+
+    def _worker(self):
+        while (True):
+            request = self.queue.get()
+            if (request == None): break
+            action, reply = request
+            t0 = time.monotonic()
+            try:
+                result = self.em.run_action(action)
+                reply['ok'] = True
+            except ActionFailException as err:
+                result = str(err)
+                reply['ok'] = False
+            except EOFError:
+                result = 'Emulator exited'
+                reply['ok'] = None
+            self.busy += time.monotonic() - t0
+            self.actions += 1
+            self.bytes_in += len(action)
+            self.bytes_out += len(result)
+            reply['status'] = self.em.prompt
+            reply['result'] = result
+            reply['done'].set()
+        try:
+            self.em.run_action('Quit')
+        except (ActionFailException, EOFError):
+            pass
+
+    def run(self,action,timeout):
+        """Queue an action and wait for it to complete.
+
+           Returns:
+              dict: 'ok' (True for success, False for an action error, None
+                 if the emulator has gone), 'status' and 'result'; or None
+                 if the queue is full or the action timed out.
+        """
+        reply = { 'done': threading.Event() }
+        try:
+            self.queue.put_nowait((action, reply))
+        except queue.Full:
+            return None
+        if (not reply['done'].wait(timeout)): return None
+        return reply
+
+    def stop(self):
+        self.queue.put(None)
+
+    def cpu(self):
+        """Returns:
+              float: CPU seconds used by the emulator process, or None if
+                 they cannot be found.
+        """
+        proc = getattr(self.em, '_s3270', None)
+        if (proc == None): return None
+        try:
+            with open('/proc/{0}/stat'.format(proc.pid)) as f:
+                fields = f.read().rsplit(')', 1)[1].split()
+        except (OSError, IndexError):
+            return None
+        # utime and stime are fields 14 and 15, counting the pid as 1.
+        return (int(fields[11]) + int(fields[12])) / os.sysconf('SC_CLK_TCK')
+
+    def usage(self):
+        """Returns:
+              dict: Resources used by the session.
+        """
+        cpu = self.cpu()
+        return { 'id': self.id,
+                 'cpu': round(cpu, 3) if cpu != None else None,
+                 'busy': round(self.busy, 3),
+                 'actions': self.actions,
+                 'bytes-in': self.bytes_in,
+                 'bytes-out': self.bytes_out,
+                 'queued': self.queue.qsize() }
+
+class session_server():
+    """HTTP server for many s3270 sessions behind one port
+
+       Each session is a separate s3270 process, driven over its own local
+       script connection. Clients only see one listener, with the session
+       named in the URI:
+
+          GET    /3270/sessions                     list the sessions
+          POST   /3270/sessions                     start a session
+          DELETE /3270/sessions/{id}                stop a session
+          GET    /3270/sessions/{id}/rest/json/{action}
+          GET    /3270/sessions/{id}/rest/text/{action}
+          GET    /3270/sessions/{id}/rest/stext/{action}
+          GET    /3270/usage?top={n}                busiest sessions
+
+       The rest/ nodes return the same bodies as the emulator's own httpd.
+       A POST to /3270/sessions may carry a JSON body with a 'host' to
+       connect to, and an 'id' to use instead of a generated one.
+       Connections are persistent (HTTP/1.1), so a client can drive the
+       whole fleet from one connection pool.
+
+       /3270/usage lists the sessions that have used the most emulator CPU
+       time (busy time, where CPU time cannot be found), with the time
+       spent running their actions, the number of actions, the bytes
+       passed each way and the number of requests waiting, so noisy
+       clients can be found and throttled.
+    """
+    def __init__(self,port=0,address='127.0.0.1',debug=False,emulator=None,extra_args=[],queue_depth=64,timeout=60.0):
+        """Initialize the server and start listening.
+
+           Args:
+              port (int, optional): TCP port to listen on, 0 to pick one.
+              address (str, optional): Address to listen on.
+              debug (bool): True to log debug information to stderr.
+              emulator (str): Name of the emulator to start, defaults to s3270
+              extra_args(list of str, optional): Extra arguments
+                 to pass in the s3270 command line.
+              queue_depth (int, optional): Requests that can be waiting for
+                 each session before more are refused with status 503.
+              timeout (float, optional): Seconds to wait for an action.
+        """
+        self._debug_enabled = debug
+        self._emulator = emulator
+        self._extra_args = extra_args
+        self._queue_depth = queue_depth
+        self._timeout = timeout
+        self._lock = threading.Lock()
+        self._sessions = {}
+        self._next_id = 1
+        self._thread = None
+        server = self
+
+        class handler(http.server.BaseHTTPRequestHandler):
+            protocol_version = 'HTTP/1.1'
+            def do_GET(self): server._handle(self, 'GET')
+            def do_POST(self): server._handle(self, 'POST')
+            def do_DELETE(self): server._handle(self, 'DELETE')
+            def log_message(self, format, *args):
+                if (server._debug_enabled):
+                    http.server.BaseHTTPRequestHandler.log_message(self,
+                            format, *args)
+
+        self._httpd = http.server.ThreadingHTTPServer((address, port), handler)
+        self._httpd.daemon_threads = True
+
+    @property
+    def port(self):
+        """int: Port the server is listening on"""
+        return self._httpd.server_address[1]
+
+    def create(self,host=None,id=None):
+        """Start a session, and connect it if a host is given.
+
+           Returns:
+              str: Session ID.
+           Raises:
+              StartupException: Unable to start s3270.
+              ActionFailException: Connect failed.
+              ValueError: The ID is already in use.
+        """
+        with self._lock:
+            if (id == None):
+                while (str(self._next_id) in self._sessions):
+                    self._next_id += 1
+                id = str(self._next_id)
+                self._next_id += 1
+            elif (id in self._sessions):
+                raise ValueError('Session ' + id + ' already exists')
+            # Reserve the ID while the emulator starts.
+            self._sessions[id] = None
+        try:
+            em = new_emulator(self._debug_enabled, self._emulator, self._extra_args)
+            try:
+                if (host != None): em.run_action('Connect', [str(host)])
+            except:
+                try:
+                    em.run_action('Quit')
+                except (ActionFailException, EOFError):
+                    pass
+                raise
+        except:
+            with self._lock: del self._sessions[id]
+            raise
+        with self._lock:
+            self._sessions[id] = _server_session(id, em, self._queue_depth)
+        return id
+
+    def destroy(self,id):
+        """Stop a session.
+
+           Returns:
+              bool: True if the session existed.
+        """
+        with self._lock:
+            s = self._sessions.get(id)
+            if (s == None): return False
+            del self._sessions[id]
+        s.stop()
+        return True
+
+    def sessions(self):
+        """Returns:
+              list of str: IDs of the running sessions.
+        """
+        with self._lock:
+            return [id for id, s in self._sessions.items() if s != None]
+
+    def usage(self,top=None):
+        """Report the resources used by each session, busiest first.
+
+           Args:
+              top (int, optional): Number of sessions to report.
+           Returns:
+              list of dict: Usage of each session.
+        """
+        with self._lock:
+            sessions = [s for s in self._sessions.values() if s != None]
+        usage = [s.usage() for s in sessions]
+        usage.sort(key=lambda u: (u['cpu'] if u['cpu'] != None else u['busy'],
+            u['busy']), reverse=True)
+        return usage[:top] if top != None else usage
+
+    def serve_forever(self):
+        """Handle requests until close() is called."""
+        self._httpd.serve_forever()
+
+    def start(self):
+        """Handle requests in a background thread."""
+        self._thread = threading.Thread(target=self.serve_forever, daemon=True)
+        self._thread.start()
+
+    def close(self):
+        """Stop the server and all of its sessions."""
+        self._httpd.shutdown()
+        self._httpd.server_close()
+        for id in self.sessions(): self.destroy(id)
+
+    def _reply(self,h,code,body,ctype='application/json'):
+        """Send a response."""
+        if (isinstance(body, str)): body = body.encode('utf-8')
+        h.send_response(code)
+        h.send_header('Content-Type', ctype + '; charset=utf-8')
+        h.send_header('Content-Length', str(len(body)))
+        h.end_headers()
+        h.wfile.write(body)
+
+    def _error(self,h,code,text,node='json'):
+        """Send an error response, in the style of the emulator's httpd."""
+        if (node == 'json'):
+            self._reply(h, code, json.dumps({ 'result': text.split('\n') }) + '\n')
+        else:
+            self._reply(h, code, text + '\n', 'text/plain')
+
+    def _handle(self,h,method):
+        """Route one request."""
+        url = urllib.parse.urlsplit(h.path)
+        parts = url.path.split('/')
+        length = int(h.headers.get('Content-Length', 0) or 0)
+        body = h.rfile.read(length) if length > 0 else b''
+        if (len(parts) == 3 and parts[0] == '' and parts[1] == '3270' and
+                parts[2] == 'usage'):
+            if (method != 'GET'):
+                return self._error(h, 405, 'Method not allowed')
+            query = urllib.parse.parse_qs(url.query)
+            try:
+                top = int(query['top'][0]) if 'top' in query else None
+            except ValueError:
+                return self._error(h, 400, 'Invalid top')
+            return self._reply(h, 200,
+                    json.dumps({ 'sessions': self.usage(top) }) + '\n')
+        if (len(parts) < 3 or parts[0] != '' or parts[1] != '3270' or
+                parts[2] != 'sessions'):
+            return self._error(h, 404, 'Not found')
+
+        # /3270/sessions
+        if (len(parts) == 3 or (len(parts) == 4 and parts[3] == '')):
+            if (method == 'GET'):
+                return self._reply(h, 200,
+                        json.dumps({ 'sessions': self.sessions() }) + '\n')
+            if (method != 'POST'):
+                return self._error(h, 405, 'Method not allowed')
+            try:
+                args = json.loads(body.decode('utf-8')) if body else {}
+                id = self.create(args.get('host'), args.get('id'))
+            except (ValueError, AttributeError) as err:
+                return self._error(h, 400, str(err))
+            except (StartupException, ActionFailException, EOFError) as err:
+                return self._error(h, 500, str(err))
+            return self._reply(h, 201, json.dumps({ 'id': id }) + '\n')
+
+        id = urllib.parse.unquote(parts[3])
+        with self._lock:
+            s = self._sessions.get(id)
+        if (s == None):
+            return self._error(h, 404, 'No such session')
+
+        # /3270/sessions/{id}
+        if (len(parts) == 4):
+            if (method != 'DELETE'):
+                return self._error(h, 405, 'Method not allowed')
+            self.destroy(id)
+            return self._reply(h, 200, json.dumps({ 'id': id }) + '\n')
+
+        # /3270/sessions/{id}/rest/{node}/{action}
+        if (len(parts) < 6 or parts[4] != 'rest' or
+                parts[5] not in ['json', 'text', 'stext']):
+            return self._error(h, 404, 'Not found')
+        node = parts[5]
+        action = urllib.parse.unquote('/'.join(parts[6:]))
+        if (node == 'stext' and action == ''): action = 'Query()'
+        if (action == ''):
+            return self._error(h, 400, 'Missing 3270 action.', node)
+        reply = s.run(action, self._timeout)
+        if (reply == None):
+            return self._error(h, 503, 'Session busy', node)
+        if (reply['ok'] == None):
+            self.destroy(id)
+            return self._error(h, 500, reply['result'], node)
+        if (not reply['ok']):
+            return self._error(h, 400, reply['result'], node)
+        result = reply['result']
+        if (node == 'json'):
+            self._reply(h, 200, json.dumps({ 'status': reply['status'],
+                'result': result.split('\n') if result != '' else None }) + '\n')
+        elif (node == 'stext'):
+            self._reply(h, 200, reply['status'] + '\n' + result, 'text/plain')
+        else:
+            self._reply(h, 200, result, 'text/plain')
@@ -59,6 +59,11 @@
 #define PPI			72	/* points per inch */
 
 /* Typedefs */
+typedef enum {			/* text colors */
+    COLOR_NONE,			/*  not set yet */
+    COLOR_NORMAL,		/*  black on white */
+    COLOR_REVERSE		/*  white on black */
+} gdi_color_t;
 
 /* Globals */
 
@@ -92,8 +97,10 @@ static struct {			/* printer state */
     HFONT font, bold_font, underscore_font, bold_underscore_font;
     HFONT caption_font;
 			        /*  fonts */
+    HPEN sep_pen;		/*  pen for the line between screens */
     SIZE space_size;		/*  size of a space character */
-    INT *dx;			/*  spacing array */
+    INT *dx;			/*  spacing array for a run */
+    wchar_t *run_text;		/*  text of a run */
 
     HANDLE thread;		/* thread to run the print dialog */
     HANDLE done_event;		/* event to signal dialog is done */
@@ -101,6 +108,16 @@ static struct {			/* printer state */
     void *wait_context;		/* task wait context */
 } pstate;
 static bool pstate_initted = false;
+static struct {			/* run of text with the same attributes */
+    int col;			/*  starting column */
+    int next_col;		/*  column after the last character */
+    int len;			/*  number of characters */
+    int nonblank;		/*  characters up to the last visible one */
+    HFONT font;			/*  font */
+    gdi_color_t color;		/*  color */
+    HFONT got_font;		/*  font currently selected in the DC */
+    gdi_color_t got_color;	/*  color currently set in the DC */
+} run;
 
 /* Forward declarations. */
 static void gdi_get_params(uparm_t *up);
@@ -326,7 +343,7 @@ gdi_get_params(uparm_t *up)
 }
 
 /*
- * Clean up fonts.
+ * Clean up fonts and the other cached GDI objects.
  */
 static void
 cleanup_fonts(void)
@@ -343,10 +360,20 @@ cleanup_fonts(void)
 	DeleteObject(pstate.underscore_font);
 	pstate.underscore_font = NULL;
     }
+    if (pstate.bold_underscore_font) {
+	DeleteObject(pstate.bold_underscore_font);
+	pstate.bold_underscore_font = NULL;
+    }
     if (pstate.caption_font) {
 	DeleteObject(pstate.caption_font);
 	pstate.caption_font = NULL;
     }
+    if (pstate.sep_pen) {
+	DeleteObject(pstate.sep_pen);
+	pstate.sep_pen = NULL;
+    }
+    Replace(pstate.dx, NULL);
+    Replace(pstate.run_text, NULL);
 
     pstate.active = false;
 }
@@ -847,11 +874,19 @@ gdi_init(const char *printer_name, unsigned opts, const char **fail,
 	goto failed;
     }
 
-    /* Set up the manual spacing array. */
-    pstate.dx = Malloc(sizeof(INT) * maxCOLS);
+    /* Create the pen for the line between screens. */
+    pstate.sep_pen = CreatePen(PS_SOLID, 3, RGB(0, 0, 0));
+    if (pstate.sep_pen == NULL) {
+	*fail = "CreatePen failed";
+	goto failed;
+    }
+
+    /* Set up the run buffers. */
+    Replace(pstate.dx, Malloc(sizeof(INT) * maxCOLS));
     for (i = 0; i < maxCOLS; i++) {
 	pstate.dx[i] = pstate.space_size.cx;
     }
+    Replace(pstate.run_text, Malloc(sizeof(wchar_t) * maxCOLS));
 
     /* Fill in the document info. */
     memset(&docinfo, '\0', sizeof(docinfo));
@@ -876,8 +911,70 @@ failed:
     return GDI_STATUS_ERROR;
 }
 
+/*
+ * Print the current run of text, leaving off any trailing blanks.
+ * Returns 0 for success, -1 for failure.
+ */
+static int
+gdi_flush_run(HDC dc, int row, const char **fail)
+{
+    int status;
+
+    if (!run.nonblank) {
+	run.len = 0;
+	return 0;
+    }
+
+    /* Set the bg/fg color and font. */
+    if (run.color != run.got_color) {
+	switch (run.color) {
+	case COLOR_REVERSE:
+	    SetTextColor(dc, 0xffffff);
+	    SetBkColor(dc, 0);
+	    SetBkMode(dc, OPAQUE);
+	    break;
+	case COLOR_NORMAL:
+	    SetTextColor(dc, 0);
+	    SetBkColor(dc, 0xffffff);
+	    SetBkMode(dc, TRANSPARENT);
+	    break;
+	default:
+	    break;
+	}
+	run.got_color = run.color;
+    }
+    if (run.font != run.got_font) {
+	SelectObject(dc, run.font);
+	run.got_font = run.font;
+    }
+
+#if defined(GDI_DEBUG) /*[*/
+    vtrace("[gdi] row %d col %d len %d\n", row, run.col, run.nonblank);
+#endif /*]*/
+    status = ExtTextOutW(dc,
+	    pstate.hmargin_pixels + (run.col * pstate.space_size.cx) -
+		pchar.poffX,
+	    pstate.vmargin_pixels +
+		((pstate.out_row + row + 1) * pstate.space_size.cy) -
+		pchar.poffY,
+	    0, NULL,
+	    pstate.run_text, run.nonblank, pstate.dx);
+    run.len = 0;
+    run.nonblank = 0;
+    if (status <= 0) {
+	*fail = "ExtTextOutW(run) failed";
+	return -1;
+    }
+    return 0;
+}
+
 /*
  * Print one screeful to the GDI printer.
+ *
+ * Characters are collected into runs of adjacent positions with the same
+ * font and colors, and each run is printed with one ExtTextOutW() call.
+ * Each page is started here and ended as soon as it is full, so the
+ * spooler can start on it while the rest of the job is laid out.
  */
 static int
 gdi_screenful(struct ea *ea, unsigned short rows, unsigned short cols,
@@ -895,12 +992,8 @@ gdi_screenful(struct ea *ea, unsigned short rows, unsigned short cols,
     bool fa_reverse, reverse;
     ucs4_t uc;
     int usable_rows;
-    HFONT got_font = NULL, want_font;
-#if defined(GDI_DEBUG) /*[*/
-    const char *want_font_name;
-#endif /*]*/
-    enum { COLOR_NONE, COLOR_NORMAL, COLOR_REVERSE } got_color = COLOR_NONE,
-	want_color;
+    HFONT want_font;
+    gdi_color_t want_color;
 
     devmode = (LPDEVMODE)GlobalLock(pstate.dlg.hDevMode);
 
@@ -926,9 +1019,21 @@ gdi_screenful(struct ea *ea, unsigned short rows, unsigned short cols,
 	pstate.screens = 0;
     }
 
+    /* Start a new page. The DC state is not kept across pages. */
+    if (pstate.out_row == 0) {
+	if (StartPage(dc) <= 0) {
+	    *fail = "StartPage failed";
+	    rc = -1;
+	    goto done;
+	}
+	run.got_font = NULL;
+	run.got_color = COLOR_NONE;
+    }
+
     /* If there is a caption, put it on the last line. */
     if (pstate.out_row == 0 && pstate.caption != NULL) {
 	SelectObject(dc, pstate.caption_font);
+	run.got_font = pstate.caption_font;
 	status = ExtTextOut(dc,
 		pstate.hmargin_pixels - pchar.poffX,
 		pstate.vmargin_pixels +
@@ -945,10 +1050,7 @@ gdi_screenful(struct ea *ea, unsigned short rows, unsigned short cols,
 
     /* Draw a line separating the screens. */
     if (pstate.out_row) {
-	HPEN pen;
-
-	pen = CreatePen(PS_SOLID, 3, RGB(0, 0, 0));
-	SelectObject(dc, pen);
+	SelectObject(dc, pstate.sep_pen);
 	status = MoveToEx(dc, 
 		pstate.hmargin_pixels - pchar.poffX,
 		pstate.vmargin_pixels +
@@ -970,7 +1072,6 @@ gdi_screenful(struct ea *ea, unsigned short rows, unsigned short cols,
 	    rc = -1;
 	    goto done;
 	}
-	DeleteObject(pen);
     }
 
     /* Now dump out a screen's worth. */
@@ -982,13 +1083,15 @@ gdi_screenful(struct ea *ea, unsigned short rows, unsigned short cols,
     fa_reverse = ((ea[fa_addr].gr & GR_REVERSE) != 0);
     fa_underline = ((ea[fa_addr].gr & GR_UNDERLINE) != 0);
 
+    run.len = 0;
+    run.nonblank = 0;
     for (baddr = 0, row = 0; row < ROWS; row++) {
 	if (pstate.out_row + row >= usable_rows) {
 	    break;
 	}
 	for (col = 0; col < COLS; col++, baddr++) {
-	    wchar_t w;
-	    INT wdx;
+	    int width = 1;
+	    bool blank;
 
 	    if (ea[baddr].fa) {
 		fa = ea[baddr].fa;
@@ -1016,7 +1119,9 @@ gdi_screenful(struct ea *ea, unsigned short rows, unsigned short cols,
 		switch (ctlr_dbcs_state(baddr)) {
 		case DBCS_NONE:
 		case DBCS_SB:
+		    break;
 		case DBCS_LEFT:
+		    width = 2;
 		    break;
 		case DBCS_RIGHT:
 		    /* skip altogether, we took care of it above */
@@ -1043,6 +1148,7 @@ gdi_screenful(struct ea *ea, unsigned short rows, unsigned short cols,
 		    if (uc == 0) {
 			uc = 0x3000;
 		    }
+		    width = 2;
 		    break;
 		case DBCS_RIGHT:
 		    /* skip altogether, we took care of it above */
@@ -1066,119 +1172,71 @@ gdi_screenful(struct ea *ea, unsigned short rows, unsigned short cols,
 	    if (!underline) {
 		underline = fa_underline;
 	    }
-
-	    /* Set the bg/fg color and font. */
-	    if (reverse) {
-		want_color = COLOR_REVERSE;
-	    } else {
-		want_color = COLOR_NORMAL;
-	    }
-	    if (want_color != got_color) {
-		switch (want_color) {
-		case COLOR_REVERSE:
-		    SetTextColor(dc, 0xffffff);
-		    SetBkColor(dc, 0);
-		    SetBkMode(dc, OPAQUE);
-		    break;
-		case COLOR_NORMAL:
-		    SetTextColor(dc, 0);
-		    SetBkColor(dc, 0xffffff);
-		    SetBkMode(dc, TRANSPARENT);
-		    break;
-		default:
-		    break;
-		}
-		got_color = want_color;
-	    }
+	    want_color = reverse? COLOR_REVERSE: COLOR_NORMAL;
 	    if (!high && !underline) {
 		want_font = pstate.font;
-#if defined(GDI_DEBUG) /*[*/
-		want_font_name = "Roman";
-#endif /*]*/
 	    } else if (high && !underline) {
 		want_font = pstate.bold_font;
-#if defined(GDI_DEBUG) /*[*/
-		want_font_name = "Bold";
-#endif /*]*/
 	    } else if (!high && underline) {
 		want_font = pstate.underscore_font;
-#if defined(GDI_DEBUG) /*[*/
-		want_font_name = "Underscore";
-#endif /*]*/
 	    } else {
 		want_font = pstate.bold_underscore_font;
-#if defined(GDI_DEBUG) /*[*/
-		want_font_name = "Underscore";
-#endif /*]*/
-	    }
-	    if (want_font != got_font) {
-		SelectObject(dc, want_font);
-		got_font = want_font;
-#if defined(GDI_DEBUG) /*[*/
-		vtrace("[gdi] selecting %s\n", want_font_name);
-#endif /*]*/
 	    }
 
 	    /*
-	     * Handle spaces and DBCS spaces (U+3000).
-	     * If not reverse or underline, just skip over them.
-	     * Otherwise, print a space or two spaces, using the
-	     * right font and modes.
+	     * Spaces and DBCS spaces (U+3000) that are not reverse or
+	     * underlined do not show. One in the middle of a plain run is
+	     * kept, so the run is not broken. Otherwise it is skipped.
 	     */
-	    if (uc == ' ' || uc == 0x3000) {
-		if (reverse || underline) {
-		    status = ExtTextOut(dc, pstate.hmargin_pixels +
-				(col * pstate.space_size.cx) -
-				pchar.poffX,
-			    pstate.vmargin_pixels +
-				((pstate.out_row + row + 1) *
-				 pstate.space_size.cy) -
-				pchar.poffY,
-			    0, NULL,
-			    "  ",
-			    (uc == 0x3000)? 2: 1,
-			    pstate.dx);
-		    if (status <= 0) {
-			*fail = "ExtTextOut(space) failed";
-			rc = -1;
-			goto done;
-		    }
+	    blank = (uc == ' ' || uc == 0x3000);
+	    if (blank && !reverse && !underline) {
+		if (run.len && run.next_col == col &&
+			run.color == COLOR_NORMAL &&
+			(run.font == pstate.font ||
+			 run.font == pstate.bold_font)) {
+		    pstate.run_text[run.len] = L' ';
+		    pstate.dx[run.len] = width * pstate.space_size.cx;
+		    run.len++;
+		    run.next_col += width;
 		}
 		continue;
 	    }
 
-	    /*
-	     * Emit one character at a time. This should be optimized to print
-	     * strings of characters with the same attributes.
-	     */
-#if defined(GDI_DEBUG) /*[*/
-	    if (uc != ' ') {
-		vtrace("[gdi] row %d col %d x=%ld y=%ld uc=%lx\n",
-			row, col,
-			pstate.hmargin_pixels + (col * pstate.space_size.cx) -
-			    pchar.poffX,
-			pstate.vmargin_pixels +
-			  ((pstate.out_row + row + 1) * pstate.space_size.cy) -
-			    pchar.poffY,
-			uc);
+	    /* Start a new run if this position does not continue this one. */
+	    if (run.len && (run.next_col != col || run.font != want_font ||
+			run.color != want_color)) {
+		if (gdi_flush_run(dc, row, fail) < 0) {
+		    rc = -1;
+		    goto done;
+		}
 	    }
-#endif /*]*/
-	    w = (wchar_t)uc;
-	    wdx = pstate.space_size.cx;
-	    status = ExtTextOutW(dc,
-		    pstate.hmargin_pixels + (col * pstate.space_size.cx) -
-			pchar.poffX,
-		    pstate.vmargin_pixels +
-			((pstate.out_row + row + 1) *
-			 pstate.space_size.cy) -
-			pchar.poffY,
-		    0, NULL,
-		    &w, 1, &wdx);
-	    if (status <= 0) {
-		*fail = "ExtTextOutW(image) failed";
-		rc = -1;
-		goto done;
+	    if (!run.len) {
+		run.col = col;
+		run.font = want_font;
+		run.color = want_color;
+	    }
+	    if (blank) {
+		int i;
+
+		/* A visible blank is printed as a space per column. */
+		for (i = 0; i < width; i++) {
+		    pstate.run_text[run.len] = L' ';
+		    pstate.dx[run.len] = pstate.space_size.cx;
+		    run.len++;
+		}
+	    } else {
+		pstate.run_text[run.len] = (wchar_t)uc;
+		pstate.dx[run.len] = width * pstate.space_size.cx;
+		run.len++;
 	    }
+	    run.next_col = col + width;
+	    run.nonblank = run.len;
+	}
+
+	/* Runs do not cross rows. */
+	if (gdi_flush_run(dc, row, fail) < 0) {
+	    rc = -1;
+	    goto done;
 	}
     }
 
@@ -106,10 +106,12 @@ typedef struct {
     char *server_subjects;		/* server subject names */
 
     char *rcvbuf;			/* receive buffer */
+    size_t rcvbuf_size;			/* receive buffer allocated size */
+    size_t rcv_start;			/* offset of ciphertext in rcvbuf */
     size_t rcvbuf_len;			/* receive buffer length */
 
-    char *prbuf;			/* pending record buffer */
-    size_t prbuf_len;			/* pending record buffer size */
+    char *prptr;			/* pending plaintext, in rcvbuf */
+    size_t prbuf_len;			/* pending plaintext length */
 
     char *sendbuf;			/* send buffer */
 } schannel_sio_t;
@@ -1130,12 +1132,6 @@ sio_free(schannel_sio_t *s)
 	s->rcvbuf = NULL;
     }
 
-    /* Free the record buffer. */
-    if (s->prbuf != NULL) {
-	Free(s->prbuf);
-	s->prbuf = NULL;
-    }
-
     /* Free the send buffer. */
     if (s->sendbuf != NULL) {
 	Free(s->sendbuf);
@@ -1252,6 +1248,7 @@ sio_negotiate(sio_t sio, socket_t sock, const char *hostname, bool *data)
 	 * negotiate in the first place.
 	 */
 	s->rcvbuf = Malloc(INBUF);
+	s->rcvbuf_size = INBUF;
 
 	if (config->accept_hostname != NULL) {
 	    if (!strncasecmp(accept_hostname, "DNS:", 4)) {
@@ -1362,8 +1359,8 @@ sio_negotiate(sio_t sio, socket_t sock, const char *hostname, bool *data)
     recsz = s->sizes.cbHeader + s->sizes.cbTrailer + s->sizes.cbMaximumMessage;
     if (recsz > INBUF) {
 	s->rcvbuf = Realloc(s->rcvbuf, recsz);
+	s->rcvbuf_size = recsz;
     }
-    s->prbuf = Malloc(s->sizes.cbMaximumMessage);
     s->sendbuf = Malloc(s->sizes.cbMaximumMessage);
 
     /* Success. */
@@ -1404,6 +1401,12 @@ fail:
 
 /*
  * Read and decrypt data.
+ *
+ * DecryptMessage works in place, so the plaintext is left where it is in
+ * rcvbuf, pointed to by prptr. Leftover ciphertext stays where it is too,
+ * starting at rcv_start. DecryptMessage needs a record to be contiguous, so
+ * the window goes back to the front of the buffer when it empties, and a
+ * partial record is only moved when the rest of it would not fit.
  */
 static SECURITY_STATUS
 read_decrypt(
@@ -1428,8 +1431,18 @@ read_decrypt(
 
 	/* Read some data. */
 	if (s->rcvbuf_len == 0 || ret == SEC_E_INCOMPLETE_MESSAGE) {
+	    /* Make room at the end of the window. */
+	    if (s->rcvbuf_len == 0) {
+		s->rcv_start = 0;
+	    } else if (s->rcv_start + s->rcvbuf_len + n2read >
+		    s->rcvbuf_size) {
+		memmove(s->rcvbuf, s->rcvbuf + s->rcv_start, s->rcvbuf_len);
+		s->rcv_start = 0;
+	    }
+
 	    /* Get the data */
-            nr = recv(s->sock, s->rcvbuf + s->rcvbuf_len, n2read, 0);
+            nr = recv(s->sock, s->rcvbuf + s->rcv_start + s->rcvbuf_len,
+		    n2read, 0);
 	    vtrace("TLS: %d/%d bytes of encrypted application data received\n",
 		    nr, n2read);
             if (nr == SOCKET_ERROR) {
@@ -1447,14 +1460,15 @@ read_decrypt(
 		/* Success. */
 #if defined(VERBOSE) /*[*/
 		print_hex_dump("<enc", nr,
-			(unsigned char *)s->rcvbuf + s->rcvbuf_len);
+			(unsigned char *)s->rcvbuf + s->rcv_start +
+			    s->rcvbuf_len);
 #endif /*]*/
 		s->rcvbuf_len += nr;
             }
         }
 
         /* Try to decrypt it. */
-	buffers[0].pvBuffer     = s->rcvbuf;
+	buffers[0].pvBuffer     = s->rcvbuf + s->rcv_start;
 	buffers[0].cbBuffer     = (DWORD)s->rcvbuf_len;
 	buffers[0].BufferType   = SECBUFFER_DATA;
 	buffers[1].BufferType   = SECBUFFER_EMPTY;
@@ -1509,21 +1523,21 @@ read_decrypt(
 
 	/* Check for completion. */
         if (data_buffer_ptr != NULL && data_buffer_ptr->cbBuffer) {
-	    /* Copy decrypted data to the record buffer. */
-	    memcpy(s->prbuf, data_buffer_ptr->pvBuffer,
-		    data_buffer_ptr->cbBuffer);
+	    /* Leave the decrypted data in place. */
+	    s->prptr = data_buffer_ptr->pvBuffer;
 	    s->prbuf_len = data_buffer_ptr->cbBuffer;
 	    s->rcvbuf_len = 0;
 	    vtrace("TLS: Got %lu decrypted bytes\n", data_buffer_ptr->cbBuffer);
 	}
 
-	/* Move any "extra" data to the receive buffer for next time. */
+	/* Keep any "extra" data where it is for next time. */
 	if (extra_buffer_ptr != NULL) {
 	    vtrace("TLS: %d bytes extra after decryption\n",
 		    (int)extra_buffer_ptr->cbBuffer);
-	    memmove(s->rcvbuf, extra_buffer_ptr->pvBuffer,
-		    extra_buffer_ptr->cbBuffer);
+	    s->rcv_start = (char *)extra_buffer_ptr->pvBuffer - s->rcvbuf;
 	    s->rcvbuf_len = extra_buffer_ptr->cbBuffer;
+	} else if (ret != SEC_I_RENEGOTIATE) {
+	    s->rcvbuf_len = 0;
 	}
 
 	/*
@@ -1534,6 +1548,14 @@ read_decrypt(
 	if (ret == SEC_I_RENEGOTIATE) {
 	    /* The server wants to perform another handshake sequence. */
 	    vtrace("TLS: Server requested renegotiate\n");
+
+	    /*
+	     * The handshake works from the front of the buffer. No
+	     * application data comes back with a renegotiate, so nothing in
+	     * front of the extra data needs to be kept.
+	     */
+	    memmove(s->rcvbuf, s->rcvbuf + s->rcv_start, s->rcvbuf_len);
+	    s->rcv_start = 0;
 	    ret = client_handshake_loop(s, false);
 	    if (ret != SEC_E_OK) {
 		s->negotiated = false;
@@ -1732,7 +1754,8 @@ sio_read(sio_t sio, char *buf, size_t buflen)
 	if (copy_len > buflen) {
 	    copy_len = buflen;
 	}
-	memcpy(buf, s->prbuf, copy_len);
+	memcpy(buf, s->prptr, copy_len);
+	s->prptr += copy_len;
 	s->prbuf_len -= copy_len;
 	return (int)copy_len;
     }
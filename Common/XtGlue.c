@@ -32,9 +32,15 @@
 #include "globals.h"
 #include "glue.h"
 #include "appres.h"
+#include "evprof.h"
 #include "latin1.h"
 #include "lazya.h"
+#include "observe.h"
+#include "shmexport.h"
+#include "startup.h"
+#include "stats.h"
 #include "task.h"
+#include "telnet.h"
 #include "trace.h"
 #include "utils.h"
 #if defined(_WIN32) /*[*/
@@ -49,12 +55,36 @@
 #include <errno.h>
 #if !defined(_WIN32) /*[*/
 # include <sys/wait.h>
+# include <fcntl.h>
+# include <signal.h>
+# include <unistd.h>
 #endif /*]*/
 
 #if defined(SEPARATE_SELECT_H) /*[*/
 # include <sys/select.h>
 #endif /*]*/
 
+/*
+ * Kernel event notification. On Linux we use epoll, on macOS kqueue. Other
+ * platforms, and any process that cannot create the kernel object, fall back
+ * to select().
+ */
+#if !defined(_WIN32) /*[*/
+# if defined(linux) || defined(__linux__) /*[*/
+#  include <sys/epoll.h>
+#  define USE_EPOLL	1
+# elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__DragonFly__) /*][*/
+#  include <sys/event.h>
+#  if defined(EV_OOBAND) /*[*/
+#   define USE_KQUEUE	1	/* need EV_OOBAND to report exceptions */
+#  endif /*]*/
+# endif /*]*/
+#endif /*]*/
+#if defined(USE_EPOLL) || defined(USE_KQUEUE) /*[*/
+# define USE_POLLER	1
+# define MAX_POLL_EVENTS 64
+#endif /*]*/
+
 #define InputReadMask	0x1
 #define InputExceptMask	0x2
 #define InputWriteMask	0x4
@@ -395,17 +425,57 @@ static struct {
     { NULL,            0 }
 };
 
+/* latin1[] indices sorted by name, built on first use. */
+static unsigned short *latin1_sorted = NULL;
+static unsigned latin1_count = 0;
+
+/* Compare two latin1[] indices by name, for qsort. */
+static int
+latin1_cmp(const void *a, const void *b)
+{
+    return strcmp(latin1[*(const unsigned short *)a].name,
+	    latin1[*(const unsigned short *)b].name);
+}
+
 ks_t
 string_to_key(char *s)
 {
-    int i;
+    unsigned lo = 0;
+    unsigned hi;
 
     if (strlen(s) == 1 && (*(unsigned char *)s & 0x7f) > ' ') {
 	return *(unsigned char *)s;
     }
-    for (i = 0; latin1[i].name != NULL; i++) {
-	if (!strcmp(s, latin1[i].name)) {
-	    return latin1[i].key;
+
+    /*
+     * Keymaps and compose maps look up every name they contain, so search a
+     * sorted index rather than the whole table.
+     */
+    if (latin1_sorted == NULL) {
+	unsigned i;
+
+	latin1_count = array_count(latin1) - 1;
+	latin1_sorted = (unsigned short *)Malloc(latin1_count *
+		sizeof(unsigned short));
+	for (i = 0; i < latin1_count; i++) {
+	    latin1_sorted[i] = (unsigned short)i;
+	}
+	qsort((void *)latin1_sorted, latin1_count, sizeof(unsigned short),
+		latin1_cmp);
+    }
+
+    hi = latin1_count;
+    while (lo < hi) {
+	unsigned mid = lo + (hi - lo) / 2;
+	int cmp = strcmp(s, latin1[latin1_sorted[mid]].name);
+
+	if (cmp == 0) {
+	    return latin1[latin1_sorted[mid]].key;
+	}
+	if (cmp < 0) {
+	    hi = mid;
+	} else {
+	    lo = mid + 1;
 	}
     }
     return KS_NONE;
@@ -426,153 +496,610 @@ key_to_string(ks_t k)
 
 /* Timeouts. */
 
-#if defined(_WIN32) /*[*/
-static void
-ms_ts(unsigned long long *u)
+/**
+ * Get the current time from a monotonic clock, in microseconds.
+ * Changes to the wall clock do not affect it, so they do not disturb
+ * pending timeouts.
+ *
+ * @return Monotonic time
+ */
+static unsigned long long
+monotonic_usec(void)
 {
-    FILETIME t;
-
-    /* Get the system time, in 100ns units. */
-    GetSystemTimeAsFileTime(&t);
-    memcpy(u, &t, sizeof(unsigned long long));
-
-    /* Divide by 10,000 to get ms. */
-    *u /= 10000ULL;
-}
-#endif /*]*/
-
-typedef struct timeout {
-    struct timeout *next;
 #if defined(_WIN32) /*[*/
-    unsigned long long ts;
+    return GetTickCount64() * 1000ULL;
 #else /*][*/
     struct timeval tv;
+# if defined(CLOCK_MONOTONIC) /*[*/
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+	return (ts.tv_sec * (unsigned long long)MILLION) + (ts.tv_nsec / 1000L);
+    }
+# endif /*]*/
+    gettimeofday(&tv, NULL);
+    return (tv.tv_sec * (unsigned long long)MILLION) + tv.tv_usec;
 #endif /*]*/
+}
+
+typedef struct timeout {
+    unsigned long long ts;	/* expiration time, monotonic usec */
+    unsigned long seq;		/* creation order, to break ties */
+    size_t index;		/* position in the heap */
     tofn_t proc;
     bool in_play;
 } timeout_t;
-static timeout_t *timeouts = NULL;
 
-ioid_t
-AddTimeOut(unsigned long interval_ms, tofn_t proc)
+/* Pending timeouts, kept as a binary min-heap ordered by expiration time. */
+static timeout_t **timeouts = NULL;
+static size_t n_timeouts = 0;
+static size_t max_timeouts = 0;
+static unsigned long timeout_seq = 0;
+
+/* Returns true if timeout a expires before timeout b. */
+static bool
+timeout_before(const timeout_t *a, const timeout_t *b)
+{
+    return a->ts < b->ts || (a->ts == b->ts && a->seq < b->seq);
+}
+
+/* Store a timeout at a heap position. */
+static void
+heap_set(size_t ix, timeout_t *t)
+{
+    timeouts[ix] = t;
+    t->index = ix;
+}
+
+/* Move a timeout towards the root of the heap until it is in order. */
+static void
+heap_up(size_t ix)
+{
+    timeout_t *t = timeouts[ix];
+
+    while (ix > 0) {
+	size_t parent = (ix - 1) / 2;
+
+	if (!timeout_before(t, timeouts[parent])) {
+	    break;
+	}
+	heap_set(ix, timeouts[parent]);
+	ix = parent;
+    }
+    heap_set(ix, t);
+}
+
+/* Move a timeout away from the root of the heap until it is in order. */
+static void
+heap_down(size_t ix)
+{
+    timeout_t *t = timeouts[ix];
+
+    for (;;) {
+	size_t child = (2 * ix) + 1;
+
+	if (child >= n_timeouts) {
+	    break;
+	}
+	if (child + 1 < n_timeouts &&
+		timeout_before(timeouts[child + 1], timeouts[child])) {
+	    child++;
+	}
+	if (!timeout_before(timeouts[child], t)) {
+	    break;
+	}
+	heap_set(ix, timeouts[child]);
+	ix = child;
+    }
+    heap_set(ix, t);
+}
+
+/* Remove the timeout at a heap position. */
+static void
+heap_remove(size_t ix)
+{
+    timeout_t *last = timeouts[--n_timeouts];
+
+    if (ix < n_timeouts) {
+	heap_set(ix, last);
+	heap_down(ix);
+	heap_up(last->index);
+    }
+}
+
+/**
+ * Add a timeout, optionally rounding its expiration time up so that it
+ * shares a wakeup with other timeouts.
+ *
+ * @param[in] interval_ms	Interval, in milliseconds
+ * @param[in] slack_ms		Coalescing granularity, or 0
+ * @param[in] proc		Function to call
+ *
+ * @return Timeout identifier
+ */
+static ioid_t
+add_timeout(unsigned long interval_ms, unsigned long slack_ms, tofn_t proc)
 {
     timeout_t *t_new;
-    timeout_t *t;
-    timeout_t *prev = NULL;
 
     t_new = (timeout_t *)Malloc(sizeof(timeout_t));
     t_new->proc = proc;
     t_new->in_play = false;
-#if defined(_WIN32) /*[*/
-    ms_ts(&t_new->ts);
-    t_new->ts += interval_ms;
-#else /*][*/
-    gettimeofday(&t_new->tv, NULL);
-    t_new->tv.tv_sec += interval_ms / 1000L;
-    t_new->tv.tv_usec += (interval_ms % 1000L) * 1000L;
-    if (t_new->tv.tv_usec > MILLION) {
-	t_new->tv.tv_sec += t_new->tv.tv_usec / MILLION;
-	t_new->tv.tv_usec %= MILLION;
-    }
-#endif /*]*/
+    t_new->seq = timeout_seq++;
+    t_new->ts = monotonic_usec() + (interval_ms * 1000ULL);
+    if (slack_ms > 0) {
+	unsigned long long slack_usec = slack_ms * 1000ULL;
 
-    /* Find where to insert this item. */
-    for (t = timeouts; t != NULL; t = t->next) {
-#if defined(_WIN32) /*[*/
-	if (t->ts > t_new->ts)
-#else /*][*/
-	if (t->tv.tv_sec > t_new->tv.tv_sec ||
-	    (t->tv.tv_sec == t_new->tv.tv_sec &&
-	     t->tv.tv_usec > t_new->tv.tv_usec))
-#endif /*]*/
-	{
-	    break;
-	}
-	prev = t;
+	t_new->ts = ((t_new->ts + slack_usec - 1) / slack_usec) * slack_usec;
     }
 
-    /* Insert it. */
-    if (prev == NULL) {	/* Front. */
-	t_new->next = timeouts;
-	timeouts = t_new;
-    } else if (t == NULL) {	/* Rear. */
-	t_new->next = NULL;
-	prev->next = t_new;
-    } else {			/* Middle. */
-	t_new->next = t;
-	prev->next = t_new;
+    if (n_timeouts >= max_timeouts) {
+	max_timeouts = max_timeouts? (max_timeouts * 2): 16;
+	timeouts = (timeout_t **)Realloc(timeouts,
+		max_timeouts * sizeof(timeout_t *));
     }
+    heap_set(n_timeouts, t_new);
+    heap_up(n_timeouts++);
 
     return (ioid_t)t_new;
 }
 
+ioid_t
+AddTimeOut(unsigned long interval_ms, tofn_t proc)
+{
+    return add_timeout(interval_ms, 0, proc);
+}
+
+/*
+ * Add a timeout that can expire up to slack_ms late. Timeouts with the same
+ * slack are aligned to common boundaries, so bursts of them (blinking, idle
+ * and keepalive timers) are handled in a single wakeup.
+ */
+ioid_t
+AddTimeOutCoalesced(unsigned long interval_ms, unsigned long slack_ms,
+	tofn_t proc)
+{
+    return add_timeout(interval_ms, slack_ms, proc);
+}
+
 void
 RemoveTimeOut(ioid_t timer)
 {
     timeout_t *st = (timeout_t *)timer;
-    timeout_t *t;
-    timeout_t *prev = NULL;
 
     if (st->in_play) {
 	return;
     }
-    for (t = timeouts; t != NULL; t = t->next) {
-	if (t == st) {
-	    if (prev != NULL) {
-		prev->next = t->next;
-	    } else {
-		timeouts = t->next;
-	    }
-	    Free(t);
-	    return;
-	}
-	prev = t;
+    if (st->index < n_timeouts && timeouts[st->index] == st) {
+	heap_remove(st->index);
+	Free(st);
     }
 }
 
 /* Input events. */ 
 typedef struct input {  
     struct input *next;
+#if defined(USE_POLLER) /*[*/
+    struct input *fd_next;	/* next input on the same fd */
+#endif /*]*/
     iosrc_t source; 
     int condition;
     iofn_t proc;
 } input_t;          
 static input_t *inputs = NULL;
 static bool inputs_changed = false;
+static int n_conditions = 0;
 
-ioid_t
-AddInput(iosrc_t source, iofn_t fn)
+/**
+ * Run an input callback, timing it if the event profiler is on.
+ *
+ * @param[in] ip	Input
+ */
+static void
+run_input(input_t *ip)
+{
+    iofn_t proc = ip->proc;
+    evprof_kind_t kind;
+    unsigned long long t0;
+
+    if (!appres.event_profile_ms) {
+	(*proc)(ip->source, (ioid_t)ip);
+	return;
+    }
+
+    /* The callback may remove the input, so look at it first. */
+    if (ip->condition & InputReadMask) {
+	kind = EP_INPUT;
+    } else if (ip->condition & InputWriteMask) {
+	kind = EP_OUTPUT;
+    } else {
+	kind = EP_EXCEPT;
+    }
+    t0 = monotonic_usec();
+    (*proc)(ip->source, (ioid_t)ip);
+    evprof_record((evprof_fn_t)proc, kind,
+	    (unsigned long)(monotonic_usec() - t0));
+}
+
+#if defined(USE_POLLER) /*[*/
+/* Per-fd state for the kernel poller. */
+typedef struct {
+    input_t *inputs;		/* inputs registered on this fd */
+    int mask;			/* conditions registered with the kernel */
+    bool unpollable;		/* kernel refused it; always ready */
+} fdinfo_t;
+static fdinfo_t *fdinfo = NULL;
+static int fdinfo_count = 0;
+static int n_unpollable = 0;
+
+static enum {
+    POLLER_UNKNOWN,		/* not initialized yet */
+    POLLER_KERNEL,		/* using epoll or kqueue */
+    POLLER_SELECT		/* using select */
+} poller = POLLER_UNKNOWN;
+static int poll_fd = -1;
+
+/**
+ * Initialize the kernel poller, falling back to select() if it fails.
+ */
+static void
+poller_init(void)
 {
+#if defined(USE_EPOLL) /*[*/
+    poll_fd = epoll_create1(EPOLL_CLOEXEC);
+#else /*][*/
+    poll_fd = kqueue();
+#endif /*]*/
+    if (poll_fd < 0) {
+	vtrace("Kernel poller init failed: %s, using select()\n",
+		strerror(errno));
+	poller = POLLER_SELECT;
+	return;
+    }
+    poller = POLLER_KERNEL;
+}
+
+/**
+ * Tell the kernel about the set of conditions registered for an fd.
+ *
+ * @param[in] fd	File descriptor
+ * @param[in] added	true if an input was just added to this fd
+ */
+static void
+poller_update(int fd, bool added)
+{
+    fdinfo_t *f = &fdinfo[fd];
     input_t *ip;
+    int mask = 0;
+#if defined(USE_EPOLL) /*[*/
+    struct epoll_event ev;
+#else /*][*/
+    struct kevent kev[2];
+    int nkev = 0;
+#endif /*]*/
 
-    assert(source != INVALID_IOSRC);
+    for (ip = f->inputs; ip != NULL; ip = ip->fd_next) {
+	mask |= ip->condition;
+    }
+
+    if (f->unpollable) {
+	if (mask == 0) {
+	    f->unpollable = false;
+	    n_unpollable--;
+	}
+	f->mask = mask;
+	return;
+    }
+
+    /*
+     * Even if the mask has not changed, re-register when an input is added,
+     * in case the fd was closed and reused without its inputs being removed
+     * first (closing an fd silently drops its kernel registrations).
+     */
+    if (mask == f->mask && !added) {
+	return;
+    }
+
+#if defined(USE_EPOLL) /*[*/
+    memset(&ev, 0, sizeof(ev));
+    ev.data.fd = fd;
+    if (mask & InputReadMask) {
+	ev.events |= EPOLLIN;
+    }
+    if (mask & InputWriteMask) {
+	ev.events |= EPOLLOUT;
+    }
+    if (mask & InputExceptMask) {
+	ev.events |= EPOLLPRI;
+    }
+    if (mask == 0) {
+	/* The fd may already be closed, so ignore errors. */
+	(void) epoll_ctl(poll_fd, EPOLL_CTL_DEL, fd, &ev);
+    } else if (epoll_ctl(poll_fd, EPOLL_CTL_MOD, fd, &ev) < 0 &&
+	    (errno != ENOENT ||
+	     epoll_ctl(poll_fd, EPOLL_CTL_ADD, fd, &ev) < 0)) {
+	if (errno == EPERM) {
+	    /* Regular files can't be polled. select() says they're ready. */
+	    f->unpollable = true;
+	    n_unpollable++;
+	} else {
+	    xs_warning("epoll_ctl(%d) failed: %s", fd, strerror(errno));
+	}
+    }
+#else /*][*/
+    /*
+     * kqueue has no exception filter; out-of-band data is flagged on the read
+     * filter. If only exceptions are wanted, make the read filter
+     * edge-triggered so ordinary pending data does not wake us continuously.
+     */
+    if (mask & (InputReadMask | InputExceptMask)) {
+	EV_SET(&kev[nkev++], fd, EVFILT_READ,
+		EV_ADD | ((mask & InputReadMask)? 0: EV_CLEAR), 0, 0, NULL);
+    } else if (f->mask & (InputReadMask | InputExceptMask)) {
+	EV_SET(&kev[nkev++], fd, EVFILT_READ, EV_DELETE, 0, 0, NULL);
+    }
+    if (mask & InputWriteMask) {
+	EV_SET(&kev[nkev++], fd, EVFILT_WRITE, EV_ADD, 0, 0, NULL);
+    } else if (f->mask & InputWriteMask) {
+	EV_SET(&kev[nkev++], fd, EVFILT_WRITE, EV_DELETE, 0, 0, NULL);
+    }
+    if (nkev > 0 && kevent(poll_fd, kev, nkev, NULL, 0, NULL) < 0 &&
+	    mask != 0) {
+	xs_warning("kevent(%d) failed: %s", fd, strerror(errno));
+    }
+#endif /*]*/
+    f->mask = mask;
+}
+
+/**
+ * Add an input to the per-fd table.
+ *
+ * @param[in] ip	Input to add
+ */
+static void
+poller_add(input_t *ip)
+{
+    int fd = ip->source;
+
+    if (poller == POLLER_UNKNOWN) {
+	poller_init();
+    }
+    if (poller != POLLER_KERNEL) {
+	return;
+    }
+
+    if (fd >= fdinfo_count) {
+	int new_count = fdinfo_count? fdinfo_count: 32;
+
+	while (new_count <= fd) {
+	    new_count *= 2;
+	}
+	fdinfo = (fdinfo_t *)Realloc(fdinfo, new_count * sizeof(fdinfo_t));
+	memset(&fdinfo[fdinfo_count], 0,
+		(new_count - fdinfo_count) * sizeof(fdinfo_t));
+	fdinfo_count = new_count;
+    }
+    ip->fd_next = fdinfo[fd].inputs;
+    fdinfo[fd].inputs = ip;
+    poller_update(fd, true);
+}
+
+/**
+ * Remove an input from the per-fd table.
+ *
+ * @param[in] ip	Input to remove
+ */
+static void
+poller_remove(input_t *ip)
+{
+    input_t **ipp;
+
+    if (poller != POLLER_KERNEL) {
+	return;
+    }
+    for (ipp = &fdinfo[ip->source].inputs; *ipp != NULL;
+	    ipp = &(*ipp)->fd_next) {
+	if (*ipp == ip) {
+	    *ipp = ip->fd_next;
+	    break;
+	}
+    }
+    poller_update(ip->source, false);
+}
+
+/**
+ * Run the callbacks for the inputs on an fd that match a set of ready
+ * conditions.
+ *
+ * @param[in] fd		File descriptor
+ * @param[in] ready		Ready conditions
+ * @param[out] processed_any	Set to true if a callback was run
+ *
+ * @return true if the set of inputs changed
+ */
+static bool
+poller_dispatch(int fd, int ready, bool *processed_any)
+{
+    input_t *ip, *ip_next;
+
+    if (fd < 0 || fd >= fdinfo_count) {
+	return false;
+    }
+    for (ip = fdinfo[fd].inputs; ip != NULL; ip = ip_next) {
+	ip_next = ip->fd_next;
+	if (ip->condition & ready) {
+	    run_input(ip);
+	    *processed_any = true;
+	    if (inputs_changed) {
+		/* Other events may no longer be valid. Try again. */
+		return true;
+	    }
+	}
+    }
+    return false;
+}
+
+/**
+ * Wait for events with the kernel poller and dispatch them.
+ *
+ * @param[in] tp		Timeout, or NULL to block indefinitely
+ * @param[out] processed_any	Set to true if a callback was run
+ *
+ * @return true if the set of inputs changed
+ */
+static bool
+poller_wait(struct timeval *tp, bool *processed_any)
+{
+#if defined(USE_EPOLL) /*[*/
+    struct epoll_event events[MAX_POLL_EVENTS];
+    int tmo;
+#else /*][*/
+    struct kevent events[MAX_POLL_EVENTS];
+    struct timespec ts, *tsp = NULL;
+#endif /*]*/
+    int ns;
+    int i;
+    unsigned long long wait_start;
+
+    if (n_unpollable > 0) {
+	/* Something is always ready, so don't block. */
+	static struct timeval zero = { 0L, 0L };
+
+	tp = &zero;
+    }
+
+    wait_start = monotonic_usec();
+#if defined(USE_EPOLL) /*[*/
+    if (tp == NULL) {
+	tmo = -1;
+    } else {
+	/* Round up, so we don't wake up just before a timeout expires. */
+	tmo = (int)(tp->tv_sec * 1000L + (tp->tv_usec + 999L) / 1000L);
+    }
+    ns = epoll_wait(poll_fd, events, MAX_POLL_EVENTS, tmo);
+#else /*][*/
+    if (tp != NULL) {
+	ts.tv_sec = tp->tv_sec;
+	ts.tv_nsec = tp->tv_usec * 1000L;
+	tsp = &ts;
+    }
+    ns = kevent(poll_fd, NULL, 0, events, MAX_POLL_EVENTS, tsp);
+#endif /*]*/
+    stats_add(STAT_WAIT_USEC, monotonic_usec() - wait_start);
+
+    if (ns < 0) {
+	if (errno != EINTR) {
+	    xs_warning("process_events: %s failed: %s",
+#if defined(USE_EPOLL) /*[*/
+		    "epoll_wait()",
+#else /*][*/
+		    "kevent()",
+#endif /*]*/
+		    strerror(errno));
+	}
+	return false;
+    }
+
+    vtrace("Got %u event%s\n", ns, (ns == 1)? "": "s");
+
+    inputs_changed = false;
+
+    for (i = 0; i < ns; i++) {
+	int fd;
+	int ready = 0;
+
+#if defined(USE_EPOLL) /*[*/
+	fd = events[i].data.fd;
+	if (events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) {
+	    ready |= InputReadMask;
+	}
+	if (events[i].events & (EPOLLOUT | EPOLLHUP | EPOLLERR)) {
+	    ready |= InputWriteMask;
+	}
+	if (events[i].events & EPOLLPRI) {
+	    ready |= InputExceptMask;
+	}
+#else /*][*/
+	fd = (int)events[i].ident;
+	if (events[i].filter == EVFILT_READ) {
+	    if (fd < fdinfo_count && (fdinfo[fd].mask & InputReadMask)) {
+		ready |= InputReadMask;
+	    }
+	    if (events[i].flags & EV_OOBAND) {
+		ready |= InputExceptMask;
+	    }
+	} else if (events[i].filter == EVFILT_WRITE) {
+	    ready |= InputWriteMask;
+	}
+#endif /*]*/
+	if (poller_dispatch(fd, ready, processed_any)) {
+	    return true;
+	}
+    }
+
+    if (n_unpollable > 0) {
+	input_t *ip, *ip_next;
+
+	for (ip = inputs; ip != NULL; ip = ip_next) {
+	    ip_next = ip->next;
+	    if (fdinfo[ip->source].unpollable &&
+		    (ip->condition & (InputReadMask | InputWriteMask))) {
+		run_input(ip);
+		*processed_any = true;
+		if (inputs_changed) {
+		    return true;
+		}
+	    }
+	}
+    }
+
+    return false;
+}
+#endif /*]*/
+
+/**
+ * Add an input to the list.
+ *
+ * @param[in] source	I/O source
+ * @param[in] condition	Condition to wait for
+ * @param[in] fn	Callback function
+ *
+ * @return I/O identifier
+ */
+static ioid_t
+add_input(iosrc_t source, int condition, iofn_t fn)
+{
+    input_t *ip;
 
     ip = (input_t *)Malloc(sizeof(input_t));
     ip->source = source;
-    ip->condition = InputReadMask;
+    ip->condition = condition;
     ip->proc = fn;
     ip->next = inputs;
     inputs = ip;
     inputs_changed = true;
+    n_conditions++;
+#if defined(USE_POLLER) /*[*/
+    poller_add(ip);
+#endif /*]*/
     return (ioid_t)ip;
 }
 
+ioid_t
+AddInput(iosrc_t source, iofn_t fn)
+{
+    assert(source != INVALID_IOSRC);
+
+    return add_input(source, InputReadMask, fn);
+}
+
 ioid_t
 AddExcept(iosrc_t source, iofn_t fn)
 {
 #if defined(_WIN32) /*[*/
     return 0;
 #else /*][*/
-    input_t *ip;
-
-    ip = (input_t *)Malloc(sizeof(input_t));
-    ip->source = source;
-    ip->condition = InputExceptMask;
-    ip->proc = fn;
-    ip->next = inputs;
-    inputs = ip;
-    inputs_changed = true;
-    return (ioid_t)ip;
+    return add_input(source, InputExceptMask, fn);
 #endif /*]*/
 }
 
@@ -580,16 +1107,7 @@ AddExcept(iosrc_t source, iofn_t fn)
 ioid_t
 AddOutput(iosrc_t source, iofn_t fn)
 {
-    input_t *ip;
-
-    ip = (input_t *)Malloc(sizeof(input_t));
-    ip->source = source;
-    ip->condition = InputWriteMask;
-    ip->proc = fn;
-    ip->next = inputs;
-    inputs = ip;
-    inputs_changed = true;
-    return (ioid_t)ip;
+    return add_input(source, InputWriteMask, fn);
 }
 #endif /*]*/
 
@@ -613,72 +1131,215 @@ RemoveInput(ioid_t id)
     } else {
 	inputs = ip->next;
     }
+#if defined(USE_POLLER) /*[*/
+    poller_remove(ip);
+#endif /*]*/
+    n_conditions--;
     Free(ip);
     inputs_changed = true;
 }
 
 #if !defined(_WIN32) /*[*/
-/* Child exit events. */ 
+/*
+ * Child exit events.
+ *
+ * The SIGCHLD handler writes a byte to a self-pipe, whose read end is an
+ * ordinary input, so waitpid() is only called after a child has exited.
+ * Registered children are kept in a small hash table keyed by pid.
+ */
+#define CHILD_HASH	32	/* number of child hash buckets */
+#define CHILD_HASH_IX(pid)	((unsigned)(pid) % CHILD_HASH)
+
 typedef struct child_exit {  
     struct child_exit *next;
     pid_t pid;
     childfn_t proc;
 } child_exit_t;          
-static child_exit_t *child_exits = NULL;
+static child_exit_t *child_exits[CHILD_HASH];
+static int child_pipe[2] = { -1, -1 };
+static bool child_poll = false;	/* no self-pipe, poll on every pass */
 
-ioid_t
-AddChild(pid_t pid, childfn_t fn)
+/**
+ * SIGCHLD handler. Wakes up the event loop.
+ *
+ * @param[in] ignored	Signal number
+ */
+static void
+sigchld_wakeup(int ignored)
 {
-    child_exit_t *cx;
-
-    assert(pid != 0 && pid != -1);
+    int save_errno = errno;
+    char c = 0;
 
-    cx = (child_exit_t *)Malloc(sizeof(child_exit_t));
-    cx->pid = pid;
-    cx->proc = fn;
-    cx->next = child_exits;
-    child_exits = cx;
-    return (ioid_t)cx;
+    if (write(child_pipe[1], &c, 1) < 0) {
+	/* The pipe is full, so a wakeup is already pending. */
+    }
+    errno = save_errno;
 }
 
 /**
- * Poll for an exited child processes.
+ * Reap exited children and call their callbacks.
  *
  * @return true if a waited-for child exited
  */
 static bool
-poll_children(void)
+child_reap(void)
 {
     pid_t pid;
     int status = 0;
-    child_exit_t *c;
-    child_exit_t *next = NULL;
-    child_exit_t *prev = NULL;
     bool any = false;
 
     while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
-	for (c = child_exits; c != NULL; c = next) {
-	    next = c->next;
-	    if (c->pid == pid) {
-		(*c->proc)((ioid_t)c, status);
-		if (prev) {
-		    prev->next = next;
-		} else {
-		    child_exits = next;
-		}
-		Free(c);
-		any = true;
-	    } else {
-		prev = c;
-	    }
+	child_exit_t **cp = &child_exits[CHILD_HASH_IX(pid)];
+	child_exit_t *c;
+
+	while ((c = *cp) != NULL && c->pid != pid) {
+	    cp = &c->next;
+	}
+	if (c != NULL) {
+	    *cp = c->next;
+	    (*c->proc)((ioid_t)c, status);
+	    Free(c);
+	    any = true;
 	}
     }
     return any;
 }
+
+/**
+ * Self-pipe input callback.
+ *
+ * @param[in] fd	Self-pipe read end
+ * @param[in] id	Input ID
+ */
+static void
+child_pipe_input(iosrc_t fd, ioid_t id)
+{
+    char buf[64];
+
+    /* Drain the pipe before reaping, so no exit is missed. */
+    while (read(child_pipe[0], buf, sizeof(buf)) > 0) {
+    }
+    child_reap();
+}
+
+/**
+ * Set up the self-pipe and the SIGCHLD handler.
+ *
+ * @return true for success
+ */
+static bool
+child_pipe_init(void)
+{
+    struct sigaction sa;
+    int i;
+
+    if (pipe(child_pipe) < 0) {
+	vtrace("AddChild: pipe: %s, polling for child exits\n",
+		strerror(errno));
+	child_pipe[0] = child_pipe[1] = -1;
+	return false;
+    }
+    for (i = 0; i < 2; i++) {
+	fcntl(child_pipe[i], F_SETFD, 1);
+	fcntl(child_pipe[i], F_SETFL, fcntl(child_pipe[i], F_GETFL) | O_NONBLOCK);
+    }
+    AddInput(child_pipe[0], child_pipe_input);
+
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_handler = sigchld_wakeup;
+    sigemptyset(&sa.sa_mask);
+    sa.sa_flags = SA_RESTART | SA_NOCLDSTOP;
+    sigaction(SIGCHLD, &sa, NULL);
+
+    /* A child may have exited before the handler was installed. */
+    sigchld_wakeup(SIGCHLD);
+    return true;
+}
+
+ioid_t
+AddChild(pid_t pid, childfn_t fn)
+{
+    child_exit_t *cx;
+    unsigned ix;
+
+    assert(pid != 0 && pid != -1);
+
+    if (child_pipe[0] == -1 && !child_poll && !child_pipe_init()) {
+	child_poll = true;
+    }
+
+    ix = CHILD_HASH_IX(pid);
+    cx = (child_exit_t *)Malloc(sizeof(child_exit_t));
+    cx->pid = pid;
+    cx->proc = fn;
+    cx->next = child_exits[ix];
+    child_exits[ix] = cx;
+    return (ioid_t)cx;
+}
 #endif /*]*/
 
 #if defined(_WIN32) /*[*/
-#define MAX_HA	256
+#define WAIT_SLICE_MS	10	/* slice for waiting on more than 64 handles */
+
+static HANDLE *ha = NULL;	/* handles to wait for */
+static DWORD ha_max = 0;	/* allocated size of ha[] */
+
+/*
+ * Wait for any of nha handles, like WaitForMultipleObjects.
+ *
+ * WaitForMultipleObjects takes at most MAXIMUM_WAIT_OBJECTS (64) handles.
+ * Past that, the handles are checked in groups of 64 without waiting, and
+ * between checks the wait blocks for up to WAIT_SLICE_MS on the first
+ * group, which holds the longest-registered inputs (the console and host
+ * connection), so those still get an immediate response.
+ */
+static DWORD
+wait_handles(DWORD nha, HANDLE *handles, DWORD tmo)
+{
+    unsigned long long deadline =
+	(tmo == INFINITE)? 0: monotonic_usec() + tmo * 1000ULL;
+
+    if (nha <= MAXIMUM_WAIT_OBJECTS) {
+	return WaitForMultipleObjects(nha, handles, FALSE, tmo);
+    }
+
+    for (;;) {
+	DWORD base;
+	DWORD slice = WAIT_SLICE_MS;
+	DWORD ret;
+
+	for (base = 0; base < nha; base += MAXIMUM_WAIT_OBJECTS) {
+	    DWORD n = nha - base;
+
+	    if (n > MAXIMUM_WAIT_OBJECTS) {
+		n = MAXIMUM_WAIT_OBJECTS;
+	    }
+	    ret = WaitForMultipleObjects(n, handles + base, FALSE, 0);
+	    if (ret == WAIT_FAILED) {
+		return ret;
+	    }
+	    if (ret < WAIT_OBJECT_0 + n) {
+		return ret + base;
+	    }
+	}
+
+	if (tmo != INFINITE) {
+	    unsigned long long now = monotonic_usec();
+
+	    if (now >= deadline) {
+		return WAIT_TIMEOUT;
+	    }
+	    if ((deadline - now + 999) / 1000 < slice) {
+		slice = (DWORD)((deadline - now + 999) / 1000);
+	    }
+	}
+	ret = WaitForMultipleObjects(MAXIMUM_WAIT_OBJECTS, handles, FALSE,
+		slice);
+	if (ret == WAIT_FAILED || ret < WAIT_OBJECT_0 + MAXIMUM_WAIT_OBJECTS) {
+	    return ret;
+	}
+    }
+}
 #endif /*]*/
 
 /*
@@ -696,18 +1357,18 @@ static bool
 process_some_events(bool block, bool *processed_any)
 {
 #if defined(_WIN32) /*[*/
-    HANDLE ha[MAX_HA];
     DWORD nha;
     DWORD tmo;
     DWORD ret;
-    unsigned long long now;
     int i;
 #else /*][*/
     int ne = 0;
     fd_set rfds, wfds, xfds;
     int ns;
-    struct timeval now, twait, *tp;
+    struct timeval twait, *tp;
 #endif /*]*/
+    unsigned long long now;
+    unsigned long long wait_start;
     input_t *ip, *ip_next;
     struct timeout *t;
     bool any_events_pending;
@@ -715,15 +1376,9 @@ process_some_events(bool block, bool *processed_any)
 #   if defined(_WIN32) /*[*/
 #    define SOURCE_READY    (ret == WAIT_OBJECT_0 + i)
 #    define WAIT_BAD        (ret == WAIT_FAILED)
-#    define GET_TS(v)       ms_ts(v)
-#    define EXPIRED(t, now) (t->ts <= now)
 #   else /*][*/
 #    define SOURCE_READY    FD_ISSET(ip->source, &rfds)
 #    define WAIT_BAD        (ns < 0)
-#    define GET_TS(v)       gettimeofday(v, NULL);
-#    define EXPIRED(t, now) (t->tv.tv_sec < now.tv_sec || \
-			     (t->tv.tv_sec == now.tv_sec && \
-			      t->tv.tv_usec < now.tv_usec))
 #   endif /*]*/
 
     *processed_any = false;
@@ -738,10 +1393,21 @@ process_some_events(bool block, bool *processed_any)
     FD_ZERO(&xfds);
 #endif /*]*/
 
+#if defined(USE_POLLER) /*[*/
+    if (poller == POLLER_KERNEL) {
+	/* The kernel already knows what we're waiting for. */
+	ne = n_conditions;
+	any_events_pending = (ne > 0);
+    } else
+#endif /*]*/
     for (ip = inputs; ip != NULL; ip = ip->next) {
 	/* Set pending input event. */
 	if ((unsigned long)ip->condition & InputReadMask) {
 #if defined(_WIN32) /*[*/
+	    if (nha >= ha_max) {
+		ha_max = ha_max? ha_max * 2: MAXIMUM_WAIT_OBJECTS;
+		ha = (HANDLE *)Realloc(ha, ha_max * sizeof(HANDLE));
+	    }
 	    ha[nha++] = ip->source;
 #else /*][*/
 	    FD_SET(ip->source, &rfds);
@@ -767,25 +1433,17 @@ process_some_events(bool block, bool *processed_any)
     }
 
     if (block) {
-	if (timeouts != NULL) {
+	if (n_timeouts > 0) {
+	    unsigned long long delta;
+
 	    /* Compute how long to wait for the first event. */
-	    GET_TS(&now);
+	    now = monotonic_usec();
+	    delta = (timeouts[0]->ts > now)? (timeouts[0]->ts - now): 0;
 #if defined(_WIN32) /*[*/
-	    if (now > timeouts->ts) {
-		tmo = 0;
-	    } else {
-		tmo = (DWORD)(timeouts->ts - now);
-	    }
+	    tmo = (DWORD)((delta + 999) / 1000);
 #else /*][*/
-	    twait.tv_sec = timeouts->tv.tv_sec - now.tv_sec;
-	    twait.tv_usec = timeouts->tv.tv_usec - now.tv_usec;
-	    if (twait.tv_usec < 0L) {
-		twait.tv_sec--;
-		twait.tv_usec += MILLION;
-	    }
-	    if (twait.tv_sec < 0L) {
-		twait.tv_sec = twait.tv_usec = 0L;
-	    }
+	    twait.tv_sec = (time_t)(delta / MILLION);
+	    twait.tv_usec = (long)(delta % MILLION);
 	    tp = &twait;
 #endif /*]*/
 	    any_events_pending = true;
@@ -808,8 +1466,8 @@ process_some_events(bool block, bool *processed_any)
     }
 
 #if !defined(_WIN32) /*[*/
-    /* Poll for children. */
-    if (poll_children()) {
+    /* Poll for children, if there is no self-pipe to tell us. */
+    if (child_poll && child_reap()) {
 	return false;
     }
 #endif /*]*/
@@ -831,7 +1489,11 @@ process_some_events(bool block, bool *processed_any)
 		(nha == 1)? "": "s",
 		(int)tmo);
     }
-    ret = WaitForMultipleObjects(nha, ha, FALSE, tmo);
+    if (tmo != 0) {
+	trace_flush();
+    }
+    wait_start = monotonic_usec();
+    ret = wait_handles(nha, ha, tmo);
 #else /*][*/
     if (tp == NULL) {
 	vtrace("Waiting for %d event%s\n",
@@ -851,8 +1513,21 @@ process_some_events(bool block, bool *processed_any)
 		(ne == 1)? "": "s",
 		sec, msec);
     }
+    if (tp == NULL || tp->tv_sec || tp->tv_usec) {
+	trace_flush();
+    }
+#if defined(USE_POLLER) /*[*/
+    if (poller == POLLER_KERNEL) {
+	if (poller_wait(tp, processed_any)) {
+	    return false;
+	}
+	goto timeouts;
+    }
+#endif /*]*/
+    wait_start = monotonic_usec();
     ns = select(FD_SETSIZE, &rfds, &wfds, &xfds, tp);
 #endif /*[*/
+    stats_add(STAT_WAIT_USEC, monotonic_usec() - wait_start);
 
     if (WAIT_BAD) {
 #if !defined(_WIN32) /*[*/
@@ -886,7 +1561,7 @@ process_some_events(bool block, bool *processed_any)
 	/* Check for input ready. */
 	if (((unsigned long)ip->condition & InputReadMask) &&
 		SOURCE_READY) {
-	    (*ip->proc)(ip->source, (ioid_t)ip);
+	    run_input(ip);
 	    *processed_any = true;
 	    if (inputs_changed) {
 		/* Other events may no longer be valid. Try again. */
@@ -898,7 +1573,7 @@ process_some_events(bool block, bool *processed_any)
 	/* Check for output ready. */
 	if (((unsigned long)ip->condition & InputWriteMask) &&
 		FD_ISSET(ip->source, &wfds)) {
-	    (*ip->proc)(ip->source, (ioid_t)ip);
+	    run_input(ip);
 	    *processed_any = true;
 	    if (inputs_changed) {
 		/* Other events may no longer be valid. Try again. */
@@ -909,7 +1584,7 @@ process_some_events(bool block, bool *processed_any)
 	/* Check for exception ready. */
 	if (((unsigned long)ip->condition & InputExceptMask) &&
 		FD_ISSET(ip->source, &xfds)) {
-	    (*ip->proc)(ip->source, (ioid_t)ip);
+	    run_input(ip);
 	    *processed_any = true;
 	    if (inputs_changed) {
 		/* Other events may no longer be valid. Try again. */
@@ -919,19 +1594,26 @@ process_some_events(bool block, bool *processed_any)
 #endif /*]*/
     }
 
+#if defined(USE_POLLER) /*[*/
+timeouts:
+#endif /*]*/
     /* See what's expired. */
-    if (timeouts != NULL) {
-	GET_TS(&now);
-	while ((t = timeouts) != NULL) {
-	    if (EXPIRED(t, now)) {
-		timeouts = t->next;
-		t->in_play = true;
+    if (n_timeouts > 0) {
+	now = monotonic_usec();
+	while (n_timeouts > 0 && (t = timeouts[0])->ts <= now) {
+	    heap_remove(0);
+	    t->in_play = true;
+	    if (appres.event_profile_ms) {
+		unsigned long long t0 = monotonic_usec();
+
 		(*t->proc)((ioid_t)t);
-		*processed_any = true;
-		Free(t);
+		evprof_record((evprof_fn_t)t->proc, EP_TIMEOUT,
+			(unsigned long)(monotonic_usec() - t0));
 	    } else {
-		break;
+		(*t->proc)((ioid_t)t);
 	    }
+	    *processed_any = true;
+	    Free(t);
 	}
     }
 
@@ -954,12 +1636,24 @@ process_events(bool block)
 
     /* Process events until no more are ready. */
     while (!done) {
+	/* Bring the shared-memory screen up to date before blocking. */
+	shmexport_update();
+
+	/* Pass any new host output to observers. */
+	observe_flush();
+
 	if (run_tasks()) {
+	    net_flush_output();
 	    return true;
 	}
 
+	/* Send collected host output before waiting for the reply. */
+	net_flush_output();
+
 	/* Process some events. */
 	done = process_some_events(block, &any_this_time);
+	stats_inc(STAT_LOOPS);
+	startup_mark(STARTUP_LOOP);
 
 	/* Flush the lazy allocator ring. */
 	lazya_flush();
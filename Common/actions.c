@@ -38,17 +38,31 @@
 #include "appres.h"
 
 #include "actions.h"
+#include "varbuf.h"	/* must precede hibernate.h */
+#include "hibernate.h"
+#include "keylat.h"
 #include "lazya.h"
 #include "popups.h"
 #include "resources.h"
+#include "stats.h"
 #include "task.h"
 #include "trace.h"
 #include "utils.h"
-#include "varbuf.h"
 #include "vstatus.h"
 
 llist_t actions_list = LLIST_INIT(actions_list);
 unsigned actions_list_count;
+unsigned actions_generation;	/* bumped when an action is added */
+
+/*
+ * Indices for actions_list: a case-insensitive hash table for exact lookups,
+ * and an array sorted by name (rebuilt when actions are added) for
+ * abbreviations.
+ */
+#define ACTION_HASH_SIZE	256	/* must be a power of 2 */
+static action_elt_t *action_hash[ACTION_HASH_SIZE];
+static action_elt_t **action_sorted = NULL;
+static unsigned action_sorted_count = 0;
 
 enum iaction ia_cause;
 const char *ia_name[] = {
@@ -68,6 +82,111 @@ typedef struct {
 static llist_t suppressed = LLIST_INIT(suppressed);
 static bool suppressed_initted = false;
 
+/**
+ * Hash an action name, ignoring case.
+ *
+ * @param[in] name	Action name
+ *
+ * @return Hash bucket index
+ */
+static unsigned
+action_hash_name(const char *name)
+{
+    unsigned h = 2166136261U;	/* FNV-1a */
+    unsigned char c;
+
+    while ((c = (unsigned char)*name++) != '\0') {
+	h = (h ^ (unsigned char)tolower(c)) * 16777619U;
+    }
+    return h & (ACTION_HASH_SIZE - 1);
+}
+
+/**
+ * Look up an action by its exact name, ignoring case.
+ *
+ * @param[in] name	Action name
+ *
+ * @return Action element, or NULL if not found
+ */
+action_elt_t *
+lookup_action(const char *name)
+{
+    action_elt_t *e;
+
+    for (e = action_hash[action_hash_name(name)]; e != NULL;
+	    e = e->hash_next) {
+	if (!strcasecmp(e->t.name, name)) {
+	    return e;
+	}
+    }
+    return NULL;
+}
+
+/* Compare two action elements by name, for qsort. */
+static int
+action_elt_cmp(const void *a, const void *b)
+{
+    return strcasecmp((*(action_elt_t **)a)->t.name,
+	    (*(action_elt_t **)b)->t.name);
+}
+
+/**
+ * Look up an action by an abbreviation of its name, ignoring case.
+ *
+ * @param[in] prefix	Abbreviated action name
+ * @param[out] ambiguous Returned true if more than one action matches
+ *
+ * @return Action element, or NULL if not found or ambiguous
+ */
+action_elt_t *
+lookup_action_prefix(const char *prefix, bool *ambiguous)
+{
+    size_t len = strlen(prefix);
+    unsigned lo = 0;
+    unsigned hi;
+
+    *ambiguous = false;
+
+    if (action_sorted == NULL) {
+	action_elt_t *e;
+	unsigned i = 0;
+
+	action_sorted = (action_elt_t **)Malloc(actions_list_count *
+		sizeof(action_elt_t *));
+	FOREACH_LLIST(&actions_list, e, action_elt_t *) {
+	    action_sorted[i++] = e;
+	} FOREACH_LLIST_END(&actions_list, e, action_elt_t *);
+	action_sorted_count = i;
+	qsort((void *)action_sorted, action_sorted_count,
+		sizeof(action_elt_t *), action_elt_cmp);
+    }
+
+    /*
+     * Find the first name that sorts at or after the prefix. Any names that
+     * match the prefix follow it directly.
+     */
+    hi = action_sorted_count;
+    while (lo < hi) {
+	unsigned mid = lo + (hi - lo) / 2;
+
+	if (strcasecmp(action_sorted[mid]->t.name, prefix) < 0) {
+	    lo = mid + 1;
+	} else {
+	    hi = mid;
+	}
+    }
+    if (lo >= action_sorted_count ||
+	    strncasecmp(action_sorted[lo]->t.name, prefix, len)) {
+	return NULL;
+    }
+    if (lo + 1 < action_sorted_count &&
+	    !strncasecmp(action_sorted[lo + 1]->t.name, prefix, len)) {
+	*ambiguous = true;
+	return NULL;
+    }
+    return action_sorted[lo];
+}
+
 /* Initialize the list of suppressed actions. */
 static void
 init_suppressed(const char *actions)
@@ -82,8 +201,6 @@ init_suppressed(const char *actions)
     a = lazya(NewString(actions));
     while ((action = strtok(a, " \t\r\n")) != NULL) {
 	size_t sl = strlen(action);
-	action_elt_t *e;
-	bool found = false;
 
 	/* Prime for the next strtok() call. */
 	a = NULL;
@@ -95,13 +212,7 @@ init_suppressed(const char *actions)
 	}
 
 	/* Make sure the action they are suppressing is real. */
-	FOREACH_LLIST(&actions_list, e, action_elt_t *) {
-	    if (!strcasecmp(e->t.name, action)) {
-		found = true;
-		break;
-	    }
-	} FOREACH_LLIST_END(&actions_list, e, action_elt_t *);
-	if (!found) {
+	if (lookup_action(action) == NULL) {
 	    vtrace("Warning: action '%s' in %s not found\n", action,
 		    ResSuppressActions);
 	    continue;
@@ -303,6 +414,8 @@ run_action_entry(action_elt_t *e, enum iaction cause, unsigned count,
 {
     bool ret;
 
+    hibernate_touch();
+
     if (action_suppressed(e->t.name)) {
 	vtrace("%s() [suppressed]\n", e->t.name);
 	return false;
@@ -317,8 +430,14 @@ run_action_entry(action_elt_t *e, enum iaction cause, unsigned count,
 
     ia_cause = cause;
     current_action_name = e->t.name;
+    e->runs++;
+    stats_inc(STAT_ACTIONS);
+    if (IA_IS_KEY(cause)) {
+	keylat_action();
+    }
     ret = (*e->t.action)(cause, count, parms);
     current_action_name = NULL;
+    keylat_end();
     return ret;
 }
 
@@ -337,17 +456,17 @@ register_actions(action_table_t *new_actions, unsigned count)
     for (i = 0; i < count; i++) {
 	action_elt_t *e;
 	action_elt_t *before;
+	unsigned h;
+
+	/* Replace an existing action. */
+	if ((e = lookup_action(new_actions[i].name)) != NULL) {
+	    e->t = new_actions[i]; /* struct copy */
+	    return;
+	}
 
 	before = NULL;
 	FOREACH_LLIST(&actions_list, e, action_elt_t *) {
-	    int cmp;
-
-	    cmp = strcasecmp(e->t.name, new_actions[i].name);
-	    if (cmp == 0) {
-		/* Replace. */
-		e->t = new_actions[i]; /* struct copy */
-		return;
-	    } else if (cmp < 0) {
+	    if (strcasecmp(e->t.name, new_actions[i].name) < 0) {
 		/* Goes ahead of this one. */
 		before = e;
 		break;
@@ -356,7 +475,13 @@ register_actions(action_table_t *new_actions, unsigned count)
 
 	e = Malloc(sizeof(action_elt_t));
 	e->t = new_actions[i]; /* struct copy */
+	e->runs = 0;
 	llist_init(&e->list);
+	h = action_hash_name(e->t.name);
+	e->hash_next = action_hash[h];
+	action_hash[h] = e;
+	Replace(action_sorted, NULL);
+	actions_generation++;
 
 	if (before) {
 	    /* Insert before found element. */
@@ -0,0 +1,380 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	allocs.c
+ *		Allocation accounting.
+ *
+ * When the allocAccounting resource is set, every block handed out by
+ * Malloc(), Calloc(), Realloc() or NewString() is remembered along with the
+ * source file that asked for it, so Query(Allocations) can report live bytes
+ * and allocation counts per file and per subsystem. Blocks allocated while
+ * accounting was off are not tracked, and freeing them is ignored.
+ */
+
+#include "globals.h"
+
+#include <inttypes.h>
+
+#include "allocs.h"
+#include "appres.h"
+#include "boolstr.h"
+#include "lazya.h"
+#include "names.h"
+#include "popups.h"
+#include "query.h"
+#include "resources.h"
+#include "toggles.h"
+#include "utils.h"
+#include "varbuf.h"
+
+#define MAX_SITES	512		/* source files tracked */
+#define SITE_HASH	1024		/* must be a power of 2 > MAX_SITES */
+#define BLOCKS_MIN	4096		/* initial block table size */
+
+/* Per-file counters. */
+typedef struct {
+    const char *file;			/* source file, NULL for untagged */
+    uint64_t live_bytes;		/* bytes currently allocated */
+    uint64_t live_count;		/* blocks currently allocated */
+    uint64_t allocs;			/* allocations, including reallocs */
+    uint64_t bytes;			/* bytes allocated */
+    uint64_t peak_bytes;		/* high-water mark of live_bytes */
+    size_t largest;			/* largest single block */
+} site_t;
+
+/* A live block. */
+typedef struct {
+    void *p;
+    size_t len;
+    unsigned site;
+} block_t;
+
+static site_t sites[MAX_SITES];
+static unsigned n_sites;
+static int site_hash[SITE_HASH];	/* site index + 1, 0 if empty */
+
+static block_t *blocks;			/* open-addressed block table */
+static size_t n_slots;
+static size_t n_blocks;
+
+/* Hash a pointer. */
+static size_t
+ptr_hash(const void *p, size_t size)
+{
+    uint64_t u = (uint64_t)(uintptr_t)p;
+
+    return (size_t)((u >> 4) * 0x9e3779b97f4a7c15ULL >> 20) & (size - 1);
+}
+
+/* Find or create the counters for a source file. */
+static unsigned
+site_find(const char *file)
+{
+    size_t h = ptr_hash(file, SITE_HASH);
+
+    while (site_hash[h]) {
+	if (sites[site_hash[h] - 1].file == file) {
+	    return site_hash[h] - 1;
+	}
+	h = (h + 1) & (SITE_HASH - 1);
+    }
+    if (file != NULL && n_sites >= MAX_SITES - 1) {
+	/* Out of room: charge it to the untagged site. */
+	return site_find(NULL);
+    }
+    sites[n_sites].file = file;
+    site_hash[h] = ++n_sites;
+    return n_sites - 1;
+}
+
+/*
+ * Grow the block table. It uses malloc() directly, so it does not account
+ * for itself.
+ */
+static bool
+blocks_grow(void)
+{
+    size_t new_slots = n_slots? n_slots * 2: BLOCKS_MIN;
+    block_t *new_blocks = (block_t *)calloc(new_slots, sizeof(block_t));
+    size_t i;
+
+    if (new_blocks == NULL) {
+	return false;
+    }
+    for (i = 0; i < n_slots; i++) {
+	if (blocks[i].p != NULL) {
+	    size_t h = ptr_hash(blocks[i].p, new_slots);
+
+	    while (new_blocks[h].p != NULL) {
+		h = (h + 1) & (new_slots - 1);
+	    }
+	    new_blocks[h] = blocks[i];
+	}
+    }
+    free(blocks);
+    blocks = new_blocks;
+    n_slots = new_slots;
+    return true;
+}
+
+/* Remember a new block. */
+static void
+block_add(void *p, size_t len, const char *file)
+{
+    unsigned s = site_find(file);
+    site_t *site = &sites[s];
+    size_t h;
+
+    if (2 * (n_blocks + 1) > n_slots && !blocks_grow()) {
+	return;
+    }
+    h = ptr_hash(p, n_slots);
+    while (blocks[h].p != NULL && blocks[h].p != p) {
+	h = (h + 1) & (n_slots - 1);
+    }
+    if (blocks[h].p == p) {
+	/* Freed behind our back (with free()) and handed out again. */
+	sites[blocks[h].site].live_count--;
+	sites[blocks[h].site].live_bytes -= blocks[h].len;
+    } else {
+	n_blocks++;
+    }
+    blocks[h].p = p;
+    blocks[h].len = len;
+    blocks[h].site = s;
+
+    site->allocs++;
+    site->bytes += len;
+    site->live_count++;
+    site->live_bytes += len;
+    if (site->live_bytes > site->peak_bytes) {
+	site->peak_bytes = site->live_bytes;
+    }
+    if (len > site->largest) {
+	site->largest = len;
+    }
+}
+
+/* Forget a block, if it is being tracked. */
+static void
+block_remove(void *p)
+{
+    size_t h, j;
+
+    if (!n_blocks) {
+	return;
+    }
+    h = ptr_hash(p, n_slots);
+    while (blocks[h].p != p) {
+	if (blocks[h].p == NULL) {
+	    return;
+	}
+	h = (h + 1) & (n_slots - 1);
+    }
+    sites[blocks[h].site].live_count--;
+    sites[blocks[h].site].live_bytes -= blocks[h].len;
+    n_blocks--;
+
+    /* Shift back any entry that probed past this slot. */
+    j = h;
+    for (;;) {
+	size_t k;
+
+	blocks[h].p = NULL;
+	do {
+	    j = (j + 1) & (n_slots - 1);
+	    if (blocks[j].p == NULL) {
+		return;
+	    }
+	    k = ptr_hash(blocks[j].p, n_slots);
+	} while (h <= j? (h < k && k <= j): (h < k || k <= j));
+	blocks[h] = blocks[j];
+	h = j;
+    }
+}
+
+/* Allocation hook, called from Malloc.c. */
+static void
+allocs_track(void *old, void *p, size_t len, const char *file)
+{
+    if (!appres.alloc_accounting) {
+	return;
+    }
+    if (old != NULL) {
+	block_remove(old);
+    }
+    if (p != NULL) {
+	block_add(p, len, file);
+    }
+}
+
+/* Discard everything. */
+static void
+allocs_reset(void)
+{
+    free(blocks);
+    blocks = NULL;
+    n_slots = 0;
+    n_blocks = 0;
+    memset(sites, 0, sizeof(sites));
+    memset(site_hash, 0, sizeof(site_hash));
+    n_sites = 0;
+}
+
+/* Return the name of a source file, without its directory. */
+static const char *
+site_file(const site_t *site)
+{
+    const char *slash;
+
+    if (site->file == NULL) {
+	return "unknown";
+    }
+    slash = strrchr(site->file, '/');
+    if (slash == NULL) {
+	slash = strrchr(site->file, '\\');
+    }
+    return (slash != NULL)? slash + 1: site->file;
+}
+
+/*
+ * Return the subsystem a source file belongs to: the name of its directory
+ * if that is a front end (b3270, c3270 and so on), otherwise its name up to
+ * the first punctuation, so ft_dft.c is ft and httpd-core.c is httpd.
+ */
+static const char *
+site_subsystem(const site_t *site)
+{
+    const char *file = site_file(site);
+    size_t n;
+
+    if (file > site->file + 4) {
+	const char *dir = file - 2;
+
+	while (dir > site->file && dir[-1] != '/' && dir[-1] != '\\') {
+	    dir--;
+	}
+	n = file - 1 - dir;
+	if (n == 5 && !strncmp(dir + 1, "3270", 4)) {
+	    return lazyaf("%.*s", (int)n, dir);
+	}
+    }
+    n = strcspn(file, "_-.");
+    return lazyaf("%.*s", (int)n, file);
+}
+
+/* Order sites by live bytes, largest first. */
+static int
+site_compare(const void *a, const void *b)
+{
+    const site_t *sa = *(site_t **)a;
+    const site_t *sb = *(site_t **)b;
+
+    if (sa->live_bytes > sb->live_bytes) {
+	return -1;
+    }
+    return sa->live_bytes < sb->live_bytes;
+}
+
+/*
+ * Allocations query.
+ * Returns one line per source file, in decreasing order of live bytes,
+ * followed by a total. Each line starts with the subsystem and the file.
+ */
+static const char *
+allocs_query(void)
+{
+    site_t *sorted[MAX_SITES];
+    uint64_t live_bytes = 0, live_count = 0, allocs = 0, bytes = 0;
+    varbuf_t r;
+    unsigned i;
+
+    if (!appres.alloc_accounting) {
+	return NULL;
+    }
+    for (i = 0; i < n_sites; i++) {
+	sorted[i] = &sites[i];
+    }
+    qsort(sorted, n_sites, sizeof(site_t *), site_compare);
+
+    vb_init(&r);
+    for (i = 0; i < n_sites; i++) {
+	site_t *s = sorted[i];
+
+	vb_appendf(&r, "%s %s live-bytes %"PRIu64" live-count %"PRIu64
+		" allocs %"PRIu64" bytes %"PRIu64" peak-bytes %"PRIu64
+		" largest %zu\n",
+		site_subsystem(s), site_file(s), s->live_bytes,
+		s->live_count, s->allocs, s->bytes, s->peak_bytes,
+		s->largest);
+	live_bytes += s->live_bytes;
+	live_count += s->live_count;
+	allocs += s->allocs;
+	bytes += s->bytes;
+    }
+    vb_appendf(&r, "Total live-bytes %"PRIu64" live-count %"PRIu64
+	    " allocs %"PRIu64" bytes %"PRIu64,
+	    live_bytes, live_count, allocs, bytes);
+    return lazya(vb_consume(&r));
+}
+
+/* The allocAccounting resource changed. */
+static bool
+toggle_alloc_accounting(const char *name _is_unused, const char *value)
+{
+    bool previous = appres.alloc_accounting;
+    const char *errmsg = boolstr(value, &appres.alloc_accounting);
+
+    if (errmsg != NULL) {
+	popup_an_error("%s %s", ResAllocAccounting, errmsg);
+	return false;
+    }
+
+    /* Start afresh each time accounting is turned on. */
+    if (appres.alloc_accounting != previous) {
+	allocs_reset();
+    }
+    return true;
+}
+
+/*
+ * Allocation accounting module registration.
+ */
+void
+allocs_register(void)
+{
+    static query_t queries[] = {
+	{ KwAllocations, allocs_query, NULL, false, true }
+    };
+
+    register_extended_toggle(ResAllocAccounting, toggle_alloc_accounting,
+	    NULL, NULL, (void **)&appres.alloc_accounting, XRM_BOOLEAN);
+    register_queries(queries, array_count(queries));
+    alloc_track = allocs_track;
+}
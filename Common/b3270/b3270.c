@@ -43,11 +43,13 @@
 # include <signal.h>
 #endif /*]*/
 #include <errno.h>
+#include <inttypes.h>
 #include "appres.h"
 #include "3270ds.h"
 #include "resources.h"
 
 #include "actions.h"
+#include "allocs.h"
 #include "b3270proto.h"
 #include "bind-opt.h"
 #include "boolstr.h"
@@ -56,9 +58,13 @@
 #include "codepage.h"
 #include "ctlr.h"
 #include "ctlrc.h"
+#include "evprof.h"
+#include "footprint.h"
 #include "unicodec.h"
 #include "ft.h"
 #include "glue.h"
+#include "varbuf.h"	/* must precede hibernate.h */
+#include "hibernate.h"
 #include "ui_stream.h"
 #include "host.h"
 #include "httpd-core.h"
@@ -72,6 +78,7 @@
 #include "model.h"
 #include "names.h"
 #include "nvt.h"
+#include "observe.h"
 #include "nvt_gui.h"
 #include "opts.h"
 #include "popups.h"
@@ -82,12 +89,15 @@
 #include "proxy_toggle.h"
 #include "query.h"
 #include "screen.h"
+#include "screenhist.h"
 #include "selectc.h"
 #include "sio.h"
+#include "simd_glue.h"
 #include "sio_glue.h"
 #include "sio_internal.h"
 #include "split_host.h"
 #include "stats.h"
+#include "startup.h"
 #include "status.h"
 #include "task.h"
 #include "telnet.h"
@@ -95,8 +105,8 @@
 #include "toggles.h"
 #include "trace.h"
 #include "screentrace.h"
+#include "shmexport.h"
 #include "utils.h"
-#include "varbuf.h"
 #include "vstatus.h"
 #include "xio.h"
 #include "xscroll.h"
@@ -117,10 +127,7 @@ char *commondocs3270 = NULL;
 unsigned windirs_flags;
 #endif /*]*/
 
-static int brcvd = 0;
-static int rrcvd = 0;
-static int bsent = 0;
-static int rsent = 0;
+static uint64_t last_stats[STAT_CONNECTION_MAX];
 static ioid_t stats_ioid = NULL_IOID;
 
 static void b3270_toggle(toggle_index_t ix, enum toggle_type tt);
@@ -153,30 +160,75 @@ usage(const char *msg)
     exit(1);
 }
 
-/* Dump the current send/receive statistics. */
+/* Dump the resource footprint, if it has changed since it was last sent. */
+static void
+dump_footprint(void)
+{
+    static size_t *last_sizes = NULL;
+    static size_t last_count = 0;
+    size_t count = footprint_count();
+    size_t *sizes = (size_t *)Malloc((count + 1) * sizeof(size_t));
+    const char **args;
+    size_t session, shared;
+    size_t i;
+
+    footprint_snapshot(sizes, &session, &shared);
+    if (count == last_count &&
+	    !memcmp(sizes, last_sizes, count * sizeof(size_t))) {
+	Free(sizes);
+	return;
+    }
+    Replace(last_sizes, sizes);
+    last_count = count;
+
+    args = (const char **)Malloc(((2 * count) + 5) * sizeof(const char *));
+    for (i = 0; i < count; i++) {
+	args[2 * i] = footprint_name(i);
+	args[(2 * i) + 1] = lazyaf("%zu", sizes[i]);
+    }
+    args[2 * count] = AttrSessionBytes;
+    args[(2 * count) + 1] = lazyaf("%zu", session);
+    args[(2 * count) + 2] = AttrSharedBytes;
+    args[(2 * count) + 3] = lazyaf("%zu", shared);
+    args[(2 * count) + 4] = NULL;
+    ui_leaf(IndFootprint, args);
+    Free(args);
+}
+
+/* Dump the current statistics. */
 static void
 dump_stats(void)
 {
-    ui_vleaf(IndStats,
-	    AttrBytesReceived, lazyaf("%d", brcvd),
-	    AttrRecordsReceived, lazyaf("%d", rrcvd),
-	    AttrBytesSent, lazyaf("%d", bsent),
-	    AttrRecordsSent, lazyaf("%d", rsent),
-	    NULL);
+    uint64_t snap[STAT_MAX];
+    const char *args[(2 * STAT_MAX) + 1];
+    int i;
+
+    stats_snapshot(snap);
+    for (i = 0; i < STAT_MAX; i++) {
+	args[2 * i] = stats_name(i);
+	args[(2 * i) + 1] = lazyaf("%" PRIu64, snap[i]);
+    }
+    args[2 * STAT_MAX] = NULL;
+    ui_leaf(IndStats, args);
+    dump_footprint();
+}
+
+/* Check for changes to the per-connection statistics. */
+static bool
+stats_changed(void)
+{
+    if (!memcmp(last_stats, stats, sizeof(last_stats))) {
+	return false;
+    }
+    memcpy(last_stats, stats, sizeof(last_stats));
+    return true;
 }
 
 /* Dump the current send/receive stats out if they have changed. */
 static void
 stats_poll(ioid_t id _is_unused)
 {
-    if (brcvd != ns_brcvd ||
-	rrcvd != ns_rrcvd ||
-	bsent != ns_bsent ||
-	rsent != ns_rsent) {
-	brcvd = ns_brcvd;
-	rrcvd = ns_rrcvd;
-	bsent = ns_bsent;
-	rsent = ns_rsent;
+    if (stats_changed()) {
 	dump_stats();
     }
     stats_ioid = NULL_IOID;
@@ -186,8 +238,8 @@ stats_poll(ioid_t id _is_unused)
 void
 stats_poke(void)
 {
-    /* Schedule a timeout. */
-    if (stats_ioid == NULL_IOID) {
+    /* Schedule a timeout, if the UI wants them. */
+    if (ui_subscribed(UI_SUB_STATS) && stats_ioid == NULL_IOID) {
 	stats_ioid = AddTimeOut(STATS_POLL, stats_poll);
     }
 }
@@ -208,14 +260,7 @@ b3270_connect(bool ignored)
     if (cstate == NOT_CONNECTED && stats_ioid != NULL_IOID) {
 	RemoveTimeOut(stats_ioid);
 	stats_ioid = NULL_IOID;
-	if (brcvd != ns_brcvd ||
-	    rrcvd != ns_rrcvd ||
-	    bsent != ns_bsent ||
-	    rsent != ns_rsent) {
-	    brcvd = ns_brcvd;
-	    rrcvd = ns_rrcvd;
-	    bsent = ns_bsent;
-	    rsent = ns_rsent;
+	if (stats_changed()) {
 	    dump_stats();
 	}
     }
@@ -255,14 +300,7 @@ b3270_connect(bool ignored)
 
     /* If just connected, dump initial stats. */
     if (cstate != NOT_CONNECTED && stats_ioid == NULL_IOID &&
-	(brcvd != ns_brcvd ||
-	 rrcvd != ns_rrcvd ||
-	 bsent != ns_bsent ||
-	 rsent != ns_rsent)) {
-	brcvd = ns_brcvd;
-	rrcvd = ns_rrcvd;
-	bsent = ns_bsent;
-	rsent = ns_rsent;
+	    ui_subscribed(UI_SUB_STATS) && stats_changed()) {
 	dump_stats();
     }
 
@@ -408,6 +446,8 @@ main(int argc, char *argv[])
     const char *cl_hostname = NULL;
     toggle_index_t ix;
 
+    startup_init("b3270");
+
 #if defined(_WIN32) /*[*/
     get_version_info();
     if (!get_dirs("wc3270", &instdir, NULL, NULL, NULL, NULL, NULL,
@@ -425,12 +465,17 @@ main(int argc, char *argv[])
      */
     codepage_register();
     ctlr_register();
+    evprof_register();
+    allocs_register();
+    footprint_register();
     ft_register();
+    hibernate_register();
     host_register();
     idle_register();
     kybd_register();
     task_register();
     query_register();
+    stats_register();
     nvt_register();
     pr3287_session_register();
     print_screen_register();
@@ -439,6 +484,9 @@ main(int argc, char *argv[])
     toggles_register();
     trace_register();
     screentrace_register();
+    observe_register();
+    screenhist_register();
+    shmexport_register();
     xio_register();
     sio_glue_register();
     hio_register();
@@ -447,11 +495,13 @@ main(int argc, char *argv[])
     net_register();
     login_macro_register();
     vstatus_register();
+    simd_glue_register();
 
     argc = parse_command_line(argc, (const char **)argv, &cl_hostname);
     if (cl_hostname != NULL) {
 	usage("Unrecognized option(s)");
     }
+    startup_mark(STARTUP_RESOURCES);
 
     check_min_version(appres.min_version);
 
@@ -496,6 +546,7 @@ POSSIBILITY OF SUCH DAMAGE.", cyear),
 	xs_warning("Cannot find code page \"%s\"", appres.codepage);
 	codepage_init(NULL);
     }
+    startup_mark(STARTUP_CODEPAGE);
     dump_codepages();
     dump_models();
     dump_proxies();
@@ -532,7 +583,6 @@ POSSIBILITY OF SUCH DAMAGE.", cyear),
 	}
     }
     ft_init();
-    hostfile_init();
 
 #if !defined(_WIN32) /*[*/
     /* Make sure we don't fall over any SIGPIPEs. */
@@ -947,16 +997,20 @@ b3270_register(void)
 	{ "ForceStatus",	ForceStatus_action,	ACTION_HIDDEN },
     };
     static opt_t b3270_opts[] = {
+	{ OptBinary,   OPT_BOOLEAN, true,  ResBinary,    aoffset(ui_binary),
+	    NULL, "Use binary framing for UI output" },
 	{ OptCallback, OPT_STRING,  false, ResCallback,
 	    aoffset(scripting.callback), NULL, "Callback address and port" },
 	{ OptUtf8,     OPT_BOOLEAN, true,  ResUtf8,      aoffset(utf8),
 	    NULL, "Force local codeset to be UTF-8" },
     };
     static res_t b3270_resources[] = {
+	{ ResBinary,		aoffset(ui_binary), XRM_BOOLEAN },
 	{ ResCallback,		aoffset(scripting.callback), XRM_STRING },
 	{ ResIdleCommand,aoffset(idle_command),     XRM_STRING },
 	{ ResIdleCommandEnabled,aoffset(idle_command_enabled),XRM_BOOLEAN },
 	{ ResIdleTimeout,aoffset(idle_timeout),     XRM_STRING },
+	{ ResMaxUpdateRate,	aoffset(max_update_rate), XRM_INT },
 	{ ResUtf8,		aoffset(utf8),      XRM_BOOLEAN },
     };
     static xres_t b3270_xresources[] = {
@@ -0,0 +1,336 @@
+#!/usr/bin/env python3
+# b3270 UI protocol benchmark
+#
+# Runs b3270 against a synthetic 3270 host (or against playback), and
+# measures what the UI protocol costs in each output format:
+#   writes_per_sec    host writes processed per second, host flooding
+#   updates_per_sec   screen updates delivered per second, host flooding
+#                     (b3270 may merge several writes into one update)
+#   bytes_per_update  UI output bytes per screen update
+#   latency_ms        host write to screen update delivery, one at a time
+#   cpu_ms_per_update b3270 CPU time per screen update
+#
+# The formats are XML and the binary framing (-binary). Results are
+# printed as a table, or as JSON lines with -json.
+
+from xml.parsers import expat
+import argparse
+import json
+import os
+import select
+import socket
+import struct
+import subprocess
+import sys
+import threading
+import time
+
+# Telnet and 3270 constants.
+IAC, DO, WILL, SB, SE = 255, 253, 251, 250, 240
+EOR = 239
+TELOPT_BINARY, TELOPT_TTYPE, TELOPT_EOR = 0, 24, 25
+CMD_WRITE, CMD_EW = 0xf1, 0xf5
+ORDER_SBA = 0x11
+WCC_RESTORE = 0xc2
+
+# Process command-line arguments.
+parser = argparse.ArgumentParser(description='b3270 UI protocol benchmark')
+parser.add_argument('-b3270', default='b3270',
+        help='path to the b3270 program')
+parser.add_argument('-format', action='append', choices=['xml', 'binary'],
+        help='output format to test (default all)')
+parser.add_argument('-updates', type=int, default=2000,
+        help='number of host writes in the throughput test')
+parser.add_argument('-pings', type=int, default=200,
+        help='number of host writes in the latency test')
+parser.add_argument('-rows', type=int, default=1,
+        help='number of screen rows each host write changes')
+parser.add_argument('-playback',
+        help='trace file to play with playback -f instead of the synthetic '
+             'host (throughput, size and CPU only)')
+parser.add_argument('-playback-program', default='playback',
+        help='path to the playback program')
+parser.add_argument('-json', action='store_true',
+        help='write results as JSON lines')
+args = parser.parse_args()
+
+# Returns an unused local TCP port.
+def FreePort():
+    s = socket.socket()
+    s.bind(('127.0.0.1', 0))
+    port = s.getsockname()[1]
+    s.close()
+    return port
+
+# Synthetic host. Negotiates TN3270, then sends 3270 writes on demand.
+class Host:
+    def __init__(self):
+        self.listener = socket.socket()
+        self.listener.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.listener.bind(('127.0.0.1', 0))
+        self.listener.listen(1)
+        self.port = self.listener.getsockname()[1]
+        self.conn = None
+        self.ready = threading.Event()
+        threading.Thread(target=self.serve, daemon=True).start()
+
+    # Accept the emulator, negotiate, then discard whatever it sends.
+    def serve(self):
+        self.conn, _ = self.listener.accept()
+        self.listener.close()
+        self.conn.setsockopt(socket.IPPROTO_TCP, socket.TCP_NODELAY, 1)
+        self.conn.sendall(bytes([IAC, DO, TELOPT_TTYPE]))
+        self.expect(bytes([IAC, WILL, TELOPT_TTYPE]))
+        self.conn.sendall(bytes([IAC, SB, TELOPT_TTYPE, 1, IAC, SE]))
+        self.expect(bytes([IAC, SE]))
+        self.conn.sendall(bytes([IAC, WILL, TELOPT_EOR, IAC, DO, TELOPT_EOR,
+            IAC, WILL, TELOPT_BINARY, IAC, DO, TELOPT_BINARY]))
+        self.ready.set()
+        try:
+            while self.conn.recv(65536):
+                pass
+        except OSError:
+            pass
+
+    # Read until a byte sequence is seen.
+    def expect(self, what):
+        buf = b''
+        while what not in buf:
+            d = self.conn.recv(4096)
+            if not d:
+                raise Exception('Emulator disconnected during negotiation')
+            buf += d
+
+    # Build a write that puts marker n on the screen.
+    def record(self, n, erase=False):
+        data = bytes([CMD_EW if erase else CMD_WRITE, WCC_RESTORE])
+        for i in range(args.rows):
+            addr = ((n + i) % 24) * 80
+            text = '{0:08d} '.format(n) * 9
+            # 14-bit buffer address.
+            data += bytes([ORDER_SBA, (addr >> 8) & 0x3f, addr & 0xff])
+            data += text[:79].encode('cp037')
+        return data.replace(b'\xff', b'\xff\xff') + bytes([IAC, EOR])
+
+    def send(self, n, erase=False):
+        self.conn.sendall(self.record(n, erase))
+
+    def close(self):
+        if self.conn is not None:
+            self.conn.close()
+
+# UI stream decoders. Each calls handler(name, attrs) for element starts
+# and leaves, and returns nothing; the caller counts the bytes.
+class XmlDecoder:
+    def __init__(self, handler):
+        self.parser = expat.ParserCreate('UTF-8')
+        self.parser.StartElementHandler = handler
+    def feed(self, data):
+        self.parser.Parse(data, False)
+
+class BinaryDecoder:
+    def __init__(self, handler):
+        self.handler = handler
+        self.names = {}
+        self.buf = b''
+    def feed(self, data):
+        self.buf += data
+        while len(self.buf) >= 5:
+            ftype, length = struct.unpack('!cI', self.buf[:5])
+            if len(self.buf) < 5 + length:
+                break
+            payload = self.buf[5:5 + length]
+            self.buf = self.buf[5 + length:]
+            if ftype == b'd':
+                self.names[struct.unpack('!H', payload[:2])[0]] = \
+                        payload[2:].decode('utf-8')
+            elif ftype in (b's', b'l'):
+                eid, count = struct.unpack('!HH', payload[:4])
+                off = 4
+                attrs = {}
+                for i in range(count):
+                    aid, vlen = struct.unpack('!HI', payload[off:off + 6])
+                    off += 6
+                    attrs[self.names[aid]] = \
+                            payload[off:off + vlen].decode('utf-8')
+                    off += vlen
+                self.handler(self.names[eid], attrs)
+
+# A b3270 process and its UI output.
+class Emulator:
+    def __init__(self, fmt):
+        command = [args.b3270]
+        if fmt == 'binary':
+            command.append('-binary')
+        self.proc = subprocess.Popen(command, stdin=subprocess.PIPE,
+                stdout=subprocess.PIPE)
+        self.fd = self.proc.stdout.fileno()
+        self.bytes = 0
+        self.screens = 0
+        self.rows = {}
+        self.row = 0
+        self.connected = False
+        decoder = XmlDecoder if fmt == 'xml' else BinaryDecoder
+        self.decoder = decoder(self.element)
+        self.proc.stdin.write(b'<b3270-in>\n')
+        self.proc.stdin.flush()
+
+    # Element handler: count screens, keep a copy of the screen text and
+    # track the connection.
+    def element(self, name, attrs):
+        if name == 'screen':
+            self.screens += 1
+        elif name == 'row':
+            self.row = int(attrs['row'])
+        elif name == 'char' and 'text' in attrs:
+            col = int(attrs['column']) - 1
+            text = self.rows.get(self.row, '').ljust(col)
+            self.rows[self.row] = text[:col] + attrs['text'] + \
+                    text[col + len(attrs['text']):]
+        elif name == 'erase':
+            self.rows = {}
+        elif name == 'connection':
+            self.connected = attrs.get('state', '').startswith('connected-3')
+
+    # Read and decode output until cond() is true.
+    def until(self, cond, timeout=30.0):
+        limit = time.monotonic() + timeout
+        while not cond():
+            left = limit - time.monotonic()
+            if left <= 0 or not select.select([self.fd], [], [], left)[0]:
+                raise Exception('Timed out waiting for b3270')
+            data = os.read(self.fd, 65536)
+            if not data:
+                raise Exception('b3270 exited')
+            self.bytes += len(data)
+            self.decoder.feed(data)
+
+    def run(self, actions):
+        self.proc.stdin.write('<run actions="{0}"/>\n'.format(actions)
+                .encode('utf-8'))
+        self.proc.stdin.flush()
+
+    # Returns b3270's user plus system CPU time in seconds, or None.
+    def cpu(self):
+        try:
+            with open('/proc/{0}/stat'.format(self.proc.pid)) as f:
+                fields = f.read().rsplit(')', 1)[1].split()
+            return (int(fields[11]) + int(fields[12])) / \
+                    os.sysconf('SC_CLK_TCK')
+        except (OSError, IndexError, ValueError):
+            return None
+
+    def close(self):
+        try:
+            self.proc.stdin.write(b'</b3270-in>\n')
+            self.proc.stdin.close()
+        except OSError:
+            pass
+        try:
+            self.proc.wait(5)
+        except subprocess.TimeoutExpired:
+            self.proc.kill()
+            self.proc.wait()
+
+    # Returns True if marker n is on the screen, where the host put it.
+    def shows(self, n):
+        return self.rows.get((n % 24) + 1, '').startswith('{0:08d}'.format(n))
+
+# Measure one format against the synthetic host.
+def Synthetic(fmt):
+    host = Host()
+    e = Emulator(fmt)
+    e.run('Connect(127.0.0.1:{0})'.format(host.port))
+    e.until(lambda: e.connected)
+    host.ready.wait(10)
+    host.send(0, erase=True)
+    e.until(lambda: e.shows(0))
+
+    # Latency: one write at a time, waiting for each screen update.
+    latencies = []
+    for i in range(1, args.pings + 1):
+        start = time.monotonic()
+        host.send(i)
+        e.until(lambda: e.shows(i))
+        latencies.append((time.monotonic() - start) * 1000.0)
+
+    # Throughput: the host writes as fast as it can.
+    first = args.pings + 1
+    last = first + args.updates - 1
+    bytes0, screens0, cpu0 = e.bytes, e.screens, e.cpu()
+    start = time.monotonic()
+    sender = threading.Thread(target=lambda: [host.send(n)
+        for n in range(first, last + 1)])
+    sender.start()
+    e.until(lambda: e.shows(last), timeout=120.0)
+    elapsed = time.monotonic() - start
+    sender.join()
+    cpu1 = e.cpu()
+    e.close()
+    host.close()
+
+    latencies.sort()
+    return Results(fmt, 'synthetic', args.updates, e.screens - screens0,
+            e.bytes - bytes0, elapsed,
+            None if cpu0 is None or cpu1 is None else cpu1 - cpu0, latencies)
+
+# Measure one format playing a trace file.
+def Playback(fmt):
+    port = FreePort()
+    pb = subprocess.Popen([args.playback_program, '-f', '-p', str(port),
+        args.playback], stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    time.sleep(0.5)
+    e = Emulator(fmt)
+    cpu0 = e.cpu()
+    start = time.monotonic()
+    e.run('Connect(127.0.0.1:{0})'.format(port))
+    e.until(lambda: e.connected)
+    bytes0, screens0 = e.bytes, e.screens
+    try:
+        # Playback closes the connection when the file has been sent.
+        e.until(lambda: e.screens > screens0 and not e.connected,
+                timeout=300.0)
+    finally:
+        elapsed = time.monotonic() - start
+        cpu1 = e.cpu()
+        e.close()
+        pb.terminate()
+        pb.wait()
+    return Results(fmt, 'playback', None, e.screens - screens0,
+            e.bytes - bytes0, elapsed,
+            None if cpu0 is None or cpu1 is None else cpu1 - cpu0, [])
+
+# Compute the results for one run.
+def Results(fmt, host, writes, screens, nbytes, elapsed, cpu, latencies):
+    r = { 'format': fmt, 'host': host, 'updates': screens }
+    if writes:
+        r['writes_per_sec'] = round(writes / elapsed, 1)
+    if screens:
+        r['updates_per_sec'] = round(screens / elapsed, 1)
+        r['bytes_per_update'] = round(nbytes / screens, 1)
+        if cpu is not None:
+            r['cpu_ms_per_update'] = round(cpu * 1000.0 / screens, 4)
+    if latencies:
+        r['latency_ms'] = round(sum(latencies) / len(latencies), 3)
+        r['latency_p50_ms'] = round(latencies[len(latencies) // 2], 3)
+        r['latency_p99_ms'] = round(latencies[(len(latencies) * 99) // 100],
+                3)
+    return r
+
+columns = ['format', 'writes_per_sec', 'updates', 'updates_per_sec',
+        'bytes_per_update',
+        'cpu_ms_per_update', 'latency_ms', 'latency_p50_ms', 'latency_p99_ms']
+
+formats = args.format if args.format else ['xml', 'binary']
+results = []
+for fmt in formats:
+    r = Playback(fmt) if args.playback else Synthetic(fmt)
+    results.append(r)
+    if args.json:
+        print(json.dumps(r, sort_keys=True))
+        sys.stdout.flush()
+
+if not args.json:
+    print(' '.join('{0:>17}'.format(c) for c in columns))
+    for r in results:
+        print(' '.join('{0:>17}'.format(str(r.get(c, '-'))) for c in columns))
@@ -31,3 +31,5 @@
  */
 
 void b3270_new_codepage(bool);
+void screen_disp_flush(void);
+void screen_resubscribe(void);
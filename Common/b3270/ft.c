@@ -56,6 +56,15 @@ void ft_gui_clear_progress(void)
 {
 }
 
+/* Returns the transfer rate so far, as a string. */
+static const char *
+bytes_per_sec(size_t length)
+{
+    double elapsed = ft_stats_elapsed();
+
+    return lazyaf("%.0f", (elapsed > 0.0)? (double)length / elapsed: 0.0);
+}
+
 void
 ft_gui_complete_popup(const char *msg, bool is_error)
 {
@@ -64,6 +73,15 @@ ft_gui_complete_popup(const char *msg, bool is_error)
 	    AttrSuccess, ValTrueFalse(!is_error),
 	    AttrText, msg,
 	    AttrCause, ia_name[ft_cause],
+	    AttrBytes, lazyaf("%lu", (unsigned long)fts.length),
+	    AttrBytesPerSec, bytes_per_sec(fts.length),
+	    AttrBlocks, lazyaf("%lu", ft_stats.blocks),
+	    AttrRttMs, lazyaf("%.1f", ft_stats.rtt_count?
+		(ft_stats.rtt_total * 1000.0) / ft_stats.rtt_count: 0.0),
+	    AttrRttMaxMs, lazyaf("%.1f", ft_stats.rtt_max * 1000.0),
+	    AttrRetransmits, lazyaf("%lu", ft_stats.retransmits),
+	    AttrDiskMs, lazyaf("%.1f", ft_stats.disk_time * 1000.0),
+	    AttrBufferSize, lazyaf("%lu", (unsigned long)ft_stats.buffer_size),
 	    NULL);
 }
 
@@ -73,6 +91,8 @@ ft_gui_update_length(size_t length)
     ui_vleaf(IndFt,
 	    AttrState, "running",
 	    AttrBytes, lazyaf("%lu", (unsigned long)length),
+	    AttrBytesPerSec, bytes_per_sec(length),
+	    AttrBlocks, lazyaf("%lu", ft_stats.blocks),
 	    AttrCause, ia_name[ft_cause],
 	    NULL);
 }
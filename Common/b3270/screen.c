@@ -31,24 +31,29 @@
  */
 
 #include "globals.h"
+#include <assert.h>
 #include "3270ds.h"
 #include "resources.h"
 
 #include "appres.h"
 #include "b3270proto.h"
+#include "bscreen.h"
 #include "ctlr.h"
 #include "ctlrc.h"
+#include "footprint.h"
+#include "varbuf.h"	/* must precede hibernate.h */
+#include "hibernate.h"
 #include "ui_stream.h"
 #include "lazya.h"
 #include "nvt.h"
 #include "screen.h"
 #include "see.h"
+#include "startup.h"
 #include "toggles.h"
 #include "trace.h"
 #include "unicodec.h"
 #include "utils.h"
 #include "utf8.h"
-#include "varbuf.h"
 #include "xscroll.h"
 
 /* Unicode circled A character. */
@@ -101,7 +106,17 @@ static int saved_baddr = 0;
 
 static struct ea zero_ea;
 
+/* Pool of rowdiffs, reused for each row. */
+static rowdiff_t *rowdiff_pool = NULL;
+static int rowdiff_pool_size = 0;
+static int rowdiff_pool_used = 0;
+
 static bool cursor_enabled = true;
+static bool xformatted = false;
+
+/* Update rate limiting. */
+static ioid_t update_id = NULL_IOID;
+static bool update_pending = false;
 
 static void screen_disp_cond(bool always);
 
@@ -121,11 +136,7 @@ ea_equal(screen_t *a, screen_t *b)
 static bool
 ea_equal_attrs(screen_t *a, screen_t *b)
 {
-    screen_t ax = *a;	/* struct copy */
-    screen_t bx = *b;	/* struct copy */
-
-    ax.ccode = bx.ccode = 0;
-    return ea_equal(&ax, &bx);
+    return a->fg == b->fg && a->bg == b->bg && a->gr == b->gr;
 }
 
 static char *
@@ -253,6 +264,55 @@ internal_screen_init(void)
     save_empty();
 }
 
+/*
+ * Hibernate: send any held-back update, then pack the saved screen state
+ * and free it.
+ */
+static void
+screen_sleep(varbuf_t *blob)
+{
+    unsigned char have_ea = saved_ea != NULL;
+
+    if (update_pending) {
+	screen_disp_flush();
+    }
+    vb_append(blob, (char *)&have_ea, 1);
+    if (saved_ea != NULL) {
+	hib_pack(blob, saved_ea, sizeof(struct ea), saved_rows * saved_cols);
+	Replace(saved_ea, NULL);
+    }
+    hib_pack(blob, saved_s, sizeof(screen_t), maxROWS * maxCOLS);
+    Replace(saved_s, NULL);
+    Replace(rowdiff_pool, NULL);
+    rowdiff_pool_size = 0;
+}
+
+/*
+ * Wake from hibernation: restore the saved screen state.
+ */
+static void
+screen_wake(const unsigned char *blob)
+{
+    if (*blob++) {
+	saved_ea = (struct ea *)Malloc(saved_rows * saved_cols *
+		sizeof(struct ea));
+	blob = hib_unpack(blob, saved_ea, sizeof(struct ea),
+		saved_rows * saved_cols);
+    }
+    saved_s = (screen_t *)Malloc(maxROWS * maxCOLS * sizeof(screen_t));
+    hib_unpack(blob, saved_s, sizeof(screen_t), maxROWS * maxCOLS);
+}
+
+/* Footprint of the copy of the screen last sent to the UI. */
+static size_t
+screen_footprint(void)
+{
+    return ((saved_ea != NULL)?
+		saved_rows * saved_cols * sizeof(struct ea): 0) +
+	((saved_s != NULL)? maxROWS * maxCOLS * sizeof(screen_t): 0) +
+	(rowdiff_pool_size * sizeof(rowdiff_t));
+}
+
 /* Screen initialization. */
 void
 screen_init(void)
@@ -260,12 +320,21 @@ screen_init(void)
     static toggle_register_t toggles[] = {
 	{ VISIBLE_CONTROL,	toggle_visibleControl, 0 }
     };
+    static footprint_t footprints[] = {
+	{ "screen-shadow",	screen_footprint,	false }
+    };
 
     /* Register toggles. */
     register_toggles(toggles, array_count(toggles));
 
     /* Do internal initialization. */
     internal_screen_init();
+
+    /* Register the hibernation functions. */
+    register_hibernator(screen_sleep, screen_wake);
+
+    /* Register the buffer size. */
+    register_footprints(footprints, array_count(footprints));
 }
 
 /* Codepage change handler. */
@@ -341,31 +410,41 @@ uncircle(unsigned long uc)
 }
 
 /*
- * Render the screen into a buffer.
+ * Fill part of a rendered screen with blanks, blue on black.
+ */
+static void
+render_blanks(screen_t *s, int count)
+{
+    int i;
+
+    memset(s, 0, count * sizeof(screen_t));
+    for (i = 0; i < count; i++) {
+	s[i].ccode = ' ';
+	s[i].fg = mode.m3279? HOST_COLOR_BLUE : HOST_COLOR_NEUTRAL_WHITE;
+	s[i].bg = HOST_COLOR_NEUTRAL_BLACK;
+    }
+}
+
+/*
+ * Render a range of rows into a buffer.
  *
  * ea: ROWS*COLS screen buffer to render
- * s: maxROWS*maxCOLS screen_t to render into
+ * s: maxROWS*maxCOLS screen_t to render into, already blanked
+ * row0: first row to render
+ * nrows: number of rows to render
  */
-void
-render_screen(struct ea *ea, screen_t *s)
+static void
+render_rows(struct ea *ea, screen_t *s, int row0, int nrows)
 {
     int i;
     ucs4_t uc;
-    int fa_addr = find_field_attribute(0);
+    int fa_addr = find_field_attribute(row0 * COLS);
     unsigned char fa = ea[fa_addr].fa;
     int fa_fg;
     int fa_bg;
     int fa_gr;
     bool fa_high;
 
-    /* Start with all blanks, blue on black. */
-    memset(s, 0, maxROWS * maxCOLS * sizeof(screen_t));
-    for (i = 0; i < maxROWS * maxCOLS; i++) {
-	s[i].ccode = ' ';
-	s[i].fg = mode.m3279? HOST_COLOR_BLUE : HOST_COLOR_NEUTRAL_WHITE;
-	s[i].bg = HOST_COLOR_NEUTRAL_BLACK;
-    }
-
     if (ea[fa_addr].fg) {
 	fa_fg = ea[fa_addr].fg & 0x0f;
     } else {
@@ -386,7 +465,7 @@ render_screen(struct ea *ea, screen_t *s)
 
     fa_gr = ea[fa_addr].gr;
 
-    for (i = 0; i < ROWS * COLS; i++) {
+    for (i = row0 * COLS; i < (row0 + nrows) * COLS; i++) {
 	int fg_color, bg_color;
 	bool high;
 	bool dbcs = false;
@@ -583,6 +662,83 @@ render_screen(struct ea *ea, screen_t *s)
     }
 }
 
+/*
+ * Render the screen into a buffer.
+ *
+ * ea: ROWS*COLS screen buffer to render
+ * s: maxROWS*maxCOLS screen_t to render into
+ */
+void
+render_screen(struct ea *ea, screen_t *s)
+{
+    render_blanks(s, maxROWS * maxCOLS);
+    render_rows(ea, s, 0, ROWS);
+}
+
+/*
+ * Render just the rows that have changed since the last display into a copy
+ * of the previously-rendered screen.
+ *
+ * Returns false if that is not safe, because the changes include field
+ * attributes (which affect the rendering of the rows that follow them) or
+ * the screen contains DBCS text (whose cells can span rows).
+ */
+static bool
+render_changed_rows(struct ea *ea, screen_t *s)
+{
+    int row, i;
+
+    if (dbcs) {
+	return false;
+    }
+    for (row = 0; row < ROWS; row++) {
+	if (!ctlr_row_changed(row)) {
+	    continue;
+	}
+	for (i = row * COLS; i < (row + 1) * COLS; i++) {
+	    if ((ea[i].fa || saved_ea[i].fa) &&
+		    memcmp(&ea[i], &saved_ea[i], sizeof(struct ea))) {
+		return false;
+	    }
+	}
+    }
+
+    memcpy(s, saved_s, maxROWS * maxCOLS * sizeof(screen_t));
+    for (row = 0; row < ROWS; row++) {
+	int nrows = 0;
+
+	while (row + nrows < ROWS && ctlr_row_changed(row + nrows)) {
+	    render_blanks(s + ((row + nrows) * maxCOLS), maxCOLS);
+	    nrows++;
+	}
+	if (nrows) {
+	    render_rows(ea, s, row, nrows);
+	    row += nrows;
+	}
+    }
+    return true;
+}
+
+/*
+ * Allocate a rowdiff from the pool. A row can have at most maxCOLS of them,
+ * and the whole pool is released at once by free_rowdiffs().
+ */
+static rowdiff_t *
+alloc_rowdiff(void)
+{
+    if (rowdiff_pool_size < maxCOLS) {
+	assert(rowdiff_pool_used == 0);
+	rowdiff_pool_size = maxCOLS;
+	Replace(rowdiff_pool,
+		(rowdiff_t *)Malloc(rowdiff_pool_size * sizeof(rowdiff_t)));
+    }
+    assert(rowdiff_pool_used < rowdiff_pool_size);
+    return &rowdiff_pool[rowdiff_pool_used++];
+}
+
+/* How many cells to compare at once when skipping unchanged cells. */
+#define SKIP_CHUNK	8
+
 /* Generate one row's worth of raw diffs. */
 static rowdiff_t *
 generate_rowdiffs(screen_t *oldr, screen_t *newr)
@@ -594,11 +750,19 @@ generate_rowdiffs(screen_t *oldr, screen_t *newr)
     for (col = 0; col < maxCOLS; col++) {
 	rowdiff_t *d;
 
+	/* Skip runs of unchanged cells quickly. */
+	while (col + SKIP_CHUNK <= maxCOLS &&
+		!memcmp(&oldr[col], &newr[col], SKIP_CHUNK * sizeof(screen_t))) {
+	    col += SKIP_CHUNK;
+	}
+	if (col >= maxCOLS) {
+	    break;
+	}
 	if (ea_equal(&oldr[col], &newr[col])) {
 	    continue;
 	}
 
-	d = (rowdiff_t *)Malloc(sizeof(rowdiff_t));
+	d = alloc_rowdiff();
 	d->next = NULL;
 	d->start_col = col;
 	d->width = 1;
@@ -692,12 +856,8 @@ merge_adjacent(rowdiff_t *diffs, screen_t *oldr, screen_t *newr)
 		ea_equal_attrs(&newr[d->start_col], &newr[next->start_col]) &&
 		ea_equal_attrs_span(oldr, newr, d, next)) {
 
-	    rowdiff_t *nx;
-
 	    d->width = next->start_col + next->width - d->start_col;
-	    nx = next;
 	    d->next = next->next;
-	    Free(nx);
 
 	    /* Consider d again. */
 	    next = d;
@@ -715,12 +875,8 @@ merge_adjacent(rowdiff_t *diffs, screen_t *oldr, screen_t *newr)
 		ea_equal_attrs(&oldr[d->start_col], &oldr[next->start_col]) &&
 		ea_equal_attrs(&newr[d->start_col], &newr[next->start_col])) {
 
-	    rowdiff_t *nx;
-
 	    d->width += next->width;
-	    nx = next;
 	    d->next = next->next;
-	    Free(nx);
 
 	    /* Consider d again. */
 	    next = d;
@@ -738,13 +894,9 @@ merge_adjacent(rowdiff_t *diffs, screen_t *oldr, screen_t *newr)
 		ea_equal_attrs(&oldr[d->start_col], &oldr[next->start_col]) &&
 		ea_equal_attrs(&newr[d->start_col], &newr[next->start_col])) {
 
-	    rowdiff_t *nx;
-
 	    d->reason = RD_TEXT;
 	    d->width += next->width;
-	    nx = next;
 	    d->next = next->next;
-	    Free(nx);
 
 	    /* Consider d again. */
 	    next = d;
@@ -760,36 +912,34 @@ static void
 emit_rowdiffs(screen_t *oldr, screen_t *newr, rowdiff_t *diffs)
 {
     rowdiff_t *d;
+    static varbuf_t r;
+    static bool r_initted = false;
 
-    for (d = diffs; d != NULL; d = d->next) {
-	const char *args[13]; /* col, fg, bg, gr, text, count, NULL */
-	int aix = 0;
-	char *col_value;
+    if (!r_initted) {
+	vb_init(&r);
+	r_initted = true;
+    }
 
-	args[aix++] = AttrColumn;
-	col_value = xs_buffer("%d", d->start_col + 1);
-	args[aix++] = col_value; /* will explicitly lazya below */
+    for (d = diffs; d != NULL; d = d->next) {
+	ui_begin((d->reason == RD_TEXT)? IndChar: IndAttr);
+	ui_attr_int(AttrColumn, d->start_col + 1);
 	if (oldr[d->start_col].fg != newr[d->start_col].fg) {
-	    args[aix++] = AttrFg;
-	    args[aix++] = see_color(0xf0 | newr[d->start_col].fg);
+	    ui_attr_static(AttrFg, see_color(0xf0 | newr[d->start_col].fg));
 	}
 	if (oldr[d->start_col].bg != newr[d->start_col].bg) {
-	    args[aix++] = AttrBg;
-	    args[aix++] = see_color(0xf0 | newr[d->start_col].bg);
+	    ui_attr_static(AttrBg, see_color(0xf0 | newr[d->start_col].bg));
 	}
 	if (oldr[d->start_col].gr != newr[d->start_col].gr) {
-	    args[aix++] = "gr";
-	    args[aix++] = see_gr(newr[d->start_col].gr);
+	    ui_attr_static("gr", see_gr(newr[d->start_col].gr));
 	}
 
 	if (d->reason == RD_TEXT) {
 	    int i;
-	    varbuf_t r;
-	    char *ccode_value;
 	    char utf8_buf[6];
 	    int utf8_len;
 
-	    vb_init(&r);
+	    /* The text is collected in a buffer that is reused. */
+	    vb_reset(&r);
 	    for (i = 0; i < d->width; i++) {
 		if (newr[d->start_col + i].ccode == 0) {
 		    /* DBCS right, skip it. */
@@ -797,32 +947,21 @@ emit_rowdiffs(screen_t *oldr, screen_t *newr, rowdiff_t *diffs)
 		}
 		utf8_len = unicode_to_utf8(newr[d->start_col + i].ccode,
 			utf8_buf);
-		vb_appendf(&r, "%.*s", utf8_len, utf8_buf);
+		vb_append(&r, utf8_buf, utf8_len);
 	    }
-	    args[aix++] = AttrText;
-	    ccode_value = vb_consume(&r);
-	    args[aix++] = ccode_value;
-	    lazya(ccode_value);
+	    ui_attr(AttrText, vb_len(&r)? vb_buf(&r): "");
 	} else {
-	    args[aix++] = "count";
-	    args[aix++] = lazyaf("%d", d->width);
+	    ui_attr_int("count", d->width);
 	}
-
-	args[aix++] = NULL;
-	ui_leaf((d->reason == RD_TEXT)? IndChar: IndAttr, args);
-	lazya(col_value);
+	ui_end_leaf();
     }
 }
 
 static rowdiff_t *
-free_rowdiffs(rowdiff_t *diffs)
+free_rowdiffs(rowdiff_t *diffs _is_unused)
 {
-    /* Free the diffs. */
-    while (diffs != NULL) {
-	rowdiff_t *next = diffs->next;
-	Free(diffs);
-	diffs = next;
-    }
+    /* Return the diffs to the pool. */
+    rowdiff_pool_used = 0;
     return NULL;
 }
 
@@ -857,11 +996,11 @@ emit_cursor_cond(bool with_screen)
 	if (with_screen) {
 	    ui_vpush(IndScreen, NULL);
 	}
-	ui_vleaf(IndCursor,
-	    AttrEnabled, ValTrue,
-	    AttrRow, lazyaf("%d", (saved_baddr / COLS) + 1),
-	    AttrColumn, lazyaf("%d", (saved_baddr % COLS) + 1),
-	    NULL);
+	ui_begin(IndCursor);
+	ui_attr_static(AttrEnabled, ValTrue);
+	ui_attr_int(AttrRow, (saved_baddr / COLS) + 1);
+	ui_attr_int(AttrColumn, (saved_baddr % COLS) + 1);
+	ui_end_leaf();
 	sent_baddr = saved_baddr;
 	if (with_screen) {
 	    ui_pop();
@@ -869,6 +1008,19 @@ emit_cursor_cond(bool with_screen)
     }
 }
 
+/*
+ * Emit a cursor disabled indication.
+ */
+static void
+emit_cursor_disabled(void)
+{
+    ui_vpush(IndScreen, NULL);
+    ui_vleaf(IndCursor,
+	AttrEnabled, ValFalse,
+	NULL);
+    ui_pop();
+}
+
 /*
  * Emit the diff between two screens.
  */
@@ -884,15 +1036,16 @@ emit_diff(screen_t *old, screen_t *new)
 
 	if (memcmp(old + (row * maxCOLS), new + (row * maxCOLS),
 		sizeof(screen_t) * maxCOLS)) {
-	    ui_vpush("row",
-		    AttrRow, lazyaf("%d", row + 1),
-		    NULL);
+	    ui_begin("row");
+	    ui_attr_int(AttrRow, row + 1);
+	    ui_end_push();
 	    emit_row(&old[row * maxCOLS], &new[row * maxCOLS]);
 	    ui_pop();
 	}
     }
 
     ui_pop();
+    startup_mark(STARTUP_SCREEN);
 }
 
 /*
@@ -917,7 +1070,12 @@ screen_disp_cond(bool always)
     bool empty;
     int i;
     screen_t *s;
-    static bool xformatted = false;
+
+    /* Nothing to do if the UI does not want the screen. */
+    if (!ui_subscribed(UI_SUB_SCREEN)) {
+	ctlr_clear_row_changes();
+	return;
+    }
 
     /* Check for a size change. */
     if (ROWS != last_rows || COLS != last_cols) {
@@ -934,6 +1092,7 @@ screen_disp_cond(bool always)
 	saved_rows == ROWS &&
 	saved_cols == COLS &&
 	!memcmp(saved_ea, ea_buf, se)) {
+	ctlr_clear_row_changes();
 	emit_cursor_cond(true);
 	return;
     }
@@ -956,6 +1115,7 @@ screen_disp_cond(bool always)
 	}
 	/* Remember that the screen is empty. */
 	save_empty();
+	ctlr_clear_row_changes();
 	emit_cursor_cond(true);
 	return;
     }
@@ -969,7 +1129,11 @@ screen_disp_cond(bool always)
 
     /* Render the new screen. */
     s = Malloc(ss);
-    render_screen(ea_buf, s);
+    if (always || sent_erase || saved_ea_is_empty ||
+	    saved_rows != ROWS || saved_cols != COLS ||
+	    !render_changed_rows(ea_buf, s)) {
+	render_screen(ea_buf, s);
+    }
 
     /* Tell them what the screen looks like now. */
     emit_diff(saved_s, s);
@@ -981,17 +1145,97 @@ screen_disp_cond(bool always)
     Replace(saved_s, s);
     saved_rows = ROWS;
     saved_cols = COLS;
+    ctlr_clear_row_changes();
+}
+
+/*
+ * The UI has subscribed to the screen again. Send it the whole screen, since
+ * nothing was tracked while it was not subscribed.
+ */
+void
+screen_resubscribe(void)
+{
+    emit_erase(ROWS, COLS);
+    last_rows = ROWS;
+    last_cols = COLS;
+    save_empty();
+    xformatted = false;
+    ui_vleaf(IndFormatted,
+	    AttrState, ValFalse,
+	    NULL);
+    sent_baddr = -1;
+    if (!cursor_enabled) {
+	emit_cursor_disabled();
+    }
+    screen_disp_cond(true);
+}
+
+/*
+ * Check for a screen or cursor change that has not been sent yet.
+ */
+static bool
+screen_unsent(void)
+{
+    return ROWS != last_rows || COLS != last_cols ||
+	saved_rows != ROWS || saved_cols != COLS ||
+	(cursor_enabled && sent_baddr != saved_baddr) ||
+	memcmp(saved_ea, ea_buf, ROWS * COLS * sizeof(struct ea));
+}
+
+/*
+ * The update interval has expired. Send any changes accumulated since the
+ * last update.
+ */
+static void
+update_timeout(ioid_t id _is_unused)
+{
+    update_id = NULL_IOID;
+    if (update_pending) {
+	update_pending = false;
+	screen_disp(false);
+    }
 }
 
 /*
  * Display a changed screen.
+ * If the update rate is limited, the first change after an idle period is
+ * sent immediately, and later changes are accumulated and sent once per
+ * update interval.
  */
 void
 screen_disp(bool erasing _is_unused)
 {
+    if (!ui_subscribed(UI_SUB_SCREEN) || hibernating) {
+	/* Nothing to send, or nothing can have changed. */
+	return;
+    }
+    if (appres.max_update_rate > 0) {
+	if (!screen_unsent()) {
+	    return;
+	}
+	if (update_id != NULL_IOID) {
+	    update_pending = true;
+	    return;
+	}
+	update_id = AddTimeOut(1000 / appres.max_update_rate, update_timeout);
+    }
     screen_disp_cond(false);
 }
 
+/*
+ * If updates are rate limited, send any screen changes now, because the UI
+ * is about to be told something it should see in the context of the
+ * current screen.
+ */
+void
+screen_disp_flush(void)
+{
+    if (appres.max_update_rate > 0 && saved_ea != NULL) {
+	update_pending = false;
+	screen_disp_cond(false);
+    }
+}
+
 /*
  * Scroll the screen.
  */
@@ -1000,6 +1244,10 @@ screen_scroll(unsigned char fg, unsigned char bg)
 {
     int i;
 
+    if (!ui_subscribed(UI_SUB_SCREEN)) {
+	return;
+    }
+
     if (!fg) {
 	fg = mode.m3279? HOST_COLOR_BLUE: HOST_COLOR_NEUTRAL_WHITE;
     }
@@ -1063,11 +1311,9 @@ enable_cursor(bool on)
 {
     if (on != cursor_enabled) {
 	if (!(cursor_enabled = on)) {
-	    ui_vpush(IndScreen, NULL);
-	    ui_vleaf(IndCursor,
-		AttrEnabled, ValFalse,
-		NULL);
-	    ui_pop();
+	    if (ui_subscribed(UI_SUB_SCREEN)) {
+		emit_cursor_disabled();
+	    }
 	    sent_baddr = -1;
 	}
     }
@@ -1102,11 +1348,11 @@ screen_set_thumb(float top, float shown, int saved, int screen, int back)
     last_shown = shown;
     last_saved = saved;
     last_back = back;
-    ui_vleaf(IndThumb,
-	    AttrTop, lazyaf("%.5f", top),
-	    AttrShown, lazyaf("%.5f", shown),
-	    AttrSaved, lazyaf("%d", saved),
-	    AttrScreen, lazyaf("%d", screen),
-	    AttrBack, lazyaf("%d", back),
-	    NULL);
+    ui_begin(IndThumb);
+    ui_attr_static(AttrTop, lazyaf("%.5f", top));
+    ui_attr_static(AttrShown, lazyaf("%.5f", shown));
+    ui_attr_int(AttrSaved, saved);
+    ui_attr_int(AttrScreen, screen);
+    ui_attr_int(AttrBack, back);
+    ui_end_leaf();
 }
@@ -34,6 +34,7 @@
 #include "resources.h"
 
 #include "b3270proto.h"
+#include "bscreen.h"
 #include "ctlr.h"
 #include "kybd.h"
 #include "lazya.h"
@@ -148,6 +149,7 @@ status_lock(char *msg)
 {
     Replace(saved_lock, msg);
     if (!scrolled && !flashing) {
+	screen_disp_flush();
 	ui_vleaf(IndOia,
 		AttrField, OiaLock,
 		AttrValue, saved_lock,
@@ -49,13 +49,18 @@
 #include "b3270proto.h"
 #include "bind-opt.h"
 #include "b_password.h"
+#include "bscreen.h"
 #include "lazya.h"
 #include "popups.h"
 #include "resources.h"
 #include "screen.h"
+#include "spans.h"
+#include "stats.h"
 #include "task.h"
 #include "trace.h"
 #include "utils.h"
+#include "varbuf.h"	/* must precede serialize.h */
+#include "serialize.h"
 #include "xio.h"
 
 #if defined(_WIN32) /*[*/
@@ -67,6 +72,9 @@
 #define BOM_SIZE	3
 
 #define INBUF_SIZE	8192
+#define INBUF_MAX	(256 * 1024)	/* largest input read */
+
+#define UI_FLUSH_MAX	65536	/* flush buffered output at this size */
 
 #if defined(_WIN32) /*[*/
 static HANDLE peer_thread;
@@ -76,17 +84,31 @@ int peer_nr;
 int peer_errno;
 #endif /*]*/
 
-/* XML container stack. */
-typedef struct _ui_container {
-    struct _ui_container *next;
-    char *name;
-} ui_container_t;
-static ui_container_t *ui_container;
+/* XML container stack. Container names are static strings. */
+static const char **ui_container;
+static int ui_container_max;
 static int ui_depth;
 
 static XML_Parser parser;
 int input_nest = 0;
 
+/*
+ * UI subscriptions. Everything is sent until the UI says otherwise with a
+ * subscribe operation.
+ */
+unsigned ui_subscriptions = UI_SUB_SCREEN | UI_SUB_OIA | UI_SUB_STATS;
+
+/*
+ * The latest value of each OIA field suppressed while the UI is not
+ * subscribed to the OIA, replayed when it subscribes again.
+ */
+#define OIA_SAVE_ARGS	30	/* most attributes and values saved */
+typedef struct oia_save {
+    struct oia_save *next;
+    const char **args;		/* attributes and values, NULL-terminated */
+} oia_save_t;
+static oia_save_t *oia_saved = NULL;
+
 /* Action state. */
 typedef struct {
     char *tag;
@@ -140,92 +162,320 @@ static tcb_t cb_ui = {
 
 static socket_t ui_socket = INVALID_SOCKET;
 
+/*
+ * Pending output. Output is collected here and written out when each
+ * top-level element is complete, or when it gets large.
+ */
+static varbuf_t ui_obuf;
+static bool ui_obuf_initted = false;
+static bool ui_write_failed = false;
+
+/* Binary framing name table. */
+#define BIN_HASH_SIZE	256
+typedef struct _bin_name {
+    struct _bin_name *next;
+    char *name;
+    unsigned id;
+} bin_name_t;
+static bin_name_t *bin_names[BIN_HASH_SIZE];
+static unsigned bin_next_id;
+
+/* Write pending output to the UI socket. */
+static void
+ui_flush(void)
+{
+    const char *buf;
+    size_t len;
+    ssize_t nw = 0;
+
+    if (!ui_obuf_initted || (len = vb_len(&ui_obuf)) == 0) {
+	return;
+    }
+    buf = vb_buf(&ui_obuf);
+    while (len > 0 && !ui_write_failed) {
+	if (ui_socket != INVALID_SOCKET) {
+	    nw = send(ui_socket, buf, len, 0);
+	} else {
+	    nw = write(fileno(stdout), buf, len);
+	}
+	if (nw < 0) {
+	    ui_write_failed = true;
+	} else {
+	    buf += nw;
+	    len -= nw;
+	}
+    }
+    vb_reset(&ui_obuf);
+    if (nw < 0) {
+	vtrace("UI write failure\n");
+	x3270_exit(1);
+    }
+}
+
+/* Write pending output if a top-level element has just been completed. */
+static void
+ui_flush_cond(void)
+{
+    if (ui_depth <= 1) {
+	ui_flush();
+    }
+}
+
+/* Set up the output buffer. */
+static void
+ui_obuf_init(void)
+{
+    if (!ui_obuf_initted) {
+	vb_init(&ui_obuf);
+	ui_obuf_initted = true;
+    }
+}
+
 /* Write to the UI socket. */
 static void
 uprintf(const char *fmt, ...)
 {
     va_list ap;
-    char *s;
-    static bool eol = true;
-    ssize_t nw;
+    size_t len0;
 
+    ui_obuf_init();
+    len0 = vb_len(&ui_obuf);
     va_start(ap, fmt);
-    s = xs_vbuffer(fmt, ap);
+    vb_vappendf(&ui_obuf, fmt, ap);
     va_end(ap);
-    if (ui_socket != INVALID_SOCKET) {
-	nw = send(ui_socket, s, strlen(s), 0);
-    } else {
-	nw = write(fileno(stdout), s, strlen(s));
+    vtrace("ui> %s", vb_buf(&ui_obuf) + len0);
+
+    if (vb_len(&ui_obuf) >= UI_FLUSH_MAX) {
+	ui_flush();
     }
+}
+
+/* Append a 16-bit value to the binary output, in network order. */
+static void
+bin_put16(varbuf_t *r, unsigned v)
+{
+    char b[2];
 
-    if (eol) {
-	vtrace("ui> ");
-	eol = false;
+    b[0] = (v >> 8) & 0xff;
+    b[1] = v & 0xff;
+    vb_append(r, b, sizeof(b));
+}
+
+/* Append a 32-bit value to the binary output, in network order. */
+static void
+bin_put32(varbuf_t *r, size_t v)
+{
+    char b[4];
+
+    b[0] = (v >> 24) & 0xff;
+    b[1] = (v >> 16) & 0xff;
+    b[2] = (v >> 8) & 0xff;
+    b[3] = v & 0xff;
+    vb_append(r, b, sizeof(b));
+}
+
+/* Append a binary frame header. */
+static void
+bin_frame(char type, size_t len)
+{
+    ui_obuf_init();
+    vb_append(&ui_obuf, &type, 1);
+    bin_put32(&ui_obuf, len);
+}
+
+/*
+ * Return the binary ID for an element or attribute name, sending a define
+ * frame the first time it is seen.
+ */
+static unsigned
+bin_id(const char *name)
+{
+    unsigned h = 2166136261U;
+    const char *s;
+    bin_name_t *n;
+    size_t len;
+
+    for (s = name; *s; s++) {
+	h = (h ^ (unsigned char)*s) * 16777619U;
     }
-    vtrace("%s", s);
-    if (strlen(s) > 0 && s[strlen(s) - 1] == '\n') {
-	eol = true;
+    h %= BIN_HASH_SIZE;
+    for (n = bin_names[h]; n != NULL; n = n->next) {
+	if (!strcmp(n->name, name)) {
+	    return n->id;
+	}
     }
-    Free(s);
-    if (nw < 0) {
-	vtrace("UI write failure\n");
-	x3270_exit(1);
+
+    len = strlen(name);
+    n = Malloc(sizeof(bin_name_t) + len + 1);
+    n->name = (char *)(n + 1);
+    strcpy(n->name, name);
+    n->id = bin_next_id++;
+    n->next = bin_names[h];
+    bin_names[h] = n;
+
+    bin_frame(BinFrameDefine, 2 + len);
+    bin_put16(&ui_obuf, n->id);
+    vb_append(&ui_obuf, name, len);
+    return n->id;
+}
+
+/*
+ * Element under construction. Attributes are appended straight to the
+ * output buffer in XML mode, and to a scratch buffer in binary mode, so the
+ * define frames for new names can precede the element frame.
+ */
+static const char *ui_elem_name;
+static size_t ui_elem_start;
+static varbuf_t bin_attrs;
+static bool bin_attrs_initted = false;
+static unsigned bin_attr_count;
+
+/* Write pending output if it is large, or if an element is complete. */
+static void
+ui_flush_elem(bool leaf)
+{
+    if (leaf) {
+	ui_flush_cond();
+    } else if (vb_len(&ui_obuf) >= UI_FLUSH_MAX) {
+	ui_flush();
+    }
+}
+
+/*
+ * Start a UI element. It is followed by any number of ui_attr calls, then
+ * ui_end_leaf or ui_end_push.
+ *
+ * @param[in] name	element name, which must be static if it will be pushed
+ */
+void
+ui_begin(const char *name)
+{
+    ui_obuf_init();
+    ui_elem_name = name;
+    if (appres.ui_binary) {
+	if (!bin_attrs_initted) {
+	    vb_init(&bin_attrs);
+	    bin_attrs_initted = true;
+	}
+	vb_reset(&bin_attrs);
+	bin_attr_count = 0;
+	bin_id(name);
+	return;
+    }
+    ui_elem_start = vb_len(&ui_obuf);
+    if (ui_depth > 0) {
+	vb_appendf(&ui_obuf, "%*s", ui_depth, "");
     }
+    vb_append(&ui_obuf, "<", 1);
+    vb_appends(&ui_obuf, name);
 }
 
-/* Dump a string in HTML quoted format, if needed. */
+/* Add a binary attribute to the element under construction. */
 static void
-xml_safe(const char *value)
+bin_attr(const char *tag, const char *value, size_t len)
 {
-    char s;
+    bin_put16(&bin_attrs, bin_id(tag));
+    bin_put32(&bin_attrs, len);
+    vb_append(&bin_attrs, value, len);
+    bin_attr_count++;
+}
 
-    while ((s = *value++)) {
-	unsigned char c = s;
+/**
+ * Add an attribute to the element under construction.
+ *
+ * @param[in] tag	attribute name
+ * @param[in] value	attribute value, or NULL to omit the attribute
+ */
+void
+ui_attr(const char *tag, const char *value)
+{
+    if (value == NULL) {
+	return;
+    }
+    if (appres.ui_binary) {
+	bin_attr(tag, value, strlen(value));
+    } else {
+	ser_xml_attr(&ui_obuf, tag, value);
+    }
+}
 
-	if ((c & 0x80) && (c < 0x86 || c > 0x9f)) {
-	    /* UTF-8 upper. */
-	    uprintf("%c", c);
-	} else if (c >= ' ' && c != 0x7f) {
-	    /* Printable, but might need quoting. */
-	    switch (c) {
-	    case '<':
-		uprintf("&lt;");
-		break;
-	    case '>':
-		uprintf("&gt;");
-		break;
-	    case '"':
-		uprintf("&quot;");
-		break;
-	    case '&':
-		uprintf("&amp;");
-		break;
-	    case '\'':
-		uprintf("&apos;");
-		break;
-	    default:
-		uprintf("%c", c);
-		break;
-	    }
-	} else {
-	    /*
-	     * Not printable. XML 1.0 understands tabs, newlines and carriage
-	     * returns, and that's about it.
-	     */
-	    switch (c) {
-	    case 9:
-	    case 10:
-	    case 13:
-		uprintf("&#%u;", c);
-		break;
-	    default:
-		uprintf(" ");
-		break;
-	    }
-	}
+/**
+ * Add an attribute whose value never needs quoting, such as a keyword.
+ *
+ * @param[in] tag	attribute name
+ * @param[in] value	attribute value
+ */
+void
+ui_attr_static(const char *tag, const char *value)
+{
+    if (appres.ui_binary) {
+	bin_attr(tag, value, strlen(value));
+    } else {
+	ser_xml_attr_static(&ui_obuf, tag, value);
+    }
+}
+
+/**
+ * Add an integer attribute.
+ *
+ * @param[in] tag	attribute name
+ * @param[in] value	attribute value
+ */
+void
+ui_attr_int(const char *tag, long value)
+{
+    if (appres.ui_binary) {
+	char buf[21];
+
+	bin_attr(tag, buf, ser_int(buf, value));
+    } else {
+	ser_xml_attr_int(&ui_obuf, tag, value);
+    }
+}
+
+/**
+ * Add a Boolean attribute.
+ *
+ * @param[in] tag	attribute name
+ * @param[in] value	attribute value
+ */
+void
+ui_attr_bool(const char *tag, bool value)
+{
+    ui_attr_static(tag, ValTrueFalse(value));
+}
+
+/* Finish the element under construction. */
+static void
+ui_end(bool leaf)
+{
+    if (appres.ui_binary) {
+	size_t len = vb_len(&bin_attrs);
+
+	bin_frame(leaf? BinFrameLeaf: BinFrameStart, 4 + len);
+	bin_put16(&ui_obuf, bin_id(ui_elem_name));
+	bin_put16(&ui_obuf, bin_attr_count);
+	vb_append(&ui_obuf, vb_buf(&bin_attrs), len);
+	vtrace("ui> %*s[%s%s, %u attribute%s]\n", ui_depth, "", ui_elem_name,
+		leaf? "/": "", bin_attr_count,
+		(bin_attr_count == 1)? "": "s");
+    } else {
+	vb_appends(&ui_obuf, leaf? "/>\n": ">\n");
+	vtrace("ui> %.*s", (int)(vb_len(&ui_obuf) - ui_elem_start),
+		vb_buf(&ui_obuf) + ui_elem_start);
     }
 }
 
+/**
+ * Finish the element under construction as a leaf.
+ */
+void
+ui_end_leaf(void)
+{
+    ui_end(true);
+    ui_flush_elem(true);
+}
+
 /*
  * Generate a GUI object, either leaf or container.
  * The name is followed by a NULL-terminated list of tags and values.
@@ -233,18 +483,14 @@ xml_safe(const char *value)
 static void
 ui_object(bool leaf, const char *name, const char *args[])
 {
-    const char *tag;
-    int i = 0;
-
-    uprintf("%*s<%s", ui_depth, "", name);
-    while ((tag = args[i++]) != NULL) {
-	const char *value = args[i++];
+    int i;
 
-	uprintf(" %s=\"", tag);
-	xml_safe(value);
-	uprintf("\"");
+    ui_begin(name);
+    for (i = 0; args[i] != NULL; i += 2) {
+	ui_attr(args[i], args[i + 1]);
     }
-    uprintf("%s>\n", leaf? "/": "");
+    ui_end(leaf);
+    ui_flush_elem(leaf);
 }
 
 /*
@@ -256,17 +502,89 @@ ui_vobject(bool leaf, const char *name, va_list ap)
 {
     const char *tag;
 
-    uprintf("%*s<%s", ui_depth, "", name);
+    ui_begin(name);
+    while ((tag = va_arg(ap, const char *)) != NULL) {
+	ui_attr(tag, va_arg(ap, const char *));
+    }
+    ui_end(leaf);
+    ui_flush_elem(leaf);
+}
+
+/*
+ * Save an OIA update that the UI is not subscribed to, replacing any
+ * earlier one for the same field.
+ */
+static void
+oia_save(va_list ap)
+{
+    const char *tag;
+    const char *field = NULL;
+    const char *args[OIA_SAVE_ARGS + 1];
+    int n = 0;
+    int i;
+    size_t size = 0;
+    oia_save_t *o;
+    oia_save_t **p;
+    char *s;
+
     while ((tag = va_arg(ap, const char *)) != NULL) {
 	const char *value = va_arg(ap, const char *);
 
-	if (value) {
-	    uprintf(" %s=\"", tag);
-	    xml_safe(value);
-	    uprintf("\"");
+	if (value != NULL && n < OIA_SAVE_ARGS) {
+	    if (!strcmp(tag, AttrField)) {
+		field = value;
+	    }
+	    args[n++] = tag;
+	    args[n++] = value;
+	    size += strlen(tag) + 1 + strlen(value) + 1;
+	}
+    }
+    args[n] = NULL;
+    if (field == NULL) {
+	return;
+    }
+
+    /* Replace the previous value, keeping its place in the list. */
+    for (p = &oia_saved; (o = *p) != NULL; p = &o->next) {
+	int j;
+
+	for (j = 0; o->args[j] != NULL; j += 2) {
+	    if (!strcmp(o->args[j], AttrField) &&
+		    !strcmp(o->args[j + 1], field)) {
+		break;
+	    }
 	}
+	if (o->args[j] != NULL) {
+	    break;
+	}
+    }
+    o = (oia_save_t *)Realloc(o, sizeof(oia_save_t) +
+	    ((n + 1) * sizeof(char *)) + size);
+    if (*p == NULL) {
+	o->next = NULL;
+    }
+    *p = o;
+    o->args = (const char **)(o + 1);
+    s = (char *)(o->args + n + 1);
+    for (i = 0; i < n; i++) {
+	strcpy(s, args[i]);
+	o->args[i] = s;
+	s += strlen(s) + 1;
+    }
+    o->args[n] = NULL;
+}
+
+/* Replay the saved OIA updates. */
+static void
+oia_replay(void)
+{
+    while (oia_saved != NULL) {
+	oia_save_t *next = oia_saved->next;
+
+	ui_object(true, IndOia, oia_saved->args);
+	Free(oia_saved);
+	oia_saved = next;
     }
-    uprintf("%s>\n", leaf? "/": "");
 }
 
 /*
@@ -287,6 +605,13 @@ ui_vleaf(const char *name, ...)
 {
     va_list ap;
 
+    if (!ui_subscribed(UI_SUB_OIA) && !strcmp(name, IndOia)) {
+	va_start(ap, name);
+	oia_save(ap);
+	va_end(ap);
+	return;
+    }
+
     va_start(ap, name);
     ui_vobject(true, name, ap);
     va_end(ap);
@@ -296,14 +621,23 @@ ui_vleaf(const char *name, ...)
 static void
 push_name(const char *name)
 {
-    ui_container_t *g;
+    if (ui_depth >= ui_container_max) {
+	ui_container_max = ui_container_max? 2 * ui_container_max: 8;
+	ui_container = (const char **)Realloc((void *)ui_container,
+		ui_container_max * sizeof(const char *));
+    }
+    ui_container[ui_depth++] = name;
+}
 
-    g = Malloc(sizeof(ui_container_t) + strlen(name) + 1);
-    g->name = (char *)(g + 1);
-    strcpy(g->name, name);
-    g->next = ui_container;
-    ui_container = g;
-    ui_depth++;
+/**
+ * Finish the element under construction as the start of a container.
+ */
+void
+ui_end_push(void)
+{
+    ui_end(false);
+    push_name(ui_elem_name);
+    ui_flush_elem(false);
 }
 
 /*
@@ -343,12 +677,15 @@ ui_vpush(const char *name, ...)
 void
 ui_pop(void)
 {
-    ui_container_t *g = ui_container;
+    const char *name = ui_container[--ui_depth];
 
-    ui_depth--;
-    uprintf("%*s</%s>\n", ui_depth, "", g->name);
-    ui_container = g->next;
-    Free(g);
+    if (appres.ui_binary) {
+	bin_frame(BinFrameEnd, 0);
+	vtrace("ui> %*s[/%s]\n", ui_depth, "", name);
+    } else {
+	uprintf("%*s</%s>\n", ui_depth, "", name);
+    }
+    ui_flush_cond();
 }
 
 /* Data callback. */
@@ -376,6 +713,7 @@ ui_action_done(task_cbh handle, bool success, bool abort)
      * Repaint the screen, so the effect of the action can be seen before
      * we indicate that the action is complete.
      */
+    screen_disp_flush();
     screen_disp(false);
 
     ui_vleaf(IndRunResult,
@@ -467,6 +805,68 @@ do_run(const char *cmd, const char **attrs)
 	tcb = &cb_ui;
     }
     push_cb(command, strlen(command), tcb, (task_cbh)uia);
+    task_cb_span((task_cbh)uia, span_new("b3270", tag));
+}
+
+/* Change the output the UI is subscribed to. */
+static void
+do_subscribe(const char *cmd, const char **attrs)
+{
+    static struct {
+	const char *name;
+	unsigned flag;
+    } subs[] = {
+	{ AttrScreen,	UI_SUB_SCREEN },
+	{ AttrOia,	UI_SUB_OIA },
+	{ AttrStats,	UI_SUB_STATS },
+	{ NULL,		0 }
+    };
+    unsigned old_subscriptions = ui_subscriptions;
+    unsigned added;
+    int i;
+
+    for (i = 0; attrs[i] != NULL; i += 2) {
+	int j;
+
+	for (j = 0; subs[j].name != NULL; j++) {
+	    if (!strcasecmp(attrs[i], subs[j].name)) {
+		break;
+	    }
+	}
+	if (subs[j].name == NULL) {
+	    ui_unknown_attribute(OperSubscribe, attrs[i]);
+	    continue;
+	}
+	if (!strcasecmp(attrs[i + 1], ValTrue)) {
+	    ui_subscriptions |= subs[j].flag;
+	} else if (!strcasecmp(attrs[i + 1], ValFalse)) {
+	    ui_subscriptions &= ~subs[j].flag;
+	} else {
+	    ui_vleaf(IndUiError,
+		    AttrFatal, ValFalse,
+		    AttrText, "invalid value",
+		    AttrElement, OperSubscribe,
+		    AttrAttribute, attrs[i],
+		    AttrLine, lazyaf("%d", XML_GetCurrentLineNumber(parser)),
+		    AttrColumn,
+			lazyaf("%d", XML_GetCurrentColumnNumber(parser)),
+		    NULL);
+	}
+    }
+    vtrace("UI subscriptions 0x%x -> 0x%x\n", old_subscriptions,
+	    ui_subscriptions);
+
+    /* Bring newly-subscribed output up to date. */
+    added = ui_subscriptions & ~old_subscriptions;
+    if (added & UI_SUB_SCREEN) {
+	screen_resubscribe();
+    }
+    if (added & UI_SUB_OIA) {
+	oia_replay();
+    }
+    if (added & UI_SUB_STATS) {
+	stats_poke();
+    }
 }
 
 /* The (dummy) action for pass-through actions. */
@@ -616,18 +1016,27 @@ static void
 ui_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 {
     ssize_t nr;
-    char buf[INBUF_SIZE];
+    static char *buf = NULL;
+    static size_t buf_size = 0;
+    static size_t read_size = INBUF_SIZE;
     ssize_t nc;
     static ssize_t bom_count = 0;
     static char bom_read[BOM_SIZE];
     static unsigned char bom_value[BOM_SIZE] = { 0xef, 0xbb, 0xbf };
 
-    /* Read the data. */
+    /*
+     * Read the data. The buffer grows while reads keep filling it, so a
+     * front end sending large batches is served in fewer wakeups.
+     */
+    if (buf_size < read_size) {
+	Replace(buf, Malloc(read_size));
+	buf_size = read_size;
+    }
     if (ui_socket != INVALID_SOCKET) {
-	nr = recv(ui_socket, buf, INBUF_SIZE, 0);
+	nr = recv(ui_socket, buf, (int)read_size, 0);
     } else {
 #if !defined(_WIN32) /*[*/
-	nr = read(fileno(stdin), buf, INBUF_SIZE);
+	nr = read(fileno(stdin), buf, read_size);
 #else /*][*/
 	nr = peer_nr;
 	peer_nr = 0;
@@ -663,6 +1072,9 @@ ui_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 	}
 	x3270_exit(0);
     }
+    if ((size_t)nr == read_size && read_size < INBUF_MAX) {
+	read_size *= 2;
+    }
 
     /* Trace it, skipping any initial newline. */
     {
@@ -763,7 +1175,7 @@ peer_read(LPVOID lpParameter _is_unused)
 static void
 ui_exiting(bool ignored)
 {
-    while (ui_container) {
+    while (ui_depth > 0) {
 	ui_pop();
     }
 }
@@ -812,6 +1224,8 @@ xml_start(void *userData _is_unused, const XML_Char *name,
 	do_run(name, atts);
     } else if (!strcasecmp(name, OperRegister)) {
 	do_register(name, atts);
+    } else if (!strcasecmp(name, OperSubscribe)) {
+	do_subscribe(name, atts);
     } else if (!strcasecmp(name, OperSucceed)) {
 	do_passthru_complete(true, name, atts);
     } else if (!strcasecmp(name, OperFail)) {
@@ -938,9 +1352,12 @@ ui_io_init()
 #endif /*]*/
 
     /* Start the XML stream. */
-    uprintf("%c%c%c<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n",
-	    0xef, 0xbb, 0xbf);
+    if (!appres.ui_binary) {
+	uprintf("%c%c%c<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n",
+		0xef, 0xbb, 0xbf);
+    }
     ui_vpush(DocOut, NULL);
+    ui_flush();
 
     /* Set up a handler for exit. */
     register_schange_ordered(ST_EXITING, ui_exiting, ORDER_LAST);
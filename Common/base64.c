@@ -52,12 +52,24 @@ static char *alphabet64 = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0
  */
 char *
 base64_encode(const char *s)
+{
+    return base64_encode_buf(s, strlen(s));
+}
+
+/*
+ * Encode a buffer, which may contain NULs, in base64.
+ *
+ * Returns a malloc'd buffer.
+ */
+char *
+base64_encode_buf(const char *s, size_t len)
 {
     /*
      * We need one output character for every 6 bits of input, plus up to two
      * padding characters, plus a terminaing NUL.
      */
-    size_t nmalloc = (((strlen(s) * BITS_PER_BYTE) + (BITS_PER_BASE64 - 1)) / BITS_PER_BASE64) + MAX_PAD + 1;
+    size_t nmalloc = (((len * BITS_PER_BYTE) + (BITS_PER_BASE64 - 1)) / BITS_PER_BASE64) + MAX_PAD + 1;
+    const char *end = s + len;
     char *ret = Malloc(nmalloc);
     char *op = ret;
     char c;
@@ -72,10 +84,11 @@ base64_encode(const char *s)
 
 	/* Get the next 3 octets. */
 	for (i = 0; i < BYTES_PER_BLOCK; i++) {
-	    if (!(c = *s++)) {
+	    if (s >= end) {
 		done = true;
 		break;
 	    }
+	    c = *s++;
 	    accum = (accum << BITS_PER_BYTE) | (unsigned char)c;
 	    held_bits += BITS_PER_BYTE;
 	}
@@ -51,6 +51,7 @@
 #include "resources.h"
 
 #include "actions.h"
+#include "allocs.h"
 #include "base64.h"
 #include "bind-opt.h"
 #include "boolstr.h"
@@ -59,8 +60,10 @@
 #include "cscreen.h"
 #include "cstatus.h"
 #include "ctlrc.h"
+#include "evprof.h"
 #include "cmenubar.h"
 #include "unicodec.h"
+#include "footprint.h"
 #include "ft.h"
 #include "glue.h"
 #include "glue_gui.h"
@@ -78,6 +81,7 @@
 #include "model.h"
 #include "names.h"
 #include "nvt.h"
+#include "observe.h"
 #include "opts.h"
 #include "popups.h"
 #include "pr3287_session.h"
@@ -87,9 +91,13 @@
 #include "query.h"
 #include "s3270_proto.h"
 #include "screen.h"
+#include "screenhist.h"
 #include "selectc.h"
+#include "simd_glue.h"
 #include "sio_glue.h"
 #include "split_host.h"
+#include "stats.h"
+#include "startup.h"
 #include "status.h"
 #include "status_dump.h"
 #include "task.h"
@@ -98,6 +106,7 @@
 #include "toggles.h"
 #include "trace.h"
 #include "screentrace.h"
+#include "shmexport.h"
 #include "utf8.h"
 #include "utils.h"
 #include "varbuf.h"
@@ -555,6 +564,7 @@ main(int argc, char *argv[])
     int		i;
 #endif /*]*/
 
+    startup_init("c3270");
     Warning_redirect = c3270_Warning;
 #if defined(_WIN32) /*[*/
     /* Redirect Error() so we pause. */
@@ -588,6 +598,9 @@ main(int argc, char *argv[])
     c3270_register();
     codepage_register();
     ctlr_register();
+    evprof_register();
+    allocs_register();
+    footprint_register();
     ft_register();
     help_register();
     host_register();
@@ -598,6 +611,7 @@ main(int argc, char *argv[])
     kybd_register();
     task_register();
     query_register();
+    stats_register();
     menubar_register();
     nvt_register();
     pr3287_session_register();
@@ -610,6 +624,9 @@ main(int argc, char *argv[])
     toggles_register();
     trace_register();
     screentrace_register();
+    observe_register();
+    screenhist_register();
+    shmexport_register();
     xio_register();
     sio_glue_register();
     hio_register();
@@ -618,6 +635,7 @@ main(int argc, char *argv[])
     net_register();
     login_macro_register();
     vstatus_register();
+    simd_glue_register();
 
 #if !defined(_WIN32) /*[*/
     register_merge_profile(merge_profile);
@@ -634,6 +652,7 @@ main(int argc, char *argv[])
 #endif /*]*/
 
     argc = parse_command_line(argc, (const char **)argv, &cl_hostname);
+    startup_mark(STARTUP_RESOURCES);
 
     printf("%s\n\nType 'show copyright' for full copyright information.\n\
 Type 'help' for help information.\n\n",
@@ -658,6 +677,7 @@ Type 'help' for help information.\n\n",
 	xs_warning("Cannot find code page \"%s\"", appres.codepage);
 	codepage_init(NULL);
     }
+    startup_mark(STARTUP_CODEPAGE);
     model_init();
 
 #if defined(HAVE_LIBREADLINE) /*[*/
@@ -718,7 +738,6 @@ Type 'help' for help information.\n\n",
 
     idle_init();
     keymap_init();
-    hostfile_init();
     httpd_objects_init();
 
     if (appres.httpd_port) {
@@ -1517,6 +1536,7 @@ attempted_completion(const char *text, int start, int end)
 	}
 
 	/* Look for any matches.  Note that these are case-sensitive. */
+	hostfile_init();
 	for (h = hosts, match_count = 0; h; h = h->next) {
 	    if (!strncmp(h->name, t, strlen(t))) {
 		match_count++;
@@ -2293,6 +2313,7 @@ c3270_register(void)
 	{ ResPrinterOptions,aoffset(interactive.printer_opts),XRM_STRING },
 	{ ResReconnect,	aoffset(interactive.reconnect),XRM_BOOLEAN },
 	{ ResSaveLines,	aoffset(interactive.save_lines),XRM_INT },
+	{ ResSaveMemory,aoffset(interactive.save_memory),XRM_STRING },
 #if !defined(_WIN32) /*[*/
 	{ ResCbreak,	aoffset(c3270.cbreak_mode),	XRM_BOOLEAN },
 	{ ResCursesKeypad,aoffset(c3270.curses_keypad),	XRM_BOOLEAN },
@@ -2351,8 +2372,7 @@ c3270_register(void)
     };
     static query_t queries[] = {
 	{ KwKeymap, keymap_dump, NULL, false, true },
-	{ KwStatus, status_dump, NULL, false, true },
-	{ KwStats, status_dump, NULL, true, true }
+	{ KwStatus, status_dump, NULL, false, true }
     };
 
     /* Register for state changes. */
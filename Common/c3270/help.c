@@ -136,9 +136,12 @@ static struct {
 	    "Escape to '" HELP_W "c3270>' prompt" },
 	{ AnExecute, "<command>", P_SCRIPTING, "Execute a shell command" },
 	{ "Exit", NULL, P_INTERACTIVE, "Exit " HELP_W "c3270" },
-	{ AnExpect, "<pattern>", P_SCRIPTING, "Wait for NVT output" },
+	{ AnExpect, "<pattern>[,<timeout>][," KwNew "]", P_SCRIPTING,
+	    "Wait for NVT output" },
 	{ AnFieldEnd, NULL, P_3270, "Move to end of field" },
 	{ AnFieldMark, NULL, P_3270, "3270 FIELD MARK key (X'1E')" },
+	{ AnFields, "[" KwUnprotected "][," KwModified "]", P_SCRIPTING,
+	    "Table of fields: position, attributes and contents" },
 	{ AnFlip, NULL, P_3270, "Flip display left-to-right" },
 	{ AnHelp, "all|interactive|3270|scripting|transfer|<action>",
 	    P_INTERACTIVE, "Get help" },
@@ -37,8 +37,10 @@
 #include "resources.h"
 
 #include "actions.h"
+#include "footprint.h"
 #include "glue.h"
 #include "host.h"
+#include "keylat.h"
 #include "keymap.h"
 #include "lazya.h"
 #include "names.h"
@@ -92,6 +94,22 @@ struct keymap {
 
 static struct keymap *master_keymap = NULL;
 
+/*
+ * Prefix trie of the active keymap entries, rebuilt by set_inactive().
+ * Each node is reached by one key code from its parent.
+ */
+struct knode {
+    k_t code;			/* key code that leads here */
+    struct keymap *match;	/* entry whose codes end here, or NULL */
+    struct keymap *shortest;	/* shortest entry through or ending here */
+    int order;			/* master_keymap position of 'shortest' */
+    struct keymap *longer;	/* shortest entry continuing past here */
+    int entries;		/* number of entries through or ending here */
+    struct knode *children;	/* first child */
+    struct knode *sibling;	/* next sibling */
+};
+static struct knode *trie = NULL;
+
 static bool last_3270 = false;
 static bool last_nvt = false;
 
@@ -105,6 +123,7 @@ static void read_one_keymap(const char *name, const char *fn, bool temp,
 	const char *r0, int flags);
 static void clear_keymap(void);
 static void set_inactive(void);
+static size_t keymap_footprint(void);
 
 /*
  * Compare two k_t's.
@@ -551,30 +570,91 @@ read_one_keymap(const char *name, const char *fn, bool temp, const char *r0,
 
 /* Multi-key keymap support. */
 static struct keymap *current_match = NULL;
-static int consumed = 0;
+static struct knode *current_node = NULL;
 static char *ignore = "[ignore]";
 
-/* Find the shortest keymap with a longer match than k. */
-static struct keymap *
-longer_match(struct keymap *k, int nc)
+/* Free a trie. */
+static void
+free_trie(struct knode *n)
 {
-    struct keymap *j;
-    struct keymap *shortest = NULL;
+    while (n != NULL) {
+	struct knode *next = n->sibling;
 
-    for (j = master_keymap; j != NULL; j = j->next) {
-	if (IS_INACTIVE(j)) {
+	free_trie(n->children);
+	Free(n);
+	n = next;
+    }
+}
+
+/* Build the trie from the active entries in master_keymap. */
+static void
+build_trie(void)
+{
+    struct keymap *k;
+    int order = 0;
+
+    free_trie(trie);
+    trie = (struct knode *)Calloc(1, sizeof(struct knode));
+
+    for (k = master_keymap; k != NULL; k = k->next, order++) {
+	struct knode *n = trie;
+	int i;
+
+	if (IS_INACTIVE(k)) {
 	    continue;
 	}
-	if (j != k && j->ncodes > nc && !codecmp(j, k, nc)) {
-	    if (j->ncodes == nc+1) {
-		return j;
+	for (i = 0; i < k->ncodes; i++) {
+	    struct knode **cp;
+
+	    if (n->longer == NULL || k->ncodes < n->longer->ncodes) {
+		n->longer = k;
+	    }
+
+	    /* Find or add the child for this code. */
+	    for (cp = &n->children; *cp != NULL; cp = &(*cp)->sibling) {
+		if (!kcmp(&(*cp)->code, &k->codes[i])) {
+		    break;
+		}
+	    }
+	    if (*cp == NULL) {
+		*cp = (struct knode *)Calloc(1, sizeof(struct knode));
+		(*cp)->code = k->codes[i];
 	    }
-	    if (shortest == NULL || j->ncodes < shortest->ncodes) {
-		shortest = j;
+	    n = *cp;
+
+	    n->entries++;
+	    if (n->shortest == NULL || k->ncodes < n->shortest->ncodes) {
+		n->shortest = k;
+		n->order = order;
 	    }
 	}
+	if (n->match == NULL) {
+	    n->match = k;
+	}
     }
-    return shortest;
+}
+
+/*
+ * Find the child of a trie node that matches a key code.
+ * If more than one does, take the one with the shortest entry, and the
+ * earliest in the keymap if there is a tie.
+ */
+static struct knode *
+child_match(struct knode *n, k_t *code)
+{
+    struct knode *c;
+    struct knode *best = NULL;
+
+    for (c = n->children; c != NULL; c = c->sibling) {
+	if (!kcmp(code, &c->code) &&
+		(best == NULL ||
+		 c->shortest->ncodes < best->shortest->ncodes ||
+		 (c->shortest->ncodes == best->shortest->ncodes &&
+		  c->order < best->order))) {
+	    best = c;
+	}
+    }
+    return best;
 }
 
 /*
@@ -582,15 +662,15 @@ longer_match(struct keymap *k, int nc)
  * traces the result.  
  *
  * If s is NULL, then this is a failed initial lookup.
- * If s is 'ignore', then this is a lookup in progress (k non-NULL) or a
- *  failed multi-key lookup (k NULL).
+ * If s is 'ignore', then this is a lookup in progress (n non-NULL) or a
+ *  failed multi-key lookup (n NULL).
  * Otherwise, this is a successful lookup.
  */
 static char *
-status_ret(char *s, struct keymap *k)
+status_ret(char *s, struct knode *n)
 {
-    /* Set the compose indicator based on the new value of current_match. */
-    if (k != NULL) {
+    /* Set the compose indicator based on the new value of current_node. */
+    if (n != NULL) {
 	vstatus_compose(true, ' ', KT_STD);
     } else {
 	vstatus_compose(false, 0, KT_STD);
@@ -599,9 +679,7 @@ status_ret(char *s, struct keymap *k)
     if (s != NULL && s != ignore) {
 	vtrace(" %s:%d -> %s\n", current_match->file, current_match->line, s);
     }
-    if ((current_match = k) == NULL) {
-	consumed = 0;
-    }
+    current_node = n;
     return s;
 }
 
@@ -619,35 +697,21 @@ key_timeout(ioid_t id _is_unused)
     timeout_match = NULL;
 }
 
-static struct keymap *
-ambiguous(struct keymap *k, int nc)
-{
-    struct keymap *j;
-
-    if ((j = longer_match(k, nc)) != NULL) {
-	vtrace(" ambiguous keymap match, shortest is %s:%d, setting timeout\n",
-		j->file, j->line);
-	timeout_match = k;
-	kto = AddTimeOut(500L, key_timeout);
-    }
-    return j;
-}
-
 /*
  * Look up an key in the keymap, return the matching action if there is one.
  *
  * This code implements the mutli-key lookup, by returning dummy actions for
- * partial matches.
+ * partial matches. Each key advances one node in the trie.
  *
  * It also handles keyboards that generate ESC for the Alt key.
  */
 char *
 lookup_key(int kcode, ucs4_t ucs4, int modifiers)
 {
-    struct keymap *j, *k;
-    int n_shortest = 0;
+    struct knode *n;
     k_t code;
 
+    keylat_key();
     code.key = kcode;
     code.ucs4 = ucs4;
     code.modifiers = modifiers;
@@ -659,81 +723,43 @@ lookup_key(int kcode, ucs4_t ucs4, int modifiers)
 	timeout_match = NULL;
     }
 
-    /* If there's no match pending, find the shortest one. */
-    if (current_match == NULL) {
-	struct keymap *shortest = NULL;
+    if (trie == NULL) {
+	return NULL;
+    }
 
-	for (k = master_keymap; k != NULL; k = k->next) {
-	    if (IS_INACTIVE(k))
-		continue;
-	    if (!kcmp(&code, &k->codes[0])) {
-		if (k->ncodes == 1) {
-		    shortest = k;
-		    break;
-		}
-		if (shortest == NULL || k->ncodes < shortest->ncodes) {
-		    shortest = k;
-		    n_shortest++;
-		}
-	    }
-	}
-	if (shortest != NULL) {
-	    current_match = shortest;
-	    consumed = 0;
-	} else {
+    /* See if this key leads anywhere from where we are. */
+    n = child_match((current_node != NULL)? current_node: trie, &code);
+    if (n == NULL) {
+	if (current_node == NULL) {
 	    return NULL;
 	}
+
+	/* Complain. */
+	beep();
+	vtrace(" keymap lookup failure after partial match\n");
+	return status_ret(ignore, NULL);
     }
 
-    /* See if this character matches the next one we want. */
-    if (!kcmp(&code, &current_match->codes[consumed])) {
-	consumed++;
-	if (consumed == current_match->ncodes) {
+    if (n->match != NULL) {
+	current_match = n->match;
+	if (n->children == NULL) {
 	    /* Final match. */
-	    j = ambiguous(current_match, consumed);
-	    if (j == NULL) {
-		return status_ret(current_match->action, NULL);
-	    } else {
-		return status_ret(ignore, j);
-	    }
-	} else {
-	    /* Keep looking. */
-	    vtrace(" partial keymap match in %s:%d %s\n",
-		    current_match->file, current_match->line,
-		    (n_shortest > 1)? " and other(s)": "");
-	    return status_ret(ignore, current_match);
+	    return status_ret(n->match->action, NULL);
 	}
-    }
 
-    /* It doesn't.  Try for a better candidate. */
-    for (k = master_keymap; k != NULL; k = k->next) {
-	if (IS_INACTIVE(k)) {
-	    continue;
-	}
-	if (k == current_match) {
-	    continue;
-	}
-	if (k->ncodes > consumed && !codecmp(k, current_match, consumed) &&
-		!kcmp(&k->codes[consumed], &code)) {
-	    consumed++;
-	    if (k->ncodes == consumed) {
-		j = ambiguous(k, consumed);
-		if (j == NULL) {
-		    current_match = k;
-		    return status_ret(k->action, NULL);
-		} else {
-		    return status_ret(ignore, j);
-		}
-	    } else {
-		return status_ret(ignore, k);
-	    }
-	}
+	/* Ambiguous: wait a while for a longer match. */
+	vtrace(" ambiguous keymap match, shortest is %s:%d, setting timeout\n",
+		n->longer->file, n->longer->line);
+	timeout_match = n->match;
+	kto = AddTimeOut(500L, key_timeout);
+	return status_ret(ignore, n);
     }
 
-    /* Complain. */
-    beep();
-    vtrace(" keymap lookup failure after partial match\n");
-    return status_ret(ignore, NULL);
+    /* Keep looking. */
+    vtrace(" partial keymap match in %s:%d %s\n",
+	    n->shortest->file, n->shortest->line,
+	    (n->entries > 1)? " and other(s)": "");
+    return status_ret(ignore, n);
 }
 
 static struct {
@@ -947,6 +973,9 @@ keymap_register(void)
 	{ AnKeymap,		Keymap_action, ACTION_KE },
 	{ AnTemporaryKeymap,	Keymap_action, ACTION_KE }
     };
+    static footprint_t footprints[] = {
+	{ "keymap",		keymap_footprint,	false }
+    };
 
     /* Register for state changes. */
     register_schange(ST_3270_MODE, keymap_3270_mode);
@@ -954,6 +983,9 @@ keymap_register(void)
 
     /* Register the actions. */
     register_actions(keymap_actions, array_count(keymap_actions));
+
+    /* Register the table size. */
+    register_footprints(footprints, array_count(footprints));
 }
 
 /* Read each of the keymaps specified by the keymap resource. */
@@ -990,6 +1022,34 @@ keymap_init(void)
     set_inactive();
 }
 
+/* Footprint of a trie. */
+static size_t
+trie_footprint(struct knode *n)
+{
+    size_t bytes = 0;
+
+    while (n != NULL) {
+	bytes += sizeof(struct knode) + trie_footprint(n->children);
+	n = n->sibling;
+    }
+    return bytes;
+}
+
+/* Footprint of the keymap entries and the trie. */
+static size_t
+keymap_footprint(void)
+{
+    struct keymap *k;
+    size_t bytes = trie_footprint(trie);
+
+    for (k = master_keymap; k != NULL; k = k->next) {
+	bytes += sizeof(struct keymap) +
+	    (k->ncodes * (sizeof(k_t) + sizeof(int))) +
+	    strlen(k->name) + strlen(k->file) + strlen(k->action) + 3;
+    }
+    return bytes;
+}
+
 /* Erase the current keymap. */
 static void
 clear_keymap(void)
@@ -1001,6 +1061,9 @@ clear_keymap(void)
 	free_keymap(k);
     }
     master_keymap = NULL;
+    free_trie(trie);
+    trie = NULL;
+    current_node = NULL;
 }
 
 /* Set the inactive flags for the current keymap. */
@@ -1040,6 +1103,15 @@ set_inactive(void)
 	    }
 	}
     }
+
+    /* Rebuild the trie, abandoning any multi-key match in progress. */
+    if (kto != NULL_IOID) {
+	RemoveTimeOut(kto);
+	kto = NULL_IOID;
+	timeout_match = NULL;
+    }
+    current_node = NULL;
+    build_trie();
 }
 
 /* 3270/NVT mode change. */
@@ -37,6 +37,8 @@
 
 #include "globals.h"
 
+#include <inttypes.h>
+
 #include "3270ds.h"
 #include "actions.h"
 #include "appres.h"
@@ -51,6 +53,7 @@
 #include "query.h"
 #include "resources.h"
 #include "split_host.h"
+#include "stats.h"
 #include "status_dump.h"
 #include "telnet.h"
 #include "utf8.h"
@@ -238,25 +241,26 @@ status_dump(void)
 	}
 
 	if (IN_3270) {
-	    vb_appendf(&r, "%s %d %s, %d %s\n%s %d %s, %d %s\n",
+	    vb_appendf(&r, "%s %" PRIu64 " %s, %" PRIu64 " %s\n"
+		    "%s %" PRIu64 " %s, %" PRIu64 " %s\n",
 		    get_message("sent"),
-		    ns_bsent, (ns_bsent == 1)?
+		    stats[STAT_BYTES_TX], (stats[STAT_BYTES_TX] == 1)?
 			get_message("byte") : get_message("bytes"),
-		    ns_rsent, (ns_rsent == 1)?
+		    stats[STAT_RECORDS_TX], (stats[STAT_RECORDS_TX] == 1)?
 			get_message("record") : get_message("records"),
-		    get_message("Received"), ns_brcvd,
-			(ns_brcvd == 1)? get_message("byte"):
+		    get_message("Received"), stats[STAT_BYTES_RX],
+			(stats[STAT_BYTES_RX] == 1)? get_message("byte"):
 					 get_message("bytes"),
-		    ns_rrcvd,
-		    (ns_rrcvd == 1)? get_message("record"):
+		    stats[STAT_RECORDS_RX],
+		    (stats[STAT_RECORDS_RX] == 1)? get_message("record"):
 				     get_message("records"));
 	} else {
-	    vb_appendf(&r, "%s %d %s, %s %d %s\n",
-		    get_message("sent"), ns_bsent,
-		    (ns_bsent == 1)? get_message("byte"):
+	    vb_appendf(&r, "%s %" PRIu64 " %s, %s %" PRIu64 " %s\n",
+		    get_message("sent"), stats[STAT_BYTES_TX],
+		    (stats[STAT_BYTES_TX] == 1)? get_message("byte"):
 				     get_message("bytes"),
-		    get_message("received"), ns_brcvd,
-		    (ns_brcvd == 1)? get_message("byte"):
+		    get_message("received"), stats[STAT_BYTES_RX],
+		    (stats[STAT_BYTES_RX] == 1)? get_message("byte"):
 				     get_message("bytes"));
 	}
 
@@ -40,6 +40,7 @@
 # include <sys/wait.h>
 # include <sys/types.h>
 # include <sys/socket.h>
+# include <sys/uio.h>
 # include <sys/un.h>
 # include <netinet/in.h>
 # include <arpa/inet.h>
@@ -58,6 +59,7 @@
 #include "names.h"
 #include "peerscript.h"
 #include "s3270_proto.h"
+#include "shmexport.h"
 #include "task.h"
 #include "telnet_core.h"
 #include "trace.h"
@@ -65,7 +67,9 @@
 #include "varbuf.h"
 #include "w3misc.h"
 
-#define CHILD_BUF		1024
+#define CHILD_BUF		8192
+#define CHILD_READ_MIN		8192	/* smallest command read */
+#define CHILD_READ_MAX		(256 * 1024) /* largest command read */
 #define DELAYED_CLOSE_MS	3000
 
 static void child_data(task_cbh handle, const char *buf, size_t len,
@@ -129,7 +133,7 @@ static tcb_t async_script_cb = {
 static tcb_t child_cb = {
     "child",
     IA_SCRIPT,
-    CB_NEW_TASKQ,
+    CB_NEW_TASKQ | CB_FRAMING,
     child_data,
     child_done,
     child_run,
@@ -143,18 +147,21 @@ static tcb_t child_cb = {
 #endif /*]*/
 
 #if defined(_WIN32) /*[*/
-/* Stdout read context. */
+/*
+ * Stdout read context.
+ *
+ * The read end of the pipe is opened for overlapped I/O. The emulator keeps
+ * one read outstanding, directly into the child's output buffer, and the
+ * completion event is handled by the event loop.
+ */
 typedef struct {
     HANDLE pipe_rd_handle;	/* read handle for pipe */
     HANDLE pipe_wr_handle;	/* write handle for pipe */
-    HANDLE enable_event;	/* enable event (emulator to read thread) */
-    HANDLE done_event;		/* done event (read thread to emulator) */
+    HANDLE done_event;		/* read completion event */
     ioid_t done_id;		/* I/O identifier for done event */
-    HANDLE read_thread;		/* read thread */
-    char buf[CHILD_BUF];	/* input  buffer */
-    DWORD nr;			/* length of data in I/O buffer */
+    OVERLAPPED overlapped;	/* overlapped read state */
+    bool pending;		/* read is outstanding */
     int error;			/* error code for failed read */
-    bool dead;			/* read thread has exited, set by read thread */
     bool collected_eof;		/* EOF collected by I/O function */
 } cr_t;
 #endif /*]*/
@@ -192,8 +199,12 @@ typedef struct {
     int infd;			/* input (to emulator) file descriptor */
     int outfd;			/* output (to script) file descriptor */
     ioid_t id;			/* input I/O identifier */
-    char *buf;			/* pending command */
-    size_t buf_len;		/* length of pending command */
+    char *buf;			/* pending commands */
+    size_t buf_len;		/* length of pending commands */
+    size_t buf_start;		/* offset of the next command in buf */
+    size_t buf_alloc;		/* allocated size of buf */
+    size_t read_size;		/* size of the next read */
+    bool framed;		/* using the framed protocol */
     int stdoutpipe;		/* stdout pipe */
     ioid_t stdout_id;		/* stdout I/O identifier */
 #endif /*]*/
@@ -246,6 +257,88 @@ close_listeners(listeners_t *l)
 }
 
 #if !defined(_WIN32) /*[*/
+/**
+ * Write a frame to a child script.
+ *
+ * @param[in] c		Child
+ * @param[in] type	Frame type
+ * @param[in] buf	Payload
+ * @param[in] len	Payload length
+ */
+static void
+child_write_frame(child_t *c, char type, const char *buf, size_t len)
+{
+    unsigned char hdr[FRAME_HDR_LEN];
+    struct iovec iov[2];
+    ssize_t nw;
+
+    hdr[0] = type;
+    hdr[1] = (unsigned char)(len >> 24);
+    hdr[2] = (unsigned char)(len >> 16);
+    hdr[3] = (unsigned char)(len >> 8);
+    hdr[4] = (unsigned char)len;
+    iov[0].iov_base = (void *)hdr;
+    iov[0].iov_len = FRAME_HDR_LEN;
+    iov[1].iov_base = (void *)buf;
+    iov[1].iov_len = len;
+    nw = writev(c->outfd, iov, 2);
+    if (nw != (ssize_t)(FRAME_HDR_LEN + len)) {
+	vtrace("%s: short frame write\n", c->parent_name);
+    }
+}
+
+/**
+ * Run the next framed command in the child buffer.
+ *
+ * @param[in,out] c	Child
+ *
+ * @return true if command was run. Command is deleted from the buffer.
+ */
+static bool
+run_next_framed(child_t *c)
+{
+    unsigned char *hdr;
+    size_t len;
+    char *name;
+
+    if (c->buf_len - c->buf_start < FRAME_HDR_LEN) {
+	return false;
+    }
+    hdr = (unsigned char *)c->buf + c->buf_start;
+    len = ((size_t)hdr[1] << 24) | ((size_t)hdr[2] << 16) |
+	((size_t)hdr[3] << 8) | hdr[4];
+    if (hdr[0] != FRAME_CMD || len > FRAME_MAX) {
+	/*
+	 * There is no way to resynchronize. Stop reading, and the script
+	 * will get an error when it writes again.
+	 */
+	vtrace("%s: bad frame (type 0x%02x, length %u), closing input\n",
+		c->parent_name, hdr[0], (unsigned)len);
+	c->buf_start = 0;
+	c->buf_len = 0;
+	if (c->id != NULL_IOID) {
+	    RemoveInput(c->id);
+	    c->id = NULL_IOID;
+	}
+	close(c->infd);
+	c->infd = -1;
+	return false;
+    }
+    if (c->buf_len - c->buf_start < FRAME_HDR_LEN + len) {
+	return false;
+    }
+
+    name = push_cb((char *)hdr + FRAME_HDR_LEN, len, &child_cb, (task_cbh)c);
+    Replace(c->child_name, NewString(name));
+
+    c->buf_start += FRAME_HDR_LEN + len;
+    if (c->buf_start >= c->buf_len) {
+	c->buf_start = 0;
+	c->buf_len = 0;
+    }
+    return true;
+}
+
 /**
  * Run the next command in the child buffer.
  *
@@ -256,34 +349,35 @@ close_listeners(listeners_t *l)
 static bool
 run_next(child_t *c)
 {
-    size_t cmdlen;
+    char *cmd;
+    char *nl;
     char *name;
 
+    if (c->framed) {
+	return run_next_framed(c);
+    }
+
     /* Find a newline in the buffer. */
-    for (cmdlen = 0; cmdlen < c->buf_len; cmdlen++) {
-	if (c->buf[cmdlen] == '\n') {
-	    break;
-	}
+    if (c->buf_start >= c->buf_len) {
+	return false;
     }
-    if (cmdlen >= c->buf_len) {
+    cmd = c->buf + c->buf_start;
+    nl = memchr(cmd, '\n', c->buf_len - c->buf_start);
+    if (nl == NULL) {
 	return false;
     }
 
-    /*
-     * Run the first command.
-     * cmdlen is the number of characters in the command, not including the
-     * newline.
-     */
-    name = push_cb(c->buf, cmdlen, &child_cb, (task_cbh)c);
+    /* Run the first command, not including the newline. */
+    name = push_cb(cmd, nl - cmd, &child_cb, (task_cbh)c);
     Replace(c->child_name, NewString(name));
 
-    /* If there is more, shift it over. */
-    cmdlen++; /* count the newline */
-    if (c->buf_len > cmdlen) {
-	memmove(c->buf, c->buf + cmdlen, c->buf_len - cmdlen);
-	c->buf_len = c->buf_len - cmdlen;
-    } else {
-	Replace(c->buf, NULL);
+    /*
+     * Step past it. The rest is shifted down only when more input is read,
+     * so a large batch is not copied once per command.
+     */
+    c->buf_start = (nl + 1) - c->buf;
+    if (c->buf_start >= c->buf_len) {
+	c->buf_start = 0;
 	c->buf_len = 0;
     }
     return true;
@@ -380,10 +474,9 @@ child_input(iosrc_t fd _is_unused, ioid_t id)
 {
     child_t *c;
     bool found_child = false;
-    char buf[8192];
-    size_t n2r;
-    size_t nr;
-    size_t i;
+    char *buf;
+    char *cr;
+    ssize_t nr;
 
     /* Find the child. */
     FOREACH_LLIST(&child_scripts, c, child_t *) {
@@ -394,9 +487,20 @@ child_input(iosrc_t fd _is_unused, ioid_t id)
     } FOREACH_LLIST_END(&child_scripts, c, child_t *);
     assert(found_child);
 
+    /* Make room for the read, after any input not yet consumed. */
+    if (c->buf_start > 0) {
+	memmove(c->buf, c->buf + c->buf_start, c->buf_len - c->buf_start);
+	c->buf_len -= c->buf_start;
+	c->buf_start = 0;
+    }
+    if (c->buf_alloc < c->buf_len + c->read_size) {
+	c->buf_alloc = c->buf_len + c->read_size;
+	c->buf = Realloc(c->buf, c->buf_alloc);
+    }
+
     /* Read input. */
-    n2r = sizeof(buf);
-    nr = read(c->infd, buf, (int)n2r);
+    buf = c->buf + c->buf_len;
+    nr = read(c->infd, buf, c->read_size);
     assert(nr >= 0);
     vtrace("%s input complete, nr=%d\n", c->parent_name, (int)nr);
     if (nr == 0) {
@@ -413,15 +517,27 @@ child_input(iosrc_t fd _is_unused, ioid_t id)
 	return;
     }
 
-    /* Append, filtering out CRs. */
-    c->buf = Realloc(c->buf, c->buf_len + nr + 1);
-    for (i = 0; i < nr; i++) {
-	char ch = buf[i];
+    /* Grow the next read if this one filled the buffer, shrink it if idle. */
+    if ((size_t)nr == c->read_size && c->read_size < CHILD_READ_MAX) {
+	c->read_size *= 2;
+    } else if ((size_t)nr < c->read_size / 4 &&
+	    c->read_size > CHILD_READ_MIN) {
+	c->read_size /= 2;
+    }
+
+    /* Keep it, filtering out CRs unless it is framed. */
+    if (!c->framed && (cr = memchr(buf, '\r', nr)) != NULL) {
+	char *end = buf + nr;
+	char *t = cr;
 
-	if (ch != '\r') {
-	    c->buf[c->buf_len++] = ch;
+	for (; cr < end; cr++) {
+	    if (*cr != '\r') {
+		*t++ = *cr;
+	    }
 	}
+	nr = t - buf;
     }
+    c->buf_len += nr;
 
     /* Disable further input. */
     if (c->id != NULL_IOID) {
@@ -430,7 +546,7 @@ child_input(iosrc_t fd _is_unused, ioid_t id)
     }
 
     /* Run the next command, if we have it all. */
-    if (!run_next(c) && c->id == NULL_IOID) {
+    if (!run_next(c) && c->id == NULL_IOID && c->infd != -1) {
 	/* Get more input. */
 	c->id = AddInput(c->infd, child_input);
     }
@@ -496,9 +612,14 @@ child_data(task_cbh handle, const char *buf, size_t len, bool success)
 {
 #if !defined(_WIN32) /*[*/
     child_t *c = (child_t *)handle;
-    char *s = lazyaf(DATA_PREFIX "%.*s\n", (int)len, buf);
+    char *s;
     ssize_t nw;
 
+    if (c->framed) {
+	child_write_frame(c, FRAME_DATA, buf, len);
+	return;
+    }
+    s = lazyaf(DATA_PREFIX "%.*s\n", (int)len, buf);
     nw = write(c->outfd, s, strlen(s));
     if (nw != (ssize_t)strlen(s)) {
 	vtrace("child_data: short write\n");
@@ -519,10 +640,15 @@ child_reqinput(task_cbh handle, const char *buf, size_t len, bool echo)
 {
 #if !defined(_WIN32) /*[*/
     child_t *c = (child_t *)handle;
-    char *s = lazyaf("%s%.*s\n", echo? INPUT_PREFIX: PWINPUT_PREFIX,
-	    (int)len, buf);
+    char *s;
     ssize_t nw;
 
+    if (c->framed) {
+	child_write_frame(c, echo? FRAME_INPUT: FRAME_PWINPUT, buf, len);
+	return;
+    }
+    s = lazyaf("%s%.*s\n", echo? INPUT_PREFIX: PWINPUT_PREFIX, (int)len,
+	    buf);
     nw = write(c->outfd, s, strlen(s));
     if (nw != (ssize_t)strlen(s)) {
 	vtrace("child_reqinput: short write\n");
@@ -562,12 +688,23 @@ child_done(task_cbh handle, bool success, bool abort)
 
     /* Print the prompt. */
     prompt = task_cb_prompt(handle);
-    s = lazyaf("%s\n%s\n", prompt, success? "ok": "error");
     vtrace("Output for %s: %s/%s\n", c->child_name, prompt,
 	success? "ok": "error");
-    nw = write(c->outfd, s, strlen(s));
-    if (nw != (ssize_t)strlen(s)) {
-	vtrace("child_done: short write\n");
+    if (c->framed) {
+	child_write_frame(c, success? FRAME_OK: FRAME_ERROR, prompt,
+		strlen(prompt));
+    } else {
+	s = lazyaf("%s\n%s\n", prompt, success? "ok": "error");
+	nw = write(c->outfd, s, strlen(s));
+	if (nw != (ssize_t)strlen(s)) {
+	    vtrace("child_done: short write\n");
+	}
+
+	/* Switch to the framed protocol once the script has asked for it. */
+	if (success && (c->capabilities & CBF_FRAMED)) {
+	    vtrace("%s switching to framed protocol\n", c->parent_name);
+	    c->framed = true;
+	}
     }
 
     /* Run any pending command that we already read in. */
@@ -599,9 +736,35 @@ child_done(task_cbh handle, bool success, bool abort)
 }
 
 #if defined(_WIN32) /*[*/
+/*
+ * Wait for an outstanding read to finish, canceling it first if asked.
+ * Returns the number of bytes read, and sets cr->error on failure.
+ */
+static DWORD
+cr_finish(cr_t *cr, bool cancel)
+{
+    DWORD nr = 0;
+
+    if (!cr->pending) {
+	return 0;
+    }
+    if (cancel) {
+	CancelIo(cr->pipe_rd_handle);
+    }
+    if (!GetOverlappedResult(cr->pipe_rd_handle, &cr->overlapped, &nr,
+		TRUE)) {
+	cr->error = GetLastError();
+	nr = 0;
+    }
+    cr->pending = false;
+    return nr;
+}
+
 static void
 cr_teardown(cr_t *cr)
 {
+    /* The kernel must be done with the buffer before it is freed. */
+    cr_finish(cr, true);
     if (cr->pipe_rd_handle != INVALID_HANDLE_VALUE) {
 	CloseHandle(cr->pipe_rd_handle);
 	cr->pipe_rd_handle = INVALID_HANDLE_VALUE;
@@ -610,10 +773,6 @@ cr_teardown(cr_t *cr)
 	CloseHandle(cr->pipe_wr_handle);
 	cr->pipe_wr_handle = INVALID_HANDLE_VALUE;
     }
-    if (cr->enable_event != INVALID_HANDLE_VALUE) {
-	CloseHandle(cr->enable_event);
-	cr->enable_event = INVALID_HANDLE_VALUE;
-    }
     if (cr->done_event != INVALID_HANDLE_VALUE) {
 	CloseHandle(cr->done_event);
 	cr->done_event = INVALID_HANDLE_VALUE;
@@ -622,10 +781,6 @@ cr_teardown(cr_t *cr)
 	RemoveInput(cr->done_id);
 	cr->done_id = NULL_IOID;
     }
-    if (cr->read_thread != INVALID_HANDLE_VALUE) {
-	CloseHandle(cr->read_thread);
-	cr->read_thread = INVALID_HANDLE_VALUE;
-    }
 }
 
 /**
@@ -650,39 +805,75 @@ close_child(child_t *c)
 }
 
 /*
- * Collect output from the read thread.
+ * Start a read of the child's stdout/stderr, directly into the end of the
+ * output buffer.
+ * Returns true if the read was started.
+ */
+static bool
+cr_start(child_t *c)
+{
+    cr_t *cr = &c->cr;
+
+    c->output_buf = Realloc(c->output_buf, c->output_buflen + CHILD_BUF + 1);
+    memset(&cr->overlapped, 0, sizeof(cr->overlapped));
+    cr->overlapped.hEvent = cr->done_event;
+    if (!ReadFile(cr->pipe_rd_handle, c->output_buf + c->output_buflen,
+		CHILD_BUF, NULL, &cr->overlapped) &&
+	    GetLastError() != ERROR_IO_PENDING) {
+	/* Pipe broken. */
+	cr->error = GetLastError();
+	return false;
+    }
+
+    /* Even if it completed already, the event is set. */
+    cr->pending = true;
+    return true;
+}
+
+/*
+ * Collect the output from a completed read and start the next one.
+ * If 'wait' is true, waits for the read to complete.
  * Returns true if more input may be available.
  */
 static bool
-cr_collect(child_t *c)
+cr_collect(child_t *c, bool wait)
 {
     cr_t *cr = &c->cr;
-    if (cr->nr != 0) {
-	vtrace("Got %d bytes of script stdout/stderr\n", (int)cr->nr);
-	if (cr->nr == 2 && !strncmp(cr->buf, "^C", 2)) {
+    DWORD nr;
+
+    if (!cr->pending) {
+	return false;
+    }
+    if (!wait && WaitForSingleObject(cr->done_event, 0) != WAIT_OBJECT_0) {
+	return true;
+    }
+    nr = cr_finish(cr, false);
+    if (nr != 0) {
+	char *data = c->output_buf + c->output_buflen;
+
+	vtrace("Got %d bytes of script stdout/stderr\n", (int)nr);
+	if (nr == 2 && !strncmp(data, "^C", 2)) {
 	    /* Hack, hack, hack. */
 	    vtrace("Suppressing '^C' output from child\n");
 	} else {
-	    c->output_buf = Realloc(c->output_buf,
-		    c->output_buflen + cr->nr + 1);
-	    memcpy(c->output_buf + c->output_buflen, cr->buf, cr->nr);
-	    c->output_buflen += cr->nr;
-	    c->output_buf[c->output_buflen] = '\0';
+	    c->output_buflen += nr;
 	}
-
-	/* Ready for more. */
-	cr->nr = 0;
+	c->output_buf[c->output_buflen] = '\0';
     }
-    if (cr->dead) {
-	if (cr->error != 0) {
-	    vtrace("Script stdout/stderr read failed: %s\n",
-		    win32_strerror(cr->error));
-	}
-	cr->collected_eof = true;
-	return false;
+    if (cr->error == 0 && cr_start(c)) {
+	return true;
     }
-    SetEvent(cr->enable_event);
-    return true;
+
+    /* Canceled or pipe broken. */
+    vtrace("Script stdout/stderr read failed: %s\n",
+	    win32_strerror(cr->error));
+    cr->collected_eof = true;
+    if (cr->done_id != NULL_IOID) {
+	/* The event stays set now, so stop watching it. */
+	RemoveInput(cr->done_id);
+	cr->done_id = NULL_IOID;
+    }
+    return false;
 }
 #endif /*]*/
 
@@ -701,14 +892,13 @@ child_run(task_cbh handle, bool *success)
 
     if (c->done) {
 #if defined(_WIN32) /*[*/
-	/* Collect remaining output and let the read thread exit. */
+	/* Collect remaining output, up to EOF. */
 	cr_t *cr = &c->cr;
 
 	if (!cr->collected_eof) {
 	    do {
 		vtrace("Waiting for child final stdout/stderr\n");
-		WaitForSingleObject(cr->done_event, INFINITE);
-	    } while (cr_collect(c));
+	    } while (cr_collect(c, true));
 	}
 #endif /*]*/
 	if (c->output_buflen) {
@@ -780,7 +970,8 @@ child_setflags(task_cbh handle, unsigned flags)
 {
     child_t *c = (child_t *)handle;
 
-    c->capabilities = flags;
+    /* Once negotiated, framing stays on. */
+    c->capabilities = flags | (c->capabilities & CBF_FRAMED);
 }
 
 /**
@@ -990,43 +1181,7 @@ child_exited(iosrc_t fd _is_unused, ioid_t id _is_unused)
     }
 }
 
-/* Read from the child's stdout or stderr. */
-static DWORD WINAPI
-child_read_thread(LPVOID parameter)
-{
-    child_t *child = (child_t *)parameter;
-    cr_t *cr = &child->cr;
-    DWORD success;
-    bool done = false;
-
-    while (!done) {
-	switch (WaitForSingleObject(cr->enable_event, INFINITE)) {
-	case WAIT_OBJECT_0:
-	    success = ReadFile(cr->pipe_rd_handle, cr->buf, CHILD_BUF, &cr->nr,
-		    NULL);
-	    if (!success) {
-		/* Canceled or pipe broken. */
-		cr->error = GetLastError();
-		done = true;
-		break;
-	    }
-	    SetEvent(cr->done_event);
-	    break;
-	default:
-	    cr->error = GetLastError();
-	    done = true;
-	    break;
-	}
-    }
-
-    /* All done, I hope. */
-    cr->nr = 0;
-    cr->dead = true;
-    SetEvent(cr->done_event);
-    return 0;
-}
-
-/* The child stdout/stderr thread produced output. */
+/* A read of the child's stdout/stderr completed. */
 static void
 cr_output(iosrc_t fd, ioid_t id)
 {
@@ -1043,47 +1198,65 @@ cr_output(iosrc_t fd, ioid_t id)
     assert(found_child);
 
     /* Collect the output. */
-    cr_collect(c);
+    cr_collect(c, false);
 }
 
-/* Set up the stdout reader context. */
+/*
+ * Set up the stdout reader context.
+ *
+ * Anonymous pipes do not support overlapped I/O, so this uses a uniquely
+ * named pipe. The emulator's end is overlapped and not inherited; the
+ * child's end is an ordinary inheritable handle.
+ */
 static bool
 setup_cr(child_t *c)
 {
+    static unsigned pipe_serial = 0;
     cr_t *cr = &c->cr;
     SECURITY_ATTRIBUTES sa;
-    DWORD mode;
+    char *pipe_name;
+
+    cr->pipe_rd_handle = INVALID_HANDLE_VALUE;
+    cr->pipe_wr_handle = INVALID_HANDLE_VALUE;
+    cr->done_event = INVALID_HANDLE_VALUE;
+    cr->done_id = NULL_IOID;
 
     /* Create the pipe. */
+    pipe_name = xs_buffer("\\\\.\\pipe\\%s-script-%u-%u", app,
+	    (unsigned)GetCurrentProcessId(), pipe_serial++);
+    cr->pipe_rd_handle = CreateNamedPipe(pipe_name,
+	    PIPE_ACCESS_INBOUND | FILE_FLAG_OVERLAPPED |
+		FILE_FLAG_FIRST_PIPE_INSTANCE,
+	    PIPE_TYPE_BYTE | PIPE_READMODE_BYTE | PIPE_WAIT, 1, 0, CHILD_BUF,
+	    0, NULL);
+    if (cr->pipe_rd_handle == INVALID_HANDLE_VALUE) {
+	popup_an_error("CreateNamedPipe() failed: %s",
+		win32_strerror(GetLastError()));
+	Free(pipe_name);
+	return false;
+    }
     memset(&sa, 0, sizeof(sa));
     sa.nLength = sizeof(SECURITY_ATTRIBUTES);
     sa.bInheritHandle = TRUE;
     sa.lpSecurityDescriptor = NULL;
-    if (!CreatePipe(&cr->pipe_rd_handle, &cr->pipe_wr_handle, &sa, 0)) {
-	popup_an_error("CreatePipe() failed: %s",
+    cr->pipe_wr_handle = CreateFile(pipe_name, GENERIC_WRITE, 0, &sa,
+	    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    Free(pipe_name);
+    if (cr->pipe_wr_handle == INVALID_HANDLE_VALUE) {
+	popup_an_error("CreateFile(pipe) failed: %s",
 		win32_strerror(GetLastError()));
-	return false;
-    }
-    if (!SetHandleInformation(cr->pipe_rd_handle, HANDLE_FLAG_INHERIT, 0)) {
-	popup_an_error("SetHandleInformation() failed: %s",
-		win32_strerror(GetLastError()));
-	CloseHandle(cr->pipe_rd_handle);
-	CloseHandle(cr->pipe_wr_handle);
-	return false;
-    }
-    mode = PIPE_READMODE_BYTE;
-    if (!SetNamedPipeHandleState(cr->pipe_rd_handle, &mode, NULL, NULL)) {
-	popup_an_error("SetNamedPipeHandleState(stdout) failed: %s",
-		win32_strerror(GetLastError()));
-	CloseHandle(cr->pipe_rd_handle);
-	CloseHandle(cr->pipe_wr_handle);
+	cr_teardown(cr);
 	return false;
     }
 
     /* Express interest in their output. */
-    cr->enable_event = CreateEvent(NULL, FALSE, FALSE, NULL);
-    cr->done_event = CreateEvent(NULL, FALSE, FALSE, NULL);
-    cr->read_thread = CreateThread(NULL, 0, child_read_thread, c, 0, NULL);
+    cr->done_event = CreateEvent(NULL, TRUE, FALSE, NULL);
+    if (!cr_start(c)) {
+	popup_an_error("ReadFile(pipe) failed: %s",
+		win32_strerror(cr->error));
+	cr_teardown(cr);
+	return false;
+    }
     cr->done_id = AddInput(cr->done_event, cr_output);
 
     return true;
@@ -1113,6 +1286,7 @@ Script_action(ia_t ia, unsigned argc, const char **argv)
     int inpipe[2] = { -1, -1 };
     int outpipe[2] = { -1, -1 };
     int stdoutpipe[2];
+    const char *shm_path;
 #else /*][*/
     bool share_console = false;
     STARTUPINFO startupinfo;
@@ -1223,6 +1397,7 @@ Script_action(ia_t ia, unsigned argc, const char **argv)
     }
 
     /* Fork and exec the script process. */
+    shm_path = shmexport_path();
     if ((pid = fork()) < 0) {
 	popup_an_error("fork() failed");
 	close(inpipe[0]);
@@ -1259,6 +1434,11 @@ Script_action(ia_t ia, unsigned argc, const char **argv)
 	/* Export the names of the pipes into the environment. */
 	putenv(xs_buffer(OUTPUT_ENV "=%d", outpipe[0]));
 	putenv(xs_buffer(INPUT_ENV "=%d", inpipe[1]));
+	if (shm_path != NULL) {
+	    putenv(xs_buffer(SHM_ENV "=%s", shm_path));
+	} else {
+	    unsetenv(SHM_ENV);
+	}
 
 	/* Set up arguments. */
 	child_argv = (char **)Malloc((argc + 1) * sizeof(char *));
@@ -1280,6 +1460,9 @@ Script_action(ia_t ia, unsigned argc, const char **argv)
     c->done = false;
     c->buf = NULL;
     c->buf_len = 0;
+    c->buf_start = 0;
+    c->buf_alloc = 0;
+    c->read_size = CHILD_READ_MIN;
     c->pid = pid;
     c->exit_id = AddChild(pid, child_exited);
     c->enabled = true;
@@ -1307,6 +1490,7 @@ Script_action(ia_t ia, unsigned argc, const char **argv)
     /* Set up the stdout/stderr output pipes. */
     c = (child_t *)Calloc(1, sizeof(child_t));
     if (!setup_cr(c)) {
+	Free(c->output_buf);
 	Free(c);
 	return false;
     }
@@ -1343,13 +1527,9 @@ Script_action(ia_t ia, unsigned argc, const char **argv)
 		win32_strerror(GetLastError()));
 	close_listeners(&listeners);
 
-	/* Let the read thread complete. */
-	CloseHandle(cr->pipe_wr_handle);
-	cr->pipe_wr_handle = INVALID_HANDLE_VALUE;
-	SetEvent(cr->enable_event);
-	WaitForSingleObject(cr->done_event, INFINITE);
-
+	/* Cancel the outstanding read. */
 	cr_teardown(cr);
+	Free(c->output_buf);
 	Free(c);
 	Free(args);
 	return false;
@@ -1359,7 +1539,6 @@ Script_action(ia_t ia, unsigned argc, const char **argv)
     CloseHandle(process_information.hThread);
     CloseHandle(cr->pipe_wr_handle);
     cr->pipe_wr_handle = INVALID_HANDLE_VALUE;
-    SetEvent(cr->enable_event);
 
     /* Create a new script description. */
     llist_init(&c->llist);
@@ -52,16 +52,24 @@
 #include "unicodec.h"
 #include "ft.h"
 #include "ft_cut.h"
+#include "footprint.h"
 #include "ft_dft.h"
+#include "varbuf.h"	/* must precede hibernate.h */
+#include "hibernate.h"
 #include "host.h"
+#include "keylat.h"
 #include "kybd.h"
 #include "lazya.h"
+#include "observe.h"
 #include "popups.h"
+#include "rtime.h"
 #include "screen.h"
+#include "screenhist.h"
 #include "scroll.h"
 #include "see.h"
 #include "selectc.h"
 #include "sf.h"
+#include "stats.h"
 #include "tables.h"
 #include "task.h"
 #include "telnet_core.h"
@@ -86,8 +94,26 @@ struct ea *ea_buf;		/* 3270 device buffer */
 				/* ea_buf[-1] is the dummy default field
 				   attribute */
 struct ea *aea_buf;	/* alternate 3270 extended attribute buffer */
+
+/*
+ * Buffer arenas. Each holds the dummy default field attribute, followed by
+ * room for one maximum-sized screen, or two once it has been scrolled.
+ * ea_buf and aea_buf are windows into them: scrolling slides ea_buf forward
+ * by a row, and only when it runs out of room is it moved back to the start
+ * of its arena.
+ *
+ * The alternate arena is only allocated when the NVT alternate screen is
+ * first used, and is released after appres.alt_buffer_release seconds back
+ * on the primary screen.
+ */
+static struct ea *ea_arena;	/* arena ea_buf is in */
+static struct ea *aea_arena;	/* arena aea_buf is in */
+static size_t ea_arena_cells;	/* screen cells in ea_arena */
+static size_t aea_arena_cells;	/* screen cells in aea_arena */
+static ioid_t alt_release_id = NULL_IOID;
 bool formatted = false;	/* set in screen_disp */
 bool screen_changed = false;
+unsigned long screen_generation = 0;	/* bumped on every screen change */
 int first_changed = -1;
 int last_changed = -1;
 unsigned char reply_mode = SF_SRM_FIELD;
@@ -110,8 +136,61 @@ static void ctlr_negotiating(bool ignored);
 static void ctlr_connect(bool ignored);
 static int sscp_start;
 static void ctlr_add_ic(int baddr, unsigned char ic);
+static void ctlr_write_run(int baddr, const unsigned char *c, int len,
+	unsigned char cs, unsigned char fg, unsigned char bg,
+	unsigned char gr, unsigned char ic);
 
 static void ticking_stop(struct timeval *tp);
+static void fa_index_ensure(void);
+static void ctlr_fill_range(int baddr, int count, const struct ea *fill,
+	bool attrs);
+static void wcache_trim(size_t budget);
+static size_t wcache_footprint(void);
+static void ctlr_sleep(varbuf_t *blob);
+static void ctlr_wake(const unsigned char *blob);
+
+/*
+ * Field attribute index: the buffer addresses of the field attributes in
+ * ea_buf, in ascending order. Single-location changes keep it up to date;
+ * bulk changes invalidate it, and the next lookup rebuilds it.
+ */
+static int *fa_index = NULL;
+static int fa_count = 0;
+static int fa_index_size = 0;
+static bool fa_index_valid = false;
+static struct ea *fa_index_buf = NULL;	/* buffer the index describes */
+static int fa_index_cells = 0;		/* ROWS*COLS when it was built */
+
+/*
+ * Changed rows: one flag per row, set along with screen_changed, so that a
+ * screen back end can refresh just the rows that were modified since it
+ * last called ctlr_clear_row_changes().
+ */
+static unsigned char *row_changed = NULL;
+static void rows_changed(int bstart, int bend);
+
+/*
+ * Row generations: the value of screen_generation when each row was last
+ * modified, so a consumer holding a copy of the buffer (such as the Snap
+ * action) can refresh just the rows that are out of date.
+ */
+static unsigned long *row_gen = NULL;
+static void rows_touched(int bstart, int bend);
+
+/*
+ * DBCS post-processing state: the span of ea_buf changed since the last
+ * pass, and the SO/SI state found at each field attribute by that pass, so
+ * the next one can start at an unchanged field and stop as soon as the
+ * state downstream of the changes matches what it was before.
+ */
+static bool dbcs_dirty_all = true;
+static int dbcs_dirty_first = -1;
+static int dbcs_dirty_last = -1;
+static int dbcs_faddr0 = -1;		/* scan origin of the last pass */
+static unsigned char *dbcs_fa_state = NULL;
+static int dbcs_fa_state_cells = 0;
+#define DBCS_ST_SO	0x1
+#define DBCS_ST_SI	0x2
 
 /*
  * code_table is used to translate buffer addresses and attributes to the 3270
@@ -129,12 +208,21 @@ static unsigned char code_table[64] = {
 };
 
 #define IsBlank(c)	((c == EBC_null) || (c == EBC_space))
+#define SCAN_BLOCK	64	/* cells per block in whole-buffer scans */
 
 #define ALL_CHANGED	{ \
 	screen_changed = true; \
+	screen_generation++; \
+	rows_changed(0, ROWS*COLS); \
+	dbcs_dirty_all = true; \
 	if (IN_NVT) { first_changed = 0; last_changed = ROWS*COLS; } }
 #define REGION_CHANGED(f, l)	{ \
 	screen_changed = true; \
+	screen_generation++; \
+	rows_changed(f, l); \
+	if (dbcs_dirty_first == -1 || f < dbcs_dirty_first) \
+	    dbcs_dirty_first = f; \
+	if (l > dbcs_dirty_last) dbcs_dirty_last = l; \
 	if (IN_NVT) { \
 	    if (first_changed == -1 || f < first_changed) first_changed = f; \
 	    if (last_changed == -1 || l > last_changed) last_changed = l; } }
@@ -155,16 +243,83 @@ static unsigned char code_table[64] = {
 	} \
     }
 
+/*
+ * Toggle the Erase/Write cache size, in bytes. Zero turns it off.
+ */
+static bool
+toggle_write_cache_size(const char *name, const char *value)
+{
+    unsigned long l;
+    char *end;
+    int size;
+
+    if (!*value) {
+	appres.write_cache_size = 0;
+	return true;
+    }
+
+    l = strtoul(value, &end, 10);
+    size = (int)l;
+    if (*end != '\0' || (unsigned long)size != l || size < 0) {
+	popup_an_error("Invalid %s value", name);
+	return false;
+    }
+    appres.write_cache_size = size;
+    return true;
+}
+
+/* Footprint of the screen buffers. */
+static size_t
+ea_buf_footprint(void)
+{
+    return ea_arena_cells * sizeof(struct ea);
+}
+
+static size_t
+aea_buf_footprint(void)
+{
+    return aea_arena_cells * sizeof(struct ea);
+}
+
+static size_t
+zero_buf_footprint(void)
+{
+    return (zero_buf != NULL)? maxROWS * maxCOLS * sizeof(struct ea): 0;
+}
+
 /**
  * Controller module registration.
  */
 void
 ctlr_register(void)
 {
+    static footprint_t footprints[] = {
+	{ "ea-buf", ea_buf_footprint, false },
+	{ "aea-buf", aea_buf_footprint, false },
+	{ "zero-buf", zero_buf_footprint, false },
+	{ "write-cache", wcache_footprint, false }
+    };
+
     /* Register callback routines. */
     register_schange(ST_NEGOTIATING, ctlr_negotiating);
     register_schange(ST_CONNECT, ctlr_connect);
     register_schange(ST_3270_MODE, ctlr_connect);
+
+    /* Register the response time histograms. */
+    rtime_register();
+
+    /* Register the Erase/Write cache size. */
+    register_extended_toggle(ResWriteCacheSize, toggle_write_cache_size,
+	    NULL, NULL, (void **)&appres.write_cache_size, XRM_INT);
+
+    /* Register the hibernation functions. */
+    register_hibernator(ctlr_sleep, ctlr_wake);
+
+    /* Register the structured field module. */
+    sf_register();
+
+    /* Register the buffer sizes. */
+    register_footprints(footprints, array_count(footprints));
 }
 
 /*
@@ -176,36 +331,123 @@ ctlr_init(unsigned cmask)
     ctlr_reinit(cmask);
 }
 
+/*
+ * Allocate a buffer arena with room for one maximum-sized screen.
+ * Returns the arena, and the window into it.
+ */
+static struct ea *
+arena_alloc(struct ea **bufp, size_t *cellsp)
+{
+    struct ea *arena = (struct ea *)Calloc(sizeof(struct ea),
+	    (maxROWS * maxCOLS) + 1);
+
+    arena[0].fa = FA_PRINTABLE | FA_MODIFY;
+    *bufp = arena + 1;
+    *cellsp = maxROWS * maxCOLS;
+    return arena;
+}
+
+/*
+ * Release the alternate screen buffer, after a while on the primary screen.
+ */
+static void
+alt_release(ioid_t id _is_unused)
+{
+    alt_release_id = NULL_IOID;
+    if (!is_altbuffer) {
+	Replace(aea_arena, NULL);
+	aea_buf = NULL;
+	aea_arena_cells = 0;
+    }
+}
+
+/*
+ * Hibernate: pack the screen buffers and free them, along with everything
+ * that can be rebuilt from them.
+ */
+static void
+ctlr_sleep(varbuf_t *blob)
+{
+    unsigned char alt = is_altbuffer;
+
+    /*
+     * The idle primary screen is kept while the alternate screen is in use.
+     * An idle alternate screen is dropped, as alt_release() would.
+     */
+    vb_append(blob, (char *)&alt, 1);
+    if (is_altbuffer) {
+	hib_pack(blob, aea_buf, sizeof(struct ea), maxROWS * maxCOLS);
+    }
+    Replace(aea_arena, NULL);
+    aea_buf = NULL;
+    aea_arena_cells = 0;
+    if (alt_release_id != NULL_IOID) {
+	RemoveTimeOut(alt_release_id);
+	alt_release_id = NULL_IOID;
+    }
+
+    hib_pack(blob, ea_buf, sizeof(struct ea), maxROWS * maxCOLS);
+    Replace(ea_arena, NULL);
+    ea_buf = NULL;
+    ea_arena_cells = 0;
+    Replace(zero_buf, NULL);
+
+    ctlr_invalidate_fa_index();
+    Replace(fa_index, NULL);
+    fa_index_size = 0;
+    Replace(dbcs_fa_state, NULL);
+    dbcs_fa_state_cells = 0;
+    dbcs_dirty_all = true;
+    wcache_trim(0);
+}
+
+/*
+ * Wake from hibernation: restore the screen buffers.
+ */
+static void
+ctlr_wake(const unsigned char *blob)
+{
+    bool alt = *blob++ != 0;
+
+    if (alt) {
+	aea_arena = arena_alloc(&aea_buf, &aea_arena_cells);
+	blob = hib_unpack(blob, aea_buf, sizeof(struct ea),
+		maxROWS * maxCOLS);
+    }
+    ea_arena = arena_alloc(&ea_buf, &ea_arena_cells);
+    hib_unpack(blob, ea_buf, sizeof(struct ea), maxROWS * maxCOLS);
+    zero_buf = (unsigned char *)Calloc(sizeof(struct ea), maxROWS * maxCOLS);
+}
+
 /*
  * Reinitialize the emulated 3270 hardware.
  */
 void
 ctlr_reinit(unsigned cmask)
 {
-    static struct ea *real_ea_buf = NULL;
-    static struct ea *real_aea_buf = NULL;
-
     if (cmask & MODEL_CHANGE) {
 	/* Allocate buffers */
-	if (real_ea_buf) {
-	    Free((char *)real_ea_buf);
-	}
-	real_ea_buf = (struct ea *)Calloc(sizeof(struct ea),
-		(maxROWS * maxCOLS) + 1);
-	ea_buf = real_ea_buf + 1;
-	if (real_aea_buf) {
-	    Free((char *)real_aea_buf);
-	}
-	real_aea_buf = (struct ea *)Calloc(sizeof(struct ea),
-		(maxROWS * maxCOLS) + 1);
-	aea_buf = real_aea_buf + 1;
+	Replace(ea_arena, arena_alloc(&ea_buf, &ea_arena_cells));
+	if (is_altbuffer) {
+	    /* The idle buffer is the primary screen, so it is needed. */
+	    Replace(aea_arena, arena_alloc(&aea_buf, &aea_arena_cells));
+	} else {
+	    Replace(aea_arena, NULL);
+	    aea_buf = NULL;
+	    aea_arena_cells = 0;
+	}
 	Replace(zero_buf, (unsigned char *)Calloc(sizeof(struct ea),
 		    maxROWS * maxCOLS));
 	cursor_addr = 0;
 	buffer_addr = 0;
 
-	ea_buf[-1].fa  = FA_PRINTABLE | FA_MODIFY;
-	aea_buf[-1].fa = FA_PRINTABLE | FA_MODIFY;
+	ctlr_invalidate_fa_index();
+	Replace(row_changed, (unsigned char *)Malloc(maxROWS));
+	memset(row_changed, 1, maxROWS);
+	Replace(row_gen,
+		(unsigned long *)Malloc(maxROWS * sizeof(unsigned long)));
+	screen_generation++;
+	rows_touched(0, maxROWS * maxCOLS);
     }
 }
 
@@ -310,17 +552,8 @@ ctlr_reset(void)
 static void
 set_formatted(void)
 {
-    int baddr;
-
-    formatted = false;
-    baddr = 0;
-    do {
-	if (ea_buf[baddr].fa) {
-	    formatted = true;
-	    break;
-	}
-	INC_BA(baddr);
-    } while (baddr != 0);
+    fa_index_ensure();
+    formatted = fa_count > 0;
 }
 
 /*
@@ -367,6 +600,156 @@ ctlr_connect(bool ignored _is_unused)
     }
 }
 
+/*
+ * Note that the field attributes in ea_buf have been changed in bulk.
+ */
+void
+ctlr_invalidate_fa_index(void)
+{
+    fa_index_valid = false;
+}
+
+/*
+ * Returns true if the field attribute index describes the current buffer.
+ */
+static bool
+fa_index_current(void)
+{
+    return fa_index_valid && fa_index_buf == ea_buf &&
+	fa_index_cells == ROWS * COLS;
+}
+
+/*
+ * Make sure the field attribute index is up to date, rebuilding it if
+ * necessary.
+ */
+static void
+fa_index_ensure(void)
+{
+    int baddr;
+
+    if (fa_index_current()) {
+	return;
+    }
+    if (fa_index_size < ROWS * COLS) {
+	fa_index_size = ROWS * COLS;
+	fa_index = (int *)Realloc(fa_index, fa_index_size * sizeof(int));
+    }
+    fa_count = 0;
+    for (baddr = 0; baddr < ROWS * COLS; baddr++) {
+	if (ea_buf[baddr].fa) {
+	    fa_index[fa_count++] = baddr;
+	}
+    }
+    fa_index_buf = ea_buf;
+    fa_index_cells = ROWS * COLS;
+    fa_index_valid = true;
+}
+
+/*
+ * Returns the position of the first field attribute in the index whose
+ * address is greater than or equal to baddr.
+ */
+static int
+fa_index_lower_bound(int baddr)
+{
+    int lo = 0;
+    int hi = fa_count;
+
+    while (lo < hi) {
+	int mid = lo + (hi - lo) / 2;
+
+	if (fa_index[mid] < baddr) {
+	    lo = mid + 1;
+	} else {
+	    hi = mid;
+	}
+    }
+    return lo;
+}
+
+/*
+ * Record a new field attribute at baddr in the index.
+ */
+static void
+fa_index_add(int baddr)
+{
+    int ix;
+
+    if (!fa_index_current()) {
+	return;
+    }
+    ix = fa_index_lower_bound(baddr);
+    if (ix < fa_count && fa_index[ix] == baddr) {
+	return;
+    }
+    if (fa_count >= fa_index_size) {
+	/* Can't happen, but don't make it worse. */
+	fa_index_valid = false;
+	return;
+    }
+    memmove(&fa_index[ix + 1], &fa_index[ix], (fa_count - ix) * sizeof(int));
+    fa_index[ix] = baddr;
+    fa_count++;
+}
+
+/*
+ * Remove the field attribute at baddr from the index.
+ */
+static void
+fa_index_remove(int baddr)
+{
+    int ix;
+
+    if (!fa_index_current()) {
+	return;
+    }
+    ix = fa_index_lower_bound(baddr);
+    if (ix < fa_count && fa_index[ix] == baddr) {
+	memmove(&fa_index[ix], &fa_index[ix + 1],
+		(fa_count - ix - 1) * sizeof(int));
+	fa_count--;
+    }
+}
+
+/*
+ * Returns the address of the next field attribute after baddr, wrapping
+ * around the end of the buffer, or -1 if the screen isn't formatted.
+ * Passing -1 returns the first field attribute on the screen.
+ */
+static int
+next_fa(int baddr)
+{
+    int ix;
+
+    fa_index_ensure();
+    if (fa_count == 0) {
+	return -1;
+    }
+    ix = fa_index_lower_bound(baddr + 1);
+    if (ix >= fa_count) {
+	ix = 0;
+    }
+    return fa_index[ix];
+}
+
+/*
+ * Returns the number of field attributes on the screen, and sets *addrs to
+ * their buffer addresses in ascending order. The array is only valid until
+ * the buffer is next changed.
+ */
+int
+ctlr_field_addrs(const int **addrs)
+{
+    if (!formatted) {
+	*addrs = NULL;
+	return 0;
+    }
+    fa_index_ensure();
+    *addrs = fa_index;
+    return fa_count;
+}
+
 /*
  * Find the buffer address of the field attribute for a given buffer address.
  * Returns -1 if the screen isn't formatted.
@@ -376,6 +759,22 @@ find_field_attribute_ea(int baddr, struct ea *ea)
 {
     int sbaddr;
 
+    if (ea == ea_buf) {
+	int ix;
+
+	/* Use the index. */
+	fa_index_ensure();
+	if (fa_count == 0) {
+	    return -1;
+	}
+	ix = fa_index_lower_bound(baddr + 1) - 1;
+	if (ix < 0) {
+	    /* Wrap to the last field on the screen. */
+	    ix = fa_count - 1;
+	}
+	return fa_index[ix];
+    }
+
     sbaddr = baddr;    
     do {   
 	if (ea[baddr].fa) {
@@ -463,18 +862,20 @@ fa2ea(int baddr)
 int
 next_unprotected(int baddr0)
 {
-    register int baddr, nbaddr;
+    int ix0, i;
+
+    /* Walk the field attribute index forward from baddr0, wrapping. */
+    fa_index_ensure();
+    ix0 = fa_index_lower_bound(baddr0);
+    for (i = 0; i < fa_count; i++) {
+	int baddr = fa_index[(ix0 + i) % fa_count];
+	int nbaddr = baddr;
 
-    nbaddr = baddr0;
-    do {
-	baddr = nbaddr;
 	INC_BA(nbaddr);
-	if (ea_buf[baddr].fa &&
-		!FA_IS_PROTECTED(ea_buf[baddr].fa) &&
-		!ea_buf[nbaddr].fa) {
+	if (!FA_IS_PROTECTED(ea_buf[baddr].fa) && !ea_buf[nbaddr].fa) {
 	    return nbaddr;
 	}
-    } while (nbaddr != baddr0);
+    }
     return 0;
 }
 
@@ -529,8 +930,8 @@ ctlr_erase(bool alt)
 /*
  * Interpret an incoming 3270 command.
  */
-enum pds
-process_ds(unsigned char *buf, size_t buflen)
+static enum pds
+process_ds_cmd(unsigned char *buf, size_t buflen)
 {
     enum pds rv;
 
@@ -598,6 +999,23 @@ process_ds(unsigned char *buf, size_t buflen)
     }
 }
 
+/*
+ * Interpret an incoming 3270 command, and save the screen in the history if
+ * it changed.
+ */
+enum pds
+process_ds(unsigned char *buf, size_t buflen)
+{
+    unsigned long generation = screen_generation;
+    enum pds rv = process_ds_cmd(buf, buflen);
+
+    if (screen_generation != generation) {
+	screenhist_capture();
+	observe_screen();
+    }
+    return rv;
+}
+
 /*
  * Functions to insert SA attributes into the inbound data stream.
  */
@@ -667,6 +1085,58 @@ insert_sa(int baddr, unsigned char *current_fgp, unsigned char *current_bgp,
 }
 
 
+/*
+ * Returns the largest possible Read Modified reply: the AID and cursor
+ * address, an SBA per field, plus a GE order and a character per buffer
+ * position, plus an SA order for each attribute in character reply mode.
+ */
+static size_t
+rm_max_size(void)
+{
+    size_t per_char = 2;
+
+    if (reply_mode == SF_SRM_CHAR) {
+	per_char += 3 * crm_nattr;
+    }
+    return 4 + (formatted? 3 * (size_t)fa_count: 0) +
+	(size_t)(ROWS * COLS) * per_char;
+}
+
+/*
+ * Append the non-null characters of a field to the output buffer, with no
+ * SA orders and no tracing. The space must already have been reserved.
+ */
+static void
+rm_copy_field(int baddr, int len)
+{
+    while (len > 0) {
+	int n = ROWS * COLS - baddr;
+	struct ea *ea, *end;
+
+	if (n > len) {
+	    n = len;
+	}
+	ea = &ea_buf[baddr];
+	end = ea + n;
+	while (ea < end) {
+	    /* Skip a run of nulls. */
+	    while (ea < end && !ea->ec) {
+		ea++;
+	    }
+	    /* Copy a run of characters. */
+	    while (ea < end && ea->ec) {
+		if (ea->cs & CS_GE) {
+		    *obptr++ = ORDER_GE;
+		}
+		*obptr++ = ea->ec;
+		ea++;
+	    }
+	}
+	len -= n;
+	baddr = 0;
+    }
+}
+
 /*
  * Process a 3270 Read-Modified command and transmit the data back to the
  * host.
@@ -674,7 +1144,7 @@ insert_sa(int baddr, unsigned char *current_fgp, unsigned char *current_bgp,
 void
 ctlr_read_modified(unsigned char aid_byte, bool all)
 {
-    int baddr, sbaddr;
+    int baddr;
     bool send_data = true;
     bool short_read = false;
     unsigned char current_fg = 0x00;
@@ -692,8 +1162,14 @@ ctlr_read_modified(unsigned char aid_byte, bool all)
 	return;
     }
 
-    trace_ds("> ");
+    /* Reserve space once for the largest possible reply. */
     obptr = obuf;
+    if (formatted) {
+	fa_index_ensure();
+    }
+    space3270out(rm_max_size());
+
+    trace_ds("> ");
 
     switch (aid_byte) {
 
@@ -738,71 +1214,69 @@ ctlr_read_modified(unsigned char aid_byte, bool all)
     }
 
     baddr = 0;
-    if (formatted) {
-	/* find first field attribute */
-	do {
-	    if (ea_buf[baddr].fa) {
-		break;
+    if (formatted && fa_count > 0) {
+	bool fast = send_data && !toggled(TRACING) &&
+	    reply_mode != SF_SRM_CHAR;
+	int i;
+
+	/* Visit only the fields, via the field attribute index. */
+	for (i = 0; i < fa_count; i++) {
+	    int fa_addr = fa_index[i];
+	    int end = fa_index[(i + 1) % fa_count];
+	    bool any = false;
+
+	    if (!FA_IS_MODIFIED(ea_buf[fa_addr].fa)) {
+		continue;
 	    }
+	    baddr = fa_addr;
 	    INC_BA(baddr);
-	} while (baddr != 0);
-	sbaddr = baddr;
-	do {
-	    if (FA_IS_MODIFIED(ea_buf[baddr].fa)) {
-		bool any = false;
-
-		INC_BA(baddr);
-		space3270out(3);
-		*obptr++ = ORDER_SBA;
-		ENCODE_BADDR(obptr, baddr);
-		trace_ds(" SetBufferAddress%s", rcba(baddr));
-		while (!ea_buf[baddr].fa) {
-		    if (send_data && ea_buf[baddr].ec) {
-			insert_sa(baddr,
-			    &current_fg,
-			    &current_bg,
-			    &current_gr,
-			    &current_cs,
-			    &current_ic,
-			    &any);
-			if (ea_buf[baddr].cs & CS_GE) {
-			    space3270out(1);
-			    *obptr++ = ORDER_GE;
-			    if (any) {
-				trace_ds("'");
-			    }
-			    trace_ds(" GraphicEscape");
-			    any = false;
+	    *obptr++ = ORDER_SBA;
+	    ENCODE_BADDR(obptr, baddr);
+	    trace_ds(" SetBufferAddress%s", rcba(baddr));
+	    if (fast) {
+		rm_copy_field(baddr, (end - baddr + ROWS * COLS) % (ROWS * COLS));
+		continue;
+	    }
+	    while (baddr != end) {
+		if (send_data && ea_buf[baddr].ec) {
+		    insert_sa(baddr,
+			&current_fg,
+			&current_bg,
+			&current_gr,
+			&current_cs,
+			&current_ic,
+			&any);
+		    if (ea_buf[baddr].cs & CS_GE) {
+			*obptr++ = ORDER_GE;
+			if (any) {
+			    trace_ds("'");
+			}
+			trace_ds(" GraphicEscape");
+			any = false;
+		    }
+		    *obptr++ = ea_buf[baddr].ec;
+		    if (ea_buf[baddr].ec <= 0x3f ||
+			ea_buf[baddr].ec == 0xff) {
+			if (any) {
+			    trace_ds("'");
 			}
-			space3270out(1);
-			*obptr++ = ea_buf[baddr].ec;
-			if (ea_buf[baddr].ec <= 0x3f ||
-			    ea_buf[baddr].ec == 0xff) {
-			    if (any) {
-				trace_ds("'");
-			    }
-
-			    trace_ds(" %s", see_ebc(ea_buf[baddr].ec));
-			    any = false;
-			} else {
-			    if (!any) {
-				trace_ds(" '");
-			    }
-			    trace_ds("%s", see_ebc(ea_buf[baddr].ec));
-			    any = true;
+
+			trace_ds(" %s", see_ebc(ea_buf[baddr].ec));
+			any = false;
+		    } else {
+			if (!any) {
+			    trace_ds(" '");
 			}
+			trace_ds("%s", see_ebc(ea_buf[baddr].ec));
+			any = true;
 		    }
-		    INC_BA(baddr);
-		}
-		if (any) {
-		    trace_ds("'");
 		}
-	    } else {	/* not modified - skip */
-		do {
-		    INC_BA(baddr);
-		} while (!ea_buf[baddr].fa);
+		INC_BA(baddr);
 	    }
-	} while (baddr != sbaddr);
+	    if (any) {
+		trace_ds("'");
+	    }
+	}
     } else {
 	bool any = false;
 	int nbytes = 0;
@@ -825,7 +1299,6 @@ ctlr_read_modified(unsigned char aid_byte, bool all)
 		    &current_ic,
 		    &any);
 		if (ea_buf[baddr].cs & CS_GE) {
-		    space3270out(1);
 		    *obptr++ = ORDER_GE;
 		    if (any) {
 			trace_ds("' ");
@@ -833,7 +1306,6 @@ ctlr_read_modified(unsigned char aid_byte, bool all)
 		    trace_ds(" GraphicEscape ");
 		    any = false;
 		}
-		space3270out(1);
 		*obptr++ = ea_buf[baddr].ec;
 		if (ea_buf[baddr].ec <= 0x3f ||
 		    ea_buf[baddr].ec == 0xff) {
@@ -869,6 +1341,7 @@ ctlr_read_modified(unsigned char aid_byte, bool all)
 
 rm_done:
     trace_ds("\n");
+    keylat_stage(KEYLAT_ENCODE);
     net_output();
 }
 
@@ -1186,6 +1659,7 @@ ctlr_snap_buffer_sscp_lu(void)
 void
 ctlr_erase_all_unprotected(void)
 {
+    static const struct ea null_fill = { EBC_null };
     int baddr, sbaddr;
     unsigned char fa;
     bool f;
@@ -1193,45 +1667,238 @@ ctlr_erase_all_unprotected(void)
     kybd_inhibit(false);
 
     ALL_CHANGED;
-    if (formatted) {
-	/* find first field attribute */
-	baddr = 0;
-	do {
-	    if (ea_buf[baddr].fa) {
-		break;
-	    }
-	    INC_BA(baddr);
-	} while (baddr != 0);
-	sbaddr = baddr;
+    if (formatted && (sbaddr = next_fa(-1)) >= 0) {
+	baddr = sbaddr;
 	f = false;
 	do {
 	    fa = ea_buf[baddr].fa;
 	    if (!FA_IS_PROTECTED(fa)) {
+		int nbaddr = next_fa(baddr);
+		int count = nbaddr - baddr - 1;
+
 		mdt_clear(baddr);
-		do {
-		    INC_BA(baddr);
-		    if (!f) {
-			cursor_move(baddr);
-			    f = true;
-		    }
-		    if (!ea_buf[baddr].fa) {
-			ctlr_add(baddr, EBC_null, 0);
-		    }
-		} while (!ea_buf[baddr].fa);
+		if (count < 0) {
+		    count += ROWS * COLS;
+		}
+		INC_BA(baddr);
+		if (!f) {
+		    cursor_move(baddr);
+		    f = true;
+		}
+
+		/* Null out the whole field at once. */
+		ctlr_fill_range(baddr, count, &null_fill, false);
+		baddr = nbaddr;
 	    } else {
-		do {
-		    INC_BA(baddr);
-		} while (!ea_buf[baddr].fa);
+		baddr = next_fa(baddr);
 	    }
 	} while (baddr != sbaddr);
 	if (!f) {
 	    cursor_move(0);
 	}
-    } else {
-	ctlr_clear(true);
+    } else {
+	ctlr_clear(true);
+    }
+    aid = AID_NO;
+    do_reset(false);
+}
+
+/*
+ * Erase/Write cache.
+ *
+ * Host applications repaint the same panels over and over. An Erase/Write
+ * starts from a cleared buffer, so the buffer it leaves depends only on the
+ * orders and data after the WCC and on the screen geometry. The cache keeps
+ * the resulting buffer image and field list for recent records, so a
+ * repeat is applied with bulk copies instead of being parsed again. The
+ * WCC is handled as usual on every write. The cache is not used while
+ * tracing, so the trace always shows the orders.
+ */
+typedef struct wcache {
+    struct wcache *next;	/* next entry, least recently used last */
+    uint64_t hash;		/* hash of the record after the WCC */
+    unsigned char *record;	/* the record after the WCC */
+    size_t record_len;
+    int rows, cols;		/* screen geometry */
+    bool m3279;			/* color mode */
+    bool dbcs;			/* DBCS mode */
+    struct ea *image;		/* resulting buffer */
+    int *fields;		/* field attribute addresses */
+    int nfields;
+    int buffer_addr;		/* resulting buffer address */
+    bool insert_cursor;		/* an IC order was processed */
+    int ic_baddr;		/*  where */
+    unsigned char defaults[5];	/* resulting default fg, bg, gr, cs, ic */
+    bool blink;			/* image contains blinking text */
+    enum pds rv;		/* result */
+    size_t size;		/* bytes used */
+} wcache_t;
+static wcache_t *wcache_list = NULL;
+static size_t wcache_bytes = 0;
+
+/* Hash a write record, FNV-1a style. */
+static uint64_t
+wcache_hash(const unsigned char *buf, size_t len)
+{
+    uint64_t h = 0xcbf29ce484222325ULL;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+	h = (h ^ buf[i]) * 0x100000001b3ULL;
+    }
+    return h;
+}
+
+/* Free a cache entry. */
+static void
+wcache_free(wcache_t *w)
+{
+    wcache_bytes -= w->size;
+    Free(w->record);
+    Free(w->image);
+    Free(w->fields);
+    Free(w);
+}
+
+/* Drop entries from the least recently used end until the budget is met. */
+static void
+wcache_trim(size_t budget)
+{
+    while (wcache_bytes > budget && wcache_list != NULL) {
+	wcache_t **wp = &wcache_list;
+
+	while ((*wp)->next != NULL) {
+	    wp = &(*wp)->next;
+	}
+	wcache_free(*wp);
+	*wp = NULL;
+    }
+}
+
+/* Footprint of the Erase/Write cache. */
+static size_t
+wcache_footprint(void)
+{
+    return wcache_bytes;
+}
+
+/* Returns true if the cache can be used for this write. */
+static bool
+wcache_usable(void)
+{
+    if (appres.write_cache_size <= 0) {
+	if (wcache_list != NULL) {
+	    wcache_trim(0);
+	}
+	return false;
+    }
+    return !toggled(TRACING);
+}
+
+/*
+ * Look up an Erase/Write record. On a hit, the entry is moved to the front
+ * of the list and returned.
+ */
+static wcache_t *
+wcache_find(const unsigned char *buf, size_t len)
+{
+    uint64_t h = wcache_hash(buf, len);
+    wcache_t **wp;
+
+    for (wp = &wcache_list; *wp != NULL; wp = &(*wp)->next) {
+	wcache_t *w = *wp;
+
+	if (w->hash == h && w->record_len == len && w->rows == ROWS &&
+		w->cols == COLS && w->m3279 == mode.m3279 &&
+		w->dbcs == dbcs && !memcmp(w->record, buf, len)) {
+	    *wp = w->next;
+	    w->next = wcache_list;
+	    wcache_list = w;
+	    stats_inc(STAT_WRITE_CACHE_HITS);
+	    return w;
+	}
+    }
+    stats_inc(STAT_WRITE_CACHE_MISSES);
+    return NULL;
+}
+
+/* Apply a cache entry to the cleared buffer. */
+static void
+wcache_apply(const wcache_t *w)
+{
+    memcpy(ea_buf, w->image, ROWS * COLS * sizeof(struct ea));
+    if (fa_index_size < ROWS * COLS) {
+	fa_index_size = ROWS * COLS;
+	fa_index = (int *)Realloc(fa_index, fa_index_size * sizeof(int));
+    }
+    memcpy(fa_index, w->fields, w->nfields * sizeof(int));
+    fa_count = w->nfields;
+    fa_index_buf = ea_buf;
+    fa_index_cells = ROWS * COLS;
+    fa_index_valid = true;
+    ALL_CHANGED;
+    buffer_addr = w->buffer_addr;
+    default_fg = w->defaults[0];
+    default_bg = w->defaults[1];
+    default_gr = w->defaults[2];
+    default_cs = w->defaults[3];
+    default_ic = w->defaults[4];
+    if (w->blink) {
+	blink_start();
+    }
+}
+
+/* Remember the result of an Erase/Write. */
+static void
+wcache_store(const unsigned char *buf, size_t len, bool insert_cursor,
+	int ic_baddr, enum pds rv)
+{
+    size_t cells = ROWS * COLS;
+    size_t size = sizeof(wcache_t) + len + cells * sizeof(struct ea);
+    wcache_t *w;
+    size_t i;
+
+    fa_index_ensure();
+    size += fa_count * sizeof(int);
+    if (size > (size_t)appres.write_cache_size) {
+	return;
+    }
+    wcache_trim(appres.write_cache_size - size);
+
+    w = (wcache_t *)Calloc(1, sizeof(wcache_t));
+    w->hash = wcache_hash(buf, len);
+    w->record = (unsigned char *)Malloc(len? len: 1);
+    memcpy(w->record, buf, len);
+    w->record_len = len;
+    w->rows = ROWS;
+    w->cols = COLS;
+    w->m3279 = mode.m3279;
+    w->dbcs = dbcs;
+    w->image = (struct ea *)Malloc(cells * sizeof(struct ea));
+    memcpy(w->image, ea_buf, cells * sizeof(struct ea));
+    w->fields = (int *)Malloc((fa_count? fa_count: 1) * sizeof(int));
+    memcpy(w->fields, fa_index, fa_count * sizeof(int));
+    w->nfields = fa_count;
+    w->buffer_addr = buffer_addr;
+    w->insert_cursor = insert_cursor;
+    w->ic_baddr = ic_baddr;
+    w->defaults[0] = default_fg;
+    w->defaults[1] = default_bg;
+    w->defaults[2] = default_gr;
+    w->defaults[3] = default_cs;
+    w->defaults[4] = default_ic;
+    for (i = 0; i < cells; i++) {
+	if (ea_buf[i].gr & GR_BLINK) {
+	    w->blink = true;
+	    break;
+	}
     }
-    aid = AID_NO;
-    do_reset(false);
+    w->rv = rv;
+    w->size = size;
+
+    w->next = wcache_list;
+    wcache_list = w;
+    wcache_bytes += size;
 }
 
 /*
@@ -1267,6 +1934,8 @@ ctlr_write(unsigned char buf[], size_t buflen, bool erase)
     char mb[16];
     bool insert_cursor = false;
     int ic_baddr = 0;
+    bool use_cache;
+    wcache_t *cached = NULL;
 
 #define END_TEXT0	{ if (previous == TEXT) trace_ds("'"); }
 #define END_TEXT(cmd)	{ END_TEXT0; trace_ds(" %s", cmd); }
@@ -1318,16 +1987,13 @@ ctlr_write(unsigned char buf[], size_t buflen, bool erase)
     if (WCC_RESET_MDT(buf[1])) {
 	trace_ds("%sresetMDT", paren);
 	paren = ",";
-	baddr = 0;
 	if (appres.modified_sel) {
 	    ALL_CHANGED;
 	}
-	do {
-	    if (ea_buf[baddr].fa) {
-		mdt_clear(baddr);
-	    }
-	    INC_BA(baddr);
-	} while (baddr != 0);
+	fa_index_ensure();
+	for (i = 0; i < fa_count; i++) {
+	    ea_buf[fa_index[i]].fa &= ~FA_MODIFY;
+	}
     }
     if (strcmp(paren, "(")) {
 	trace_ds(")");
@@ -1337,6 +2003,15 @@ ctlr_write(unsigned char buf[], size_t buflen, bool erase)
     last_zpt = false;
     current_fa = get_field_attribute(buffer_addr);
 
+    /* An Erase/Write seen before can be applied from the cache. */
+    use_cache = erase && wcache_usable();
+    if (use_cache && (cached = wcache_find(buf + 2, buflen - 2)) != NULL) {
+	wcache_apply(cached);
+	insert_cursor = cached->insert_cursor;
+	ic_baddr = cached->ic_baddr;
+	rv = cached->rv;
+    }
+
 #define ABORT_WRITEx { \
     rv = PDS_BAD_ADDR; \
     aborted = true; \
@@ -1347,7 +2022,8 @@ ctlr_write(unsigned char buf[], size_t buflen, bool erase)
     ABORT_WRITEx; \
 } \
 
-    for (cp = &buf[2]; !aborted && cp < (buf + buflen); cp++) {
+    for (cp = &buf[2]; cached == NULL && !aborted && cp < (buf + buflen);
+	    cp++) {
 	switch (*cp) {
 	case ORDER_SF:	/* start field */
 	    END_TEXT("StartField");
@@ -1507,31 +2183,36 @@ ctlr_write(unsigned char buf[], size_t buflen, bool erase)
 	    if (baddr >= COLS * ROWS) {
 		ABORT_WRITE("invalid RA address");
 	    }
-	    do {
-		if (add_dbcs) {
-		    ctlr_add(buffer_addr, add_c1, default_cs);
-		} else {
-		    if (ra_ge) {
-			ctlr_add(buffer_addr, add_c1, CS_GE);
-		    } else if (default_cs) {
-			ctlr_add(buffer_addr, add_c1, default_cs);
-		    } else {
-			ctlr_add(buffer_addr, add_c1, 0);
-		    }
+	    if (!add_dbcs) {
+		struct ea fill;
+		int count = baddr - buffer_addr;
+
+		if (count <= 0) {
+		    count += ROWS * COLS;
 		}
-		ctlr_add_fg(buffer_addr, default_fg);
-		ctlr_add_gr(buffer_addr, default_gr);
-		ctlr_add_ic(buffer_addr, default_ic);
-		INC_BA(buffer_addr);
-		if (add_dbcs) {
+		memset(&fill, 0, sizeof(fill));
+		fill.ec = add_c1;
+		fill.cs = ra_ge? CS_GE: default_cs;
+		fill.fg = default_fg;
+		fill.gr = default_gr;
+		fill.ic = default_ic;
+		ctlr_fill_range(buffer_addr, count, &fill, true);
+		buffer_addr = baddr;
+	    } else {
+		do {
+		    ctlr_add(buffer_addr, add_c1, default_cs);
+		    ctlr_add_fg(buffer_addr, default_fg);
+		    ctlr_add_gr(buffer_addr, default_gr);
+		    ctlr_add_ic(buffer_addr, default_ic);
+		    INC_BA(buffer_addr);
 		    ctlr_add(buffer_addr, add_c2, default_cs);
 		    ctlr_add_fg(buffer_addr, default_fg);
 		    ctlr_add_bg(buffer_addr, default_bg);
 		    ctlr_add_gr(buffer_addr, default_gr);
 		    ctlr_add_ic(buffer_addr, default_ic);
 		    INC_BA(buffer_addr);
-		}
-	    } while (buffer_addr != baddr);
+		} while (buffer_addr != baddr);
+	    }
 	    current_fa = get_field_attribute(buffer_addr);
 	    last_cmd = true;
 	    last_zpt = false;
@@ -1555,14 +2236,39 @@ ctlr_write(unsigned char buf[], size_t buflen, bool erase)
 	    if (d == DBCS_LEFT) {
 		ABORT_WRITE("EUA overwriting left half of DBCS character");
 	    }
-	    do {
-		if (ea_buf[buffer_addr].fa) {
-		    current_fa = ea_buf[buffer_addr].fa;
-		} else if (!FA_IS_PROTECTED(current_fa)) {
-		    ctlr_add(buffer_addr, EBC_null, CS_BASE);
+	    {
+		struct ea fill;
+		int count = baddr - buffer_addr;
+
+		if (count <= 0) {
+		    count += ROWS * COLS;
 		}
-		INC_BA(buffer_addr);
-	    } while (buffer_addr != baddr);
+		memset(&fill, 0, sizeof(fill));
+		fill.ec = EBC_null;
+		fill.cs = CS_BASE;
+
+		/* Null each run of unprotected positions in one fill. */
+		while (count > 0) {
+		    int b = buffer_addr;
+		    int run = 0;
+
+		    if (ea_buf[b].fa) {
+			current_fa = ea_buf[b].fa;
+			INC_BA(buffer_addr);
+			count--;
+			continue;
+		    }
+		    while (run < count && !ea_buf[b].fa) {
+			run++;
+			INC_BA(b);
+		    }
+		    if (!FA_IS_PROTECTED(current_fa)) {
+			ctlr_fill_range(buffer_addr, run, &fill, false);
+		    }
+		    buffer_addr = b;
+		    count -= run;
+		}
+	    }
 	    current_fa = get_field_attribute(buffer_addr);
 	    last_cmd = true;
 	    last_zpt = false;
@@ -1940,6 +2646,38 @@ ctlr_write(unsigned char buf[], size_t buflen, bool erase)
 		trace_ds(" '");
 	    }
 	    previous = TEXT;
+	    if (!dbcs && default_cs != CS_DBCS) {
+		size_t n = 1;
+		size_t j;
+
+		/*
+		 * Without DBCS, a run of data characters up to the next order
+		 * all take the same path, so store it in one pass.
+		 */
+		while (cp + n < buf + buflen && cp[n] > 0x3F) {
+		    n++;
+		}
+		if (toggled(TRACING)) {
+		    for (j = 0; j < n; j++) {
+			trace_ds("%s", see_ebc(cp[j]));
+		    }
+		}
+		for (j = 0; j < n; ) {
+		    int span = ROWS * COLS - buffer_addr;
+
+		    if ((size_t)span > n - j) {
+			span = (int)(n - j);
+		    }
+		    ctlr_write_run(buffer_addr, cp + j, span, default_cs,
+			    default_fg, default_bg, default_gr, default_ic);
+		    j += span;
+		    buffer_addr = (buffer_addr + span) % (ROWS * COLS);
+		}
+		cp += n - 1;
+		last_cmd = false;
+		last_zpt = false;
+		break;
+	    }
 	    add_dbcs = false;
 	    d = ctlr_lookleft_state(buffer_addr, &why);
 	    if (d == DBCS_RIGHT) {
@@ -2009,6 +2747,9 @@ ctlr_write(unsigned char buf[], size_t buflen, bool erase)
     if (ctlr_dbcs_postprocess() < 0 && rv == PDS_OKAY_NO_OUTPUT) {
 	rv = PDS_BAD_ADDR;
     }
+    if (use_cache && cached == NULL && !aborted) {
+	wcache_store(buf + 2, buflen - 2, insert_cursor, ic_baddr, rv);
+    }
 
     trace_primed = false;
 
@@ -2156,6 +2897,7 @@ ctlr_write_sscp_lu(unsigned char buf[], size_t buflen)
 
     /* Let a blocked task go. */
     task_host_output();
+    observe_screen();
 }
 
 /*
@@ -2280,6 +3022,12 @@ valid_dbcs_char(unsigned char c1, unsigned char c2)
  * after each batch of NVT write operations.  It could also be called after
  * significant keyboard operations, but that might be too expensive.
  *
+ * On a formatted screen, only the fields from the one before the first
+ * changed location through the first field after the last one whose SO/SI
+ * state is unchanged are processed, so only those fields are validated.
+ * Anything else (unformatted screens, the first field attribute moving,
+ * bulk changes) gets a full pass.
+ *
  * Returns 0 for success, -1 for failure.
  */
 int
@@ -2295,9 +3043,20 @@ ctlr_dbcs_postprocess(void)
     bool so = false, si = false;
     bool dbcs_field = false;
     int rc = 0;
+    int cells = ROWS * COLS;
+    int first_baddr;	/* first location processed */
+    int span_end = -1;	/* scan offset of the last changed location,
+			   -1 for a full pass */
+    bool done = false;
 
     /* If we're not in DBCS mode, do nothing. */
     if (!dbcs) {
+	dbcs_dirty_all = true;
+	return 0;
+    }
+
+    /* If nothing has changed, there is nothing to do. */
+    if (!dbcs_dirty_all && dbcs_dirty_first < 0) {
 	return 0;
     }
 
@@ -2317,8 +3076,50 @@ ctlr_dbcs_postprocess(void)
     faddr = faddr0;
     dbcs_field = (ea_buf[faddr].cs & CS_MASK) == CS_DBCS;
 
+#   define SCAN_OFFSET(b)	(((b) - faddr0 - 1 + cells) % cells)
+    if (!dbcs_dirty_all && faddr0 >= 0 && faddr0 == dbcs_faddr0 &&
+	    dbcs_fa_state_cells == cells &&
+	    (faddr0 < dbcs_dirty_first || faddr0 >= dbcs_dirty_last)) {
+	int last = (dbcs_dirty_last < cells)? dbcs_dirty_last: cells;
+	int sfa;
+
+	/*
+	 * Start at the field attribute before the first change, which is
+	 * unchanged, with the SO/SI state the last pass found there.
+	 */
+	span_end = SCAN_OFFSET(last - 1);
+	sfa = find_field_attribute(dbcs_dirty_first? dbcs_dirty_first - 1:
+		cells - 1);
+	if (sfa != faddr0) {
+	    so = (dbcs_fa_state[sfa] & DBCS_ST_SO) != 0;
+	    si = (dbcs_fa_state[sfa] & DBCS_ST_SI) != 0;
+	    baddr = sfa;
+	    pbaddr = sfa;
+	    DEC_BA(pbaddr);
+	    if (pbaddr == faddr0) {
+		pbaddr = -1;
+	    }
+	}
+    } else if (dbcs_fa_state_cells != cells) {
+	Replace(dbcs_fa_state, (unsigned char *)Malloc(cells));
+	dbcs_fa_state_cells = cells;
+    }
+    first_baddr = baddr;
+
     do {
 	if (ea_buf[baddr].fa) {
+	    unsigned char state = (so? DBCS_ST_SO: 0) | (si? DBCS_ST_SI: 0);
+
+	    /*
+	     * Past the changes, a field that starts in the same SO/SI state
+	     * as last time will come out the same, so stop after this.
+	     */
+	    if (span_end >= 0 && SCAN_OFFSET(baddr) > span_end &&
+		    dbcs_fa_state[baddr] == state) {
+		done = true;
+	    }
+	    dbcs_fa_state[baddr] = state;
+
 	    faddr = baddr;
 	    ea_buf[faddr].db = DBCS_NONE;
 	    dbcs_field = (ea_buf[faddr].cs & CS_MASK) == CS_DBCS;
@@ -2427,7 +3228,24 @@ ctlr_dbcs_postprocess(void)
 	pbaddr = baddr;
 	INC_BA(baddr);
 
-    } while (baddr != last_baddr);
+    } while (!done && baddr != last_baddr);
+#   undef SCAN_OFFSET
+
+    /* The db fields are rewritten without being marked as changed. */
+    screen_generation++;
+    if (span_end < 0) {
+	rows_touched(0, cells);
+    } else if (baddr > first_baddr) {
+	rows_touched(first_baddr, baddr);
+    } else {
+	rows_touched(first_baddr, cells);
+	rows_touched(0, baddr);
+    }
+
+    dbcs_faddr0 = faddr0;
+    dbcs_dirty_all = false;
+    dbcs_dirty_first = -1;
+    dbcs_dirty_last = -1;
 
     return rc;
 }
@@ -2454,21 +3272,33 @@ ps_process(void)
 
 /*
  * Tell me if there is any data on the screen.
+ *
+ * This runs on every clear, usually over a screen with nothing on it, so
+ * each cell's test is folded into bitwise operations and the result is only
+ * checked once per block of SCAN_BLOCK cells. The inner loop has no branches,
+ * and the compiler can vectorize it.
  */
 bool
 ctlr_any_data(void)
 {
-    int i;
+    const struct ea *ea;
+    const struct ea *end;
 
     if (ea_buf == NULL) {
 	return false;
     }
 
-    for (i = 0; i < ROWS*COLS; i++) {
-	if (!IsBlank(ea_buf[i].ec) ||
-		(ea_buf[i].ucs4 != 0 &&
-		 ea_buf[i].ucs4 != ' ' &&
-		 ea_buf[i].ucs4 != 0x3000)) {
+    end = ea_buf + ROWS*COLS;
+    for (ea = ea_buf; ea < end; ) {
+	const struct ea *block_end = (end - ea > SCAN_BLOCK)?
+	    ea + SCAN_BLOCK: end;
+	unsigned any = 0;
+
+	for (; ea < block_end; ea++) {
+	    any |= ((ea->ec != EBC_null) & (ea->ec != EBC_space)) |
+		((ea->ucs4 != 0) & (ea->ucs4 != ' ') & (ea->ucs4 != 0x3000));
+	}
+	if (any) {
 	    return true;
 	}
     }
@@ -2493,6 +3323,10 @@ ctlr_clear(bool can_snap)
 
     /* Clear the screen. */
     memset((char *)ea_buf, 0, ROWS*COLS*sizeof(struct ea));
+    fa_count = 0;
+    fa_index_buf = ea_buf;
+    fa_index_cells = ROWS * COLS;
+    fa_index_valid = true;
     ALL_CHANGED;
     cursor_move(0);
     buffer_addr = 0;
@@ -2523,6 +3357,112 @@ ctlr_blanks(void)
     formatted = false;
 }
 
+/*
+ * Fill a contiguous, non-wrapping span of the 3270 buffer with a character,
+ * as if by ctlr_add() on each position, and if 'attrs' is set, also with a
+ * foreground color, graphic rendition and input control, as if by
+ * ctlr_add_fg(), ctlr_add_gr() and ctlr_add_ic(). The span is marked changed
+ * once.
+ */
+static void
+fill_span(int baddr, int count, const struct ea *fill, bool attrs)
+{
+    struct ea *ea = &ea_buf[baddr];
+    struct ea *end = ea + count;
+    unsigned char fg = fill->fg;
+    bool set_fg = attrs && mode.m3279;
+    struct ea *first = NULL;
+    struct ea *last = NULL;
+    bool any_fa = false;
+    bool any_selected = false;
+
+    if ((fg & 0xf0) != 0xf0) {
+	fg = 0;
+    }
+
+    for (; ea < end; ea++) {
+	/*
+	 * Snap data that is about to be lost, at the same point ctlr_add()
+	 * would. Like ctlr_add(), a field attribute or NVT character does not
+	 * count as data.
+	 */
+	if (trace_primed &&
+		(ea->fa || ea->ucs4 || ea->ec != fill->ec ||
+		 ea->cs != fill->cs) &&
+		!IsBlank(((ea->fa || ea->ucs4)? 0: ea->ec))) {
+	    if (any_fa) {
+		ctlr_invalidate_fa_index();
+	    }
+	    if (toggled(SCREEN_TRACE)) {
+		trace_screen(false);
+	    }
+	    scroll_save(maxROWS);
+	    trace_primed = false;
+	}
+	if (ea->fa || ea->ucs4 || ea->ec != fill->ec || ea->cs != fill->cs ||
+		(set_fg && ea->fg != fg) ||
+		(attrs && ea->gr != fill->gr)) {
+	    if (first == NULL) {
+		first = ea;
+	    }
+	    last = ea;
+	    if (ea->fa) {
+		any_fa = true;
+	    }
+	    if (!any_selected && screen_selected((int)(ea - ea_buf))) {
+		any_selected = true;
+	    }
+	    ea->ec = fill->ec;
+	    ea->cs = fill->cs;
+	    ea->fa = 0;
+	    ea->ucs4 = 0;
+	    if (set_fg) {
+		ea->fg = fg;
+	    }
+	    if (attrs) {
+		ea->gr = fill->gr;
+	    }
+	}
+	if (attrs) {
+	    ea->ic = fill->ic;
+	}
+    }
+
+    if (first == NULL) {
+	return;
+    }
+    if (any_selected) {
+	unselect((int)(first - ea_buf), (int)(last - first) + 1);
+    }
+    if (any_fa) {
+	ctlr_invalidate_fa_index();
+    }
+    REGION_CHANGED((int)(first - ea_buf), (int)(last - ea_buf) + 1);
+    if (attrs && (fill->gr & GR_BLINK)) {
+	blink_start();
+    }
+}
+
+/*
+ * Fill 'count' positions of the 3270 buffer starting at baddr, wrapping
+ * around the end of the buffer, using bulk stores. Used for SBCS
+ * Repeat to Address and Erase Unprotected to Address.
+ */
+static void
+ctlr_fill_range(int baddr, int count, const struct ea *fill, bool attrs)
+{
+    while (count > 0) {
+	int n = ROWS * COLS - baddr;
+
+	if (n > count) {
+	    n = count;
+	}
+	fill_span(baddr, n, fill, attrs);
+	count -= n;
+	baddr = 0;
+    }
+}
+
 /*
  * Change a character in the 3270 buffer, EBCDIC mode.
  * Removes any field attribute defined at that location.
@@ -2546,6 +3486,9 @@ ctlr_add(int baddr, unsigned char c, unsigned char cs)
 	    unselect(baddr, 1);
 	}
 	ONE_CHANGED(baddr);
+	if (ea_buf[baddr].fa) {
+	    fa_index_remove(baddr);
+	}
 	ea_buf[baddr].ec = c;
 	ea_buf[baddr].cs = cs;
 	ea_buf[baddr].fa = 0;
@@ -2553,6 +3496,145 @@ ctlr_add(int baddr, unsigned char c, unsigned char cs)
     }
 }
 
+/*
+ * Store a run of characters in consecutive 3270 buffer positions, which
+ * must not wrap past the end of the buffer. Equivalent to calling
+ * ctlr_add(), ctlr_add_fg(0) and ctlr_add_gr(0) for each position, but the
+ * change is recorded once for the whole run.
+ */
+void
+ctlr_add_run(int baddr, const unsigned char *c, const unsigned char *cs,
+	int len)
+{
+    int first = -1;
+    int last = -1;
+    int i;
+
+    for (i = 0; i < len; i++, baddr++) {
+	struct ea *ea = &ea_buf[baddr];
+	unsigned char oc = 0;
+	bool changed = false;
+
+	if (ea->fa || ea->ucs4 || ((oc = ea->ec) != c[i] || ea->cs != cs[i])) {
+	    if (trace_primed && !IsBlank(oc)) {
+		if (toggled(SCREEN_TRACE)) {
+		    trace_screen(false);
+		}
+		scroll_save(maxROWS);
+		trace_primed = false;
+	    }
+	    if (ea->fa) {
+		fa_index_remove(baddr);
+	    }
+	    ea->ec = c[i];
+	    ea->cs = cs[i];
+	    ea->fa = 0;
+	    ea->ucs4 = 0;
+	    changed = true;
+	}
+	if (mode.m3279 && ea->fg) {
+	    ea->fg = 0;
+	    changed = true;
+	}
+	if (ea->gr) {
+	    ea->gr = 0;
+	    changed = true;
+	}
+	if (changed) {
+	    if (screen_selected(baddr)) {
+		unselect(baddr, 1);
+	    }
+	    if (first < 0) {
+		first = baddr;
+	    }
+	    last = baddr;
+	}
+    }
+    if (first >= 0) {
+	REGION_CHANGED(first, last + 1);
+    }
+}
+
+/*
+ * Store a run of SBCS data characters from a 3270 Write in consecutive
+ * buffer positions, with the same character set, colors, graphic rendition
+ * and input control for each. The run must not wrap past the end of the
+ * buffer. Equivalent to calling ctlr_add(), ctlr_add_fg(), ctlr_add_bg(),
+ * ctlr_add_gr() and ctlr_add_ic() for each position, but the change is
+ * recorded once for the whole run.
+ */
+static void
+ctlr_write_run(int baddr, const unsigned char *c, int len, unsigned char cs,
+	unsigned char fg, unsigned char bg, unsigned char gr, unsigned char ic)
+{
+    int first = -1;
+    int last = -1;
+    bool gr_changed = false;
+    int i;
+
+    if (!mode.m3279) {
+	fg = 0;
+	bg = 0;
+    } else {
+	if ((fg & 0xf0) != 0xf0) {
+	    fg = 0;
+	}
+	if ((bg & 0xf0) != 0xf0) {
+	    bg = 0;
+	}
+    }
+
+    for (i = 0; i < len; i++, baddr++) {
+	struct ea *ea = &ea_buf[baddr];
+	unsigned char oc = 0;
+	bool changed = false;
+
+	if (ea->fa || ea->ucs4 || ((oc = ea->ec) != c[i] || ea->cs != cs)) {
+	    if (trace_primed && !IsBlank(oc)) {
+		if (toggled(SCREEN_TRACE)) {
+		    trace_screen(false);
+		}
+		scroll_save(maxROWS);
+		trace_primed = false;
+	    }
+	    if (ea->fa) {
+		fa_index_remove(baddr);
+	    }
+	    ea->ec = c[i];
+	    ea->cs = cs;
+	    ea->fa = 0;
+	    ea->ucs4 = 0;
+	    changed = true;
+	}
+	if (mode.m3279 && (ea->fg != fg || ea->bg != bg)) {
+	    ea->fg = fg;
+	    ea->bg = bg;
+	    changed = true;
+	}
+	if (ea->gr != gr) {
+	    ea->gr = gr;
+	    gr_changed = true;
+	    changed = true;
+	}
+	ea->ic = ic;
+	if (changed) {
+	    if (screen_selected(baddr)) {
+		unselect(baddr, 1);
+	    }
+	    if (first < 0) {
+		first = baddr;
+	    }
+	    last = baddr;
+	}
+    }
+    if (first >= 0) {
+	REGION_CHANGED(first, last + 1);
+    }
+    if (gr_changed && (gr & GR_BLINK)) {
+	blink_start();
+    }
+}
+
 /*
  * Change a character in the 3270 buffer, NVT mode.
  * Removes any field attribute defined at that location.
@@ -2575,6 +3657,9 @@ ctlr_add_nvt(int baddr, ucs4_t ucs4, unsigned char cs)
 	    unselect(baddr, 1);
 	}
 	ONE_CHANGED(baddr);
+	if (ea_buf[baddr].fa) {
+	    fa_index_remove(baddr);
+	}
 	ea_buf[baddr].ucs4 = ucs4;
 	ea_buf[baddr].ec = 0;
 	ea_buf[baddr].cs = cs;
@@ -2586,6 +3671,79 @@ ctlr_add_nvt(int baddr, ucs4_t ucs4, unsigned char cs)
     }
 }
 
+/*
+ * Store a run of 7-bit printable characters in consecutive NVT-mode buffer
+ * positions, which must not wrap past the end of the buffer. Equivalent to
+ * calling ctlr_add_nvt(), ctlr_add_gr(), ctlr_add_fg() and ctlr_add_bg()
+ * for each position, but the change is recorded once for the whole run.
+ */
+void
+ctlr_add_nvt_run(int baddr, const unsigned char *s, int len, unsigned char gr,
+	unsigned char fg, unsigned char bg)
+{
+    int first = -1;
+    int last = -1;
+    int i;
+
+    if (!mode.m3279) {
+	fg = bg = 0;
+    } else {
+	if ((fg & 0xf0) != 0xf0) {
+	    fg = 0;
+	}
+	if ((bg & 0xf0) != 0xf0) {
+	    bg = 0;
+	}
+    }
+
+    for (i = 0; i < len; i++, baddr++) {
+	struct ea *ea = &ea_buf[baddr];
+	bool changed = false;
+
+	if (ea->fa || ea->ucs4 != s[i] || ea->ec != 0 || ea->cs != CS_BASE) {
+	    if (trace_primed && !IsBlank(ea->ec)) {
+		if (toggled(SCREEN_TRACE)) {
+		    trace_screen(false);
+		}
+		scroll_save(maxROWS);
+		trace_primed = false;
+	    }
+	    if (ea->fa) {
+		fa_index_remove(baddr);
+	    }
+	    ea->ucs4 = s[i];
+	    ea->ec = 0;
+	    ea->cs = CS_BASE;
+	    ea->fa = 0;
+	    changed = true;
+	}
+	if (ea->gr != gr) {
+	    ea->gr = gr;
+	    changed = true;
+	}
+	if (mode.m3279 && (ea->fg != fg || ea->bg != bg)) {
+	    ea->fg = fg;
+	    ea->bg = bg;
+	    changed = true;
+	}
+	if (changed) {
+	    if (screen_selected(baddr)) {
+		unselect(baddr, 1);
+	    }
+	    if (first < 0) {
+		first = baddr;
+	    }
+	    last = baddr;
+	}
+    }
+    if (first >= 0) {
+	REGION_CHANGED(first, last + 1);
+    }
+    if (gr & GR_BLINK) {
+	blink_start();
+    }
+}
+
 /* 
  * Set a field attribute in the 3270 buffer.
  */
@@ -2597,9 +3755,12 @@ ctlr_add_fa(int baddr, unsigned char fa, unsigned char cs)
 
     /*
      * Store the new attribute, setting the 'printable' bits so that the
-     * value will be non-zero.
+     * value will be non-zero. ctlr_add() does not see a change if the
+     * location already held a null, so record it here.
      */
+    ONE_CHANGED(baddr);
     ea_buf[baddr].fa = FA_PRINTABLE | (fa & FA_MASK);
+    fa_index_add(baddr);
 }
 
 /* 
@@ -2733,6 +3894,7 @@ ctlr_bcopy(int baddr_from, int baddr_to, int count, int move_ea)
 		count * sizeof(struct ea))) {
 	memmove(&ea_buf[baddr_to], &ea_buf[baddr_from],
 		count * sizeof(struct ea));
+	fa_index_valid = false;
 	REGION_CHANGED(baddr_to, baddr_to + count);
 	/*
 	 * For the time being, if any selected text shifts around on
@@ -2757,6 +3919,7 @@ ctlr_aclear(int baddr, int count, int clear_ea)
     if (memcmp((char *)&ea_buf[baddr], (char *)zero_buf,
 		count * sizeof(struct ea))) {
 	memset((char *) &ea_buf[baddr], 0, count * sizeof(struct ea));
+	fa_index_valid = false;
 	REGION_CHANGED(baddr, baddr + count);
 	if (area_is_selected(baddr, count)) {
 	    unselect(baddr, count);
@@ -2787,8 +3950,41 @@ ctlr_scroll(unsigned char fg, unsigned char bg)
 	screen_disp(false);
     }
 
-    /* Move ea_buf. */
-    memmove(&ea_buf[0], &ea_buf[COLS], qty * sizeof(struct ea));
+    /* Make room in the arena to slide, the first time it scrolls. */
+    if (ea_arena_cells < (size_t)(2 * maxROWS * maxCOLS)) {
+	size_t offset = ea_buf - ea_arena;
+
+	ea_arena = (struct ea *)Realloc(ea_arena,
+		((2 * maxROWS * maxCOLS) + 1) * sizeof(struct ea));
+	memset(ea_arena + 1 + ea_arena_cells, 0,
+		((2 * maxROWS * maxCOLS) - ea_arena_cells) *
+		    sizeof(struct ea));
+	ea_arena_cells = 2 * maxROWS * maxCOLS;
+	ea_buf = ea_arena + offset;
+    }
+
+    /*
+     * Move ea_buf. If it can slide forward a row without going past the
+     * first maximum-sized screen in its arena, just move the window and put
+     * back the dummy field attribute. Otherwise copy it to the start of the
+     * arena, which happens at most once every maxROWS scrolls.
+     */
+    if (ea_buf + COLS <= ea_arena + 1 + (maxROWS * maxCOLS)) {
+	ea_buf += COLS;
+	memset((char *)&ea_buf[-1], 0, sizeof(struct ea));
+	ea_buf[-1].fa = FA_PRINTABLE | FA_MODIFY;
+    } else {
+	memmove(ea_arena + 1, &ea_buf[COLS], qty * sizeof(struct ea));
+	ea_buf = ea_arena + 1;
+    }
+    fa_index_valid = false;
+    if (row_changed != NULL && ROWS > 1) {
+	memmove(row_changed, row_changed + 1, ROWS - 1);
+    }
+    rows_changed(qty, qty + COLS);
+    dbcs_dirty_all = true;
+    screen_generation++;
+    rows_touched(0, ROWS * COLS);
 
     /* Clear the last line. */
     memset((char *) &ea_buf[qty], 0, COLS * sizeof(struct ea));
@@ -2820,6 +4016,79 @@ ctlr_changed(int bstart, int bend)
     REGION_CHANGED(bstart, bend);
 }
 
+/*
+ * Mark the rows spanned by a region of the screen as changed.
+ */
+static void
+rows_changed(int bstart, int bend)
+{
+    int r0, r1;
+
+    if (row_changed == NULL || bend <= bstart || COLS == 0) {
+	return;
+    }
+    r0 = bstart / COLS;
+    r1 = (bend - 1) / COLS;
+    if (r1 >= maxROWS) {
+	r1 = maxROWS - 1;
+    }
+    if (r0 <= r1) {
+	memset(row_changed + r0, 1, r1 - r0 + 1);
+    }
+    rows_touched(bstart, bend);
+}
+
+/*
+ * Stamp the rows spanned by a region of the screen with the current
+ * generation, without scheduling a redisplay.
+ */
+static void
+rows_touched(int bstart, int bend)
+{
+    int r;
+
+    if (row_gen == NULL || bend <= bstart || COLS == 0) {
+	return;
+    }
+    for (r = bstart / COLS; r <= (bend - 1) / COLS && r < maxROWS; r++) {
+	row_gen[r] = screen_generation;
+    }
+}
+
+/*
+ * Returns the generation of the last change to a row.
+ */
+unsigned long
+ctlr_row_generation(int row)
+{
+    if (row_gen == NULL || row < 0 || row >= maxROWS) {
+	return screen_generation;
+    }
+    return row_gen[row];
+}
+
+/*
+ * Returns true if a row has changed since the last call to
+ * ctlr_clear_row_changes().
+ */
+bool
+ctlr_row_changed(int row)
+{
+    return row_changed == NULL || row < 0 || row >= maxROWS ||
+	row_changed[row];
+}
+
+/*
+ * Forget about changed rows, once the screen has been refreshed.
+ */
+void
+ctlr_clear_row_changes(void)
+{
+    if (row_changed != NULL) {
+	memset(row_changed, 0, maxROWS);
+    }
+}
+
 /*
  * Swap the regular and alternate screen buffers
  */
@@ -2827,14 +4096,32 @@ void
 ctlr_altbuffer(bool alt)
 {
     struct ea *etmp;
+    size_t ctmp;
 
     if (alt != is_altbuffer) {
 
+	if (aea_arena == NULL) {
+	    aea_arena = arena_alloc(&aea_buf, &aea_arena_cells);
+	}
 	etmp = ea_buf;
 	ea_buf = aea_buf;
 	aea_buf = etmp;
+	etmp = ea_arena;
+	ea_arena = aea_arena;
+	aea_arena = etmp;
+	ctmp = ea_arena_cells;
+	ea_arena_cells = aea_arena_cells;
+	aea_arena_cells = ctmp;
 
 	is_altbuffer = alt;
+	if (alt_release_id != NULL_IOID) {
+	    RemoveTimeOut(alt_release_id);
+	    alt_release_id = NULL_IOID;
+	}
+	if (!alt && appres.alt_buffer_release > 0) {
+	    alt_release_id = AddTimeOutCoalesced(
+		    appres.alt_buffer_release * 1000UL, 1000, alt_release);
+	}
 	ALL_CHANGED;
 	unselect(0, ROWS*COLS);
 
@@ -2857,6 +4144,8 @@ mdt_set(int baddr)
     faddr = find_field_attribute(baddr);
     if (faddr >= 0 && !(ea_buf[faddr].fa & FA_MODIFY)) {
 	ea_buf[faddr].fa |= FA_MODIFY;
+	screen_generation++;
+	rows_touched(faddr, faddr + 1);
 	if (appres.modified_sel) {
 	    ALL_CHANGED;
 	}
@@ -2871,6 +4160,8 @@ mdt_clear(int baddr)
     faddr = find_field_attribute(baddr);
     if (faddr >= 0 && (ea_buf[faddr].fa & FA_MODIFY)) {
 	ea_buf[faddr].fa &= ~FA_MODIFY;
+	screen_generation++;
+	rows_touched(faddr, faddr + 1);
 	if (appres.modified_sel) {
 	    ALL_CHANGED;
 	}
@@ -2883,12 +4174,13 @@ mdt_clear(int baddr)
 void
 ctlr_shrink(void)
 {
-    int baddr;
+    unsigned char c = visible_control? EBC_space : EBC_null;
+    struct ea *ea;
+    struct ea *end = ea_buf + ROWS*COLS;
 
-    for (baddr = 0; baddr < ROWS*COLS; baddr++) {
-	if (!ea_buf[baddr].fa) {
-	    ea_buf[baddr].ec = visible_control? EBC_space : EBC_null;
-	}
+    /* A select rather than a branch, so the loop can be vectorized. */
+    for (ea = ea_buf; ea < end; ea++) {
+	ea->ec = ea->fa? ea->ec: c;
     }
     ALL_CHANGED;
     screen_disp(false);
@@ -2929,6 +4221,7 @@ static struct timeval t_start;
 static bool ticking = false;
 static bool mticking = false;
 static bool ticking_anyway = false;
+static unsigned char t_aid;
 static ioid_t tick_id;
 static struct timeval t_want;
 
@@ -2967,6 +4260,7 @@ ticking_start(bool anyway)
     }
     ticking = true;
     ticking_anyway = anyway;
+    t_aid = aid;
     tick_id = AddTimeOut(1000, keep_ticking);
     t_want = t_start;
 }
@@ -3003,6 +4297,11 @@ ticking_stop(struct timeval *tp)
 	    ticking_anyway? "negotiation step": "operation",
 	    cs / 1000000L,
 	    cs % 1000000L);
+
+    /* Only a host unlock (which supplies the time) is a response. */
+    if (!ticking_anyway && tp != &t1) {
+	rtime_record(t_aid, cs);
+    }
     ticking_anyway = false;
 }
 
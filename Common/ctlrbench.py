@@ -0,0 +1,244 @@
+#!/usr/bin/env python3
+# Whole-buffer operation benchmark for s3270
+#
+# Runs s3270 against a synthetic 3270 host that sends a fixed stream of
+# records for one scenario, then disconnects, and reports the CPU time
+# s3270 used. The scenarios are:
+#   screen      Erase/Write Alternate with fields, Erase All Unprotected,
+#               a full-screen write and a clear (the original benchmark)
+#   dbcs        Erase/Write Alternate of fields holding SO/SI-delimited
+#               DBCS text, with a DBCS code page
+#   fields      many small fields: Erase/Write Alternate with a field every
+#               few columns, a Write into each unprotected field, and Erase
+#               All Unprotected
+#   sa          Writes that change color and highlighting with Set
+#               Attribute orders every few characters
+#   nvt         NVT text that scrolls the whole screen
+# Each run is repeated several times and the median is printed, as text or
+# as JSON lines with -json, with the cost per cycle and per record. With
+# -scale, each scenario is also run on a 24x80 model 2 screen and the ratio
+# is reported, so it shows how a cost grows with the screen size. Comparing
+# two builds with the same arguments shows the effect of a change to the
+# buffer scans in ctlr.c.
+#
+# The default screen is the largest the emulator supports, 62x160.
+
+import argparse
+import json
+import resource
+import socket
+import statistics
+import subprocess
+import threading
+
+# Telnet and 3270 constants.
+IAC, DO, WILL, SB, SE = 255, 253, 251, 250, 240
+EOR = 239
+TELOPT_BINARY, TELOPT_TTYPE, TELOPT_EOR = 0, 24, 25
+CMD_W, CMD_EWA, CMD_EAU = 0xf1, 0x7e, 0x6f
+WCC_RESTORE = 0xc2
+ORDER_SBA, ORDER_SF, ORDER_SA = 0x11, 0x1d, 0x28
+FA_UNPROTECTED, FA_PROTECTED = 0x40, 0x60
+XA_HIGHLIGHTING, XA_FOREGROUND, XA_ALL = 0x41, 0x42, 0x00
+SO, SI = 0x0e, 0x0f
+
+SCENARIOS = ['screen', 'dbcs', 'fields', 'sa', 'nvt']
+
+# Process command-line arguments.
+parser = argparse.ArgumentParser(description='s3270 buffer scan benchmark')
+parser.add_argument('-s3270', default='s3270', help='s3270 to run')
+parser.add_argument('-rows', type=int, default=62, help='screen rows')
+parser.add_argument('-cols', type=int, default=160, help='screen columns')
+parser.add_argument('-fields', type=int, default=4,
+        help='fields per row for the screen scenario '
+        '(half of them unprotected)')
+parser.add_argument('-width', type=int, default=4,
+        help='field width for the fields scenario')
+parser.add_argument('-cycles', type=int, default=5000,
+        help='number of cycles per run')
+parser.add_argument('-runs', type=int, default=5, help='number of runs')
+parser.add_argument('-scenario', default='screen',
+        help='comma-separated scenarios to run, or all ({0})'.format(
+            ', '.join(SCENARIOS)))
+parser.add_argument('-codepage', default='cp930',
+        help='code page for the dbcs scenario')
+parser.add_argument('-scale', action='store_true',
+        help='also run each scenario at 24x80 and report the ratio')
+parser.add_argument('-json', action='store_true',
+        help='write the results as JSON lines')
+args = parser.parse_args()
+scenarios = SCENARIOS if args.scenario == 'all' else args.scenario.split(',')
+for s in scenarios:
+    if s not in SCENARIOS:
+        parser.error('unknown scenario {0}'.format(s))
+
+# Returns a 14-bit buffer address.
+def Address(baddr):
+    return bytes([(baddr >> 8) & 0x3f, baddr & 0xff])
+
+# Returns a 3270 record.
+def Record(data):
+    return bytes(data).replace(bytes([IAC]), bytes([IAC, IAC])) + \
+            bytes([IAC, EOR])
+
+# Builds the records for one cycle of the screen scenario.
+def Screen(rows, cols):
+    width = cols // args.fields
+    ewa = bytearray([CMD_EWA, WCC_RESTORE])
+    text = ('x' * (width - 1)).encode('cp037')
+    for row in range(rows):
+        for f in range(args.fields):
+            ewa += bytes([ORDER_SBA]) + Address(row * cols + f * width)
+            ewa += bytes([ORDER_SF,
+                FA_UNPROTECTED if f % 2 == 0 else FA_PROTECTED])
+            ewa += text
+    full = bytes([CMD_EWA, WCC_RESTORE]) + \
+            ('y' * (rows * cols)).encode('cp037')
+    return [Record(ewa), Record([CMD_EAU]), Record(full),
+            Record([CMD_EWA, WCC_RESTORE])]
+
+# Builds the records for one cycle of the dbcs scenario. Each row is a
+# protected field holding a run of DBCS characters.
+def Dbcs(rows, cols):
+    ewa = bytearray([CMD_EWA, WCC_RESTORE])
+    n = (cols - 3) // 2
+    for row in range(rows):
+        ewa += bytes([ORDER_SBA]) + Address(row * cols)
+        ewa += bytes([ORDER_SF, FA_PROTECTED, SO])
+        for i in range(n):
+            ewa += bytes([0x45 + (row + i) % 16, 0x41 + i % 0x9e])
+        ewa += bytes([SI])
+    return [Record(ewa), Record([CMD_EWA, WCC_RESTORE])]
+
+# Builds the records for one cycle of the fields scenario.
+def Fields(rows, cols):
+    width = args.width
+    ewa = bytearray([CMD_EWA, WCC_RESTORE])
+    w = bytearray([CMD_W, WCC_RESTORE])
+    text = ('z' * (width - 1)).encode('cp037')
+    for baddr in range(0, rows * cols - width + 1, width):
+        unprotected = (baddr // width) % 2 == 0
+        ewa += bytes([ORDER_SF,
+            FA_UNPROTECTED if unprotected else FA_PROTECTED]) + text
+        if unprotected:
+            w += bytes([ORDER_SBA]) + Address(baddr + 1) + text
+    return [Record(ewa), Record(w), Record([CMD_EAU])]
+
+# Builds the records for one cycle of the sa scenario.
+def Sa(rows, cols):
+    w = bytearray([CMD_W, WCC_RESTORE, ORDER_SBA]) + Address(0)
+    text = 'abc'.encode('cp037')
+    for i in range(rows * cols // len(text)):
+        w += bytes([ORDER_SA, XA_FOREGROUND, 0xf1 + i % 7,
+            ORDER_SA, XA_HIGHLIGHTING, 0xf1 if i % 2 else 0xf4]) + text
+    w += bytes([ORDER_SA, XA_ALL, 0x00])
+    return [Record([CMD_EWA, WCC_RESTORE]), Record(w)]
+
+# Builds the text for one cycle of the nvt scenario: a screen full of
+# lines, so each cycle scrolls the whole screen.
+def Nvt(rows, cols):
+    line = ('n' * (cols - 1) + '\r\n').encode('ascii')
+    return [line * rows]
+
+BUILDERS = {'screen': Screen, 'dbcs': Dbcs, 'fields': Fields, 'sa': Sa,
+        'nvt': Nvt}
+
+# Synthetic host. Negotiates TN3270 (or nothing, for NVT mode), sends the
+# records, and disconnects.
+class Host:
+    def __init__(self, data, nvt):
+        self.data = data
+        self.nvt = nvt
+        self.listener = socket.socket()
+        self.listener.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.listener.bind(('127.0.0.1', 0))
+        self.listener.listen(1)
+        self.port = self.listener.getsockname()[1]
+        threading.Thread(target=self.serve, daemon=True).start()
+
+    def serve(self):
+        try:
+            conn, _ = self.listener.accept()
+        except OSError:
+            return
+        self.listener.close()
+        try:
+            if not self.nvt:
+                conn.sendall(bytes([IAC, DO, TELOPT_TTYPE]))
+                self.expect(conn, bytes([IAC, WILL, TELOPT_TTYPE]))
+                conn.sendall(bytes([IAC, SB, TELOPT_TTYPE, 1, IAC, SE]))
+                self.expect(conn, bytes([IAC, SE]))
+                conn.sendall(bytes([IAC, WILL, TELOPT_EOR, IAC, DO,
+                    TELOPT_EOR, IAC, WILL, TELOPT_BINARY, IAC, DO,
+                    TELOPT_BINARY]))
+                self.expect(conn, bytes([IAC, WILL, TELOPT_BINARY]))
+            for i in range(args.cycles):
+                conn.sendall(self.data)
+            # Let the emulator see the end of the data before the socket
+            # is closed, so its last replies are not reset.
+            conn.shutdown(socket.SHUT_WR)
+            while conn.recv(4096):
+                pass
+        except OSError:
+            pass
+        conn.close()
+
+    def expect(self, conn, what):
+        buf = b''
+        while what not in buf:
+            d = conn.recv(4096)
+            if not d:
+                raise OSError('Emulator disconnected during negotiation')
+            buf += d
+
+# Runs s3270 once. Returns the CPU seconds it used.
+def Run(data, nvt, opts):
+    host = Host(data, nvt)
+    before = resource.getrusage(resource.RUSAGE_CHILDREN)
+    proc = subprocess.Popen([args.s3270] + opts,
+        stdin=subprocess.PIPE, stdout=subprocess.DEVNULL,
+        stderr=subprocess.DEVNULL)
+    proc.communicate('Connect(127.0.0.1:{0})\nWait(600,Disconnect)\nQuit\n'
+            .format(host.port).encode('utf-8'))
+    after = resource.getrusage(resource.RUSAGE_CHILDREN)
+    return (after.ru_utime - before.ru_utime) + \
+            (after.ru_stime - before.ru_stime)
+
+# Runs one scenario on one screen size. Returns the result.
+def Measure(scenario, rows, cols):
+    records = BUILDERS[scenario](rows, cols)
+    if rows == 24 and cols == 80:
+        opts = ['-model', '3279-2']
+    else:
+        opts = ['-model', '3279-5', '-oversize',
+                '{0}x{1}'.format(cols, rows)]
+    if scenario == 'dbcs':
+        opts += ['-codepage', args.codepage]
+    data = b''.join(records)
+    times = [Run(data, scenario == 'nvt', opts) for i in range(args.runs)]
+    cpu = statistics.median(times)
+    return {'scenario': scenario, 'rows': rows, 'cols': cols,
+            'cycles': args.cycles, 'runs': args.runs,
+            'records_per_cycle': len(records), 'bytes_per_cycle': len(data),
+            'cpu': round(cpu, 3),
+            'us_per_cycle': round(cpu * 1e6 / args.cycles, 1),
+            'us_per_record':
+                round(cpu * 1e6 / (args.cycles * len(records)), 1)}
+
+for scenario in scenarios:
+    result = Measure(scenario, args.rows, args.cols)
+    if args.scale:
+        small = Measure(scenario, 24, 80)
+        result['us_per_cycle_24x80'] = small['us_per_cycle']
+        result['scale'] = round(result['us_per_cycle'] /
+                max(small['us_per_cycle'], 0.1), 2)
+    if args.json:
+        print(json.dumps(result))
+        continue
+    line = '{0}: {1}x{2}, {3} cycles: {4:.3f}s CPU, {5:.1f}us per cycle, ' \
+            '{6:.1f}us per record'.format(scenario, args.rows, args.cols,
+                args.cycles, result['cpu'], result['us_per_cycle'],
+                result['us_per_record'])
+    if args.scale:
+        line += ', {0:.2f}x 24x80'.format(result['scale'])
+    print(line + ' (median over {0} runs)'.format(args.runs))
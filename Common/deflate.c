@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *	deflate.c
+ *		DEFLATE compression (RFC 1951) with gzip (RFC 1952) or zlib
+ *		(RFC 1950) framing, used for HTTP Content-Encoding.
+ *
+ *		The output is a single block using the fixed Huffman codes,
+ *		with LZ77 matching over a 32K window. That does not compress
+ *		as tightly as zlib, but it is small, has no tables to
+ *		transmit, and screen-sized text compresses well with it.
+ */
+
+#include "globals.h"
+
+#include "varbuf.h"
+#include "deflate.h"
+
+#define WSIZE		32768	/* window size */
+#define HBITS		15	/* hash table size, in bits */
+#define HSIZE		(1 << HBITS)
+#define MIN_MATCH	3
+#define MAX_MATCH	258
+#define MAX_CHAIN	64	/* longest hash chain to search */
+
+/* Length codes 257..285: base lengths and extra bits. */
+static const unsigned short len_base[29] = {
+    3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+    35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258
+};
+static const unsigned char len_extra[29] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+    3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0
+};
+
+/* Distance codes 0..29: base distances and extra bits. */
+static const unsigned short dist_base[30] = {
+    1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+    257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+    8193, 12289, 16385, 24577
+};
+static const unsigned char dist_extra[30] = {
+    0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+    7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13
+};
+
+/* Bit output state. */
+typedef struct {
+    varbuf_t *out;
+    unsigned long bits;	/* pending bits, LSB first */
+    int nbits;		/* number of pending bits */
+} bitout_t;
+
+/*
+ * Append 'n' bits of 'v', least-significant bit first.
+ */
+static void
+put_bits(bitout_t *b, unsigned long v, int n)
+{
+    b->bits |= v << b->nbits;
+    b->nbits += n;
+    while (b->nbits >= 8) {
+	char c = (char)(b->bits & 0xff);
+
+	vb_append(b->out, &c, 1);
+	b->bits >>= 8;
+	b->nbits -= 8;
+    }
+}
+
+/*
+ * Append an 'n'-bit Huffman code. Huffman codes are stored
+ * most-significant bit first, so the code is reversed.
+ */
+static void
+put_code(bitout_t *b, unsigned v, int n)
+{
+    unsigned r = 0;
+    int i;
+
+    for (i = 0; i < n; i++) {
+	r = (r << 1) | ((v >> i) & 1);
+    }
+    put_bits(b, r, n);
+}
+
+/*
+ * Append a literal/length symbol, using the fixed code.
+ */
+static void
+put_litlen(bitout_t *b, unsigned v)
+{
+    if (v < 144) {
+	put_code(b, 0x30 + v, 8);
+    } else if (v < 256) {
+	put_code(b, 0x190 + (v - 144), 9);
+    } else if (v < 280) {
+	put_code(b, v - 256, 7);
+    } else {
+	put_code(b, 0xc0 + (v - 280), 8);
+    }
+}
+
+/*
+ * Append a match of length 'len' at distance 'dist'.
+ */
+static void
+put_match(bitout_t *b, unsigned len, unsigned dist)
+{
+    int c;
+
+    for (c = 28; len_base[c] > len; c--) {
+    }
+    put_litlen(b, 257 + c);
+    put_bits(b, len - len_base[c], len_extra[c]);
+
+    for (c = 29; dist_base[c] > dist; c--) {
+    }
+    put_code(b, c, 5);
+    put_bits(b, dist - dist_base[c], dist_extra[c]);
+}
+
+/*
+ * Hash the three bytes at 'p'.
+ */
+static unsigned
+hash3(const unsigned char *p)
+{
+    return ((p[0] << 10) ^ (p[1] << 5) ^ p[2]) & (HSIZE - 1);
+}
+
+/*
+ * Compress a buffer into a fixed-Huffman DEFLATE stream.
+ */
+static void
+deflate_raw(const unsigned char *in, size_t len, varbuf_t *out)
+{
+    bitout_t b;
+    int *head;
+    int *prev;
+    size_t i;
+
+    b.out = out;
+    b.bits = 0;
+    b.nbits = 0;
+
+    head = (int *)Malloc(HSIZE * sizeof(int));
+    prev = (int *)Malloc(WSIZE * sizeof(int));
+    for (i = 0; i < HSIZE; i++) {
+	head[i] = -1;
+    }
+
+    /* BFINAL=1, BTYPE=01 (fixed Huffman codes). */
+    put_bits(&b, 1, 1);
+    put_bits(&b, 1, 2);
+
+    i = 0;
+    while (i < len) {
+	unsigned best_len = 0;
+	unsigned best_dist = 0;
+
+	if (i + MIN_MATCH <= len) {
+	    unsigned h = hash3(in + i);
+	    int cand = head[h];
+	    int chain = MAX_CHAIN;
+	    size_t max = len - i;
+
+	    if (max > MAX_MATCH) {
+		max = MAX_MATCH;
+	    }
+	    while (cand >= 0 && (size_t)cand < i && i - cand <= WSIZE &&
+		    chain-- > 0) {
+		const unsigned char *p = in + cand;
+		const unsigned char *q = in + i;
+		unsigned n = 0;
+
+		if (p[best_len] == q[best_len]) {
+		    while (n < max && p[n] == q[n]) {
+			n++;
+		    }
+		    if (n > best_len) {
+			best_len = n;
+			best_dist = (unsigned)(i - cand);
+			if (n == max) {
+			    break;
+			}
+		    }
+		}
+		cand = prev[cand & (WSIZE - 1)];
+	    }
+	}
+
+	if (best_len >= MIN_MATCH) {
+	    size_t end = i + best_len;
+
+	    put_match(&b, best_len, best_dist);
+	    /* Insert every position covered by the match. */
+	    for (; i < end; i++) {
+		if (i + MIN_MATCH <= len) {
+		    unsigned h = hash3(in + i);
+
+		    prev[i & (WSIZE - 1)] = head[h];
+		    head[h] = (int)i;
+		}
+	    }
+	} else {
+	    if (i + MIN_MATCH <= len) {
+		unsigned h = hash3(in + i);
+
+		prev[i & (WSIZE - 1)] = head[h];
+		head[h] = (int)i;
+	    }
+	    put_litlen(&b, in[i]);
+	    i++;
+	}
+    }
+
+    /* End of block, then flush to a byte boundary. */
+    put_litlen(&b, 256);
+    if (b.nbits) {
+	put_bits(&b, 0, 8 - b.nbits);
+    }
+
+    Free(prev);
+    Free(head);
+}
+
+/*
+ * Compute a CRC-32 (as used by gzip).
+ */
+static uint32_t
+gz_crc32(const unsigned char *p, size_t len)
+{
+    static uint32_t table[256];
+    static bool initted = false;
+    uint32_t crc = 0xffffffff;
+    size_t i;
+
+    if (!initted) {
+	uint32_t c;
+	int n, k;
+
+	for (n = 0; n < 256; n++) {
+	    c = (uint32_t)n;
+	    for (k = 0; k < 8; k++) {
+		c = (c & 1)? (0xedb88320 ^ (c >> 1)): (c >> 1);
+	    }
+	    table[n] = c;
+	}
+	initted = true;
+    }
+    for (i = 0; i < len; i++) {
+	crc = table[(crc ^ p[i]) & 0xff] ^ (crc >> 8);
+    }
+    return crc ^ 0xffffffff;
+}
+
+/*
+ * Compute an Adler-32 checksum (as used by zlib).
+ */
+static uint32_t
+adler32(const unsigned char *p, size_t len)
+{
+    uint32_t a = 1, b = 0;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+	a = (a + p[i]) % 65521;
+	b = (b + a) % 65521;
+    }
+    return (b << 16) | a;
+}
+
+/*
+ * Append a 32-bit value, least- or most-significant byte first.
+ */
+static void
+put_u32(varbuf_t *out, uint32_t v, bool big_endian)
+{
+    unsigned char c[4];
+    int i;
+
+    for (i = 0; i < 4; i++) {
+	c[big_endian? 3 - i: i] = (v >> (i * 8)) & 0xff;
+    }
+    vb_append(out, (char *)c, 4);
+}
+
+/*
+ * Compress a buffer, appending the result to 'out'.
+ */
+void
+deflate_buffer(const char *in, size_t len, deflate_format_t fmt,
+	varbuf_t *out)
+{
+    const unsigned char *u = (const unsigned char *)in;
+
+    if (fmt == DF_GZIP) {
+	/* Magic, CM=8, no flags, no mtime, no XFL, OS unknown. */
+	static const char gz_header[10] = {
+	    0x1f, (char)0x8b, 8, 0, 0, 0, 0, 0, 0, (char)0xff
+	};
+
+	vb_append(out, gz_header, sizeof(gz_header));
+	deflate_raw(u, len, out);
+	put_u32(out, gz_crc32(u, len), false);
+	put_u32(out, (uint32_t)len, false);
+    } else {
+	/* CM=8, 32K window, fastest compression level. */
+	vb_append(out, "\x78\x01", 2);
+	deflate_raw(u, len, out);
+	put_u32(out, adler32(u, len), true);
+    }
+}
@@ -32,6 +32,8 @@
 
 #include "globals.h"
 
+#include "startup.h"
+#include "task.h"
 #include "telnet.h"
 #include "trace.h"
 #include "utils.h"
@@ -141,6 +143,10 @@ change_cstate(enum cstate new_cstate, const char *why)
 	    state_name[new_cstate], why);
 
     cstate = new_cstate;
+    task_wakeup();
+    if (new_cstate >= CONNECTED_NVT) {
+	startup_mark(STARTUP_NEGOTIATED);
+    }
 
     /* Handle connected/not connected separately. */
     if (cCONNECTED(old_cstate) != cCONNECTED(new_cstate) ||
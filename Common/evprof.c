@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	evprof.c
+ *		Event loop profiler.
+ *
+ * When the eventProfileMs resource is non-zero, the event loop times each
+ * callback it runs and passes the result here. Samples are kept in one
+ * histogram per callback function, and any callback that takes at least
+ * eventProfileMs milliseconds is written to the trace.
+ */
+
+#include "globals.h"
+
+#if defined(__GLIBC__) /*[*/
+# include <execinfo.h>
+#endif /*]*/
+
+#include "appres.h"
+#include "evprof.h"
+#include "hist.h"
+#include "lazya.h"
+#include "names.h"
+#include "popups.h"
+#include "query.h"
+#include "resources.h"
+#include "toggles.h"
+#include "trace.h"
+#include "utils.h"
+#include "varbuf.h"
+
+#define EP_HASH_SIZE	64
+
+typedef struct evprof {
+    struct evprof *next;		/* next in hash bucket */
+    evprof_fn_t fn;			/* callback */
+    evprof_kind_t kind;			/* kind of callback */
+    char *name;				/* symbolized name */
+    hist_t hist;			/* run times, in microseconds */
+} evprof_t;
+
+static evprof_t *ep_hash[EP_HASH_SIZE];
+static unsigned ep_count;
+
+static const char *kind_name[] = { "input", "output", "exception", "timeout" };
+
+/* Hash a callback. */
+static unsigned
+ep_hash_fn(evprof_fn_t fn)
+{
+    uintptr_t u = (uintptr_t)fn;
+
+    return (unsigned)((u >> 4) ^ (u >> 10)) & (EP_HASH_SIZE - 1);
+}
+
+/*
+ * Find a name for a callback. Without a symbol table, this is the address,
+ * which addr2line can translate.
+ */
+static char *
+ep_symbolize(evprof_fn_t fn)
+{
+#if defined(__GLIBC__) /*[*/
+    void *addr = (void *)(uintptr_t)fn;
+    char **syms = backtrace_symbols(&addr, 1);
+
+    if (syms != NULL) {
+	/* The format is file(symbol+offset) [address]. */
+	char *lp = strchr(syms[0], '(');
+	char *rp = (lp != NULL)? strchr(lp, ')'): NULL;
+	char *name = NULL;
+
+	if (rp != NULL && lp[1] != '+') {
+	    char *plus = strchr(lp, '+');
+
+	    if (plus == NULL || plus > rp) {
+		plus = rp;
+	    }
+	    name = xs_buffer("%.*s", (int)(plus - lp - 1), lp + 1);
+	} else if (rp != NULL) {
+	    /* No symbol: keep the file's base name and the offset. */
+	    char *slash;
+
+	    *lp = '\0';
+	    slash = strrchr(syms[0], '/');
+	    name = xs_buffer("%s%.*s", (slash != NULL)? slash + 1: syms[0],
+		    (int)(rp - lp - 1), lp + 1);
+	}
+	free(syms);
+	if (name != NULL) {
+	    return name;
+	}
+    }
+#endif /*]*/
+    return xs_buffer("0x%lx", (unsigned long)(uintptr_t)fn);
+}
+
+/*
+ * Record the time taken by a callback.
+ */
+void
+evprof_record(evprof_fn_t fn, evprof_kind_t kind, unsigned long usec)
+{
+    unsigned h = ep_hash_fn(fn);
+    evprof_t *e;
+
+    for (e = ep_hash[h]; e != NULL; e = e->next) {
+	if (e->fn == fn && e->kind == kind) {
+	    break;
+	}
+    }
+    if (e == NULL) {
+	e = (evprof_t *)Calloc(1, sizeof(evprof_t));
+	e->fn = fn;
+	e->kind = kind;
+	e->name = ep_symbolize(fn);
+	e->next = ep_hash[h];
+	ep_hash[h] = e;
+	ep_count++;
+    }
+    hist_add(&e->hist, usec);
+
+    if (appres.event_profile_ms > 0 &&
+	    usec >= (unsigned long)appres.event_profile_ms * 1000UL) {
+	vtrace("Event loop stall: %s callback %s took %lu.%03lums\n",
+		kind_name[kind], e->name, usec / 1000UL, usec % 1000UL);
+    }
+}
+
+/* Discard the profile. */
+static void
+evprof_reset(void)
+{
+    int i;
+
+    for (i = 0; i < EP_HASH_SIZE; i++) {
+	evprof_t *e, *next;
+
+	for (e = ep_hash[i]; e != NULL; e = next) {
+	    next = e->next;
+	    hist_clear(&e->hist);
+	    Free(e->name);
+	    Free(e);
+	}
+	ep_hash[i] = NULL;
+    }
+    ep_count = 0;
+}
+
+/* Order profile entries by total time, largest first. */
+static int
+ep_compare(const void *a, const void *b)
+{
+    const evprof_t *ea = *(evprof_t **)a;
+    const evprof_t *eb = *(evprof_t **)b;
+
+    if (ea->hist.total > eb->hist.total) {
+	return -1;
+    }
+    return ea->hist.total < eb->hist.total;
+}
+
+/*
+ * Event profile query.
+ * Returns one line per callback, in decreasing order of total time.
+ */
+static const char *
+evprof_query(void)
+{
+    evprof_t **sorted;
+    varbuf_t r;
+    unsigned n = 0;
+    unsigned i;
+
+    if (!ep_count) {
+	return NULL;
+    }
+    sorted = (evprof_t **)Malloc(ep_count * sizeof(evprof_t *));
+    for (i = 0; i < EP_HASH_SIZE; i++) {
+	evprof_t *e;
+
+	for (e = ep_hash[i]; e != NULL; e = e->next) {
+	    sorted[n++] = e;
+	}
+    }
+    qsort(sorted, n, sizeof(evprof_t *), ep_compare);
+
+    vb_init(&r);
+    for (i = 0; i < n; i++) {
+	hist_t *h = &sorted[i]->hist;
+
+	vb_appendf(&r, "%s%s %s count %lu total-ms %.3f mean-ms %.3f "
+		"p50-ms %.3f p99-ms %.3f max-ms %.3f",
+		i? "\n": "",
+		sorted[i]->name,
+		kind_name[sorted[i]->kind],
+		h->count,
+		h->total / 1000.0,
+		(h->total / h->count) / 1000.0,
+		hist_pct(h, 50) / 1000.0,
+		hist_pct(h, 99) / 1000.0,
+		h->max / 1000.0);
+    }
+    Free(sorted);
+    return lazya(vb_consume(&r));
+}
+
+/* The eventProfileMs resource changed. */
+static bool
+toggle_event_profile_ms(const char *name _is_unused, const char *value)
+{
+    unsigned long l;
+    char *end;
+    int ms;
+
+    if (!*value) {
+	appres.event_profile_ms = 0;
+	return true;
+    }
+
+    l = strtoul(value, &end, 10);
+    ms = (int)l;
+    if (*end != '\0' || (unsigned long)ms != l || ms < 0) {
+	popup_an_error("Invalid %s value", ResEventProfileMs);
+	return false;
+    }
+
+    /* Start a fresh profile each time profiling is turned on. */
+    if (ms && !appres.event_profile_ms) {
+	evprof_reset();
+    }
+    appres.event_profile_ms = ms;
+    return true;
+}
+
+/*
+ * Event profiler module registration.
+ */
+void
+evprof_register(void)
+{
+    static query_t queries[] = {
+	{ KwEventProfile, evprof_query, NULL, false, false }
+    };
+
+    register_extended_toggle(ResEventProfileMs, toggle_event_profile_ms,
+	    NULL, NULL, (void **)&appres.event_profile_ms, XRM_INT);
+    register_queries(queries, array_count(queries));
+}
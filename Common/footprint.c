@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+/*
+ *	footprint.c
+ *		Per-session resource footprint.
+ *
+ * Each module that owns a sizeable buffer registers a function that
+ * returns its live size, computed from the sizes it already keeps, so
+ * Query(Footprint) costs almost nothing. Items are either per session
+ * (the screen buffers, scrollback, trace and network buffers) or shared
+ * by every session in the process (action and query tables, compose maps).
+ */
+
+#include "globals.h"
+
+#include "actions.h"
+#include "footprint.h"
+#include "lazya.h"
+#include "names.h"
+#include "query.h"
+#include "utils.h"
+#include "varbuf.h"
+
+static footprint_t *footprints = NULL;
+static size_t num_footprints = 0;
+
+/**
+ * Register a set of footprint items.
+ *
+ * @param[in] new_footprints	Items to add
+ * @param[in] count		Number of items
+ */
+void
+register_footprints(footprint_t new_footprints[], size_t count)
+{
+    footprints = (footprint_t *)Realloc(footprints,
+	    (num_footprints + count) * sizeof(footprint_t));
+    memcpy(footprints + num_footprints, new_footprints,
+	    count * sizeof(footprint_t));
+    num_footprints += count;
+}
+
+/**
+ * Return the number of items.
+ *
+ * @return Number of items
+ */
+size_t
+footprint_count(void)
+{
+    return num_footprints;
+}
+
+/**
+ * Return the name of an item.
+ *
+ * @param[in] ix	Item index
+ *
+ * @return Name
+ */
+const char *
+footprint_name(size_t ix)
+{
+    return footprints[ix].name;
+}
+
+/**
+ * Take a snapshot of the item sizes.
+ *
+ * @param[out] sizes	Returned sizes, footprint_count() of them
+ * @param[out] session	Returned total of the per-session items
+ * @param[out] shared	Returned total of the shared items
+ */
+void
+footprint_snapshot(size_t *sizes, size_t *session, size_t *shared)
+{
+    size_t i;
+
+    *session = 0;
+    *shared = 0;
+    for (i = 0; i < num_footprints; i++) {
+	sizes[i] = (*footprints[i].size)();
+	if (footprints[i].shared) {
+	    *shared += sizes[i];
+	} else {
+	    *session += sizes[i];
+	}
+    }
+}
+
+/**
+ * Footprint query.
+ * Returns one line per item, per-session items first, followed by totals.
+ *
+ * @return Text
+ */
+const char *
+footprint_dump(void)
+{
+    size_t *sizes = (size_t *)lazya(Malloc((num_footprints + 1) *
+		sizeof(size_t)));
+    size_t session, shared;
+    varbuf_t r;
+    int pass;
+    size_t i;
+
+    footprint_snapshot(sizes, &session, &shared);
+    vb_init(&r);
+    for (pass = 0; pass < 2; pass++) {
+	for (i = 0; i < num_footprints; i++) {
+	    if (footprints[i].shared == (pass == 1)) {
+		vb_appendf(&r, "%s %s bytes %zu\n",
+			footprints[i].shared? "shared": "session",
+			footprints[i].name, sizes[i]);
+	    }
+	}
+    }
+    vb_appendf(&r, "Total session-bytes %zu shared-bytes %zu", session,
+	    shared);
+    return lazya(vb_consume(&r));
+}
+
+/* Size of the action table. */
+static size_t
+footprint_actions(void)
+{
+    return actions_list_count * sizeof(action_elt_t);
+}
+
+/**
+ * Footprint module registration.
+ */
+void
+footprint_register(void)
+{
+    static query_t queries[] = {
+	{ KwFootprint, footprint_dump, NULL, false, true }
+    };
+    static footprint_t items[] = {
+	{ "actions", footprint_actions, true }
+    };
+
+    register_queries(queries, array_count(queries));
+    register_footprints(items, array_count(items));
+}
@@ -66,8 +66,23 @@ typedef struct {
     FILE *file;			/* Stream to write to */
     char *caption;		/* Caption with %T% expanded */
     char *printer_name;		/* Printer name (used by GDI) */
+    const unsigned char *rows;	/* Rows for the next text screen, or NULL */
+    varbuf_t out;		/* Screen image being built */
 } real_fps_t;
 
+/* A screen snapshot. */
+struct _fps_snap {
+    int rows;			/* ROWS when captured */
+    int cols;			/* COLS when captured */
+    int xrows;			/* rows in the image, including any OIA */
+    int cursor_addr;		/* cursor address */
+    int fa_addr;		/* field attribute governing address 0 */
+    bool m3279;			/* true if 3279 default colors apply */
+    unsigned char *rows_set;	/* rows to write for text, or NULL */
+    struct ea *ea_alloc;	/* buffer, including a leading dummy cell */
+    struct ea *ea;		/* screen image */
+};
+
 /* Globals */
 
 /* Statics */
@@ -76,7 +91,7 @@ typedef struct {
  * Map default 3279 colors.  This code is duplicated three times. ;-(
  */
 static int
-color_from_fa(unsigned char fa)
+color_from_fa(unsigned char fa, bool m3279)
 {
     static int field_colors[4] = {
 	HOST_COLOR_GREEN,        /* default */
@@ -87,7 +102,7 @@ color_from_fa(unsigned char fa)
 	((((f) & FA_PROTECT) >> 4) | (((f) & FA_INT_HIGH_SEL) >> 3))
     };
 
-    if (mode.m3279) {
+    if (m3279) {
 	return field_colors[DEFCOLOR_MAP(fa)];
     } else {
 	return HOST_COLOR_GREEN;
@@ -125,6 +140,32 @@ html_color(int color)
     }
 }
 
+/*
+ * Return the HTML span start tag for a combination of attributes.
+ * The tags are built once and kept.
+ */
+static const char *
+html_span(int fg, int bg, bool high, bool ital, bool underline)
+{
+    static char *spans[16][16][2][2][2];
+    char **span = &spans[fg & 0x0f][bg & 0x0f][high][ital][underline];
+
+    if (*span == NULL) {
+	*span = xs_buffer("<span "
+		"style=\"color:%s;"
+		"background:%s;"
+		"font-weight:%s;"
+		"font-style:%s;"
+		"text-decoration:%s\">",
+		html_color(fg),
+		html_color(bg),
+		high? "bold": "normal",
+		ital? "italic": "normal",
+		underline? "underline": "none");
+    }
+    return *span;
+}
+
 /* Convert a caption string to UTF-8 RTF. */
 static char *
 rtf_caption(const char *caption)
@@ -226,6 +267,8 @@ fprint_screen_start(FILE *f, ptype_t ptype, unsigned opts, const char *caption,
     fps->spp = 1;
     fps->screens = 0;
     fps->file = f;
+    fps->rows = NULL;
+    vb_init(&fps->out);
 
     if (caption != NULL) {
 	char *xcaption;
@@ -376,18 +419,106 @@ fprint_screen_start(FILE *f, ptype_t ptype, unsigned opts, const char *caption,
     return rv;
 }
 
-#define FAIL do { \
-    rv = -1; \
-    goto done; \
-} while(false)
+/*
+ * Translate the pending run of text characters and add it to the screen
+ * image.
+ */
+static void
+flush_text(real_fps_t *fps, const ucs4_t *text, int *text_len)
+{
+    char *mb;
+    size_t nmb;
+
+    if (!*text_len) {
+	return;
+    }
+    mb = Malloc(mb_max_len(*text_len));
+    nmb = unicode_to_multibyte_string(text, *text_len, mb,
+	    mb_max_len(*text_len));
+    vb_append(&fps->out, mb, nmb);
+    Free(mb);
+    *text_len = 0;
+}
 
 /*
- * Add a screen image to a stream.
+ * Capture the screen for a later fprint_screen_body_snap() call.
+ *
+ * The snapshot is a private copy of everything the image depends on, so it
+ * can be written after the screen has changed. It takes over any row set
+ * from fprint_screen_set_rows().
+ */
+fps_snap_t
+fprint_screen_snap(fps_t ofps)
+{
+    real_fps_t *fps = (real_fps_t *)(void *)ofps;
+    struct _fps_snap *snap;
+    bool oia = fps != NULL && (fps->opts & FPS_OIA);
+
+    snap = (struct _fps_snap *)Malloc(sizeof(struct _fps_snap));
+    snap->rows = ROWS;
+    snap->cols = COLS;
+    snap->xrows = oia? ROWS + 2: ROWS;
+    snap->cursor_addr = cursor_addr;
+    snap->fa_addr = find_field_attribute(0);
+    snap->m3279 = mode.m3279;
+    snap->rows_set = NULL;
+    if (fps != NULL && fps->rows != NULL) {
+	snap->rows_set = (unsigned char *)Malloc(ROWS);
+	memcpy(snap->rows_set, fps->rows, ROWS);
+	fps->rows = NULL;
+    }
+
+    /* Copy the buffer, including the dummy cell in front of it. */
+    snap->ea_alloc = (struct ea *)Calloc(1 + (snap->xrows * COLS),
+	    sizeof(struct ea));
+    memcpy(snap->ea_alloc, ea_buf - 1,
+	    (1 + (ROWS * COLS)) * sizeof(struct ea));
+    snap->ea = snap->ea_alloc + 1;
+    if (oia) {
+	vstatus_line(snap->ea + (ROWS * COLS));
+    }
+    return snap;
+}
+
+/* Free a screen snapshot. */
+void
+fprint_screen_snap_free(fps_snap_t snap)
+{
+    if (snap != NULL) {
+	Free(snap->rows_set);
+	Free(snap->ea_alloc);
+	Free(snap);
+    }
+}
+
+/*
+ * Add the current screen image to a stream.
  *
  * Returns 0 for no screen written, 1 for screen written, -1 for error.
  */
 fps_status_t
 fprint_screen_body(fps_t ofps)
+{
+    fps_snap_t snap;
+    fps_status_t rv;
+
+    /* Quick short-circuit. */
+    if (ofps == NULL || ((real_fps_t *)(void *)ofps)->broken) {
+	return FPS_STATUS_ERROR;
+    }
+    snap = fprint_screen_snap(ofps);
+    rv = fprint_screen_body_snap(ofps, snap);
+    fprint_screen_snap_free(snap);
+    return rv;
+}
+
+/*
+ * Add a captured screen image to a stream.
+ *
+ * Returns 0 for no screen written, 1 for screen written, -1 for error.
+ */
+fps_status_t
+fprint_screen_body_snap(fps_t ofps, fps_snap_t snap)
 {
     real_fps_t *fps = (real_fps_t *)(void *)ofps;
     register int i;
@@ -409,32 +540,30 @@ fprint_screen_body(fps_t ofps)
     fps_status_t rv = FPS_STATUS_SUCCESS;
     struct ea *xea;
     int xrows;
+    int rows_n, cols;
+    const unsigned char *rows = NULL;
+    bool skip = false;
+    ucs4_t *text = NULL;
+    int text_len = 0;
 
     /* Quick short-circuit. */
     if (fps == NULL || fps->broken) {
 	return FPS_STATUS_ERROR;
     }
 
-    if (fps->opts & FPS_OIA) {
-	xea = (struct ea *)Calloc(1 + ((ROWS + 2) * COLS), sizeof(struct ea));
-	lazya(xea);
-	memcpy(xea, ea_buf - 1, (1 + (ROWS * COLS)) * sizeof(struct ea));
-	xea++;
-	vstatus_line(xea + (ROWS * COLS));
-	xrows = ROWS + 2;
-    } else {
-	xea = ea_buf;
-	xrows = ROWS;
-    }
+    xea = snap->ea;
+    xrows = snap->xrows;
+    rows_n = snap->rows;
+    cols = snap->cols;
 
-    fa_addr = find_field_attribute(0);
+    fa_addr = snap->fa_addr;
     fa = xea[fa_addr].fa;
 
     mi = ((fps->opts & FPS_MODIFIED_ITALIC)) != 0;
     if (xea[fa_addr].fg) {
 	fa_fg = xea[fa_addr].fg & 0x0f;
     } else {
-	fa_fg = color_from_fa(fa);
+	fa_fg = color_from_fa(fa, snap->m3279);
     }
     current_fg = fa_fg;
 
@@ -462,54 +591,41 @@ fprint_screen_body(fps_t ofps)
     case P_RTF:
 	if (fps->need_separator) {
 	    if (fps->screens < fps->spp) {
-		if (fprintf(fps->file, "\\par\n") < 0) {
-		    FAIL;
-		}
+		vb_appends(&fps->out, "\\par\n");
 	    } else {
-		if (fprintf(fps->file, "\n\\page\n") < 0) {
-		    FAIL;
-		}
+		vb_appends(&fps->out, "\n\\page\n");
 		fps->screens = 0;
 	    }
 	}
 	if (current_high) {
-	    if (fprintf(fps->file, "\\b ") < 0) {
-		FAIL;
-	    }
+	    vb_appends(&fps->out, "\\b ");
 	}
 	break;
     case P_HTML:
-	if (fprintf(fps->file, "  <table border=0>"
+	vb_appends(&fps->out, "  <table border=0>"
 	       "<tr bgcolor=black><td>"
-	       "<pre><span style=\"color:%s;"
-				   "background:%s;"
-				   "font-weight:%s;"
-				   "font-style:%s;"
-				   "text-decoration:%s\">",
-	       html_color(current_fg),
-	       html_color(current_bg),
-	       current_high? "bold": "normal",
-	       current_ital? "italic": "normal",
-	       current_underline? "underline": "none") < 0) {
-	    FAIL;
-	}
+	       "<pre>");
+	vb_appends(&fps->out, html_span(current_fg, current_bg, current_high,
+		    current_ital, current_underline));
 	break;
     case P_TEXT:
+	/*
+	 * Text is collected a row at a time and translated in one piece,
+	 * which is much faster than one character at a time in some locales.
+	 */
+	text = (ucs4_t *)lazya(Malloc(cols * sizeof(ucs4_t)));
+
+	/* The set of rows to write for this screen only. */
+	rows = snap->rows_set;
 	if (fps->need_separator) {
 	    if ((fps->opts & FPS_FF_SEP) && fps->screens >= fps->spp) {
-		if (fputc('\f', fps->file) < 0) {
-		    FAIL;
-		}
+		vb_append(&fps->out, "\f", 1);
 		fps->screens = 0;
 	    } else {
-		for (i = 0; i < COLS; i++) {
-		    if (fputc('=', fps->file) < 0) {
-			FAIL;
-		    }
-		}
-		if (fputc('\n', fps->file) < 0) {
-		    FAIL;
+		for (i = 0; i < cols; i++) {
+		    vb_append(&fps->out, (rows != NULL)? "-": "=", 1);
 		}
+		vb_append(&fps->out, "\n", 1);
 	    }
 	}
 	break;
@@ -521,15 +637,9 @@ fprint_screen_body(fps_t ofps)
 	 */
 	h.signature = GDI_SIGNATURE;
 	h.rows = xrows;
-	h.cols = COLS;
-	if (fwrite(&h, sizeof(h), 1, fps->file) != 1) {
-	    FAIL;
-	}
-	if (fwrite(xea, sizeof(struct ea), xrows * COLS, fps->file)
-		    != xrows * COLS) {
-	    FAIL;
-	}
-	fflush(fps->file);
+	h.cols = cols;
+	vb_append(&fps->out, (char *)&h, sizeof(h));
+	vb_append(&fps->out, (char *)xea, sizeof(struct ea) * xrows * cols);
 	rv = FPS_STATUS_SUCCESS_WRITTEN;
 	goto done;
 #endif /*]*/
@@ -539,28 +649,38 @@ fprint_screen_body(fps_t ofps)
 
     fps->need_separator = false;
 
-    for (i = 0; i < xrows * COLS; i++) {
+    for (i = 0; i < xrows * cols; i++) {
 	char mb[16];
 	int nmb;
 
 	uc = 0;
 
-	if (i && !(i % COLS)) {
+	if (i && !(i % cols)) {
+	    flush_text(fps, text, &text_len);
 	    if (fps->ptype == P_HTML) {
-		if (fputc('\n', fps->file) < 0) {
-		    FAIL;
-		}
-	    } else {
+		vb_append(&fps->out, "\n", 1);
+	    } else if (!skip) {
 		nr++;
 	    }
 	}
+	if (rows != NULL && !(i % cols)) {
+	    /* Only some rows are written, each labeled with its number. */
+	    skip = i / cols < rows_n && !rows[i / cols];
+	    if (!skip) {
+		while (nr) {
+		    vb_append(&fps->out, "\n", 1);
+		    nr--;
+		}
+		vb_appendf(&fps->out, "%02d|", (i / cols) + 1);
+	    }
+	}
 	if (xea[i].fa) {
 	    uc = ' ';
 	    fa = xea[i].fa;
 	    if (xea[i].fg) {
 		fa_fg = xea[i].fg & 0x0f;
 	    } else {
-		fa_fg = color_from_fa(fa);
+		fa_fg = color_from_fa(fa, snap->m3279);
 	    }
 	    if (xea[i].bg) {
 		fa_bg = xea[i].bg & 0x0f;
@@ -587,19 +707,19 @@ fprint_screen_body(fps_t ofps)
 	    fa_reverse = false;
 	}
 	if (FA_IS_ZERO(fa)) {
-	    if (ctlr_dbcs_state(i) == DBCS_LEFT) {
+	    if (ctlr_dbcs_state_ea(i, xea) == DBCS_LEFT) {
 		uc = 0x3000;
 	    } else {
 		uc = ' ';
 	    }
 	} else if (is_nvt(&xea[i], false, &uc)) {
 	    /* NVT-mode text. */
-	    if (ctlr_dbcs_state(i) == DBCS_RIGHT) {
+	    if (ctlr_dbcs_state_ea(i, xea) == DBCS_RIGHT) {
 		continue;
 	    }
 	} else {
 	    /* Convert EBCDIC to Unicode. */
-	    switch (ctlr_dbcs_state(i)) {
+	    switch (ctlr_dbcs_state_ea(i, xea)) {
 	    case DBCS_NONE:
 	    case DBCS_SB:
 		uc = ebcdic_to_unicode(xea[i].ec, xea[i].cs, EUO_NONE);
@@ -623,15 +743,16 @@ fprint_screen_body(fps_t ofps)
 	    }
 	}
 
+	if (skip) {
+	    continue;
+	}
+
 	/* Translate to a type-specific format and write it out. */
 	while (nr) {
-	    if (fps->ptype == P_RTF)
-		if (fprintf(fps->file, "\\par") < 0) {
-		    FAIL;
-		}
-	    if (fputc('\n', fps->file) < 0) {
-		FAIL;
+	    if (fps->ptype == P_RTF) {
+		vb_appends(&fps->out, "\\par");
 	    }
+	    vb_append(&fps->out, "\n", 1);
 	    nr--;
 	}
 	if (fps->ptype == P_RTF) {
@@ -645,15 +766,7 @@ fprint_screen_body(fps_t ofps)
 		high = fa_high;
 	    }
 	    if (high != current_high) {
-		if (high) {
-		    if (fprintf(fps->file, "\\b ") < 0) {
-			FAIL;
-		    }
-		} else {
-		    if (fprintf(fps->file, "\\b0 ") < 0) {
-			FAIL;
-		    }
-		}
+		vb_appends(&fps->out, high? "\\b ": "\\b0 ");
 		current_high = high;
 	    }
 	    if (xea[i].gr & GR_UNDERLINE) {
@@ -662,15 +775,7 @@ fprint_screen_body(fps_t ofps)
 		underline = fa_underline;
 	    }
 	    if (underline != current_underline) {
-		if (underline) {
-		    if (fprintf(fps->file, "\\ul ") < 0) {
-			FAIL;
-		    }
-		} else {
-		    if (fprintf(fps->file, "\\ul0 ") < 0) {
-			FAIL;
-		    }
-		}
+		vb_appends(&fps->out, underline? "\\ul ": "\\ul0 ");
 		current_underline = underline;
 	    }
 	    if (xea[i].gr & GR_REVERSE) {
@@ -678,19 +783,12 @@ fprint_screen_body(fps_t ofps)
 	    } else {
 		reverse = fa_reverse;
 	    }
-	    if (i == cursor_addr) {
+	    if (i == snap->cursor_addr) {
 		reverse = !reverse;
 	    }
 	    if (reverse != current_reverse) {
-		if (reverse) {
-		    if (fprintf(fps->file, "\\cf1\\highlight2 ") < 0) {
-			FAIL;
-		    }
-		} else {
-		    if (fprintf(fps->file, "\\cf0\\highlight0 ") < 0) {
-			FAIL;
-		    }
-		}
+		vb_appends(&fps->out, reverse? "\\cf1\\highlight2 ":
+			"\\cf0\\highlight0 ");
 		current_reverse = reverse;
 	    }
 	}
@@ -717,7 +815,7 @@ fprint_screen_body(fps_t ofps)
 		bg_color = tmp;
 	    }
 
-	    if (i == cursor_addr) {
+	    if (i == snap->cursor_addr) {
 		fg_color = (bg_color == HOST_COLOR_RED)?
 		    HOST_COLOR_BLACK: bg_color;
 		bg_color = HOST_COLOR_RED;
@@ -738,20 +836,9 @@ fprint_screen_body(fps_t ofps)
 		high != current_high ||
 		fa_ital != current_ital ||
 		underline != current_underline) {
-		if (fprintf(fps->file,
-			    "</span><span "
-			    "style=\"color:%s;"
-			    "background:%s;"
-			    "font-weight:%s;"
-			    "font-style:%s;"
-			    "text-decoration:%s\">",
-			    html_color(fg_color),
-			    html_color(bg_color),
-			    high? "bold": "normal",
-			    fa_ital? "italic": "normal",
-			    underline? "underline": "none") < 0) {
-		    FAIL;
-		}
+		vb_appends(&fps->out, "</span>");
+		vb_appends(&fps->out, html_span(fg_color, bg_color, high,
+			    fa_ital, underline));
 		current_fg = fg_color;
 		current_bg = bg_color;
 		current_high = high;
@@ -762,103 +849,97 @@ fprint_screen_body(fps_t ofps)
 	any = true;
 	if (fps->ptype == P_RTF) {
 	    if (uc & ~0x7f) {
-		if (fprintf(fps->file, "\\u%u?", uc) < 0) {
-		    FAIL;
-		}
+		vb_appendf(&fps->out, "\\u%u?", uc);
 	    } else {
-		nmb = unicode_to_multibyte(uc, mb, sizeof(mb));
+		unicode_to_multibyte(uc, mb, sizeof(mb));
 		if (mb[0] == '\\' || mb[0] == '{' || mb[0] == '}') {
-		    if (fprintf(fps->file, "\\%c", mb[0]) < 0) {
-			FAIL;
-		    }
+		    vb_append(&fps->out, "\\", 1);
+		    vb_append(&fps->out, mb, 1);
 		} else if (mb[0] == '-') {
-		    if (fprintf(fps->file, "\\_") < 0) {
-			FAIL;
-		    }
+		    vb_appends(&fps->out, "\\_");
 		} else if (mb[0] == ' ') {
-		    if (fprintf(fps->file, "\\~") < 0) {
-			FAIL;
-		    }
+		    vb_appends(&fps->out, "\\~");
 		} else {
-		    if (fputc(mb[0], fps->file) < 0) {
-			FAIL;
-		    }
+		    vb_append(&fps->out, mb, 1);
 		}
 	    }
 	} else if (fps->ptype == P_HTML) {
 	    if (uc == '<') {
-		if (fprintf(fps->file, "&lt;") < 0) {
-		    FAIL;
-		}
+		vb_appends(&fps->out, "&lt;");
 	    } else if (uc == '&') {
-		if (fprintf(fps->file, "&amp;") < 0) {
-		    FAIL;
-		}
+		vb_appends(&fps->out, "&amp;");
 	    } else if (uc == '>') {
-		if (fprintf(fps->file, "&gt;") < 0) {
-		    FAIL;
-		}
+		vb_appends(&fps->out, "&gt;");
 	    } else {
 		nmb = unicode_to_utf8(uc, mb);
-		{
-		    int k;
-
-		    for (k = 0; k < nmb; k++) {
-			if (fputc(mb[k], fps->file) < 0) {
-			    FAIL;
-			}
-		    }
-		}
+		vb_append(&fps->out, mb, nmb);
 	    }
 	} else {
-	    nmb = unicode_to_multibyte(uc, mb, sizeof(mb));
-	    if (fputs(mb, fps->file) < 0) {
-		FAIL;
-	    }
+	    text[text_len++] = uc;
 	}
     }
+    flush_text(fps, text, &text_len);
 
     if (fps->ptype == P_HTML) {
-	if (fputc('\n', fps->file) < 0) {
-	    FAIL;
-	}
-    } else {
+	vb_append(&fps->out, "\n", 1);
+    } else if (!skip) {
 	nr++;
     }
     if (!any && !(fps->opts & FPS_EVEN_IF_EMPTY) && fps->ptype == P_TEXT) {
-	return FPS_STATUS_SUCCESS;
+	/* Only the separator, if anything, is written. */
+	goto done;
     }
     while (nr) {
 	if (fps->ptype == P_RTF) {
-	    if (fprintf(fps->file, "\\par") < 0) {
-		FAIL;
-	    }
+	    vb_appends(&fps->out, "\\par");
 	}
 	if (fps->ptype == P_TEXT) {
-	    if (fputc('\n', fps->file) < 0) {
-		FAIL;
-	    }
+	    vb_append(&fps->out, "\n", 1);
 	}
 	nr--;
     }
     if (fps->ptype == P_HTML) {
-	if (fprintf(fps->file, "%s</span></pre></td></tr>\n  </table>\n",
-		    current_high? "</b>": "") < 0) {
-	    FAIL;
+	if (current_high) {
+	    vb_appends(&fps->out, "</b>");
 	}
+	vb_appends(&fps->out, "</span></pre></td></tr>\n  </table>\n");
     }
     fps->need_separator = true;
     fps->screens++;
     rv = FPS_STATUS_SUCCESS_WRITTEN; /* wrote a screen */
 
 done:
+    /* Write the screen out in one piece. */
+    if (vb_len(&fps->out) &&
+	    fwrite(vb_buf(&fps->out), vb_len(&fps->out), 1, fps->file) != 1) {
+	rv = FPS_STATUS_ERROR;
+    }
+#if defined(_WIN32) /*[*/
+    if (fps->ptype == P_GDI) {
+	fflush(fps->file);
+    }
+#endif /*]*/
+    vb_reset(&fps->out);
     if (FPS_IS_ERROR(rv)) {
 	fps->broken = true;
     }
     return rv;
 }
 
-#undef FAIL
+/*
+ * Limit the next text screen to a set of rows, one flag per row.
+ * The screen is written with a '-' separator and each row is prefixed with
+ * its 1-origin number. Other types ignore this.
+ */
+void
+fprint_screen_set_rows(fps_t ofps, const unsigned char *rows)
+{
+    real_fps_t *fps = (real_fps_t *)(void *)ofps;
+
+    if (fps != NULL) {
+	fps->rows = rows;
+    }
+}
 
 /*
  * Finish writing a multi-screen image.
@@ -901,6 +982,7 @@ fprint_screen_done(fps_t *ofps)
     }
 
     /* Done with the context. */
+    vb_free(&fps->out);
     Free(fps->caption);
     Free(fps->printer_name);
     memset(fps, '\0', sizeof(*fps));
@@ -36,9 +36,14 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <sys/stat.h>
+#if !defined(_WIN32) /*[*/
+# include <sys/mman.h>
+#endif /*]*/
 
 #include "appres.h"
+#include "3270ds.h"
 #include "actions.h"
 #include "ft_cut.h"
 #include "ft_dft.h"
@@ -49,15 +54,21 @@
 #include "host.h"
 #include "idle.h"
 #include "kybd.h"
+#include "lazya.h"
 #include "names.h"
 #include "popups.h"
+#include "query.h"
 #include "resources.h"
 #include "task.h"
 #include "toggles.h"
+#include "trace.h"
 #include "utils.h"
 #include "varbuf.h"
 
 /* Macros. */
+#define DFT_AUTO_HIGH_RTT	0.020	/* round trip that favors big buffers */
+#define FT_PROGRESS_MS		100	/* minimum time between progress
+					   updates */
 
 /* Globals. */
 enum ft_state ft_state = FT_NONE;	/* File transfer state */
@@ -65,12 +76,47 @@ ft_conf_t *ftc;				/* Current file transfer config */
 enum iaction ft_cause;			/* Cause of current file transfer */
 
 /* Statics. */
+static void ft_xlate_init(void);
+static bool ft_map(FILE *f);
+static void ft_unmap(void);
+static const char *ft_query_stats(void);
+static void dft_auto_update(const char *errmsg);
+static void ft_progress_flush(void);
 static ft_conf_t transfer_ft_conf;	/* FT config for Transfer() action */
 static ft_conf_t gui_ft_conf;		/* FT config for GUI (actually just
 					   c3270; x3270 uses its own) */
 static bool gui_conf_initted = false;
 
 static struct timeval t0;		/* Starting time */
+static struct timeval t_end;		/* Ending time */
+static struct timeval t_reply;		/* When we last answered the host */
+static bool reply_pending = false;	/* Waiting for the host to answer */
+static bool stats_valid = false;	/* ft_stats describes a transfer */
+static struct timeval t_progress;	/* When progress was last reported */
+static bool progress_pending = false;	/* Progress not yet reported */
+static ioid_t progress_id = NULL_IOID;	/* Timeout to report it */
+
+ft_stats_t ft_stats;			/* Transfer statistics */
+
+ft_xlate_t ft_xlate;			/* Bulk translation tables */
+
+/* DFT buffer sizes chosen by ftBufferAuto, per host. */
+typedef struct dft_auto {
+    struct dft_auto *next;
+    char *host;
+    int size;
+} dft_auto_t;
+static dft_auto_t *dft_autos = NULL;
+static int dft_auto_conn_size = -1;	/* size for this connection, or -1 */
+
+/* Checkpoint of the current or last binary upload, for Resume=yes. */
+static struct {
+    bool valid;
+    char *host_filename;
+    char *local_filename;		/* resolved */
+    host_type_t host_type;
+    unsigned long offset;		/* local bytes accepted by the host */
+} ckpt;
 
 /* Translation table: "ASCII" to EBCDIC, as seen by IND$FILE. */
 unsigned char i_asc2ft[256] = {
@@ -128,6 +174,7 @@ enum ft_parm_name {
     PARM_SECONDARY_SPACE,
     PARM_BUFFER_SIZE,
     PARM_AVBLOCK,
+    PARM_RESUME,
 #if defined(_WIN32) /*[*/
     PARM_WINDOWS_CODEPAGE,
 #endif /*]*/
@@ -154,6 +201,7 @@ static struct {
     { "SecondarySpace" },
     { "BufferSize" },
     { "Avblock" },
+    { "Resume",		NULL, { "yes", "no" } },
 #if defined(_WIN32) /*[*/
     { "WindowsCodePage" },
 #endif /*]*/
@@ -204,6 +252,9 @@ ft_register(void)
     static action_table_t ft_actions[] = {
 	{ AnTransfer,	Transfer_action,	ACTION_KE }
     };
+    static query_t queries[] = {
+	{ KwTransferStats, ft_query_stats, NULL, false, false }
+    };
 
     /* Register for state changes. */
     register_schange(ST_CONNECT, ft_connected);
@@ -216,6 +267,8 @@ ft_register(void)
     register_extended_toggle(ResFtBufferSize, toggle_ft_buffer_size, NULL,
 	    NULL, (void **)&appres.ft.dft_buffer_size, XRM_INT);
 
+    /* Register the query. */
+    register_queries(queries, array_count(queries));
 }
 
 /* Encode/decode for host type. */
@@ -321,6 +374,7 @@ ft_init_conf(ft_conf_t *p)
     p->remap_flag = p->ascii_flag;
     p->allow_overwrite = false;
     p->append_flag = false;
+    p->resume_flag = false;
     p->recfm = DEFAULT_RECFM;
     p->units = DEFAULT_UNITS;
     p->lrecl = 0;
@@ -483,9 +537,27 @@ ft_complete(const char *errmsg)
 	popup_an_errno(errno, "close(%s)", fts.resolved_local_filename);
     }
     fts.local_file = NULL;
+    Replace(fts.local_buf, NULL);
+    ft_unmap();
+
+    /* A finished upload has nothing left to resume. */
+    if (errmsg == NULL) {
+	ckpt.valid = false;
+    }
+
+    /* Report the final length, if it has not been reported yet. */
+    ft_progress_flush();
+
+    /* Stop the clock. */
+    gettimeofday(&t_end, NULL);
+    reply_pending = false;
+    if (stats_valid) {
+	dft_auto_update(errmsg);
+    }
 
     /* Clean up the state. */
     ft_state = FT_NONE;
+    task_wakeup();
     if (ft_start_id != NULL_IOID) {
 	RemoveTimeOut(ft_start_id);
 	ft_start_id = NULL_IOID;
@@ -511,14 +583,10 @@ ft_complete(const char *errmsg)
 	ft_gui_complete_popup(msg_copy, true);
 	Free(msg_copy);
     } else {
-	struct timeval t1;
 	double bytes_sec;
 	char *buf;
 
-	gettimeofday(&t1, NULL);
-	bytes_sec = (double)fts.length /
-		((double)(t1.tv_sec - t0.tv_sec) + 
-		 (double)(t1.tv_usec - t0.tv_usec) / 1.0e6);
+	bytes_sec = (double)fts.length / ft_stats_elapsed();
 	buf = xs_buffer(get_message("ftComplete"), fts.length,
 		display_scale(bytes_sec),
 		fts.is_cut ? "CUT" : "DFT");
@@ -528,11 +596,155 @@ ft_complete(const char *errmsg)
     }
 }
 
-/* Update the bytes-transferred count on the progress pop-up. */
+/* Find the ftBufferAuto entry for the current host. */
+static dft_auto_t *
+dft_auto_find(bool create)
+{
+    const char *host = lazyaf("%s:%u", current_host, current_port);
+    dft_auto_t *a;
+
+    for (a = dft_autos; a != NULL; a = a->next) {
+	if (!strcmp(a->host, host)) {
+	    return a;
+	}
+    }
+    if (!create) {
+	return NULL;
+    }
+    a = (dft_auto_t *)Malloc(sizeof(dft_auto_t));
+    a->host = NewString(host);
+    a->size = 0;
+    a->next = dft_autos;
+    dft_autos = a;
+    return a;
+}
+
+/*
+ * Return the DFT buffer size ftBufferAuto has chosen for the current host,
+ * or 0 if it has not chosen one.
+ *
+ * The size is fixed for the life of a connection, so the size the Query
+ * Reply advertised is the size transfers use.
+ */
+int
+ft_auto_buffersize(void)
+{
+    dft_auto_t *a;
+
+    if (!appres.ft.dft_buffer_auto || !CONNECTED || current_host == NULL) {
+	return 0;
+    }
+    if (dft_auto_conn_size < 0) {
+	a = dft_auto_find(false);
+	dft_auto_conn_size = (a != NULL)? a->size: 0;
+    }
+    return dft_auto_conn_size;
+}
+
+/*
+ * Adjust the ftBufferAuto size for the current host after a DFT transfer.
+ *
+ * A transfer that failed or needed retransmits halves the size, so a lossy
+ * link resends less. A clean transfer doubles it, or goes straight to the
+ * maximum if the host round trip is long. The new size is used from the
+ * next connection to the host.
+ */
+static void
+dft_auto_update(const char *errmsg)
+{
+    dft_auto_t *a;
+    double rtt;
+    int size;
+
+    if (!appres.ft.dft_buffer_auto || fts.is_cut || current_host == NULL ||
+	    ft_stats.buffer_size == 0 ||
+	    (errmsg != NULL && !strcmp(errmsg, get_message("ftUserCancel")))) {
+	return;
+    }
+    rtt = ft_stats.rtt_count? ft_stats.rtt_total / ft_stats.rtt_count: 0.0;
+    size = (int)ft_stats.buffer_size;
+    if (errmsg != NULL || ft_stats.retransmits) {
+	size /= 2;
+    } else if (rtt >= DFT_AUTO_HIGH_RTT) {
+	size = DFT_MAX_BUF;
+    } else {
+	size *= 2;
+    }
+    if (size > DFT_MAX_BUF) {
+	size = DFT_MAX_BUF;
+    }
+    if (size < DFT_MIN_BUF) {
+	size = DFT_MIN_BUF;
+    }
+    a = dft_auto_find(true);
+    vtrace("%s: DFT buffer size for %s %d -> %d (rtt %.1fms, %s)\n",
+	    ResFtBufferAuto, a->host, (int)ft_stats.buffer_size, size,
+	    rtt * 1000.0, (errmsg != NULL)? "failed": "succeeded");
+    a->size = size;
+}
+
+/* Report progress now. */
+static void
+ft_progress_report(void)
+{
+    progress_pending = false;
+    gettimeofday(&t_progress, NULL);
+    ft_gui_update_length(fts.length);
+}
+
+/* Report progress that was held back by the rate limit. */
+static void
+ft_progress_timeout(ioid_t id _is_unused)
+{
+    progress_id = NULL_IOID;
+    if (progress_pending && ft_state != FT_NONE) {
+	ft_progress_report();
+    }
+}
+
+/* Report any progress that was held back, and cancel the timeout. */
+static void
+ft_progress_flush(void)
+{
+    if (progress_id != NULL_IOID) {
+	RemoveTimeOut(progress_id);
+	progress_id = NULL_IOID;
+    }
+    if (progress_pending) {
+	ft_progress_report();
+    }
+}
+
+/*
+ * Update the bytes-transferred count on the progress pop-up.
+ *
+ * This is called for every block, so updates are limited to one every
+ * FT_PROGRESS_MS milliseconds. An update that is held back is reported
+ * when the interval runs out, or when the transfer completes.
+ */
 void
 ft_update_length(void)
 {
-    ft_gui_update_length(fts.length);
+    struct timeval now;
+    long elapsed_ms;
+
+    gettimeofday(&now, NULL);
+    elapsed_ms = ((now.tv_sec - t_progress.tv_sec) * 1000L) +
+	((now.tv_usec - t_progress.tv_usec) / 1000L);
+    if (elapsed_ms < 0 || elapsed_ms >= FT_PROGRESS_MS) {
+	if (progress_id != NULL_IOID) {
+	    RemoveTimeOut(progress_id);
+	    progress_id = NULL_IOID;
+	}
+	ft_progress_report();
+	return;
+    }
+
+    progress_pending = true;
+    if (progress_id == NULL_IOID) {
+	progress_id = AddTimeOut(FT_PROGRESS_MS - elapsed_ms,
+		ft_progress_timeout);
+    }
 }
 
 /* Process a transfer acknowledgement. */
@@ -550,9 +762,103 @@ ft_running(bool is_cut)
     gettimeofday(&t0, NULL);
     fts.length = 0;
 
+    /* The first progress update is never held back. */
+    memset(&t_progress, 0, sizeof(t_progress));
+    progress_pending = false;
+    ft_stats.buffer_size = is_cut? 0: ftc->dft_buffersize;
+
     ft_gui_running(fts.length);
 }
 
+/* Returns the difference between two times, in seconds. */
+static double
+tv_diff(const struct timeval *t1, const struct timeval *t0)
+{
+    return (double)(t1->tv_sec - t0->tv_sec) +
+	(double)(t1->tv_usec - t0->tv_usec) / 1.0e6;
+}
+
+/* Returns the elapsed time of the current or most recent transfer. */
+double
+ft_stats_elapsed(void)
+{
+    struct timeval t1;
+
+    if (ft_state == FT_NONE) {
+	return tv_diff(&t_end, &t0);
+    }
+    gettimeofday(&t1, NULL);
+    return tv_diff(&t1, &t0);
+}
+
+/* Account for local file I/O that began at 'start'. */
+void
+ft_stats_disk(const struct timeval *start)
+{
+    struct timeval t1;
+
+    gettimeofday(&t1, NULL);
+    ft_stats.disk_time += tv_diff(&t1, start);
+}
+
+/* Note that the host has sent transfer data, ending a round trip. */
+void
+ft_stats_host_data(void)
+{
+    struct timeval t1;
+    double rtt;
+
+    if (!reply_pending) {
+	return;
+    }
+    reply_pending = false;
+    gettimeofday(&t1, NULL);
+    rtt = tv_diff(&t1, &t_reply);
+    ft_stats.rtt_count++;
+    ft_stats.rtt_total += rtt;
+    if (rtt > ft_stats.rtt_max) {
+	ft_stats.rtt_max = rtt;
+    }
+}
+
+/* Note that a reply has been sent to the host, starting a round trip. */
+void
+ft_stats_replied(void)
+{
+    if (ft_state != FT_NONE) {
+	gettimeofday(&t_reply, NULL);
+	reply_pending = true;
+    }
+}
+
+/* Query for the transfer statistics. */
+static const char *
+ft_query_stats(void)
+{
+    double elapsed;
+
+    if (!stats_valid) {
+	return NULL;
+    }
+    elapsed = ft_stats_elapsed();
+    return lazyaf("state %s mode %s bytes %lu seconds %.3f bytes-per-sec %.0f "
+	    "blocks %lu rtt-ms %.1f rtt-max-ms %.1f retransmits %lu "
+	    "disk-ms %.1f buffer-size %lu%s",
+	    (ft_state == FT_NONE)? "complete": "running",
+	    fts.is_cut? "CUT": "DFT",
+	    (unsigned long)fts.length,
+	    elapsed,
+	    (elapsed > 0.0)? (double)fts.length / elapsed: 0.0,
+	    ft_stats.blocks,
+	    ft_stats.rtt_count?
+		(ft_stats.rtt_total * 1000.0) / ft_stats.rtt_count: 0.0,
+	    ft_stats.rtt_max * 1000.0,
+	    ft_stats.retransmits,
+	    ft_stats.disk_time * 1000.0,
+	    (unsigned long)ft_stats.buffer_size,
+	    ckpt.valid? lazyaf(" checkpoint %lu", ckpt.offset): "");
+}
+
 /* Process a protocol-generated abort. */
 void
 ft_aborting(void)
@@ -570,6 +876,9 @@ ft_connected(bool ignored _is_unused)
     if (!CONNECTED && ft_state != FT_NONE) {
 	ft_complete(get_message("ftDisconnected"));
     }
+    if (!CONNECTED) {
+	dft_auto_conn_size = -1;
+    }
 }
 
 /* Process an abort from no longer being in 3270 mode. */
@@ -619,6 +928,7 @@ ft_go(ft_conf_t *p, enum iaction cause)
     FILE *f;
     varbuf_t r;
     unsigned flen;
+    unsigned long resume_offset;
 
     /* Adjust the DFT buffer size. */
     p->dft_buffersize = set_dft_buffersize(p->dft_buffersize);
@@ -643,6 +953,57 @@ ft_go(ft_conf_t *p, enum iaction cause)
 	return NULL;
     }
 
+    /* Binary uploads are read straight out of a mapping of the file. */
+    if (p->receive_flag || p->ascii_flag || !ft_map(f)) {
+	/*
+	 * Buffer two DFT blocks' worth of the local file, so the disk is
+	 * touched once every other block, and tell the system the file will
+	 * be read sequentially, so it can read ahead while the host is busy.
+	 */
+	Replace(fts.local_buf, Malloc(2 * p->dft_buffersize));
+	setvbuf(f, fts.local_buf, _IOFBF, 2 * p->dft_buffersize);
+#if defined(POSIX_FADV_SEQUENTIAL) /*[*/
+	if (!p->receive_flag) {
+	    posix_fadvise(fileno(f), 0, 0, POSIX_FADV_SEQUENTIAL);
+	}
+#endif /*]*/
+    }
+
+    /*
+     * Pick up where an earlier attempt at the same upload left off, or
+     * start a new checkpoint.
+     */
+    resume_offset = 0;
+    if (!p->receive_flag && !p->ascii_flag) {
+	if (p->resume_flag && ckpt.valid &&
+		!strcmp(ckpt.host_filename, p->host_filename) &&
+		!strcmp(ckpt.local_filename, fts.resolved_local_filename) &&
+		ckpt.host_type == p->host_type) {
+	    resume_offset = ckpt.offset;
+	    if ((fts.map != NULL && resume_offset > fts.map_len) ||
+		(fts.map == NULL &&
+		 fseek(f, (long)resume_offset, SEEK_SET) < 0)) {
+		popup_an_error(AnTransfer "(): Cannot resume '%s' at offset "
+			"%lu", fts.resolved_local_filename, resume_offset);
+		ft_unmap();
+		Replace(fts.local_buf, NULL);
+		fclose(f);
+		return NULL;
+	    }
+	    fts.map_offset = (size_t)resume_offset;
+	    vtrace("Transfer resuming at offset %lu\n", resume_offset);
+	} else if (p->resume_flag) {
+	    vtrace("Transfer has no checkpoint to resume, starting over\n");
+	}
+	ckpt.valid = true;
+	Replace(ckpt.host_filename, NewString(p->host_filename));
+	Replace(ckpt.local_filename, NewString(fts.resolved_local_filename));
+	ckpt.host_type = p->host_type;
+	ckpt.offset = resume_offset;
+    } else {
+	ckpt.valid = false;
+    }
+
     /* Build the ind$file command */
     vb_init(&r);
     vb_appendf(&r, "IND\\e005BFILE %s %s %s",
@@ -659,7 +1020,7 @@ ft_go(ft_conf_t *p, enum iaction cause)
     } else if (p->host_type == HT_CICS) {
 	vb_appends(&r, " NOCRLF");
     }
-    if (p->append_flag && !p->receive_flag) {
+    if ((p->append_flag || resume_offset) && !p->receive_flag) {
 	vb_appends(&r, " APPEND");
     }
     if (!p->receive_flag) {
@@ -735,6 +1096,8 @@ ft_go(ft_conf_t *p, enum iaction cause)
     flen = kybd_prime();
     if (!flen || flen < vb_len(&r) - 1) {
 	vb_free(&r);
+	ft_unmap();
+	Replace(fts.local_buf, NULL);
 	if (f != NULL) {
 	    fclose(f);
 	    if (p->receive_flag && !p->append_flag) {
@@ -760,9 +1123,168 @@ ft_go(ft_conf_t *p, enum iaction cause)
     ft_cause = cause;
     idle_ft_start();
 
+    /* Start the statistics. */
+    memset(&ft_stats, 0, sizeof(ft_stats));
+    gettimeofday(&t0, NULL);
+    fts.length = 0;
+    reply_pending = false;
+    stats_valid = true;
+
+    if (p->ascii_flag && p->remap_flag) {
+	ft_xlate_init();
+    }
+
     return f;
 }
 
+/*
+ * Map the local file for reading.
+ * Returns true if it was mapped; on failure, the caller falls back to stdio.
+ */
+static bool
+ft_map(FILE *f)
+{
+#if !defined(_WIN32) /*[*/
+    struct stat s;
+    void *map;
+
+    if (fstat(fileno(f), &s) < 0 || !S_ISREG(s.st_mode) || s.st_size <= 0 ||
+	    (unsigned long long)s.st_size > (size_t)-1) {
+	return false;
+    }
+    map = mmap(NULL, (size_t)s.st_size, PROT_READ, MAP_PRIVATE, fileno(f), 0);
+    if (map == MAP_FAILED) {
+	vtrace("mmap(%s): %s\n", fts.resolved_local_filename,
+		strerror(errno));
+	return false;
+    }
+# if defined(MADV_SEQUENTIAL) /*[*/
+    madvise(map, (size_t)s.st_size, MADV_SEQUENTIAL);
+# endif /*]*/
+    fts.map = map;
+    fts.map_len = (size_t)s.st_size;
+    fts.map_offset = 0;
+    return true;
+#else /*][*/
+    return false;
+#endif /*]*/
+}
+
+/* Unmap the local file. */
+static void
+ft_unmap(void)
+{
+#if !defined(_WIN32) /*[*/
+    if (fts.map != NULL) {
+	munmap(fts.map, fts.map_len);
+    }
+#endif /*]*/
+    fts.map = NULL;
+    fts.map_len = 0;
+    fts.map_offset = 0;
+}
+
+/*
+ * Build the bulk translation tables for the current transfer.
+ *
+ * Host-to-local entries follow the SBCS case of the per-character code in
+ * ft_dft.c and ft_cut.c; SO starts a DBCS subfield and is left to that code.
+ * Local-to-host entries cover the bytes that form a complete character on
+ * their own in the local code page and map to an SBCS host character.
+ */
+static void
+ft_xlate_init(void)
+{
+    int c;
+
+    for (c = 0; c < 256; c++) {
+	char mb[16];
+	size_t nx;
+	int consumed;
+	enum me_fail error = ME_NONE;
+	ucs4_t u;
+	ebc_t e;
+
+	/* Host to local. */
+	if (c == EBC_so) {
+	    ft_xlate.from_host_len[c] = FT_XLATE_SLOW;
+	} else {
+	    if (c < 0x20 || (c >= 0x80 && c < 0xa0 && c != 0x9f)) {
+		nx = ft_unicode_to_multibyte(c, mb, sizeof(mb));
+	    } else if (c == 0xff) {
+		nx = ft_unicode_to_multibyte(0x9f, mb, sizeof(mb));
+	    } else {
+		nx = ft_ebcdic_to_multibyte(i_asc2ft[c], mb, sizeof(mb));
+	    }
+	    if (nx && mb[nx - 1] == '\0') {
+		nx--;
+	    }
+	    if (nx <= FT_XLATE_MAX) {
+		memcpy(ft_xlate.from_host[c], mb, nx);
+		ft_xlate.from_host_len[c] = (unsigned char)nx;
+	    } else {
+		ft_xlate.from_host_len[c] = FT_XLATE_SLOW;
+	    }
+	}
+
+	/* Local to host. */
+	ft_xlate.to_host[c] = -1;
+	mb[0] = (char)c;
+	u = ft_multibyte_to_unicode(mb, 1, &consumed, &error);
+	if (error != ME_NONE || consumed != 1) {
+	    continue;
+	}
+	if (u < 0x20 || ((u >= 0x80 && u < 0x9f))) {
+	    e = i_asc2ft[u];
+	} else if (u == 0x9f) {
+	    e = 0xff;
+	} else {
+	    e = unicode_to_ebcdic(u);
+	}
+	if (!(e & 0xff00)) {
+	    ft_xlate.to_host[c] = e? i_ft2asc[e]: '?';
+	}
+    }
+}
+
+/*
+ * Ask the system to start reading the next part of the local file for an
+ * upload, so it is in memory by the time the host asks for it.
+ */
+void
+ft_prefetch(size_t len)
+{
+#if defined(POSIX_FADV_WILLNEED) /*[*/
+    long offset;
+
+    if (fts.local_file != NULL && fts.map == NULL &&
+	    (offset = ftell(fts.local_file)) >= 0) {
+	posix_fadvise(fileno(fts.local_file), (off_t)offset, (off_t)len,
+		POSIX_FADV_WILLNEED);
+    }
+#endif /*]*/
+}
+
+/*
+ * Record that the host has accepted everything read from the local file
+ * so far, less 'pending' bytes that were read but not yet sent. Called when
+ * the host asks for the next block of an upload.
+ */
+void
+ft_checkpoint(size_t pending)
+{
+    long offset;
+
+    if (!ckpt.valid || fts.local_file == NULL) {
+	return;
+    }
+    if (fts.map != NULL) {
+	ckpt.offset = fts.map_offset - pending;
+    } else if ((offset = ftell(fts.local_file)) >= 0) {
+	ckpt.offset = (unsigned long)offset - pending;
+    }
+}
+
 /*
  * Parse the keywords for the Transfer() action.
  *
@@ -924,6 +1446,9 @@ parse_ft_keywords(unsigned argc, const char **argv)
     if (tp[PARM_AVBLOCK].value) {
 	p->avblock = atoi(tp[PARM_AVBLOCK].value);
     }
+    if (tp[PARM_RESUME].value) {
+	p->resume_flag = !strcasecmp(tp[PARM_RESUME].value, "yes");
+    }
 #if defined(_WIN32) /*[*/
     if (tp[PARM_WINDOWS_CODEPAGE].value != NULL) {
 	p->windows_codepage = atoi(tp[PARM_WINDOWS_CODEPAGE].value);
@@ -959,6 +1484,11 @@ parse_ft_keywords(unsigned argc, const char **argv)
 	popup_an_error(AnTransfer "(): 'Cr' is only for ASCII transfers");
 	return NULL;
     }
+    if (p->resume_flag && (p->receive_flag || p->ascii_flag)) {
+	popup_an_error(AnTransfer "(): 'Resume' is only for sending binary "
+		"files");
+	return NULL;
+    }
     if (tp[PARM_REMAP].value && !p->ascii_flag) {
 	popup_an_error(AnTransfer "(): 'Remap' is only for ASCII transfers");
 	return NULL;
@@ -45,6 +45,7 @@
 #include "unicodec.h"
 #include "ft.h"
 #include "names.h"
+#include "stats.h"
 #include "tables.h"
 #include "trace.h"
 #include "utils.h"
@@ -197,6 +198,17 @@ upload_convert(unsigned char *buf, int len, unsigned char *obuf,
 	    continue;
 	}
 
+	/* Most characters translate through the table. */
+	if (fts.dbcs_state == FT_DBCS_NONE &&
+		ft_xlate.from_host_len[c] != FT_XLATE_SLOW &&
+		ft_xlate.from_host_len[c] <= obuf_len) {
+	    nx = ft_xlate.from_host_len[c];
+	    memcpy(ob, ft_xlate.from_host[c], nx);
+	    ob += nx;
+	    obuf_len -= nx;
+	    continue;
+	}
+
 	/*
 	 * Convert to local multi-byte.
 	 * We do that by inverting the host's EBCDIC-to-ASCII map,
@@ -340,6 +352,14 @@ download_convert(unsigned const char *buf, unsigned len, unsigned char *xobuf)
 	    continue;
 	}
 
+	/* Most characters translate through the table. */
+	if (!fts.last_dbcs && ft_xlate.to_host[c] >= 0) {
+	    ob += store_download((unsigned char)ft_xlate.to_host[c], ob);
+	    buf++;
+	    len--;
+	    continue;
+	}
+
 	/*
 	 * Translate.
 	 *
@@ -391,6 +411,7 @@ download_convert(unsigned const char *buf, unsigned len, unsigned char *xobuf)
 void
 ft_cut_data(void)
 {
+    ft_stats_host_data();
     switch (ea_buf[O_FRAME_TYPE].ec) {
     case FT_CONTROL_CODE:
 	cut_control_code();
@@ -409,6 +430,9 @@ ft_cut_data(void)
 	cut_abort(get_message("ftCutUnknownFrame"), SC_ABORT_XMIT);
 	break;
     }
+
+    /* Any reply has been sent now. */
+    ft_stats_replied();
 }
 
 /*
@@ -501,6 +525,7 @@ cut_data_request(void)
     int c;
     int i;
     unsigned char attr;
+    struct timeval t_disk;
 
     trace_ds("< FT DATA_REQUEST %u\n", from6(seq));
     if (ft_state == FT_ABORT_WAIT) {
@@ -508,8 +533,15 @@ cut_data_request(void)
 	return;
     }
 
+    /*
+     * Asking for more means the host has stored what we sent before. A byte
+     * whose translation is still partly buffered goes again on a resume.
+     */
+    ft_checkpoint(xlate_buffered? 1: 0);
+
     /* Copy data into the screen buffer. */
     count = 0;
+    gettimeofday(&t_disk, NULL);
     while (count < O_UP_MAX && !cut_eof) {
 	if ((c = xlate_getc()) == EOF) {
 	    cut_eof = true;
@@ -518,6 +550,9 @@ cut_data_request(void)
 	ctlr_add(O_UP_DATA + count, c, 0);
 	count++;
     }
+    ft_stats_disk(&t_disk);
+    ft_stats.blocks++;
+    stats_inc(STAT_FT_BLOCKS);
 
     /* Check for errors. */
     if (ferror(fts.local_file)) {
@@ -572,6 +607,7 @@ static void
 cut_retransmit(void)
 {
     trace_ds("< FT RETRANSMIT\n");
+    ft_stats.retransmits++;
     cut_abort(get_message("ftCutRetransmit"), SC_ABORT_XMIT);
 }
 
@@ -602,6 +638,8 @@ cut_data(void)
     unsigned short raw_length;
     int conv_length;
     register int i;
+    struct timeval t_disk;
+    size_t rv;
 
     trace_ds("< FT DATA\n");
     if (ft_state == FT_ABORT_WAIT) {
@@ -631,7 +669,12 @@ cut_data(void)
     }
 
     /* Write it to the file. */
-    if (fwrite((char *)cvobuf, conv_length, 1, fts.local_file) == 0) {
+    ft_stats.blocks++;
+    stats_inc(STAT_FT_BLOCKS);
+    gettimeofday(&t_disk, NULL);
+    rv = fwrite((char *)cvobuf, conv_length, 1, fts.local_file);
+    ft_stats_disk(&t_disk);
+    if (rv == 0) {
 	char *msg;
 
 	msg = xs_buffer("write(%s): %s", ftc->local_filename, strerror(errno));
@@ -734,9 +777,14 @@ xlate_getc(void)
 
     } else {
 	/* Binary, just read it. */
-	c = fgetc(fts.local_file);
-	if (c == EOF)
-		return c;
+	if (fts.map != NULL) {
+	    if (fts.map_offset >= fts.map_len) {
+		return EOF;
+	    }
+	    c = fts.map[fts.map_offset++];
+	} else if ((c = fgetc(fts.local_file)) == EOF) {
+	    return c;
+	}
 	mb[0] = c;
 	mb_len = 1;
 	nc = 0;
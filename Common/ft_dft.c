@@ -43,6 +43,7 @@
 #include "ft_private.h"
 #include "unicodec.h"
 #include "ft.h"
+#include "stats.h"
 #include "telnet_core.h"
 #include "trace.h"
 #include "utils.h"
@@ -99,6 +100,7 @@ ft_dft_data(unsigned char *data, int length _is_unused)
 	trace_ds(" (no transfer in progress)\n");
 	return;
     }
+    ft_stats_host_data();
 
     /* Get the length. */
     cp = (unsigned char *)(data_bufr->sf_length);
@@ -132,6 +134,9 @@ ft_dft_data(unsigned char *data, int length _is_unused)
 	trace_ds(" Unsupported(0x%04x)\n", data_type);
 	break;
     }
+
+    /* Any reply has been sent now. */
+    ft_stats_replied();
 }
 
 /* Process an Open request. */
@@ -283,6 +288,11 @@ dft_data_insert(struct data_buffer *data_bufr)
     /* Process file data. */
     if (my_length > 0) {
 	size_t rv = 1;
+	struct timeval t_disk;
+
+	ft_stats.blocks++;
+	stats_inc(STAT_FT_BLOCKS);
+	gettimeofday(&t_disk, NULL);
 
 	/* Write the data out to the file. */
 	if (ftc->ascii_flag && (ftc->remap_flag || ftc->cr_flag)) {
@@ -308,6 +318,17 @@ dft_data_insert(struct data_buffer *data_bufr)
 		    continue;
 		}
 
+		/* Most characters translate through the table. */
+		if (fts.dbcs_state == FT_DBCS_NONE &&
+			ft_xlate.from_host_len[c] != FT_XLATE_SLOW &&
+			ft_xlate.from_host_len[c] <= obuf_len) {
+		    nx = ft_xlate.from_host_len[c];
+		    memcpy(ob, ft_xlate.from_host[c], nx);
+		    ob += nx;
+		    obuf_len -= nx;
+		    continue;
+		}
+
 		/*
 		 * Convert to local multi-byte.
 		 * We do that by inverting the host's
@@ -390,6 +411,7 @@ dft_data_insert(struct data_buffer *data_bufr)
 		    fts.local_file);
 	    fts.length += my_length;
 	}
+	ft_stats_disk(&t_disk);
 
 	if (!rv) {
 	    /* write failed */
@@ -468,6 +490,28 @@ dft_ascii_read(unsigned char *bufptr, size_t numbytes)
 	return nm;
     }
 
+    /*
+     * Translate a run of characters that map on their own through the
+     * table, stopping at anything that needs NL expansion or the full
+     * treatment.
+     */
+    if (ftc->remap_flag && !fts.last_dbcs) {
+	size_t n = 0;
+
+	while (n < numbytes && (c = getc(fts.local_file)) != EOF) {
+	    if (ft_xlate.to_host[c] < 0 ||
+		    (c == '\n' && ftc->cr_flag && !fts.last_cr)) {
+		ungetc(c, fts.local_file);
+		break;
+	    }
+	    bufptr[n++] = (unsigned char)ft_xlate.to_host[c];
+	    fts.last_cr = (c == '\r');
+	}
+	if (n) {
+	    return n;
+	}
+    }
+
     if (ftc->remap_flag) {
 	/* Read bytes until we have a legal multibyte sequence. */
 	do {
@@ -570,6 +614,7 @@ dft_get_request(void)
     size_t numread;
     size_t total_read = 0;
     unsigned char *bufptr;
+    struct timeval t_disk;
 
     trace_ds(" Get\n");
 
@@ -578,11 +623,15 @@ dft_get_request(void)
 	return;
     }
 
+    /* Asking for more means the host has stored what we sent before. */
+    ft_checkpoint(0);
+
     /* Read a buffer's worth. */
     space3270out(ftc->dft_buffersize);
     numbytes = ftc->dft_buffersize - 27; /* always read 5 bytes less than we're
 				            allowed */
     bufptr = obuf + 17;
+    gettimeofday(&t_disk, NULL);
     while (!dft_eof && numbytes) {
 	if (ftc->ascii_flag && (ftc->remap_flag || ftc->cr_flag)) {
 	    numread = dft_ascii_read(bufptr, numbytes);
@@ -593,6 +642,21 @@ dft_get_request(void)
 	    bufptr += numread;
 	    numbytes -= numread;
 	    total_read += numread;
+	} else if (fts.map != NULL) {
+	    /* Binary read from the mapping. */
+	    numread = fts.map_len - fts.map_offset;
+	    if (numread > numbytes) {
+		numread = numbytes;
+	    }
+	    memcpy(bufptr, fts.map + fts.map_offset, numread);
+	    fts.map_offset += numread;
+	    bufptr += numread;
+	    numbytes -= numread;
+	    total_read += numread;
+	    if (fts.map_offset >= fts.map_len) {
+		dft_eof = true;
+	    }
+	    break;
 	} else {
 	    /* Binary read. */
 	    numread = fread(bufptr, 1, numbytes, fts.local_file);
@@ -611,6 +675,8 @@ dft_get_request(void)
 	}
     }
 
+    ft_stats_disk(&t_disk);
+
     /* Check for read error. */
     if (ferror(fts.local_file)) {
 	char *buf;
@@ -621,6 +687,11 @@ dft_get_request(void)
 	return;
     }
 
+    /* Start reading the next block while this one is on its way. */
+    if (!dft_eof) {
+	ft_prefetch(2 * ftc->dft_buffersize);
+    }
+
     /* Set up SF header for Data or EOF. */
     obptr = obuf;
     *obptr++ = AID_SF;
@@ -634,6 +705,8 @@ dft_get_request(void)
 	SET16(obptr, TR_RECNUM_HDR);
 	SET32(obptr, recnum);
 	recnum++;
+	ft_stats.blocks++;
+	stats_inc(STAT_FT_BLOCKS);
 	SET16(obptr, TR_NOT_COMPRESSED);
 	*obptr++ = TR_BEGIN_DATA;
 	SET16(obptr, total_read + 5);
@@ -730,11 +803,13 @@ set_dft_buffersize(int size)
 {
     /*
      * Pick the default:
+     * - Size learned by ftBufferAuto
      * - New resource
      * - Old resource
      * - Hard-coded default
      */
-    if (!size && !(size = appres.ft.dft_buffer_size)) {
+    if (!size && !(size = ft_auto_buffersize()) &&
+	    !(size = appres.ft.dft_buffer_size)) {
 	size = DFT_BUF;
     }
 
@@ -474,6 +474,13 @@ set_appres_defaults(void)
     appres.bind_limit = true;
     appres.new_environ = true;
     appres.max_recent = 5;
+    appres.net_read_budget = NET_READ_BUDGET;
+    appres.nvt_save_size = NVT_SAVE_SIZE;
+    appres.screentrace.queue = SCREENTRACE_QUEUE;
+    appres.dns_cache_ttl = DNS_CACHE_TTL;
+    appres.latency_dscp = LATENCY_DSCP;
+    appres.alt_buffer_release = ALT_BUFFER_RELEASE;
+    appres.reconnect_max_delay = RECONNECT_MAX_DELAY;
 
     appres.ft.dft_buffer_size = DFT_BUF;
 
@@ -490,6 +497,8 @@ set_appres_defaults(void)
 
     appres.unlock_delay = false;
     appres.unlock_delay_ms = 350;
+    appres.settle_time_ms = SETTLE_TIME_MS;
+    appres.key_latency_sample = KEY_LATENCY_SAMPLE;
 
     set_toggle(AID_WAIT, true);
     set_toggle(TYPEAHEAD, true);
@@ -568,6 +577,8 @@ static opt_t base_opts[] = {
     "<name>", "Send <name> as TELNET terminal name" },
 { OptTrace,    OPT_BOOLEAN, true,  ResTrace,     toggle_aoffset(TRACING),
     NULL, "Enable tracing" },
+{ OptTraceBinary,OPT_BOOLEAN,true,ResTraceBinary,aoffset(trace_binary),
+    NULL, "Write traces in binary form" },
 { OptTraceFile,OPT_STRING,  false, ResTraceFile, aoffset(trace_file),
     "<file>", "Write traces to <file>" },
 { OptTraceFileSize,OPT_STRING,false,ResTraceFileSize,aoffset(trace_file_size),
@@ -1036,6 +1047,8 @@ parse_model_number(char *m)
 
 static res_t base_resources[] = {
     { ResAlias,		aoffset(alias),		XRM_STRING },
+    { ResAllocAccounting,aoffset(alloc_accounting),	XRM_BOOLEAN },
+    { ResAltBufferRelease,aoffset(alt_buffer_release),	XRM_INT },
     { ResBindLimit,	aoffset(bind_limit),	XRM_BOOLEAN },
     { ResBindUnlock,	aoffset(bind_unlock),	XRM_BOOLEAN },
     { ResBsdTm,		aoffset(bsd_tm),		XRM_BOOLEAN },
@@ -1047,11 +1060,15 @@ static res_t base_resources[] = {
     { ResConsole,aoffset(interactive.console),	XRM_STRING },
     { ResDbcsCgcsgid, aoffset(dbcs_cgcsgid),	XRM_STRING },
     { ResDevName,	aoffset(devname),	XRM_STRING },
+    { ResDnsCacheTtl,	aoffset(dns_cache_ttl),	XRM_INT },
     { ResEof,		aoffset(linemode.eof),	XRM_STRING },
     { ResErase,		aoffset(linemode.erase),	XRM_STRING },
+    { ResEventProfileMs,aoffset(event_profile_ms),	XRM_INT },
+    { ResForceScalar,	aoffset(force_scalar),	XRM_BOOLEAN },
     { ResFtAllocation,	aoffset(ft.allocation),	XRM_STRING },
     { ResFtAvblock,	aoffset(ft.avblock),	XRM_INT },
     { ResFtBlksize,	aoffset(ft.blksize),	XRM_INT },
+    { ResFtBufferAuto,aoffset(ft.dft_buffer_auto),XRM_BOOLEAN },
     { ResFtBufferSize,aoffset(ft.dft_buffer_size),XRM_INT },
 #if defined(_WIN32) /*[*/
     { ResFtWindowsCodePage,aoffset(ft.codepage),XRM_INT },
@@ -1068,6 +1085,7 @@ static res_t base_resources[] = {
     { ResFtRecfm,	aoffset(ft.recfm),	XRM_STRING },
     { ResFtRemap,	aoffset(ft.remap),	XRM_STRING },
     { ResFtSecondarySpace,aoffset(ft.secondary_space),XRM_INT },
+    { ResHibernateSeconds,aoffset(hibernate_seconds),XRM_INT },
     { ResHostname,	aoffset(hostname),	XRM_STRING },
     { ResHostsFile,	aoffset(hostsfile),	XRM_STRING },
     { ResHttpd,		aoffset(httpd_port),		XRM_STRING },
@@ -1075,7 +1093,11 @@ static res_t base_resources[] = {
     { ResInlcr,		aoffset(linemode.inlcr),	XRM_BOOLEAN },
     { ResOnlcr,		aoffset(linemode.onlcr),	XRM_BOOLEAN },
     { ResIntr,		aoffset(linemode.intr),	XRM_STRING },
+    { ResKeyLatencySample,aoffset(key_latency_sample),XRM_INT },
     { ResKill,		aoffset(linemode.kill),	XRM_STRING },
+    { ResLatencyBusyPoll,aoffset(latency_busy_poll),XRM_INT },
+    { ResLatencyDscp,aoffset(latency_dscp),	XRM_INT },
+    { ResLatencyKeepalive,aoffset(latency_keepalive),XRM_STRING },
     { ResLnext,		aoffset(linemode.lnext),	XRM_STRING },
 #if defined(_WIN32) /*[*/
     { ResLocalCp,	aoffset(local_cp),	XRM_INT },
@@ -1084,37 +1106,58 @@ static res_t base_resources[] = {
     { ResMacros,	aoffset(macros),	XRM_STRING },
     { ResModel,	aoffset(model),			XRM_STRING },
     { ResModifiedSel, aoffset(modified_sel),	XRM_BOOLEAN },
+    { ResNetReadBudget,aoffset(net_read_budget),XRM_INT },
     { ResNewEnviron,aoffset(new_environ),	XRM_BOOLEAN },
     { ResNopSeconds,aoffset(nop_seconds),	XRM_INT },
     { ResNoTelnetInputMode,aoffset(interactive.no_telnet_input_mode),
 	XRM_STRING },
     { ResNumericLock, aoffset(numeric_lock),	XRM_BOOLEAN },
+    { ResNvtSaveSize,aoffset(nvt_save_size),	XRM_INT },
     { ResOerrLock,	aoffset(oerr_lock),	XRM_BOOLEAN },
+    { ResOutputCork,	aoffset(output_cork),	XRM_BOOLEAN },
     { ResOversize,	aoffset(oversize),	XRM_STRING },
     { ResPort,	aoffset(port),			XRM_STRING },
 #if defined(_WIN32) /*[*/
     { ResPrintDialog,	aoffset(interactive.print_dialog), XRM_BOOLEAN },
 #endif /*]*/
     { ResProxy,		aoffset(proxy),		XRM_STRING },
+    { ResProxyLocalDns,aoffset(proxy_local_dns),XRM_BOOLEAN },
     { ResQrBgColor,	aoffset(qr_bg_color),	XRM_BOOLEAN },
     { ResQuit,		aoffset(linemode.quit),	XRM_STRING },
+    { ResReconnectMaxDelay,aoffset(reconnect_max_delay),XRM_INT },
     { ResRprnt,		aoffset(linemode.rprnt),	XRM_STRING },
+    { ResScreenHistory,aoffset(screen_history),XRM_INT },
+    { ResScreenTraceCompress,aoffset(screentrace.compress),XRM_STRING },
+    { ResScreenTraceDedup,aoffset(screentrace.dedup),XRM_BOOLEAN },
+    { ResScreenTraceDelta,aoffset(screentrace.delta),XRM_BOOLEAN },
+    { ResScreenTraceDrop,aoffset(screentrace.drop),XRM_STRING },
     { ResScreenTraceFile,aoffset(screentrace.file),XRM_STRING },
+    { ResScreenTraceQueue,aoffset(screentrace.queue),XRM_INT },
     { ResScreenTraceTarget,aoffset(screentrace.target),XRM_STRING },
     { ResScreenTraceType,aoffset(screentrace.type),XRM_STRING },
     { ResSecure,	aoffset(secure),		XRM_BOOLEAN },
     { ResSbcsCgcsgid, aoffset(sbcs_cgcsgid),	XRM_STRING },
+    { ResSettleLearn,aoffset(settle_learn),	XRM_BOOLEAN },
+    { ResSettleTime,aoffset(settle_time_ms),	XRM_INT },
+    { ResShmExport,	aoffset(shm_export),	XRM_STRING },
+    { ResSpanFile,	aoffset(span_file),	XRM_STRING },
     { ResScriptPort,aoffset(script_port),	XRM_STRING },
     { ResScriptPortOnce,aoffset(script_port_once),	XRM_BOOLEAN },
     { ResSuppressActions,aoffset(suppress_actions),XRM_STRING },
     { ResTermName,	aoffset(termname),	XRM_STRING },
+    { ResTraceBinary,aoffset(trace_binary),	XRM_BOOLEAN },
+    { ResTraceCategories,aoffset(trace_categories),XRM_STRING },
     { ResTraceDir,	aoffset(trace_dir),	XRM_STRING },
     { ResTraceFile,	aoffset(trace_file),	XRM_STRING },
+    { ResTraceFileCompress,aoffset(trace_file_compress),XRM_STRING },
+    { ResTraceFileGenerations,aoffset(trace_file_generations),XRM_INT },
     { ResTraceFileSize,aoffset(trace_file_size),	XRM_STRING },
+    { ResTraceFileTotalSize,aoffset(trace_file_total_size),XRM_STRING },
     { ResTraceMonitor,aoffset(trace_monitor),	XRM_BOOLEAN },
     { ResUnlockDelay,aoffset(unlock_delay),	XRM_BOOLEAN },
     { ResUnlockDelayMs,aoffset(unlock_delay_ms),	XRM_INT },
-    { ResWerase,	aoffset(linemode.werase),XRM_STRING }
+    { ResWerase,	aoffset(linemode.werase),XRM_STRING },
+    { ResWriteCacheSize,aoffset(write_cache_size),XRM_INT }
 };
 
 typedef struct reslist {
@@ -0,0 +1,342 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *	hibernate.c
+ *		Idle session hibernation.
+ *
+ * When hibernateSeconds is set, a session that has had no host input and
+ * no actions for that long compresses its screen, scrollback and front-end
+ * buffers into one blob and frees them. The connection is kept up, with
+ * TELNET NOPs if nopSeconds is not already sending them. Host input, an
+ * action or any state change wakes the session again before anything looks
+ * at the buffers.
+ *
+ * Only front ends whose buffers are never touched between events (s3270
+ * and b3270) call hibernate_register(), so it is a no-op anywhere else.
+ */
+
+#include "globals.h"
+
+#include <assert.h>
+#include <time.h>
+
+#include "appres.h"
+#include "varbuf.h"	/* must precede hibernate.h */
+#include "hibernate.h"
+#include "kybd.h"
+#include "popups.h"
+#include "resources.h"
+#include "task.h"
+#include "telnet.h"
+#include "toggles.h"
+#include "trace.h"
+#include "utils.h"
+
+#define HIB_MAX		8	/* maximum number of hibernators */
+#define HIB_NOP_SECONDS	60	/* keepalive interval while hibernating */
+#define HIB_MAX_RUN	128	/* maximum elements in one packed run */
+
+bool hibernating = false;
+
+static struct {
+    hib_sleep_fn *sleep_fn;
+    hib_wake_fn *wake_fn;
+    varbuf_t blob;
+} hibernators[HIB_MAX];
+static int n_hibernators = 0;
+
+static bool registered = false;
+static time_t last_activity = 0;
+static ioid_t hib_id = NULL_IOID;
+static size_t packed_bytes = 0;
+static bool hib_nops = false;
+
+static void hib_schedule(void);
+
+/**
+ * Register a module's hibernation functions. Modules sleep in the reverse
+ * of the order they register, so a front end can still look at the
+ * controller's buffers when it goes to sleep, and wake in the order they
+ * register. Each has its own blob.
+ *
+ * @param[in] sleep_fn	function to compress and free buffers
+ * @param[in] wake_fn	function to restore them
+ */
+void
+register_hibernator(hib_sleep_fn *sleep_fn, hib_wake_fn *wake_fn)
+{
+    assert(n_hibernators < HIB_MAX);
+    hibernators[n_hibernators].sleep_fn = sleep_fn;
+    hibernators[n_hibernators].wake_fn = wake_fn;
+    n_hibernators++;
+}
+
+/**
+ * Pack an array into the blob, run-length encoded. Each run starts with a
+ * byte: 0x80 + n - 1 for n copies of one element, or n - 1 for n literal
+ * elements.
+ *
+ * @param[in,out] blob	blob to append to
+ * @param[in] data	array
+ * @param[in] elem_size	size of each element
+ * @param[in] count	number of elements
+ */
+void
+hib_pack(varbuf_t *blob, const void *data, size_t elem_size, size_t count)
+{
+    const char *d = (const char *)data;
+    size_t i = 0;
+
+    packed_bytes += elem_size * count;
+    while (i < count) {
+	size_t n = 1;
+	unsigned char hdr;
+
+	while (i + n < count && n < HIB_MAX_RUN &&
+		!memcmp(d + (i * elem_size), d + ((i + n) * elem_size),
+		    elem_size)) {
+	    n++;
+	}
+	if (n > 1) {
+	    hdr = 0x80 | (unsigned char)(n - 1);
+	    vb_append(blob, (char *)&hdr, 1);
+	    vb_append(blob, d + (i * elem_size), elem_size);
+	} else {
+	    /* Extend the literal until the next repeat. */
+	    while (i + n < count && n < HIB_MAX_RUN &&
+		    (i + n + 1 >= count ||
+		     memcmp(d + ((i + n) * elem_size),
+			 d + ((i + n + 1) * elem_size), elem_size))) {
+		n++;
+	    }
+	    hdr = (unsigned char)(n - 1);
+	    vb_append(blob, (char *)&hdr, 1);
+	    vb_append(blob, d + (i * elem_size), n * elem_size);
+	}
+	i += n;
+    }
+}
+
+/**
+ * Unpack an array packed by hib_pack().
+ *
+ * @param[in] blob	packed data
+ * @param[out] data	array
+ * @param[in] elem_size	size of each element
+ * @param[in] count	number of elements
+ *
+ * @return Next byte in the blob.
+ */
+const unsigned char *
+hib_unpack(const unsigned char *blob, void *data, size_t elem_size,
+	size_t count)
+{
+    char *d = (char *)data;
+    size_t i = 0;
+
+    while (i < count) {
+	unsigned char hdr = *blob++;
+	size_t n = (hdr & 0x7f) + 1;
+
+	if (hdr & 0x80) {
+	    size_t j;
+
+	    for (j = 0; j < n; j++) {
+		memcpy(d + ((i + j) * elem_size), blob, elem_size);
+	    }
+	    blob += elem_size;
+	} else {
+	    memcpy(d + (i * elem_size), blob, n * elem_size);
+	    blob += n * elem_size;
+	}
+	i += n;
+    }
+    return blob;
+}
+
+/* Put the session to sleep. */
+static void
+hib_sleep(void)
+{
+    size_t blob_bytes = 0;
+    int i;
+
+    packed_bytes = 0;
+    for (i = n_hibernators - 1; i >= 0; i--) {
+	vb_init(&hibernators[i].blob);
+	(*hibernators[i].sleep_fn)(&hibernators[i].blob);
+	blob_bytes += vb_len(&hibernators[i].blob);
+    }
+    hibernating = true;
+
+    /* Keep the connection alive. */
+    if (appres.nop_seconds == 0) {
+	appres.nop_seconds = HIB_NOP_SECONDS;
+	net_nop_seconds();
+	hib_nops = true;
+    }
+    vtrace("Hibernating: %lu bytes of buffers packed into %lu\n",
+	    (unsigned long)packed_bytes, (unsigned long)blob_bytes);
+}
+
+/* Wake the session up. */
+static void
+hib_wake(void)
+{
+    int i;
+
+    hibernating = false;
+    for (i = 0; i < n_hibernators; i++) {
+	(*hibernators[i].wake_fn)(
+		(const unsigned char *)vb_buf(&hibernators[i].blob));
+	vb_free(&hibernators[i].blob);
+    }
+    if (hib_nops) {
+	appres.nop_seconds = 0;
+	net_nop_seconds();
+	hib_nops = false;
+    }
+    vtrace("Awake\n");
+}
+
+/**
+ * Note activity: host input or an action. Wakes the session if it is
+ * hibernating.
+ */
+void
+hibernate_touch(void)
+{
+    if (hibernating) {
+	hib_wake();
+	hib_schedule();
+    }
+    last_activity = time(NULL);
+}
+
+/* Idle check timeout. */
+static void
+hib_check(ioid_t id _is_unused)
+{
+    hib_id = NULL_IOID;
+    if (hibernating || appres.hibernate_seconds <= 0) {
+	return;
+    }
+
+    /*
+     * Only a connected session with nothing pending sleeps: scripts waiting
+     * on the screen and a locked keyboard keep it awake.
+     */
+    if (time(NULL) - last_activity >= appres.hibernate_seconds &&
+	    CONNECTED && !kybdlock && !task_pending()) {
+	hib_sleep();
+	return;
+    }
+    hib_schedule();
+}
+
+/* Schedule the next idle check. */
+static void
+hib_schedule(void)
+{
+    time_t idle = time(NULL) - last_activity;
+    long secs;
+
+    if (hib_id != NULL_IOID) {
+	RemoveTimeOut(hib_id);
+	hib_id = NULL_IOID;
+    }
+    if (!registered || appres.hibernate_seconds <= 0) {
+	return;
+    }
+    secs = appres.hibernate_seconds - (long)idle;
+    if (secs < 1) {
+	secs = 1;
+    }
+    hib_id = AddTimeOutCoalesced(secs * 1000, 1000, hib_check);
+}
+
+/*
+ * Toggle the hibernation interval.
+ */
+static bool
+toggle_hibernate_seconds(const char *name _is_unused, const char *value)
+{
+    unsigned long l;
+    char *end;
+    int secs;
+
+    if (!*value) {
+	appres.hibernate_seconds = 0;
+	hib_schedule();
+	return true;
+    }
+
+    l = strtoul(value, &end, 10);
+    secs = (int)l;
+    if (*end != '\0' || (unsigned long)secs != l || secs < 0) {
+	popup_an_error("Invalid %s value", ResHibernateSeconds);
+	return false;
+    }
+    appres.hibernate_seconds = secs;
+    last_activity = time(NULL);
+    hib_schedule();
+    return true;
+}
+
+/*
+ * State change. Registered ahead of everything else, so the buffers are
+ * back before any other module reacts.
+ */
+static void
+hib_state(bool ignored _is_unused)
+{
+    hibernate_touch();
+    hib_schedule();
+}
+
+/**
+ * Hibernation module registration. Called by front ends that can
+ * hibernate.
+ */
+void
+hibernate_register(void)
+{
+    enum st st;
+
+    registered = true;
+    last_activity = time(NULL);
+
+    /* Register the toggle. */
+    register_extended_toggle(ResHibernateSeconds, toggle_hibernate_seconds,
+	    NULL, NULL, (void **)&appres.hibernate_seconds, XRM_INT);
+
+    /* Register the state change callbacks. */
+    for (st = 0; st < N_ST; st++) {
+	register_schange_ordered(st, hib_state, 0);
+    }
+}
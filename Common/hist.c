@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	hist.c
+ *		Log-linear histograms.
+ *
+ * Values are kept in buckets of 16 linear sub-buckets per power of two, so
+ * any recorded value is within about 6% of the true one, using a fixed
+ * number of counters regardless of the range. The bucket array is
+ * allocated with the first sample.
+ */
+
+#include "globals.h"
+
+#include "hist.h"
+
+#define SUB_BITS	HIST_SUB_BITS
+#define SUB_COUNT	(1 << SUB_BITS)
+#define MAX_EXP		HIST_MAX_EXP
+
+/* Map a sample to its bucket. */
+static unsigned
+bucket_of(unsigned long v)
+{
+    unsigned e;
+
+    if (v < SUB_COUNT) {
+	return (unsigned)v;
+    }
+    for (e = SUB_BITS; e < MAX_EXP && (v >> (e + 1)); e++) {
+    }
+    return ((e - SUB_BITS + 1) * SUB_COUNT) +
+	(unsigned)((v >> (e - SUB_BITS)) & (SUB_COUNT - 1));
+}
+
+/*
+ * Return the highest value that maps to a bucket.
+ */
+unsigned long
+hist_bucket_top(unsigned b)
+{
+    unsigned e;
+    unsigned long width;
+
+    if (b < SUB_COUNT) {
+	return b;
+    }
+    e = (b / SUB_COUNT) + SUB_BITS - 1;
+    width = 1UL << (e - SUB_BITS);
+    return ((SUB_COUNT + (b % SUB_COUNT)) * width) + width - 1;
+}
+
+/*
+ * Add a sample to a histogram.
+ */
+void
+hist_add(hist_t *h, unsigned long v)
+{
+    if (v > HIST_MAX_VALUE) {
+	v = HIST_MAX_VALUE;
+    }
+    if (h->buckets == NULL) {
+	h->buckets = (unsigned long *)Calloc(HIST_BUCKETS,
+		sizeof(unsigned long));
+    }
+    h->buckets[bucket_of(v)]++;
+    h->count++;
+    h->total += (double)v;
+    if (v > h->max) {
+	h->max = v;
+    }
+}
+
+/*
+ * Empty a histogram.
+ */
+void
+hist_clear(hist_t *h)
+{
+    Replace(h->buckets, NULL);
+    h->count = 0;
+    h->max = 0;
+    h->total = 0.0;
+}
+
+/*
+ * Find the value at a percentile.
+ */
+unsigned long
+hist_pct(const hist_t *h, unsigned pct)
+{
+    unsigned long want = ((h->count * pct) + 99) / 100;
+    unsigned long seen = 0;
+    unsigned b;
+
+    for (b = 0; b < HIST_BUCKETS; b++) {
+	seen += h->buckets[b];
+	if (seen >= want) {
+	    unsigned long top = hist_bucket_top(b);
+
+	    return (top < h->max)? top: h->max;
+	}
+    }
+    return h->max;
+}
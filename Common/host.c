@@ -41,11 +41,13 @@
 #include "boolstr.h"
 #include "host.h"
 #include "host_gui.h"
+#include "lazya.h"
 #include "login_macro.h"
 #include "names.h"
 #include "popups.h"
 #include "product.h"
 #include "split_host.h"
+#include "stats.h"
 #include "task.h"
 #include "telnet.h"
 #include "telnet_core.h"
@@ -59,6 +61,8 @@
 
 #define RECONNECT_MS		2000	/* 2 sec before reconnecting to host */
 #define RECONNECT_ERR_MS	5000	/* 5 sec before reconnecting to host */
+#define RECONNECT_MIN_MS	500	/* shortest reconnect delay */
+#define RECONNECT_STABLE_SECS	60	/* connection time that resets backoff */
 
 #define MAX_RECENT		20	/* upper limit on appres.max_recent */
 
@@ -79,14 +83,30 @@ enum iaction	connect_ia = IA_NONE;
 
 struct host *hosts = NULL;
 static struct host *last_host = NULL;
+
+/*
+ * Hash index of the hosts file entries, by name, for hostfile_lookup().
+ * Recent-host entries are not included.
+ */
+static struct host **host_hash = NULL;
+static unsigned host_hash_size = 0;	/* always a power of 2 */
+
+/* The last hosts file entry. The recent-host entries follow it. */
+static struct host *last_file_host = NULL;
 static iosrc_t net_sock = INVALID_IOSRC;
 static ioid_t reconnect_id = NULL_IOID;
+static unsigned reconnect_count = 0;	/* reconnects since a stable connection */
+static time_t connected_time = 0;	/* when the host connection was made */
 
 static char *host_ps = NULL;
+static char *qualified_name = NULL;	/* host name part of qualified_host */
+static char *qualified_port = NULL;	/* port part of qualified_host */
+static char *qualified_accept = NULL;	/* accept name, or NULL */
 
 static void save_recent(const char *);
 
 static void try_reconnect(ioid_t id);
+static unsigned long reconnect_delay(bool failed);
 
 static action_t Connect_action;
 static action_t Disconnect_action;
@@ -116,6 +136,52 @@ stoken(char **s)
     return r;
 }
 
+/* Hash a host name (FNV-1a). */
+static unsigned
+host_hash_name(const char *name)
+{
+    unsigned h = 2166136261U;
+    unsigned char c;
+
+    while ((c = (unsigned char)*name++) != '\0') {
+	h = (h ^ c) * 16777619U;
+    }
+    return h & (host_hash_size - 1);
+}
+
+/*
+ * Build the hash index of the hosts file entries.
+ * If a name appears more than once, the first entry is the one found.
+ */
+static void
+index_hosts(unsigned count)
+{
+    struct host *h;
+
+    host_hash_size = 64;
+    while (host_hash_size < count * 2) {
+	host_hash_size *= 2;
+    }
+    host_hash = (struct host **)Calloc(host_hash_size, sizeof(struct host *));
+    for (h = hosts; h != NULL; h = h->next) {
+	struct host **p;
+
+	if (h->entry_type == RECENT) {
+	    continue;
+	}
+	for (p = &host_hash[host_hash_name(h->name)]; *p != NULL;
+		p = &(*p)->hash_next) {
+	    if (!strcmp((*p)->name, h->name)) {
+		break;
+	    }
+	}
+	if (*p == NULL) {
+	    h->hash_next = NULL;
+	    *p = h;
+	}
+    }
+}
+
 /*
  * Read the hosts file.
  */
@@ -126,6 +192,7 @@ read_hosts_file(void)
     char buf[1024];
     struct host *h;
     char *hostfile_name;
+    unsigned count = 0;
 
     /* This only applies to emulators with displays. */
     if (!product_has_display()) {
@@ -144,9 +211,10 @@ read_hosts_file(void)
 	    char *s = buf;
 	    char *name, *entry_type, *hostname;
 	    char *slash;
+	    size_t sl = strlen(buf);
 
-	    if (strlen(buf) > (unsigned)1 && buf[strlen(buf) - 1] == '\n') {
-		buf[strlen(buf) - 1] = '\0';
+	    if (sl > 1 && buf[sl - 1] == '\n') {
+		buf[sl - 1] = '\0';
 	    }
 	    while (isspace((unsigned char)*s)) {
 		s++;
@@ -194,6 +262,7 @@ read_hosts_file(void)
 		hosts = h;
 	    }
 	    last_host = h;
+	    count++;
 	}
 	fclose(hf);
     } else if (appres.hostsfile != NULL) {
@@ -201,6 +270,8 @@ read_hosts_file(void)
 		appres.hostsfile);
     }
     Free(hostfile_name);
+    last_file_host = last_host;
+    index_hosts(count);
 
     /*
      * Read the recent-connection file, and prepend it to the hosts list.
@@ -237,6 +308,7 @@ host_set_flag(int flag)
 static void
 host_cancel_reconnect(void)
 {
+    reconnect_count = 0;
     if (reconnect_id != NULL_IOID) {
 	RemoveTimeOut(reconnect_id);
 	reconnect_id = NULL_IOID;
@@ -299,7 +371,9 @@ host_register(void)
 }
 
 /**
- * Read in the hosts file.
+ * Read in the hosts file, if it has not been read yet.
+ * This is done on the first Connect(), or earlier if a user interface needs
+ * the list of hosts.
  */
 void
 hostfile_init(void)
@@ -310,9 +384,8 @@ hostfile_init(void)
 	return;
     }
 
-    read_hosts_file();
-
     hostfile_initted = true;
+    read_hosts_file();
 }
 
 /*
@@ -325,10 +398,10 @@ hostfile_lookup(const char *name, char **hostname, char **loginstring)
     struct host *h;
 
     hostfile_init();
-    for (h = hosts; h != NULL; h = h->next) {
-	if (h->entry_type == RECENT) {
-	    continue;
-	}
+    if (host_hash == NULL) {
+	return 0;
+    }
+    for (h = host_hash[host_hash_name(name)]; h != NULL; h = h->hash_next) {
 	if (!strcmp(name, h->name)) {
 	    *hostname = h->hostname;
 	    if (h->loginstring != NULL) {
@@ -454,6 +527,7 @@ host_connect(const char *n, enum iaction ia)
     Replace(reconnect_host, NewString(nb));
 
     /* Remember this hostname in the recent connection list and file. */
+    hostfile_init();
     save_recent(nb);
 
 #if defined(LOCAL_PROCESS) /*[*/
@@ -523,6 +597,9 @@ host_connect(const char *n, enum iaction ia)
 		port,
 		(accept != NULL)? "=": "",
 		(accept != NULL)? accept: ""));
+    Replace(qualified_name, NewString(chost));
+    Replace(qualified_port, NewString(port));
+    Replace(qualified_accept, (accept != NULL)? NewString(accept): NULL);
 
     /* Attempt contact. */
     ever_3270 = false;
@@ -530,7 +607,8 @@ host_connect(const char *n, enum iaction ia)
     if (nc == NC_FAILED) {
 	if (!host_gui_connect()) {
 	    if (appres.interactive.reconnect) {
-		reconnect_id = AddTimeOut(RECONNECT_ERR_MS, try_reconnect);
+		reconnect_id = AddTimeOut(reconnect_delay(true),
+			try_reconnect);
 		change_cstate(RECONNECTING, "host_connect");
 	    }
 	}
@@ -649,6 +727,60 @@ host_continue_connect(iosrc_t iosrc, net_connect_t nc)
     }
 }
 
+/*
+ * Compute the delay before the next automatic reconnect.
+ *
+ * The ceiling starts at the fixed delay and doubles with each reconnect since
+ * the last stable connection, up to reconnectMaxDelay seconds. The delay is
+ * chosen at random below the ceiling, so sessions that lost the same host do
+ * not all retry in lockstep. A reconnectMaxDelay of 0 keeps the fixed delay.
+ */
+static unsigned long
+reconnect_delay(bool failed)
+{
+    unsigned long base = failed? RECONNECT_ERR_MS: RECONNECT_MS;
+    unsigned long max_ms = (unsigned long)appres.reconnect_max_delay * 1000UL;
+    unsigned long ceiling = base;
+    unsigned long delay;
+    unsigned i;
+    static bool seeded = false;
+
+    if (appres.reconnect_max_delay <= 0) {
+	return base;
+    }
+    if (!seeded) {
+	/* Mix in the process ID, so sessions started together differ. */
+#if defined(_WIN32) /*[*/
+	srand((unsigned int)time(NULL) ^ (unsigned int)GetCurrentProcessId());
+#else /*][*/
+	srandom((unsigned int)time(NULL) ^ ((unsigned int)getpid() << 8));
+#endif /*]*/
+	seeded = true;
+    }
+    if (max_ms < base) {
+	max_ms = base;
+    }
+    for (i = 0; i < reconnect_count && ceiling < max_ms; i++) {
+	ceiling *= 2;
+    }
+    if (ceiling > max_ms) {
+	ceiling = max_ms;
+    }
+#if defined(_WIN32) /*[*/
+    delay = (((unsigned long)rand() << 15) | (unsigned long)rand()) %
+	(ceiling + 1);
+#else /*][*/
+    delay = (unsigned long)random() % (ceiling + 1);
+#endif /*]*/
+    if (delay < RECONNECT_MIN_MS) {
+	delay = RECONNECT_MIN_MS;
+    }
+    reconnect_count++;
+    vtrace("Reconnect %u in %lu.%03lus\n", reconnect_count, delay / 1000,
+	    delay % 1000);
+    return delay;
+}
+
 /*
  * Reconnect to the last host.
  * Returns true if connection initiated, false otherwise.
@@ -671,6 +803,7 @@ try_reconnect(ioid_t id _is_unused)
     reconnect_id = NULL_IOID;
     assert(cstate == RECONNECTING);
     change_cstate(NOT_CONNECTED, "try_reconnect");
+    stats_inc(STAT_RECONNECTS);
 
     host_reconnect();
 }
@@ -685,12 +818,18 @@ host_disconnect(bool failed)
     x_remove_input();
     net_disconnect(true);
     net_sock = INVALID_IOSRC;
+
+    /* A connection that lasted a while starts the backoff over. */
+    if (connected_time != 0 &&
+	    time(NULL) - connected_time >= RECONNECT_STABLE_SECS) {
+	reconnect_count = 0;
+    }
+    connected_time = 0;
+
     if (!host_gui_disconnect()) {
 	if (appres.interactive.reconnect && reconnect_id == NULL_IOID) {
 	    /* Schedule an automatic reconnection. */
-	    reconnect_id = AddTimeOut(failed? RECONNECT_ERR_MS:
-					      RECONNECT_MS,
-		  try_reconnect);
+	    reconnect_id = AddTimeOut(reconnect_delay(failed), try_reconnect);
 	    change_cstate(RECONNECTING, "host_disconnect");
 	}
     }
@@ -720,6 +859,9 @@ void
 host_in3270(enum cstate new_cstate)
 {
     ever_3270 = cIN_3270(new_cstate);
+    if (connected_time == 0) {
+	connected_time = time(NULL);
+    }
     change_cstate(new_cstate, "host_in3270");
 }
 
@@ -784,7 +926,6 @@ static void
 save_recent(const char *hn)
 {
     struct host *h;
-    int nih = 0;
     struct host *r_start = NULL;
     char *lcf_name = NULL;
     FILE *lcf = NULL;
@@ -800,24 +941,14 @@ save_recent(const char *hn)
     }
 
     /*
-     * Copy the ibm_hosts into the array, and point r_start at the first
-     * recent-host entry.
+     * Point r_start at the first recent-host entry. The hosts file entries
+     * ahead of it do not change, so they stay where they are in the list.
      */
-    for (h = hosts; h != NULL; h = h->next) {
-	if (h->entry_type == RECENT) {
-	    r_start = h;
-	    break;
-	}
-
-	h_array = (struct host **)
-	    Realloc(h_array, (nh + 1) * sizeof(struct host *));
-	h_array[nh++] = h;
-	nih++;
-    }
+    r_start = (last_file_host != NULL)? last_file_host->next: hosts;
 
     /*
-     * Allocate a new entry and add it to the array, just under the
-     * ibm_hosts and before the first recent entry.
+     * Allocate a new entry and add it to the array, ahead of the existing
+     * recent entries.
      */
     if (hn != NULL) {
 	h = (struct host *)Malloc(sizeof(*h));
@@ -887,7 +1018,7 @@ save_recent(const char *hn)
 #if defined(CFDEBUG) /*[*/
     dump_array("before", h_array, nh);
 #endif /*]*/
-    qsort(h_array + nih, nh - nih, sizeof(struct host *), host_compare);
+    qsort(h_array, nh, sizeof(struct host *), host_compare);
 #if defined(CFDEBUG) /*[*/
     dump_array("after", h_array, nh);
 #endif /*]*/
@@ -897,7 +1028,7 @@ save_recent(const char *hn)
      * At the same time, limit the size of the recent list to MAX_RECENT.
      */
     n_recent = 0;
-    for (i = nih; i < nh; i++) {
+    for (i = 0; i < nh; i++) {
 	bool delete = false;
 
 	if (n_recent >= appres.max_recent) {
@@ -905,7 +1036,7 @@ save_recent(const char *hn)
 	} else {
 	    int j;
 
-	    for (j = nih; j < i; j++) {
+	    for (j = 0; j < i; j++) {
 		if (h_array[j] != NULL &&
 			!strcmp(h_array[i]->name, h_array[j]->name)) {
 		    delete = true;
@@ -923,9 +1054,13 @@ save_recent(const char *hn)
 	}
     }
 
-    /* Create a new host list from what's left. */
-    hosts = NULL;
-    last_host = NULL;
+    /* Create a new host list from the hosts file entries and what's left. */
+    last_host = last_file_host;
+    if (last_host != NULL) {
+	last_host->next = NULL;
+    } else {
+	hosts = NULL;
+    }
     for (i = 0; i < nh; i++) {
 	if ((h = h_array[i]) != NULL) {
 	    h->next = NULL;
@@ -952,7 +1087,8 @@ save_recent(const char *hn)
 "# Automatically generated %s# by %s\n\
 # Do not edit!\n",
 		    ctime(&t), build);
-	    for (h = hosts; h != NULL; h = h->next) {
+	    for (h = (last_file_host != NULL)? last_file_host->next: hosts;
+		    h != NULL; h = h->next) {
 		if (h->entry_type == RECENT) {
 		    fprintf(lcf, "%lu %s\n", (unsigned long)h->connect_time,
 			    h->name);
@@ -1076,3 +1212,31 @@ host_reconnecting(void)
 {
     return cstate == RECONNECTING;
 }
+
+/*
+ * Return a version of qualified_host that names the host by a numeric
+ * address, so a child process can connect without repeating the name
+ * lookup. The original name is passed as the accept name, so certificate
+ * checks still verify against it.
+ *
+ * Returns qualified_host if address is NULL or is already the host name.
+ */
+const char *
+host_qualified_at(const char *address)
+{
+    bool has_colons;
+
+    if (address == NULL || qualified_name == NULL ||
+	    !strcmp(address, qualified_name)) {
+	return qualified_host;
+    }
+    has_colons = (strchr(address, ':') != NULL);
+    return lazyaf("%s%s%s%s%s:%s=%s",
+	    HOST_FLAG(TLS_HOST)? "L:": "",
+	    HOST_FLAG(NO_VERIFY_CERT_HOST)? "Y:": "",
+	    has_colons? "[": "",
+	    address,
+	    has_colons? "]": "",
+	    qualified_port,
+	    (qualified_accept != NULL)? qualified_accept: qualified_name);
+}
@@ -37,16 +37,32 @@
 
 #include "appres.h"
 #include "asprintf.h"
+#include "base64.h"
 #include "lazya.h"
+#include "sha1.h"
 #include "trace.h"
 #include "utils.h"
 #include "varbuf.h"
+#include "deflate.h"
 
 #include "httpd-core.h"
 #include "httpd-io.h"
 
 #define DIRLIST_NLEN	14
 
+#define WS_GUID		"258EAFA5-E914-47DA-95CA-C5AB0DC85B11"
+#define WS_MAX_FRAME	65536	/* largest WebSocket frame accepted */
+
+#define MIN_ENCODE	128	/* smallest body worth compressing */
+
+/* WebSocket opcodes. */
+#define WS_OP_TEXT	0x1
+#define WS_OP_CLOSE	0x8
+#define WS_OP_PING	0x9
+#define WS_OP_PONG	0xa
+#define WS_FIN		0x80
+#define WS_MASK		0x80
+
 /* Typedefs */
 typedef enum {		/* Print mode: */
     HP_SEND,		/*  Send directly */
@@ -69,6 +85,13 @@ typedef enum {		/* Supported verbs: */
     VERB_OTHER		/*  anything else */
 } verb_t;
 
+typedef enum {		/* Content encodings: */
+    CE_NONE,		/*  identity */
+    CE_GZIP,		/*  gzip */
+    CE_DEFLATE,		/*  deflate (zlib framing) */
+    CE_COUNT
+} encoding_t;
+
 /* fields */
 typedef struct _field {	/* HTTP request fields (name: value) */
     struct _field *next; /* linkage */
@@ -94,6 +117,8 @@ typedef struct {
     char *fields_start;	/* start of fields */
     field_t *fields;	/* field values */
     char *location;	/* real location for 301 errors */
+    char *etag;		/* entity tag for the response */
+    encoding_t encoding; /* content encoding accepted by the client */
     struct _httpd_reg *async_node; /* asynchronous event node */
     size_t it_offset;	/* input trace offset */
     size_t ot_offset;	/* output trace offset */
@@ -105,6 +130,13 @@ typedef struct {
     void *mhandle;	/* the handle from the main procedure */
     bool cr;		/* last character seen was a CR */
     unsigned long seq;	/* connection sequence number, for tracing */
+    varbuf_t held;	/* pipelined input, held while a request is pending */
+    bool in_input;	/* processing input */
+
+    /* WebSocket state */
+    bool ws;		/* connection has been upgraded to a WebSocket */
+    ws_closed_t *ws_closed; /* called when the WebSocket is closed */
+    varbuf_t ws_in;	/* incoming frame data not yet processed */
 
     /* Per-request state */
     request_t request;
@@ -135,14 +167,22 @@ typedef struct _httpd_reg {
 	} fixed_binary;		/* fixed binary */
 	reg_dyn_t *dyn;		/* dynamic output */
     } u;
+    varbuf_t body;		/* fixed content or directory listing */
+    varbuf_t encoded[CE_COUNT];	/* compressed body, built once */
 } httpd_reg_t;
 
 /* Globals */
 
 /* Statics */
 static httpd_reg_t *httpd_reg;
+static char httpd_last_modified[32];	/* Last-Modified for fixed content */
+static varbuf_t root_body;		/* listing of / */
+static varbuf_t root_encoded[CE_COUNT];	/* compressed listing of / */
 static unsigned long httpd_seq = 0;
 
+static void httpd_reg_changed(void);
+static const char *lookup_field(const char *name, field_t *f);
+
 /* Code */
 
 /**
@@ -160,6 +200,10 @@ status_text(int status_code)
 	return "OK";
     case 301:
 	return "Moved Permanently";
+    case 304:
+	return "Not Modified";
+    case 101:
+	return "Switching Protocols";
     case 400:
 	return "Bad Request";
     case 404:
@@ -195,33 +239,34 @@ httpd_data_trace(httpd_t *h, const char *direction, const char *buf,
     for (i = 0; i < len; i++) {
 	if (!(i % BPL)) {
 	    if (i) {
-		vtrace(" ");
+		vctrace(TC_HTTP, " ");
 		for (j = 0; j < BPL; j++) {
-		    vtrace("%c", iscntrl(linebuf[j])? '.': linebuf[j]);
+		    vctrace(TC_HTTP, "%c",
+			    iscntrl(linebuf[j])? '.': linebuf[j]);
 		}
 	    }
-	    vtrace("%sh%s [%lu] 0x%04x",
+	    vctrace(TC_HTTP, "%sh%s [%lu] 0x%04x",
 		    i? "\n": "",
 		    direction,
 		    h->seq,
 		    (unsigned)(*doffset + i));
 	}
-	vtrace(" %02x", (unsigned char)buf[i]);
+	vctrace(TC_HTTP, " %02x", (unsigned char)buf[i]);
 	linebuf[i % BPL] = buf[i];
     }
 
     /* Space over the missing data bytes on the line. */
     if (i % BPL) {
-	vtrace("%*s", (int)((BPL - (i % BPL)) * 3 + 1), "");
+	vctrace(TC_HTTP, "%*s", (int)((BPL - (i % BPL)) * 3 + 1), "");
     } else {
-	vtrace(" ");
+	vctrace(TC_HTTP, " ");
     }
 
     /* Trace the last chunk of data as text. */
     for (j = 0; j < ((i % BPL)? (i % BPL): BPL); j++) {
-	vtrace("%c", iscntrl(linebuf[j])? '.': linebuf[j]);
+	vctrace(TC_HTTP, "%c", iscntrl(linebuf[j])? '.': linebuf[j]);
     }
-    vtrace("\n");
+    vctrace(TC_HTTP, "\n");
 
     *doffset += len;
 }
@@ -360,6 +405,64 @@ httpd_content_len(httpd_t *h, size_t len)
     httpd_send(h, cl, strlen(cl));
 }
 
+/**
+ * Send a response body with its Content-Length, compressing it if the client
+ * accepts that and it makes the body smaller.
+ *
+ * @param[in,out] h	State
+ * @param[in] buf	Body
+ * @param[in] len	Length of body
+ * @param[in,out] cache	Compressed copies of a fixed body, or NULL
+ */
+static void
+httpd_send_body(httpd_t *h, const char *buf, size_t len, varbuf_t *cache)
+{
+    request_t *r = &h->request;
+    varbuf_t local;
+    varbuf_t *z;
+
+    if (r->encoding == CE_NONE || len < MIN_ENCODE) {
+	httpd_content_len(h, len);
+	if (len) {
+	    httpd_send(h, buf, len);
+	}
+	return;
+    }
+
+    if (cache != NULL) {
+	z = &cache[r->encoding];
+	if (!vb_len(z)) {
+	    deflate_buffer(buf, len,
+		    (r->encoding == CE_GZIP)? DF_GZIP: DF_ZLIB, z);
+	}
+    } else {
+	vb_init(&local);
+	z = &local;
+	deflate_buffer(buf, len, (r->encoding == CE_GZIP)? DF_GZIP: DF_ZLIB,
+		z);
+    }
+
+    if (vb_len(z) < len) {
+	const char *ce = lazyaf("Content-Encoding: %s\r\n"
+		"Vary: Accept-Encoding\r\n",
+		(r->encoding == CE_GZIP)? "gzip": "deflate");
+
+	vctrace(TC_HTTP, "h> [%lu] Content-Encoding %s, %u -> %u bytes\n",
+		h->seq, (r->encoding == CE_GZIP)? "gzip": "deflate",
+		(unsigned)len, (unsigned)vb_len(z));
+	httpd_send(h, ce, strlen(ce));
+	httpd_content_len(h, vb_len(z));
+	httpd_send(h, vb_buf(z), vb_len(z));
+    } else {
+	httpd_content_len(h, len);
+	httpd_send(h, buf, len);
+    }
+
+    if (z == &local) {
+	vb_free(&local);
+    }
+}
+
 /**
  * Dump the buffered http_print() data.
  *
@@ -372,7 +475,10 @@ httpd_print_dump(httpd_t *h, dump_t type)
     request_t *r = &h->request;
 
     if (type == DUMP_WITH_LENGTH) {
-	httpd_content_len(h, vb_len(&r->print_buf));
+	httpd_send_body(h, vb_buf(&r->print_buf), vb_len(&r->print_buf),
+		NULL);
+	vb_reset(&r->print_buf);
+	return;
     }
     if (vb_len(&r->print_buf)) {
 	httpd_send(h, vb_buf(&r->print_buf), vb_len(&r->print_buf));
@@ -417,6 +523,8 @@ httpd_reinit_request(request_t *r)
     free_fields(&r->fields);
     r->fields_start = NULL;
     free_fields(&r->queries);
+    Replace(r->etag, NULL);
+    r->encoding = CE_NONE;
     vb_reset(&r->print_buf);
     r->verb = VERB_OTHER;
     r->it_offset = 0;
@@ -465,6 +573,8 @@ httpd_init_state(httpd_t *h, void *mhandle)
     httpd_init_request(&h->request);
 
     h->cr = false;
+    vb_init(&h->held);
+    vb_init(&h->ws_in);
     h->mhandle = mhandle;
     h->seq = httpd_seq++;
 }
@@ -485,7 +595,7 @@ httpd_http_header(httpd_t *h, int status_code, bool do_close,
     time_t t;
     char *a;
 
-    vtrace("h> [%lu] Response: %d %s\n", h->seq, status_code,
+    vctrace(TC_HTTP, "h> [%lu] Response: %d %s\n", h->seq, status_code,
 	    status_text(status_code));
 
     httpd_print(h, HP_BUFFER, "HTTP/1.1 %d %s\n", status_code,
@@ -496,6 +606,8 @@ httpd_http_header(httpd_t *h, int status_code, bool do_close,
     httpd_print(h, HP_BUFFER, "Server: %s\n", build);
     if (do_close) {
 	httpd_print(h, HP_BUFFER, "Connection: close\n");
+    } else if (r->http_1_0) {
+	httpd_print(h, HP_BUFFER, "Connection: keep-alive\n");
     }
     if (status_code == 301 && r->location != NULL) {
 	httpd_print(h, HP_BUFFER, "Location: %s\n", r->location);
@@ -555,7 +667,7 @@ httpd_verror(httpd_t *h, errmode_t mode, content_t content_type,
 	httpd_http_header(h, status_code, mode <= ERRMODE_FATAL,
 		lazyaf("%s; charset=iso8859-1", type_map[content_type]));
     } else {
-	vtrace("h> [%lu] Response: %d %s\n", h->seq, status_code,
+	vctrace(TC_HTTP, "h> [%lu] Response: %d %s\n", h->seq, status_code,
 		status_text(status_code));
     }
 
@@ -726,7 +838,7 @@ httpd_digest_request_line(httpd_t *h)
     errmode = ERRMODE_NON_HTTP;
 
     rq = r->request_buf;
-    vtrace("h< [%lu] Request: %s\n", h->seq, rq);
+    vctrace(TC_HTTP, "h< [%lu] Request: %s\n", h->seq, rq);
 
     /*
      * We need to see something that looks like:
@@ -993,10 +1105,91 @@ httpd_register_dyn(const char *path, const char *desc, content_t content_type,
 
     reg->next = httpd_reg;
     httpd_reg = reg;
+    httpd_reg_changed();
 
     return reg;
 }
 
+/**
+ * Release a cached body and its compressed copies.
+ *
+ * @param[in,out] body	Body
+ * @param[in,out] encoded Compressed copies
+ */
+static void
+free_cached_body(varbuf_t *body, varbuf_t *encoded)
+{
+    int i;
+
+    vb_free(body);
+    for (i = 0; i < CE_COUNT; i++) {
+	vb_free(&encoded[i]);
+    }
+}
+
+/**
+ * Note a change to the registry.
+ *
+ * Everything the registry serves is built into the emulator, so it is
+ * stamped with the time it was registered. This also invalidates the cached
+ * directory listings.
+ */
+static void
+httpd_reg_changed(void)
+{
+    static const char *day[] = {
+	"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"
+    };
+    static const char *month[] = {
+	"Jan", "Feb", "Mar", "Apr", "May", "Jun",
+	"Jul", "Aug", "Sep", "Oct", "Nov", "Dec"
+    };
+    time_t t = time(NULL);
+    struct tm *tm = gmtime(&t);
+    httpd_reg_t *reg;
+
+    /* Format it by hand: strftime() names are locale-dependent. */
+    snprintf(httpd_last_modified, sizeof(httpd_last_modified),
+	    "%s, %02d %s %04d %02d:%02d:%02d GMT",
+	    day[tm->tm_wday], tm->tm_mday, month[tm->tm_mon],
+	    tm->tm_year + 1900, tm->tm_hour, tm->tm_min, tm->tm_sec);
+
+    free_cached_body(&root_body, root_encoded);
+    for (reg = httpd_reg; reg != NULL; reg = reg->next) {
+	if (reg->type == OR_DIR) {
+	    free_cached_body(&reg->body, reg->encoded);
+	}
+    }
+}
+
+/**
+ * Answer a conditional request for built-in content.
+ *
+ * Clients send back the Last-Modified value they were given, so an exact
+ * match means they have the current version.
+ *
+ * @param[in,out] h	State
+ * @param[in] content_str Content-Type value
+ * @param[in] cache_control Cache-Control value
+ *
+ * @return true if a 304 response was sent
+ */
+static bool
+httpd_not_modified(httpd_t *h, const char *content_str,
+	const char *cache_control)
+{
+    request_t *r = &h->request;
+    const char *ims = lookup_field("If-Modified-Since", r->fields);
+
+    if (ims == NULL || strcmp(ims, httpd_last_modified)) {
+	return false;
+    }
+    httpd_http_header(h, 304, !r->persistent, content_str);
+    httpd_print(h, HP_SEND, "Last-Modified: %s\nCache-Control: %s\n\n",
+	    httpd_last_modified, cache_control);
+    return true;
+}
+
 /**
  * Reply to a successful URI lookup.
  *
@@ -1032,52 +1225,52 @@ httpd_reply(httpd_t *h, httpd_reg_t *reg, const char *uri)
 	break;
     }
 
+    if (httpd_not_modified(h, reg->content_str, "max-age=43200")) {
+	goto done;
+    }
+
     httpd_http_header(h, 200, !r->persistent, reg->content_str);
-    httpd_print(h, HP_SEND, "Cache-Control: max-age=43200\n");
+    httpd_print(h, HP_SEND, "Last-Modified: %s\nCache-Control: max-age=43200\n",
+	    httpd_last_modified);
 
     switch (r->verb) {
     case VERB_GET:
     case VERB_OTHER:
-	/* Generate the body. */
-	if (reg->content_type == CT_HTML) {
-	    httpd_print(h, HP_BUFFER,
-		    "<!DOCTYPE HTML PUBLIC \"-//IETF//DTD HTML 2.0//EN\">\n");
-	    httpd_print(h, HP_BUFFER, "<html>\n");
-	}
-
-	switch (reg->type) {
-	case OR_FIXED:
-	    httpd_print(h, HP_BUFFER, "%s", reg->u.fixed);
-	    break;
-	case OR_FIXED_BINARY:
-	    httpd_content_len(h, reg->u.fixed_binary.length);
-	    httpd_send(h, (char *)reg->u.fixed_binary.fixed,
-		    reg->u.fixed_binary.length);
-	    break;
-	case OR_DYN_TERM:
-	case OR_DYN_NONTERM:
-	case OR_DIR:
-	    /* Can't happen. */
+	if (reg->type == OR_FIXED_BINARY) {
+	    httpd_send_body(h, (const char *)reg->u.fixed_binary.fixed,
+		    reg->u.fixed_binary.length, reg->encoded);
 	    break;
 	}
 
-	if (reg->content_type == CT_HTML) {
-	    if (reg->flags & HF_TRAILER) {
-		httpd_html_trailer(h, HP_BUFFER);
+	/* Generate the body the first time, and keep it. */
+	if (!vb_len(&reg->body)) {
+	    if (reg->content_type == CT_HTML) {
+		vb_appends(&reg->body,
+			"<!DOCTYPE HTML PUBLIC \"-//IETF//DTD HTML 2.0//EN\">\n"
+			"<html>\n");
+	    }
+	    vb_appends(&reg->body, reg->u.fixed);
+	    if (reg->content_type == CT_HTML) {
+		if (reg->flags & HF_TRAILER) {
+		    httpd_html_trailer(h, HP_BUFFER);
+		    vb_append(&reg->body, vb_buf(&r->print_buf),
+			    vb_len(&r->print_buf));
+		    vb_reset(&r->print_buf);
+		}
+		vb_appends(&reg->body, "</html>\n");
 	    }
-	    httpd_print(h, HP_BUFFER, "</html>\n");
 	}
 
-	/* Dump the Content-Length now and terminate the response header. */
-	if (reg->type != OR_FIXED_BINARY) {
-	    httpd_print_dump(h, DUMP_WITH_LENGTH);
-	}
+	/* Send it with its Content-Length. */
+	httpd_send_body(h, vb_buf(&reg->body), vb_len(&reg->body),
+		reg->encoded);
 	break;
     case VERB_HEAD:
 	httpd_print(h, HP_SEND, "\n");
 	break;
     }
 
+done:
     /* If the connection is not persistent, close the connection. */
     if (!r->persistent) {
 	return HS_SUCCESS_CLOSE;
@@ -1090,23 +1283,48 @@ httpd_reply(httpd_t *h, httpd_reg_t *reg, const char *uri)
 /**
  * List a directory as the response.
  *
+ * Listings of canonical directory names are cached until the registry
+ * changes.
+ *
  * @param[in,out] h	State
  * @param[in] uri	URI matched
+ * @param[in] dir	Registry entry for the directory, or NULL for /
  *
  * @return httpd_status_t
  */
 static httpd_status_t
-httpd_dirlist(httpd_t *h, const char *uri)
+httpd_dirlist(httpd_t *h, const char *uri, httpd_reg_t *dir)
 {
     request_t *r = &h->request;
     char *q_uri;
     httpd_reg_t *reg;
+    varbuf_t *body = NULL;
+    varbuf_t *encoded = NULL;
+
+    if (httpd_not_modified(h, "text/html; charset=iso8859-1", "no-cache")) {
+	goto done;
+    }
 
     httpd_http_header(h, 200, !r->persistent, "text/html; charset=iso8859-1");
+    httpd_print(h, HP_SEND, "Last-Modified: %s\nCache-Control: no-cache\n",
+	    httpd_last_modified);
+
+    if (dir == NULL) {
+	body = &root_body;
+	encoded = root_encoded;
+    } else if (strstr(uri, "//") == NULL) {
+	body = &dir->body;
+	encoded = dir->encoded;
+    }
 
     switch (r->verb) {
     case VERB_GET:
     case VERB_OTHER:
+	if (body != NULL && vb_len(body)) {
+	    httpd_send_body(h, vb_buf(body), vb_len(body), encoded);
+	    break;
+	}
+
 	/* Generate the body. */
 	q_uri = html_quote(uri);
 	httpd_print(h, HP_BUFFER,
@@ -1157,14 +1375,20 @@ httpd_dirlist(httpd_t *h, const char *uri)
 	httpd_html_trailer(h, HP_BUFFER);
 	httpd_print(h, HP_BUFFER, "</html>\n");
 
-	/* Dump the Content-Length now and terminate the response header. */
-	httpd_print_dump(h, DUMP_WITH_LENGTH);
+	/* Keep it, then send it with its Content-Length. */
+	if (body != NULL) {
+	    vb_append(body, vb_buf(&r->print_buf), vb_len(&r->print_buf));
+	}
+	httpd_send_body(h, vb_buf(&r->print_buf), vb_len(&r->print_buf),
+		encoded);
+	vb_reset(&r->print_buf);
 	break;
     case VERB_HEAD:
 	httpd_print(h, HP_SEND, "\n");
 	break;
     }
 
+done:
     /* If the connection is not persistent, close the connection. */
     if (!r->persistent) {
 	return HS_SUCCESS_CLOSE;
@@ -1193,6 +1417,81 @@ lookup_field(const char *name, field_t *f)
     return NULL;
 }
 
+/**
+ * Check an Accept-Encoding field for a content coding.
+ *
+ * @param[in] ae	Field value
+ * @param[in] coding	Coding name
+ *
+ * @return 1 if accepted, 0 if refused (q=0), -1 if not mentioned
+ */
+static int
+accepts_coding(const char *ae, const char *coding)
+{
+    size_t cl = strlen(coding);
+
+    while (*ae) {
+	const char *end = strchr(ae, ',');
+	size_t tl;
+
+	if (end == NULL) {
+	    end = ae + strlen(ae);
+	}
+	while (ae < end && (*ae == ' ' || *ae == '\t')) {
+	    ae++;
+	}
+	for (tl = 0; ae + tl < end && ae[tl] != ';' && ae[tl] != ' ' &&
+		ae[tl] != '\t'; tl++) {
+	}
+	if (tl == cl && !strncasecmp(ae, coding, cl)) {
+	    const char *q = ae + tl;
+
+	    /* Look for a q=0 parameter. */
+	    while ((q = strchr(q, ';')) != NULL && q < end) {
+		q++;
+		while (*q == ' ' || *q == '\t') {
+		    q++;
+		}
+		if ((*q == 'q' || *q == 'Q') && q[1] == '=') {
+		    return (strtod(q + 2, NULL) > 0.0)? 1: 0;
+		}
+	    }
+	    return 1;
+	}
+	ae = *end? end + 1: end;
+    }
+    return -1;
+}
+
+/**
+ * Pick the content encoding to use for a response, from the request's
+ * Accept-Encoding field.
+ *
+ * @param[in] r		Request state
+ *
+ * @return encoding_t
+ */
+static encoding_t
+pick_encoding(request_t *r)
+{
+    const char *ae = lookup_field("Accept-Encoding", r->fields);
+    int gzip, deflate, star;
+
+    if (ae == NULL) {
+	return CE_NONE;
+    }
+    gzip = accepts_coding(ae, "gzip");
+    deflate = accepts_coding(ae, "deflate");
+    star = accepts_coding(ae, "*");
+    if (gzip == 1 || (gzip == -1 && star == 1)) {
+	return CE_GZIP;
+    }
+    if (deflate == 1 || (deflate == -1 && star == 1)) {
+	return CE_DEFLATE;
+    }
+    return CE_NONE;
+}
+
 /**
  * Redirect a directory name by appending a '/'.
  *
@@ -1371,7 +1670,7 @@ httpd_lookup_uri(httpd_t *h, const char *uri)
     char *canon;
 
     if (!uricmp(uri, "/")) {
-	return httpd_dirlist(h, "/");
+	return httpd_dirlist(h, "/", NULL);
     }
 
     /* Look for an exact match. */
@@ -1393,7 +1692,7 @@ httpd_lookup_uri(httpd_t *h, const char *uri)
 		}
 		if (!uricmp(copy, reg->path)) {
 		    Free(copy);
-		    return httpd_dirlist(h, uri);
+		    return httpd_dirlist(h, uri, reg);
 		}
 	    }
 	    break;
@@ -1590,12 +1889,21 @@ httpd_digest_request(httpd_t *h)
 	return httpd_error(h, ERRMODE_FATAL, CT_HTML, 400, "Missing hostname.");
     }
 
-    /* Check for connection close request. */
-    if ((connection = lookup_field("Connection", r->fields)) != NULL &&
-	    !strcasecmp(connection, "close")) {
-	r->persistent = false;
+    /*
+     * Check for connection close request, or a keep-alive request from an
+     * HTTP 1.0 client.
+     */
+    if ((connection = lookup_field("Connection", r->fields)) != NULL) {
+	if (!strcasecmp(connection, "close")) {
+	    r->persistent = false;
+	} else if (r->http_1_0 && !strcasecmp(connection, "keep-alive")) {
+	    r->persistent = true;
+	}
     }
 
+    /* Check for compression support. */
+    r->encoding = pick_encoding(r);
+
     /*
      * Split the URI at '?' or '#' before doing percent decodes.
      * This allows '?' and '#' to be percent-encoded in any of the elements.
@@ -1735,6 +2043,172 @@ httpd_input_char(httpd_t *h, char c)
     return HS_CONTINUE;
 }
 
+/**
+ * Copy a run of characters up to the next line ending into the request
+ * buffer.
+ *
+ * @param[in,out] h	connection state
+ * @param[in] data	data buffer
+ * @param[in] len	length of data in buffer
+ *
+ * @return Number of characters consumed
+ */
+static size_t
+httpd_input_run(httpd_t *h, const char *data, size_t len)
+{
+    request_t *r = &h->request;
+    const char *nl;
+    const char *cr;
+    size_t run;
+
+    nl = memchr(data, '\n', len);
+    if (nl != NULL) {
+	len = nl - data;
+    }
+    cr = memchr(data, '\r', len);
+    run = (cr != NULL)? (size_t)(cr - data): len;
+
+    /* Leave overflow to httpd_input_char(), which will diagnose it. */
+    if (run > (size_t)(MAX_HTTPD_REQUEST - r->nr)) {
+	run = MAX_HTTPD_REQUEST - r->nr;
+    }
+    memcpy(r->request_buf + r->nr, data, run);
+    r->nr += run;
+    r->rll += run;
+    return run;
+}
+
+/**
+ * Send a WebSocket frame.
+ *
+ * @param[in,out] h	connection state
+ * @param[in] opcode	frame opcode
+ * @param[in] buf	payload
+ * @param[in] len	length of payload
+ */
+static void
+httpd_ws_frame(httpd_t *h, unsigned char opcode, const char *buf, size_t len)
+{
+    char hdr[10];
+    size_t hlen = 2;
+    int i;
+
+    hdr[0] = WS_FIN | opcode;
+    if (len < 126) {
+	hdr[1] = (char)len;
+    } else if (len < 65536) {
+	hdr[1] = 126;
+	hdr[2] = (char)(len >> 8);
+	hdr[3] = (char)len;
+	hlen = 4;
+    } else {
+	hdr[1] = 127;
+	for (i = 0; i < 8; i++) {
+	    hdr[2 + i] = (char)((unsigned long long)len >> (56 - (i * 8)));
+	}
+	hlen = 10;
+    }
+    httpd_send(h, hdr, hlen);
+    if (len) {
+	httpd_send(h, buf, len);
+    }
+}
+
+/**
+ * Process incoming WebSocket data.
+ *
+ * The WebSocket endpoints only push data, so apart from answering pings and
+ * closes, client messages are ignored.
+ *
+ * @param[in,out] h	connection state
+ * @param[in] data	data buffer
+ * @param[in] len	length of data in buffer
+ *
+ * @return httpd_status_t
+ */
+static httpd_status_t
+httpd_ws_input(httpd_t *h, const char *data, size_t len)
+{
+    const unsigned char *b;
+    size_t total;
+    size_t off = 0;
+    httpd_status_t rv = HS_CONTINUE;
+    char *old;
+
+    vb_append(&h->ws_in, data, len);
+    b = (const unsigned char *)vb_buf(&h->ws_in);
+    total = vb_len(&h->ws_in);
+
+    while (rv == HS_CONTINUE) {
+	const unsigned char *f = b + off;
+	size_t avail = total - off;
+	size_t hlen = 2;
+	unsigned long long plen;
+	char *payload;
+	size_t i;
+
+	if (avail < hlen) {
+	    break;
+	}
+	if (!(f[1] & WS_MASK)) {
+	    vctrace(TC_HTTP, "h< [%lu] Unmasked WebSocket frame\n", h->seq);
+	    return HS_ERROR_CLOSE;
+	}
+	plen = f[1] & 0x7f;
+	if (plen == 126) {
+	    hlen += 2;
+	} else if (plen == 127) {
+	    hlen += 8;
+	}
+	hlen += 4;
+	if (avail < hlen) {
+	    break;
+	}
+	if (plen == 126) {
+	    plen = (f[2] << 8) | f[3];
+	} else if (plen == 127) {
+	    plen = 0;
+	    for (i = 0; i < 8; i++) {
+		plen = (plen << 8) | f[2 + i];
+	    }
+	}
+	if (plen > WS_MAX_FRAME) {
+	    vctrace(TC_HTTP, "h< [%lu] WebSocket frame too big\n", h->seq);
+	    return HS_ERROR_CLOSE;
+	}
+	if (avail < hlen + plen) {
+	    break;
+	}
+
+	/* Unmask the payload. */
+	payload = Malloc((size_t)plen + 1);
+	for (i = 0; i < plen; i++) {
+	    payload[i] = f[hlen + i] ^ f[hlen - 4 + (i % 4)];
+	}
+	off += hlen + (size_t)plen;
+
+	switch (f[0] & 0x0f) {
+	case WS_OP_CLOSE:
+	    vctrace(TC_HTTP, "h< [%lu] WebSocket close\n", h->seq);
+	    httpd_ws_frame(h, WS_OP_CLOSE, payload, (plen >= 2)? 2: 0);
+	    rv = HS_SUCCESS_CLOSE;
+	    break;
+	case WS_OP_PING:
+	    httpd_ws_frame(h, WS_OP_PONG, payload, (size_t)plen);
+	    break;
+	default:
+	    break;
+	}
+	Free(payload);
+    }
+
+    /* Keep any partial frame for next time. */
+    old = vb_consume(&h->ws_in);
+    vb_append(&h->ws_in, old + off, total - off);
+    Free(old);
+    return rv;
+}
+
 /*****************************************************************************
  * Functions called by the main logic.
  *****************************************************************************/
@@ -1764,6 +2238,7 @@ httpd_register_dir(const char *path, const char *desc)
 
     reg->next = httpd_reg;
     httpd_reg = reg;
+    httpd_reg_changed();
 
     return reg;
 }
@@ -1803,6 +2278,7 @@ httpd_register_fixed(const char *path, const char *desc,
 
     reg->next = httpd_reg;
     httpd_reg = reg;
+    httpd_reg_changed();
 
     return reg;
 }
@@ -1844,6 +2320,7 @@ httpd_register_fixed_binary(const char *path, const char *desc,
 
     reg->next = httpd_reg;
     httpd_reg = reg;
+    httpd_reg_changed();
 
     return reg;
 }
@@ -1903,9 +2380,81 @@ httpd_set_alias(void *nhandle, const char *text)
 
     if (reg) {
 	reg->alias = text;
+	httpd_reg_changed();
     }
 }
 
+/**
+ * Process a block of incoming HTTP data.
+ *
+ * Requests pipelined behind one that completes are processed in order. If
+ * a request is pending, the remaining input is held until it completes.
+ *
+ * @param[in,out] h	connection state
+ * @param[in] data	data buffer
+ * @param[in] len	length of data in buffer
+ *
+ * @return httpd_status_t
+ */
+static httpd_status_t
+httpd_input_data(httpd_t *h, const char *data, size_t len)
+{
+    request_t *r = &h->request;
+    size_t i;
+    httpd_status_t rv = HS_CONTINUE;
+
+    /*
+     * Copy runs of ordinary characters in bulk, and process line endings a
+     * byte at a time, skipping CRs.
+     */
+    h->in_input = true;
+    for (i = 0; i < len; i++) {
+	if (h->ws) {
+	    /* Skip the LF ending the upgrade request. */
+	    if (h->cr) {
+		h->cr = false;
+		if (data[i] == '\n') {
+		    continue;
+		}
+	    }
+
+	    /* The rest is WebSocket data. */
+	    rv = httpd_ws_input(h, data + i, len - i);
+	    break;
+	}
+	if (!h->cr) {
+	    i += httpd_input_run(h, data + i, len - i);
+	    if (i >= len) {
+		break;
+	    }
+	}
+	switch ((rv = httpd_input_char(h, data[i]))) {
+	case HS_CONTINUE:
+	    /* Keep parsing. */
+	    continue;
+	case HS_SUCCESS_OPEN:
+	case HS_ERROR_OPEN:
+	    /* Request done, but keep the socket open for the next one. */
+	    httpd_reinit_request(r);
+	    continue;
+	case HS_PENDING:
+	    /* Request pending, hold off further input. */
+	    vb_append(&h->held, data + i + 1, len - (i + 1));
+	    /* fall through */
+	case HS_ERROR_CLOSE:
+	    /* Request failed, close the socket. */
+	case HS_SUCCESS_CLOSE:
+	    /* Request succeeded, close the socket. */
+	    break;
+	}
+	break;
+    }
+    h->in_input = false;
+
+    /* Success, at least so far. */
+    return rv;
+}
+
 /**
  * Initialize a new connection.
  *
@@ -1925,7 +2474,7 @@ httpd_new(void *mhandle, const char *client_name)
     memset(h, 0, sizeof(*h));
     httpd_init_state(h, mhandle);
 
-    vtrace("h< [%lu] New session from %s\n", h->seq, client_name);
+    vctrace(TC_HTTP, "h< [%lu] New session from %s\n", h->seq, client_name);
 
     return h;
 }
@@ -1946,35 +2495,40 @@ httpd_input(void *dhandle, const char *data, size_t len)
 {
     httpd_t *h = (httpd_t *)dhandle;
     request_t *r = &h->request;
-    size_t i;
-    httpd_status_t rv = HS_CONTINUE;
 
     httpd_data_trace(h, "<", data, len, &r->it_offset);
+    return httpd_input_data(h, data, len);
+}
 
-    /* Process a byte at a time, skipping CRs. */
-    for (i = 0; i < len; i++) {
-	switch ((rv = httpd_input_char(h, data[i]))) {
-	case HS_CONTINUE:
-	    /* Keep parsing. */
-	    continue;
-	case HS_SUCCESS_OPEN:
-	    httpd_reinit_request(r);
-	    return rv;
-	case HS_ERROR_OPEN:
-	    /* Request failed, but keep the socket open. */
-	    httpd_reinit_request(r);
-	    /* fall through */
-	case HS_ERROR_CLOSE:
-	    /* Request failed, close the socket. */
-	case HS_SUCCESS_CLOSE:
-	    /* Request succeeded, close the socket. */
-	case HS_PENDING:
-	    /* Request pending, hold off further input. */
-	    return rv;
-	}
+/**
+ * Process input held while a request was pending.
+ *
+ * Called when an asynchronous request completes, to run any requests that
+ * were pipelined behind it.
+ *
+ * @param[in] dhandle	handle returned by httpd_new
+ *
+ * @return httpd_status_t
+ */
+httpd_status_t
+httpd_input_held(void *dhandle)
+{
+    httpd_t *h = (httpd_t *)dhandle;
+    size_t len;
+    char *data;
+    httpd_status_t rv;
+
+    /*
+     * If the request completed synchronously, the input loop is still
+     * running and will pick up where it left off.
+     */
+    if (h->in_input || (len = vb_len(&h->held)) == 0) {
+	return HS_CONTINUE;
     }
 
-    /* Success, at least so far. */
+    data = vb_consume(&h->held);
+    rv = httpd_input_data(h, data, len);
+    Free(data);
     return rv;
 }
 
@@ -1989,10 +2543,17 @@ httpd_close(void *dhandle, const char *why)
 {
     httpd_t *h = dhandle;
 
-    vtrace("h> [%lu] Close: %s\n", h->seq, why);
+    vctrace(TC_HTTP, "h> [%lu] Close: %s\n", h->seq, why);
+
+    /* Tell the WebSocket endpoint. */
+    if (h->ws && h->ws_closed != NULL) {
+	(*h->ws_closed)(h);
+    }
 
     /* Wipe the existing request state. */
     httpd_free_request(&h->request);
+    vb_free(&h->held);
+    vb_free(&h->ws_in);
 
     /* Free it. */
     memset(h, 0, sizeof(*h));
@@ -2046,7 +2607,12 @@ httpd_dyn_complete(void *dhandle, const char *format, ...)
 
     /* Generate the output. */
     httpd_http_header(h, 200, !r->persistent, reg->content_str);
-    httpd_print(h, HP_SEND, "Cache-Control: no-store\n");
+    if (r->etag != NULL) {
+	httpd_print(h, HP_SEND, "ETag: %s\nCache-Control: no-cache\n",
+		r->etag);
+    } else {
+	httpd_print(h, HP_SEND, "Cache-Control: no-store\n");
+    }
 
     switch (r->verb) {
     case VERB_GET:
@@ -2084,6 +2650,79 @@ httpd_dyn_complete(void *dhandle, const char *format, ...)
     }
 }
 
+/**
+ * Check an If-None-Match field value for an entity tag.
+ *
+ * @param[in] list	Field value: a comma-separated list of tags, or "*"
+ * @param[in] etag	Tag to look for
+ *
+ * @return true if the tag is in the list
+ */
+static bool
+etag_listed(const char *list, const char *etag)
+{
+    size_t elen = strlen(etag);
+
+    while (*list) {
+	size_t len;
+
+	while (*list == ' ' || *list == '\t' || *list == ',') {
+	    list++;
+	}
+	if (!strncmp(list, "W/", 2)) {
+	    list += 2;
+	}
+	len = strcspn(list, " \t,");
+	if ((len == 1 && *list == '*') ||
+		(len == elen && !strncmp(list, etag, len))) {
+	    return true;
+	}
+	list += len;
+    }
+    return false;
+}
+
+/**
+ * Set the entity tag for a dynamic response.
+ *
+ * Called from a method before it generates its response. If the client
+ * already has this version (If-None-Match), a 304 response is sent.
+ *
+ * @param[in] dhandle	handle returned by httpd_new
+ * @param[in] etag	Entity tag, including the double quotes
+ *
+ * @return HS_CONTINUE if the method should go on and generate the response,
+ *  otherwise an httpd_status_t suitable for return from the method.
+ */
+httpd_status_t
+httpd_dyn_etag(void *dhandle, const char *etag)
+{
+    httpd_t *h = (httpd_t *)dhandle;
+    request_t *r = &h->request;
+    httpd_reg_t *reg = r->async_node;
+    const char *inm;
+
+    Replace(r->etag, NewString(etag));
+    if ((inm = lookup_field("If-None-Match", r->fields)) == NULL ||
+	    !etag_listed(inm, etag)) {
+	return HS_CONTINUE;
+    }
+
+    /* Un-mark the node. */
+    r->async_node = NULL;
+
+    httpd_http_header(h, 304, !r->persistent, reg->content_str);
+    httpd_print(h, HP_SEND, "ETag: %s\nCache-Control: no-cache\n\n",
+	    r->etag);
+
+    if (!r->persistent) {
+	return HS_SUCCESS_CLOSE;
+    } else {
+	httpd_reinit_request(r);
+	return HS_SUCCESS_OPEN;
+    }
+}
+
 /**
  * Unsuccessfully complete a dynamic HTTP request.
  *
@@ -2203,3 +2842,100 @@ httpd_fetch_query(void *dhandle, const char *name)
     return NULL;
 
 }
+
+/**
+ * Fetch a header field from the current request.
+ *
+ * @param[in] dhandle	Connection handle
+ * @param[in] name	Field name
+ *
+ * @return Field value, or NULL
+ */
+const char *
+httpd_fetch_field(void *dhandle, const char *name)
+{
+    httpd_t *h = dhandle;
+
+    return lookup_field(name, h->request.fields);
+}
+
+/**
+ * Upgrade the current request to a WebSocket.
+ *
+ * Called from a dynamic node. On success, the 101 response has been sent
+ * and the node can push text messages with httpd_ws_send().
+ *
+ * @param[in] dhandle	Connection handle
+ * @param[in] closed	Function to call when the WebSocket is closed
+ *
+ * @return httpd_status_t, suitable for return from a node
+ */
+httpd_status_t
+httpd_ws_upgrade(void *dhandle, ws_closed_t *closed)
+{
+    httpd_t *h = dhandle;
+    request_t *r = &h->request;
+    const char *upgrade = lookup_field("Upgrade", r->fields);
+    const char *key = lookup_field("Sec-WebSocket-Key", r->fields);
+    const char *version = lookup_field("Sec-WebSocket-Version", r->fields);
+    char *kbuf;
+    unsigned char digest[SHA1_LEN];
+    char *accept;
+
+    if (r->verb != VERB_GET || upgrade == NULL ||
+	    strcasecmp(upgrade, "websocket") || key == NULL ||
+	    version == NULL || strcmp(version, "13")) {
+	return httpd_dyn_error(dhandle, CT_TEXT, 400,
+		"WebSocket upgrade required.\n");
+    }
+
+    kbuf = xs_buffer("%s%s", key, WS_GUID);
+    sha1((unsigned char *)kbuf, strlen(kbuf), digest);
+    Free(kbuf);
+    accept = base64_encode_buf((char *)digest, sizeof(digest));
+
+    vctrace(TC_HTTP, "h> [%lu] Response: 101 %s\n", h->seq, status_text(101));
+    httpd_print(h, HP_SEND, "HTTP/1.1 101 %s\n\
+Upgrade: websocket\n\
+Connection: Upgrade\n\
+Sec-WebSocket-Accept: %s\n\
+\n", status_text(101), accept);
+    Free(accept);
+
+    h->ws = true;
+    h->ws_closed = closed;
+    r->async_node = NULL;
+    return HS_SUCCESS_OPEN;
+}
+
+/**
+ * Send a text message on a WebSocket.
+ *
+ * @param[in] dhandle	Connection handle
+ * @param[in] text	Message text (UTF-8)
+ * @param[in] len	Length of text
+ */
+void
+httpd_ws_send(void *dhandle, const char *text, size_t len)
+{
+    httpd_t *h = dhandle;
+
+    if (h->ws) {
+	httpd_ws_frame(h, WS_OP_TEXT, text, len);
+    }
+}
+
+/**
+ * Check a connection for being a WebSocket.
+ *
+ * @param[in] dhandle	Connection handle
+ *
+ * @return true if the connection has been upgraded
+ */
+bool
+httpd_ws_active(void *dhandle)
+{
+    httpd_t *h = dhandle;
+
+    return h->ws;
+}
@@ -42,17 +42,21 @@
 #include <fcntl.h>
 #include <errno.h>
 #include <assert.h>
+#include <stddef.h>
 
 #include "appres.h"
 #include "bind-opt.h"
 #include "lazya.h"
 #include "popups.h"
+#include "rearm.h"
 #include "resources.h"
+#include "spans.h"
 #include "task.h"
 #include "toggles.h"
 #include "trace.h"
 #include "utils.h"
-#include "varbuf.h"
+#include "varbuf.h"	/* must precede serialize.h */
+#include "serialize.h"
 
 #include "httpd-core.h"
 #include "httpd-io.h"
@@ -64,6 +68,11 @@
 #endif /*]*/
 
 #define IDLE_MAX	15
+#define IDLE_SLACK_MS	1000	/* idle timeouts can be up to 1s late */
+
+#define OUTQ_THROTTLE	(256 * 1024)	/* queued output that defers commands */
+#define OUTQ_MAX	(4 * 1024 * 1024) /* queued output that drops a session */
+#define OUTQ_COMPACT	(64 * 1024)	/* sent output worth reclaiming */
 
 struct hio_listener {
     llist_t link;	/* list linkage */
@@ -89,18 +98,42 @@ typedef struct {
     void *dhandle;	/* httpd protocol handle */
     int idle;
     ioid_t ioid;	/* AddInput ID */
-    ioid_t toid;	/* AddTimeOut ID */
+    rearm_t timer;	/* idle and close timer */
+    ioid_t oid;		/* AddOutput ID */
+
+    varbuf_t outq;	/* output not yet accepted by the socket */
+    size_t outq_sent;	/* bytes at the front of outq already sent */
+    bool overflow;	/* outq exceeded OUTQ_MAX, session is being dropped */
+    bool lingering;	/* closed, but still draining outq */
 
     struct {		/* pending command state: */
 	sendto_callback_t *callback; /* callback function */
 	content_t content_type; /* content type */
 	varbuf_t result; /* accumulated result data */
 	bool done;	/* is the command done? */
+	bool running;	/* is the command running? */
+	char *deferred;	/* command held until outq drains */
+	span_t *span;	/* request span, until the command is pushed */
     } pending;
     hio_listener_t *listener;
 } session_t;
 llist_t sessions = LLIST_INIT(sessions);
 
+static void hio_data(task_cbh handle, const char *buf, size_t len,
+	bool success);
+static bool hio_complete(task_cbh handle, bool success, bool abort);
+static void hio_timeout(rearm_t *r);
+static void hio_socket_close(session_t *session);
+
+static tcb_t httpd_cb = {
+    "httpd",
+    IA_HTTPD,
+    CB_NEW_TASKQ,
+    hio_data,
+    hio_complete,
+    NULL
+};
+
 /**
  * Return the text for the most recent socket error.
  *
@@ -116,6 +149,88 @@ socket_errtext(void)
 #endif /*]*/
 }
 
+#if !defined(_WIN32) /*[*/
+/**
+ * Drain queued output on an httpd connection.
+ *
+ * @param[in] fd	socket file descriptor
+ * @param[in] id	I/O ID
+ */
+static void
+hio_socket_output(iosrc_t fd, ioid_t id)
+{
+    session_t *session;
+    size_t left;
+
+    session = NULL;
+    FOREACH_LLIST(&sessions, session, session_t *) {
+	if (session->oid == id) {
+	    break;
+	}
+    } FOREACH_LLIST_END(&sessions, session, session_t *);
+    if (session == NULL) {
+	vctrace(TC_HTTP, "httpd mystery output\n");
+	return;
+    }
+
+    while ((left = vb_len(&session->outq) - session->outq_sent) > 0) {
+	ssize_t nw = send(session->s, vb_buf(&session->outq) +
+		session->outq_sent, (int)left, 0);
+
+	if (nw < 0) {
+	    if (socket_errno() == SE_EWOULDBLOCK) {
+		break;
+	    }
+
+	    /* The input side will see the EOF. */
+	    vctrace(TC_HTTP, "http send error: %s\n", socket_errtext());
+	    vb_reset(&session->outq);
+	    session->outq_sent = 0;
+	    break;
+	}
+	session->outq_sent += nw;
+    }
+
+    if (vb_len(&session->outq) > session->outq_sent) {
+	/* Still backed up. Reclaim the space that has been sent. */
+	if (session->outq_sent >= OUTQ_COMPACT) {
+	    varbuf_t r;
+
+	    vb_init(&r);
+	    vb_append(&r, vb_buf(&session->outq) + session->outq_sent,
+		    vb_len(&session->outq) - session->outq_sent);
+	    vb_free(&session->outq);
+	    session->outq = r;
+	    session->outq_sent = 0;
+	}
+	return;
+    }
+
+    /* Drained. */
+    RemoveInput(session->oid);
+    session->oid = NULL_IOID;
+    vb_reset(&session->outq);
+    session->outq_sent = 0;
+    if (session->lingering) {
+	hio_socket_close(session);
+	return;
+    }
+
+    /* Run a command that was held back by the backlog. */
+    if (session->pending.deferred != NULL) {
+	char *cmd = session->pending.deferred;
+
+	session->pending.deferred = NULL;
+	vctrace(TC_HTTP, "httpd output drained, resuming commands\n");
+	session->pending.running = true;
+	push_cb(cmd, strlen(cmd), &httpd_cb, session);
+	task_cb_span(session, session->pending.span);
+	session->pending.span = NULL;
+	Free(cmd);
+    }
+}
+#endif /*]*/
+
 /**
  * Close the session associated with a particular socket.
  * Called from the HTTPD logic when a fatal error or EOF occurs.
@@ -125,47 +240,68 @@ socket_errtext(void)
 static void
 hio_socket_close(session_t *session)
 {
-    SOCK_CLOSE(session->s);
     if (session->ioid != NULL_IOID) {
 	RemoveInput(session->ioid);
+	session->ioid = NULL_IOID;
     }
-    if (session->toid != NULL_IOID) {
-	RemoveTimeOut(session->toid);
+    rearm_cancel(&session->timer);
+
+    /*
+     * If there is still output queued (typically the response that ended a
+     * non-persistent connection), keep the socket open until it drains or
+     * the idle timeout expires.
+     */
+    if (vb_len(&session->outq) > session->outq_sent && !session->overflow &&
+	    !session->lingering) {
+	session->lingering = true;
+	session->dhandle = NULL;
+	rearm_set(&session->timer, IDLE_MAX * 1000, IDLE_SLACK_MS);
+	return;
+    }
+
+    SOCK_CLOSE(session->s);
+    if (session->oid != NULL_IOID) {
+	RemoveInput(session->oid);
     }
 #if defined(_WIN32) /*[*/
     CloseHandle(session->event);
 #endif /*]*/
+    vb_free(&session->outq);
     vb_free(&session->pending.result);
+    Replace(session->pending.deferred, NULL);
+    span_done(session->pending.span, false);
+    session->pending.span = NULL;
+    rearm_release(&session->timer);
     llist_unlink(&session->link);
-    Free(session);
     if (session->listener != NULL) {
 	session->listener->n_sessions--;
     }
+    Free(session);
 }
 
 /**
  * httpd timeout.
  *
- * @param[in] id	timeout ID
+ * @param[in] r		timer
  */
 static void
-hio_timeout(ioid_t id)
+hio_timeout(rearm_t *r)
 {
-    session_t *session;
+    session_t *session =
+	(session_t *)(void *)((char *)r - offsetof(session_t, timer));
 
-    session = NULL;
-    FOREACH_LLIST(&sessions, session, session_t *) {
-	if (session->toid == id) {
-	    break;
-	}
-    } FOREACH_LLIST_END(&sessions, session, session_t *);
-    if (session == NULL) {
-	vtrace("httpd mystery timeout\n");
+    if (session->lingering) {
+	vctrace(TC_HTTP, "httpd output drain timeout\n");
+	hio_socket_close(session);
 	return;
     }
-
-    session->toid = NULL_IOID;
-    httpd_close(session->dhandle, "timeout");
+    if (session->overflow && session->pending.running) {
+	/* Wait for the command to finish before freeing the session. */
+	rearm_set(&session->timer, 100, 0);
+	return;
+    }
+    httpd_close(session->dhandle,
+	    session->overflow? "output queue overflow": "timeout");
     hio_socket_close(session);
 }
 
@@ -189,7 +325,7 @@ hio_socket_input(iosrc_t fd, ioid_t id)
 	}
     } FOREACH_LLIST_END(&sessions, session, session_t *);
     if (session == NULL) {
-	vtrace("httpd mystery input\n");
+	vctrace(TC_HTTP, "httpd mystery input\n");
 	return;
     }
 
@@ -199,10 +335,7 @@ hio_socket_input(iosrc_t fd, ioid_t id)
 
     session->idle = 0;
 
-    if (session->toid != NULL_IOID) {
-	RemoveTimeOut(session->toid);
-	session->toid = NULL_IOID;
-    }
+    rearm_cancel(&session->timer);
 
     nr = recv(session->s, buf, sizeof(buf), 0);
     if (nr <= 0) {
@@ -214,7 +347,8 @@ hio_socket_input(iosrc_t fd, ioid_t id)
 		harmless = true;
 	    }
 	    ebuf = lazyaf("recv error: %s", socket_errtext());
-	    vtrace("httpd %s%s\n", ebuf, harmless? " (harmless)": "");
+	    vctrace(TC_HTTP, "httpd %s%s\n", ebuf,
+		    harmless? " (harmless)": "");
 	} else {
 	    ebuf = "session EOF";
 	}
@@ -233,9 +367,14 @@ hio_socket_input(iosrc_t fd, ioid_t id)
 	    /* Stop input on this socket. */
 	    RemoveInput(session->ioid);
 	    session->ioid = NULL_IOID;
-	} else if (session->toid == NULL_IOID) {
-	    /* Leave input enabled and start the timeout. */
-	    session->toid = AddTimeOut(IDLE_MAX * 1000, hio_timeout);
+	} else if (!rearm_pending(&session->timer) &&
+		!httpd_ws_active(session->dhandle)) {
+	    /*
+	     * Leave input enabled and start the timeout. WebSockets stay open
+	     * until the client closes them. Since the timer was only
+	     * cancelled above, this just moves its deadline.
+	     */
+	    rearm_set(&session->timer, IDLE_MAX * 1000, IDLE_SLACK_MS);
 	}
     }
 }
@@ -271,7 +410,7 @@ hio_connection(iosrc_t fd, ioid_t id)
 	}
     } FOREACH_LLIST_END(&sessions, session, session_t *);
     if (!found) {
-	vtrace("httpd accept: session not found\n");
+	vctrace(TC_HTTP, "httpd accept: session not found\n");
 	return;
     }
 
@@ -279,35 +418,55 @@ hio_connection(iosrc_t fd, ioid_t id)
     len = sizeof(sa);
     t = accept(l->listen_s, &sa.sa, &len);
     if (t == INVALID_SOCKET) {
-	vtrace("httpd accept error: %s%s\n", socket_errtext(),
+	vctrace(TC_HTTP, "httpd accept error: %s%s\n", socket_errtext(),
 		(socket_errno() == SE_EWOULDBLOCK)? " (harmless)": "");
 	return;
     }
     if (l->n_sessions >= N_SESSIONS) {
-	vtrace("Too many connections.\n");
-	SOCK_CLOSE(t);
-	return;
+	session_t *idle = NULL;
+
+	/*
+	 * Make room by closing the least-recently used session that is not
+	 * waiting for a request to complete or streaming to a WebSocket.
+	 */
+	FOREACH_LLIST(&sessions, session, session_t *) {
+	    if (session->listener == l && session->ioid != NULL_IOID &&
+		    !httpd_ws_active(session->dhandle)) {
+		idle = session;
+	    }
+	} FOREACH_LLIST_END(&sessions, session, session_t *);
+	if (idle == NULL) {
+	    vctrace(TC_HTTP, "Too many connections.\n");
+	    SOCK_CLOSE(t);
+	    return;
+	}
+	httpd_close(idle->dhandle, "too many connections");
+	hio_socket_close(idle);
     }
 
 #if !defined(_WIN32) /*[*/
     fcntl(t, F_SETFD, 1);
+
+    /* Output is queued and drained, so sends must never block. */
+    fcntl(t, F_SETFL, fcntl(t, F_GETFL) | O_NONBLOCK);
 #endif /*]*/
 
     session = Malloc(sizeof(session_t));
     memset(session, 0, sizeof(session_t));
     session->listener = l;
     vb_init(&session->pending.result);
+    vb_init(&session->outq);
     session->s = t;
 #if defined(_WIN32) /*[*/
     session->event = CreateEvent(NULL, FALSE, FALSE, NULL);
     if (session->event == NULL) {
-	vtrace("httpd: can't create socket handle\n");
+	vctrace(TC_HTTP, "httpd: can't create socket handle\n");
 	SOCK_CLOSE(t);
 	Free(session);
 	return;
     }
     if (WSAEventSelect(session->s, session->event, FD_READ | FD_CLOSE) != 0) {
-	vtrace("httpd: Can't set socket handle events\n");
+	vctrace(TC_HTTP, "httpd: Can't set socket handle events\n");
 	CloseHandle(session->event);
 	SOCK_CLOSE(t);
 	Free(session);
@@ -340,9 +499,10 @@ hio_connection(iosrc_t fd, ioid_t id)
 #endif /*]*/
 
     /* Set the timeout for the first line of input. */
-    session->toid = AddTimeOut(IDLE_MAX * 1000, hio_timeout);
+    rearm_init(&session->timer, hio_timeout);
+    rearm_set(&session->timer, IDLE_MAX * 1000, IDLE_SLACK_MS);
 
-    LLIST_APPEND(&session->link, sessions);
+    LLIST_PREPEND(&session->link, sessions);
     l->n_sessions++;
 }
 
@@ -424,7 +584,7 @@ hio_init_x(struct sockaddr *sa, socklen_t sa_len)
 	l->desc = xs_buffer("%s:%u", inet_ntop(sa->sa_family,
 		    &sin->sin_addr, hostbuf, sizeof(hostbuf)),
 		ntohs(sin->sin_port));
-	vtrace("Listening for HTTP on %s\n", l->desc);
+	vctrace(TC_HTTP, "Listening for HTTP on %s\n", l->desc);
     }
 #if defined(X3270_IPV6) /*[*/
     else if (sa->sa_family == AF_INET6) {
@@ -433,7 +593,7 @@ hio_init_x(struct sockaddr *sa, socklen_t sa_len)
 	l->desc = xs_buffer("[%s]:%u", inet_ntop(sa->sa_family,
 		&sin6->sin6_addr, hostbuf, sizeof(hostbuf)),
 	    ntohs(sin6->sin6_port));
-	vtrace("Listening for HTTP on %s\n", l->desc);
+	vctrace(TC_HTTP, "Listening for HTTP on %s\n", l->desc);
     }
 #endif /*]*/
 
@@ -493,7 +653,8 @@ hio_stop_x(hio_listener_t *l)
     } FOREACH_LLIST_END(&sessions, session, session_t *);
 
     l->n_sessions = 0;
-    vtrace("Stopped listening for HTTP connections on %s\n", l->desc);
+    vctrace(TC_HTTP, "Stopped listening for HTTP connections on %s\n",
+	    l->desc);
     Replace(l->desc, NULL);
     llist_unlink(&l->link);
     Free(l);
@@ -524,10 +685,75 @@ hio_send(void *mhandle, const char *buf, size_t len)
     session_t *s = mhandle;
     ssize_t nw;
 
-    nw = send(s->s, buf, (int)len, 0);
-    if (nw < 0) {
-	vtrace("http send error: %s\n", socket_errtext());
+    if (s->overflow) {
+	/* The session is being dropped. */
+	return;
     }
+
+#if !defined(_WIN32) /*[*/
+    if (vb_len(&s->outq) > s->outq_sent) {
+	/* Stay behind what is already queued. */
+	nw = 0;
+    } else
+#endif /*]*/
+    {
+	nw = send(s->s, buf, (int)len, 0);
+	if (nw < 0) {
+#if !defined(_WIN32) /*[*/
+	    if (socket_errno() == SE_EWOULDBLOCK) {
+		nw = 0;
+	    } else
+#endif /*]*/
+	    {
+		vctrace(TC_HTTP, "http send error: %s\n", socket_errtext());
+		return;
+	    }
+	}
+    }
+    if ((size_t)nw == len) {
+	return;
+    }
+
+#if !defined(_WIN32) /*[*/
+    /* Queue the rest, to be sent when the socket is writable. */
+    if (vb_len(&s->outq) - s->outq_sent + (len - nw) > OUTQ_MAX) {
+	vctrace(TC_HTTP, "httpd output queue overflow, dropping session\n");
+	s->overflow = true;
+	vb_reset(&s->outq);
+	s->outq_sent = 0;
+	if (s->oid != NULL_IOID) {
+	    RemoveInput(s->oid);
+	    s->oid = NULL_IOID;
+	}
+	if (s->ioid != NULL_IOID) {
+	    RemoveInput(s->ioid);
+	    s->ioid = NULL_IOID;
+	}
+
+	/* Close it from the main loop, not from inside this call chain. */
+	rearm_set(&s->timer, 1, 0);
+	return;
+    }
+    vb_append(&s->outq, buf + nw, len - nw);
+    if (s->oid == NULL_IOID) {
+	s->oid = AddOutput(s->s, hio_socket_output);
+    }
+#endif /*]*/
+}
+
+/**
+ * Check for a session with a backlog of output.
+ *
+ * @param[in] mhandle	our handle
+ *
+ * @return true if the client is not keeping up with output
+ */
+bool
+hio_output_full(void *mhandle)
+{
+    session_t *s = mhandle;
+
+    return s->overflow || vb_len(&s->outq) - s->outq_sent >= OUTQ_THROTTLE;
 }
 
 /**
@@ -569,37 +795,9 @@ hio_data(task_cbh handle, const char *buf, size_t len, bool success)
 	    }
 	}
     } else if (s->pending.content_type == CT_JSON) {
-	size_t i;
-	char c;
-
 	/* Quote JSON in the response. */
 	vb_appends(&s->pending.result, "  \"");
-	for (i = 0; i < len; i++) {
-	    c = buf[i];
-	    switch (c) {
-	    case '"':
-		vb_appends(&s->pending.result, "\\\"");
-		break;
-	    case '\\':
-		vb_appends(&s->pending.result, "\\\\");
-		break;
-	    case '\r':
-		vb_appends(&s->pending.result, "\\r");
-		break;
-	    case '\n':
-		vb_appends(&s->pending.result, "\\n");
-		break;
-	    case '\t':
-		vb_appends(&s->pending.result, "\\t");
-		break;
-	    case '\f':
-		vb_appends(&s->pending.result, "\\f");
-		break;
-	    default:
-		vb_append(&s->pending.result, &c, 1);
-		break;
-	    }
-	}
+	ser_json_text(&s->pending.result, buf, len);
 	vb_appends(&s->pending.result, "\",");
     } else {
 	/* Plain text. */
@@ -625,6 +823,7 @@ hio_complete(task_cbh handle, bool success, bool abort)
 
     /* We're done. */
     s->pending.done = true;
+    s->pending.running = false;
 
     /* Pass the result up to the node. */
     s->pending.callback(s->dhandle, success? SC_SUCCESS: SC_USER_ERROR,
@@ -652,14 +851,6 @@ sendto_t
 hio_to3270(const char *cmd, sendto_callback_t *callback, void *dhandle,
 	content_t content_type)
 {
-    static tcb_t httpd_cb = {
-	"httpd",
-	IA_HTTPD,
-	CB_NEW_TASKQ,
-	hio_data,
-	hio_complete,
-	NULL
-    };
     size_t sl;
     session_t *s = httpd_mhandle(dhandle);
 
@@ -685,7 +876,21 @@ hio_to3270(const char *cmd, sendto_callback_t *callback, void *dhandle,
     s->pending.callback = callback;
     s->pending.content_type = content_type;
     s->pending.done = false;
+    span_done(s->pending.span, false);
+    s->pending.span = span_new("httpd", httpd_fetch_field(dhandle,
+		"traceparent"));
+    if (hio_output_full(s)) {
+	/* Hold the command until the client catches up. */
+	vctrace(TC_HTTP, "httpd output backlog, deferring command\n");
+	Replace(s->pending.deferred, Malloc(sl + 1));
+	memcpy(s->pending.deferred, cmd, sl);
+	s->pending.deferred[sl] = '\0';
+	return SENDTO_PENDING;
+    }
+    s->pending.running = true;
     push_cb(cmd, sl, &httpd_cb, s);
+    task_cb_span(s, s->pending.span);
+    s->pending.span = NULL;
 
     /*
      * It's possible for the command to have completed already.
@@ -711,6 +916,22 @@ hio_async_done(void *dhandle, httpd_status_t rv)
 	return;
     }
 
+    if (session->overflow) {
+	/* The session is being dropped. */
+	return;
+    }
+
+    /* Process any requests that were pipelined behind this one. */
+    rv = httpd_input_held(dhandle);
+    if (rv < 0) {
+	httpd_close(dhandle, "protocol error");
+	hio_socket_close(session);
+	return;
+    } else if (rv == HS_PENDING) {
+	/* Another request is pending; leave input stopped. */
+	return;
+    }
+
     /* Allow more input. */
     if (session->ioid == NULL_IOID) {
 #if !defined(_WIN32) /*[*/
@@ -725,8 +946,8 @@ hio_async_done(void *dhandle, httpd_status_t rv)
      * as soon as the last input arrived, because it might have taken us a
      * long time to proces the last request.
      */
-    if (session->toid == NULL_IOID) {
-	session->toid = AddTimeOut(IDLE_MAX * 1000, hio_timeout);
+    if (!rearm_pending(&session->timer) && !httpd_ws_active(dhandle)) {
+	rearm_set(&session->timer, IDLE_MAX * 1000, IDLE_SLACK_MS);
     }
 }
 
@@ -42,8 +42,26 @@
 #include <fcntl.h>
 #include <assert.h>
 
+#include "3270ds.h"
+#include "ctlr.h"
+#include "ctlrc.h"
+#include "footprint.h"
 #include "fprint_screen.h"
-#include "varbuf.h"
+#include "host.h"
+#include "keylat.h"
+#include "kybd.h"
+#include "lazya.h"
+#include "nvt.h"
+#include "rtime.h"
+#include "screenhist.h"
+#include "stats.h"
+#include "telnet.h"
+#include "toggles.h"
+#include "toupper.h"
+#include "unicodec.h"
+#include "utils.h"
+#include "varbuf.h"	/* must precede serialize.h */
+#include "serialize.h"
 
 #include "httpd-core.h"
 #include "httpd-io.h"
@@ -56,6 +74,27 @@
 extern unsigned char favicon[];
 extern unsigned favicon_size;
 
+/* Live screen WebSocket subscribers. */
+#define LIVE_TICK_MS	100	/* how often to check for screen changes */
+typedef struct _live {
+    struct _live *next;
+    void *dhandle;	/* connection */
+    char **row_text;	/* text of each row last sent */
+    int rows, cols;	/* screen size last sent */
+    int cursor;		/* cursor address last sent */
+} live_t;
+static live_t *live_subs = NULL;
+static ioid_t live_id = NULL_IOID;
+static unsigned long live_gen = 0; /* screen generation last checked */
+static int live_rows = 0, live_cols = 0, live_cursor = -1;
+static bool live_behind = false; /* a subscriber was skipped */
+
+/* Cached HTML screen image. */
+static varbuf_t image_cache;
+static bool image_cached = false;
+static unsigned long image_gen;	/* screen generation it was rendered from */
+static int image_rows, image_cols;
+
 /**
  * Capture the screen image.
  *
@@ -74,6 +113,14 @@ hn_image(void *dhandle, varbuf_t *image, httpd_status_t *status)
     char *temp_name;
     char buf[8192];
 
+    /* If the screen has not changed since the last time, use that image. */
+    if (image_cached && image_gen == screen_generation &&
+	    image_rows == ROWS && image_cols == COLS) {
+	vb_init(image);
+	vb_append(image, vb_buf(&image_cache), vb_len(&image_cache));
+	return true;
+    }
+
     /* Open the temporary file. */
 #if defined(_WIN32) /*[*/
     fd = win_mkstemp(&temp_name, P_HTML);
@@ -131,6 +178,17 @@ hn_image(void *dhandle, varbuf_t *image, httpd_status_t *status)
     unlink(temp_name);
     Free(temp_name);
 
+    /* Remember it. */
+    if (!image_cached) {
+	vb_init(&image_cache);
+	image_cached = true;
+    }
+    vb_reset(&image_cache);
+    vb_append(&image_cache, vb_buf(image), vb_len(image));
+    image_gen = screen_generation;
+    image_rows = ROWS;
+    image_cols = COLS;
+
     /* Success. */
     return true;
 }
@@ -149,6 +207,13 @@ hn_screen_image(const char *uri, void *dhandle)
     httpd_status_t rv;
     varbuf_t r;
 
+    /* Let the client keep its copy if the screen has not changed. */
+    rv = httpd_dyn_etag(dhandle, lazyaf("\"%lu-%dx%d\"", screen_generation,
+		ROWS, COLS));
+    if (rv != HS_CONTINUE) {
+	return rv;
+    }
+
     /* Get the image. */
     if (hn_image(dhandle, &r, &rv)) {
 	/* Success: Write the response. */
@@ -163,6 +228,123 @@ hn_screen_image(const char *uri, void *dhandle)
     return rv;
 }
 
+/**
+ * Callback for the resource footprint dynamic node.
+ *
+ * @param[in] uri	URI
+ * @param[in] dhandle	Session handle
+ *
+ * @return httpd_status_t
+ */
+static httpd_status_t
+hn_footprint(const char *uri _is_unused, void *dhandle)
+{
+    return httpd_dyn_complete(dhandle, "%s\n", footprint_dump());
+}
+
+/**
+ * Callback for the statistics dynamic node.
+ *
+ * @param[in] uri	URI
+ * @param[in] dhandle	Session handle
+ *
+ * @return httpd_status_t
+ */
+static httpd_status_t
+hn_stats(const char *uri _is_unused, void *dhandle)
+{
+    return httpd_dyn_complete(dhandle, "%s\n", stats_dump());
+}
+
+/**
+ * Callback for the screen history nonterminal dynamic node
+ * (/3270/history). An empty fragment lists the saved screens; a number
+ * returns that screen.
+ *
+ * @param[in] url	URL fragment
+ * @param[in] dhandle	daemon handle
+ *
+ * @return httpd_status_t
+ */
+static httpd_status_t
+hn_history(const char *url, void *dhandle)
+{
+    const char *text;
+    char *errmsg;
+    char *ptr;
+    long n;
+
+    if (!*url) {
+	return httpd_dyn_complete(dhandle, "%s", screenhist_list());
+    }
+    n = strtol(url, &ptr, 10);
+    if (ptr == url || *ptr != '\0') {
+	return httpd_dyn_error(dhandle, CT_TEXT, 404,
+		"Invalid screen number.\n");
+    }
+    if ((text = screenhist_text((int)n, true, &errmsg)) == NULL) {
+	return httpd_dyn_error(dhandle, CT_TEXT, 404, "%s.\n", errmsg);
+    }
+    return httpd_dyn_complete(dhandle, "%s", text);
+}
+
+/**
+ * Escape a label value for OpenMetrics.
+ *
+ * @param[in] s		Value
+ *
+ * @return Escaped value
+ */
+static const char *
+metrics_label(const char *s)
+{
+    varbuf_t r;
+    char c;
+
+    vb_init(&r);
+    while ((c = *s++)) {
+	if (c == '\\' || c == '"') {
+	    vb_appendf(&r, "\\%c", c);
+	} else if (c == '\n') {
+	    vb_appends(&r, "\\n");
+	} else {
+	    vb_append(&r, &c, 1);
+	}
+    }
+    return lazya(vb_consume(&r));
+}
+
+/**
+ * Callback for the OpenMetrics dynamic node.
+ *
+ * Everything here comes straight from the counters and state variables,
+ * without running an action, so it can be scraped often.
+ *
+ * @param[in] uri	URI
+ * @param[in] dhandle	Session handle
+ *
+ * @return httpd_status_t
+ */
+static httpd_status_t
+hn_metrics(const char *uri _is_unused, void *dhandle)
+{
+    return httpd_dyn_complete(dhandle, "%s%s%s\
+# TYPE x3270_connected gauge\n\
+x3270_connected %d\n\
+# TYPE x3270_connection info\n\
+x3270_connection_info{state=\"%s\",host=\"%s\"} 1\n\
+# TYPE x3270_keyboard_locked gauge\n\
+x3270_keyboard_locked %d\n\
+# EOF\n",
+	    stats_metrics(),
+	    rtime_metrics(),
+	    keylat_metrics(),
+	    CONNECTED,
+	    state_name[cstate],
+	    metrics_label(PCONNECTED? current_host: ""),
+	    (kybdlock & ~KL_NOT_CONNECTED) != 0);
+}
+
 /* The tiny HTML form on the interactive page. */
 #define CMD_FORM \
 "<form method=\"GET\" accept-charset=\"UTF-8\" target=\"_self\">\n\
@@ -570,6 +752,293 @@ rest_json_dyn(const char *url, void *dhandle)
     }
 }
 
+/**
+ * Render one row of the screen as UTF-8 text.
+ *
+ * @param[in] row	Row number, 0-origin
+ *
+ * @return Text, must be freed
+ */
+static char *
+live_row_text(int row)
+{
+    varbuf_t r;
+    int first = row * COLS;
+    bool is_zero;
+    int i;
+
+    vb_init(&r);
+    is_zero = FA_IS_ZERO(get_field_attribute(first));
+    for (i = first; i < first + COLS; i++) {
+	char mb[16];
+	ucs4_t uc;
+	size_t xlen;
+
+	if (ea_buf[i].fa) {
+	    is_zero = FA_IS_ZERO(ea_buf[i].fa);
+	    vb_appends(&r, " ");
+	    continue;
+	}
+	if (is_zero) {
+	    vb_appends(&r, " ");
+	    continue;
+	}
+	if (IS_RIGHT(ctlr_dbcs_state(i))) {
+	    continue;
+	}
+	if (is_nvt(&ea_buf[i], false, &uc)) {
+	    if (toggled(MONOCASE)) {
+		uc = u_toupper(uc);
+	    }
+	    xlen = unicode_to_multibyte_f(uc, mb, sizeof(mb), true);
+	} else if (IS_LEFT(ctlr_dbcs_state(i)) && i + 1 < first + COLS) {
+	    xlen = ebcdic_to_multibyte_f((ea_buf[i].ec << 8) | ea_buf[i + 1].ec,
+		    mb, sizeof(mb), true);
+	} else {
+	    xlen = ebcdic_to_multibyte_fx(ea_buf[i].ec, ea_buf[i].cs, mb,
+		    sizeof(mb),
+		    EUO_BLANK_UNDEF | (toggled(MONOCASE)? EUO_TOUPPER: 0),
+		    &uc, true);
+	}
+	if (xlen > 0) {
+	    vb_append(&r, mb, xlen - 1);
+	}
+    }
+    return vb_consume(&r);
+}
+
+/**
+ * Append a JSON-quoted string to a buffer.
+ *
+ * @param[in,out] r	Buffer
+ * @param[in] s		String to quote
+ */
+static void
+live_json_quote(varbuf_t *r, const char *s)
+{
+    vb_appends(r, "\"");
+    ser_json_text(r, s, strlen(s));
+    vb_appends(r, "\"");
+}
+
+/**
+ * Free the row text saved for a subscriber.
+ *
+ * @param[in,out] l	Subscriber
+ */
+static void
+live_free_rows(live_t *l)
+{
+    int i;
+
+    if (l->row_text != NULL) {
+	for (i = 0; i < l->rows; i++) {
+	    Free(l->row_text[i]);
+	}
+	Replace(l->row_text, NULL);
+    }
+}
+
+/**
+ * Send the changes since the last update to one subscriber.
+ *
+ * The message has the same shape as the b3270 screen indication: an
+ * optional erase with the new size, the cursor position, and the text of
+ * each row that changed.
+ *
+ * @param[in,out] l	Subscriber
+ * @param[in] text	Current text of each row
+ */
+static void
+live_update(live_t *l, char **text)
+{
+    varbuf_t r;
+    bool any = false;
+    bool any_rows = false;
+    int i;
+
+    vb_init(&r);
+    vb_appends(&r, "{\"screen\":{");
+    if (l->row_text == NULL || l->rows != ROWS || l->cols != COLS) {
+	live_free_rows(l);
+	l->rows = ROWS;
+	l->cols = COLS;
+	l->row_text = (char **)Calloc(ROWS, sizeof(char *));
+	l->cursor = -1;
+	vb_appendf(&r, "\"erase\":{\"rows\":%d,\"columns\":%d},", ROWS,
+		COLS);
+	any = true;
+    }
+    if (l->cursor != cursor_addr) {
+	vb_appendf(&r, "\"cursor\":{\"row\":%d,\"column\":%d},",
+		(cursor_addr / COLS) + 1, (cursor_addr % COLS) + 1);
+	l->cursor = cursor_addr;
+	any = true;
+    }
+    vb_appends(&r, "\"rows\":[");
+    for (i = 0; i < ROWS; i++) {
+	if (l->row_text[i] != NULL && !strcmp(l->row_text[i], text[i])) {
+	    continue;
+	}
+	vb_appendf(&r, "%s{\"row\":%d,\"text\":", any_rows? ",": "", i + 1);
+	live_json_quote(&r, text[i]);
+	vb_appends(&r, "}");
+	Replace(l->row_text[i], NewString(text[i]));
+	any = any_rows = true;
+    }
+    vb_appends(&r, "]}}");
+
+    if (any) {
+	httpd_ws_send(l->dhandle, vb_buf(&r), vb_len(&r));
+    }
+    vb_free(&r);
+}
+
+/**
+ * Render each row of the screen as text.
+ *
+ * @return Array of row text, must be freed with live_free_text()
+ */
+static char **
+live_render(void)
+{
+    char **text = (char **)Malloc(ROWS * sizeof(char *));
+    int i;
+
+    for (i = 0; i < ROWS; i++) {
+	text[i] = live_row_text(i);
+    }
+    return text;
+}
+
+/**
+ * Free rendered row text.
+ *
+ * @param[in] text	Array returned by live_render()
+ */
+static void
+live_free_text(char **text)
+{
+    int i;
+
+    for (i = 0; i < ROWS; i++) {
+	Free(text[i]);
+    }
+    Free(text);
+}
+
+/**
+ * Check for screen changes and push them to the live subscribers.
+ */
+static void
+live_push(void)
+{
+    char **text;
+    live_t *l;
+
+    if (!live_behind && live_gen == screen_generation && live_rows == ROWS &&
+	    live_cols == COLS && live_cursor == cursor_addr) {
+	return;
+    }
+    live_gen = screen_generation;
+    live_rows = ROWS;
+    live_cols = COLS;
+    live_cursor = cursor_addr;
+    live_behind = false;
+
+    /* Render the screen once for all of the subscribers. */
+    text = live_render();
+    for (l = live_subs; l != NULL; l = l->next) {
+	/*
+	 * Skip subscribers that are not keeping up. They still have the
+	 * rows they were last sent, so they catch up on a later tick.
+	 */
+	if (hio_output_full(httpd_mhandle(l->dhandle))) {
+	    live_behind = true;
+	} else {
+	    live_update(l, text);
+	}
+    }
+    live_free_text(text);
+}
+
+/**
+ * Timeout callback for the live screen check.
+ *
+ * @param[in] id	Timeout ID
+ */
+static void
+live_tick(ioid_t id _is_unused)
+{
+    live_id = NULL_IOID;
+    if (live_subs != NULL) {
+	live_push();
+	live_id = AddTimeOut(LIVE_TICK_MS, live_tick);
+    }
+}
+
+/**
+ * A live screen WebSocket has been closed.
+ *
+ * @param[in] dhandle	Session handle
+ */
+static void
+live_closed(void *dhandle)
+{
+    live_t **lp;
+    live_t *l;
+
+    for (lp = &live_subs; (l = *lp) != NULL; lp = &l->next) {
+	if (l->dhandle == dhandle) {
+	    *lp = l->next;
+	    live_free_rows(l);
+	    Free(l);
+	    break;
+	}
+    }
+    if (live_subs == NULL && live_id != NULL_IOID) {
+	RemoveTimeOut(live_id);
+	live_id = NULL_IOID;
+    }
+}
+
+/**
+ * Callback for the live screen WebSocket node.
+ *
+ * @param[in] uri	URI
+ * @param[in] dhandle	Session handle
+ *
+ * @return httpd_status_t
+ */
+static httpd_status_t
+hn_live(const char *uri, void *dhandle)
+{
+    httpd_status_t rv;
+    live_t *l;
+    char **text;
+
+    rv = httpd_ws_upgrade(dhandle, live_closed);
+    if (rv != HS_SUCCESS_OPEN) {
+	return rv;
+    }
+
+    l = (live_t *)Calloc(1, sizeof(live_t));
+    l->dhandle = dhandle;
+    l->cursor = -1;
+
+    /* Send the current screen to the new subscriber. */
+    text = live_render();
+    live_update(l, text);
+    live_free_text(text);
+
+    l->next = live_subs;
+    live_subs = l;
+    if (live_id == NULL_IOID) {
+	live_id = AddTimeOut(LIVE_TICK_MS, live_tick);
+    }
+    return rv;
+}
+
 /**
  * Initialize the HTTP object hierarchy.
  */
@@ -589,7 +1058,18 @@ httpd_objects_init(void)
 	    CT_HTML, "text/html; charset=utf-8", HF_TRAILER, hn_screen_image);
     httpd_register_dyn_term("/3270/interact.html", "Interactive form",
 	    CT_HTML, "text/html; charset=utf-8", HF_TRAILER, hn_interact);
+    httpd_register_dyn_term("/3270/live", "Live screen updates (WebSocket)",
+	    CT_TEXT, "text/plain; charset=utf-8", HF_NONE, hn_live);
+    httpd_register_dyn_term("/3270/stats", "Statistics",
+	    CT_TEXT, "text/plain; charset=utf-8", HF_NONE, hn_stats);
+    httpd_register_dyn_term("/3270/footprint", "Resource footprint",
+	    CT_TEXT, "text/plain; charset=utf-8", HF_NONE, hn_footprint);
+    httpd_register_dyn_nonterm("/3270/history", "Screen history", CT_TEXT,
+	    "text/plain; charset=utf-8", HF_NONE, hn_history);
     httpd_register_dir("/3270/rest", "REST interface");
+    httpd_register_dyn_term("/metrics", "OpenMetrics",
+	    CT_TEXT, "application/openmetrics-text; version=1.0.0; "
+		"charset=utf-8", HF_NONE, hn_metrics);
     httpd_register_fixed_binary("/favicon.ico", "Browser icon",
 	    CT_BINARY, "image/vnd.microsoft.icon", HF_HIDDEN, favicon,
 	    favicon_size);
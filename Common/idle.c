@@ -42,6 +42,7 @@
 #include "host.h"
 #include "idle.h"
 #include "popups.h"
+#include "rearm.h"
 #include "resources.h"
 #include "task.h"
 #include "trace.h"
@@ -64,12 +65,12 @@ enum idle_enum idle_user_enabled = IDLE_DISABLED;
 static bool idle_enabled = false;	/* validated and user-enabled */
 static unsigned long idle_n = 0L;
 static unsigned long idle_multiplier = IDLE_SEC;
-static ioid_t idle_id;
+static rearm_t idle_timer;
 static unsigned long idle_ms;
 static bool idle_randomize = false;
-static bool idle_ticking = false;
 
 static void idle_in3270(bool in3270);
+static void idle_timeout(rearm_t *r);
 static void push_idle(char *s);
 
 /**
@@ -81,6 +82,8 @@ idle_register(void)
     /* Register for state changes. */
     register_schange(ST_3270_MODE, idle_in3270);
     register_schange(ST_CONNECT, idle_in3270);
+
+    rearm_init(&idle_timer, idle_timeout);
 }
 
 /* Initialization. */
@@ -175,10 +178,7 @@ idle_in3270(bool in3270 _is_unused)
 	reset_idle_timer();
     } else {
 	/* Not in 3270 mode any more, turn off the timeout. */
-	if (idle_ticking) {
-	    RemoveTimeOut(idle_id);
-	    idle_ticking = false;
-	}
+	rearm_cancel(&idle_timer);
 
 	/* If the user didn't want it to be permanent, disable it. */
 	if (idle_user_enabled != IDLE_PERM) {
@@ -191,10 +191,9 @@ idle_in3270(bool in3270 _is_unused)
  * Idle timeout.
  */
 static void
-idle_timeout(ioid_t id _is_unused)
+idle_timeout(rearm_t *r _is_unused)
 {
     vtrace("Idle timeout\n");
-    idle_ticking = false;
     if (ft_state != FT_NONE) {
 	/* Should not happen, but just in case. */
 	vtrace("File transfer in progress, ignoring\n");
@@ -207,7 +206,8 @@ idle_timeout(ioid_t id _is_unused)
 
 /*
  * Reset (and re-enable) the idle timer.  Called when the user presses a key or
- * clicks with the mouse.
+ * clicks with the mouse, so it moves the deadline in place rather than
+ * replacing the timeout.
  */
 void
 reset_idle_timer(void)
@@ -215,10 +215,6 @@ reset_idle_timer(void)
     if (idle_enabled) {
 	unsigned long idle_ms_now;
 
-	if (idle_ticking) {
-	    RemoveTimeOut(idle_id);
-	    idle_ticking = false;
-	}
 	idle_ms_now = idle_ms;
 	if (idle_randomize) {
 	    idle_ms_now = idle_ms;
@@ -231,8 +227,7 @@ reset_idle_timer(void)
 #if defined(DEBUG_IDLE_TIMEOUT) /*[*/
 	vtrace("Setting idle timeout to %lu\n", idle_ms_now);
 #endif /*]*/
-	idle_id = AddTimeOut(idle_ms_now, idle_timeout);
-	idle_ticking = true;
+	rearm_set(&idle_timer, idle_ms_now, 0);
     }
 }
 
@@ -243,10 +238,7 @@ reset_idle_timer(void)
 void
 cancel_idle_timer(void)
 {
-    if (idle_ticking) {
-	RemoveTimeOut(idle_id);
-	idle_ticking = false;
-    }
+    rearm_cancel(&idle_timer);
     idle_enabled = false;
 }
 
@@ -256,11 +248,7 @@ cancel_idle_timer(void)
 void
 idle_ft_start(void)
 {
-    if (idle_ticking)
-    {
-	RemoveTimeOut(idle_id);
-	idle_ticking = false;
-    }
+    rearm_cancel(&idle_timer);
 }
 
 /*
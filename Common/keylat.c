@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	keylat.c
+ *		Keystroke-to-wire latency.
+ *
+ * One in keyLatencySample key events is followed from the key arriving
+ * to the resulting bytes being written to the host, with a timestamp at
+ * each stage on the way. Each stage has its own histogram, in
+ * microseconds, and each completed sample is written to the trace.
+ * Only one key event is followed at a time.
+ */
+
+#include "globals.h"
+
+#include "appres.h"
+#include "hist.h"
+#include "keylat.h"
+#include "lazya.h"
+#include "names.h"
+#include "popups.h"
+#include "query.h"
+#include "resources.h"
+#include "toggles.h"
+#include "trace.h"
+#include "utils.h"
+#include "varbuf.h"
+
+static const char *stage_name[KEYLAT_NSTAGES] = {
+    "keymap", "typeahead", "dispatch", "encode", "write", "total"
+};
+
+static enum {
+    KS_IDLE,		/* no sample */
+    KS_RUNNING,		/* sample is running */
+    KS_QUEUED		/* sample is on the typeahead queue */
+} state = KS_IDLE;
+
+static struct timeval key_time;	/* time of the last key event */
+static bool key_pending;	/* key_time has not been used yet */
+static unsigned long key_events; /* key events seen */
+static struct timeval t_start;	/* start of the sample */
+static struct timeval t_last;	/* last stage of the sample */
+static unsigned long usec[KEYLAT_NSTAGES]; /* time in each stage */
+static unsigned seen;		/* stages reached, as a bit mask */
+static hist_t hists[KEYLAT_NSTAGES];
+
+#define STAGE_BIT(s)	(1U << (s))
+
+/* Compute the time between two timestamps, in microseconds. */
+static unsigned long
+delta_usec(struct timeval *t1, struct timeval *t0)
+{
+    long d = ((t1->tv_sec - t0->tv_sec) * 1000000L) +
+	(t1->tv_usec - t0->tv_usec);
+
+    return (d > 0)? (unsigned long)d: 0;
+}
+
+/* Charge the time since the last stage to a stage. */
+static void
+mark(keylat_stage_t stage)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+    usec[stage] += delta_usec(&now, &t_last);
+    seen |= STAGE_BIT(stage);
+    t_last = now;
+}
+
+/*
+ * A key event has arrived, and is about to be looked up in the keymap.
+ */
+void
+keylat_key(void)
+{
+    if (appres.key_latency_sample > 0 && state == KS_IDLE) {
+	gettimeofday(&key_time, NULL);
+	key_pending = true;
+    }
+}
+
+/*
+ * A keyboard action is starting. This is where a sample may begin.
+ */
+void
+keylat_action(void)
+{
+    bool from_key = key_pending;
+
+    key_pending = false;
+    if (appres.key_latency_sample <= 0 || state != KS_IDLE ||
+	    ++key_events % appres.key_latency_sample) {
+	return;
+    }
+
+    memset(usec, 0, sizeof(usec));
+    seen = 0;
+    if (from_key) {
+	t_start = t_last = key_time;
+	mark(KEYLAT_KEYMAP);
+    } else {
+	gettimeofday(&t_start, NULL);
+	t_last = t_start;
+    }
+    state = KS_RUNNING;
+}
+
+/*
+ * An action has finished. If the sample got as far as the host, record
+ * it. Otherwise, forget it.
+ */
+void
+keylat_end(void)
+{
+    varbuf_t r;
+    int i;
+
+    if (state != KS_RUNNING) {
+	return;
+    }
+    state = KS_IDLE;
+    if (!(seen & STAGE_BIT(KEYLAT_WRITE))) {
+	return;
+    }
+
+    usec[KEYLAT_TOTAL] = delta_usec(&t_last, &t_start);
+    seen |= STAGE_BIT(KEYLAT_TOTAL);
+    vb_init(&r);
+    for (i = 0; i < KEYLAT_NSTAGES; i++) {
+	if (seen & STAGE_BIT(i)) {
+	    hist_add(&hists[i], usec[i]);
+	    vb_appendf(&r, " %s %.3fms", stage_name[i], usec[i] / 1000.0);
+	}
+    }
+    vtrace("Key latency:%s\n", vb_buf(&r));
+    vb_free(&r);
+}
+
+/*
+ * The running action is being put on the typeahead queue.
+ * Returns true if the queue entry carries the sample.
+ */
+bool
+keylat_enqueue(void)
+{
+    if (state != KS_RUNNING) {
+	return false;
+    }
+    mark(KEYLAT_DISPATCH);
+    state = KS_QUEUED;
+    return true;
+}
+
+/*
+ * The typeahead entry carrying the sample is about to run.
+ */
+void
+keylat_dequeue(void)
+{
+    if (state == KS_QUEUED) {
+	mark(KEYLAT_TYPEAHEAD);
+	state = KS_RUNNING;
+    }
+}
+
+/*
+ * The typeahead queue has been flushed.
+ */
+void
+keylat_flush(void)
+{
+    if (state == KS_QUEUED) {
+	state = KS_IDLE;
+    }
+}
+
+/*
+ * A stage has been reached.
+ */
+void
+keylat_stage(keylat_stage_t stage)
+{
+    if (state == KS_RUNNING) {
+	mark(stage);
+    }
+}
+
+/*
+ * Bytes have been written to the host.
+ * Keys that write directly, without an AID, are charged to the dispatch
+ * stage up to the write.
+ */
+void
+keylat_wire(void)
+{
+    if (state != KS_RUNNING) {
+	return;
+    }
+    if (!(seen & STAGE_BIT(KEYLAT_DISPATCH))) {
+	mark(KEYLAT_DISPATCH);
+    }
+    mark(KEYLAT_WRITE);
+}
+
+/*
+ * Key latency query.
+ * Returns one line per stage that has samples.
+ */
+static const char *
+keylat_query(void)
+{
+    varbuf_t r;
+    int i;
+
+    if (!hists[KEYLAT_TOTAL].count) {
+	return NULL;
+    }
+    vb_init(&r);
+    for (i = 0; i < KEYLAT_NSTAGES; i++) {
+	hist_t *h = &hists[i];
+
+	if (!h->count) {
+	    continue;
+	}
+	vb_appendf(&r, "%s%s count %lu mean-ms %.3f p50-ms %.3f p95-ms %.3f "
+		"p99-ms %.3f max-ms %.3f",
+		vb_len(&r)? "\n": "",
+		stage_name[i],
+		h->count,
+		(h->total / h->count) / 1000.0,
+		hist_pct(h, 50) / 1000.0,
+		hist_pct(h, 95) / 1000.0,
+		hist_pct(h, 99) / 1000.0,
+		h->max / 1000.0);
+    }
+    return lazya(vb_consume(&r));
+}
+
+/* Bucket boundaries for OpenMetrics. */
+static struct {
+    unsigned long usec;
+    const char *le;
+} metric_bounds[] = {
+    { 100, "0.0001" },
+    { 250, "0.00025" },
+    { 500, "0.0005" },
+    { 1000, "0.001" },
+    { 2500, "0.0025" },
+    { 5000, "0.005" },
+    { 10000, "0.01" },
+    { 25000, "0.025" },
+    { 50000, "0.05" },
+    { 100000, "0.1" },
+    { 250000, "0.25" },
+    { 1000000, "1.0" }
+};
+
+/*
+ * Format the per-stage histograms in OpenMetrics text format.
+ */
+const char *
+keylat_metrics(void)
+{
+    varbuf_t r;
+    int i;
+
+    vb_init(&r);
+    vb_appends(&r, "# TYPE x3270_key_latency_seconds histogram\n");
+    for (i = 0; i < KEYLAT_NSTAGES; i++) {
+	hist_t *h = &hists[i];
+	unsigned long cum = 0;
+	unsigned b = 0;
+	size_t j;
+
+	if (!h->count) {
+	    continue;
+	}
+	for (j = 0; j < array_count(metric_bounds); j++) {
+	    while (b < HIST_BUCKETS &&
+		    hist_bucket_top(b) <= metric_bounds[j].usec) {
+		cum += h->buckets[b++];
+	    }
+	    vb_appendf(&r, "x3270_key_latency_seconds_bucket{stage=\"%s\","
+		    "le=\"%s\"} %lu\n", stage_name[i], metric_bounds[j].le,
+		    cum);
+	}
+	vb_appendf(&r, "x3270_key_latency_seconds_bucket{stage=\"%s\","
+		"le=\"+Inf\"} %lu\n", stage_name[i], h->count);
+	vb_appendf(&r, "x3270_key_latency_seconds_count{stage=\"%s\"} %lu\n",
+		stage_name[i], h->count);
+	vb_appendf(&r, "x3270_key_latency_seconds_sum{stage=\"%s\"} %.6f\n",
+		stage_name[i], h->total / 1000000.0);
+    }
+    return lazya(vb_consume(&r));
+}
+
+/* The keyLatencySample resource changed. */
+static bool
+toggle_key_latency_sample(const char *name _is_unused, const char *value)
+{
+    unsigned long l;
+    char *end;
+    int n;
+
+    if (!*value) {
+	appres.key_latency_sample = 0;
+	return true;
+    }
+
+    l = strtoul(value, &end, 10);
+    n = (int)l;
+    if (*end != '\0' || (unsigned long)n != l || n < 0) {
+	popup_an_error("Invalid %s value", ResKeyLatencySample);
+	return false;
+    }
+
+    /* Start a fresh set of histograms each time sampling is turned on. */
+    if (n && !appres.key_latency_sample) {
+	int i;
+
+	for (i = 0; i < KEYLAT_NSTAGES; i++) {
+	    hist_clear(&hists[i]);
+	}
+    }
+    appres.key_latency_sample = n;
+    state = KS_IDLE;
+    key_pending = false;
+    return true;
+}
+
+/*
+ * Key latency module registration.
+ */
+void
+keylat_register(void)
+{
+    static query_t queries[] = {
+	{ KwKeyLatency, keylat_query, NULL, false, false }
+    };
+
+    register_extended_toggle(ResKeyLatencySample, toggle_key_latency_sample,
+	    NULL, NULL, (void **)&appres.key_latency_sample, XRM_INT);
+    register_queries(queries, array_count(queries));
+}
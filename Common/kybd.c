@@ -49,9 +49,11 @@
 #include "codepage.h"
 #include "ctlrc.h"
 #include "unicodec.h"
+#include "footprint.h"
 #include "ft.h"
 #include "host.h"
 #include "idle.h"
+#include "keylat.h"
 #include "kybd.h"
 #include "latin1.h"
 #include "lazya.h"
@@ -62,8 +64,10 @@
 #include "print_screen.h"
 #include "product.h"
 #include "screen.h"
+#include "screenhist.h"
 #include "scroll.h"
 #include "split_host.h"
+#include "stats.h"
 #include "stringscript.h"
 #include "task.h"
 #include "telnet.h"
@@ -93,9 +97,11 @@ static unsigned char pa_xlate[] = {
 #define PA_SZ	(sizeof(pa_xlate)/sizeof(pa_xlate[0]))
 static ioid_t unlock_id = NULL_IOID;
 static time_t unlock_delay_time;
+static struct timeval lock_start;
 static bool key_Character(unsigned ebc, bool with_ge, bool pasting,
 	bool oerr_fail, bool *consumed);
 static bool flush_ta(void);
+static size_t bulk_input(const ucs4_t *ws, size_t xlen, enum iaction ia);
 static void key_AID(unsigned char aid_code);
 static void kybdlock_set(unsigned int bits, const char *cause);
 static ks_t my_string_to_key(const char *s, enum keytype *keytypep,
@@ -119,21 +125,52 @@ static struct composite {
     struct akey translation;
 } *composites = NULL;
 static int n_composites = 0;
+
+/*
+ * Parsed compose maps, by name. An entry is reused as long as the resource
+ * text it was parsed from has not changed, so switching between compose
+ * maps does not parse them again.
+ */
+typedef struct compose_map {
+    struct compose_map *next;
+    char *name;			/* compose map name */
+    char *source;		/* resource text it was parsed from */
+    struct composite *composites; /* parsed entries */
+    int n_composites;		/* number of entries */
+} compose_map_t;
+static compose_map_t *compose_maps = NULL;
 static char *default_compose_map_name = NULL;
 static char *temporary_compose_map_name = NULL;
 
 #define ak_eq(k1, k2)	(((k1).ucs4  == (k2).ucs4) && \
 			 ((k1).keytype == (k2).keytype))
 
-typedef struct ta {
-    struct ta *next;
+/*
+ * Typeahead queue.
+ *
+ * The queue is a ring of fixed-size records, doubled in size when it fills.
+ * Short parameters (the common case, e.g., a single character for Key())
+ * are stored in the record itself; longer ones are copied to the heap.
+ */
+#define BULK_INPUT_MAX	256	/* longest run stored by bulk_input() */
+
+#define TA_INITIAL	64	/* initial ring size, must be a power of 2 */
+#define TA_PARM_INLINE	16	/* longest inline parameter, plus the NUL */
+typedef struct {
     const char *efn_name;
     action_t *fn;
-    const char *parm1;
-    const char *parm2;
+    unsigned nparms;
+    bool keylat;		/* carries the key latency sample */
+    char *long_parm[2];
+    char short_parm[2][TA_PARM_INLINE];
 } ta_t;
-ta_t *ta_head = (struct ta *) NULL;
-ta_t *ta_tail = (struct ta *) NULL;
+static ta_t *ta_ring = NULL;
+static unsigned ta_size = 0;
+static unsigned ta_first = 0;
+static unsigned ta_count = 0;
+
+#define TA_PARM(ta, i)	((ta)->long_parm[i]? (ta)->long_parm[i]: \
+			 (ta)->short_parm[i])
 
 static char dxl[] = "0123456789abcdef";
 #define FROM_HEX(c)	(int)(strchr(dxl, tolower((unsigned char)c)) - dxl)
@@ -249,6 +286,22 @@ static action_table_t kybd_dactions[] = {
     { AnCompose,	Compose_action,		ACTION_KE }
 };
 
+/*
+ * Store a parameter in a typeahead record.
+ */
+static void
+ta_store_parm(ta_t *ta, const char *parm)
+{
+    size_t len = strlen(parm);
+
+    if (len < TA_PARM_INLINE) {
+	memcpy(ta->short_parm[ta->nparms], parm, len + 1);
+    } else {
+	ta->long_parm[ta->nparms] = NewString(parm);
+    }
+    ta->nparms++;
+}
+
 /*
  * Put a function or action on the typeahead queue.
  */
@@ -259,50 +312,62 @@ enq_xta(const char *name, action_t *fn, const char *parm1, const char *parm2)
 
     /* If no connection, forget it. */
     if (!IN_3270 && !IN_NVT && !IN_SSCP) {
-	vtrace("  dropped (not connected)\n");
+	vctrace(TC_KYBD, "  dropped (not connected)\n");
 	return;
     }
 
     /* If operator error, complain and drop it. */
     if (kybdlock & KL_OERR_MASK) {
 	ring_bell();
-	vtrace("  dropped (operator error)\n");
+	vctrace(TC_KYBD, "  dropped (operator error)\n");
 	return;
     }
 
     /* If scroll lock, complain and drop it. */
     if (kybdlock & KL_SCROLLED) {
 	ring_bell();
-	vtrace("  dropped (scrolled)\n");
+	vctrace(TC_KYBD, "  dropped (scrolled)\n");
 	return;
     }
 
     /* If typeahead disabled, complain and drop it. */
     if (!toggled(TYPEAHEAD)) {
-	vtrace("  dropped (no typeahead)\n");
+	vctrace(TC_KYBD, "  dropped (no typeahead)\n");
 	return;
     }
 
-    ta = (ta_t *)Malloc(sizeof(*ta));
-    ta->next = NULL;
+    /* Grow the ring if it is full. */
+    if (ta_count == ta_size) {
+	unsigned new_size = ta_size? ta_size * 2: TA_INITIAL;
+	ta_t *new_ring = (ta_t *)Malloc(new_size * sizeof(ta_t));
+	unsigned i;
+
+	for (i = 0; i < ta_count; i++) {
+	    new_ring[i] = ta_ring[(ta_first + i) & (ta_size - 1)];
+	}
+	Free(ta_ring);
+	ta_ring = new_ring;
+	ta_size = new_size;
+	ta_first = 0;
+    }
+
+    ta = &ta_ring[(ta_first + ta_count) & (ta_size - 1)];
     ta->efn_name = name;
     ta->fn = fn;
-    ta->parm1 = ta->parm2 = NULL;
+    ta->nparms = 0;
+    ta->keylat = keylat_enqueue();
+    ta->long_parm[0] = ta->long_parm[1] = NULL;
     if (parm1) {
-	ta->parm1 = NewString(parm1);
+	ta_store_parm(ta, parm1);
 	if (parm2) {
-	    ta->parm2 = NewString(parm2);
+	    ta_store_parm(ta, parm2);
 	}
     }
-    if (ta_head) {
-	ta_tail->next = ta;
-    } else {
-	ta_head = ta;
+    if (!ta_count++) {
 	vstatus_typeahead(true);
     }
-    ta_tail = ta;
 
-    vtrace("  action queued (kybdlock 0x%x)\n", kybdlock);
+    vctrace(TC_KYBD, "  action queued (kybdlock 0x%x)\n", kybdlock);
 }
 
 /*
@@ -329,34 +394,40 @@ enq_fta(action_t *fn, const char *parm1, const char *parm2)
 bool
 run_ta(void)
 {
-    ta_t *ta;
+    ta_t ta;
+    const char *argv[2];
+    unsigned i;
 
-    if (kybdlock || (ta = ta_head) == NULL) {
+    if (kybdlock || !ta_count) {
 	return false;
     }
 
-    if ((ta_head = ta->next) == NULL) {
-	ta_tail = NULL;
+    /*
+     * Take a copy of the record, because the action may add to or flush
+     * the queue.
+     */
+    ta = ta_ring[ta_first];
+    ta_first = (ta_first + 1) & (ta_size - 1);
+    if (!--ta_count) {
 	vstatus_typeahead(false);
     }
 
-    if (ta->efn_name) {
-	run_action(ta->efn_name, IA_TYPEAHEAD, ta->parm1, ta->parm2);
+    for (i = 0; i < ta.nparms; i++) {
+	argv[i] = TA_PARM(&ta, i);
+    }
+    if (ta.keylat) {
+	keylat_dequeue();
+    }
+    if (ta.efn_name) {
+	run_action(ta.efn_name, IA_TYPEAHEAD,
+		(ta.nparms > 0)? argv[0]: NULL,
+		(ta.nparms > 1)? argv[1]: NULL);
     } else {
-	unsigned argc = 0;
-	const char *argv[2];
-
-	if (ta->parm1) {
-	    argv[argc++] = ta->parm1;
-	    if (ta->parm2) {
-		argv[argc++] = ta->parm2;
-	    }
-	}
-	(*ta->fn)(IA_TYPEAHEAD, argc, argv);
+	(*ta.fn)(IA_TYPEAHEAD, ta.nparms, argv);
+	keylat_end();
     }
-    Free((char *)ta->parm1);
-    Free((char *)ta->parm2);
-    Free(ta);
+    Free(ta.long_parm[0]);
+    Free(ta.long_parm[1]);
 
     return true;
 }
@@ -368,18 +439,19 @@ run_ta(void)
 static bool
 flush_ta(void)
 {
-    ta_t *ta, *next;
-    bool any = false;
+    bool any = ta_count != 0;
+
+    while (ta_count) {
+	ta_t *ta = &ta_ring[ta_first];
 
-    for (ta = ta_head; ta != NULL; ta = next) {
-	Free((char *)ta->parm1);
-	Free((char *)ta->parm2);
-	next = ta->next;
-	Free(ta);
-	any = true;
+	Free(ta->long_parm[0]);
+	Free(ta->long_parm[1]);
+	ta_first = (ta_first + 1) & (ta_size - 1);
+	ta_count--;
     }
-    ta_head = ta_tail = NULL;
+    ta_first = 0;
     vstatus_typeahead(false);
+    keylat_flush();
     return any;
 }
 
@@ -455,24 +527,52 @@ kybdlock_decode(char *how, unsigned int bits)
     return rs;
 }
 
+/*
+ * Account for the time the keyboard is locked while connected.
+ * Called just before kybdlock changes to 'n'.
+ */
+static void
+kybdlock_account(unsigned int n)
+{
+    bool was_locked = (kybdlock & ~KL_NOT_CONNECTED) != 0;
+    bool is_locked = (n & ~KL_NOT_CONNECTED) != 0;
+    struct timeval t1;
+
+    if (was_locked == is_locked) {
+	return;
+    }
+    gettimeofday(&t1, NULL);
+    if (is_locked) {
+	lock_start = t1;
+    } else {
+	stats_inc(STAT_KYBD_LOCKS);
+	stats_add(STAT_KYBD_LOCK_USEC,
+		((t1.tv_sec - lock_start.tv_sec) * 1000000LL) +
+		    (t1.tv_usec - lock_start.tv_usec));
+    }
+}
+
 /* Set bits in the keyboard lock. */
 static void
 kybdlock_set(unsigned int bits, const char *cause _is_unused)
 {
     unsigned int n;
 
-    vtrace("Keyboard lock(%s) %s\n", cause, kybdlock_decode("+", bits));
+    vctrace(TC_KYBD, "Keyboard lock(%s) %s\n", cause,
+	    kybdlock_decode("+", bits));
     n = kybdlock | bits;
     if (n != kybdlock) {
 #if defined(KYBDLOCK_TRACE) /*[*/
-       vtrace("  %s: kybdlock |= 0x%04x, 0x%04x -> 0x%04x\n",
+       vctrace(TC_KYBD, "  %s: kybdlock |= 0x%04x, 0x%04x -> 0x%04x\n",
 	    cause, bits, kybdlock, n);
 #endif /*]*/
 	if ((kybdlock ^ bits) & KL_DEFERRED_UNLOCK) {
 	    /* Turned on deferred unlock. */
 	    unlock_delay_time = time(NULL);
 	}
+	kybdlock_account(n);
 	kybdlock = n;
+	task_wakeup();
     }
 }
 
@@ -483,20 +583,22 @@ kybdlock_clr(unsigned int bits, const char *cause _is_unused)
     unsigned int n;
 
     if (kybdlock & bits) {
-	vtrace("Keyboard unlock(%s) %s\n", cause,
+	vctrace(TC_KYBD, "Keyboard unlock(%s) %s\n", cause,
 		kybdlock_decode("-", kybdlock & bits));
     }
     n = kybdlock & ~bits;
     if (n != kybdlock) {
 #if defined(KYBDLOCK_TRACE) /*[*/
-	vtrace("  %s: kybdlock &= ~0x%04x, 0x%04x -> 0x%04x\n",
+	vctrace(TC_KYBD, "  %s: kybdlock &= ~0x%04x, 0x%04x -> 0x%04x\n",
 		cause, bits, kybdlock, n);
 #endif /*]*/
 	if ((kybdlock ^ n) & KL_DEFERRED_UNLOCK) {
 	    /* Turned off deferred unlock. */
 	    unlock_delay_time = 0;
 	}
+	kybdlock_account(n);
 	kybdlock = n;
+	task_wakeup();
     }
 }
 
@@ -733,6 +835,20 @@ toggle_insert_mode(toggle_index_t ix, enum toggle_type type)
     vstatus_insert_mode(toggled(INSERT_MODE));
 }
 
+/* Footprint of the parsed compose maps. */
+static size_t
+compose_footprint(void)
+{
+    compose_map_t *cm;
+    size_t bytes = 0;
+
+    for (cm = compose_maps; cm != NULL; cm = cm->next) {
+	bytes += sizeof(compose_map_t) +
+	    (cm->n_composites * sizeof(struct composite));
+    }
+    return bytes;
+}
+
 /*
  * Keyboard module registration.
  */
@@ -747,6 +863,9 @@ kybd_register(void)
 	{ REVERSE_INPUT,toggle_reverse_input,	0 },
 	{ INSERT_MODE,	toggle_insert_mode,	0 },
     };
+    static footprint_t footprints[] = {
+	{ "compose-maps",	compose_footprint,	true }
+    };
 
     /* Register interest in connect and disconnect events. */
     register_schange_ordered(ST_CONNECT, kybd_connect, 1000);
@@ -768,6 +887,12 @@ kybd_register(void)
 	    (void **)&appres.unlock_delay, XRM_BOOLEAN);
     register_extended_toggle(ResUnlockDelayMs, toggle_unlock_delay_ms, NULL,
 	    NULL, (void **)&appres.unlock_delay_ms, XRM_INT);
+
+    /* Register the table size. */
+    register_footprints(footprints, array_count(footprints));
+
+    /* Register the key latency module. */
+    keylat_register();
 }
 
 /*
@@ -777,6 +902,7 @@ kybd_register(void)
 static void
 key_AID(unsigned char aid_code)
 {
+    keylat_stage(KEYLAT_DISPATCH);
     if (IN_NVT) {
 	register unsigned i;
 
@@ -814,6 +940,7 @@ key_AID(unsigned char aid_code)
 	    buffer_addr = cursor_addr;
 	    aid = aid_code;
 	    ctlr_read_modified(aid, false);
+	    screenhist_aid(aid);
 	    vstatus_ctlr_done();
 	    break;
 	default:
@@ -831,8 +958,10 @@ key_AID(unsigned char aid_code)
     kybdlock_set(KL_OIA_TWAIT | KL_OIA_LOCKED, "key_AID");
     aid = aid_code;
     ctlr_read_modified(aid, false);
+    screenhist_aid(aid);
     ticking_start(false);
     vstatus_ctlr_done();
+    net_busy_poll();
 }
 
 static bool
@@ -1067,13 +1196,53 @@ key_Character_wrapper(ia_t ia _is_unused, unsigned argc, const char **argv)
     }
     ebcdic_to_multibyte_x(ebc, with_ge? CS_GE: CS_BASE,
 	    mb, sizeof(mb), EUO_BLANK_UNDEF, &uc);
-    vtrace(" %s -> Key(%s\"%s\")\n",
+    vctrace(TC_KYBD, " %s -> Key(%s\"%s\")\n",
 	ia_name[(int) ia_cause],
 	with_ge ? "GE " : "", mb);
     key_Character(ebc, with_ge, pasting, oerr_fail, NULL);
     return true;
 }
 
+/*
+ * Replace the nulls in front of 'baddr' in the field starting at 'faddr'
+ * with blanks, for the blankFill toggle.
+ */
+static void
+blank_fill(int faddr, int baddr)
+{
+    register int baddr_fill = baddr;
+
+    DEC_BA(baddr_fill);
+    while (baddr_fill != faddr) {
+
+	/* Check for backward line wrap. */
+	if ((baddr_fill % COLS) == COLS - 1) {
+	    bool aborted = true;
+	    register int baddr_scan = baddr_fill;
+
+	    /* Check the field within the preceeding line for NULLs. */
+	    while (baddr_scan != faddr) {
+		if (ea_buf[baddr_scan].ec != EBC_null) {
+		    aborted = false;
+		    break;
+		}
+		if (!(baddr_scan % COLS)) {
+		    break;
+		}
+		DEC_BA(baddr_scan);
+	    }
+	    if (aborted) {
+		break;
+	    }
+	}
+
+	if (ea_buf[baddr_fill].ec == EBC_null) {
+	    ctlr_add(baddr_fill, EBC_space, 0);
+	}
+	DEC_BA(baddr_fill);
+    }
+}
+
 /*
  * Handle an ordinary displayable character key.  Lots of stuff to handle
  * insert-mode, protected fields and etc.
@@ -1138,7 +1307,8 @@ key_Character(unsigned ebc, bool with_ge, bool pasting, bool oerr_fail,
 	} else {
 #if 0
 	    /* Ignore it, successfully. */
-	    vtrace("Ignoring non-numeric character in numeric field\n");
+	    vctrace(TC_KYBD,
+		    "Ignoring non-numeric character in numeric field\n");
 	    return true;
 #endif
 	}
@@ -1283,37 +1453,7 @@ key_Character(unsigned ebc, bool with_ge, bool pasting, bool oerr_fail,
 
     /* Replace leading nulls with blanks, if desired. */
     if (formatted && toggled(BLANK_FILL)) {
-	register int baddr_fill = baddr;
-
-	DEC_BA(baddr_fill);
-	while (baddr_fill != faddr) {
-
-	    /* Check for backward line wrap. */
-	    if ((baddr_fill % COLS) == COLS - 1) {
-		bool aborted = true;
-		register int baddr_scan = baddr_fill;
-
-		/* Check the field within the preceeding line for NULLs. */
-		while (baddr_scan != faddr) {
-		    if (ea_buf[baddr_scan].ec != EBC_null) {
-			aborted = false;
-			break;
-		    }
-		    if (!(baddr_scan % COLS)) {
-			break;
-		    }
-		    DEC_BA(baddr_scan);
-		}
-		if (aborted) {
-		    break;
-		}
-	    }
-
-	    if (ea_buf[baddr_fill].ec == EBC_null) {
-		ctlr_add(baddr_fill, EBC_space, 0);
-	    }
-	    DEC_BA(baddr_fill);
-	}
+	blank_fill(faddr, baddr);
     }
 
     mdt_set(cursor_addr);
@@ -1354,7 +1494,8 @@ key_WCharacter_wrapper(ia_t ia _is_unused, unsigned argc, const char **argv)
 	oerr_fail = true;
     }
     ebc_wide = atoi(argv[0]);
-    vtrace(" %s -> Key(X'%04x')\n", ia_name[(int) ia_cause], ebc_wide);
+    vctrace(TC_KYBD, " %s -> Key(X'%04x')\n", ia_name[(int) ia_cause],
+	    ebc_wide);
     ebc_pair[0] = (ebc_wide >> 8) & 0xff;
     ebc_pair[1] = ebc_wide & 0xff;
     key_WCharacter(ebc_pair, oerr_fail);
@@ -1387,7 +1528,8 @@ key_WCharacter(unsigned char ebc_pair[], bool oerr_fail)
     }
 
     if (!dbcs) {
-	vtrace("DBCS character received when not in DBCS mode, ignoring.\n");
+	vctrace(TC_KYBD,
+		"DBCS character received when not in DBCS mode, ignoring.\n");
 	return true;
     }
 
@@ -1416,7 +1558,8 @@ key_WCharacter(unsigned char ebc_pair[], bool oerr_fail)
 	} else {
 #if 0
 	    /* Ignore it, successfully. */
-	    vtrace("Ignoring non-numeric character in numeric field\n");
+	    vctrace(TC_KYBD,
+		    "Ignoring non-numeric character in numeric field\n");
 	    return true;
 #endif
 	}
@@ -1658,7 +1801,7 @@ key_UCharacter(ucs4_t ucs4, enum keytype keytype, enum iaction cause,
     struct akey ak;
 
     if (keyboard_disabled() && IA_IS_KEY(cause)) {
-	vtrace("  [suppressed, keyboard disabled]\n");
+	vctrace(TC_KYBD, "  [suppressed, keyboard disabled]\n");
 	vstatus_keyboard_disable_flash();
 	return;
     }
@@ -1676,7 +1819,7 @@ key_UCharacter(ucs4_t ucs4, enum keytype keytype, enum iaction cause,
 		enq_ta(AnKey, lazyaf("apl_%s", apl_name),
 			oerr_fail ? KwFailOnError : KwNoFailOnError);
 	    } else {
-		vtrace("  dropped (invalid key type or name)\n");
+		vctrace(TC_KYBD, "  dropped (invalid key type or name)\n");
 	    }
 	}
 	return;
@@ -1726,19 +1869,19 @@ key_UCharacter(ucs4_t ucs4, enum keytype keytype, enum iaction cause,
 	break;
     }
 
-    vtrace(" %s -> Key(U+%04x)\n", ia_name[(int) cause], ucs4);
+    vctrace(TC_KYBD, " %s -> Key(U+%04x)\n", ia_name[(int) cause], ucs4);
     if (IN_3270) {
 	ebc_t ebc;
 	bool ge;
 
 	if (ucs4 < 0x20) {
-	    vtrace("  dropped (control char)\n");
+	    vctrace(TC_KYBD, "  dropped (control char)\n");
 	    return;
 	}
 	ebc = unicode_to_ebcdic_ge(ucs4, &ge,
 		keytype == KT_GE || toggled(APL_MODE));
 	if (ebc == 0) {
-	    vtrace("  dropped (no EBCDIC translation)\n");
+	    vctrace(TC_KYBD, "  dropped (no EBCDIC translation)\n");
 	    return;
 	}
 	if (ebc & 0xff00) {
@@ -1772,7 +1915,7 @@ key_UCharacter(ucs4_t ucs4, enum keytype keytype, enum iaction cause,
 	    break;
 	}
 
-	vtrace("  dropped (not %s)\n", why);
+	vctrace(TC_KYBD, "  dropped (not %s)\n", why);
     }
 }
 
@@ -1938,7 +2081,8 @@ do_reset(bool explicit)
 	kybdlock_clr(~KL_DEFERRED_UNLOCK, "do_reset");
 	kybdlock_set(KL_DEFERRED_UNLOCK, "do_reset");
 	unlock_id = AddTimeOut(appres.unlock_delay_ms, defer_unlock);
-	vtrace("Deferring keyboard unlock %dms\n", appres.unlock_delay_ms);
+	vctrace(TC_KYBD, "Deferring keyboard unlock %dms\n",
+		appres.unlock_delay_ms);
     }
 
     /* Clean up other modes. */
@@ -2779,7 +2923,7 @@ lightpen_select(int baddr)
     faddr = find_field_attribute(baddr);
     fa = ea_buf[faddr].fa;
     if (!FA_IS_SELECTABLE(fa)) {
-	vtrace("  lightpen select on non-selectable field\n");
+	vctrace(TC_KYBD, "  lightpen select on non-selectable field\n");
 	ring_bell();
 	    return;
     }
@@ -2912,8 +3056,10 @@ EraseEOF_action(ia_t ia, unsigned argc, const char **argv)
 	    baddr = cursor_addr;
 	    DEC_BA(baddr);
 	    ea_buf[baddr].ec = EBC_si;
+	    ctlr_changed(baddr, baddr + 1);
 	} else {
 	    ea_buf[cursor_addr].ec = EBC_si;
+	    ctlr_changed(cursor_addr, cursor_addr + 1);
 	}
     }
     ctlr_dbcs_postprocess();
@@ -3608,6 +3754,88 @@ ns_action(action_t action, enum iaction cause, const char *param)
 
 }
 
+/*
+ * Fast path for String(): store a run of ordinary text in the current
+ * field at once, with one field lookup, one MDT update and one change
+ * notification, instead of one key_UCharacter() call per character.
+ *
+ * Applies only when per-character entry would simply overwrite cells: the
+ * keyboard is unlocked, the cursor is in an unprotected, non-numeric
+ * field, and insert mode, reverse input, DBCS and compose processing are
+ * all off. The run stops at the end of the field, at the
+ * end of the buffer and at anything that is not plain SBCS text; the
+ * caller handles that character the ordinary way.
+ *
+ * Returns the number of characters consumed, which is 0 if the fast path
+ * does not apply.
+ */
+static size_t
+bulk_input(const ucs4_t *ws, size_t xlen, enum iaction ia)
+{
+    unsigned char ebc_run[BULK_INPUT_MAX];
+    unsigned char cs_run[BULK_INPUT_MAX];
+    int baddr;
+    int faddr;
+    unsigned char fa;
+    int n = 0;
+
+    if (!IN_3270 || !formatted || kybdlock || dbcs || composing != NONE ||
+	    toggled(INSERT_MODE) || toggled(REVERSE_INPUT)) {
+	return 0;
+    }
+    baddr = cursor_addr;
+    if (ea_buf[baddr].fa) {
+	return 0;
+    }
+    faddr = find_field_attribute(baddr);
+    fa = get_field_attribute(baddr);
+    if (faddr < 0 || FA_IS_PROTECTED(fa) || FA_IS_NUMERIC(fa) ||
+	    ea_buf[faddr].cs == CS_DBCS) {
+	return 0;
+    }
+
+    /* Translate as much as fits. */
+    while ((size_t)n < xlen && n < BULK_INPUT_MAX &&
+	    baddr + n < ROWS * COLS && !ea_buf[baddr + n].fa) {
+	ucs4_t c = ws[n];
+	ebc_t ebc;
+	bool ge;
+
+	if (c < 0x20 || c == '\\' || (c >= UPRIV2 && c <= UPRIV_dup)) {
+	    break;
+	}
+	ebc = unicode_to_ebcdic_ge(c, &ge, toggled(APL_MODE));
+	if (ebc < 0x40 || (ebc & 0xff00)) {
+	    break;
+	}
+	ebc_run[n] = (unsigned char)ebc;
+	cs_run[n] = ge? CS_GE: 0;
+	n++;
+    }
+    if (!n) {
+	return 0;
+    }
+
+    vctrace(TC_KYBD, " %s -> %d characters\n", ia_name[(int)ia], n);
+    ctlr_add_run(baddr, ebc_run, cs_run, n);
+    baddr = (baddr + n) % (ROWS * COLS);
+    if (toggled(BLANK_FILL)) {
+	blank_fill(faddr, baddr);
+    }
+    mdt_set(cursor_addr);
+
+    /* Auto-skip past the end of the field, as key_Character() would. */
+    while (ea_buf[baddr].fa) {
+	if (FA_IS_SKIP(ea_buf[baddr].fa)) {
+	    baddr = next_unprotected(baddr);
+	} else {
+	    INC_BA(baddr);
+	}
+    }
+    cursor_move(baddr);
+    return n;
+}
+
 /*
  * Pretend that a sequence of keys was entered at the keyboard.
  *
@@ -3659,7 +3887,7 @@ emulate_uinput(const ucs4_t *ws, size_t xlen, bool pasting)
 	 * so if the keyboard is locked, it's fatal
 	 */
 	if (kybdlock) {
-	    vtrace("  keyboard locked, string dropped\n");
+	    vctrace(TC_KYBD, "  keyboard locked, string dropped\n");
 	    return 0;
 	}
 
@@ -3688,6 +3916,17 @@ emulate_uinput(const ucs4_t *ws, size_t xlen, bool pasting)
 	    }
 	}
 
+	/* Store runs of ordinary text a field at a time. */
+	if (state == BASE && !pasting) {
+	    size_t n = bulk_input(ws, xlen, ia);
+
+	    if (n) {
+		ws += n;
+		xlen -= n;
+		continue;
+	    }
+	}
+
 	c = *ws;
 
 	switch (state) {
@@ -3761,14 +4000,14 @@ emulate_uinput(const ucs4_t *ws, size_t xlen, bool pasting)
 	    case UPRIV_fm: /* private-use FM */
 	    case UPRIV2_fm:
 		if (pasting) {
-		    vtrace(" %s -> FM\n", ia_name[(int) ia]);
+		    vctrace(TC_KYBD, " %s -> FM\n", ia_name[(int) ia]);
 		    key_Character(EBC_fm, false, true, true, NULL);
 		}
 		break;
 	    case UPRIV_dup: /* private-use DUP */
 	    case UPRIV2_dup:
 		if (pasting) {
-		    vtrace(" %s -> DUP\n", ia_name[(int) ia]);
+		    vctrace(TC_KYBD, " %s -> DUP\n", ia_name[(int) ia]);
 		    key_Character(EBC_dup, false, true, true, NULL);
 		}
 		break;
@@ -3966,7 +4205,8 @@ emulate_uinput(const ucs4_t *ws, size_t xlen, bool pasting)
 		nc++;
 		break;
 	    } else {
-		vtrace(" %s -> Key(X'%02X')\n", ia_name[(int) ia], literal);
+		vctrace(TC_KYBD, " %s -> Key(X'%02X')\n", ia_name[(int) ia],
+			literal);
 		if (!(literal & ~0xff)) {
 		    key_Character((unsigned char) literal, false, true, true,
 			    NULL);
@@ -4000,7 +4240,7 @@ emulate_uinput(const ucs4_t *ws, size_t xlen, bool pasting)
 	}
 	break;
     case EBC:
-	vtrace(" %s -> Key(X'%02X')\n", ia_name[(int) ia], literal);
+	vctrace(TC_KYBD, " %s -> Key(X'%02X')\n", ia_name[(int) ia], literal);
 	key_Character((unsigned char) literal, false, true, true, NULL);
 	state = BASE;
 	if (MarginedPaste() && BA_TO_COL(cursor_addr) < orig_col) {
@@ -4271,7 +4511,9 @@ build_composites(const char *how)
     enum keytype a[3];
     ucs4_t ucs4[3];
     int i;
+    int max_composites = 0;
     struct composite *cp;
+    compose_map_t *cm;
 
     if (appres.interactive.compose_map == NULL) {
 	popup_an_error("%s: No %s defined", how, ResComposeMap);
@@ -4283,6 +4525,21 @@ build_composites(const char *how)
 		appres.interactive.compose_map);
 	return false;
     }
+
+    /* Use the parsed copy, if the definition has not changed. */
+    for (cm = compose_maps; cm != NULL; cm = cm->next) {
+	if (!strcmp(cm->name, appres.interactive.compose_map)) {
+	    break;
+	}
+    }
+    if (cm != NULL && !strcmp(cm->source, c0)) {
+	composites = cm->composites;
+	n_composites = cm->n_composites;
+	return true;
+    }
+
+    composites = NULL;
+    n_composites = 0;
     c1 = c = NewString(c0);	/* will be modified by strtok */
     while ((ln = strtok(c, "\n"))) {
 	bool okay = true;
@@ -4308,8 +4565,11 @@ build_composites(const char *how)
 	if (!okay) {
 	    continue;
 	}
-	composites = (struct composite *) Realloc((char *)composites,
-		(n_composites + 1) * sizeof(struct composite));
+	if (n_composites >= max_composites) {
+	    max_composites = max_composites? 2 * max_composites: 64;
+	    composites = (struct composite *)Realloc((char *)composites,
+		    max_composites * sizeof(struct composite));
+	}
 	cp = composites + n_composites;
 	cp->k1.ucs4 = ucs4[0];
 	cp->k1.keytype = a[0];
@@ -4320,6 +4580,17 @@ build_composites(const char *how)
 	n_composites++;
     }
     Free(c1);
+
+    /* Remember the result. */
+    if (cm == NULL) {
+	cm = (compose_map_t *)Calloc(1, sizeof(compose_map_t));
+	cm->name = NewString(appres.interactive.compose_map);
+	cm->next = compose_maps;
+	compose_maps = cm;
+    }
+    Replace(cm->source, NewString(c0));
+    Replace(cm->composites, composites);
+    cm->n_composites = n_composites;
     return true;
 }
 
@@ -4357,7 +4628,8 @@ destroy_compose_map(void)
     composing = NONE;
     vstatus_compose(false, 0, KT_STD);
 
-    Replace(composites, NULL);
+    /* The entries belong to compose_maps. */
+    composites = NULL;
     n_composites = 0;
 }
 
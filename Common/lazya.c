@@ -28,6 +28,11 @@
 /*
  *      lazya.c
  *              Lazy allocations
+ *
+ * Formatted strings are carved out of a chain of arena chunks, which are
+ * reset rather than freed when the table is flushed, so a temporary string
+ * costs a pointer increment. Buffers that were already Malloc'd, and very
+ * long strings, are remembered in slot blocks and freed individually.
  */
 
 #include "globals.h"
@@ -36,12 +41,16 @@
 # include <malloc.h>
 #endif /*]*/
 
+#include "asprintf.h"
 #include "trace.h"
 #include "utils.h"
 
 #include "lazya.h"
 
 #define BLOCK_SLOTS  1024	/* slots per block */
+#define CHUNK_SIZE   (64 * 1024) /* bytes per arena chunk */
+#define CHUNK_KEEP   4		/* arena chunks kept across a flush */
+#define BIG_STRING   (CHUNK_SIZE / 4) /* longer strings are Malloc'd */
 
 typedef struct lazy_block {
     struct lazy_block *next;
@@ -52,6 +61,14 @@ static lazy_block_t **last_block = &blocks;
 static lazy_block_t *current_block;
 static int slot_ix = 0;
 
+typedef struct lazy_chunk {
+    struct lazy_chunk *next;
+    size_t used;
+    char data[CHUNK_SIZE];
+} lazy_chunk_t;
+static lazy_chunk_t *chunks;
+static lazy_chunk_t *current_chunk;
+
 /**
  * Add a buffer to the lazy allocation table.
  *
@@ -62,6 +79,11 @@ static int slot_ix = 0;
 char *
 lazya(void *buf)
 {
+    if (current_block == NULL && blocks != NULL) {
+	/* Reuse the block kept by the last flush. */
+	current_block = blocks;
+	slot_ix = 0;
+    }
     if (current_block == NULL || slot_ix >= BLOCK_SLOTS) {
 	/* Allocate a new block. */
 	current_block = (lazy_block_t *)Calloc(1, sizeof(lazy_block_t));
@@ -76,7 +98,30 @@ lazya(void *buf)
 }
 
 /**
- * Format a string into Malloc'd memory and put it into the lazy table.
+ * Move on to the next arena chunk, allocating it if necessary.
+ *
+ * @return Empty chunk
+ */
+static lazy_chunk_t *
+next_chunk(void)
+{
+    lazy_chunk_t *c = (current_chunk != NULL)? current_chunk->next: chunks;
+
+    if (c == NULL) {
+	c = (lazy_chunk_t *)Malloc(sizeof(lazy_chunk_t));
+	c->next = NULL;
+	if (current_chunk != NULL) {
+	    current_chunk->next = c;
+	} else {
+	    chunks = c;
+	}
+    }
+    c->used = 0;
+    return current_chunk = c;
+}
+
+/**
+ * Format a string into lazily-freed memory.
  *
  * @param[in] fmt	Format
  *
@@ -89,13 +134,13 @@ lazyaf(const char *fmt, ...)
     char *r;
 
     va_start(args, fmt);
-    r = xs_vbuffer(fmt, args);
+    r = vlazyaf(fmt, args);
     va_end(args);
-    return lazya(r);
+    return r;
 }
 
 /**
- * Format a string into Malloc'd memory and put it into the lazy table.
+ * Format a string into lazily-freed memory.
  * Varargs version.
  *
  * @param[in] fmt	Format
@@ -105,7 +150,40 @@ lazyaf(const char *fmt, ...)
 char *
 vlazyaf(const char *fmt, va_list args)
 {
-    return lazya(xs_vbuffer(fmt, args));
+    va_list args_copy;
+    lazy_chunk_t *c = (current_chunk != NULL)? current_chunk: next_chunk();
+    size_t room = CHUNK_SIZE - c->used;
+    int len;
+    char *r;
+
+    /* Try formatting into what is left of the current chunk. */
+    va_copy(args_copy, args);
+    len = vsnprintf(c->data + c->used, room, fmt, args_copy);
+    va_end(args_copy);
+    if (len < 0) {
+	/* Older vsnprintf()s do not say how much space is needed. */
+	va_copy(args_copy, args);
+	len = vscprintf(fmt, args_copy);
+	va_end(args_copy);
+	if (len < 0) {
+	    Error("vlazyaf: vsnprintf failure");
+	}
+    }
+    if ((size_t)len < room) {
+	r = c->data + c->used;
+	c->used += len + 1;
+	return r;
+    }
+
+    /* Put long strings in the slot table, others in a fresh chunk. */
+    if ((size_t)len >= BIG_STRING) {
+	return lazya(xs_vbuffer(fmt, args));
+    }
+    c = next_chunk();
+    r = c->data;
+    vsnprintf(r, len + 1, fmt, args);
+    c->used = len + 1;
+    return r;
 }
 
 /**
@@ -118,37 +196,63 @@ lazya_flush(void)
 #if defined(HAVE_MALLOC_USABLE_SIZE) /*[*/
     size_t nb = 0;
 #endif /*]*/
-    lazy_block_t *r, *next = NULL;
+    size_t na = 0;
+    unsigned nc = 0;
+    lazy_block_t *r, *next_block = NULL;
+    lazy_chunk_t *c, *next = NULL;
+    bool in_use = (current_chunk != NULL);
 
-    for (r = blocks; r != NULL; r = next) {
+    /* Free the Malloc'd buffers, keeping the first block. */
+    for (r = (current_block != NULL)? blocks: NULL; r != NULL;
+	    r = next_block) {
+	int n = (r == current_block)? slot_ix: BLOCK_SLOTS;
 	int i;
 
-	next = r->next;
-	for (i = 0; i < BLOCK_SLOTS; i++) {
+	next_block = (r == current_block)? NULL: r->next;
+	for (i = 0; i < n; i++) {
 	    if (r->slot[i] != NULL) {
 #if defined(HAVE_MALLOC_USABLE_SIZE) /*[*/
 		nb += malloc_usable_size(r->slot[i]);
 #endif /*]*/
 		Free(r->slot[i]);
+		r->slot[i] = NULL;
 		nf++;
 	    }
 	}
-	Free(r);
+	if (r == blocks) {
+	    r->next = NULL;
+	    last_block = &r->next;
+	} else {
+	    Free(r);
+	}
     }
-
     current_block = NULL;
-    blocks = NULL;
-    last_block = &blocks;
     slot_ix = 0;
 
+    /* Reset the arena, trimming it back if it grew. */
+    for (c = chunks; c != NULL; c = next) {
+	next = c->next;
+	if (in_use) {
+	    na += c->used;
+	    in_use = (c != current_chunk);
+	}
+	if (++nc == CHUNK_KEEP) {
+	    c->next = NULL;
+	} else if (nc > CHUNK_KEEP) {
+	    Free(c);
+	}
+    }
+    current_chunk = NULL;
+
 #if defined(HAVE_MALLOC_USABLE_SIZE) /*[*/
     if (nf > 10 || nb > 1024) {
-	vtrace("lazya_flush: %u slot%s, %zu bytes\n", nf, (nf == 1)? "": "s",
-		nb);
+	vtrace("lazya_flush: %u slot%s, %zu bytes, %zu arena bytes\n", nf,
+		(nf == 1)? "": "s", nb, na);
     }
 #else /*][*/
     if (nf > 10) {
-	vtrace("lazya_flush: %u slot%s\n", nf, (nf == 1)? "": "s");
+	vtrace("lazya_flush: %u slot%s, %zu arena bytes\n", nf,
+		(nf == 1)? "": "s", na);
     }
 #endif /*]*/
 }
@@ -1,6 +1,7 @@
 # Object files for lib32xx.
-LIB32XX_OBJECTS = apl.o asprintf.o boolstr.o base64.o copyright.o indent_s.o \
-	min_version.o lazya.o proxy.o proxy_http.o proxy_passthru.o \
-	proxy_socks4.o proxy_socks5.o proxy_telnet.o proxy_toggle.o \
-	resolver.o see.o sioc.o split_host.o tables.o toupper.o unicode.o \
-	unicode_dbcs.o utf8.o varbuf.o xs_buffer.o
+LIB32XX_OBJECTS = apl.o asprintf.o boolstr.o base64.o copyright.o \
+	deflate.o indent_s.o min_version.o lazya.o proxy.o proxy_http.o \
+	proxy_passthru.o proxy_socks4.o proxy_socks5.o proxy_telnet.o \
+	proxy_toggle.o resolver.o see.o sha1.o simd.o sioc.o split_host.o \
+	startup.o \
+	tables.o toupper.o unicode.o unicode_dbcs.o utf8.o varbuf.o xs_buffer.o
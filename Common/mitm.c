@@ -27,9 +27,14 @@
 
 /* Man-in-the-middle trace daemon. */
 
+#if defined(__linux__) /*[*/
+# define _GNU_SOURCE	1	/* for splice() and tee() */
+#endif /*]*/
+
 #include "globals.h"
 
 #include <errno.h>
+#include <fcntl.h>
 #if defined(HAVE_GETOPT_H) /*[*/
 # include <getopt.h>		/* why isn't this necessary elsewhere? */
 #endif /*]*/
@@ -40,9 +45,11 @@
 # include <sys/types.h>
 # include <sys/socket.h>
 # include <sys/un.h>
+# include <sys/wait.h>
 # include <netinet/in.h>
 # include <arpa/inet.h>
 #else /*][*/
+# include <io.h>
 # include "w3misc.h"
 #endif /*]*/
 
@@ -56,7 +63,54 @@
 # define sockerr(s)	win32_perror(s)
 #endif /*]*/
 
+/* Relay data with splice() instead of copying it through a buffer. */
+#if defined(__linux__) && defined(SPLICE_F_MOVE) /*[*/
+# define USE_SPLICE	1
+#endif /*]*/
+
+#define RELAY_CHUNK	65536	/* largest single relay transfer */
+#define CAP_PIPE_SIZE	(1024 * 1024) /* capture pipe size, if settable */
+#define REQ_MAX		256	/* longest passthru request line */
+
+/* Capture records, passed from the relay to the capture writer. */
+typedef enum {
+    CAP_OPEN,			/* session opened */
+    CAP_EMULATOR,		/* data from the emulator */
+    CAP_HOST,			/* data from the host */
+    CAP_EMULATOR_EOF,		/* emulator EOF */
+    CAP_HOST_EOF,		/* host EOF */
+    CAP_CLOSE			/* session closed */
+} cap_type_t;
+typedef struct {
+    unsigned id;		/* session ID */
+    cap_type_t type;		/* record type */
+    size_t length;		/* length of the data that follows */
+} cap_header_t;
+
+/* One relayed connection. */
+typedef struct session {
+    struct session *next;	/* linkage */
+    unsigned id;		/* session ID, for the capture writer */
+    socket_t a;			/* emulator socket */
+    socket_t o;			/* host socket */
+    bool a_open;		/* emulator is still sending */
+    bool o_open;		/* host is still sending */
+    char req[REQ_MAX + 1];	/* passthru request line */
+    size_t req_len;		/* length of req */
+#if defined(USE_SPLICE) /*[*/
+    int pipe[2][2];		/* relay pipes, emulator-to-host and back */
+#endif /*]*/
+} session_t;
+
 static char *me;
+static char *file = NULL;
+static bool multi = false;
+static session_t *sessions = NULL;
+static unsigned next_id = 1;
+static int cap_fd = -1;
+#if defined(USE_SPLICE) /*[*/
+static bool use_splice = true;
+#endif /*]*/
 #if 0
 static void sockerr(const char *s);
 #endif
@@ -67,31 +121,609 @@ static void netdump(FILE *f, char direction, unsigned char *buffer,
 static void
 mitm_usage(void)
 {
-    fprintf(stderr, "Usage: %s [-p listenport] [-f outfile]\n", me);
+    fprintf(stderr, "Usage: %s [-m] [-p listenport] [-f outfile]\n", me);
     exit(1);
 }
 
+/* Allocate memory, exiting if none is available. */
+static void *
+mitm_realloc(void *p, size_t len)
+{
+    void *r = realloc(p, len);
+
+    if (r == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	exit(1);
+    }
+    return r;
+}
+
+/* Write a buffer completely to a file descriptor. */
+static bool
+write_all(int fd, const void *buf, size_t len)
+{
+    const char *b = buf;
+
+    while (len) {
+	ssize_t nw = write(fd, b, (unsigned)len);
+
+	if (nw < 0 && errno == EINTR) {
+	    continue;
+	}
+	if (nw <= 0) {
+	    return false;
+	}
+	b += nw;
+	len -= nw;
+    }
+    return true;
+}
+
+/* Read a buffer completely from a file descriptor. */
+static bool
+read_all(int fd, void *buf, size_t len)
+{
+    char *b = buf;
+
+    while (len) {
+	ssize_t nr = read(fd, b, (unsigned)len);
+
+	if (nr < 0 && errno == EINTR) {
+	    continue;
+	}
+	if (nr <= 0) {
+	    return false;
+	}
+	b += nr;
+	len -= nr;
+    }
+    return true;
+}
+
+/* Pass a capture record header to the capture writer. */
+static void
+cap_header(unsigned id, cap_type_t type, size_t length)
+{
+    cap_header_t h;
+
+    memset(&h, 0, sizeof(h));
+    h.id = id;
+    h.type = type;
+    h.length = length;
+    if (!write_all(cap_fd, &h, sizeof(h))) {
+	perror("capture write");
+	exit(1);
+    }
+}
+
+/* Pass a capture record to the capture writer. */
+static void
+cap_record(unsigned id, cap_type_t type, const void *buf, size_t length)
+{
+    cap_header(id, type, length);
+    if (length && !write_all(cap_fd, buf, length)) {
+	perror("capture write");
+	exit(1);
+    }
+}
+
+/* Mark the time in a trace file. */
+static void
+stamp(FILE *f, const char *what)
+{
+    time_t t = time(NULL);
+
+    fprintf(f, "%s %s", what, asctime(gmtime(&t)));
+}
+
+/*
+ * Capture writer.
+ *
+ * Runs in the background, reading capture records from the relay and
+ * formatting them into the trace files, so the hex dump never holds up
+ * the relay. Each session gets its own trace file.
+ */
+static void
+cap_writer(int fd, FILE *single)
+{
+    typedef struct trace {
+	struct trace *next;
+	unsigned id;
+	FILE *f;
+    } trace_t;
+    trace_t *traces = NULL;
+    trace_t *t, **tp;
+    cap_header_t h;
+    unsigned char *buf = mitm_realloc(NULL, RELAY_CHUNK);
+    size_t buf_size = RELAY_CHUNK;
+
+    while (read_all(fd, &h, sizeof(h))) {
+	if (h.length > buf_size) {
+	    buf_size = h.length;
+	    buf = mitm_realloc(buf, buf_size);
+	}
+	if (h.length && !read_all(fd, buf, h.length)) {
+	    break;
+	}
+
+	/* Find the session's trace file. */
+	for (tp = &traces; (t = *tp) != NULL; tp = &t->next) {
+	    if (t->id == h.id) {
+		break;
+	    }
+	}
+	if (h.type == CAP_OPEN) {
+	    FILE *f;
+
+	    if (single != NULL) {
+		f = single;
+	    } else {
+		char *name = xs_buffer("%s.%u", file, h.id);
+
+		f = fopen(name, "w");
+		if (f == NULL) {
+		    perror(name);
+		}
+		free(name);
+	    }
+	    if (f != NULL) {
+		t = (trace_t *)mitm_realloc(NULL, sizeof(trace_t));
+		t->next = traces;
+		t->id = h.id;
+		t->f = f;
+		traces = t;
+		fprintf(f, "Recorded by %s\n", build);
+		stamp(f, "Started");
+		if (h.length) {
+		    fprintf(f, "Connection to %.*s\n", (int)h.length,
+			    (char *)buf);
+		}
+	    }
+	    continue;
+	}
+	if (t == NULL) {
+	    continue;
+	}
+	switch (h.type) {
+	case CAP_EMULATOR:
+	    netdump(t->f, '>', buf, h.length);
+	    break;
+	case CAP_HOST:
+	    netdump(t->f, '<', buf, h.length);
+	    break;
+	case CAP_EMULATOR_EOF:
+	    fprintf(t->f, "Emulator EOF\n");
+	    break;
+	case CAP_HOST_EOF:
+	    fprintf(t->f, "Host EOF\n");
+	    break;
+	case CAP_CLOSE:
+	    stamp(t->f, "Stopped");
+	    fclose(t->f);
+	    *tp = t->next;
+	    free(t);
+	    break;
+	default:
+	    break;
+	}
+    }
+
+    /* The relay has gone away. */
+    while ((t = traces) != NULL) {
+	stamp(t->f, "Stopped");
+	fclose(t->f);
+	traces = t->next;
+	free(t);
+    }
+    free(buf);
+}
+
+#if defined(_WIN32) /*[*/
+static FILE *cap_single;
+static int cap_read_fd;
+
+/* Capture writer thread. */
+static DWORD WINAPI
+cap_thread(LPVOID parameter _is_unused)
+{
+    cap_writer(cap_read_fd, cap_single);
+    return 0;
+}
+#endif /*]*/
+
+/*
+ * Start the capture writer.
+ * On POSIX systems it is a child process; on Windows it is a thread.
+ */
+#if !defined(_WIN32) /*[*/
+static pid_t
+#else /*][*/
+static HANDLE
+#endif /*]*/
+cap_start(FILE *single)
+{
+    int fds[2];
+#if !defined(_WIN32) /*[*/
+    pid_t pid;
+
+    if (pipe(fds) < 0) {
+	perror("pipe");
+	exit(1);
+    }
+# if defined(F_SETPIPE_SZ) /*[*/
+    /* Give the writer some slack before it holds up the relay. */
+    (void) fcntl(fds[1], F_SETPIPE_SZ, CAP_PIPE_SIZE);
+# endif /*]*/
+    switch (pid = fork()) {
+    case -1:
+	perror("fork");
+	exit(1);
+    case 0:
+	/* Child. */
+	close(fds[1]);
+	signal(SIGINT, SIG_IGN);
+	cap_writer(fds[0], single);
+	_exit(0);
+    default:
+	/* Parent. */
+	close(fds[0]);
+	if (single != NULL) {
+	    fclose(single);
+	}
+	cap_fd = fds[1];
+	break;
+    }
+    return pid;
+#else /*][*/
+    HANDLE thread;
+
+    if (_pipe(fds, CAP_PIPE_SIZE, _O_BINARY) < 0) {
+	perror("pipe");
+	exit(1);
+    }
+    cap_read_fd = fds[0];
+    cap_single = single;
+    cap_fd = fds[1];
+    thread = CreateThread(NULL, 0, cap_thread, NULL, 0, NULL);
+    if (thread == NULL) {
+	win32_perror("CreateThread");
+	exit(1);
+    }
+    return thread;
+#endif /*]*/
+}
+
+/* Close a session and free it. */
+static void
+session_close(session_t *s)
+{
+    session_t **sp;
+
+    for (sp = &sessions; *sp != NULL; sp = &(*sp)->next) {
+	if (*sp == s) {
+	    *sp = s->next;
+	    break;
+	}
+    }
+    SOCK_CLOSE(s->a);
+    if (s->o != INVALID_SOCKET) {
+	SOCK_CLOSE(s->o);
+	cap_header(s->id, CAP_CLOSE, 0);
+    }
+#if defined(USE_SPLICE) /*[*/
+    {
+	int i, j;
+
+	for (i = 0; i < 2; i++) {
+	    for (j = 0; j < 2; j++) {
+		if (s->pipe[i][j] >= 0) {
+		    close(s->pipe[i][j]);
+		}
+	    }
+	}
+    }
+#endif /*]*/
+    free(s);
+}
+
+/*
+ * Read from the emulator until the passthru request line is complete, then
+ * connect to the host.
+ * Returns true if the session is still alive.
+ */
+static bool
+session_request(session_t *s)
+{
+    ssize_t nr;
+    char thru_host[REQ_MAX + 1];
+    unsigned thru_port;
+    struct hostent *h;
+    int connect_result;
+
+    /*
+     * Read one byte at a time, so nothing after the request line is
+     * consumed.
+     */
+    nr = recv(s->a, s->req + s->req_len, 1, 0);
+    if (nr < 0) {
+	sockerr("recv");
+	return false;
+    }
+    if (nr == 0) {
+	fprintf(stderr, "Empty connection\n");
+	return false;
+    }
+    s->req_len++;
+    if (s->req_len < 2 || s->req[s->req_len - 1] != '\n') {
+	if (s->req_len >= REQ_MAX) {
+	    fprintf(stderr, "Request line too long\n");
+	    return false;
+	}
+	return true;
+    }
+    if (s->req[s->req_len - 2] != '\r') {
+	fprintf(stderr, "Request line does not end in CR/LF\n");
+	return false;
+    }
+    s->req[s->req_len - 2] = '\0';
+    if (sscanf(s->req, "%256s %u", thru_host, &thru_port) != 2) {
+	fprintf(stderr, "Malformed request line\n");
+	return false;
+    }
+
+    /* Connect. */
+    h = gethostbyname(thru_host);
+    if (h == NULL) {
+	fprintf(stderr, "gethostbyname(%s) failed\n", thru_host);
+	return false;
+    }
+    s->o = socket(h->h_addrtype, SOCK_STREAM, 0);
+    if (s->o == INVALID_SOCKET) {
+	sockerr("socket");
+	return false;
+    }
+    if (h->h_addrtype == AF_INET) {
+	struct sockaddr_in sin_o;
+
+	memset(&sin_o, 0, sizeof(sin_o));
+	sin_o.sin_family = AF_INET;
+	memcpy(&sin_o.sin_addr, h->h_addr_list[0], h->h_length);
+	sin_o.sin_port = htons(thru_port);
+	connect_result = connect(s->o, (struct sockaddr *)&sin_o,
+		sizeof(sin_o));
+    } else if (h->h_addrtype == AF_INET6) {
+	struct sockaddr_in6 sin6_o;
+
+	memset(&sin6_o, 0, sizeof(sin6_o));
+	sin6_o.sin6_family = AF_INET6;
+	memcpy(&sin6_o.sin6_addr, h->h_addr_list[0], h->h_length);
+	sin6_o.sin6_port = htons(thru_port);
+	connect_result = connect(s->o, (struct sockaddr *)&sin6_o,
+		sizeof(sin6_o));
+    } else {
+	fprintf(stderr, "Unknown address type %d\n", h->h_addrtype);
+	SOCK_CLOSE(s->o);
+	s->o = INVALID_SOCKET;
+	return false;
+    }
+    if (connect_result < 0) {
+	sockerr("connect");
+	SOCK_CLOSE(s->o);
+	s->o = INVALID_SOCKET;
+	return false;
+    }
+
+    s->o_open = true;
+    cap_record(s->id, CAP_OPEN, s->req, strlen(s->req));
+    return true;
+}
+
+#if defined(USE_SPLICE) /*[*/
+/*
+ * Relay data from one socket to another without copying it, using a pipe.
+ * The capture writer gets a copy of the data with tee().
+ * Returns the number of bytes relayed, 0 for EOF or -1 for an error.
+ */
+static ssize_t
+relay_splice(session_t *s, int dir, socket_t from, socket_t to)
+{
+    int *p = s->pipe[dir];
+    ssize_t n, left;
+
+    if (p[0] < 0 && pipe(p) < 0) {
+	perror("pipe");
+	p[0] = p[1] = -1;
+	return -1;
+    }
+    n = splice(from, NULL, p[1], NULL, RELAY_CHUNK,
+	    SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+    if (n <= 0) {
+	return n;
+    }
+
+    /*
+     * Copy and drain the pipe a piece at a time. tee() always starts at
+     * the front of the pipe, so each piece is sent on before the next one
+     * is copied.
+     */
+    cap_header(s->id, dir? CAP_HOST: CAP_EMULATOR, n);
+    for (left = n; left > 0; ) {
+	ssize_t nt = tee(p[0], cap_fd, left, 0);
+
+	if (nt < 0 && errno == EINTR) {
+	    continue;
+	}
+	if (nt <= 0) {
+	    perror("tee");
+	    exit(1);
+	}
+	left -= nt;
+	while (nt > 0) {
+	    ssize_t ns = splice(p[0], NULL, to, NULL, nt, SPLICE_F_MOVE);
+
+	    if (ns < 0 && errno == EINTR) {
+		continue;
+	    }
+	    if (ns <= 0) {
+		/* The other side is gone; keep the capture in sync. */
+		char buf[4096];
+
+		while (nt > 0) {
+		    ssize_t nr = read(p[0], buf,
+			    (nt > (ssize_t)sizeof(buf))? sizeof(buf): (size_t)nt);
+
+		    if (nr <= 0) {
+			exit(1);
+		    }
+		    nt -= nr;
+		}
+		break;
+	    }
+	    nt -= ns;
+	}
+    }
+    return n;
+}
+#endif /*]*/
+
+/*
+ * Relay data from one socket to another.
+ * Returns the number of bytes relayed, 0 for EOF or -1 for an error.
+ */
+static ssize_t
+relay(session_t *s, int dir, socket_t from, socket_t to)
+{
+    char buf[RELAY_CHUNK];
+    ssize_t nr;
+    ssize_t ns;
+    char *b;
+
+#if defined(USE_SPLICE) /*[*/
+    if (use_splice) {
+	nr = relay_splice(s, dir, from, to);
+	if (nr >= 0 || (errno != EINVAL && errno != ENOSYS)) {
+	    return nr;
+	}
+
+	/* Sockets that can't be spliced. Copy from now on. */
+	use_splice = false;
+    }
+#endif /*]*/
+
+    nr = recv(from, buf, sizeof(buf), 0);
+    if (nr <= 0) {
+	return nr;
+    }
+    cap_record(s->id, dir? CAP_HOST: CAP_EMULATOR, buf, nr);
+    for (b = buf, ns = nr; ns > 0; ) {
+	ssize_t nw = send(to, b, (int)ns, 0);
+
+	if (nw <= 0) {
+	    break;
+	}
+	b += nw;
+	ns -= nw;
+    }
+    return nr;
+}
+
+/*
+ * Process input on one session.
+ * Returns true if the session is still alive.
+ */
+static bool
+session_input(session_t *s, fd_set *rfds)
+{
+    ssize_t nr;
+
+    if (s->o == INVALID_SOCKET) {
+	/* Still reading the request. */
+	return !FD_ISSET(s->a, rfds) || session_request(s);
+    }
+
+    if (s->a_open && FD_ISSET(s->a, rfds)) {
+	nr = relay(s, 0, s->a, s->o);
+	if (nr < 0) {
+	    sockerr("emulator recv");
+	    return false;
+	}
+	if (nr == 0) {
+	    cap_header(s->id, CAP_EMULATOR_EOF, 0);
+	    shutdown(s->o, 1);
+	    s->a_open = false;
+	}
+    }
+    if (s->o_open && FD_ISSET(s->o, rfds)) {
+	nr = relay(s, 1, s->o, s->a);
+	if (nr < 0) {
+	    sockerr("host recv");
+	    return false;
+	}
+	if (nr == 0) {
+	    cap_header(s->id, CAP_HOST_EOF, 0);
+	    shutdown(s->a, 1);
+	    s->o_open = false;
+	}
+    }
+    return s->a_open || s->o_open;
+}
+
+/* Accept a new connection. */
+static void
+session_accept(socket_t s)
+{
+    struct sockaddr_in sin_a;
+    socklen_t a_len;
+    socket_t a;
+    session_t *session;
+
+    memset(&sin_a, 0, sizeof(sin_a));
+    sin_a.sin_family = AF_INET;
+    a_len = sizeof(sin_a);
+    a = accept(s, (struct sockaddr *)&sin_a, &a_len);
+    if (a == INVALID_SOCKET) {
+	sockerr("accept");
+	if (!multi) {
+	    exit(1);
+	}
+	return;
+    }
+#if !defined(_WIN32) /*[*/
+    if (a >= FD_SETSIZE) {
+	fprintf(stderr, "Too many connections\n");
+	SOCK_CLOSE(a);
+	return;
+    }
+#endif /*]*/
+
+    session = (session_t *)mitm_realloc(NULL, sizeof(session_t));
+    memset(session, 0, sizeof(session_t));
+    session->id = next_id++;
+    session->a = a;
+    session->o = INVALID_SOCKET;
+    session->a_open = true;
+#if defined(USE_SPLICE) /*[*/
+    session->pipe[0][0] = session->pipe[0][1] = -1;
+    session->pipe[1][0] = session->pipe[1][1] = -1;
+#endif /*]*/
+    session->next = sessions;
+    sessions = session;
+}
+
 int
 main(int argc, char *argv[])
 {
     int c;
     int port = 4200;
-    char *file = NULL;
-    FILE *f;
-    struct sockaddr_in sin, sin_a;
+    FILE *f = NULL;
+    struct sockaddr_in sin;
     socket_t s;
-    socket_t a;
-    socket_t o;
-    socklen_t a_len;
-    char buf[16384];
-    size_t nr;
-    char thru_host[256];
-    unsigned thru_port;
-    struct hostent *h;
-    bool a_open = true, o_open = true;
     int on = 1;
-    int connect_result;
-    time_t t;
+#if !defined(_WIN32) /*[*/
+    pid_t writer;
+#else /*][*/
+    HANDLE writer;
+#endif /*]*/
 
 #if defined(_WIN32) /*[*/
     if (sockstart() < 0) {
@@ -113,8 +745,11 @@ main(int argc, char *argv[])
 
     /* Parse options. */
     opterr = 0;
-    while ((c = getopt(argc, argv, "p:f:")) != -1) {
+    while ((c = getopt(argc, argv, "mp:f:")) != -1) {
 	switch (c) {
+	case 'm':
+	    multi = true;
+	    break;
 	case 'p':
 	    port = atoi(optarg);
 	    if (port <= 0 || port > 0xffff) {
@@ -154,16 +789,24 @@ main(int argc, char *argv[])
 	file = xs_buffer("%s\\mitm.%d.txt", desktop, (int)getpid());
 #endif /*]*/
     }
-    f = fopen(file, "w");
-    if (f == NULL) {
-	perror(file);
-	exit(1);
+    if (!multi) {
+	/* In multi-connection mode, each session has its own file. */
+	f = fopen(file, "w");
+	if (f == NULL) {
+	    perror(file);
+	    exit(1);
+	}
     }
-    fprintf(f, "Recorded by %s\n", build);
-    t = time(NULL);
-    fprintf(f, "Started %s", asctime(gmtime(&t)));
 
-    /* Wait for a connection. */
+    /* Ignore broken pipes. */
+#if !defined(_WIN32) /*[*/
+    signal(SIGPIPE, SIG_IGN);
+#endif /*]*/
+
+    /* Start the capture writer. */
+    writer = cap_start(f);
+
+    /* Wait for connections. */
     s = socket(AF_INET, SOCK_STREAM, 0);
     if (s == INVALID_SOCKET) {
 	sockerr("socket");
@@ -181,143 +824,71 @@ main(int argc, char *argv[])
 	sockerr("bind");
 	exit(1);
     }
-    if (listen(s, 1) < 0) {
+    if (listen(s, multi? SOMAXCONN: 1) < 0) {
 	sockerr("listen");
 	exit(1);
     }
-    memset(&sin_a, 0, sizeof(sin_a));
-    sin_a.sin_family = AF_INET;
-    a_len = sizeof(sin_a);
-    a = accept(s, (struct sockaddr *)&sin_a, &a_len);
-    if (a == INVALID_SOCKET) {
-	sockerr("accept");
-	exit(1);
-    }
-    SOCK_CLOSE(s);
-
-    /* Read the initial request. */
-    nr = recv(a, buf, sizeof(buf), 0);
-    if (nr < 0) {
-	sockerr("recv");
-	exit(1);
-    }
-    if (nr == 0) {
-	fprintf(stderr, "Empty connection\n");
-	exit(1);
-    }
-    if (nr < 2) {
-	fprintf(stderr, "Short read\n");
-	exit(1);
-    }
-    if (buf[nr - 2] != '\r' || buf[nr - 1] != '\n') {
-	fprintf(stderr, "Request line does not end in CR/LF\n");
-	exit(1);
-    }
-    buf[nr - 2] = '\0';
-    if (sscanf(buf, "%256s %u", thru_host, &thru_port) != 2) {
-	fprintf(stderr, "Malformed request line\n");
-	exit(1);
-    }
-
-    /* Connect. */
-    h = gethostbyname(thru_host);
-    if (h == NULL) {
-	fprintf(stderr, "gethostbyname(%s) failed\n", thru_host);
-    }
-    o = socket(h->h_addrtype, SOCK_STREAM, 0);
-    if (o == INVALID_SOCKET) {
-	sockerr("socket");
-	exit(1);
-    }
-    if (h->h_addrtype == AF_INET) {
-	struct sockaddr_in sin_o;
-
-	memset(&sin_o, 0, sizeof(sin_o));
-	sin_o.sin_family = AF_INET;
-	memcpy(&sin_o.sin_addr, h->h_addr_list[0], h->h_length);
-	sin_o.sin_port = htons(thru_port);
-	connect_result = connect(o, (struct sockaddr *)&sin_o, sizeof(sin_o));
-    } else if (h->h_addrtype == AF_INET6) {
-	struct sockaddr_in6 sin6_o;
-
-	memset(&sin6_o, 0, sizeof(sin6_o));
-	sin6_o.sin6_family = AF_INET6;
-	memcpy(&sin6_o.sin6_addr, h->h_addr_list[0], h->h_length);
-	sin6_o.sin6_port = htons(thru_port);
-	connect_result = connect(o, (struct sockaddr *)&sin6_o, sizeof(sin6_o));
-    } else {
-	fprintf(stderr, "Unknown address type %d\n", h->h_addrtype);
-	exit(1);
-    }
-    if (connect_result < 0) {
-	sockerr("connect");
-	exit(1);
-    }
-
-    /* Ignore broken pipes. */
-#if !defined(_WIN32) /*[*/
-    signal(SIGPIPE, SIG_IGN);
-#endif /*]*/
 
     /* Shuffle and trace. */
-    while (a_open || o_open) {
+    while (s != INVALID_SOCKET || sessions != NULL) {
 	fd_set rfds;
 	int ns;
 	int maxfd = 0;
+	session_t *session, *next;
 
 	FD_ZERO(&rfds);
-	if (a_open) {
-	    FD_SET(a, &rfds);
-	    if (a > maxfd) {
-		maxfd = a;
-	    }
+	if (s != INVALID_SOCKET) {
+	    FD_SET(s, &rfds);
+	    maxfd = (int)s;
 	}
-	if (o_open) {
-	    FD_SET(o, &rfds);
-	    if (o > maxfd) {
-		maxfd = o;
+	for (session = sessions; session != NULL; session = session->next) {
+	    if (session->a_open) {
+		FD_SET(session->a, &rfds);
+		if ((int)session->a > maxfd) {
+		    maxfd = (int)session->a;
+		}
+	    }
+	    if (session->o_open) {
+		FD_SET(session->o, &rfds);
+		if ((int)session->o > maxfd) {
+		    maxfd = (int)session->o;
+		}
 	    }
 	}
 
 	ns = select(maxfd + 1, &rfds, NULL, NULL, NULL);
 	if (ns < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
 	    sockerr("select");
 	    exit(1);
 	}
-	if (a_open && FD_ISSET(a, &rfds)) {
-	    nr = recv(a, buf, sizeof(buf), 0);
-	    if (nr < 0) {
-		sockerr("emulator recv");
-		exit(1);
-	    }
-	    if (nr == 0) {
-		fprintf(f, "Emulator EOF\n");
-		shutdown(o, 1);
-		a_open = false;
-	    } else {
-		netdump(f, '>', (unsigned char *)buf, nr);
-		send(o, buf, nr, 0);
+
+	for (session = sessions; session != NULL; session = next) {
+	    next = session->next;
+	    if (!session_input(session, &rfds)) {
+		session_close(session);
 	    }
 	}
-	if (o_open && FD_ISSET(o, &rfds)) {
-	    nr = recv(o, buf, sizeof(buf), 0);
-	    if (nr < 0) {
-		sockerr("host recv");
-		exit(1);
-	    }
-	    if (nr == 0) {
-		fprintf(f, "Host EOF\n");
-		shutdown(a, 1);
-		o_open = false;
-	    } else {
-		netdump(f, '<', (unsigned char *)buf, nr);
-		send(a, buf, nr, 0);
+
+	if (s != INVALID_SOCKET && FD_ISSET(s, &rfds)) {
+	    session_accept(s);
+	    if (!multi) {
+		/* Only one connection. */
+		SOCK_CLOSE(s);
+		s = INVALID_SOCKET;
 	    }
 	}
     }
 
-    t = time(NULL);
-    fprintf(f, "Stopped %s", asctime(gmtime(&t)));
+    /* Let the capture writer finish. */
+    close(cap_fd);
+#if !defined(_WIN32) /*[*/
+    waitpid(writer, NULL, 0);
+#else /*][*/
+    WaitForSingleObject(writer, INFINITE);
+#endif /*]*/
     return 0;
 }
 
@@ -26,7 +26,7 @@ XX_TH(XX_PRODUCT,1,XX_DATE)
 XX_SH(Name)
 XX_PRODUCT XX_DASH network stream trace facility
 XX_SH(Synopsis)
-XX_FB(XX_PRODUCT) [XX_DASHED(p) XX_FI(listenport)] [XX_DASHED(f) XX_FI(outfile)]
+XX_FB(XX_PRODUCT) [XX_DASHED(m)] [XX_DASHED(p) XX_FI(listenport)] [XX_DASHED(f) XX_FI(outfile)]
 XX_SH(Description)
 XX_FB(XX_PRODUCT) is a proxy server that traces the data passing through it.
 It supports the Sun XX_FI(passthru) protocol, where the client writes the
@@ -34,10 +34,17 @@ desired host name and port, separated by a space and terminated by a carriage
 return and line feed, at the beginning of the session.
 XX_LP
 Network data is written in hexadecimal to the specified file.
+The trace is written by a separate process, so formatting it does not
+slow down the session.
 XX_LP
 The name is derived from its position in the network stream: the man in the
 middle.
 XX_SH(Options)
+XX_TP(XX_FB(XX_DASHED(m)))
+Accepts any number of connections, instead of exiting after the first one
+ends.
+Each connection is traced to its own file, named by appending a period and the
+connection number to XX_FI(outfile).
 XX_TP(XX_FB(XX_DASHED(p)) XX_FI(listenport))
 Specifies the port to listen on.
 The default port is 4200.
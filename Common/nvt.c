@@ -50,6 +50,7 @@
 #include "telnet_core.h"
 #include "trace.h"
 #include "screentrace.h"
+#include "simd.h"
 #include "unicodec.h"
 #include "utils.h"
 
@@ -1834,6 +1835,52 @@ nvt_process(unsigned int c)
     task_host_output();
 }
 
+/*
+ * Fast path for text: process a run of 7-bit printable characters from the
+ * host at once, instead of one nvt_process() call each.
+ *
+ * Only text that ansi_printing() would simply store and step over is
+ * handled: no escape sequence, multi-byte character or wrap pending, no
+ * insert mode, the US ASCII character set, no DBCS and no screen tracing.
+ * The run stops at the first other byte, and one short of the last column,
+ * so the wrap logic stays in ansi_printing().
+ *
+ * Returns the number of bytes consumed, which may be 0. The caller passes
+ * the rest to nvt_process().
+ */
+size_t
+nvt_process_run(const unsigned char *buf, size_t len)
+{
+    size_t max;
+    size_t n;
+    size_t i;
+
+    if (state != DATA || pmi || held_wrap || insert_mode || dbcs ||
+	    once_cset != -1 || csd[cset] != CSD_US ||
+	    toggled(SCREEN_TRACE) ||
+	    cursor_addr / COLS >= scroll_bottom) {
+	return 0;
+    }
+    max = COLS - 1 - (cursor_addr % COLS);
+    n = (*simd_printable_run)(buf, (len < max)? len: max);
+    if (!n) {
+	return 0;
+    }
+
+    scroll_to_bottom();
+    ctlr_add_nvt_run(cursor_addr, buf, (int)n, gr, fg, bg);
+    cursor_move(cursor_addr + (int)n);
+    nvt_ch = buf[n - 1];
+    pe = 0;
+
+    /* Let a blocked task go. */
+    for (i = 0; i < n; i++) {
+	task_store(buf[i]);
+    }
+    task_host_output();
+    return n;
+}
+
 void
 nvt_send_up(void)
 {
@@ -2213,7 +2260,7 @@ nvt_snap(void)
 	static struct ea zea = { 0, 0, 0, 0, 0, 0, 0, 0 };
 
 	/* See if aea_buf has anything in it. */
-	for (i = 0; i < ROWS * COLS; i++) {
+	for (i = 0; aea_buf != NULL && i < ROWS * COLS; i++) {
 	    if (memcmp(&aea_buf[i], &zea, sizeof(struct ea))) {
 		any = 1;
 		break;
@@ -0,0 +1,460 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *	observe.c
+ *		Host output observers.
+ *
+ * Observe() lets a peer script connection watch host output without
+ * polling: after each host write it is sent the screen, and NVT-mode host
+ * output is sent as it arrives.
+ *
+ * Host output goes into a single log. Each entry is formatted once, when it
+ * is added, and is never changed afterwards, so any number of observers can
+ * send the same text. Each observer has its own cursor into the log. An
+ * observer whose connection cannot keep up stops in place, and the log
+ * keeps everything from the slowest cursor on. An observer that falls more
+ * than its limit behind skips to the newest entry and is told how many
+ * entries it lost, so one stuck observer cannot hold on to an unbounded
+ * amount of memory. The screen is only rendered if there is a screen
+ * observer, and it is rendered once however many observers there are.
+ *
+ * Everything here runs in the event loop thread, so the log and the
+ * cursors need no locking.
+ */
+
+#include "globals.h"
+
+#include <inttypes.h>
+
+#include "actions.h"
+#include "ctlr.h"
+#include "lazya.h"
+#include "names.h"
+#include "observe.h"
+#include "popups.h"
+#include "s3270_proto.h"
+#include "task.h"
+#include "trace.h"
+#include "utils.h"
+#include "varbuf.h"
+
+/* Largest NVT entry. Longer output is split into several. */
+#define OBS_NVT_MAX	4096
+
+/* One log entry. */
+typedef struct obs_entry {
+    struct obs_entry *next;	/* next newer entry */
+    uint64_t seq;		/* sequence number */
+    unsigned what;		/* OBS_SCREEN or OBS_NVT */
+    uint64_t offset;		/* log bytes before this entry */
+    size_t len;			/* length of text */
+    char *text;			/* formatted text */
+} obs_entry_t;
+
+/* One observer. */
+struct observer {
+    observer_t *next;		/* list linkage */
+    unsigned what;		/* what it wants to see */
+    size_t limit;		/* how far it may fall behind, in bytes */
+    observe_send_fn *send;	/* output function */
+    void *context;		/* context for send */
+    obs_entry_t *cur;		/* next entry to send, NULL if caught up */
+    bool blocked;		/* output function is full */
+    uint64_t lost;		/* entries skipped and not yet reported */
+};
+
+unsigned observe_classes = 0;	/* union of what the observers want */
+
+static observer_t *observers = NULL;
+static obs_entry_t *log_head = NULL;	/* oldest entry */
+static obs_entry_t *log_tail = NULL;	/* newest entry */
+static uint64_t log_seq = 0;		/* sequence number of the next entry */
+static uint64_t log_bytes = 0;		/* bytes ever logged */
+static varbuf_t nvt_pending;		/* NVT output not yet logged */
+static bool nvt_initted = false;
+
+/* Recompute the union of observer classes. */
+static void
+set_classes(void)
+{
+    observer_t *o;
+
+    observe_classes = 0;
+    for (o = observers; o != NULL; o = o->next) {
+	observe_classes |= o->what;
+    }
+}
+
+/* Free the entries that every observer has sent. */
+static void
+log_trim(void)
+{
+    uint64_t min_seq = log_seq;
+    observer_t *o;
+
+    for (o = observers; o != NULL; o = o->next) {
+	if (o->cur != NULL && o->cur->seq < min_seq) {
+	    min_seq = o->cur->seq;
+	}
+    }
+    while (log_head != NULL && log_head->seq < min_seq) {
+	obs_entry_t *next = log_head->next;
+
+	Free(log_head);
+	log_head = next;
+    }
+    if (log_head == NULL) {
+	log_tail = NULL;
+    }
+}
+
+/* Add an entry to the log. Consumes the text in r. */
+static void
+log_append(unsigned what, varbuf_t *r)
+{
+    obs_entry_t *e = (obs_entry_t *)Malloc(sizeof(obs_entry_t) +
+	    vb_len(r));
+    observer_t *o;
+
+    e->next = NULL;
+    e->seq = log_seq++;
+    e->what = what;
+    e->offset = log_bytes;
+    e->len = vb_len(r);
+    e->text = (char *)(e + 1);
+    memcpy(e->text, vb_buf(r), e->len);
+    vb_free(r);
+    log_bytes += e->len;
+    if (log_tail != NULL) {
+	log_tail->next = e;
+    } else {
+	log_head = e;
+    }
+    log_tail = e;
+
+    for (o = observers; o != NULL; o = o->next) {
+	if (o->cur == NULL) {
+	    o->cur = e;
+	} else if (log_bytes - o->cur->offset > o->limit) {
+	    /* Too far behind. Skip to this entry. */
+	    o->lost += e->seq - o->cur->seq;
+	    vtrace("Observer 0x%lx lost %" PRIu64 " entries\n",
+		    (unsigned long)(uintptr_t)o, e->seq - o->cur->seq);
+	    o->cur = e;
+	}
+    }
+    log_trim();
+}
+
+/* Send what an observer has not seen yet, until it blocks. */
+static void
+drain(observer_t *o)
+{
+    while (!o->blocked && (o->lost || o->cur != NULL)) {
+	obs_entry_t *e = o->cur;
+
+	if (o->lost) {
+	    const char *s = lazyaf("observe lost %" PRIu64 "\n", o->lost);
+
+	    if (!(*o->send)(o->context, s, strlen(s))) {
+		o->blocked = true;
+		break;
+	    }
+	    o->lost = 0;
+	    continue;
+	}
+	if ((e->what & o->what) && !(*o->send)(o->context, e->text, e->len)) {
+	    o->blocked = true;
+	    break;
+	}
+	o->cur = e->next;
+    }
+}
+
+/* Log pending NVT output. */
+static void
+nvt_seal(void)
+{
+    varbuf_t r;
+    const char *s;
+    size_t len;
+    size_t lines = 0;
+    size_t i;
+    size_t start = 0;
+
+    if (!nvt_initted || (len = vb_len(&nvt_pending)) == 0) {
+	return;
+    }
+    s = vb_buf(&nvt_pending);
+    for (i = 0; i < len; i++) {
+	if (s[i] == '\n') {
+	    lines++;
+	}
+    }
+    if (s[len - 1] != '\n') {
+	lines++;
+    }
+
+    /* One data line per line of output, without the CRs. */
+    vb_init(&r);
+    vb_appendf(&r, "observe nvt %" PRIu64 " %u\n", log_seq, (unsigned)lines);
+    for (i = 0; i <= len; i++) {
+	if (i == len || s[i] == '\n') {
+	    if (i > start || i < len) {
+		size_t end = i;
+
+		vb_appends(&r, DATA_PREFIX);
+		for (; start < end; start++) {
+		    if (s[start] != '\r') {
+			vb_append(&r, &s[start], 1);
+		    }
+		}
+		vb_append(&r, "\n", 1);
+	    }
+	    start = i + 1;
+	}
+    }
+    vb_reset(&nvt_pending);
+    log_append(OBS_NVT, &r);
+}
+
+/**
+ * Save a byte of NVT-mode host output.
+ *
+ * @param[in] c		Byte
+ */
+void
+observe_nvt_char(unsigned char c)
+{
+    if (!nvt_initted) {
+	vb_init(&nvt_pending);
+	nvt_initted = true;
+    }
+    vb_append(&nvt_pending, (char *)&c, 1);
+    if (vb_len(&nvt_pending) >= OBS_NVT_MAX) {
+	nvt_seal();
+    }
+}
+
+/**
+ * Log the screen after a host write.
+ */
+void
+observe_screen(void)
+{
+    varbuf_t r;
+    char *text;
+    char *line;
+    char *nl;
+
+    if (!(observe_classes & OBS_SCREEN)) {
+	return;
+    }
+
+    /* Keep the order of any NVT output that came first. */
+    nvt_seal();
+
+    vb_init(&r);
+    vb_appendf(&r, "observe screen %" PRIu64 " %d %d\n", log_seq, ROWS, COLS);
+    text = dump_screen_text(ea_buf, ROWS, COLS, true);
+    for (line = text; *line; line = nl + 1) {
+	nl = strchr(line, '\n');
+	if (nl == NULL) {
+	    nl = line + strlen(line);
+	}
+	vb_appends(&r, DATA_PREFIX);
+	vb_append(&r, line, nl - line);
+	vb_append(&r, "\n", 1);
+	if (!*nl) {
+	    break;
+	}
+    }
+    Free(text);
+    log_append(OBS_SCREEN, &r);
+}
+
+/**
+ * Send what has been logged to each observer. Called from the event loop.
+ */
+void
+observe_flush(void)
+{
+    observer_t *o;
+
+    if (observers == NULL) {
+	return;
+    }
+    nvt_seal();
+    for (o = observers; o != NULL; o = o->next) {
+	drain(o);
+    }
+    log_trim();
+}
+
+/**
+ * Resume sending to an observer that was blocked.
+ *
+ * @param[in,out] o	Observer
+ */
+void
+observe_drain(observer_t *o)
+{
+    o->blocked = false;
+    drain(o);
+    log_trim();
+}
+
+/**
+ * Add an observer. It sees host output from now on.
+ *
+ * @param[in] what	OBS_SCREEN and/or OBS_NVT
+ * @param[in] limit	How far it may fall behind, in bytes
+ * @param[in] send	Output function
+ * @param[in] context	Context for send
+ *
+ * @return Observer
+ */
+observer_t *
+observe_add(unsigned what, size_t limit, observe_send_fn *send, void *context)
+{
+    observer_t *o = (observer_t *)Calloc(1, sizeof(observer_t));
+
+    o->what = what;
+    o->limit = limit;
+    o->send = send;
+    o->context = context;
+    o->next = observers;
+    observers = o;
+    set_classes();
+    vtrace("Observer 0x%lx added\n", (unsigned long)(uintptr_t)o);
+    return o;
+}
+
+/**
+ * Change what an observer sees.
+ *
+ * @param[in,out] o	Observer
+ * @param[in] what	OBS_SCREEN and/or OBS_NVT
+ * @param[in] limit	How far it may fall behind, in bytes
+ */
+void
+observe_change(observer_t *o, unsigned what, size_t limit)
+{
+    o->what = what;
+    o->limit = limit;
+    set_classes();
+}
+
+/**
+ * Remove an observer.
+ *
+ * @param[in] o		Observer
+ */
+void
+observe_remove(observer_t *o)
+{
+    observer_t **p;
+
+    for (p = &observers; *p != NULL; p = &(*p)->next) {
+	if (*p == o) {
+	    *p = o->next;
+	    break;
+	}
+    }
+    vtrace("Observer 0x%lx removed\n", (unsigned long)(uintptr_t)o);
+    Free(o);
+    set_classes();
+    log_trim();
+    if (observers == NULL && nvt_initted) {
+	vb_reset(&nvt_pending);
+    }
+}
+
+/*
+ * The Observe action.
+ *  Observe([Screen|Nvt|All|Off][,limit])
+ * Makes the current script connection an observer.
+ */
+static bool
+Observe_action(ia_t ia, unsigned argc, const char **argv)
+{
+    unsigned what = OBS_SCREEN | OBS_NVT;
+    size_t limit = OBS_LIMIT_DEFAULT;
+
+    action_debug(AnObserve, ia, argc, argv);
+    if (check_argc(AnObserve, argc, 0, 2) < 0) {
+	return false;
+    }
+
+    if (argc > 0) {
+	if (!strcasecmp(argv[0], KwScreen)) {
+	    what = OBS_SCREEN;
+	} else if (!strcasecmp(argv[0], KwNvt)) {
+	    what = OBS_NVT;
+	} else if (!strcasecmp(argv[0], KwAll)) {
+	    what = OBS_SCREEN | OBS_NVT;
+	} else if (!strcasecmp(argv[0], KwOff)) {
+	    what = 0;
+	} else {
+	    popup_an_error(AnObserve "(): Parameter must be " KwScreen ", "
+		    KwNvt ", " KwAll " or " KwOff);
+	    return false;
+	}
+    }
+    if (argc > 1) {
+	unsigned long l;
+	char *end;
+
+	l = strtoul(argv[1], &end, 10);
+	if (*end != '\0' || l == 0) {
+	    popup_an_error(AnObserve "(): Invalid limit '%s'", argv[1]);
+	    return false;
+	}
+	limit = (size_t)l;
+    }
+
+    if (!task_observe(what, limit)) {
+	popup_an_error(AnObserve "(): Only a peer script connection can "
+		"observe");
+	return false;
+    }
+    return true;
+}
+
+/**
+ * Observer module registration.
+ */
+void
+observe_register(void)
+{
+    static action_table_t observe_actions[] = {
+	{ AnObserve,	Observe_action, 0 }
+    };
+
+    register_actions(observe_actions, array_count(observe_actions));
+}
@@ -49,6 +49,7 @@
 #include "actions.h"
 #include "kybd.h"
 #include "lazya.h"
+#include "observe.h"
 #include "peerscript.h"
 #include "popups.h"
 #include "s3270_proto.h"
@@ -75,6 +76,7 @@ static void peer_setir_state(task_cbh handle, const char *name, void *state,
 static void *peer_getir_state(task_cbh handle, const char *name);
 static void peer_reqinput(task_cbh handle, const char *buf, size_t len,
 	bool echo);
+static bool peer_observe(task_cbh handle, unsigned what, size_t limit);
 
 static irv_t peer_irv = {
     peer_setir,
@@ -96,7 +98,8 @@ static tcb_t peer_cb = {
     peer_getflags,
     &peer_irv,
     NULL,
-    peer_reqinput
+    peer_reqinput,
+    peer_observe
 };
 
 /* Callback block for an interactive peer. */
@@ -112,7 +115,8 @@ static tcb_t interactive_cb = {
     peer_getflags,
     &peer_irv,
     NULL,
-    peer_reqinput
+    peer_reqinput,
+    peer_observe
 };
 
 /* Peer script context. */
@@ -124,13 +128,21 @@ typedef struct {
 #endif /*]*/
     peer_listen_t listener;
     ioid_t id;		/* I/O identifier */
-    char *buf;		/* pending command */
-    size_t buf_len;	/* length of pending command */
+    char *buf;		/* pending commands */
+    size_t buf_len;	/* length of pending commands */
+    size_t buf_start;	/* offset of the next command in buf */
+    size_t buf_alloc;	/* allocated size of buf */
+    size_t read_size;	/* size of the next read */
     bool enabled;	/* is this peer enabled? */
     char *name;		/* task name */
     unsigned capabilities; /* self-reported capabilities */
     void *irhandle;	/* input request handle */
     task_cb_ir_state_t ir_state; /* named input request state */
+    varbuf_t obuf;	/* pending output */
+    size_t obuf_start;	/* offset of the first unsent byte in obuf */
+    bool running;	/* a command is running */
+    observer_t *observer; /* host output observer */
+    ioid_t output_id;	/* I/O identifier for output space */
 } peer_t;
 static llist_t peer_scripts = LLIST_INIT(peer_scripts);
 
@@ -147,6 +159,183 @@ struct _peer_listen {
 };
 static llist_t peer_listeners = LLIST_INIT(peer_listeners);
 
+/* Output is sent once this much is pending, even if more commands are. */
+#define PEER_OBUF_MAX	16384
+
+/* Input read sizes. Reads grow while they keep filling the buffer. */
+#define PEER_READ_MIN	8192
+#define PEER_READ_MAX	(256 * 1024)
+
+/**
+ * Send pending output to a peer.
+ *
+ * @param[in,out] p	Peer
+ */
+static void
+peer_flush(peer_t *p)
+{
+    const char *s = vb_buf(&p->obuf) + p->obuf_start;
+    size_t len = vb_len(&p->obuf) - p->obuf_start;
+
+    while (len > 0 && p->socket != INVALID_SOCKET) {
+	ssize_t ns = send(p->socket, s, (int)len, 0);
+
+	if (ns <= 0) {
+	    popup_a_sockerr("s3sock send");
+	    break;
+	}
+	s += ns;
+	len -= ns;
+    }
+    vb_reset(&p->obuf);
+    p->obuf_start = 0;
+    if (p->output_id != NULL_IOID) {
+	RemoveInput(p->output_id);
+	p->output_id = NULL_IOID;
+    }
+}
+
+/**
+ * Queue output for a peer.
+ *
+ * Output is held while more commands from the peer are waiting to run, so
+ * a client that pipelines its commands gets its results in large writes.
+ * Interactive peers see each line immediately.
+ *
+ * @param[in,out] p	Peer
+ * @param[in] s		Text to send
+ */
+static void
+peer_send(peer_t *p, const char *s)
+{
+    vb_appends(&p->obuf, s);
+    if ((p->capabilities & CBF_INTERACTIVE) ||
+	    vb_len(&p->obuf) >= PEER_OBUF_MAX) {
+	peer_flush(p);
+    }
+}
+
+#if defined(MSG_DONTWAIT) /*[*/
+static bool peer_flush_nb(peer_t *p);
+
+/**
+ * The socket has room for more observer output.
+ *
+ * @param[in] fd	File descriptor
+ * @param[in] id	I/O identifier
+ */
+static void
+peer_output(iosrc_t fd _is_unused, ioid_t id)
+{
+    peer_t *p;
+    bool found_peer = false;
+
+    FOREACH_LLIST(&peer_scripts, p, peer_t *) {
+	if (p->output_id == id) {
+	    found_peer = true;
+	    break;
+	}
+    } FOREACH_LLIST_END(&peer_scripts, p, peer_t *);
+    assert(found_peer);
+
+    RemoveInput(p->output_id);
+    p->output_id = NULL_IOID;
+    if (peer_flush_nb(p) && p->observer != NULL) {
+	observe_drain(p->observer);
+    }
+}
+
+/**
+ * Send pending output to a peer without blocking.
+ *
+ * @param[in,out] p	Peer
+ *
+ * @return true if everything was sent, false if the rest will be sent when
+ *  the socket has room
+ */
+static bool
+peer_flush_nb(peer_t *p)
+{
+    while (p->obuf_start < vb_len(&p->obuf) && p->socket != INVALID_SOCKET) {
+	ssize_t ns = send(p->socket, vb_buf(&p->obuf) + p->obuf_start,
+		vb_len(&p->obuf) - p->obuf_start, MSG_DONTWAIT);
+
+	if (ns < 0 && (errno == EWOULDBLOCK || errno == EAGAIN)) {
+	    if (p->output_id == NULL_IOID) {
+		p->output_id = AddOutput(p->socket, peer_output);
+	    }
+	    return false;
+	}
+	if (ns <= 0) {
+	    popup_a_sockerr("s3sock send");
+	    break;
+	}
+	p->obuf_start += ns;
+    }
+    vb_reset(&p->obuf);
+    p->obuf_start = 0;
+    return true;
+}
+#endif /*]*/
+
+/**
+ * Send host output to an observing peer.
+ *
+ * Output is held while a command from the peer is running, so it does not
+ * get mixed up with the command's own output, and while earlier output is
+ * still waiting for room in the socket.
+ *
+ * @param[in] context	Peer
+ * @param[in] buf	Text to send
+ * @param[in] len	Length of text
+ *
+ * @return true if the text was taken
+ */
+static bool
+peer_observe_send(void *context, const char *buf, size_t len)
+{
+    peer_t *p = (peer_t *)context;
+
+    if (p->running || p->obuf_start < vb_len(&p->obuf)) {
+	return false;
+    }
+    vb_append(&p->obuf, buf, len);
+#if defined(MSG_DONTWAIT) /*[*/
+    peer_flush_nb(p);
+#else /*][*/
+    peer_flush(p);
+#endif /*]*/
+    return true;
+}
+
+/**
+ * Make a peer an observer of host output, change what it observes, or
+ * stop it observing.
+ *
+ * @param[in] handle	Callback handle
+ * @param[in] what	OBS_SCREEN and/or OBS_NVT, or 0 to stop
+ * @param[in] limit	How far it may fall behind, in bytes
+ *
+ * @return true
+ */
+static bool
+peer_observe(task_cbh handle, unsigned what, size_t limit)
+{
+    peer_t *p = (peer_t *)handle;
+
+    if (!what) {
+	if (p->observer != NULL) {
+	    observe_remove(p->observer);
+	    p->observer = NULL;
+	}
+    } else if (p->observer != NULL) {
+	observe_change(p->observer, what, limit);
+    } else {
+	p->observer = observe_add(what, limit, peer_observe_send, p);
+    }
+    return true;
+}
+
 /**
  * Tear down a peer connection.
  *
@@ -156,6 +345,12 @@ static void
 close_peer(peer_t *p)
 {
     llist_unlink(&p->llist);
+    if (p->observer != NULL) {
+	observe_remove(p->observer);
+	p->observer = NULL;
+    }
+    peer_flush(p);
+    vb_free(&p->obuf);
     if (p->socket != INVALID_SOCKET) {
 	SOCK_CLOSE(p->socket);
 	p->socket = INVALID_SOCKET;
@@ -192,36 +387,34 @@ close_peer(peer_t *p)
 static bool
 run_next(peer_t *p)
 {
-    size_t cmdlen;
+    char *cmd;
+    char *nl;
     char *name;
 
     /* Find a newline in the buffer. */
-    for (cmdlen = 0; cmdlen < p->buf_len; cmdlen++) {
-	if (p->buf[cmdlen] == '\n') {
-	    break;
-	}
+    if (p->buf_start >= p->buf_len) {
+	return false;
     }
-    if (cmdlen >= p->buf_len) {
+    cmd = p->buf + p->buf_start;
+    nl = memchr(cmd, '\n', p->buf_len - p->buf_start);
+    if (nl == NULL) {
 	return false;
     }
 
-    /*
-     * Run the first command.
-     * cmdlen is the number of characters in the command, not including the
-     * newline.
-     */
-    name = push_cb(p->buf, cmdlen,
+    /* Run the first command, not including the newline. */
+    p->running = true;
+    name = push_cb(cmd, nl - cmd,
 	    (p->capabilities & CBF_INTERACTIVE)? &interactive_cb : &peer_cb,
 	    (task_cbh)p);
     Replace(p->name, NewString(name));
 
-    /* If there is more, shift it over. */
-    cmdlen++; /* count the newline */
-    if (p->buf_len > cmdlen) {
-	memmove(p->buf, p->buf + cmdlen, p->buf_len - cmdlen);
-	p->buf_len = p->buf_len - cmdlen;
-    } else {
-	Replace(p->buf, NULL);
+    /*
+     * Step past it. The rest is shifted down only when more input is read,
+     * so a large batch is not copied once per command.
+     */
+    p->buf_start = (nl + 1) - p->buf;
+    if (p->buf_start >= p->buf_len) {
+	p->buf_start = 0;
 	p->buf_len = 0;
     }
     return true;
@@ -237,10 +430,9 @@ peer_input(iosrc_t fd _is_unused, ioid_t id)
 {
     peer_t *p;
     bool found_peer = false;
-    char buf[8192];
-    size_t n2r;
+    char *buf;
+    char *cr;
     ssize_t nr;
-    ssize_t i;
 
     /* Find the peer. */
     FOREACH_LLIST(&peer_scripts, p, peer_t *) {
@@ -251,9 +443,20 @@ peer_input(iosrc_t fd _is_unused, ioid_t id)
     } FOREACH_LLIST_END(&peer_scripts, p, peer_t *);
     assert(found_peer);
 
+    /* Make room for the read, after any input not yet consumed. */
+    if (p->buf_start > 0) {
+	memmove(p->buf, p->buf + p->buf_start, p->buf_len - p->buf_start);
+	p->buf_len -= p->buf_start;
+	p->buf_start = 0;
+    }
+    if (p->buf_alloc < p->buf_len + p->read_size) {
+	p->buf_alloc = p->buf_len + p->read_size;
+	p->buf = Realloc(p->buf, p->buf_alloc);
+    }
+
     /* Read input. */
-    n2r = sizeof(buf);
-    nr = recv(p->socket, buf, (int)n2r, 0);
+    buf = p->buf + p->buf_len;
+    nr = recv(p->socket, buf, (int)p->read_size, 0);
     if (nr < 0) {
 #if defined(_WIN32) /*[*/
 	if (GetLastError() != WSAECONNRESET) {
@@ -274,15 +477,27 @@ peer_input(iosrc_t fd _is_unused, ioid_t id)
 	return;
     }
 
-    /* Append, filtering out CRs. */
-    p->buf = Realloc(p->buf, p->buf_len + nr + 1);
-    for (i = 0; i < nr; i++) {
-	char c = buf[i];
+    /* Grow the next read if this one filled the buffer, shrink it if idle. */
+    if ((size_t)nr == p->read_size && p->read_size < PEER_READ_MAX) {
+	p->read_size *= 2;
+    } else if ((size_t)nr < p->read_size / 4 &&
+	    p->read_size > PEER_READ_MIN) {
+	p->read_size /= 2;
+    }
+
+    /* Keep it, filtering out CRs. */
+    if ((cr = memchr(buf, '\r', nr)) != NULL) {
+	char *end = buf + nr;
+	char *t = cr;
 
-	if (c != '\r') {
-	    p->buf[p->buf_len++] = c;
+	for (; cr < end; cr++) {
+	    if (*cr != '\r') {
+		*t++ = *cr;
+	    }
 	}
+	nr = t - buf;
     }
+    p->buf_len += nr;
 
     /* Disable further input. */
     if (p->id != NULL_IOID) {
@@ -313,13 +528,8 @@ static void
 peer_data(task_cbh handle, const char *buf, size_t len, bool success)
 {
     peer_t *p = (peer_t *)handle;
-    char *s = lazyaf(DATA_PREFIX "%.*s\n", (int)len, buf);
-    ssize_t ns;
 
-    ns = send(p->socket, s, strlen(s), 0);
-    if (ns < 0) {
-	popup_a_sockerr("s3sock send");
-    }
+    peer_send(p, lazyaf(DATA_PREFIX "%.*s\n", (int)len, buf));
 }
 
 /**
@@ -334,14 +544,11 @@ static void
 peer_reqinput(task_cbh handle, const char *buf, size_t len, bool echo)
 {
     peer_t *p = (peer_t *)handle;
-    char *s = lazyaf("%s%.*s\n", echo? INPUT_PREFIX: PWINPUT_PREFIX, (int)len,
-	    buf);
-    ssize_t ns;
 
-    ns = send(p->socket, s, strlen(s), 0);
-    if (ns < 0) {
-	popup_a_sockerr("s3sock send");
-    }
+    /* The client has to see this before it can answer. */
+    peer_send(p, lazyaf("%s%.*s\n", echo? INPUT_PREFIX: PWINPUT_PREFIX,
+		(int)len, buf));
+    peer_flush(p);
 }
 
 /**
@@ -361,10 +568,12 @@ peer_done(task_cbh handle, bool success, bool abort)
     char *s = lazyaf("%s\n%s\n", prompt, success? PROMPT_OK: PROMPT_ERROR);
     bool new_child = false;
 
+    p->running = false;
+
     /* Print the prompt. */
     vtrace("Output for %s: '%s/%s'\n", p->name, prompt,
 	    success? PROMPT_OK: PROMPT_ERROR);
-    send(p->socket, s, strlen(s), 0);
+    peer_send(p, s);
 
     if (abort || !p->enabled) {
 	close_peer(p);
@@ -373,6 +582,15 @@ peer_done(task_cbh handle, bool success, bool abort)
 
     /* Run any pending command that we already read in. */
     new_child = run_next(p);
+    if (!new_child) {
+	/* The client is waiting for us. */
+	peer_flush(p);
+
+	/* Send any host output held while the command ran. */
+	if (p->observer != NULL) {
+	    observe_drain(p->observer);
+	}
+    }
     if (!new_child && p->id == NULL_IOID) {
 	/* Allow more input. */
 #if defined(_WIN32) /*[*/
@@ -611,7 +829,11 @@ peer_accepted(socket_t s, void *listener)
 #endif /*]*/
     p->buf = NULL;
     p->buf_len = 0;
+    p->buf_start = 0;
+    p->buf_alloc = 0;
+    p->read_size = PEER_READ_MIN;
     p->enabled = true;
+    vb_init(&p->obuf);
     task_cb_init_ir_state(&p->ir_state);
     LLIST_APPEND(&p->llist, peer_scripts);
 }
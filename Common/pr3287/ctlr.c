@@ -46,6 +46,8 @@
 #include <sys/types.h>
 #if !defined(_WIN32) /*[*/
 #include <sys/wait.h>
+#include <sys/select.h>
+#include <fcntl.h>
 #endif /*]*/
 #include <signal.h>
 #include "globals.h"
@@ -77,6 +79,7 @@
 #define INVISIBLE	0x02	/* invisible field */
 
 #define BUFSZ		4096
+#define PRBUF_SIZE	65536	/* printer output buffer */
 
 #define FCORDER_NOP	0x0001	/* dummy filler for DBCS right half */
 
@@ -97,10 +100,26 @@ static int any_3270_output = 0;
 #if !defined(_WIN32) /*[*/
 static FILE *prfile = NULL;
 static int prpid = -1;
+static unsigned char prbuf[PRBUF_SIZE];
+static size_t prbuf_len = 0;
+static bool prjob = false;	/* print job in progress */
+
+/* Output waiting for the printer process, in order. */
+typedef struct spool {
+    struct spool *next;
+    size_t len;			/* data length, data follows */
+    size_t off;			/* amount already written */
+    bool eoj;			/* close the printer process here */
+} spool_t;
+static spool_t *spool_head = NULL;
+static spool_t *spool_tail = NULL;
+static size_t spool_bytes = 0;	/* unwritten data */
+static bool spool_skip = false;	/* discarding the rest of a failed job */
 #else /*][*/
 static int ws_initted = 0;
 static int ws_needpre = 1;
 #endif /*]*/
+static bool prpending = false;
 static unsigned char wcc_line_length;
 
 static int ctlr_erase(void);
@@ -108,6 +127,9 @@ static int dump_formatted(void);
 static int dump_unformatted(void);
 static int stash(unsigned char c);
 static int prflush(void);
+#if !defined(_WIN32) /*[*/
+static int prput(unsigned char c);
+#endif /*]*/
 static int copyfile(const char *filename);
 
 #define DECODE_BADDR(c1, c2) \
@@ -605,6 +627,74 @@ unicode_to_printer(ucs4_t u, char mb[], int mb_len)
 }
 #endif /*[*/
 
+/*
+ * Translations that are fixed once the code page is set up, built on first
+ * use: EBCDIC to Unicode for SBCS text, and a direct-mapped cache of
+ * printer encodings, keyed by the low byte of the Unicode value.
+ */
+static ucs4_t ebc_uc[256];
+static bool ebc_uc_initted = false;
+static struct {
+    ucs4_t uc;			/* Unicode value */
+    int len;			/* length of encoding, -1 if empty slot */
+    char mb[16];		/* printer encoding */
+} prenc[256];
+static bool prenc_initted = false;
+
+/* Translate an SBCS EBCDIC character to Unicode. */
+static ucs4_t
+scs_ebcdic_to_unicode(unsigned char ebc)
+{
+    if (!ebc_uc_initted) {
+	int i;
+
+	for (i = 0; i < 256; i++) {
+	    ebc_uc[i] = ebcdic_to_unicode(i, CS_BASE, EUO_NONE);
+	}
+	ebc_uc_initted = true;
+    }
+    return ebc_uc[ebc];
+}
+
+/*
+ * Translate a Unicode character to the bytes to send to the printer.
+ * Characters with no translation are sent as a space.
+ * Returns the length, and the bytes in *mbp.
+ */
+static int
+printer_encode(ucs4_t u, const char **mbp)
+{
+    int i = u & 0xff;
+
+    if (!prenc_initted) {
+	int j;
+
+	for (j = 0; j < 256; j++) {
+	    prenc[j].len = -1;
+	}
+	prenc_initted = true;
+    }
+    if (prenc[i].len < 0 || prenc[i].uc != u) {
+	int len;
+
+#if !defined(_WIN32) /*[*/
+	len = unicode_to_multibyte(u, prenc[i].mb, sizeof(prenc[i].mb));
+#else /*][*/
+	len = unicode_to_printer(u, prenc[i].mb, sizeof(prenc[i].mb));
+#endif /*]*/
+	if (len == 0) {
+	    prenc[i].mb[0] = ' ';
+	    len = 1;
+	} else {
+	    len--;
+	}
+	prenc[i].uc = u;
+	prenc[i].len = len;
+    }
+    *mbp = prenc[i].mb;
+    return prenc[i].len;
+}
+
 /*
  * Our philosophy for automatic newlines and formfeeds is that we generate them
  * only if the user attempts to put data outside the MPP/MPL-defined area.
@@ -663,7 +753,7 @@ dump_scs_line(bool reset_pp, bool always_nl)
 		trnbuf[j].data_len = 0;
 	    }
 	    if (j < i || linebuf[j] != ' ') {
-		char mb[16];
+		const char *mb;
 		int len;
 
 		if (linebuf[j] == FCORDER_NOP) {
@@ -672,17 +762,7 @@ dump_scs_line(bool reset_pp, bool always_nl)
 		n_data++;
 		any_data = true;
 		scs_any = true;
-#if !defined(_WIN32) /*[*/
-		len = unicode_to_multibyte(linebuf[j], mb, sizeof(mb));
-#else /*][*/
-		len = unicode_to_printer(linebuf[j], mb, sizeof(mb));
-#endif /*]*/
-		if (len == 0) {
-		    mb[0] = ' ';
-		    len = 1;
-		} else {
-		    len--;
-		}
+		len = printer_encode(linebuf[j], &mb);
 		for (k = 0; k < len; k++) {
 		    if (stash(mb[k]) < 0) {
 			return -1;
@@ -1309,8 +1389,8 @@ process_scs_contig(unsigned char *buf, size_t buflen)
 		last = DATA;
 		break;
 	    }
-	    uc = ebcdic_to_unicode(*cp, CS_BASE, EUO_NONE);
-	    {
+	    uc = scs_ebcdic_to_unicode(*cp);
+	    if (tracef != NULL) {
 		char mb[16];
 
 		unicode_to_multibyte(uc, mb, sizeof(mb));
@@ -1463,55 +1543,291 @@ stash(unsigned char c)
 	return -1;
     }
 #else /*][*/
-    if (prfile == NULL) {
-	prfile = popen_no_sigint(options.command);
-	if (prfile == NULL) {
-	    errmsg("%s: %s", options.command, strerror(errno));
-	    return -1;
-	}
+    if (!prjob) {
+	/* Start a new job. The printer process is started by spool_run(). */
+	prjob = true;
 	if ((options.trnpre != NULL) && copyfile(options.trnpre) < 0) {
-	    pclose_no_sigint(prfile);
-	    prfile = NULL;
+	    prbuf_len = 0;
+	    prjob = false;
 	    return -1;
 	}
     }
 
     trace_pdc(c);
-    if (fputc(c, prfile) == EOF) {
-	errmsg("Write error to '%s': %s", options.command, strerror(errno));
-	pclose_no_sigint(prfile);
-	prfile = NULL;
+    if (prput(c) < 0) {
 	return -1;
     }
 #endif /*]*/
 
+    prpending = true;
     return 0;
 }
 
+#if !defined(_WIN32) /*[*/
 /*
- * Flush the pipe going to the printer process, to try to flush out any
- * pending errors.
+ * Start the printer process.
  */
 static int
-prflush(void)
+spool_open(void)
 {
-#if defined(_WIN32) /*[*/
-    if (ws_initted && ws_flush() < 0) {
+    prfile = popen_no_sigint(options.command);
+    if (prfile == NULL) {
+	errmsg("%s: %s", options.command, strerror(errno));
 	return -1;
     }
-#else /*][*/
-    if (prfile != NULL) {
-	if (fflush(prfile) < 0) {
-	    errmsg("Flush error to '%s': %s", options.command, strerror(errno));
+    fcntl(fileno(prfile), F_SETFL,
+	    fcntl(fileno(prfile), F_GETFL) | O_NONBLOCK);
+    return 0;
+}
+
+/*
+ * Close the pipe to the printer process and collect its status.
+ */
+static int
+spool_close(void)
+{
+    int status = pclose_no_sigint(prfile);
+
+    prfile = NULL;
+    if (status) {
+	if (status < 0) {
+	    errmsg("Close error on '%s': %s", options.command,
+		    strerror(errno));
+	} else if (WIFEXITED(status)) {
+	    errmsg("'%s' exited with status %d", options.command,
+		    WEXITSTATUS(status));
+	} else if (WIFSIGNALED(status)) {
+	    errmsg("'%s' terminated by signal %d", options.command,
+		    WTERMSIG(status));
+	} else {
+	    errmsg("'%s' returned status %d", options.command, status);
+	}
+	return -1;
+    }
+    return 0;
+}
+
+/*
+ * Remove the first entry from the spool.
+ */
+static void
+spool_pop(void)
+{
+    spool_t *sp = spool_head;
+
+    spool_bytes -= sp->len - sp->off;
+    spool_head = sp->next;
+    if (spool_head == NULL) {
+	spool_tail = NULL;
+    }
+    Free(sp);
+}
+
+/*
+ * Add data, or an end-of-job marker, to the spool.
+ */
+static void
+spool_add(const unsigned char *data, size_t len, bool eoj)
+{
+    spool_t *sp = Malloc(sizeof(spool_t) + len);
+
+    sp->next = NULL;
+    sp->len = len;
+    sp->off = 0;
+    sp->eoj = eoj;
+    if (len) {
+	memcpy(sp + 1, data, len);
+    }
+    if (spool_tail != NULL) {
+	spool_tail->next = sp;
+    } else {
+	spool_head = sp;
+    }
+    spool_tail = sp;
+    spool_bytes += len;
+}
+
+/*
+ * Write as much of the spool to the printer process as it will take.
+ *
+ * With no -spoollimit, or if the spool is over its limit, waits for the
+ * printer process to catch up. Otherwise this returns as soon as the pipe
+ * is full, and it is called again from the network loop when the pipe
+ * becomes writable.
+ *
+ * Returns -1 if any errors were reported.
+ */
+static int
+spool_run(bool drain)
+{
+    int rv = 0;
+
+    while (spool_head != NULL) {
+	spool_t *sp = spool_head;
+	ssize_t nw;
+
+	if (sp->eoj) {
+	    if (prfile != NULL && spool_close() < 0) {
+		rv = -1;
+	    }
+	    spool_skip = false;
+	    spool_pop();
+	    continue;
+	}
+	if (spool_skip) {
+	    /* Discard the rest of a failed job. */
+	    spool_pop();
+	    continue;
+	}
+	if (prfile == NULL && spool_open() < 0) {
+	    spool_skip = true;
+	    rv = -1;
+	    continue;
+	}
+
+	nw = write(fileno(prfile), (unsigned char *)(sp + 1) + sp->off,
+		sp->len - sp->off);
+	if (nw < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+		fd_set wfds;
+
+		if (!drain && options.spool_limit &&
+			spool_bytes <= options.spool_limit) {
+		    break;
+		}
+		FD_ZERO(&wfds);
+		FD_SET(fileno(prfile), &wfds);
+		select(fileno(prfile) + 1, NULL, &wfds, NULL, NULL);
+		continue;
+	    }
+	    errmsg("Write error to '%s': %s", options.command, strerror(errno));
 	    pclose_no_sigint(prfile);
 	    prfile = NULL;
-	    return -1;
+	    spool_skip = true;
+	    rv = -1;
+	    continue;
+	}
+	sp->off += nw;
+	spool_bytes -= nw;
+	if (sp->off == sp->len) {
+	    spool_pop();
 	}
     }
+    return rv;
+}
+
+/*
+ * Move the output buffer to the spool and start writing it.
+ */
+static int
+prdrain(void)
+{
+    if (prbuf_len == 0) {
+	return 0;
+    }
+    spool_add(prbuf, prbuf_len, false);
+    prbuf_len = 0;
+    return spool_run(false);
+}
+
+/*
+ * Add a character to the output buffer, writing it out when it fills.
+ */
+static int
+prput(unsigned char c)
+{
+    prbuf[prbuf_len++] = c;
+    if (prbuf_len >= PRBUF_SIZE) {
+	return prdrain();
+    }
+    return 0;
+}
+#endif /*]*/
+
+/*
+ * Push buffered output through to the printer.
+ */
+int
+print_flush(void)
+{
+    prpending = false;
+#if defined(_WIN32) /*[*/
+    if (ws_initted && ws_flush() < 0) {
+	return -1;
+    }
+#else /*][*/
+    if (prdrain() < 0) {
+	return -1;
+    }
 #endif /*]*/
     return 0;
 }
 
+/*
+ * Returns true if there is output that has not been pushed to the printer.
+ */
+bool
+print_pending(void)
+{
+    return prpending;
+}
+
+/*
+ * Returns the printer pipe if there is spooled output waiting for it to
+ * become writable, or -1.
+ */
+int
+print_spool_fd(void)
+{
+#if !defined(_WIN32) /*[*/
+    if (spool_head != NULL && prfile != NULL) {
+	return fileno(prfile);
+    }
+#endif /*]*/
+    return -1;
+}
+
+/*
+ * Continue writing spooled output, when the printer pipe is writable.
+ */
+void
+print_spool_run(void)
+{
+#if !defined(_WIN32) /*[*/
+    spool_run(false);
+#endif /*]*/
+}
+
+/*
+ * Wait for all spooled output to be written and the last job to complete.
+ */
+void
+print_drain(void)
+{
+#if !defined(_WIN32) /*[*/
+    spool_run(true);
+#endif /*]*/
+}
+
+/*
+ * Flush the pipe going to the printer process at the end of a print unit,
+ * to try to flush out any pending errors.
+ *
+ * With -flushtimeout, output is instead held until the buffer fills, the
+ * job ends, or the connection has been idle for that long.
+ */
+static int
+prflush(void)
+{
+    if (options.flush_timeout) {
+	return 0;
+    }
+    return print_flush();
+}
+
 /*
  * Change a character in the 3270 buffer.
  */
@@ -1732,7 +2048,6 @@ dump_unformatted(void)
     int prcol = 0;
     ucs4_t c;
     int done = 0;
-    char mb[16];
     const char *mbp;
     int len;
     int j;
@@ -1794,18 +2109,7 @@ dump_unformatted(void)
 		break;
 	    }
 
-#if !defined(_WIN32) /*[*/
-	    len = unicode_to_multibyte(c, mb, sizeof(mb));
-#else /*][*/
-	    len = unicode_to_printer(c, mb, sizeof(mb));
-#endif /*]*/
-	    if (len == 0) {
-		mb[0] = ' ';
-		len = 1;
-	    } else {
-		len--;
-	    }
-	    mbp = mb;
+	    len = printer_encode(c, &mbp);
 	    for (j = 0; j < len; j++) {
 		if (uoutput(mbp[j]) < 0) {
 		    return -1;
@@ -1842,14 +2146,10 @@ dump_unformatted(void)
     uo_last_cr = false;
 
     /* Flush buffered data. */
-#if defined(_WIN32) /*[*/
-    if (ws_initted) {
-	ws_flush();
-    }
-#else /*][*/
-    fflush(prfile);
-#endif /*]*/
     any_3270_output = 0;
+    if (prflush() < 0) {
+	return -1;
+    }
 
     return 0;
 }
@@ -1951,21 +2251,11 @@ dump_formatted(void)
 			return -1;
 		    }
 		} else {
-		    char mb[16];
+		    const char *mb;
 		    int len;
 		    int j;
 
-#if !defined(_WIN32) /*[*/
-		    len = unicode_to_multibyte(c, mb, sizeof(mb));
-#else /*][*/
-		    len = unicode_to_printer(c, mb, sizeof(mb));
-#endif /*]*/
-		    if (len == 0) {
-			mb[0] = ' ';
-			len = 1;
-		    } else {
-			len--;
-		    }
+		    len = printer_encode(c, &mb);
 		    for (j = 0; j < len; j++) {
 			if (stash(mb[j]) < 0) {
 			    return -1;
@@ -1998,14 +2288,10 @@ dump_formatted(void)
 
     /* Clear the buffer. */
     memset(page_buf, '\0', MAX_BUF * sizeof(ucs4_t));
-#if defined(_WIN32) /*[*/
-    if (ws_initted) {
-	    ws_flush();
-    }
-#else /*][*/
-    fflush(prfile);
-#endif /*]*/
     any_3270_output = 0;
+    if (prflush() < 0) {
+	return -1;
+    }
 
     return 0;
 }
@@ -2073,30 +2359,23 @@ print_eoj(void)
 	ws_needpre = 1;
     }
 #else /*]*/
-    if (prfile != NULL) {
+    if (prjob) {
 	trace_ds("End of print job.\n");
 	if (options.trnpost != NULL && copyfile(options.trnpost) < 0) {
 	    rc = -1;
 	}
-	rc = pclose_no_sigint(prfile);
-	if (rc) {
-	    if (rc < 0) {
-		errmsg("Close error on '%s': %s", options.command,
-			strerror(errno));
-	    } else if (WIFEXITED(rc)) {
-		errmsg("'%s' exited with status %d", options.command,
-			WEXITSTATUS(rc));
-	    } else if (WIFSIGNALED(rc)) {
-		errmsg("'%s' terminated by signal %d", options.command,
-			WTERMSIG(rc));
-	    } else {
-		errmsg("'%s' returned status %d", options.command, rc);
-	    }
+	if (prbuf_len) {
+	    spool_add(prbuf, prbuf_len, false);
+	    prbuf_len = 0;
+	}
+	spool_add(NULL, 0, true);
+	prjob = false;
+	if (spool_run(false) < 0) {
 	    rc = -1;
 	}
-	prfile = NULL;
     }
 #endif /*]*/
+    prpending = false;
 
     /* Make sure the next 3270 job starts with clean conditions. */
     page_buf_initted = 0;
@@ -2166,8 +2445,7 @@ copyfile(const char *filename)
 #if defined(_WIN32) /*[*/
 	if (ws_putc(c) < 0) {
 #else /*][*/
-	if (fputc(c, prfile) < 0) {
-	    errmsg("write(%s): %s", options.command, strerror(errno));
+	if (prput((unsigned char)c) < 0) {
 #endif /*]*/
 	    rc = -1;
 	    break;
@@ -41,6 +41,11 @@ enum pds {
 void ctlr_add(unsigned char ebc, ucs4_t c, unsigned char cs, unsigned char gr);
 void ctlr_write(unsigned char buf[], size_t buflen, bool erase);
 int print_eoj(void);
+int print_flush(void);
+bool print_pending(void);
+int print_spool_fd(void);
+void print_spool_run(void);
+void print_drain(void);
 void print_unbind(void);
 enum pds process_ds(unsigned char *buf, size_t buflen);
 enum pds process_scs(unsigned char *buf, size_t buflen);
@@ -66,6 +66,13 @@
  *		pass through SCS FF orders
  *          -ffskip
  *		skip FF at top of page
+ *          -flushtimeout n
+ *              hold printer output until idle for n milliseconds
+ *              (0 flushes after every print unit)
+ *          -lufile file
+ *              run one printer session per line of file, each line
+ *              holding [lu[,lu...]@]host[:port] and an optional print
+ *              command (POSIX only)
  *          -keyfile file
  *          -keyfiletype type
  *          -keypasswd type:text
@@ -88,6 +95,9 @@
  *	        allow self-signed host certificates
  *	    -skipcc
  *	    	skip ASA carriage control characters in host output
+ *          -spoollimit n
+ *              queue up to n KiB of output for a slow print command
+ *              (POSIX only)
  *          -syncport port
  *              TCP port for login session synchronization
  *	    -trace
@@ -112,9 +122,11 @@
 #include <stdarg.h>
 #include <errno.h>
 #include <string.h>
+#include <ctype.h>
 #if !defined(_WIN32) /*[*/
 # include <syslog.h>
 # include <netdb.h>
+# include <sys/wait.h>
 #endif /*]*/
 #include <sys/types.h>
 #if !defined(_MSC_VER) /*[*/
@@ -146,6 +158,7 @@
 #include "resources.h"
 #include "sio.h"
 #include "split_host.h"
+#include "startup.h"
 #include "telnet_core.h"
 #include "unicodec.h"
 #include "utf8.h"
@@ -193,6 +206,11 @@ usage(void)
     fprintf(stderr,
 	    "usage: %s [options] [lu[,lu...]@]host[:port]\n",
 	    programname);
+#if !defined(_WIN32) /*[*/
+    fprintf(stderr,
+	    "       %s [options] -lufile <file>\n",
+	    programname);
+#endif /*]*/
     fprintf(stderr, "Use " OptHelp1 " for the list of options\n");
     pr3287_exit(1);
 }
@@ -264,7 +282,11 @@ cmdline_help(void)
 "                   time out end of print job\n"
 "  -ffeoj           assume FF at the end of each print job\n"
 "  -ffthru          pass through SCS FF orders\n"
-"  -ffskip          skip FF orders at top of page\n");
+"  -ffskip          skip FF orders at top of page\n"
+"  -flushtimeout <milliseconds>\n"
+"                   hold printer output until idle this long (default %d,\n"
+"                   0 to flush after every print unit)\n",
+	    DEFAULT_FLUSH_TIMEOUT);
     if (tls_options & TLS_OPT_KEY_FILE) {
 	fprintf(stderr,
 "  " OptKeyFile " <file>  find certificate private key in <file>\n");
@@ -281,6 +303,9 @@ cmdline_help(void)
     }
     fprintf(stderr,
 "  -ignoreeoj       ignore PRINT-EOJ commands\n"
+#if !defined(_WIN32) /*[*/
+"  -lufile <file>   run a session for each '<host> [<cmd>]' line in <file>\n"
+#endif /*]*/
 "  -mpp <n>         define the Maximum Presentation Position (unformatted\n"
 "                   line length)\n");
     if (tls_options & TLS_OPT_VERIFY_HOST_CERT) {
@@ -301,6 +326,11 @@ cmdline_help(void)
     fprintf(stderr,
 "  -skipcc          skip ASA carriage control characters in unformatted host\n"
 "                   output\n"
+#if !defined(_WIN32) /*[*/
+"  -spoollimit <KiB>\n"
+"                   queue up to <KiB> of output while the print command\n"
+"                   catches up (default 0, write synchronously)\n"
+#endif /*]*/
 "  -syncport port   TCP port for login session synchronization\n"
 #if defined(_WIN32) /*[*/
 "  " OptTrace "           trace data stream to <wc3270appData>/x3trc.<pid>.txt\n"
@@ -372,7 +402,12 @@ xs_warning(const char *fmt, ...)
     errmsg("%s", b);
 }
 
-/* Memory allocation. */
+/* Memory allocation. pr3287 does not do allocation accounting. */
+#undef Malloc
+#undef Calloc
+#undef Realloc
+#undef NewString
+
 void *
 Malloc(size_t len)
 {
@@ -422,6 +457,30 @@ NewString(const char *s)
     return strcpy(p, s);
 }
 
+void *
+Malloc_at(size_t len, const char *file _is_unused)
+{
+    return Malloc(len);
+}
+
+void *
+Calloc_at(size_t nelem, size_t elem_size, const char *file _is_unused)
+{
+    return Calloc(nelem, elem_size);
+}
+
+void *
+Realloc_at(void *p, size_t len, const char *file _is_unused)
+{
+    return Realloc(p, len);
+}
+
+char *
+NewString_at(const char *s, const char *file _is_unused)
+{
+    return NewString(s);
+}
+
 void
 Error(const char *msg)
 {
@@ -436,6 +495,7 @@ fatal_signal(int sig)
     /* Flush any pending data and exit. */
     vtrace("Fatal signal %d\n", sig);
     print_eoj();
+    print_drain();
     errmsg("Exiting on signal %d", sig);
     exit(0);
 }
@@ -451,6 +511,229 @@ flush_signal(int sig)
 }
 #endif /*]*/
 
+#if !defined(_WIN32) /*[*/
+/* -lufile sessions. */
+typedef struct {
+    char *host;			/* host specification */
+    char *command;		/* print command, or NULL */
+    pid_t pid;			/* child process, or -1 */
+    time_t restart;		/* when to start it, or 0 for never */
+    unsigned starts;		/* number of times started */
+} lu_session_t;
+static lu_session_t *lu_sessions = NULL;
+static int lu_count = 0;
+static volatile sig_atomic_t lu_status_requested = 0;
+static volatile sig_atomic_t lu_stop = 0;
+
+/* Read the -lufile. */
+static void
+lufile_read(const char *filename)
+{
+    FILE *f;
+    char buf[1024];
+    int line = 0;
+
+    if ((f = fopen(filename, "r")) == NULL) {
+	perror(filename);
+	pr3287_exit(1);
+    }
+    while (fgets(buf, sizeof(buf), f) != NULL) {
+	char *s = buf;
+	char *host;
+	size_t sl;
+
+	line++;
+	sl = strlen(s);
+	while (sl && isspace((unsigned char)s[sl - 1])) {
+	    s[--sl] = '\0';
+	}
+	while (isspace((unsigned char)*s)) {
+	    s++;
+	}
+	if (!*s || *s == '#') {
+	    continue;
+	}
+	host = s;
+	while (*s && !isspace((unsigned char)*s)) {
+	    s++;
+	}
+	if (*s) {
+	    *s++ = '\0';
+	    while (isspace((unsigned char)*s)) {
+		s++;
+	    }
+	}
+	lu_sessions = Realloc(lu_sessions,
+		(lu_count + 1) * sizeof(lu_session_t));
+	lu_sessions[lu_count].host = NewString(host);
+	lu_sessions[lu_count].command = *s? NewString(s): NULL;
+	lu_sessions[lu_count].pid = -1;
+	lu_sessions[lu_count].restart = 1;
+	lu_sessions[lu_count].starts = 0;
+	lu_count++;
+    }
+    fclose(f);
+    if (!lu_count) {
+	fprintf(stderr, "%s: no sessions defined\n", filename);
+	pr3287_exit(1);
+    }
+}
+
+/* Signal handler for the -lufile supervisor. */
+static void
+lufile_signal(int sig)
+{
+    if (sig == SIGUSR1) {
+	lu_status_requested = 1;
+    } else {
+	lu_stop = sig;
+    }
+}
+
+/* Report the state of each -lufile session. */
+static void
+lufile_status(void)
+{
+    int i;
+
+    for (i = 0; i < lu_count; i++) {
+	lu_session_t *l = &lu_sessions[i];
+
+	if (l->pid > 0) {
+	    errmsg("%s: running, pid %d, started %u time%s", l->host,
+		    (int)l->pid, l->starts, (l->starts == 1)? "": "s");
+	} else if (l->restart) {
+	    errmsg("%s: waiting to restart", l->host);
+	} else {
+	    errmsg("%s: stopped", l->host);
+	}
+    }
+}
+
+/*
+ * Run the -lufile supervisor.
+ *
+ * Starts a child process for each session in the file, restarting them as
+ * they exit if -reconnect is in effect. Returns only in a child process,
+ * with that child's host specification. The parent exits when all of the
+ * sessions have finished, or when it is killed.
+ */
+static char *
+lufile_run(const char *filename)
+{
+    int i;
+    bool stopping = false;
+
+    lufile_read(filename);
+
+    if (options.bdaemon == WILL_DAEMON) {
+	switch (fork()) {
+	case -1:
+	    perror("fork");
+	    exit(1);
+	    break;
+	case 0:
+	    if (setsid() < 0) {
+		exit(1);
+	    }
+	    options.bdaemon = AM_DAEMON;
+	    break;
+	default:
+	    exit(0);
+	    break;
+	}
+    }
+
+    signal(SIGTERM, lufile_signal);
+    signal(SIGINT, lufile_signal);
+    signal(SIGHUP, lufile_signal);
+    signal(SIGUSR1, lufile_signal);
+
+    for (;;) {
+	time_t now = time(NULL);
+	bool any = false;
+	pid_t pid;
+	int status;
+
+	/* Start or restart sessions. */
+	for (i = 0; i < lu_count && !lu_stop; i++) {
+	    lu_session_t *l = &lu_sessions[i];
+
+	    if (l->pid > 0 || !l->restart || l->restart > now) {
+		continue;
+	    }
+	    switch ((pid = fork())) {
+	    case -1:
+		errmsg("fork: %s", strerror(errno));
+		l->restart = now + 5;
+		break;
+	    case 0:
+		signal(SIGTERM, SIG_DFL);
+		signal(SIGINT, SIG_DFL);
+		signal(SIGHUP, SIG_DFL);
+		signal(SIGUSR1, SIG_DFL);
+		if (l->command != NULL) {
+		    options.command = l->command;
+		}
+		return l->host;
+	    default:
+		l->pid = pid;
+		l->starts++;
+		break;
+	    }
+	}
+
+	/* Collect exited sessions. */
+	while ((pid = waitpid(-1, &status, WNOHANG)) > 0) {
+	    for (i = 0; i < lu_count; i++) {
+		lu_session_t *l = &lu_sessions[i];
+
+		if (l->pid != pid) {
+		    continue;
+		}
+		l->pid = -1;
+		if (WIFSIGNALED(status)) {
+		    errmsg("%s: terminated by signal %d", l->host,
+			    WTERMSIG(status));
+		} else if (WEXITSTATUS(status)) {
+		    errmsg("%s: exited with status %d", l->host,
+			    WEXITSTATUS(status));
+		}
+		l->restart = options.reconnect? time(NULL) + 5: 0;
+		break;
+	    }
+	}
+
+	if (lu_status_requested) {
+	    lu_status_requested = 0;
+	    lufile_status();
+	    for (i = 0; i < lu_count; i++) {
+		if (lu_sessions[i].pid > 0) {
+		    kill(lu_sessions[i].pid, SIGUSR1);
+		}
+	    }
+	}
+
+	/* Pass on a fatal signal, and exit when everything is done. */
+	for (i = 0; i < lu_count; i++) {
+	    if (lu_sessions[i].pid > 0) {
+		if (lu_stop && !stopping) {
+		    kill(lu_sessions[i].pid, lu_stop);
+		}
+		any = true;
+	    } else if (!lu_stop && lu_sessions[i].restart) {
+		any = true;
+	    }
+	}
+	if (!any) {
+	    exit(0);
+	}
+	stopping = (lu_stop != 0);
+	sleep(1);
+    }
+}
+#endif /*]*/
+
 void
 pr3287_exit(int status)
 {
@@ -502,6 +785,11 @@ init_options(void)
     options.ffeoj		= 0;
     options.ffthru		= 0;
     options.ffskip		= 0;
+    options.flush_timeout	= DEFAULT_FLUSH_TIMEOUT;
+#if !defined(_WIN32) /*[*/
+    options.spool_limit		= 0;
+    options.lufile		= NULL;
+#endif /*]*/
     options.ignoreeoj		= 0;
 #if defined(_WIN32) /*[*/
     if ((options.printer = getenv("PRINTER")) == NULL) {
@@ -541,6 +829,7 @@ int
 main(int argc, char *argv[])
 {
     int i;
+    char *hostspec;
     char *lu = NULL;
     char *host = NULL;
     char *port = "23";
@@ -562,6 +851,8 @@ main(int argc, char *argv[])
     int report_success = 0;
     unsigned tls_options = sio_all_options_supported();
 
+    startup_init("pr3287");
+
     /* Learn our name. */
 #if defined(_WIN32) /*[*/
     if ((programname = strrchr(argv[0], '\\')) != NULL)
@@ -730,6 +1021,29 @@ main(int argc, char *argv[])
 	    }
 	    options.eoj_timeout = strtoul(argv[i + 1], NULL, 0);
 	    i++;
+	} else if (!strcmp(argv[i], "-flushtimeout")) {
+	    if (argc <= i + 1 || !argv[i + 1][0]) {
+		fprintf(stderr, "Missing value for -flushtimeout\n");
+		usage();
+	    }
+	    options.flush_timeout = strtoul(argv[i + 1], NULL, 0);
+	    i++;
+#if !defined(_WIN32) /*[*/
+	} else if (!strcmp(argv[i], "-spoollimit")) {
+	    if (argc <= i + 1 || !argv[i + 1][0]) {
+		fprintf(stderr, "Missing value for -spoollimit\n");
+		usage();
+	    }
+	    options.spool_limit = (size_t)strtoul(argv[i + 1], NULL, 0) * 1024;
+	    i++;
+	} else if (!strcmp(argv[i], "-lufile")) {
+	    if (argc <= i + 1 || !argv[i + 1][0]) {
+		fprintf(stderr, "Missing value for -lufile\n");
+		usage();
+	    }
+	    options.lufile = argv[i + 1];
+	    i++;
+#endif /*]*/
 	} else if (!strcmp(argv[i], "-ignoreeoj")) {
 	    options.ignoreeoj = 1;
 	} else if (!strcmp(argv[i], "-ffeoj")) {
@@ -843,15 +1157,28 @@ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.\n", cyear);
 	    usage();
 	}
     }
-    if (argc != i + 1) {
-	usage();
+#if !defined(_WIN32) /*[*/
+    if (options.lufile != NULL) {
+	if (argc != i) {
+	    usage();
+	}
+
+	/* Returns only in a child process, with that session's host. */
+	hostspec = lufile_run(options.lufile);
+    } else
+#endif /*]*/
+    {
+	if (argc != i + 1) {
+	    usage();
+	}
+	hostspec = argv[i];
     }
 
     /*
      * Pick apart the hostname, LUs and port.
      * We allow "L:" and "<luname>@" in either order.
      */
-    if (!new_split_host(argv[i],  &lu, &host, &port, &accept, &prefixes,
+    if (!new_split_host(hostspec,  &lu, &host, &port, &accept, &prefixes,
 		&error)) {
 	fprintf(stderr, "%s\n", error);
 	pr3287_exit(1);
@@ -882,6 +1209,7 @@ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.\n", cyear);
 	fprintf(stderr, "Secure connections not supported.\n");
 	pr3287_exit(1);
     }
+    startup_mark(STARTUP_RESOURCES);
 
 #if defined(_WIN32) /*[*/
     /* Set the printer code page. */
@@ -894,6 +1222,7 @@ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.\n", cyear);
     if (codepage_init(options.codepage) != CS_OKAY) {
 	pr3287_exit(1);
     }
+    startup_mark(STARTUP_CODEPAGE);
 
     /* Set up the custom translation table. */
     if (xtable != NULL && xtable_init(xtable) < 0) {
@@ -1003,7 +1332,7 @@ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.\n", cyear);
 
 #if !defined(_WIN32) /*[*/
     /* Become a daemon. */
-    if (options.bdaemon != NOT_DAEMON) {
+    if (options.bdaemon == WILL_DAEMON) {
 	switch (fork()) {
 	case -1:
 	    perror("fork");
@@ -1071,6 +1400,8 @@ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.\n", cyear);
     for (;;) {
 	char *errtxt;
 
+	startup_mark(STARTUP_LOOP);
+
 	/* Resolve the host name. */
 	if (proxy_type > 0) {
 	    unsigned long lport;
@@ -1119,6 +1450,7 @@ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.\n", cyear);
 	    rc = 1;
 	    goto retry;
 	}
+	startup_mark(STARTUP_CONNECT);
 
 	if (proxy_type > 0) {
 	    /* Connect to the host through the proxy. */
@@ -1166,6 +1498,7 @@ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.\n", cyear);
 	    rc = 1;
 	    goto retry;
 	}
+	startup_mark(STARTUP_NEGOTIATED);
 
 	/* Report sudden success. */
 	if (report_success) {
@@ -1188,6 +1521,7 @@ MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.\n", cyear);
     retry:
 	/* Flush any pending data. */
 	print_eoj();
+	print_drain();
 
 	/* Close the socket. */
 	if (s != INVALID_SOCKET) {
@@ -52,6 +52,11 @@ typedef struct {
 	int ffeoj;		/* -ffeoj */
 	int ffthru;		/* -ffthru */
 	int ffskip;		/* -ffskip */
+	unsigned long flush_timeout; /* -flushtimeout */
+#if !defined(_WIN32) /*[*/
+	size_t spool_limit;	/* -spoollimit */
+	const char *lufile;	/* -lufile */
+#endif /*]*/
 	int ignoreeoj;		/* -ignoreeoj */
 #if defined(_WIN32) /*[*/
 	const char *printer;	/* printer to use (-printer) */
@@ -83,3 +88,4 @@ extern void pr3287_exit(int exit_code);
 #define MIN_UNF_MPP	40	/* minimum value for unformatted MPP */
 #define MAX_UNF_MPP	256	/* maximum value for unformatted MPP */
 #define DEFAULT_UNF_MPP	132	/* default value for unformatted MPP */
+#define DEFAULT_FLUSH_TIMEOUT 1000 /* default -flushtimeout, in ms */
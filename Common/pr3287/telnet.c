@@ -79,6 +79,7 @@
 #include "sio.h"
 #include "varbuf.h"	/* needed for sioc.h */
 #include "sioc.h"
+#include "startup.h"
 #include "trace.h"
 #include "pr_telnet.h"
 
@@ -399,10 +400,19 @@ pr_net_process(socket_t s)
 	fd_set rfds;
 	struct timeval t;
 	struct timeval *tp;
+	fd_set wfds;
 	int nr;
 	int maxfd = (int)s;
+	int pfd = print_spool_fd();
 
 	FD_ZERO(&rfds);
+	FD_ZERO(&wfds);
+	if (pfd >= 0) {
+	    FD_SET(pfd, &wfds);
+	    if (pfd > maxfd) {
+		maxfd = pfd;
+	    }
+	}
 	FD_SET(s, &rfds);
 	if (options.eoj_timeout) {
 	    t.tv_sec = options.eoj_timeout;
@@ -411,14 +421,25 @@ pr_net_process(socket_t s)
 	} else {
 	    tp = NULL;
 	}
+	if (print_pending() && (tp == NULL ||
+		    (unsigned long)t.tv_sec * 1000 > options.flush_timeout)) {
+	    t.tv_sec = options.flush_timeout / 1000;
+	    t.tv_usec = (options.flush_timeout % 1000) * 1000;
+	    tp = &t;
+	}
 	if (syncsock != INVALID_SOCKET) {
-	    if (syncsock > s) {
+	    if ((int)syncsock > maxfd) {
 		maxfd = (int)syncsock;
 	    }
 	    FD_SET(syncsock, &rfds);
 	}
-	nr = select(maxfd + 1, &rfds, NULL, NULL, tp);
-	if (nr == 0 && options.eoj_timeout) {
+	nr = select(maxfd + 1, &rfds, &wfds, NULL, tp);
+	if (nr > 0 && pfd >= 0 && FD_ISSET(pfd, &wfds)) {
+	    print_spool_run();
+	}
+	if (nr == 0 && print_pending()) {
+	    print_flush();
+	} else if (nr == 0 && options.eoj_timeout) {
 	    print_eoj();
 	}
 	if (nr > 0 && FD_ISSET(s, &rfds)) {
@@ -1192,6 +1213,7 @@ process_eor(void)
 	    } else {
 		rv = process_scs(ibuf + EH_SIZE, (ibptr - ibuf) - EH_SIZE);
 	    }
+	    startup_mark(STARTUP_HOST_WRITE);
 	    if (rv < 0 && response_required != TN3270E_RSF_NO_RESPONSE) {
 		tn3270e_nak(rv);
 	    } else if (rv == PDS_OKAY_NO_OUTPUT &&
@@ -1260,6 +1282,7 @@ process_eor(void)
     } else {
 	/* Plain old 3270 mode. */
 	rv = process_ds(ibuf, ibptr - ibuf);
+	startup_mark(STARTUP_HOST_WRITE);
 	if (rv < 0) {
 	    tn3270_nak(rv);
 	} else {
@@ -55,6 +55,12 @@ static size_t tscnt = 0;
 /* Globals */
 FILE *tracef = NULL;
 
+/*
+ * Referenced by the trace macros in the emulator's trace.h, which the shared
+ * library code is compiled with. This trace.c does its own checking.
+ */
+unsigned trace_categories = ~0U;
+
 static char *tdsbuf = NULL;
 #define TDS_LEN	75
 
@@ -49,6 +49,7 @@
 #include "lazya.h"
 #include "popups.h"
 #include "pr3287_session.h"
+#include "telnet.h"
 #include "telnet_core.h"
 #include "sio.h"
 #include "toggles.h"
@@ -550,7 +551,11 @@ pr3287_start_now(const char *lu, bool associated)
 		s += 2;
 		continue;
 	    } else if (!strncmp(s+1, "H%", 2)) {
-		vb_appends(&r, qualified_host);
+		/*
+		 * Pass the address the session is already connected to,
+		 * so pr3287 does not look the name up again.
+		 */
+		vb_appends(&r, host_qualified_at(net_peer_address()));
 		s += 2;
 		continue;
 #if !defined(_WIN32) /*[*/
@@ -33,6 +33,7 @@
 #include "globals.h"
 
 #if !defined(_WIN32) /*[*/
+#include <errno.h>
 #include <sys/ioctl.h>
 #include <netinet/in.h>
 #include <netdb.h>
@@ -49,7 +50,9 @@
 #include "proxy_telnet.h"
 #include "proxy_socks4.h"
 #include "proxy_socks5.h"
+#include "resolver.h"
 #include "task.h"
+#include "telnet_core.h"
 #include "trace.h"
 #include "utils.h"
 #include "w3misc.h"
@@ -109,6 +112,7 @@ static close_t *closes[PT_MAX] = {
 static proxytype_t proxy_type = PT_NONE;
 static bool proxy_pending = false;
 static ioid_t proxy_timeout_id = NULL_IOID;
+static bool proxy_local_dns = false;
 
 /* Return the name for a given proxy type. */
 const char *
@@ -148,6 +152,17 @@ proxy_default_port(proxytype_t type)
     }
 }
 
+/*
+ * Choose where a SOCKS5 proxy's target host names are resolved. By default
+ * the name is sent to the proxy, so a slow or incomplete local DNS does not
+ * hold up the connection.
+ */
+void
+proxy_set_local_dns(bool local)
+{
+    proxy_local_dns = local;
+}
+
 /*
  * Resolve the type, hostname and port for a proxy.
  * Returns -1 for failure, 0 for no proxy, >0 (the proxy type) for success.
@@ -336,6 +351,46 @@ parse_host_port(char *s, char **puser, char **phost, char **pport)
     return true;
 }
 
+/*
+ * Read more of a proxy reply into buf, which already holds *nread bytes,
+ * until it holds 'want' bytes. Each recv() asks for everything that is still
+ * missing, but never for more, so anything the server sends after the reply
+ * stays in the socket for the telnet layer.
+ * Returns PX_SUCCESS when the reply is complete, PX_WANTMORE if the socket
+ * would block first, and PX_FAILURE for an error or EOF.
+ */
+proxy_negotiate_ret_t
+proxy_recv(const char *name, socket_t fd, unsigned char *buf, size_t *nread,
+	size_t want)
+{
+    while (*nread < want) {
+	ssize_t nr = recv(fd, (char *)buf + *nread, (int)(want - *nread), 0);
+
+	if (nr < 0) {
+	    if (socket_errno() == SE_EWOULDBLOCK) {
+		if (*nread) {
+		    trace_netdata('<', buf, *nread);
+		}
+		return PX_WANTMORE;
+	    }
+	    popup_a_sockerr("%s Proxy: receive error", name);
+	    if (*nread) {
+		trace_netdata('<', buf, *nread);
+	    }
+	    return PX_FAILURE;
+	}
+	if (nr == 0) {
+	    if (*nread) {
+		trace_netdata('<', buf, *nread);
+	    }
+	    popup_an_error("%s Proxy: unexpected EOF", name);
+	    return PX_FAILURE;
+	}
+	*nread += nr;
+    }
+    return PX_SUCCESS;
+}
+
 /*
  * Proxy negotiation timed out.
  */
@@ -380,7 +435,8 @@ proxy_negotiate(socket_t fd, const char *user, const char *host,
 	ret = proxy_socks4(fd, user, host, port, true);
 	break;
     case PT_SOCKS5:
-	ret = proxy_socks5(fd, user, host, port, false);
+	ret = proxy_socks5(fd, user, host, port,
+		!proxy_local_dns && !numeric_host(host));
 	break;
     case PT_SOCKS5D:
 	ret = proxy_socks5(fd, user, host, port, true);
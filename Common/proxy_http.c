@@ -133,49 +133,58 @@ proxy_http(socket_t fd, const char *user, const char *host, unsigned short port)
     return PX_WANTMORE;
 }
 
+/*
+ * Returns the length of the reply in buf, through the empty line that ends
+ * the headers, or 0 if the reply is not complete yet.
+ */
+static size_t
+reply_end(const unsigned char *buf, size_t len)
+{
+    const unsigned char *nl = buf;
+
+    while ((nl = memchr(nl, '\n', len - (nl - buf))) != NULL) {
+	nl++;
+	if ((size_t)(nl - buf) < len && *nl == '\n') {
+	    return nl - buf + 1;
+	}
+	if ((size_t)(nl - buf) + 1 < len && nl[0] == '\r' && nl[1] == '\n') {
+	    return nl - buf + 2;
+	}
+    }
+    return 0;
+}
+
 /* HTTP proxy continuation. */
 proxy_negotiate_ret_t
 proxy_http_continue(void)
 {
     char *space;
-    bool nl = false;
 
     /*
      * Process the reply.
-     * Read a byte at a time until two \n or EOF.
+     * Look at whatever has arrived without consuming it, then read exactly
+     * as much as belongs to the reply, through the empty line that ends
+     * it. Anything after that stays in the socket for the telnet layer.
      */
     for (;;) {
-	ssize_t nr = recv(ps.fd, (char *)&ps.rbuf[ps.nread], 1, 0);
-	if (nr < 0) {
-	    if (socket_errno() == SE_EWOULDBLOCK) {
-		if (ps.nread) {
-		    trace_netdata('<', ps.rbuf, ps.nread);
-		}
-		return PX_WANTMORE;
-	    }
-	    popup_a_sockerr("HTTP Proxy: receive error");
-	    if (ps.nread) {
-		trace_netdata('<', ps.rbuf, ps.nread);
-	    }
-	    return PX_FAILURE;
+	proxy_negotiate_ret_t ret;
+	size_t end;
+	ssize_t np = recv(ps.fd, (char *)&ps.rbuf[ps.nread],
+		(int)(RBUF - 1 - ps.nread), MSG_PEEK);
+
+	if (np <= 0) {
+	    /* Let proxy_recv() sort out an error, EOF or blocking. */
+	    end = ps.nread + 1;
+	} else if ((end = reply_end(ps.rbuf, ps.nread + np)) == 0) {
+	    end = ps.nread + np;
 	}
-	if (nr == 0) {
-	    if (ps.nread) {
-		trace_netdata('<', ps.rbuf, ps.nread);
-	    }
-	    popup_an_error("HTTP Proxy: unexpected EOF");
-	    return PX_FAILURE;
+	ret = proxy_recv("HTTP", ps.fd, ps.rbuf, &ps.nread, end);
+	if (ret != PX_SUCCESS) {
+	    return ret;
 	}
-	if (++ps.nread >= RBUF) {
-	    ps.nread = RBUF - 1;
+	if (reply_end(ps.rbuf, ps.nread) != 0 || ps.nread >= RBUF - 1) {
 	    break;
 	}
-	if (ps.nread && ps.rbuf[ps.nread - 1] == '\n') {
-	    if (nl) {
-		break;
-	    }
-	    nl = true;
-	}
     }
 
     trace_netdata('<', ps.rbuf, ps.nread);
@@ -160,34 +160,12 @@ proxy_socks4(socket_t fd, const char *user, const char *host,
 proxy_negotiate_ret_t
 proxy_socks4_continue(void)
 {
-    /*
-     * Process the reply.
-     * Read the response.
-     */
-    for (;;) {
-	ssize_t nr = recv(ps.fd, (char *)&ps.rbuf[ps.nread], 1, 0);
-
-	if (nr < 0) {
-	    if (socket_errno() == SE_EWOULDBLOCK) {
-		if (ps.nread) {
-		    trace_netdata('<', ps.rbuf, ps.nread);
-		}
-		return PX_WANTMORE;
-	    }
-	    popup_a_sockerr("SOCKS4 Proxy: receive error");
-	    return PX_FAILURE;
-	}
-	if (nr == 0) {
-	    if (ps.nread) {
-		trace_netdata('<', ps.rbuf, ps.nread);
-	    }
-	    popup_an_error("SOCKS4 Proxy: unexpected EOF");
-	    return PX_FAILURE;
-	    /* XXX: was break */
-	}
-	if (++ps.nread >= REPLY_LEN) {
-	    break;
-	}
+    proxy_negotiate_ret_t ret;
+
+    /* Read the fixed-length reply. */
+    ret = proxy_recv("SOCKS4", ps.fd, ps.rbuf, &ps.nread, REPLY_LEN);
+    if (ret != PX_SUCCESS) {
+	return ret;
     }
 
     trace_netdata('<', ps.rbuf, ps.nread);
@@ -54,6 +54,7 @@
 
 /* Pending proxy state. */
 #define REPLY_LEN	2
+#define CONNECT_REPLY_MAX	(5 + 255 + 2)
 enum phase {
     PROCESS_AUTH_REPLY,
     PROCESS_CRED_REPLY,
@@ -67,9 +68,8 @@ struct {
     size_t nread;
     char *host;
     char *user;
-    int n2read;
     enum phase phase;
-    unsigned char *vrbuf;
+    unsigned char vrbuf[CONNECT_REPLY_MAX];
     union {
 	struct sockaddr sa;
 	struct sockaddr_in sin;
@@ -153,36 +153,12 @@ proxy_socks5(socket_t fd, const char *user, const char *host,
 static proxy_negotiate_ret_t
 proxy_socks5_process_auth_reply(void)
 {
-    /*
-     * Wait for the server reply.
-     * Read 2 bytes of response.
-     */
-    for (;;) {
-	ssize_t nr = recv(ps.fd, (char *)&ps.rbuf[ps.nread], 1, 0);
-
-	if (nr < 0) {
-	    if (socket_errno() == SE_EWOULDBLOCK) {
-		if (ps.nread) {
-		    trace_netdata('<', ps.rbuf, ps.nread);
-		}
-		return PX_WANTMORE;
-	    }
-	    popup_a_sockerr("SOCKS5 Proxy: receive error");
-	    if (ps.nread) {
-		trace_netdata('<', ps.rbuf, ps.nread);
-	    }
-	    return PX_FAILURE;
-	}
-	if (nr == 0) {
-	    popup_an_error("SOCKS5 Proxy: unexpected EOF");
-	    if (ps.nread) {
-		trace_netdata('<', ps.rbuf, ps.nread);
-	    }
-	    return PX_FAILURE;
-	}
-	if (++ps.nread >= REPLY_LEN) {
-	    break;
-	}
+    proxy_negotiate_ret_t ret;
+
+    /* Wait for the 2-byte server reply. */
+    ret = proxy_recv("SOCKS5", ps.fd, ps.rbuf, &ps.nread, REPLY_LEN);
+    if (ret != PX_SUCCESS) {
+	return ret;
     }
 
     trace_netdata('<', ps.rbuf, ps.nread);
@@ -255,33 +231,12 @@ proxy_socks5_process_auth_reply(void)
 static proxy_negotiate_ret_t
 proxy_socks5_process_cred_reply(void)
 {
-    /* Read the response. */
-    for (;;) {
-	ssize_t nr = recv(ps.fd, (char *)&ps.rbuf[ps.nread], 1, 0);
-
-	if (nr < 0) {
-	    if (socket_errno() == SE_EWOULDBLOCK) {
-		if (ps.nread) {
-		    trace_netdata('<', ps.rbuf, ps.nread);
-		}
-		return PX_WANTMORE;
-	    }
-	    popup_a_sockerr("SOCKS5 Proxy: receive error");
-	    if (ps.nread) {
-		trace_netdata('<', ps.rbuf, ps.nread);
-	    }
-	    return PX_FAILURE;
-	}
-	if (nr == 0) {
-	    popup_an_error("SOCKS5 Proxy: unexpected EOF");
-	    if (ps.nread) {
-		trace_netdata('<', ps.rbuf, ps.nread);
-	    }
-	    return PX_FAILURE;
-	}
-	if (++ps.nread >= REPLY_LEN) {
-	    break;
-	}
+    proxy_negotiate_ret_t ret;
+
+    /* Read the 2-byte response. */
+    ret = proxy_recv("SOCKS5", ps.fd, ps.rbuf, &ps.nread, REPLY_LEN);
+    if (ret != PX_SUCCESS) {
+	return ret;
     }
 
     trace_netdata('<', ps.rbuf, ps.nread);
@@ -353,12 +308,35 @@ proxy_socks5_send_connect(void)
     return PX_WANTMORE;
 }
 
+/*
+ * Returns the length of the connect reply, as far as it is known from the
+ * bytes read so far, or 0 if the address type is unknown.
+ */
+static size_t
+connect_reply_len(void)
+{
+    if (ps.nread < 4) {
+	return 4;
+    }
+    switch (ps.vrbuf[3]) {
+    case 0x01: /* IPv4 */
+	return 4 + 4 + 2;
+    case 0x03: /* domainname */
+	return (ps.nread < 5)? 5: 5 + ps.vrbuf[4] + 2;
+#if defined(X3270_IPV6) /*[*/
+    case 0x04: /* IPv6 */
+	return 4 + sizeof(struct in6_addr) + 2;
+#endif /*]*/
+    default:
+	return 0;
+    }
+}
+
 /* Process the reply to the connect request. */
 static proxy_negotiate_ret_t
 proxy_socks5_process_connect_reply(void)
 {
     char nbuf[256];
-    bool done = false;
     char *atype_name[] = {
 	"",
 	"IPv4",
@@ -370,115 +348,69 @@ proxy_socks5_process_connect_reply(void)
     unsigned short rport;
 
     /*
-     * Process the reply.
-     * Only the first two bytes of the response are interesting;
-     * skip the rest.
+     * Process the reply. Read the fixed part first, then as much more as the
+     * address type says is there.
      */
-    while (!done) {
-	unsigned char r;
-	ssize_t nr = recv(ps.fd, (char *)&r, 1, 0);
-
-	if (nr < 0) {
-	    if (socket_errno() == SE_EWOULDBLOCK) {
-		if (ps.nread) {
-		    trace_netdata('<', ps.vrbuf, ps.nread);
-		}
-		return PX_WANTMORE;
-	    }
-	    if (ps.nread) {
-		trace_netdata('<', ps.vrbuf, ps.nread);
-	    }
-	    popup_a_sockerr("SOCKS5 Proxy: receive error");
-	    return PX_FAILURE;
+    for (;;) {
+	proxy_negotiate_ret_t ret;
+	size_t want = connect_reply_len();
+
+	ret = proxy_recv("SOCKS5", ps.fd, ps.vrbuf, &ps.nread, want);
+	if (ret == PX_FAILURE) {
+	    return ret;
 	}
-	if (nr == 0) {
-	    if (ps.nread) {
-		trace_netdata('<', ps.vrbuf, ps.nread);
-	    }
-	    popup_an_error("SOCKS5 Proxy: unexpected EOF");
+
+	/* Check what has arrived so far. */
+	if (ps.nread > 0 && ps.vrbuf[0] != 0x05) {
+	    popup_an_error("SOCKS5 Proxy: incorrect reply version 0x%02x",
+		    ps.vrbuf[0]);
+	    trace_netdata('<', ps.vrbuf, ps.nread);
 	    return PX_FAILURE;
 	}
-
-	ps.vrbuf = Realloc(ps.vrbuf, ps.nread + 1);
-	ps.vrbuf[ps.nread] = r;
-
-	switch (ps.nread++) {
-	case 0:
-	    if (r != 0x05) {
-		popup_an_error("SOCKS5 Proxy: incorrect reply version 0x%02x",
-			r);
-		if (ps.nread) {
-		    trace_netdata('<', ps.vrbuf, ps.nread);
-		}
-		return PX_FAILURE;
-	    }
-	    break;
-	case 1:
-	    if (r != 0x00) {
-		trace_netdata('<', ps.vrbuf, ps.nread);
-	    }
-	    switch (r) {
-	    case 0x00:
-		break;
+	if (ps.nread > 1 && ps.vrbuf[1] != 0x00) {
+	    trace_netdata('<', ps.vrbuf, ps.nread);
+	    switch (ps.vrbuf[1]) {
 	    case 0x01:
 		popup_an_error("SOCKS5 Proxy: server failure");
-		return PX_FAILURE;
+		break;
 	    case 0x02:
 		popup_an_error("SOCKS5 Proxy: connection not allowed");
-		return PX_FAILURE;
+		break;
 	    case 0x03:
 		popup_an_error("SOCKS5 Proxy: network unreachable");
-		return PX_FAILURE;
+		break;
 	    case 0x04:
 		popup_an_error("SOCKS5 Proxy: host unreachable");
-		return PX_FAILURE;
+		break;
 	    case 0x05:
 		popup_an_error("SOCKS5 Proxy: connection refused");
-		return PX_FAILURE;
+		break;
 	    case 0x06:
 		popup_an_error("SOCKS5 Proxy: ttl expired");
-		return PX_FAILURE;
+		break;
 	    case 0x07:
 		popup_an_error("SOCKS5 Proxy: command not supported");
-		return PX_FAILURE;
+		break;
 	    case 0x08:
 		popup_an_error("SOCKS5 Proxy: address type not supported");
-		return PX_FAILURE;
-	    default:
-		popup_an_error("SOCKS5 Proxy: unknown server error 0x%02x", r);
-		return PX_FAILURE;
-	    }
-	    break;
-	case 2:
-	    break;
-	case 3:
-	    switch (r) {
-	    case 0x01:
-		ps.n2read = 6;
-		break;
-	    case 0x03:
-		ps.n2read = -1;
-		break;
-#if defined(X3270_IPV6) /*[*/
-	    case 0x04:
-		ps.n2read = sizeof(struct in6_addr) + 2;
 		break;
-#endif /*]*/
 	    default:
-		popup_an_error("SOCKS5 Proxy: unknown server address type "
-			"0x%02x", r);
-		if (ps.nread) {
-		    trace_netdata('<', ps.vrbuf, ps.nread);
-		}
-		return PX_FAILURE;
-	    }
-	    break;
-	default:
-	    if (ps.n2read == -1) {
-		ps.n2read = r + 2;
-	    } else if (!--ps.n2read) {
-		done = true;
+		popup_an_error("SOCKS5 Proxy: unknown server error 0x%02x",
+			ps.vrbuf[1]);
+		break;
 	    }
+	    return PX_FAILURE;
+	}
+	if (ps.nread > 3 && connect_reply_len() == 0) {
+	    popup_an_error("SOCKS5 Proxy: unknown server address type "
+		    "0x%02x", ps.vrbuf[3]);
+	    trace_netdata('<', ps.vrbuf, ps.nread);
+	    return PX_FAILURE;
+	}
+	if (ret == PX_WANTMORE) {
+	    return ret;
+	}
+	if (ps.nread == connect_reply_len()) {
 	    break;
 	}
     }
@@ -491,7 +423,7 @@ proxy_socks5_process_connect_reply(void)
 	portp = &ps.vrbuf[4 + 4];
 	break;
     case 0x03: /* domainname */
-	strncpy(nbuf, (char *)&ps.vrbuf[5], ps.vrbuf[4]);
+	memcpy(nbuf, &ps.vrbuf[5], ps.vrbuf[4]);
 	nbuf[ps.vrbuf[4]] = '\0';
 	portp = &ps.vrbuf[5 + ps.vrbuf[4]];
 	break;
@@ -517,7 +449,6 @@ proxy_socks5_process_connect_reply(void)
 	    nbuf,
 	    rport);
 
-    Replace(ps.vrbuf, NULL);
     return PX_SUCCESS;
 }
 
@@ -535,9 +466,7 @@ proxy_socks5_close(void)
     ps.fd = INVALID_SOCKET;
     ps.port = 0;
     ps.nread = 0;
-    ps.n2read = 0;
     Replace(ps.host, NULL);
     Replace(ps.user, NULL);
-    Replace(ps.vrbuf, NULL);
     ps.phase = 0;
 }
@@ -32,18 +32,22 @@
 
 #include "globals.h"
 
+#include <inttypes.h>
+
 #include "appres.h"
 
 #include "actions.h"
 #include "codepage.h"
 #include "copyright.h"
 #include "ctlrc.h"
+#include "footprint.h"
 #include "host.h"
 #include "lazya.h"
 #include "names.h"
 #include "popups.h"
 #include "query.h"
 #include "split_host.h"
+#include "stats.h"
 #include "telnet.h"
 #include "task.h"
 #include "trace.h"
@@ -155,8 +159,9 @@ get_rx(void)
     }
 
     return IN_3270?
-	lazyaf("records %u bytes %u", ns_rrcvd, ns_brcvd):
-	lazyaf("bytes %u", ns_brcvd);
+	lazyaf("records %" PRIu64 " bytes %" PRIu64, stats[STAT_RECORDS_RX],
+		stats[STAT_BYTES_RX]):
+	lazyaf("bytes %" PRIu64, stats[STAT_BYTES_RX]);
 }
 
 static const char *
@@ -197,8 +202,9 @@ get_tx(void)
     }
 
     return IN_3270?
-	lazyaf("records %u bytes %u", ns_rsent, ns_bsent):
-	lazyaf("bytes %u", ns_bsent);
+	lazyaf("records %" PRIu64 " bytes %" PRIu64, stats[STAT_RECORDS_TX],
+		stats[STAT_BYTES_TX]):
+	lazyaf("bytes %" PRIu64, stats[STAT_BYTES_TX]);
 }
 
 const char *
@@ -306,6 +312,13 @@ register_queries(query_t new_queries[], size_t count)
     num_queries += count;
 }
 
+/* Footprint of the query table. */
+static size_t
+query_footprint(void)
+{
+    return num_queries * sizeof(query_t);
+}
+
 /**
  * Query module registration.
  */
@@ -343,6 +356,7 @@ query_register(void)
 	{ KwSsl, net_query_tls, NULL, true, false },
 	{ KwStatsRx, get_rx, NULL, false, false },
 	{ KwStatsTx, get_tx, NULL, false, false },
+	{ KwTaskUsage, task_get_usage, NULL, false, true },
 	{ KwTasks, get_tasks, NULL, false, true },
 	{ KwTelnetMyOptions, net_myopts, NULL, false, false },
 	{ KwTelnetHostOptions, net_hisopts, NULL, false, false },
@@ -356,10 +370,16 @@ query_register(void)
 	{ KwTn3270eOptions, tn3270e_current_opts, NULL, false, false },
 	{ KwVersion, query_build, NULL, false, false }
     };
+    static footprint_t footprints[] = {
+	{ "queries",		query_footprint,	true }
+    };
 
     /* Register actions.*/
     register_actions(actions, array_count(actions));
 
     /* Register queries. */
     register_queries(base_queries, array_count(base_queries));
+
+    /* Register the table size. */
+    register_footprints(footprints, array_count(footprints));
 }
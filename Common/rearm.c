@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	rearm.c
+ *		Re-armable timers.
+ *
+ * Some timers are pushed back on every keystroke or request: the idle
+ * command timer and the httpd session idle timeout. Doing that with
+ * RemoveTimeOut() and AddTimeOut() allocates and re-sorts the timeout list
+ * each time. A re-armable timer instead keeps its deadline in place. Moving
+ * the deadline later just updates it; when the underlying timeout fires
+ * early, it is re-added for the time that is left. Only moving the
+ * deadline earlier replaces the underlying timeout.
+ *
+ * Cancelling is lazy too, so a cancel followed by a re-arm costs nothing.
+ * rearm_release() removes the underlying timeout, and must be called
+ * before the memory holding the timer is freed.
+ */
+
+#include "globals.h"
+
+#if !defined(_WIN32) /*[*/
+# include <sys/time.h>
+#endif /*]*/
+#include <time.h>
+
+#include "rearm.h"
+#include "utils.h"
+
+/* Timers with a pending timeout. */
+static llist_t pending = LLIST_INIT(pending);
+
+static void rearm_timeout(ioid_t id);
+
+/* Returns the monotonic time in milliseconds. */
+static unsigned long long
+now_ms(void)
+{
+#if defined(_WIN32) /*[*/
+    return GetTickCount64();
+#else /*][*/
+    struct timeval tv;
+# if defined(CLOCK_MONOTONIC) /*[*/
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+	return (ts.tv_sec * 1000ULL) + (ts.tv_nsec / 1000000L);
+    }
+# endif /*]*/
+    gettimeofday(&tv, NULL);
+    return (tv.tv_sec * 1000ULL) + (tv.tv_usec / 1000L);
+#endif /*]*/
+}
+
+/* Start the underlying timeout. */
+static void
+start(rearm_t *r, unsigned long long now, unsigned long msec)
+{
+    r->id = AddTimeOutCoalesced(msec, r->slack_ms, rearm_timeout);
+    r->fires = now + msec;
+    llist_insert_before(&r->link, &pending);
+}
+
+/* Stop the underlying timeout. */
+static void
+stop(rearm_t *r)
+{
+    RemoveTimeOut(r->id);
+    r->id = NULL_IOID;
+    llist_unlink(&r->link);
+}
+
+/* The underlying timeout fired. */
+static void
+rearm_timeout(ioid_t id)
+{
+    rearm_t *r;
+    bool found = false;
+    unsigned long long now;
+
+    FOREACH_LLIST(&pending, r, rearm_t *) {
+	if (r->id == id) {
+	    found = true;
+	    break;
+	}
+    } FOREACH_LLIST_END(&pending, r, rearm_t *);
+    if (!found) {
+	return;
+    }
+    r->id = NULL_IOID;
+    llist_unlink(&r->link);
+
+    if (!r->armed) {
+	return;
+    }
+    now = now_ms();
+    if (r->due > now) {
+	/* Re-armed since the timeout was added. */
+	start(r, now, (unsigned long)(r->due - now));
+	return;
+    }
+    r->armed = false;
+    (*r->fn)(r);
+}
+
+/**
+ * Initialize a re-armable timer.
+ *
+ * @param[out] r	Timer
+ * @param[in] fn	Callback
+ */
+void
+rearm_init(rearm_t *r, rearm_fn_t fn)
+{
+    llist_init(&r->link);
+    r->id = NULL_IOID;
+    r->fires = 0;
+    r->due = 0;
+    r->slack_ms = 0;
+    r->fn = fn;
+    r->armed = false;
+}
+
+/**
+ * Arm or re-arm a timer.
+ *
+ * @param[in,out] r	Timer
+ * @param[in] msec	Milliseconds from now until the callback
+ * @param[in] slack_ms	How late the callback may run, for coalescing
+ */
+void
+rearm_set(rearm_t *r, unsigned long msec, unsigned long slack_ms)
+{
+    unsigned long long now = now_ms();
+
+    r->due = now + msec;
+    r->slack_ms = slack_ms;
+    r->armed = true;
+    if (r->id != NULL_IOID) {
+	if (r->fires <= r->due) {
+	    /* It will fire first and be pushed back then. */
+	    return;
+	}
+	stop(r);
+    }
+    start(r, now, msec);
+}
+
+/**
+ * Cancel a timer. The underlying timeout is left to expire.
+ *
+ * @param[in,out] r	Timer
+ */
+void
+rearm_cancel(rearm_t *r)
+{
+    r->armed = false;
+}
+
+/**
+ * Cancel a timer and remove its underlying timeout, before it is freed.
+ *
+ * @param[in,out] r	Timer
+ */
+void
+rearm_release(rearm_t *r)
+{
+    r->armed = false;
+    if (r->id != NULL_IOID) {
+	stop(r);
+    }
+}
+
+/**
+ * Check a timer.
+ *
+ * @param[in] r		Timer
+ *
+ * @return true if the callback is due to be called.
+ */
+bool
+rearm_pending(const rearm_t *r)
+{
+    return r->armed;
+}
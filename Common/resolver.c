@@ -41,6 +41,7 @@
 #endif /*]*/
 
 #include <stdio.h>
+#include <time.h>
 #include "lazya.h"
 #include "resolver.h"
 #if defined(_WIN32) /*[*/
@@ -54,6 +55,11 @@
 
 #if defined(ASYNC_RESOLVER) /*[*/
 # define GAI_SLOTS	10
+# if !defined(_WIN32) /*[*/
+#  define GAI_SIGNAL	SIGRTMIN	/* completion signal */
+# else /*][*/
+#  define GAI_THREADS	4		/* resolver worker threads */
+# endif /*]*/
 static struct gai {
     bool busy;			/* true if busy */
     bool done;			/* true if done */
@@ -71,8 +77,175 @@ static struct gai {
     HANDLE event;		/* event to signal */
 # endif /*]*/
 } gai[GAI_SLOTS];
+
+# if defined(_WIN32) /*[*/
+/* Resolver worker pool. Requests are queued by slot number. */
+static bool pool_started = false;
+static CRITICAL_SECTION pool_lock;	/* protects the queue */
+static HANDLE pool_work;		/* semaphore, counts queued requests */
+static int pool_queue[GAI_SLOTS];	/* queued slots */
+static int pool_head;			/* next slot to dequeue */
+static int pool_count;			/* number of queued slots */
+# endif /*]*/
 #endif /*]*/
 
+/*
+ * Cache of recent lookups, so reconnects do not repeat the same query.
+ * Failed lookups are cached too, for at most RCACHE_NEG_TTL seconds.
+ */
+#define RCACHE_SIZE	8	/* names cached */
+#define RCACHE_ADDRS	8	/* addresses kept per name */
+#define RCACHE_NEG_TTL	5	/* maximum lifetime of a failed lookup */
+typedef union {
+    struct sockaddr sa;
+    struct sockaddr_in sin;
+#if defined(X3270_IPV6) /*[*/
+    struct sockaddr_in6 sin6;
+#endif /*]*/
+} rcache_addr_t;
+static struct rcache {
+    char *host;			/* host name, NULL if slot is empty */
+    char *port;			/* port name */
+    time_t expiry;		/* when the entry expires */
+    rhp_t rv;			/* RHP_SUCCESS or RHP_CANNOT_RESOLVE */
+    char *errmsg;		/* error message, if failed */
+    unsigned short pport;	/* numeric port */
+    int n;			/* number of addresses */
+    bool partial;		/* there may be more than n addresses */
+    rcache_addr_t addr[RCACHE_ADDRS];
+    socklen_t len[RCACHE_ADDRS];
+} rcache[RCACHE_SIZE];
+static int rcache_ttl = DNS_CACHE_TTL;
+
+/* Set the lifetime of cached lookups. Zero disables the cache. */
+void
+set_resolver_cache_ttl(int seconds)
+{
+    rcache_ttl = seconds;
+}
+
+/* Empty a cache slot. */
+static void
+rcache_clear(struct rcache *r)
+{
+    Replace(r->host, NULL);
+    Replace(r->port, NULL);
+    Replace(r->errmsg, NULL);
+}
+
+/* Find an unexpired cache entry for a host and port. */
+static struct rcache *
+rcache_find(const char *host, const char *portname)
+{
+    time_t now = time(NULL);
+    int i;
+
+    if (rcache_ttl <= 0) {
+	return NULL;
+    }
+    for (i = 0; i < RCACHE_SIZE; i++) {
+	struct rcache *r = &rcache[i];
+
+	if (r->host == NULL) {
+	    continue;
+	}
+	if (now >= r->expiry) {
+	    rcache_clear(r);
+	    continue;
+	}
+	if (!strcmp(r->host, host) &&
+		!strcmp(r->port, portname? portname: "")) {
+	    return r;
+	}
+    }
+    return NULL;
+}
+
+/*
+ * Answer a lookup from the cache.
+ * Returns true, with the result in *rv, if the answer was cached.
+ */
+static bool
+rcache_answer(const char *host, const char *portname, unsigned short *pport,
+	struct sockaddr *sa, size_t sa_len, socklen_t *sa_rlen, char **errmsg,
+	int max, int *nr, rhp_t *rv)
+{
+    struct rcache *r = rcache_find(host, portname);
+    int i;
+
+    if (r == NULL || (r->partial && r->n < max)) {
+	return false;
+    }
+    *nr = 0;
+    *rv = r->rv;
+    if (r->rv != RHP_SUCCESS) {
+	if (errmsg) {
+	    *errmsg = lazya(NewString(r->errmsg));
+	}
+	return true;
+    }
+    for (i = 0; i < r->n && i < max; i++) {
+	memcpy((char *)sa + (i * sa_len), &r->addr[i], r->len[i]);
+	sa_rlen[i] = r->len[i];
+	(*nr)++;
+    }
+    *pport = r->pport;
+    return true;
+}
+
+/* Record the result of a lookup in the cache. */
+static void
+rcache_store(const char *host, const char *portname, rhp_t rv,
+	unsigned short pport, const struct sockaddr *sa, size_t sa_len,
+	const socklen_t *sa_rlen, int nr, int max, const char *errmsg)
+{
+    struct rcache *r = NULL;
+    time_t now = time(NULL);
+    int ttl = rcache_ttl;
+    int i;
+
+    if (ttl <= 0 || (rv != RHP_SUCCESS && rv != RHP_CANNOT_RESOLVE)) {
+	return;
+    }
+    if (rv != RHP_SUCCESS && ttl > RCACHE_NEG_TTL) {
+	ttl = RCACHE_NEG_TTL;
+    }
+
+    /* Replace the same name, else use an empty slot or the oldest one. */
+    if ((r = rcache_find(host, portname)) == NULL) {
+	for (i = 0; i < RCACHE_SIZE; i++) {
+	    if (rcache[i].host == NULL) {
+		r = &rcache[i];
+		break;
+	    }
+	    if (r == NULL || rcache[i].expiry < r->expiry) {
+		r = &rcache[i];
+	    }
+	}
+    }
+    rcache_clear(r);
+
+    r->host = NewString(host);
+    r->port = NewString(portname? portname: "");
+    r->expiry = now + ttl;
+    r->rv = rv;
+    r->pport = pport;
+    r->n = 0;
+    r->partial = nr >= max || nr > RCACHE_ADDRS;
+    if (rv == RHP_SUCCESS) {
+	for (i = 0; i < nr && i < RCACHE_ADDRS; i++) {
+	    if (sa_rlen[i] > sizeof(r->addr[0])) {
+		continue;
+	    }
+	    memcpy(&r->addr[r->n], (const char *)sa + (i * sa_len),
+		    sa_rlen[i]);
+	    r->len[r->n++] = sa_rlen[i];
+	}
+    } else {
+	r->errmsg = NewString(errmsg? errmsg: "Cannot resolve");
+    }
+}
+
 #if defined(X3270_IPV6) /*[*/
 /*
  * Resolve a hostname and port using getaddrinfo, allowing IPv4 or IPv6.
@@ -154,16 +327,27 @@ resolve_host_and_port_v46(const char *host, char *portname,
 #if defined(ASYNC_RESOLVER) /*[*/
 
 # if !defined(_WIN32) /*[*/
-/* Notification function for lookup completion. */
+/*
+ * Signal handler for lookup completion.
+ *
+ * glibc runs the lookups on its own pool of threads. Asking for a signal,
+ * rather than a SIGEV_THREAD notification, avoids starting one more thread
+ * per lookup just to say it is done.
+ */
 static void
-gai_notify(union sigval sigval)
+gai_notify(int signo _is_unused, siginfo_t *info, void *context _is_unused)
 {
-    char slot = (char)sigval.sival_int;
-    struct gai *gaip = &gai[(int)slot];
+    char slot = (char)info->si_value.sival_int;
+    struct gai *gaip;
     ssize_t nw;
 
-    assert(gaip->busy == true);
-    assert(gaip->done == false);
+    if (slot < 0 || slot >= GAI_SLOTS) {
+	return;
+    }
+    gaip = &gai[(int)slot];
+    if (!gaip->busy || gaip->done) {
+	return;
+    }
     gaip->done = true;
 
     /*
@@ -171,42 +355,130 @@ gai_notify(union sigval sigval)
      * the completion status.
      */
     nw = write(gaip->pipe, &slot, 1);
-    assert(nw == 1);
+    (void)nw;
+}
+
+/* Install the completion signal handler. */
+static void
+gai_init(void)
+{
+    static bool initted = false;
+    struct sigaction sa;
+
+    if (initted) {
+	return;
+    }
+    initted = true;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = gai_notify;
+    sa.sa_flags = SA_SIGINFO | SA_RESTART;
+    sigemptyset(&sa.sa_mask);
+    sigaction(GAI_SIGNAL, &sa, NULL);
 }
 
 # else /*][*/
 
-/* Asynchronous resolution thread. */
+/* Resolver worker thread. */
 static DWORD WINAPI
-async_resolve(LPVOID parameter)
+resolver_worker(LPVOID parameter _is_unused)
 {
-    struct gai *gaip = (struct gai *)parameter;
-    char slot = (char)(gaip - gai);
-    struct addrinfo hints;
-    ssize_t nw;
+    for (;;) {
+	struct gai *gaip;
+	char slot;
+	struct addrinfo hints;
+	ssize_t nw;
+
+	/* Wait for a request. */
+	WaitForSingleObject(pool_work, INFINITE);
+	EnterCriticalSection(&pool_lock);
+	slot = (char)pool_queue[pool_head];
+	pool_head = (pool_head + 1) % GAI_SLOTS;
+	pool_count--;
+	LeaveCriticalSection(&pool_lock);
+	gaip = &gai[(int)slot];
+
+	assert(gaip->busy == true);
+	assert(gaip->done == false);
+	memset(&hints, '\0', sizeof(struct addrinfo));
+	hints.ai_flags = 0;
+	hints.ai_family = PF_UNSPEC;
+	hints.ai_socktype = SOCK_STREAM;
+	hints.ai_protocol = IPPROTO_TCP;
+	gaip->rc = getaddrinfo(gaip->host, gaip->port, &hints, &gaip->result);
+	gaip->done = true;
+
+	/*
+	 * Write our slot number into the pipe, so the main thread can poll us
+	 * for the completion status.
+	 */
+	nw = write(gaip->pipe, &slot, 1);
+	assert(nw == 1);
+
+	/* Tell the main thread we are done. */
+	SetEvent(gaip->event);
+    }
+    return 0;
+}
 
-    assert(gaip->busy == true);
-    assert(gaip->done == false);
-    gaip->done = true;
-    memset(&hints, '\0', sizeof(struct addrinfo));
-    hints.ai_flags = 0;
-    hints.ai_family = PF_UNSPEC;
-    hints.ai_socktype = SOCK_STREAM;
-    hints.ai_protocol = IPPROTO_TCP;
-    gaip->rc = getaddrinfo(gaip->host, gaip->port, &hints, &gaip->result);
+/*
+ * Start the resolver worker pool.
+ *
+ * @return true for success, otherwise sets errmsg
+ */
+static bool
+pool_init(char **errmsg)
+{
+    int i;
 
-    /*
-     * Write our slot number into the pipe, so the main thread can poll us for
-     * the completion status.
-     */
-    nw = write(gaip->pipe, &slot, 1);
-    assert(nw == 1);
+    if (pool_started) {
+	return true;
+    }
 
-    /* Tell the main thread we are done. */
-    SetEvent(gaip->event);
+    InitializeCriticalSection(&pool_lock);
+    pool_work = CreateSemaphore(NULL, 0, GAI_SLOTS, NULL);
+    if (pool_work == NULL) {
+	if (errmsg) {
+	    *errmsg = lazyaf("Resolver pool: %s",
+		    win32_strerror(GetLastError()));
+	}
+	DeleteCriticalSection(&pool_lock);
+	return false;
+    }
+    for (i = 0; i < GAI_THREADS; i++) {
+	HANDLE thread = CreateThread(NULL, 0, resolver_worker, NULL, 0, NULL);
 
-    /* Exit the thread. */
-    return 0;
+	if (thread == NULL) {
+	    if (i > 0) {
+		/* Make do with what we have. */
+		break;
+	    }
+	    if (errmsg) {
+		*errmsg = lazyaf("Resolver pool: %s",
+			win32_strerror(GetLastError()));
+	    }
+	    CloseHandle(pool_work);
+	    DeleteCriticalSection(&pool_lock);
+	    return false;
+	}
+	CloseHandle(thread);
+    }
+    pool_started = true;
+    return true;
+}
+
+/*
+ * Queue a request for the worker pool.
+ *
+ * @param[in] slot	Slot to resolve
+ */
+static void
+pool_queue_slot(int slot)
+{
+    EnterCriticalSection(&pool_lock);
+    pool_queue[(pool_head + pool_count) % GAI_SLOTS] = slot;
+    pool_count++;
+    LeaveCriticalSection(&pool_lock);
+    ReleaseSemaphore(pool_work, 1, NULL);
 }
 
 # endif /*]*/
@@ -223,8 +495,6 @@ resolve_host_and_port_v46_a(const char *host, char *portname,
 {
 # if !defined(_WIN32) /*[*/
     int rc;
-# else /*][*/
-    HANDLE thread;
 # endif /*]*/
 
     *nr = 0;
@@ -241,6 +511,29 @@ resolve_host_and_port_v46_a(const char *host, char *portname,
 	}
     }
 
+    /*
+     * Share a lookup for the same name that is already in flight. There is
+     * only one requester per pipe, so the new request takes over the
+     * earlier one, and gets its completion.
+     */
+    for (*slot = 0; *slot < GAI_SLOTS; (*slot)++) {
+	struct gai *gaip = &gai[*slot];
+
+	if (gaip->busy && gaip->pipe == pipe && !strcmp(gaip->host, host) &&
+		((gaip->port == NULL && portname == NULL) ||
+		 (gaip->port != NULL && portname != NULL &&
+		  !strcmp(gaip->port, portname)))) {
+	    return RHP_PENDING;
+	}
+    }
+
+# if defined(_WIN32) /*[*/
+    if (!pool_init(errmsg)) {
+	*slot = -1;
+	return RHP_FATAL;
+    }
+# endif /*]*/
+
     /* Find an empty slot. */
     for (*slot = 0; *slot < GAI_SLOTS; (*slot)++) {
 	if (!gai[*slot].busy) {
@@ -272,16 +565,21 @@ resolve_host_and_port_v46_a(const char *host, char *portname,
     gai[*slot].result.ai_protocol = IPPROTO_TCP;
 
     gai[*slot].gaicbs = &gai[*slot].gaicb;
-    gai[*slot].gaicb.ar_name = host;
-    gai[*slot].gaicb.ar_service = portname;
+    gai[*slot].gaicb.ar_name = gai[*slot].host;
+    gai[*slot].gaicb.ar_service = gai[*slot].port;
     gai[*slot].gaicb.ar_result = &gai[*slot].result;
 
-    gai[*slot].sigevent.sigev_notify = SIGEV_THREAD;
+    gai_init();
+    memset(&gai[*slot].sigevent, 0, sizeof(gai[*slot].sigevent));
+    gai[*slot].sigevent.sigev_notify = SIGEV_SIGNAL;
+    gai[*slot].sigevent.sigev_signo = GAI_SIGNAL;
     gai[*slot].sigevent.sigev_value.sival_int = *slot;
-    gai[*slot].sigevent.sigev_notify_function = gai_notify;
 
     rc = getaddrinfo_a(GAI_NOWAIT, &gai[*slot].gaicbs, 1, &gai[*slot].sigevent);
     if (rc != 0) {
+	gai[*slot].busy = false;
+	Replace(gai[*slot].host, NULL);
+	Replace(gai[*slot].port, NULL);
 	if (errmsg) {
 	    *errmsg = lazyaf("%s/%s:\n%s", host, portname? portname: "(none)",
 		    gai_strerror(rc));
@@ -289,15 +587,7 @@ resolve_host_and_port_v46_a(const char *host, char *portname,
 	return RHP_CANNOT_RESOLVE;
     }
 # else /*][*/
-    thread = CreateThread(NULL, 0, async_resolve, &gai[*slot], 0, NULL);
-    if (thread == INVALID_HANDLE_VALUE) {
-	if (errmsg) {
-	    *errmsg = lazyaf("%s/%s:\n%s", host, portname? portname: "(none)",
-		    win32_strerror(GetLastError()));
-	}
-	return RHP_CANNOT_RESOLVE;
-    }
-    CloseHandle(thread);
+    pool_queue_slot(*slot);
 # endif /*]*/
 
     return RHP_PENDING;
@@ -306,8 +596,8 @@ resolve_host_and_port_v46_a(const char *host, char *portname,
 #endif /*]*/
 
 /* Collect the status for a slot. */
-rhp_t
-collect_host_and_port(int slot, struct sockaddr *sa, size_t sa_len,
+static rhp_t
+collect_host_and_port_slot(int slot, struct sockaddr *sa, size_t sa_len,
 	socklen_t *sa_rlen, unsigned short *pport, char **errmsg, int max,
 	int *nr)
 {
@@ -436,6 +726,28 @@ collect_host_and_port(int slot, struct sockaddr *sa, size_t sa_len,
 #endif /*]*/
 }
 
+/* Collect the status for a slot, and cache the result. */
+rhp_t
+collect_host_and_port(int slot, struct sockaddr *sa, size_t sa_len,
+	socklen_t *sa_rlen, unsigned short *pport, char **errmsg, int max,
+	int *nr)
+{
+    char *local_errmsg = NULL;
+    rhp_t rv;
+
+    rv = collect_host_and_port_slot(slot, sa, sa_len, sa_rlen, pport,
+	    &local_errmsg, max, nr);
+#if defined(ASYNC_RESOLVER) /*[*/
+    rcache_store(gai[slot].host, gai[slot].port, rv,
+	    (rv == RHP_SUCCESS)? *pport: 0, sa, sa_len, sa_rlen, *nr, max,
+	    local_errmsg);
+#endif /*]*/
+    if (errmsg) {
+	*errmsg = local_errmsg;
+    }
+    return rv;
+}
+
 /* Clean up a canceled request. */
 void
 cleanup_host_and_port(int slot)
@@ -567,13 +879,26 @@ resolve_host_and_port(const char *host, char *portname, unsigned short *pport,
 	struct sockaddr *sa, size_t sa_len, socklen_t *sa_rlen, char **errmsg,
 	int max, int *nr)
 {
+    char *local_errmsg = NULL;
+    rhp_t rv;
+
+    if (rcache_answer(host, portname, pport, sa, sa_len, sa_rlen, errmsg,
+		max, nr, &rv)) {
+	return rv;
+    }
 #if defined(X3270_IPV6) /*[*/
-    return resolve_host_and_port_v46(host, portname, pport, sa, sa_len,
-	    sa_rlen, errmsg, max, nr);
+    rv = resolve_host_and_port_v46(host, portname, pport, sa, sa_len,
+	    sa_rlen, &local_errmsg, max, nr);
 #else /*][*/
-    return resolve_host_and_port_v4(host, portname, pport, sa, sa_len,
-	    sa_rlen, errmsg, max, nr);
+    rv = resolve_host_and_port_v4(host, portname, pport, sa, sa_len,
+	    sa_rlen, &local_errmsg, max, nr);
 #endif
+    rcache_store(host, portname, rv, (rv == RHP_SUCCESS)? *pport: 0, sa,
+	    sa_len, sa_rlen, *nr, max, local_errmsg);
+    if (errmsg) {
+	*errmsg = local_errmsg;
+    }
+    return rv;
 }
 
 /*
@@ -598,17 +923,19 @@ resolve_host_and_port_a(const char *host, char *portname, unsigned short *pport,
 	int max, int *nr, int *slot, int pipe, iosrc_t event)
 {
 #if defined(ASYNC_RESOLVER) /*[*/
+    rhp_t rv;
+
+    if (rcache_answer(host, portname, pport, sa, sa_len, sa_rlen, errmsg,
+		max, nr, &rv)) {
+	*slot = -1;
+	return rv;
+    }
     return resolve_host_and_port_v46_a(host, portname, pport, sa, sa_len,
 	    sa_rlen, errmsg, max, nr, slot, pipe, event);
 #else /*][*/
     *slot = -1;
-# if defined(X3270_IPV6)  /*][*/
-    return resolve_host_and_port_v46(host, portname, pport, sa, sa_len,
-	    sa_rlen, errmsg, max, nr);
-# else /*][*/
-    return resolve_host_and_port_v4(host, portname, pport, sa, sa_len,
-	    sa_rlen, errmsg, max, nr);
-# endif /*]*/
+    return resolve_host_and_port(host, portname, pport, sa, sa_len, sa_rlen,
+	    errmsg, max, nr);
 #endif /*]*/
 }
 
@@ -648,3 +975,28 @@ numeric_host_and_port(const struct sockaddr *sa, socklen_t salen, char *host,
     return true;
 #endif /*]*/
 }
+
+/*
+ * Check a hostname for being a numeric (IPv4 or IPv6) address, which can be
+ * converted without consulting DNS.
+ */
+bool
+numeric_host(const char *host)
+{
+#if defined(X3270_IPV6) /*[*/
+    struct addrinfo hints, *res;
+
+    memset(&hints, '\0', sizeof(struct addrinfo));
+    hints.ai_flags = AI_NUMERICHOST;
+    hints.ai_family = PF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+    if (getaddrinfo(host, NULL, &hints, &res) != 0) {
+	return false;
+    }
+    freeaddrinfo(res);
+    return true;
+#else /*][*/
+    return inet_addr(host) != INADDR_NONE;
+#endif /*]*/
+}
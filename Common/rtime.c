@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	rtime.c
+ *		Host response-time histograms.
+ *
+ * Each sample is the time from sending an AID to the host unlocking the
+ * keyboard, in microseconds. There is one histogram for all AIDs, plus
+ * one per AID.
+ */
+
+#include "globals.h"
+
+#include "3270ds.h"
+#include "hist.h"
+#include "lazya.h"
+#include "names.h"
+#include "query.h"
+#include "see.h"
+#include "utils.h"
+#include "varbuf.h"
+
+#include "rtime.h"
+
+static hist_t all;
+static hist_t by_aid[256];
+
+/* Format one histogram for Query(). */
+static void
+hist_dump(varbuf_t *r, const char *name, hist_t *h)
+{
+    vb_appendf(r, "%s%s count %lu mean-ms %.3f p50-ms %.3f p95-ms %.3f "
+	    "p99-ms %.3f max-ms %.3f",
+	    vb_len(r)? "\n": "",
+	    name,
+	    h->count,
+	    (h->total / h->count) / 1000.0,
+	    hist_pct(h, 50) / 1000.0,
+	    hist_pct(h, 95) / 1000.0,
+	    hist_pct(h, 99) / 1000.0,
+	    h->max / 1000.0);
+}
+
+/*
+ * Record a host response time.
+ */
+void
+rtime_record(unsigned char aid, unsigned long usec)
+{
+    hist_add(&all, usec);
+    hist_add(&by_aid[aid], usec);
+}
+
+/*
+ * Discard the samples for the last session.
+ */
+void
+rtime_reset(void)
+{
+    int i;
+
+    hist_clear(&all);
+    for (i = 0; i < 256; i++) {
+	hist_clear(&by_aid[i]);
+    }
+}
+
+/*
+ * Response time query.
+ * Returns one line for all AIDs, then one for each AID that has been sent.
+ */
+static const char *
+rtime_query(void)
+{
+    varbuf_t r;
+    int i;
+
+    if (!all.count) {
+	return NULL;
+    }
+    vb_init(&r);
+    hist_dump(&r, "All", &all);
+    for (i = 0; i < 256; i++) {
+	if (by_aid[i].count) {
+	    hist_dump(&r, see_aid((unsigned char)i), &by_aid[i]);
+	}
+    }
+    return lazya(vb_consume(&r));
+}
+
+/* Bucket boundaries for OpenMetrics. */
+static struct {
+    unsigned long usec;
+    const char *le;
+} metric_bounds[] = {
+    { 1000, "0.001" },
+    { 2500, "0.0025" },
+    { 5000, "0.005" },
+    { 10000, "0.01" },
+    { 25000, "0.025" },
+    { 50000, "0.05" },
+    { 100000, "0.1" },
+    { 250000, "0.25" },
+    { 500000, "0.5" },
+    { 1000000, "1.0" },
+    { 2500000, "2.5" },
+    { 5000000, "5.0" },
+    { 10000000, "10.0" }
+};
+
+/*
+ * Format the per-AID histograms in OpenMetrics text format.
+ * Each fine bucket is counted against the first boundary at or above its
+ * top value, so a sample just under a boundary can land in the next one.
+ */
+const char *
+rtime_metrics(void)
+{
+    varbuf_t r;
+    int i;
+
+    vb_init(&r);
+    vb_appends(&r, "# TYPE x3270_response_seconds histogram\n");
+    for (i = 0; i < 256; i++) {
+	hist_t *h = &by_aid[i];
+	const char *name;
+	unsigned long cum = 0;
+	unsigned b = 0;
+	size_t j;
+
+	if (!h->count) {
+	    continue;
+	}
+	name = see_aid((unsigned char)i);
+	for (j = 0; j < array_count(metric_bounds); j++) {
+	    while (b < HIST_BUCKETS &&
+		    hist_bucket_top(b) <= metric_bounds[j].usec) {
+		cum += h->buckets[b++];
+	    }
+	    vb_appendf(&r, "x3270_response_seconds_bucket{aid=\"%s\","
+		    "le=\"%s\"} %lu\n", name, metric_bounds[j].le, cum);
+	}
+	vb_appendf(&r, "x3270_response_seconds_bucket{aid=\"%s\","
+		"le=\"+Inf\"} %lu\n", name, h->count);
+	vb_appendf(&r, "x3270_response_seconds_count{aid=\"%s\"} %lu\n",
+		name, h->count);
+	vb_appendf(&r, "x3270_response_seconds_sum{aid=\"%s\"} %.6f\n",
+		name, h->total / 1000000.0);
+    }
+    return lazya(vb_consume(&r));
+}
+
+/* A new session is starting. */
+static void
+rtime_connect(bool ignored _is_unused)
+{
+    if (PCONNECTED && !CONNECTED) {
+	rtime_reset();
+    }
+}
+
+/*
+ * Response time module registration.
+ */
+void
+rtime_register(void)
+{
+    static query_t queries[] = {
+	{ KwResponseTime, rtime_query, NULL, false, false }
+    };
+
+    register_schange(ST_CONNECT, rtime_connect);
+    register_queries(queries, array_count(queries));
+}
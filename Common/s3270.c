@@ -39,6 +39,8 @@
 #include "globals.h"
 #if !defined(_WIN32) /*[*/
 # include <sys/wait.h>
+# include <sys/socket.h>
+# include <sys/un.h>
 # include <signal.h>
 #endif /*]*/
 #include <errno.h>
@@ -47,12 +49,17 @@
 #include "resources.h"
 
 #include "actions.h"
+#include "allocs.h"
 #include "bind-opt.h"
 #include "codepage.h"
 #include "ctlrc.h"
+#include "evprof.h"
 #include "unicodec.h"
+#include "footprint.h"
 #include "ft.h"
 #include "glue.h"
+#include "varbuf.h"	/* must precede hibernate.h */
+#include "hibernate.h"
 #include "host.h"
 #include "httpd-core.h"
 #include "httpd-nodes.h"
@@ -63,6 +70,7 @@
 #include "min_version.h"
 #include "model.h"
 #include "nvt.h"
+#include "observe.h"
 #include "opts.h"
 #include "peerscript.h"
 #include "popups.h"
@@ -71,13 +79,18 @@
 #include "proxy_toggle.h"
 #include "query.h"
 #include "screen.h"
+#include "screenhist.h"
 #include "selectc.h"
+#include "simd_glue.h"
 #include "sio_glue.h"
+#include "stats.h"
 #include "task.h"
 #include "telnet.h"
 #include "toggles.h"
 #include "trace.h"
 #include "screentrace.h"
+#include "shmexport.h"
+#include "startup.h"
 #include "utils.h"
 #include "vstatus.h"
 #include "xio.h"
@@ -98,6 +111,196 @@ unsigned windirs_flags;
 
 static void s3270_register(void);
 
+#if !defined(_WIN32) /*[*/
+/* Largest zygote spawn request. */
+# define ZYGOTE_REQ_MAX	(64 * 1024)
+
+/* Returns true if a zygote spawn request is complete. */
+static bool
+zygote_request_done(varbuf_t *r)
+{
+    size_t len = vb_len(r);
+    const char *buf = vb_buf(r);
+
+    return len > 0 && buf[len - 1] == '\0' &&
+	(len == 1 || buf[len - 2] == '\0');
+}
+
+/*
+ * Read a zygote spawn request: the session's arguments, each terminated by
+ * a NUL, followed by an empty argument (one more NUL). The session's stdin,
+ * stdout and stderr arrive with the first part of the request, as
+ * SCM_RIGHTS.
+ * Returns true for success, with the arguments in 'r' and the descriptors in
+ * 'fds'.
+ */
+static bool
+zygote_read_request(int s, varbuf_t *r, int fds[3])
+{
+    char buf[4096];
+    char cbuf[CMSG_SPACE(3 * sizeof(int))];
+    struct iovec iov;
+    struct msghdr msg;
+    struct cmsghdr *cmsg;
+    ssize_t nr;
+
+    memset(&msg, 0, sizeof(msg));
+    iov.iov_base = buf;
+    iov.iov_len = sizeof(buf);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = cbuf;
+    msg.msg_controllen = sizeof(cbuf);
+    nr = recvmsg(s, &msg, 0);
+    if (nr <= 0) {
+	return false;
+    }
+    cmsg = CMSG_FIRSTHDR(&msg);
+    if (cmsg == NULL || cmsg->cmsg_level != SOL_SOCKET ||
+	    cmsg->cmsg_type != SCM_RIGHTS ||
+	    cmsg->cmsg_len != CMSG_LEN(3 * sizeof(int))) {
+	fprintf(stderr, "zygote: request without stdin/stdout/stderr\n");
+	return false;
+    }
+    memcpy(fds, CMSG_DATA(cmsg), 3 * sizeof(int));
+
+    /* Collect the rest of the arguments. */
+    vb_append(r, buf, nr);
+    while (!zygote_request_done(r) && vb_len(r) <= ZYGOTE_REQ_MAX &&
+	    (nr = read(s, buf, sizeof(buf))) > 0) {
+	vb_append(r, buf, nr);
+    }
+    if (!zygote_request_done(r)) {
+	fprintf(stderr, "zygote: incomplete request\n");
+	close(fds[0]);
+	close(fds[1]);
+	close(fds[2]);
+	return false;
+    }
+    return true;
+}
+
+/*
+ * Run as a zygote.
+ *
+ * The process has already loaded its libraries and registered every module,
+ * so each session forked from here skips that work and shares the
+ * read-only tables with the zygote. Requests arrive on a Unix-domain socket
+ * (see zygote_read_request()); the reply is the new session's process ID,
+ * in decimal, followed by a newline.
+ *
+ * Returns only in a forked session, with *argcp and *argvp replaced by the
+ * session's arguments.
+ */
+static void
+zygote(const char *path, int *argcp, char ***argvp)
+{
+    struct sockaddr_un ssun;
+    int ls;
+
+    if (strlen(path) >= sizeof(ssun.sun_path)) {
+	fprintf(stderr, "%s: socket path too long\n", OptZygote);
+	exit(1);
+    }
+    memset(&ssun, 0, sizeof(ssun));
+    ssun.sun_family = AF_UNIX;
+    strcpy(ssun.sun_path, path);
+    ls = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (ls < 0) {
+	perror("socket");
+	exit(1);
+    }
+    unlink(path);
+    if (bind(ls, (struct sockaddr *)&ssun, sizeof(ssun)) < 0 ||
+	    listen(ls, SOMAXCONN) < 0) {
+	perror(path);
+	exit(1);
+    }
+
+    /* Sessions are not our responsibility once started. */
+    signal(SIGCHLD, SIG_IGN);
+    signal(SIGPIPE, SIG_IGN);
+
+    for (;;) {
+	int s;
+	varbuf_t r;
+	int fds[3];
+	pid_t pid;
+	char pbuf[32];
+	const char *a;
+	int argc;
+	char **argv;
+
+	s = accept(ls, NULL, NULL);
+	if (s < 0) {
+	    if (errno != EINTR) {
+		perror("accept");
+	    }
+	    continue;
+	}
+	vb_init(&r);
+	if (!zygote_read_request(s, &r, fds)) {
+	    vb_free(&r);
+	    close(s);
+	    continue;
+	}
+
+	switch (pid = fork()) {
+	case -1:
+	    perror("fork");
+	    break;
+	case 0:
+	    /* Session. */
+	    close(ls);
+	    close(s);
+	    signal(SIGCHLD, SIG_DFL);
+	    signal(SIGPIPE, SIG_DFL);
+	    dup2(fds[0], 0);
+	    dup2(fds[1], 1);
+	    dup2(fds[2], 2);
+	    if (fds[0] > 2) {
+		close(fds[0]);
+	    }
+	    if (fds[1] > 2 && fds[1] != fds[0]) {
+		close(fds[1]);
+	    }
+	    if (fds[2] > 2 && fds[2] != fds[0] && fds[2] != fds[1]) {
+		close(fds[2]);
+	    }
+
+	    /* Build the new argument vector, keeping argv[0]. */
+	    argc = 1;
+	    for (a = vb_buf(&r); *a; a += strlen(a) + 1) {
+		argc++;
+	    }
+	    argv = (char **)Malloc((argc + 1) * sizeof(char *));
+	    argv[0] = (*argvp)[0];
+	    argc = 1;
+	    for (a = vb_buf(&r); *a; a += strlen(a) + 1) {
+		argv[argc++] = NewString(a);
+	    }
+	    argv[argc] = NULL;
+	    vb_free(&r);
+	    *argcp = argc;
+	    *argvp = argv;
+	    startup_init("s3270");
+	    return;
+	default:
+	    snprintf(pbuf, sizeof(pbuf), "%d\n", (int)pid);
+	    if (write(s, pbuf, strlen(pbuf)) < 0) {
+		perror("zygote: write");
+	    }
+	    break;
+	}
+	vb_free(&r);
+	close(fds[0]);
+	close(fds[1]);
+	close(fds[2]);
+	close(s);
+    }
+}
+#endif /*]*/
+
 void
 usage(const char *msg)
 {
@@ -163,6 +366,8 @@ main(int argc, char *argv[])
 {
     const char	*cl_hostname = NULL;
 
+    startup_init("s3270");
+
 #if defined(_WIN32) /*[*/
     get_version_info();
     if (!get_dirs("wc3270", &instdir, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
@@ -180,18 +385,26 @@ main(int argc, char *argv[])
      */
     codepage_register();
     ctlr_register();
+    evprof_register();
+    allocs_register();
+    footprint_register();
     ft_register();
+    hibernate_register();
     host_register();
     idle_register();
     kybd_register();
     task_register();
     query_register();
+    stats_register();
     nvt_register();
     print_screen_register();
     s3270_register();
     toggles_register();
     trace_register();
     screentrace_register();
+    observe_register();
+    screenhist_register();
+    shmexport_register();
     xio_register();
     sio_glue_register();
     hio_register();
@@ -200,8 +413,17 @@ main(int argc, char *argv[])
     net_register();
     login_macro_register();
     vstatus_register();
+    simd_glue_register();
+
+#if !defined(_WIN32) /*[*/
+    /* Become a zygote if asked. Only forked sessions return. */
+    if (argc > 2 && !strcmp(argv[1], OptZygote)) {
+	zygote(argv[2], &argc, &argv);
+    }
+#endif /*]*/
 
     argc = parse_command_line(argc, (const char **)argv, &cl_hostname);
+    startup_mark(STARTUP_RESOURCES);
 
     if (appres.min_version != NULL) {
 	check_min_version(appres.min_version);
@@ -211,6 +433,7 @@ main(int argc, char *argv[])
 	xs_warning("Cannot find code page \"%s\"", appres.codepage);
 	codepage_init(NULL);
     }
+    startup_mark(STARTUP_CODEPAGE);
     model_init();
     ctlr_init(ALL_CHANGE);
     ctlr_reinit(ALL_CHANGE);
@@ -305,6 +528,11 @@ s3270_register(void)
 	    NULL, "Force local codeset to be UTF-8" },
 	{ OptCallback, OPT_STRING,  false, ResCallback,
 	    aoffset(scripting.callback), NULL, "Callback address and port" },
+#if !defined(_WIN32) /*[*/
+	{ OptZygote,   OPT_SKIP2,   false, NULL,         NULL,
+	    "<socket-path>", "Serve session requests on <socket-path> "
+	    "(must be first)" },
+#endif /*]*/
 
     };
     static res_t s3270_resources[] = {
@@ -0,0 +1,394 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *	screenhist.c
+ *		In-memory screen history.
+ *
+ * When screenHistory is set to N, the last N screens written by the host
+ * are kept in memory. The newest is kept whole. Each older one is kept as
+ * the XOR of it and the screen after it, run-length encoded, so the parts
+ * of a screen that did not change cost next to nothing. Each screen also
+ * records when it arrived and the AID the user sent before it.
+ *
+ * History() and the /3270/history HTTP node rebuild a past screen on
+ * demand, by applying the deltas backwards from the newest screen.
+ */
+
+#include "globals.h"
+
+#include <time.h>
+
+#include "appres.h"
+#include "ctlr.h"
+#include "3270ds.h"
+#include "actions.h"
+#include "names.h"
+#include "popups.h"
+#include "resources.h"
+#include "see.h"
+#include "varbuf.h"	/* must precede hibernate.h */
+#include "hibernate.h"
+#include "lazya.h"
+#include "screenhist.h"
+#include "task.h"
+#include "toggles.h"
+#include "trace.h"
+#include "utils.h"
+
+/* One screen. */
+typedef struct {
+    struct timeval ts;		/* when it was written */
+    unsigned char aid;		/* AID sent before it, or AID_NO */
+    int rows, cols;		/* geometry */
+    int caddr;			/* cursor address */
+    bool full;			/* delta is the whole image, not an XOR */
+    varbuf_t delta;		/* packed delta to the next newer screen,
+				   empty for the newest */
+} shist_t;
+
+static shist_t *shist = NULL;	/* ring of screens */
+static int shist_max = 0;	/* size of the ring */
+static int shist_first = 0;	/* index of the oldest screen */
+static int shist_count = 0;	/* number of screens */
+static struct ea *latest = NULL; /* newest screen, whole */
+static size_t latest_cells = 0;
+static unsigned char last_aid = AID_NO;
+
+/* Ring index of the screen n back from the newest. */
+#define SHIST_IX(n)	((shist_first + shist_count - 1 - (n)) % shist_max)
+
+/* Empty the history and resize it to the current screenHistory value. */
+static void
+shist_reset(void)
+{
+    int i;
+
+    for (i = 0; i < shist_count; i++) {
+	vb_free(&shist[SHIST_IX(i)].delta);
+    }
+    shist_max = (appres.screen_history > 0)? appres.screen_history: 0;
+    Replace(shist, shist_max? (shist_t *)Calloc(shist_max, sizeof(shist_t)):
+	    NULL);
+    shist_first = 0;
+    shist_count = 0;
+    Replace(latest, NULL);
+    latest_cells = 0;
+}
+
+/**
+ * Note the AID the user just sent. It is recorded with the next screen.
+ *
+ * @param[in] aid_code	AID
+ */
+void
+screenhist_aid(unsigned char aid_code)
+{
+    last_aid = aid_code;
+}
+
+/**
+ * Save the screen the host just wrote.
+ */
+void
+screenhist_capture(void)
+{
+    size_t cells = ROWS * COLS;
+    shist_t *h;
+
+    if (appres.screen_history != shist_max) {
+	shist_reset();
+    }
+    if (shist_max == 0 || ea_buf == NULL) {
+	return;
+    }
+
+    if (shist_count > 0) {
+	/* Turn the newest screen into a delta against this one. */
+	h = &shist[SHIST_IX(0)];
+	if (h->rows == ROWS && h->cols == COLS) {
+	    unsigned char *l = (unsigned char *)latest;
+	    const unsigned char *e = (const unsigned char *)ea_buf;
+	    size_t i;
+
+	    for (i = 0; i < cells * sizeof(struct ea); i++) {
+		l[i] ^= e[i];
+	    }
+	    h->full = false;
+	} else {
+	    h->full = true;
+	}
+	hib_pack(&h->delta, latest, sizeof(struct ea), h->rows * h->cols);
+    }
+
+    /* Drop the oldest screen if the ring is full. */
+    if (shist_count == shist_max) {
+	vb_free(&shist[shist_first].delta);
+	shist_first = (shist_first + 1) % shist_max;
+	shist_count--;
+    }
+
+    /* Add this one. */
+    shist_count++;
+    h = &shist[SHIST_IX(0)];
+    gettimeofday(&h->ts, NULL);
+    h->aid = last_aid;
+    h->rows = ROWS;
+    h->cols = COLS;
+    h->caddr = cursor_addr;
+    h->full = false;
+    vb_init(&h->delta);
+    if (latest_cells < cells) {
+	Replace(latest, (struct ea *)Malloc(cells * sizeof(struct ea)));
+	latest_cells = cells;
+    }
+    memcpy(latest, ea_buf, cells * sizeof(struct ea));
+    last_aid = AID_NO;
+}
+
+/*
+ * Rebuild the screen n back from the newest. Returns a malloc'd image the
+ * size of that screen.
+ */
+static struct ea *
+shist_rebuild(int n)
+{
+    size_t max_cells = 0;
+    struct ea *image;
+    struct ea *delta;
+    int i;
+
+    for (i = 0; i <= n; i++) {
+	shist_t *h = &shist[SHIST_IX(i)];
+
+	if ((size_t)(h->rows * h->cols) > max_cells) {
+	    max_cells = h->rows * h->cols;
+	}
+    }
+    image = (struct ea *)Malloc(max_cells * sizeof(struct ea));
+    delta = (struct ea *)Malloc(max_cells * sizeof(struct ea));
+    memcpy(image, latest, shist[SHIST_IX(0)].rows * shist[SHIST_IX(0)].cols *
+	    sizeof(struct ea));
+
+    for (i = 1; i <= n; i++) {
+	shist_t *h = &shist[SHIST_IX(i)];
+	size_t cells = h->rows * h->cols;
+
+	if (h->full) {
+	    hib_unpack((const unsigned char *)vb_buf(&h->delta), image,
+		    sizeof(struct ea), cells);
+	} else {
+	    unsigned char *m = (unsigned char *)image;
+	    const unsigned char *d = (const unsigned char *)delta;
+	    size_t j;
+
+	    hib_unpack((const unsigned char *)vb_buf(&h->delta), delta,
+		    sizeof(struct ea), cells);
+	    for (j = 0; j < cells * sizeof(struct ea); j++) {
+		m[j] ^= d[j];
+	    }
+	}
+    }
+    Free(delta);
+    return image;
+}
+
+/**
+ * List the saved screens, newest first, one per line: the number to pass
+ * to History(), the time it arrived, the AID sent before it, its size and
+ * the bytes its delta takes.
+ *
+ * @return List, good until the next call to lazya()
+ */
+const char *
+screenhist_list(void)
+{
+    varbuf_t r;
+    int i;
+
+    vb_init(&r);
+    for (i = 0; i < shist_count; i++) {
+	shist_t *h = &shist[SHIST_IX(i)];
+	time_t t = h->ts.tv_sec;
+	struct tm *tm = localtime(&t);
+
+	vb_appendf(&r, "%d %d%02d%02d.%02d%02d%02d.%03d %s %dx%d %lu\n", i,
+		tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday,
+		tm->tm_hour, tm->tm_min, tm->tm_sec,
+		(int)(h->ts.tv_usec / 1000L), see_aid(h->aid), h->rows,
+		h->cols, (unsigned long)(i? vb_len(&h->delta):
+		    h->rows * h->cols * sizeof(struct ea)));
+    }
+    return lazya(vb_consume(&r));
+}
+
+/**
+ * Render a saved screen as text, as Ascii() would.
+ *
+ * @param[in] n		screen number, 0 for the newest
+ * @param[in] force_utf8 true to force UTF-8 output
+ * @param[out] errmsg	returned error message
+ *
+ * @return Text, good until the next call to lazya(), or NULL for an error
+ */
+const char *
+screenhist_text(int n, bool force_utf8, char **errmsg)
+{
+    struct ea *image;
+    shist_t *h;
+    char *text;
+
+    if (shist_max == 0) {
+	*errmsg = ResScreenHistory " is not set";
+	return NULL;
+    }
+    if (n < 0 || n >= shist_count) {
+	*errmsg = lazyaf("There %s only %d screen%s saved",
+		(shist_count == 1)? "is": "are", shist_count,
+		(shist_count == 1)? "": "s");
+	return NULL;
+    }
+    h = &shist[SHIST_IX(n)];
+    image = shist_rebuild(n);
+    text = dump_screen_text(image, h->rows, h->cols, force_utf8);
+    Free(image);
+    return lazya(text);
+}
+
+/*
+ * History action.
+ *  History()
+ *   lists the saved screens
+ *  History(n)
+ *   displays saved screen n, where 0 is the newest
+ */
+static bool
+History_action(ia_t ia, unsigned argc, const char **argv)
+{
+    const char *text;
+    char *errmsg;
+    char *ptr;
+    long n;
+
+    action_debug(AnHistory, ia, argc, argv);
+    if (check_argc(AnHistory, argc, 0, 1) < 0) {
+	return false;
+    }
+
+    if (argc == 0) {
+	text = screenhist_list();
+	if (*text) {
+	    /* Drop the final newline; action_output() separates lines. */
+	    action_output("%.*s", (int)strlen(text) - 1, text);
+	}
+	return true;
+    }
+
+    n = strtol(argv[0], &ptr, 10);
+    if (ptr == argv[0] || *ptr != '\0') {
+	popup_an_error(AnHistory "(): Invalid screen number '%s'", argv[0]);
+	return false;
+    }
+    if ((text = screenhist_text((int)n, ia == IA_HTTPD, &errmsg)) == NULL) {
+	popup_an_error(AnHistory "(): %s", errmsg);
+	return false;
+    }
+    if (*text) {
+	action_output("%.*s", (int)strlen(text) - 1, text);
+    }
+    return true;
+}
+
+/* Validate a new screenHistory value. */
+static bool
+toggle_screen_history(const char *name _is_unused, const char *value)
+{
+    unsigned long l;
+    char *end;
+    int n;
+
+    if (!*value) {
+	appres.screen_history = 0;
+	shist_reset();
+	return true;
+    }
+
+    l = strtoul(value, &end, 10);
+    n = (int)l;
+    if (*end != '\0' || (unsigned long)n != l || n < 0) {
+	popup_an_error("Invalid %s value", ResScreenHistory);
+	return false;
+    }
+    appres.screen_history = n;
+    shist_reset();
+    return true;
+}
+
+/* Pack the newest screen away while hibernating. */
+static void
+shist_sleep(varbuf_t *blob)
+{
+    if (shist_count == 0) {
+	return;
+    }
+    hib_pack(blob, latest, sizeof(struct ea),
+	    shist[SHIST_IX(0)].rows * shist[SHIST_IX(0)].cols);
+    Replace(latest, NULL);
+}
+
+/* Restore the newest screen after hibernating. */
+static void
+shist_wake(const unsigned char *blob)
+{
+    if (shist_count == 0) {
+	return;
+    }
+    latest = (struct ea *)Malloc(latest_cells * sizeof(struct ea));
+    hib_unpack(blob, latest, sizeof(struct ea),
+	    shist[SHIST_IX(0)].rows * shist[SHIST_IX(0)].cols);
+}
+
+/**
+ * Screen history module registration.
+ */
+void
+screenhist_register(void)
+{
+    static action_table_t actions[] = {
+	{ AnHistory,	History_action,	ACTION_KE }
+    };
+
+    /* Register the action. */
+    register_actions(actions, array_count(actions));
+
+    /* Register the toggle. */
+    register_extended_toggle(ResScreenHistory, toggle_screen_history,
+	    NULL, NULL, (void **)&appres.screen_history, XRM_INT);
+
+    /* Register the hibernation hooks. */
+    register_hibernator(shist_sleep, shist_wake);
+}
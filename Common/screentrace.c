@@ -38,6 +38,9 @@
 #include <signal.h>
 #include <fcntl.h>
 #include <limits.h>
+#if !defined(_WIN32) /*[*/
+# include <sys/wait.h>
+#endif /*]*/
 #include "3270ds.h"
 #include "appres.h"
 #include "ctlr.h"
@@ -109,16 +112,119 @@ static int 	screentrace_count;
 /* Statics */
 static FILE    *screentracef = NULL;
 static fps_t	screentrace_fps = NULL;
+#if !defined(_WIN32) /*[*/
+static pid_t	screentrace_compress_pid = -1;
+#endif /*]*/
 
 /*
- * Screen trace function, called when the host clears the screen.
+ * Row hashes of the last screen written, used to suppress duplicate screens
+ * and to find the rows a delta screen needs to contain.
+ */
+static uint32_t *row_hash = NULL;
+static uint32_t *new_row_hash = NULL;
+static unsigned char *row_diff = NULL;
+static int	row_hash_size = 0;	/* number of rows allocated */
+static int	row_hash_rows = 0;	/* ROWS when row_hash was computed */
+static int	row_hash_cols = 0;	/* COLS when row_hash was computed */
+
+/*
+ * Screens captured but not yet written. Screens are captured when the host
+ * changes the screen, and formatted and written from a later pass through
+ * the event loop, so pending keyboard and host input is not held up.
  */
+typedef enum {
+    STD_WAIT,		/* write the oldest screen now to make room */
+    STD_OLDEST,		/* discard the oldest screen */
+    STD_NEWEST		/* discard the new screen */
+} st_drop_t;
+static fps_snap_t *st_queue = NULL;
+static int	st_qsize = 0;		/* slots allocated */
+static int	st_qhead = 0;		/* index of the oldest screen */
+static int	st_qcount = 0;		/* number of screens queued */
+static st_drop_t st_drop = STD_WAIT;
+static unsigned long st_dropped = 0;	/* screens discarded this trace */
+static ioid_t	st_queue_id = NULL_IOID;
+
+/*
+ * Hash a row of the screen, including the field attribute that governs
+ * the start of it, since that affects how the row is displayed.
+ */
+static uint32_t
+hash_row(int row)
+{
+    uint32_t h = 2166136261U;	/* FNV-1a */
+    struct ea *ea = &ea_buf[row * COLS];
+    struct ea *faea = fa2ea(row * COLS);
+    int i;
+
+#   define HASH_EA(e) { \
+	h = (h ^ (e)->ec) * 16777619U; \
+	h = (h ^ (e)->fa) * 16777619U; \
+	h = (h ^ (e)->fg) * 16777619U; \
+	h = (h ^ (e)->bg) * 16777619U; \
+	h = (h ^ (e)->gr) * 16777619U; \
+	h = (h ^ (e)->cs) * 16777619U; \
+	h = (h ^ (uint32_t)(e)->ucs4) * 16777619U; \
+    }
+    HASH_EA(faea);
+    for (i = 0; i < COLS; i++) {
+	HASH_EA(&ea[i]);
+    }
+#   undef HASH_EA
+    return h;
+}
+
+/* Forget the last screen written, so the next one is written in full. */
 static void
-do_screentrace(bool always _is_unused)
+forget_screen(void)
+{
+    row_hash_rows = 0;
+    row_hash_cols = 0;
+}
+
+/*
+ * Compare the screen with the last one written.
+ * Returns the number of rows that differ, and sets row_diff.
+ */
+static int
+diff_screen(void)
+{
+    int row;
+    int ndiff = 0;
+    uint32_t *t;
+
+    if (row_hash_size < maxROWS) {
+	Replace(row_hash, (uint32_t *)Malloc(maxROWS * sizeof(uint32_t)));
+	Replace(new_row_hash, (uint32_t *)Malloc(maxROWS * sizeof(uint32_t)));
+	Replace(row_diff, (unsigned char *)Malloc(maxROWS));
+	row_hash_size = maxROWS;
+	forget_screen();
+    }
+    for (row = 0; row < ROWS; row++) {
+	new_row_hash[row] = hash_row(row);
+	row_diff[row] = row_hash_rows != ROWS || row_hash_cols != COLS ||
+	    new_row_hash[row] != row_hash[row];
+	if (row_diff[row]) {
+	    ndiff++;
+	}
+    }
+
+    /* The new hashes become the old ones. */
+    t = row_hash;
+    row_hash = new_row_hash;
+    new_row_hash = t;
+    row_hash_rows = ROWS;
+    row_hash_cols = COLS;
+    return ndiff;
+}
+
+/* Write one captured screen, and free it. */
+static void
+write_snap(fps_snap_t snap)
 {
-    fps_status_t status;
+    fps_status_t status = fprint_screen_body_snap(screentrace_fps, snap);
 
-    status = fprint_screen_body(screentrace_fps);
+    fprint_screen_snap_free(snap);
     if (FPS_IS_ERROR(status)) {
 	popup_an_error("Screen trace failed");
     } else if (status == FPS_STATUS_SUCCESS) {
@@ -128,6 +234,120 @@ do_screentrace(bool always _is_unused)
     }
 }
 
+/* Remove the oldest screen from the queue. */
+static fps_snap_t
+dequeue_snap(void)
+{
+    fps_snap_t snap = st_queue[st_qhead];
+
+    st_qhead = (st_qhead + 1) % st_qsize;
+    st_qcount--;
+    return snap;
+}
+
+/* Write every queued screen now. */
+static void
+screentrace_drain(void)
+{
+    if (st_queue_id != NULL_IOID) {
+	RemoveTimeOut(st_queue_id);
+	st_queue_id = NULL_IOID;
+    }
+    while (st_qcount) {
+	write_snap(dequeue_snap());
+    }
+}
+
+/* Write the oldest queued screen, from the event loop. */
+static void
+screentrace_queue_timeout(ioid_t id _is_unused)
+{
+    st_queue_id = NULL_IOID;
+    if (st_qcount) {
+	write_snap(dequeue_snap());
+    }
+    if (st_qcount) {
+	st_queue_id = AddTimeOut(0, screentrace_queue_timeout);
+    }
+}
+
+/*
+ * Queue a captured screen.
+ * If the queue is full, screenTraceDrop says what to do about it.
+ */
+static void
+queue_snap(fps_snap_t snap)
+{
+    if (st_qsize != appres.screentrace.queue) {
+	/* The queue size changed. Write what is queued and start over. */
+	screentrace_drain();
+	Replace(st_queue,
+		(fps_snap_t *)Malloc(appres.screentrace.queue *
+		    sizeof(fps_snap_t)));
+	st_qsize = appres.screentrace.queue;
+	st_qhead = 0;
+    }
+
+    if (st_qcount == st_qsize) {
+	switch (st_drop) {
+	case STD_WAIT:
+	    write_snap(dequeue_snap());
+	    break;
+	case STD_OLDEST:
+	    fprint_screen_snap_free(dequeue_snap());
+	    break;
+	case STD_NEWEST:
+	    fprint_screen_snap_free(snap);
+	    snap = NULL;
+	    break;
+	}
+	if (st_drop != STD_WAIT) {
+	    vtrace("screentrace: queue full, %s screen discarded\n",
+		    (st_drop == STD_OLDEST)? "oldest": "newest");
+	    st_dropped++;
+
+	    /* A delta screen after a gap would be misleading. */
+	    forget_screen();
+	}
+    }
+
+    if (snap != NULL) {
+	st_queue[(st_qhead + st_qcount) % st_qsize] = snap;
+	st_qcount++;
+    }
+    if (st_qcount && st_queue_id == NULL_IOID) {
+	st_queue_id = AddTimeOut(0, screentrace_queue_timeout);
+    }
+}
+
+/*
+ * Screen trace function, called when the host clears the screen.
+ */
+static void
+do_screentrace(bool always _is_unused)
+{
+    bool full = row_hash_rows != ROWS || row_hash_cols != COLS;
+
+    if (appres.screentrace.dedup || appres.screentrace.delta) {
+	int ndiff = diff_screen();
+
+	if (ndiff == 0 && appres.screentrace.dedup) {
+	    vtrace("screentrace: duplicate screen suppressed\n");
+	    return;
+	}
+	if (appres.screentrace.delta && !full && ndiff < ROWS) {
+	    fprint_screen_set_rows(screentrace_fps, row_diff);
+	}
+    }
+
+    if (appres.screentrace.queue > 0) {
+	queue_snap(fprint_screen_snap(screentrace_fps));
+    } else {
+	screentrace_drain();
+	write_snap(fprint_screen_snap(screentrace_fps));
+    }
+}
+
 void
 trace_screen(bool is_clear)
 {
@@ -146,6 +366,9 @@ trace_char(char c)
     if (!toggled(SCREEN_TRACE) || !screentracef) {
 	return;
     }
+    if (st_qcount) {
+	screentrace_drain();
+    }
     fputc(c, screentracef);
 }
 
@@ -160,11 +383,13 @@ trace_nvt_disc(void)
 {
     int i;
 
+    screentrace_drain();
     fputc('\n', screentracef);
     for (i = 0; i < COLS; i++) {
 	fputc('=', screentracef);
     }
     fputc('\n', screentracef);
+    forget_screen();
 
     trace_skipping = true;
 }
@@ -240,6 +465,84 @@ screentrace_abort(void)
 }
 #endif /*]*/
 
+#if !defined(_WIN32) /*[*/
+/*
+ * Send a screen trace file through the screenTraceCompress command, such as
+ * gzip or zstd, which writes to it.
+ * Returns the stream to write the trace to, or NULL for failure. In either
+ * case, f has been closed.
+ */
+static FILE *
+compress_open(FILE *f, const char *name)
+{
+    int fds[2];
+    FILE *p;
+
+    fflush(f);
+    if (pipe(fds) < 0) {
+	popup_an_errno(errno, "pipe");
+	fclose(f);
+	return NULL;
+    }
+    switch ((screentrace_compress_pid = fork())) {
+    case -1:
+	popup_an_errno(errno, "fork");
+	close(fds[0]);
+	close(fds[1]);
+	fclose(f);
+	return NULL;
+    case 0:
+	/* child */
+	dup2(fds[0], 0);
+	dup2(fileno(f), 1);
+	close(fds[0]);
+	close(fds[1]);
+	execl("/bin/sh", "/bin/sh", "-c", appres.screentrace.compress,
+		(char *)NULL);
+	_exit(1);
+	break;
+    default:
+	/* parent */
+	break;
+    }
+    close(fds[0]);
+    fclose(f);
+    fcntl(fds[1], F_SETFD, 1);
+    if ((p = fdopen(fds[1], "w")) == NULL) {
+	popup_an_errno(errno, "%s", name);
+	close(fds[1]);
+	waitpid(screentrace_compress_pid, NULL, 0);
+	screentrace_compress_pid = -1;
+	return NULL;
+    }
+    vtrace("screentrace: compressing %s with '%s'\n", name,
+	    appres.screentrace.compress);
+    return p;
+}
+#endif /*]*/
+
+/*
+ * Parse the screenTraceDrop resource.
+ * Returns true for success, false for failure.
+ */
+static bool
+parse_drop(void)
+{
+    const char *drop = appres.screentrace.drop;
+
+    if (drop == NULL || !*drop || !strcasecmp(drop, "wait")) {
+	st_drop = STD_WAIT;
+    } else if (!strcasecmp(drop, "oldest")) {
+	st_drop = STD_OLDEST;
+    } else if (!strcasecmp(drop, "newest")) {
+	st_drop = STD_NEWEST;
+    } else {
+	popup_an_error("Invalid %s value '%s'", ResScreenTraceDrop, drop);
+	return false;
+    }
+    return true;
+}
+
 /*
  * Begin screen tracing.
  * Returns true for success, false for failure.
@@ -253,9 +556,23 @@ screentrace_go(tss_t target, ptype_t ptype, unsigned opts, char *tfn)
     unsigned full_opts;
     screentrace_t *st;
 
+    if (!parse_drop()) {
+	Free(tfn);
+	return false;
+    }
+
     if (target == TSS_FILE) {
 	xtfn = do_subst(tfn, DS_VARS | DS_TILDE | DS_UNIQUE);
 	screentracef = fopen(xtfn, "a");
+#if !defined(_WIN32) /*[*/
+	if (screentracef != NULL && appres.screentrace.compress != NULL &&
+		appres.screentrace.compress[0]) {
+	    if ((screentracef = compress_open(screentracef, xtfn)) == NULL) {
+		Free(xtfn);
+		return false;
+	    }
+	}
+#endif /*]*/
 	if (ptype == P_NONE) {
 	    if (screentrace_default.ptype != P_NONE) {
 		ptype = screentrace_default.ptype;
@@ -366,9 +683,23 @@ screentrace_go(tss_t target, ptype_t ptype, unsigned opts, char *tfn)
 static void
 end_screentrace(bool is_final _is_unused)
 {
+    screentrace_drain();
+    if (st_dropped) {
+	vtrace("screentrace: %lu screen%s discarded\n", st_dropped,
+		(st_dropped == 1)? "": "s");
+	st_dropped = 0;
+    }
     fprint_screen_done(&screentrace_fps);
     fclose(screentracef);
     screentracef = NULL;
+    forget_screen();
+#if !defined(_WIN32) /*[*/
+    if (screentrace_compress_pid != -1) {
+	/* Let the compression command finish writing the file. */
+	waitpid(screentrace_compress_pid, NULL, 0);
+	screentrace_compress_pid = -1;
+    }
+#endif /*]*/
 
 #if defined(_WIN32) /*[*/
     vtrace("Cleaning up screenTrace\n");
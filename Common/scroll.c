@@ -33,12 +33,18 @@
  */
 
 #include "globals.h"
+#if !defined(_WIN32) /*[*/
+# include <regex.h>
+#endif /*]*/
 #include "appres.h"
 #include "ctlr.h"
 
 #include "3270ds.h"
 #include "actions.h"
 #include "ctlrc.h"
+#include "footprint.h"
+#include "varbuf.h"	/* must precede hibernate.h */
+#include "hibernate.h"
 #include "kybd.h"
 #include "names.h"
 #include "popups.h"
@@ -49,6 +55,7 @@
 #include "telnet.h"
 #include "toggles.h"
 #include "trace.h"
+#include "unicodec.h"
 #include "utils.h"
 #include "vstatus.h"
 
@@ -57,8 +64,64 @@ bool	scroll_initted = false;
 
 /* Statics */
 
-/* Saved screens. */
-static struct ea **ea_save = (struct ea **) NULL;
+/*
+ * Saved lines are kept compressed, maxCOLS cells per line. Each line is a
+ * sequence of segments of up to 255 cells that share their attributes:
+ *
+ *  count, flags, fa, fg, bg, gr, cs, ic, db
+ *
+ * followed by the EBCDIC code and Unicode value of each cell, or of just one
+ * cell if they are all the same (SEG_REPEAT). The Unicode values are stored
+ * in as few bytes as the largest one in the segment needs.
+ *
+ * A line that matches defaults_buf is stored as a NULL pointer.
+ *
+ * Each line also has a Bloom filter of the character trigrams in its text,
+ * set when it is saved, so Find() can skip lines without expanding them.
+ */
+#define FILTER_WORDS	8	/* 256 bits */
+#define FILTER_BITS	(FILTER_WORDS * 32)
+
+typedef struct {
+    uint32_t w[FILTER_WORDS];
+} line_filter_t;
+
+typedef struct {
+    unsigned char *data;	/* compressed line, or NULL for a blank one */
+    size_t len;			/* length of data */
+    line_filter_t filter;	/* trigram filter */
+} saved_line_t;
+
+#define SEG_REPEAT	0x01	/* all cells in the segment are identical */
+#define SEG_UMASK	0x06	/* bytes per Unicode value: */
+#define SEG_U0		 0x00	/*  none, all zero */
+#define SEG_U1		 0x02	/*  1 byte */
+#define SEG_U2		 0x04	/*  2 bytes */
+#define SEG_U4		 0x06	/*  4 bytes */
+#define SEG_HDR_LEN	9	/* count, flags and 7 attribute bytes */
+#define SEG_MIN_REPEAT	3	/* minimum run length for a repeat segment */
+#define SEG_MAX		255	/* maximum cells in a segment */
+
+/* Worst case compressed line size: one segment per cell. */
+#define LINE_MAX_LEN(cols)	((cols) * (SEG_HDR_LEN + 1 + 4))
+
+/* Saved lines. */
+static saved_line_t *ea_save = NULL;
+
+/* Current screen image, while scrolled back. */
+static struct ea *image_save = NULL;
+
+/* Scratch buffers for compression and expansion. */
+static unsigned char *line_buf = NULL;
+static struct ea *wide_buf = NULL;
+static ucs4_t *text_buf = NULL;
+
+/* Trigram filter for a blank line. */
+static line_filter_t blank_filter;
+
+/* Memory used by saved lines, and the limit on it (0 means none). */
+static size_t	save_bytes = 0;
+static size_t	save_budget = 0;
 
 /* Number of lines saved. */
 static int      n_saved = 0;
@@ -67,9 +130,6 @@ static int      scroll_next = 0;
 static int      scrolled_back = 0;
 static bool  need_saving = true;
 static bool  vscreen_swapped = false;
-static char    *sbuf = NULL;
-static int      sa_bufsize;
-static char    *zbuf = NULL;
 static struct ea *defaults_buf = NULL;
 
 /* Thumb state: */
@@ -89,6 +149,340 @@ static bool	scroll_has_3270;
 static void sync_scroll(int sb);
 static void save_image(void);
 static void scroll_reset(void);
+static void scroll_free_lines(void);
+
+/* Test two cells for identical attributes. */
+static bool
+same_attrs(const struct ea *a, const struct ea *b)
+{
+    return a->fa == b->fa && a->fg == b->fg && a->bg == b->bg &&
+	a->gr == b->gr && a->cs == b->cs && a->ic == b->ic && a->db == b->db;
+}
+
+/* Test two cells for identical contents. */
+static bool
+same_cell(const struct ea *a, const struct ea *b)
+{
+    return same_attrs(a, b) && a->ec == b->ec && a->ucs4 == b->ucs4;
+}
+
+/* Count the identical cells starting at 'ea', up to 'max'. */
+static int
+run_length(const struct ea *ea, int max)
+{
+    int n = 1;
+
+    while (n < max && same_cell(&ea[0], &ea[n])) {
+	n++;
+    }
+    return n;
+}
+
+/* Store a Unicode value in 'width' bytes, big-endian. */
+static unsigned char *
+put_ucs4(unsigned char *s, ucs4_t u, int width)
+{
+    int i;
+
+    for (i = width - 1; i >= 0; i--) {
+	*s++ = (unsigned char)(u >> (i * 8));
+    }
+    return s;
+}
+
+/* Fetch a Unicode value stored in 'width' bytes. */
+static const unsigned char *
+get_ucs4(const unsigned char *s, ucs4_t *u, int width)
+{
+    *u = 0;
+    while (width--) {
+	*u = (*u << 8) | *s++;
+    }
+    return s;
+}
+
+/*
+ * Compress a line of maxCOLS cells into line_buf.
+ * Returns the compressed length.
+ */
+static size_t
+line_compress(const struct ea *ea)
+{
+    unsigned char *s = line_buf;
+    int i = 0;
+
+    while (i < maxCOLS) {
+	int left = maxCOLS - i;
+	int max = (left < SEG_MAX)? left: SEG_MAX;
+	int n = run_length(&ea[i], max);
+	bool repeat = (n >= SEG_MIN_REPEAT || n == left);
+	ucs4_t umax = 0;
+	int width;
+	unsigned char flags;
+	int j;
+
+	if (!repeat) {
+	    /* Extend the segment until the attributes change or a run. */
+	    n = 1;
+	    while (n < max && same_attrs(&ea[i], &ea[i + n]) &&
+		    run_length(&ea[i + n], SEG_MIN_REPEAT) < SEG_MIN_REPEAT) {
+		n++;
+	    }
+	}
+	for (j = 0; j < (repeat? 1: n); j++) {
+	    if (ea[i + j].ucs4 > umax) {
+		umax = ea[i + j].ucs4;
+	    }
+	}
+	if (umax == 0) {
+	    width = 0;
+	    flags = SEG_U0;
+	} else if (umax <= 0xff) {
+	    width = 1;
+	    flags = SEG_U1;
+	} else if (umax <= 0xffff) {
+	    width = 2;
+	    flags = SEG_U2;
+	} else {
+	    width = 4;
+	    flags = SEG_U4;
+	}
+	if (repeat) {
+	    flags |= SEG_REPEAT;
+	}
+
+	*s++ = (unsigned char)n;
+	*s++ = flags;
+	*s++ = ea[i].fa;
+	*s++ = ea[i].fg;
+	*s++ = ea[i].bg;
+	*s++ = ea[i].gr;
+	*s++ = ea[i].cs;
+	*s++ = ea[i].ic;
+	*s++ = ea[i].db;
+	for (j = 0; j < (repeat? 1: n); j++) {
+	    *s++ = ea[i + j].ec;
+	    s = put_ucs4(s, ea[i + j].ucs4, width);
+	}
+	i += n;
+    }
+    return s - line_buf;
+}
+
+/* Expand the first 'cols' cells of a saved line into 'ea'. */
+static void
+line_expand(const saved_line_t *l, struct ea *ea, int cols)
+{
+    const unsigned char *s = l->data;
+    int i = 0;
+
+    if (s == NULL) {
+	memcpy(ea, defaults_buf, cols * sizeof(struct ea));
+	return;
+    }
+    while (i < cols) {
+	int n = *s++;
+	unsigned char flags = *s++;
+	int width;
+	struct ea cell;
+	int j;
+
+	switch (flags & SEG_UMASK) {
+	case SEG_U0:
+	default:
+	    width = 0;
+	    break;
+	case SEG_U1:
+	    width = 1;
+	    break;
+	case SEG_U2:
+	    width = 2;
+	    break;
+	case SEG_U4:
+	    width = 4;
+	    break;
+	}
+	cell.fa = *s++;
+	cell.fg = *s++;
+	cell.bg = *s++;
+	cell.gr = *s++;
+	cell.cs = *s++;
+	cell.ic = *s++;
+	cell.db = *s++;
+	for (j = 0; j < n; j++) {
+	    if (j == 0 || !(flags & SEG_REPEAT)) {
+		cell.ec = *s++;
+		s = get_ucs4(s, &cell.ucs4, width);
+	    }
+	    if (i < cols) {
+		ea[i++] = cell;
+	    }
+	}
+    }
+}
+
+/* Free a saved line. */
+static void
+line_free(saved_line_t *l)
+{
+    if (l->data != NULL) {
+	save_bytes -= l->len;
+	Replace(l->data, NULL);
+	l->len = 0;
+    }
+}
+
+/* Discard the oldest saved lines until the memory budget is met. */
+static void
+enforce_budget(void)
+{
+    while (save_budget && save_bytes > save_budget && n_saved > 0) {
+	line_free(&ea_save[(scroll_next + scroll_max - n_saved) % scroll_max]);
+	n_saved--;
+    }
+}
+
+/*
+ * Translate a row of cells to one Unicode value per cell, as Find() sees
+ * them. Field attributes, nulls and the contents of zero-intensity fields
+ * are blanks.
+ */
+static void
+row_text(const struct ea *ea, int cols, bool is_zero, ucs4_t *u)
+{
+    int i;
+
+    for (i = 0; i < cols; i++) {
+	if (ea[i].fa) {
+	    is_zero = FA_IS_ZERO(ea[i].fa);
+	    u[i] = ' ';
+	} else if (is_zero) {
+	    u[i] = ' ';
+	} else if (ea[i].ucs4) {
+	    u[i] = ea[i].ucs4;
+	} else {
+	    u[i] = ebcdic_to_unicode(ea[i].ec, ea[i].cs, EUO_BLANK_UNDEF);
+	    if (!u[i]) {
+		u[i] = ' ';
+	    }
+	}
+    }
+}
+
+/* Compute the two filter bits for the trigram starting at 'u'. */
+static void
+trigram_bits(const ucs4_t *u, int *b1, int *b2)
+{
+    uint32_t h = ((u[0] * 31 + u[1]) * 31 + u[2]) * 0x9e3779b1U;
+
+    *b1 = (h >> 24) % FILTER_BITS;
+    *b2 = (h >> 16) % FILTER_BITS;
+}
+
+/* Compute the trigram filter for 'n' Unicode values. */
+static void
+filter_set(const ucs4_t *u, int n, line_filter_t *f)
+{
+    int i;
+
+    memset(f, 0, sizeof(*f));
+    for (i = 0; i + 3 <= n; i++) {
+	int b1, b2;
+
+	trigram_bits(u + i, &b1, &b2);
+	f->w[b1 / 32] |= 1U << (b1 % 32);
+	f->w[b2 / 32] |= 1U << (b2 % 32);
+    }
+}
+
+/* Test whether every trigram in 'pattern' might be in 'line'. */
+static bool
+filter_match(const line_filter_t *pattern, const line_filter_t *line)
+{
+    int i;
+
+    for (i = 0; i < FILTER_WORDS; i++) {
+	if (pattern->w[i] & ~line->w[i]) {
+	    return false;
+	}
+    }
+    return true;
+}
+
+/*
+ * Save a line of 'cols' cells from 'ea' (NULL for a blank line) at the
+ * head of the scroll ring.
+ */
+static void
+line_save(const struct ea *ea, int cols)
+{
+    saved_line_t *l = &ea_save[scroll_next];
+
+    line_free(l);
+    if (ea != NULL) {
+	memcpy(wide_buf, ea, cols * sizeof(struct ea));
+	if (cols < maxCOLS) {
+	    memcpy(wide_buf + cols, defaults_buf,
+		    (maxCOLS - cols) * sizeof(struct ea));
+	}
+	if (memcmp(wide_buf, defaults_buf, maxCOLS * sizeof(struct ea))) {
+	    l->len = line_compress(wide_buf);
+	    l->data = Malloc(l->len);
+	    memcpy(l->data, line_buf, l->len);
+	    save_bytes += l->len;
+	}
+    }
+    if (l->data != NULL) {
+	row_text(wide_buf, maxCOLS, false, text_buf);
+	filter_set(text_buf, maxCOLS, &l->filter);
+    } else {
+	l->filter = blank_filter;
+    }
+    scroll_next = (scroll_next + 1) % scroll_max;
+    if (n_saved < scroll_max) {
+	n_saved++;
+    }
+    enforce_budget();
+}
+
+/*
+ * Parse the saveMemory resource: a number of bytes, with an optional K or M
+ * suffix. Returns false if it is invalid.
+ */
+static bool
+parse_save_memory(const char *value, size_t *budget)
+{
+    unsigned long l;
+    char *end;
+
+    if (value == NULL || !*value) {
+	*budget = 0;
+	return true;
+    }
+    l = strtoul(value, &end, 10);
+    if (end == value) {
+	return false;
+    }
+    switch (*end) {
+    case 'k':
+    case 'K':
+	l *= 1024;
+	end++;
+	break;
+    case 'm':
+    case 'M':
+	l *= 1024 * 1024;
+	end++;
+	break;
+    default:
+	break;
+    }
+    if (*end != '\0') {
+	return false;
+    }
+    *budget = (size_t)l;
+    return true;
+}
 
 /*
  * Initialize (or re-initialize) the scrolling parameters and save area.
@@ -97,8 +491,17 @@ void
 scroll_buf_init(void)
 {
     register int i;
-    int sa_size;
-    unsigned char *s;
+
+    /* Free the old save area, whose size is the old value of scroll_max. */
+    if (ea_save != NULL) {
+	scroll_free_lines();
+	Free(ea_save);
+	Free(image_save);
+	Free(line_buf);
+	Free(wide_buf);
+	Free(text_buf);
+	Free(defaults_buf);
+    }
 
     /* Set the number of rows to save, as a multiple of maxROWS. */
     scroll_max = appres.interactive.save_lines;
@@ -108,19 +511,15 @@ scroll_buf_init(void)
     if (scroll_max < maxROWS * 5) {
 	scroll_max = maxROWS * 5;
     }
-    if (sbuf != NULL) {
-	Free(sbuf);
-	Free(zbuf);
-	Free(defaults_buf);
-	Free(ea_save);
+    if (!parse_save_memory(appres.interactive.save_memory, &save_budget)) {
+	xs_warning("Invalid %s value, ignoring", ResSaveMemory);
+	save_budget = 0;
     }
-    sa_size = scroll_max + maxROWS;
-    ea_save = (struct ea **)Calloc(sizeof(struct ea *), sa_size);
-    sa_bufsize = (sa_size *
-	    (sizeof(unsigned char) + sizeof(struct ea))) * maxCOLS;
-    sbuf = Malloc(sa_bufsize);
-    zbuf = Malloc(maxCOLS);
-    memset(zbuf, '\0', maxCOLS);
+    ea_save = (saved_line_t *)Calloc(sizeof(saved_line_t), scroll_max);
+    image_save = (struct ea *)Calloc(sizeof(struct ea), maxROWS * maxCOLS);
+    line_buf = Malloc(LINE_MAX_LEN(maxCOLS));
+    wide_buf = (struct ea *)Malloc(maxCOLS * sizeof(struct ea));
+    text_buf = (ucs4_t *)Malloc(maxCOLS * sizeof(ucs4_t));
     defaults_buf = Calloc(maxCOLS, sizeof(struct ea));
     for (i = 0; i < maxCOLS; i++) {
 	/*
@@ -131,10 +530,8 @@ scroll_buf_init(void)
 	defaults_buf[i].bg = HOST_COLOR_BLACK;
 	defaults_buf[i].gr = XAH_INTENSIFY & 0x0f;
     }
-    s = (unsigned char *)sbuf;
-    for (i = 0; i < sa_size; s += (maxCOLS * sizeof(struct ea)), i++) {
-	ea_save[i] = (struct ea *)s;
-    }
+    row_text(defaults_buf, maxCOLS, false, text_buf);
+    filter_set(text_buf, maxCOLS, &blank_filter);
     scroll_reset();
     scroll_initted = true;
 }
@@ -154,13 +551,26 @@ screen_set_thumb_traced(float top, float shown, int saved, int screen,
     screen_set_thumb(top, shown, saved, screen, back);
 }
 
+/* Free all of the saved lines. */
+static void
+scroll_free_lines(void)
+{
+    int i;
+
+    for (i = 0; i < scroll_max; i++) {
+	line_free(&ea_save[i]);
+    }
+    save_bytes = 0;
+}
+
 /*
  * Reset the scrolling parameters and erase the save area.
  */
 static void
 scroll_reset(void)
 {
-    memset(sbuf, 0, sa_bufsize);
+    scroll_free_lines();
+    memset(image_save, 0, maxROWS * maxCOLS * sizeof(struct ea));
     scroll_next = 0;
     n_saved = 0;
     scrolled_back = 0;
@@ -192,32 +602,10 @@ scroll_save(int n)
 
     /* Save the screen contents. */
     for (row = 0; row < n; row++) {
-	if (row < ROWS) {
-	    memmove(ea_save[scroll_next],
-		    ea_buf + (row * COLS),
-		    COLS * sizeof(struct ea));
-	    if (COLS < maxCOLS) {
-		memcpy(ea_save[scroll_next] + COLS, defaults_buf,
-			(maxCOLS - COLS) * sizeof(struct ea));
-	    }
-	} else {
-	    memcpy(ea_save[scroll_next], defaults_buf,
-		    maxCOLS * sizeof(struct ea));
-	}
-	scroll_next = (scroll_next + 1) % scroll_max;
-	if (n_saved < scroll_max) {
-	    n_saved++;
-	}
+	line_save((row < ROWS)? ea_buf + (row * COLS): NULL, COLS);
     }
     if (n == ROWS && n < maxROWS) {
-	for (row = n; row < maxROWS; row++) {
-	    memcpy(ea_save[scroll_next], defaults_buf,
-		    maxCOLS * sizeof(struct ea));
-	}
-	scroll_next = (scroll_next + 1) % scroll_max;
-	if (n_saved < scroll_max) {
-	    n_saved++;
-	}
+	line_save(NULL, 0);
     }
 
     /*
@@ -229,12 +617,7 @@ scroll_save(int n)
 	int pad;
 
 	for (pad = maxROWS - (scroll_next % maxROWS); pad; pad--) {
-	    memcpy(ea_save[scroll_next], defaults_buf,
-		    maxCOLS * sizeof(struct ea));
-	    scroll_next = (scroll_next + 1) % scroll_max;
-	    if (n_saved < scroll_max) {
-		n_saved++;
-	    }
+	    line_save(NULL, 0);
 	}
 
     }
@@ -281,7 +664,7 @@ save_image(void)
 #endif /*]*/
 
     for (i = 0; i < maxROWS; i++) {
-	memmove(ea_save[scroll_max + i],
+	memmove(image_save + (i * maxCOLS),
 		(ea_buf + (i * COLS)), COLS * sizeof(struct ea));
     }
     need_saving = false;
@@ -357,12 +740,11 @@ sync_scroll(int sb)
     /* Update the screen. */
     for (i = 0; i < maxROWS; i++) {
 	if (i < sb) {
-	    memmove((ea_buf + (i * COLS)),
-		    ea_save[(scroll_first + i) % scroll_max],
-		    COLS * sizeof(struct ea));
+	    line_expand(&ea_save[(scroll_first + i) % scroll_max],
+		    ea_buf + (i * COLS), COLS);
 	} else {
 	    memmove((ea_buf + (i * COLS)),
-		    ea_save[scroll_max + i - sb],
+		    image_save + ((i - sb) * maxCOLS),
 		    COLS * sizeof(struct ea));
 	}
     }
@@ -371,6 +753,7 @@ sync_scroll(int sb)
     ctlr_enable_cursor(sb == 0, EC_SCROLL);
 
     scrolled_back = sb;
+    ctlr_invalidate_fa_index();
     ctlr_changed(0, ROWS * COLS);
     blink_start();
 
@@ -526,6 +909,188 @@ Scroll_action(ia_t ia, unsigned argc, const char **argv)
     return true;
 }
 
+/* Find() search state. */
+typedef struct {
+    bool is_regex;		/* true for Find(Regex) */
+#if !defined(_WIN32) /*[*/
+    regex_t re;			/* compiled expression */
+#endif /*]*/
+    ucs4_t *text;		/* literal text */
+    int len;			/* length of literal text */
+    int matches;		/* number of matches */
+} find_t;
+
+/* Report each Find() match in a row of 'cols' Unicode values. */
+static void
+find_row(find_t *f, const ucs4_t *u, int cols, int row)
+{
+    int col;
+
+    if (!f->is_regex) {
+	for (col = 0; col + f->len <= cols; col++) {
+	    if (!memcmp(u + col, f->text, f->len * sizeof(ucs4_t))) {
+		action_output("%d %d", row, col);
+		f->matches++;
+		col += f->len - 1;
+	    }
+	}
+	return;
+    }
+
+#if !defined(_WIN32) /*[*/
+    {
+	varbuf_t r;
+	int *offset = (int *)Malloc((cols + 1) * sizeof(int));
+	const char *buf;
+	size_t pos = 0;
+	size_t blen;
+	regmatch_t m;
+	int eflags = 0;
+
+	/* Translate to multi-byte, remembering where each cell starts. */
+	vb_init(&r);
+	for (col = 0; col < cols; col++) {
+	    char mb[16];
+	    int nmb = unicode_to_multibyte(u[col], mb, sizeof(mb));
+
+	    offset[col] = (int)vb_len(&r);
+	    vb_append(&r, mb, (nmb > 0)? nmb - 1: 0);
+	}
+	offset[cols] = (int)vb_len(&r);
+	buf = vb_buf(&r);
+	blen = vb_len(&r);
+
+	while (pos <= blen &&
+		!regexec(&f->re, buf + pos, 1, &m, eflags)) {
+	    size_t start = pos + m.rm_so;
+
+	    for (col = 0; col < cols && (size_t)offset[col + 1] <= start;
+		    col++) {
+	    }
+	    action_output("%d %d", row, col);
+	    f->matches++;
+	    pos += (m.rm_eo > m.rm_so)? m.rm_eo: m.rm_so + 1;
+	    eflags = REG_NOTBOL;
+	}
+	vb_free(&r);
+	Free(offset);
+    }
+#endif /*]*/
+}
+
+/*
+ * Find(String,text) or Find(Regex,pattern), also Find(text).
+ * Searches the saved lines and the screen for text, reporting each match as
+ * 'row col', 0-origin. Saved lines have negative row numbers: row -n is the
+ * line that Scroll(Set,n) puts at the top of the display. Literal searches
+ * of three or more characters skip saved lines whose trigram filter rules
+ * them out. A match must lie within one row.
+ */
+static bool
+Find_action(ia_t ia, unsigned argc, const char **argv)
+{
+    find_t f;
+    const char *pattern;
+    line_filter_t pf;
+    bool use_filter = false;
+    ucs4_t *u;
+    int back;
+    int row;
+    int skipped = 0;
+
+    action_debug(AnFind, ia, argc, argv);
+    if (check_argc(AnFind, argc, 1, 2) < 0) {
+	return false;
+    }
+
+    memset(&f, 0, sizeof(f));
+    if (argc == 2) {
+	if (!strcasecmp(argv[0], KwRegex)) {
+	    f.is_regex = true;
+	} else if (strcasecmp(argv[0], KwString)) {
+	    return action_args_are(AnFind, KwString, KwRegex, NULL);
+	}
+	pattern = argv[1];
+    } else {
+	pattern = argv[0];
+    }
+    if (!*pattern) {
+	popup_an_error(AnFind "(): Empty search text");
+	return false;
+    }
+
+    if (f.is_regex) {
+#if defined(_WIN32) /*[*/
+	popup_an_error(AnFind "(" KwRegex "): Not supported on this platform");
+	return false;
+#else /*][*/
+	int rv = regcomp(&f.re, pattern, REG_EXTENDED);
+
+	if (rv != 0) {
+	    char errbuf[256];
+
+	    regerror(rv, &f.re, errbuf, sizeof(errbuf));
+	    popup_an_error(AnFind "(" KwRegex "): %s", errbuf);
+	    return false;
+	}
+#endif /*]*/
+    } else {
+	size_t sl = strlen(pattern);
+
+	f.text = (ucs4_t *)Malloc((sl + 1) * sizeof(ucs4_t));
+	f.len = multibyte_to_unicode_string(pattern, sl, f.text, sl + 1,
+		false);
+	if (f.len <= 0) {
+	    Free(f.text);
+	    popup_an_error(AnFind "(): Invalid search text");
+	    return false;
+	}
+	if (f.len >= 3) {
+	    filter_set(f.text, f.len, &pf);
+	    use_filter = true;
+	}
+    }
+
+    /* Search from the bottom of the scroll buffer. */
+    scroll_to_bottom();
+
+    /* Search the saved lines, oldest first. */
+    if (scroll_initted) {
+	for (back = n_saved; back > 0; back--) {
+	    saved_line_t *l =
+		&ea_save[(scroll_next + scroll_max - back) % scroll_max];
+
+	    if (use_filter && !filter_match(&pf, &l->filter)) {
+		skipped++;
+		continue;
+	    }
+	    line_expand(l, wide_buf, maxCOLS);
+	    row_text(wide_buf, maxCOLS, false, text_buf);
+	    find_row(&f, text_buf, maxCOLS, -back);
+	}
+    }
+
+    /* Search the screen. */
+    u = (ucs4_t *)Malloc(COLS * sizeof(ucs4_t));
+    for (row = 0; row < ROWS; row++) {
+	row_text(ea_buf + (row * COLS), COLS,
+		FA_IS_ZERO(get_field_attribute(row * COLS)), u);
+	find_row(&f, u, COLS, row);
+    }
+    Free(u);
+
+    vtrace(AnFind ": %d match%s, %d of %d saved lines skipped\n",
+	    f.matches, (f.matches == 1)? "": "es", skipped,
+	    scroll_initted? n_saved: 0);
+#if !defined(_WIN32) /*[*/
+    if (f.is_regex) {
+	regfree(&f.re);
+    }
+#endif /*]*/
+    Replace(f.text, NULL);
+    return true;
+}
+
 /*
  * Toggle the length of the scrollback buffer.
  */
@@ -552,6 +1117,34 @@ toggle_save_lines(const char *name _is_unused, const char *value)
     return true;
 }
 
+/*
+ * Toggle the memory limit for the scrollback buffer.
+ */
+static bool
+toggle_save_memory(const char *name _is_unused, const char *value)
+{
+    size_t budget;
+
+    if (!parse_save_memory(value, &budget)) {
+	popup_an_error("Invalid %s value", ResSaveMemory);
+	return false;
+    }
+    Replace(appres.interactive.save_memory, *value? NewString(value): NULL);
+    save_budget = budget;
+
+    /* Trim the saved lines to fit. */
+    if (scrolled_back) {
+	sync_scroll(0);
+    }
+    enforce_budget();
+    thumb_top_base = thumb_top =
+	((float)n_saved / (float)(scroll_max + maxROWS));
+    thumb_shown = (float)(1.0 - thumb_top);
+    screen_set_thumb_traced(thumb_top, thumb_shown, n_saved, maxROWS,
+	    scrolled_back);
+    return true;
+}
+
 /*
  * Called when a host connects, disconnects or changes NVT/3270 modes.
  */
@@ -565,6 +1158,56 @@ scroll_connect(bool ignored _is_unused)
     }
 }
 
+/*
+ * Hibernate: pack the screen image and free the scratch buffers. The saved
+ * lines are already compressed.
+ */
+static void
+scroll_sleep(varbuf_t *blob)
+{
+    unsigned char initted = scroll_initted;
+
+    vb_append(blob, (char *)&initted, 1);
+    if (!scroll_initted) {
+	return;
+    }
+    hib_pack(blob, image_save, sizeof(struct ea), maxROWS * maxCOLS);
+    Replace(image_save, NULL);
+    Replace(line_buf, NULL);
+    Replace(wide_buf, NULL);
+    Replace(text_buf, NULL);
+}
+
+/*
+ * Wake from hibernation: restore the screen image and scratch buffers.
+ */
+static void
+scroll_wake(const unsigned char *blob)
+{
+    if (!*blob++) {
+	return;
+    }
+    image_save = (struct ea *)Malloc(maxROWS * maxCOLS * sizeof(struct ea));
+    hib_unpack(blob, image_save, sizeof(struct ea), maxROWS * maxCOLS);
+    line_buf = Malloc(LINE_MAX_LEN(maxCOLS));
+    wide_buf = (struct ea *)Malloc(maxCOLS * sizeof(struct ea));
+    text_buf = (ucs4_t *)Malloc(maxCOLS * sizeof(ucs4_t));
+}
+
+/* Footprint of the saved lines and their scratch buffers. */
+static size_t
+scroll_footprint(void)
+{
+    if (ea_save == NULL) {
+	return 0;
+    }
+    return (scroll_max * sizeof(saved_line_t)) + save_bytes +
+	((image_save != NULL)? maxROWS * maxCOLS * sizeof(struct ea): 0) +
+	LINE_MAX_LEN(maxCOLS) +
+	(maxCOLS * (sizeof(struct ea) + sizeof(ucs4_t))) +
+	((defaults_buf != NULL)? maxCOLS * sizeof(struct ea): 0);
+}
+
 /**
  * Scrollbar module registration.
  */
@@ -572,8 +1215,12 @@ void
 scroll_register(void)
 {
     static action_table_t scroll_actions[] = {
+	{ AnFind,		Find_action,	ACTION_KE },
 	{ AnScroll,		Scroll_action,	ACTION_KE }
     };
+    static footprint_t footprints[] = {
+	{ "scrollback",		scroll_footprint,	false }
+    };
 
     /* Register the actions. */
     register_actions(scroll_actions, array_count(scroll_actions));
@@ -581,8 +1228,16 @@ scroll_register(void)
     /* Register the toggles. */
     register_extended_toggle(ResSaveLines, toggle_save_lines, NULL, NULL,
 	    (void **)&appres.interactive.save_lines, XRM_INT);
+    register_extended_toggle(ResSaveMemory, toggle_save_memory, NULL, NULL,
+	    (void **)&appres.interactive.save_memory, XRM_STRING);
 
     /* Register the state change callbacks. */
     register_schange(ST_CONNECT, scroll_connect);
     register_schange(ST_3270_MODE, scroll_connect);
+
+    /* Register the hibernation functions. */
+    register_hibernator(scroll_sleep, scroll_wake);
+
+    /* Register the buffer size. */
+    register_footprints(footprints, array_count(footprints));
 }
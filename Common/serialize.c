@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *	serialize.c
+ *		Streaming XML and JSON output.
+ *
+ * These append straight into a varbuf. Escaping is table-driven: each byte
+ * either stands for itself or has a replacement, and runs of bytes that
+ * stand for themselves are copied in one piece, so a string that needs no
+ * escaping costs a scan and a single copy.
+ */
+
+#include "globals.h"
+
+#include "b3270proto.h"
+#include "resources.h"
+#include "varbuf.h"	/* must precede serialize.h */
+#include "serialize.h"
+
+/* Replacement text for each byte, or NULL if it stands for itself. */
+static const char *xml_esc[256];
+static const char *json_esc[256];
+static bool esc_initted = false;
+
+/* Control characters in JSON, as \u escapes. */
+static char json_ctrl[' '][7];
+
+/* Set up the escape tables. */
+static void
+esc_init(void)
+{
+    int c;
+
+    /*
+     * XML 1.0 understands tabs, newlines and carriage returns, but no
+     * other control characters. Those, and DEL, become spaces.
+     */
+    for (c = 0; c < ' '; c++) {
+	xml_esc[c] = " ";
+    }
+    xml_esc['\t'] = "&#9;";
+    xml_esc['\n'] = "&#10;";
+    xml_esc['\r'] = "&#13;";
+    xml_esc[0x7f] = " ";
+    xml_esc['<'] = "&lt;";
+    xml_esc['>'] = "&gt;";
+    xml_esc['"'] = "&quot;";
+    xml_esc['&'] = "&amp;";
+    xml_esc['\''] = "&apos;";
+
+    for (c = 0; c < ' '; c++) {
+	snprintf(json_ctrl[c], sizeof(json_ctrl[c]), "\\u%04x", c);
+	json_esc[c] = json_ctrl[c];
+    }
+    json_esc['"'] = "\\\"";
+    json_esc['\\'] = "\\\\";
+    json_esc['\r'] = "\\r";
+    json_esc['\n'] = "\\n";
+    json_esc['\t'] = "\\t";
+    json_esc['\f'] = "\\f";
+
+    esc_initted = true;
+}
+
+/* Append text, escaped through a table. */
+static void
+esc_append(varbuf_t *r, const char *s, size_t len, const char **esc)
+{
+    size_t start = 0;
+    size_t i;
+
+    if (!esc_initted) {
+	esc_init();
+    }
+    for (i = 0; i < len; i++) {
+	const char *e = esc[(unsigned char)s[i]];
+
+	if (e != NULL) {
+	    if (i > start) {
+		vb_append(r, s + start, i - start);
+	    }
+	    vb_appends(r, e);
+	    start = i + 1;
+	}
+    }
+    if (i > start) {
+	vb_append(r, s + start, i - start);
+    }
+}
+
+/**
+ * Append text, escaped for an XML attribute value.
+ *
+ * @param[in,out] r	buffer
+ * @param[in] s		text
+ * @param[in] len	length of text
+ */
+void
+ser_xml_text(varbuf_t *r, const char *s, size_t len)
+{
+    esc_append(r, s, len, xml_esc);
+}
+
+/**
+ * Append text, escaped for the inside of a JSON string.
+ *
+ * @param[in,out] r	buffer
+ * @param[in] s		text
+ * @param[in] len	length of text
+ */
+void
+ser_json_text(varbuf_t *r, const char *s, size_t len)
+{
+    esc_append(r, s, len, json_esc);
+}
+
+/**
+ * Format a decimal integer.
+ *
+ * @param[out] buf	buffer, at least 21 bytes
+ * @param[in] value	value
+ *
+ * @return Length of the text, which is also NUL-terminated
+ */
+size_t
+ser_int(char *buf, long value)
+{
+    char tmp[20];
+    unsigned long u = (value < 0)? -(unsigned long)value: (unsigned long)value;
+    size_t n = 0;
+    size_t len = 0;
+
+    do {
+	tmp[n++] = '0' + (char)(u % 10);
+	u /= 10;
+    } while (u);
+    if (value < 0) {
+	buf[len++] = '-';
+    }
+    while (n) {
+	buf[len++] = tmp[--n];
+    }
+    buf[len] = '\0';
+    return len;
+}
+
+/* Append the start of an attribute: ' name="'. */
+static void
+attr_start(varbuf_t *r, const char *name)
+{
+    vb_append(r, " ", 1);
+    vb_appends(r, name);
+    vb_append(r, "=\"", 2);
+}
+
+/**
+ * Append an XML attribute, escaping its value.
+ *
+ * @param[in,out] r	buffer
+ * @param[in] name	attribute name
+ * @param[in] value	attribute value
+ */
+void
+ser_xml_attr(varbuf_t *r, const char *name, const char *value)
+{
+    attr_start(r, name);
+    ser_xml_text(r, value, strlen(value));
+    vb_append(r, "\"", 1);
+}
+
+/**
+ * Append an XML attribute whose value is known not to need escaping, such
+ * as a keyword from a table.
+ *
+ * @param[in,out] r	buffer
+ * @param[in] name	attribute name
+ * @param[in] value	attribute value
+ */
+void
+ser_xml_attr_static(varbuf_t *r, const char *name, const char *value)
+{
+    attr_start(r, name);
+    vb_appends(r, value);
+    vb_append(r, "\"", 1);
+}
+
+/**
+ * Append an integer XML attribute.
+ *
+ * @param[in,out] r	buffer
+ * @param[in] name	attribute name
+ * @param[in] value	attribute value
+ */
+void
+ser_xml_attr_int(varbuf_t *r, const char *name, long value)
+{
+    char buf[21];
+    size_t len = ser_int(buf, value);
+
+    attr_start(r, name);
+    vb_append(r, buf, len);
+    vb_append(r, "\"", 1);
+}
+
+/**
+ * Append a Boolean XML attribute.
+ *
+ * @param[in,out] r	buffer
+ * @param[in] name	attribute name
+ * @param[in] value	attribute value
+ */
+void
+ser_xml_attr_bool(varbuf_t *r, const char *name, bool value)
+{
+    ser_xml_attr_static(r, name, ValTrueFalse(value));
+}
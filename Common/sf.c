@@ -41,6 +41,7 @@
 
 #include "codepage.h"
 #include "ctlrc.h"
+#include "ft.h"
 #include "ft_dft.h"
 #include "ft_private.h"
 #include "kybd.h"
@@ -49,7 +50,9 @@
 #include "screen.h"
 #include "see.h"
 #include "telnet_core.h"
+#include "toggles.h"
 #include "trace.h"
+#include "utils.h"
 
 #define SW_3279_2	0x09
 #define SH_3279_2	0x0c
@@ -58,6 +61,9 @@
 
 /* Statics */
 static bool  qr_in_progress = false;
+static unsigned char *qr_cache = NULL;	/* encoded full Query Reply */
+static size_t qr_cache_len = 0;
+static int qr_cache_dft_size = 0;	/* DFT buffer size it was built with */
 static enum pds sf_read_part(unsigned char buf[], unsigned buflen);
 static enum pds sf_erase_reset(unsigned char buf[], int buflen);
 static enum pds sf_set_reply_mode(unsigned char buf[], int buflen);
@@ -66,6 +72,7 @@ static enum pds sf_outbound_ds(unsigned char buf[], int buflen);
 static void query_reply_start(void);
 static void do_query_reply(unsigned char code);
 static void query_reply_end(void);
+static void query_reply_all(void);
 
 typedef bool qr_multi_fn_t(unsigned *subindex, bool *more);
 
@@ -230,13 +237,7 @@ sf_read_part(unsigned char buf[], unsigned buflen)
 			return PDS_BAD_CMD;
 		}
 		trace_ds("\n");
-		query_reply_start();
-		for (i = 0; i < NSR; i++) {
-			if (dbcs || replies[i].code != QR_DBCS_ASIA) {
-				do_query_reply(replies[i].code);
-			}
-		}
- 		query_reply_end();
+		query_reply_all();
 		break;
 	    case SF_RP_QLIST:
 		trace_ds(" QueryList ");
@@ -248,10 +249,10 @@ sf_read_part(unsigned char buf[], unsigned buflen)
 			trace_ds("error: missing request type\n");
 			return PDS_BAD_CMD;
 		}
-		query_reply_start();
 		switch (buf[5]) {
 		    case SF_RPQ_LIST:
 			trace_ds("List(");
+			query_reply_start();
 			if (buflen < 7) {
 				trace_ds(")\n");
 				do_query_reply(QR_NULL);
@@ -285,18 +286,12 @@ sf_read_part(unsigned char buf[], unsigned buflen)
 				comma = ",";
 			}
 			trace_ds(")\n");
-			for (i = 0; i < NSR; i++)
-				if (dbcs || replies[i].code != QR_DBCS_ASIA) {
-					do_query_reply(replies[i].code);
-				}
-			break;
+			query_reply_all();
+			return PDS_OKAY_OUTPUT;
 		    case SF_RPQ_ALL:
 			trace_ds("All\n");
-			for (i = 0; i < NSR; i++)
-				if (dbcs || replies[i].code != QR_DBCS_ASIA) {
-					do_query_reply(replies[i].code);
-				}
-			break;
+			query_reply_all();
+			return PDS_OKAY_OUTPUT;
 		    default:
 			trace_ds("unknown request type 0x%02x\n", buf[5]);
 			return PDS_BAD_CMD;
@@ -659,6 +654,61 @@ do_query_reply(unsigned char code)
 	} while (more);
 }
 
+/* Compute the DFT buffer size reported in the DDM query reply. */
+static int
+qr_ddm_size(void)
+{
+    return (ftc != NULL && ft_state != FT_NONE)? ftc->dft_buffersize:
+	set_dft_buffersize(0);
+}
+
+/* Discard the cached Query Reply. */
+static void
+qr_cache_invalidate(bool ignored _is_unused)
+{
+    Replace(qr_cache, NULL);
+    qr_cache_len = 0;
+}
+
+/*
+ * Send a reply to Query, QueryList(All) or QueryList(Equivalent).
+ *
+ * The encoded reply depends only on the model, the code page, the DFT
+ * buffer size and the connection (for RPQNames), so it is built once and
+ * then sent from the cache. It is rebuilt when tracing, so the trace still
+ * shows each reply.
+ */
+static void
+query_reply_all(void)
+{
+    unsigned i;
+
+    if (qr_cache != NULL && qr_cache_dft_size == qr_ddm_size() &&
+	    !toggled(TRACING)) {
+	obptr = obuf;
+	space3270out(qr_cache_len);
+	memcpy(obptr, qr_cache, qr_cache_len);
+	obptr += qr_cache_len;
+	query_reply_end();
+	return;
+    }
+
+    query_reply_start();
+    for (i = 0; i < NSR; i++) {
+	if (dbcs || replies[i].code != QR_DBCS_ASIA) {
+	    do_query_reply(replies[i].code);
+	}
+    }
+
+    /* Save it for next time. */
+    qr_cache_len = obptr - obuf;
+    qr_cache = Realloc(qr_cache, qr_cache_len);
+    memcpy(qr_cache, obuf, qr_cache_len);
+    qr_cache_dft_size = qr_ddm_size();
+
+    query_reply_end();
+}
+
 static void
 do_qr_null(void)
 {
@@ -864,13 +914,7 @@ do_qr_charsets(void)
 static void
 do_qr_ddm(void)
 {
-	int size;
-
-	if (ftc != NULL) {
-	    size = ftc->dft_buffersize;
-	} else {
-	    size = set_dft_buffersize(0);
-	}
+	int size = qr_ddm_size();
 
 	trace_ds("> QueryReply(DistributedDataManagement INLIM/OUTLIM=%d)\n",
 		size);
@@ -903,3 +947,15 @@ query_reply_end(void)
 	net_output();
 	kybd_inhibit(true);
 }
+
+/**
+ * Structured field module registration.
+ */
+void
+sf_register(void)
+{
+    /* The cached Query Reply depends on all of these. */
+    register_schange(ST_REMODEL, qr_cache_invalidate);
+    register_schange(ST_CODEPAGE, qr_cache_invalidate);
+    register_schange(ST_CONNECT, qr_cache_invalidate);
+}
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *	sha1.c
+ *		SHA-1 message digest (RFC 3174), used for the WebSocket
+ *		handshake.
+ */
+
+#include "globals.h"
+
+#include "sha1.h"
+
+#define ROL(x, n)	(((x) << (n)) | ((x) >> (32 - (n))))
+
+/*
+ * Process one 64-byte block.
+ */
+static void
+sha1_block(uint32_t h[5], const unsigned char *p)
+{
+    uint32_t w[80];
+    uint32_t a, b, c, d, e, f, k, t;
+    int i;
+
+    for (i = 0; i < 16; i++) {
+	w[i] = ((uint32_t)p[i * 4] << 24) | ((uint32_t)p[i * 4 + 1] << 16) |
+	    ((uint32_t)p[i * 4 + 2] << 8) | p[i * 4 + 3];
+    }
+    for (; i < 80; i++) {
+	w[i] = ROL(w[i - 3] ^ w[i - 8] ^ w[i - 14] ^ w[i - 16], 1);
+    }
+
+    a = h[0];
+    b = h[1];
+    c = h[2];
+    d = h[3];
+    e = h[4];
+    for (i = 0; i < 80; i++) {
+	if (i < 20) {
+	    f = (b & c) | (~b & d);
+	    k = 0x5a827999;
+	} else if (i < 40) {
+	    f = b ^ c ^ d;
+	    k = 0x6ed9eba1;
+	} else if (i < 60) {
+	    f = (b & c) | (b & d) | (c & d);
+	    k = 0x8f1bbcdc;
+	} else {
+	    f = b ^ c ^ d;
+	    k = 0xca62c1d6;
+	}
+	t = ROL(a, 5) + f + e + k + w[i];
+	e = d;
+	d = c;
+	c = ROL(b, 30);
+	b = a;
+	a = t;
+    }
+    h[0] += a;
+    h[1] += b;
+    h[2] += c;
+    h[3] += d;
+    h[4] += e;
+}
+
+/*
+ * Compute the SHA-1 digest of a buffer.
+ */
+void
+sha1(const unsigned char *data, size_t len, unsigned char digest[SHA1_LEN])
+{
+    uint32_t h[5] = {
+	0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476, 0xc3d2e1f0
+    };
+    unsigned char tail[128];
+    size_t tail_len;
+    unsigned long long bits = (unsigned long long)len * 8;
+    size_t i;
+
+    /* Process the whole blocks. */
+    for (i = 0; i + 64 <= len; i += 64) {
+	sha1_block(h, data + i);
+    }
+
+    /* Pad the rest, then append the length in bits. */
+    tail_len = len - i;
+    memcpy(tail, data + i, tail_len);
+    tail[tail_len++] = 0x80;
+    while (tail_len % 64 != 56) {
+	tail[tail_len++] = 0;
+    }
+    for (i = 0; i < 8; i++) {
+	tail[tail_len++] = (unsigned char)(bits >> (56 - (i * 8)));
+    }
+    for (i = 0; i < tail_len; i += 64) {
+	sha1_block(h, tail + i);
+    }
+
+    for (i = 0; i < SHA1_LEN; i++) {
+	digest[i] = (unsigned char)(h[i / 4] >> (24 - ((i % 4) * 8)));
+    }
+}
@@ -0,0 +1,471 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *	shmexport.c
+ *		Shared-memory presentation space export.
+ *
+ * When the shmExport resource names a file, the screen is copied into a
+ * memory mapping of it, so local programs can read it without going through
+ * the scripting interface. Only the rows whose generation has moved on since
+ * the last export are copied again, and each update is described by events
+ * in a ring that follows the screen. The layout is described in shmexport.h.
+ */
+
+#include "globals.h"
+
+#if !defined(_WIN32) /*[*/
+# include <sys/mman.h>
+# include <errno.h>
+# include <fcntl.h>
+#endif /*]*/
+
+#include "3270ds.h"
+#include "appres.h"
+#include "ctlr.h"
+#include "ctlrc.h"
+#include "kybd.h"
+#include "nvt.h"
+#include "popups.h"
+#include "resources.h"
+#include "shmexport.h"
+#include "toggles.h"
+#include "trace.h"
+#include "unicodec.h"
+#include "utils.h"
+
+#define RING_SLOTS	1024		/* events in the ring, a power of 2 */
+
+#if defined(_WIN32) /*[*/
+# include "w3misc.h"
+
+# define BARRIER()	MemoryBarrier()
+#else /*][*/
+# define BARRIER()	__sync_synchronize()
+#endif /*]*/
+
+static shmx_header_t *shmx = NULL;	/* the mapping */
+static shmx_cell_t *shmx_cells;		/* cell array in the mapping */
+static shmx_event_t *shmx_ring;		/* event ring in the mapping */
+static unsigned char *shmx_rows = NULL;	/* rows copied by this update */
+static size_t shmx_size;		/* size of the mapping */
+static char *shmx_path = NULL;		/* file that is mapped */
+#if defined(_WIN32) /*[*/
+static HANDLE shmx_fh = INVALID_HANDLE_VALUE;
+static HANDLE shmx_mh = NULL;
+#else /*][*/
+static int shmx_fd = -1;
+#endif /*]*/
+static bool shmx_full = true;		/* next update must copy everything */
+static unsigned long shmx_gen;		/* screen_generation at last update */
+static bool shmx_started = false;	/* resource has been looked at */
+
+/* Unmap and remove the export file. */
+static void
+shmx_close(void)
+{
+    if (shmx == NULL) {
+	return;
+    }
+#if defined(_WIN32) /*[*/
+    UnmapViewOfFile(shmx);
+    CloseHandle(shmx_mh);
+    CloseHandle(shmx_fh);
+    shmx_mh = NULL;
+    shmx_fh = INVALID_HANDLE_VALUE;
+    DeleteFile(shmx_path);
+#else /*][*/
+    munmap(shmx, shmx_size);
+    close(shmx_fd);
+    shmx_fd = -1;
+    unlink(shmx_path);
+#endif /*]*/
+    vtrace("shmExport: stopped exporting to %s\n", shmx_path);
+    shmx = NULL;
+    Replace(shmx_path, NULL);
+    Replace(shmx_rows, NULL);
+}
+
+/*
+ * Create and map the export file.
+ * Returns true for success, false for failure.
+ */
+static bool
+shmx_open(const char *path)
+{
+    void *p;
+
+    shmx_size = sizeof(shmx_header_t) +
+	(maxROWS * maxCOLS * sizeof(shmx_cell_t)) +
+	(RING_SLOTS * sizeof(shmx_event_t));
+#if defined(_WIN32) /*[*/
+    shmx_fh = CreateFile(path, GENERIC_READ | GENERIC_WRITE,
+	    FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, NULL,
+	    CREATE_ALWAYS, FILE_ATTRIBUTE_TEMPORARY, NULL);
+    if (shmx_fh == INVALID_HANDLE_VALUE) {
+	popup_an_error("%s: %s: %s", ResShmExport, path,
+		win32_strerror(GetLastError()));
+	return false;
+    }
+    shmx_mh = CreateFileMapping(shmx_fh, NULL, PAGE_READWRITE, 0,
+	    (DWORD)shmx_size, NULL);
+    if (shmx_mh == NULL ||
+	    (p = MapViewOfFile(shmx_mh, FILE_MAP_WRITE, 0, 0, shmx_size))
+		== NULL) {
+	popup_an_error("%s: %s: %s", ResShmExport, path,
+		win32_strerror(GetLastError()));
+	if (shmx_mh != NULL) {
+	    CloseHandle(shmx_mh);
+	    shmx_mh = NULL;
+	}
+	CloseHandle(shmx_fh);
+	shmx_fh = INVALID_HANDLE_VALUE;
+	DeleteFile(path);
+	return false;
+    }
+#else /*][*/
+    shmx_fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    if (shmx_fd < 0) {
+	popup_an_errno(errno, "%s: %s", ResShmExport, path);
+	return false;
+    }
+    if (ftruncate(shmx_fd, (off_t)shmx_size) < 0 ||
+	    (p = mmap(NULL, shmx_size, PROT_READ | PROT_WRITE, MAP_SHARED,
+		      shmx_fd, 0)) == MAP_FAILED) {
+	popup_an_errno(errno, "%s: %s", ResShmExport, path);
+	close(shmx_fd);
+	shmx_fd = -1;
+	unlink(path);
+	return false;
+    }
+#endif /*]*/
+
+    shmx = (shmx_header_t *)p;
+    shmx_cells = (shmx_cell_t *)(shmx + 1);
+    shmx_ring = (shmx_event_t *)(shmx_cells + (maxROWS * maxCOLS));
+    memset(shmx, 0, shmx_size);
+    memcpy(shmx->magic, SHMX_MAGIC, sizeof(shmx->magic));
+    shmx->version = SHMX_VERSION;
+    shmx->header_size = sizeof(shmx_header_t);
+    shmx->cell_size = sizeof(shmx_cell_t);
+    shmx->max_rows = maxROWS;
+    shmx->max_cols = maxCOLS;
+    shmx->ring_offset = (uint32_t)((char *)shmx_ring - (char *)shmx);
+    shmx->ring_slots = RING_SLOTS;
+    shmx->event_size = sizeof(shmx_event_t);
+    Replace(shmx_rows, (unsigned char *)Calloc(maxROWS, 1));
+    shmx_path = NewString(path);
+    shmx_full = true;
+    vtrace("shmExport: exporting to %s\n", path);
+    shmexport_update();
+    return true;
+}
+
+/*
+ * Export one row of the screen.
+ * *is_zero tracks whether the field it is in is non-display.
+ * Returns true if the row contains a field attribute, or did before.
+ */
+static bool
+export_row(int row, bool *is_zero)
+{
+    int baddr = row * COLS;
+    int end = baddr + COLS;
+    bool any_fa = false;
+    shmx_cell_t *c = &shmx_cells[baddr];
+
+    shmx_rows[row] = 1;
+    for (; baddr < end; baddr++, c++) {
+	struct ea *ea = &ea_buf[baddr];
+	enum dbcs_state d = ctlr_dbcs_state(baddr);
+	ucs4_t uc;
+
+	if (c->flags & SHMX_CELL_FA) {
+	    any_fa = true;
+	}
+	c->ec = ea->ec;
+	c->fa = ea->fa;
+	c->fg = ea->fg;
+	c->bg = ea->bg;
+	c->gr = ea->gr;
+	c->cs = ea->cs;
+	c->flags = 0;
+	if (IS_LEFT(d)) {
+	    c->flags |= SHMX_CELL_LEFT;
+	} else if (IS_RIGHT(d)) {
+	    c->flags |= SHMX_CELL_RIGHT;
+	}
+
+	if (ea->fa) {
+	    any_fa = true;
+	    *is_zero = FA_IS_ZERO(ea->fa);
+	    c->flags |= SHMX_CELL_FA;
+	    c->ucs4 = ' ';
+	} else if (*is_zero) {
+	    c->flags |= SHMX_CELL_HIDDEN;
+	    c->ucs4 = ' ';
+	} else if (IS_RIGHT(d)) {
+	    c->ucs4 = 0;
+	} else if (is_nvt(ea, false, &uc)) {
+	    c->ucs4 = uc;
+	} else if (IS_LEFT(d) && baddr + 1 < ROWS * COLS) {
+	    uc = ebcdic_to_unicode((ea->ec << 8) | ea_buf[baddr + 1].ec,
+		    CS_BASE, EUO_NONE);
+	    c->ucs4 = uc? uc: 0x3000;
+	} else {
+	    uc = ebcdic_to_unicode(ea->ec, ea->cs, EUO_BLANK_UNDEF);
+	    c->ucs4 = uc? uc: ' ';
+	}
+    }
+    return any_fa;
+}
+
+/* Publish an event. */
+static void
+publish(uint32_t type, uint32_t arg1, uint32_t arg2)
+{
+    uint32_t n = shmx->ring_next;
+    shmx_event_t *e = &shmx_ring[n & (RING_SLOTS - 1)];
+
+    e->begin = n;
+    BARRIER();
+    e->type = type;
+    e->arg1 = arg1;
+    e->arg2 = arg2;
+    BARRIER();
+    e->end = n;
+    shmx->ring_next = n + 1;
+}
+
+/* Publish the runs of rows copied by this update. */
+static void
+publish_rows(void)
+{
+    int row;
+
+    for (row = 0; row < ROWS; row++) {
+	int first = row;
+
+	while (row < ROWS && shmx_rows[row]) {
+	    shmx_rows[row++] = 0;
+	}
+	if (row > first) {
+	    publish(SHMX_EV_ROWS, first, row - first);
+	}
+    }
+}
+
+/*
+ * Copy the rows that have changed since the last update, and the rows
+ * after them that are in the same field, so that adding or removing a
+ * field attribute is reflected in the text that depends on it.
+ */
+static void
+export_rows(void)
+{
+    int row;
+    bool carry = false;
+    bool is_zero = false;
+
+    for (row = 0; row < ROWS; row++) {
+	bool stale = shmx_full || ctlr_row_generation(row) > shmx_gen;
+
+	if (stale || carry) {
+	    bool any_fa;
+
+	    if (!carry) {
+		is_zero = formatted &&
+		    FA_IS_ZERO(get_field_attribute(row * COLS));
+	    }
+	    any_fa = export_row(row, &is_zero);
+	    if (stale) {
+		carry = carry || any_fa;
+	    } else if (any_fa) {
+		carry = false;
+	    }
+	}
+    }
+
+    /* A changed last field wraps around to the top of the screen. */
+    for (row = 0; carry && row < ROWS; row++) {
+	carry = !export_row(row, &is_zero);
+    }
+}
+
+/*
+ * Update the exported screen, if anything has changed.
+ * Called from the event loop.
+ */
+void
+shmexport_update(void)
+{
+    uint32_t flags = 0;
+    bool size_changed, cursor_changed, lock_changed, state_changed;
+
+    /* Pick up a resource set at start-up. */
+    if (!shmx_started) {
+	shmx_started = true;
+	if (appres.shm_export != NULL && *appres.shm_export &&
+		!shmx_open(appres.shm_export)) {
+	    appres.shm_export = NULL;
+	}
+    }
+
+    if (shmx == NULL) {
+	return;
+    }
+
+    /* A model change means a different size of mapping. */
+    if (shmx->max_rows != (uint32_t)maxROWS ||
+	    shmx->max_cols != (uint32_t)maxCOLS) {
+	char *path = NewString(shmx_path);
+
+	shmx_close();
+	if (!shmx_open(path)) {
+	    Replace(appres.shm_export, NULL);
+	}
+	Free(path);
+	return;
+    }
+
+    if (CONNECTED) {
+	flags |= SHMX_CONNECTED;
+    }
+    if (IN_3270) {
+	flags |= SHMX_3270;
+    }
+    if (IN_NVT) {
+	flags |= SHMX_NVT;
+    }
+    if (formatted) {
+	flags |= SHMX_FORMATTED;
+    }
+    if (shmx_full ||
+	    (uint32_t)ROWS != shmx->rows || (uint32_t)COLS != shmx->cols) {
+	shmx_full = true;
+    } else if (shmx_gen == screen_generation &&
+	    shmx->cursor == (uint32_t)cursor_addr &&
+	    shmx->kybdlock == kybdlock &&
+	    shmx->flags == flags) {
+	return;
+    }
+
+    /* Remember what the events need to report. */
+    size_changed = shmx->rows != (uint32_t)ROWS ||
+	shmx->cols != (uint32_t)COLS;
+    cursor_changed = shmx->cursor != (uint32_t)cursor_addr;
+    lock_changed = shmx->kybdlock != kybdlock;
+    state_changed = shmx->flags != flags;
+
+    shmx->seq++;
+    BARRIER();
+    shmx->rows = ROWS;
+    shmx->cols = COLS;
+    shmx->cursor = cursor_addr;
+    shmx->kybdlock = kybdlock;
+    shmx->flags = flags;
+    shmx->generation = screen_generation;
+    export_rows();
+    BARRIER();
+    shmx->seq++;
+
+    /* Describe the update, now that the screen is consistent. */
+    if (size_changed) {
+	publish(SHMX_EV_SIZE, ROWS, COLS);
+    }
+    if (state_changed) {
+	publish(SHMX_EV_STATE, flags, 0);
+    }
+    publish_rows();
+    if (cursor_changed) {
+	publish(SHMX_EV_CURSOR, cursor_addr, 0);
+    }
+    if (lock_changed) {
+	publish(SHMX_EV_KYBDLOCK, kybdlock, 0);
+    }
+
+    shmx_gen = screen_generation;
+    shmx_full = false;
+}
+
+/* The code page changed, so the characters did too. */
+static void
+shmx_codepage(bool ignored _is_unused)
+{
+    shmx_full = true;
+}
+
+/* The emulator is exiting. */
+static void
+shmx_exiting(bool ignored _is_unused)
+{
+    shmx_close();
+}
+
+/**
+ * Return the name of the file the screen is being exported to.
+ *
+ * @return File name, or NULL if the screen is not being exported
+ */
+const char *
+shmexport_path(void)
+{
+    if (!shmx_started) {
+	/* Pick up the resource now, rather than at the next update. */
+	shmexport_update();
+    }
+    return shmx_path;
+}
+
+/* The shmExport resource changed. */
+static bool
+toggle_shm_export(const char *name _is_unused, const char *value)
+{
+    shmx_started = true;
+    shmx_close();
+    Replace(appres.shm_export, NULL);
+    if (!*value) {
+	return true;
+    }
+    if (!shmx_open(value)) {
+	return false;
+    }
+    appres.shm_export = NewString(value);
+    return true;
+}
+
+/*
+ * Shared-memory export module registration.
+ */
+void
+shmexport_register(void)
+{
+    register_extended_toggle(ResShmExport, toggle_shm_export, NULL, NULL,
+	    (void **)&appres.shm_export, XRM_STRING);
+    register_schange(ST_CODEPAGE, shmx_codepage);
+    register_schange(ST_EXITING, shmx_exiting);
+}
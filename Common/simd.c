@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	simd.c
+ *		Byte-scanning kernels with run-time CPU dispatch.
+ *
+ * Each kernel finds the length of a run of bytes in some class at the start
+ * of a buffer. There is a portable version that checks eight bytes at a
+ * time, plus SSE2 and AVX2 versions on x86 and a NEON version on arm64.
+ * The best version the compiler and CPU support is chosen the first time a
+ * kernel is used, so one binary runs on any CPU of its architecture.
+ *
+ * The kernels are:
+ *   ascii-run		7-bit ASCII other than NUL (UTF-8 input)
+ *   printable-run	' ' through '~' (NVT host output)
+ *
+ * Scanning for IACs and comparing rows use memchr() and memcmp(), which
+ * the C library already dispatches on the CPU.
+ */
+
+#include "globals.h"
+
+#include "simd.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) /*[*/
+# define SIMD_X86_GNUC	1
+#endif /*]*/
+#if defined(__SSE2__) || defined(_M_X64) || \
+	(defined(_M_IX86_FP) && _M_IX86_FP >= 2) /*[*/
+# define SIMD_SSE2	1
+# include <emmintrin.h>
+#endif /*]*/
+#if defined(SIMD_X86_GNUC) && \
+	(__GNUC__ >= 5 || defined(__clang__)) /*[*/
+# define SIMD_AVX2	1
+# include <immintrin.h>
+#endif /*]*/
+#if defined(__ARM_NEON) && (defined(__aarch64__) || defined(_M_ARM64)) /*[*/
+# define SIMD_NEON	1
+# include <arm_neon.h>
+#endif /*]*/
+
+/* One implementation of a kernel. */
+typedef struct {
+    const char *variant;	/* name of the implementation */
+    simd_kernel_fn *fn;		/* function */
+    bool (*usable)(void);	/* CPU check, or NULL if always usable */
+} simd_impl_t;
+
+/* Portable versions. */
+
+static size_t
+ascii_run_scalar(const unsigned char *buf, size_t len)
+{
+    static const uint64_t ones = 0x0101010101010101ULL;
+    static const uint64_t highs = 0x8080808080808080ULL;
+    size_t n = 0;
+
+    while (len - n >= sizeof(uint64_t)) {
+	uint64_t v;
+
+	/* Stop at a word with a high bit set or a NUL byte. */
+	memcpy(&v, buf + n, sizeof(v));
+	if ((v | ((v - ones) & ~v)) & highs) {
+	    break;
+	}
+	n += sizeof(uint64_t);
+    }
+    while (n < len && buf[n] != '\0' && !(buf[n] & 0x80)) {
+	n++;
+    }
+    return n;
+}
+
+static size_t
+printable_run_scalar(const unsigned char *buf, size_t len)
+{
+    static const uint64_t ones = 0x0101010101010101ULL;
+    static const uint64_t highs = 0x8080808080808080ULL;
+    size_t n = 0;
+
+    while (len - n >= sizeof(uint64_t)) {
+	uint64_t v;
+
+	/* Stop at a word with any byte below ' ' or above '~'. */
+	memcpy(&v, buf + n, sizeof(v));
+	if (((v - (ones * ' ')) & ~v & highs) ||
+		(((v + (ones * (127 - '~'))) | v) & highs)) {
+	    break;
+	}
+	n += sizeof(uint64_t);
+    }
+    while (n < len && buf[n] >= ' ' && buf[n] < 0x7f) {
+	n++;
+    }
+    return n;
+}
+
+#if defined(SIMD_SSE2) /*[*/
+/* SSE2 versions, 16 bytes at a time. SSE2 is part of every x86-64 CPU. */
+
+static size_t
+ascii_run_sse2(const unsigned char *buf, size_t len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    size_t n = 0;
+
+    while (len - n >= 16) {
+	__m128i v = _mm_loadu_si128((const __m128i *)(buf + n));
+
+	/* The sign bit of each byte is set for a non-ASCII or NUL byte. */
+	if (_mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, zero)))) {
+	    break;
+	}
+	n += 16;
+    }
+    return n + ascii_run_scalar(buf + n, len - n);
+}
+
+static size_t
+printable_run_sse2(const unsigned char *buf, size_t len)
+{
+    const __m128i low = _mm_set1_epi8(' ' - 1);
+    const __m128i high = _mm_set1_epi8(0x7f);
+    size_t n = 0;
+
+    while (len - n >= 16) {
+	__m128i v = _mm_loadu_si128((const __m128i *)(buf + n));
+
+	/* Signed compares: bytes of 0x80 and up are negative. */
+	if (_mm_movemask_epi8(_mm_and_si128(_mm_cmpgt_epi8(v, low),
+			_mm_cmplt_epi8(v, high))) != 0xffff) {
+	    break;
+	}
+	n += 16;
+    }
+    return n + printable_run_scalar(buf + n, len - n);
+}
+#endif /*]*/
+
+#if defined(SIMD_AVX2) /*[*/
+/* AVX2 versions, 32 bytes at a time, compiled for AVX2 but used only if the
+ * CPU and OS support it. */
+
+static bool
+avx2_usable(void)
+{
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2");
+}
+
+__attribute__((target("avx2")))
+static size_t
+ascii_run_avx2(const unsigned char *buf, size_t len)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    size_t n = 0;
+
+    while (len - n >= 32) {
+	__m256i v = _mm256_loadu_si256((const __m256i *)(buf + n));
+
+	if (_mm256_movemask_epi8(_mm256_or_si256(v,
+			_mm256_cmpeq_epi8(v, zero)))) {
+	    break;
+	}
+	n += 32;
+    }
+    return n + ascii_run_scalar(buf + n, len - n);
+}
+
+__attribute__((target("avx2")))
+static size_t
+printable_run_avx2(const unsigned char *buf, size_t len)
+{
+    const __m256i low = _mm256_set1_epi8(' ' - 1);
+    const __m256i high = _mm256_set1_epi8(0x7f);
+    size_t n = 0;
+
+    while (len - n >= 32) {
+	__m256i v = _mm256_loadu_si256((const __m256i *)(buf + n));
+
+	if (_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpgt_epi8(v, low),
+			_mm256_cmpgt_epi8(high, v))) != -1) {
+	    break;
+	}
+	n += 32;
+    }
+    return n + printable_run_scalar(buf + n, len - n);
+}
+#endif /*]*/
+
+#if defined(SIMD_NEON) /*[*/
+/* NEON versions, 16 bytes at a time. NEON is part of every arm64 CPU. */
+
+static size_t
+ascii_run_neon(const unsigned char *buf, size_t len)
+{
+    size_t n = 0;
+
+    while (len - n >= 16) {
+	uint8x16_t v = vld1q_u8(buf + n);
+
+	if (vmaxvq_u8(vorrq_u8(vcgeq_u8(v, vdupq_n_u8(0x80)),
+			vceqq_u8(v, vdupq_n_u8(0))))) {
+	    break;
+	}
+	n += 16;
+    }
+    return n + ascii_run_scalar(buf + n, len - n);
+}
+
+static size_t
+printable_run_neon(const unsigned char *buf, size_t len)
+{
+    size_t n = 0;
+
+    while (len - n >= 16) {
+	uint8x16_t v = vld1q_u8(buf + n);
+
+	if (vminvq_u8(vandq_u8(vcgeq_u8(v, vdupq_n_u8(' ')),
+			vcleq_u8(v, vdupq_n_u8('~')))) != 0xff) {
+	    break;
+	}
+	n += 16;
+    }
+    return n + printable_run_scalar(buf + n, len - n);
+}
+#endif /*]*/
+
+/* Implementations of each kernel, best first. The last one is portable. */
+static simd_impl_t ascii_run_impls[] = {
+#if defined(SIMD_AVX2) /*[*/
+    { "avx2", ascii_run_avx2, avx2_usable },
+#endif /*]*/
+#if defined(SIMD_SSE2) /*[*/
+    { "sse2", ascii_run_sse2, NULL },
+#endif /*]*/
+#if defined(SIMD_NEON) /*[*/
+    { "neon", ascii_run_neon, NULL },
+#endif /*]*/
+    { "scalar", ascii_run_scalar, NULL }
+};
+
+static simd_impl_t printable_run_impls[] = {
+#if defined(SIMD_AVX2) /*[*/
+    { "avx2", printable_run_avx2, avx2_usable },
+#endif /*]*/
+#if defined(SIMD_SSE2) /*[*/
+    { "sse2", printable_run_sse2, NULL },
+#endif /*]*/
+#if defined(SIMD_NEON) /*[*/
+    { "neon", printable_run_neon, NULL },
+#endif /*]*/
+    { "scalar", printable_run_scalar, NULL }
+};
+
+static size_t ascii_run_first(const unsigned char *buf, size_t len);
+static size_t printable_run_first(const unsigned char *buf, size_t len);
+
+/* The kernel table. */
+static struct {
+    const char *name;		/* kernel name */
+    simd_kernel_fn **fn;	/* dispatch pointer */
+    simd_impl_t *impls;		/* implementations */
+    int n_impls;		/* number of implementations */
+    int selected;		/* index of the chosen implementation */
+} kernels[] = {
+    { "ascii-run", &simd_ascii_run, ascii_run_impls,
+	(int)(array_count(ascii_run_impls)), -1 },
+    { "printable-run", &simd_printable_run, printable_run_impls,
+	(int)(array_count(printable_run_impls)), -1 }
+};
+
+/* Dispatch pointers. Each one starts out choosing the implementations. */
+simd_kernel_fn *simd_ascii_run = ascii_run_first;
+simd_kernel_fn *simd_printable_run = printable_run_first;
+
+bool (*simd_scalar_hook)(void) = NULL;
+
+/* Choose the implementations, if that has not been done yet. */
+static void
+simd_init(void)
+{
+    if (kernels[0].selected < 0) {
+	simd_select(simd_scalar_hook != NULL && (*simd_scalar_hook)());
+    }
+}
+
+static size_t
+ascii_run_first(const unsigned char *buf, size_t len)
+{
+    simd_init();
+    return (*simd_ascii_run)(buf, len);
+}
+
+static size_t
+printable_run_first(const unsigned char *buf, size_t len)
+{
+    simd_init();
+    return (*simd_printable_run)(buf, len);
+}
+
+/**
+ * Choose the kernel implementations.
+ *
+ * @param[in] scalar	true to use the portable versions only
+ */
+void
+simd_select(bool scalar)
+{
+    int k;
+
+    for (k = 0; k < (int)(array_count(kernels)); k++) {
+	int i = kernels[k].n_impls - 1;
+
+	if (!scalar) {
+	    for (i = 0; i < kernels[k].n_impls - 1; i++) {
+		if (kernels[k].impls[i].usable == NULL ||
+			(*kernels[k].impls[i].usable)()) {
+		    break;
+		}
+	    }
+	}
+	kernels[k].selected = i;
+	*kernels[k].fn = kernels[k].impls[i].fn;
+    }
+}
+
+/* Returns the number of kernels. */
+int
+simd_kernel_count(void)
+{
+    return (int)(array_count(kernels));
+}
+
+/* Returns the name of a kernel. */
+const char *
+simd_kernel_name(int ix)
+{
+    return kernels[ix].name;
+}
+
+/* Returns the name of the implementation chosen for a kernel. */
+const char *
+simd_kernel_variant(int ix)
+{
+    simd_init();
+    return kernels[ix].impls[kernels[ix].selected].variant;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *	simd_glue.c
+ *		Emulator glue for the byte-scanning kernels: the forceScalar
+ *		resource, the Simd query and the trace file header line.
+ */
+
+#include "globals.h"
+
+#include "appres.h"
+#include "boolstr.h"
+#include "lazya.h"
+#include "names.h"
+#include "popups.h"
+#include "query.h"
+#include "resources.h"
+#include "simd.h"
+#include "simd_glue.h"
+#include "toggles.h"
+#include "varbuf.h"
+
+/* Tells the kernels whether scalar code was forced by a resource. */
+static bool
+simd_force_scalar(void)
+{
+    return appres.force_scalar;
+}
+
+/*
+ * Returns the kernel variants in use, as name=variant pairs separated by
+ * the given string.
+ */
+static const char *
+simd_list(const char *sep, const char *eq)
+{
+    varbuf_t r;
+    int i;
+
+    vb_init(&r);
+    for (i = 0; i < simd_kernel_count(); i++) {
+	vb_appendf(&r, "%s%s%s%s", i? sep: "", simd_kernel_name(i), eq,
+		simd_kernel_variant(i));
+    }
+    return lazya(vb_consume(&r));
+}
+
+/* Returns the kernel variants in use for the trace file header. */
+const char *
+simd_describe(void)
+{
+    return simd_list(" ", "=");
+}
+
+/* The Simd query. */
+static const char *
+simd_query(void)
+{
+    return simd_list("\n", " ");
+}
+
+/* The forceScalar resource changed. */
+static bool
+toggle_force_scalar(const char *name _is_unused, const char *value)
+{
+    const char *errmsg = boolstr(value, &appres.force_scalar);
+
+    if (errmsg != NULL) {
+	popup_an_error("%s %s", ResForceScalar, errmsg);
+	return false;
+    }
+    simd_select(appres.force_scalar);
+    return true;
+}
+
+/*
+ * SIMD module registration.
+ */
+void
+simd_glue_register(void)
+{
+    static query_t queries[] = {
+	{ KwSimd, simd_query, NULL, false, true }
+    };
+
+    simd_scalar_hook = simd_force_scalar;
+    register_extended_toggle(ResForceScalar, toggle_force_scalar, NULL, NULL,
+	    (void **)&appres.force_scalar, XRM_BOOLEAN);
+    register_queries(queries, array_count(queries));
+}
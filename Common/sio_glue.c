@@ -84,7 +84,13 @@ static flagged_res_t sio_flagged_res[] = {
     { TLS_OPT_KEY_PASSWD,
 	{ ResKeyPasswd, aoffset(tls.key_passwd), XRM_STRING } },
     { TLS_OPT_CLIENT_CERT,
-	{ ResClientCert, aoffset(tls.client_cert), XRM_STRING } }
+	{ ResClientCert, aoffset(tls.client_cert), XRM_STRING } },
+    { TLS_OPT_KERNEL_TLS,
+	{ ResKernelTls, aoffset(tls.kernel_tls), XRM_BOOLEAN } },
+    { TLS_OPT_RELEASE_BUFFERS,
+	{ ResTlsReleaseBuffers, aoffset(tls.release_buffers), XRM_BOOLEAN } },
+    { TLS_OPT_MAX_FRAGMENT,
+	{ ResTlsMaxFragment, aoffset(tls.max_fragment), XRM_INT } }
 };
 static int n_sio_flagged_res = (int)array_count(sio_flagged_res);
 
@@ -384,6 +390,31 @@ sio_toggle(const char *name, const char *value)
     case TLS_OPT_CLIENT_CERT:
 	Replace(appres.tls.client_cert, value[0]? NewString(value): NULL);
 	break;
+    case TLS_OPT_KERNEL_TLS:
+	if ((errmsg = boolstr(value, &appres.tls.kernel_tls)) != NULL) {
+	    popup_an_error("%s %s", name, errmsg);
+	    return false;
+	}
+	break;
+    case TLS_OPT_RELEASE_BUFFERS:
+	if ((errmsg = boolstr(value, &appres.tls.release_buffers)) != NULL) {
+	    popup_an_error("%s %s", name, errmsg);
+	    return false;
+	}
+	break;
+    case TLS_OPT_MAX_FRAGMENT: {
+	unsigned long l;
+	char *ptr;
+
+	l = strtoul(value, &ptr, 10);
+	if (*value == '\0' || *ptr != '\0' ||
+		(l != 0 && l != 512 && l != 1024 && l != 2048 && l != 4096)) {
+	    popup_an_error("%s must be 0, 512, 1024, 2048 or 4096", name);
+	    return false;
+	}
+	appres.tls.max_fragment = (int)l;
+	break;
+    }
     default:
 	popup_an_error("Unknown name '%s'", name);
 	return false;
@@ -37,6 +37,8 @@
 #endif /*]*/
 
 #include <stdint.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
 #include <openssl/ssl.h>
 #include <openssl/err.h>
 #include <openssl/conf.h>
@@ -66,8 +68,22 @@
 /* Globals */
 
 /* Statics */
+/*
+ * Shared TLS context. Connections with the same CA, certificate and key
+ * configuration share one of these, so the files are read only once.
+ */
+typedef struct shared_ctx {
+    struct shared_ctx *next;
+    char *key;			/* configuration the context was built from */
+    SSL_CTX *ctx;
+    unsigned refcount;
+    bool ca_loaded;		/* CA store has been loaded */
+} shared_ctx_t;
+static shared_ctx_t *shared_ctxs;
+
 typedef struct {
     tls_config_t *config;
+    shared_ctx_t *shared;
     SSL_CTX *ctx;
     SSL *con;
     socket_t sock;
@@ -81,9 +97,24 @@ typedef struct {
     char *server_subjects;
     bool negotiate_pending;
     bool negotiated;
+    char *session_key;
 } ssl_sio_t;
 
 static ssl_sio_t *current_sio;
+
+/*
+ * Client session cache. Sessions are kept across connections, keyed on the
+ * host name, peer port and the names and files used to validate and
+ * authenticate the connection, so a reconnect to the same host can resume
+ * instead of doing a full handshake.
+ */
+#define SESSION_CACHE_MAX	16
+static struct {
+    char *key;
+    SSL_SESSION *session;
+} session_cache[SESSION_CACHE_MAX];
+static unsigned session_handshakes = 0;
+static unsigned session_resumed = 0;
 #if OPENSSL_VERSION_NUMBER >= 0x00907000L /*[*/
 # define INFO_CONST const
 #else /*][*/
@@ -165,6 +196,10 @@ passwd_cb(char *buf, int size, int rwflag _is_unused, void *userdata)
     char *p;
     bool need_free = false;
 
+    if (s == NULL) {
+	/* Not loading a key for a particular connection. */
+	return 0;
+    }
     if (s->password != NULL) {
 	/* Interactive password overrides everything else. */
 	p = s->password;
@@ -471,87 +506,212 @@ spc_verify_cert_hostname(X509 *cert, const char *hostname)
 /*
  * Create a new OpenSSL connection.
  */
-sio_init_ret_t
-sio_init(tls_config_t *config, const char *password, sio_t *sio_ret)
+/* Build the session cache key for a connection. */
+static char *
+session_key(ssl_sio_t *s)
 {
-    ssl_sio_t *s = NULL;
-    char err_buf[120];
-    int cert_file_type = SSL_FILETYPE_PEM;
-    sio_init_ret_t err_ret = SI_FAILURE;
+    union {
+	struct sockaddr sa;
+	struct sockaddr_in sin;
+	struct sockaddr_in6 sin6;
+    } addr;
+    socklen_t len = sizeof(addr);
+    unsigned port = 0;
+
+    if (getpeername(s->sock, &addr.sa, &len) == 0) {
+	if (addr.sa.sa_family == AF_INET) {
+	    port = ntohs(addr.sin.sin_port);
+	} else if (addr.sa.sa_family == AF_INET6) {
+	    port = ntohs(addr.sin6.sin6_port);
+	}
+    }
+#define SK(x)	(((x) != NULL)? (x): "")
+    return xs_buffer("%s:%u:%s:%s:%s:%s", s->hostname, port,
+	    SK(s->accept_dnsname), SK(s->config->cert_file),
+	    SK(s->config->key_file), SK(s->config->client_cert));
+#undef SK
+}
 
-    sioc_error_reset();
+/* Find a key in the session cache. Returns its index, or -1. */
+static int
+session_cache_find(const char *key)
+{
+    int i;
 
-    /* Base initialization. */
-    base_init();
+    for (i = 0; i < SESSION_CACHE_MAX && session_cache[i].key != NULL; i++) {
+	if (!strcmp(session_cache[i].key, key)) {
+	    return i;
+	}
+    }
+    return -1;
+}
 
-    s = (ssl_sio_t *)Malloc(sizeof(ssl_sio_t));
-    memset(s, 0, sizeof(*s));
-    s->sock = INVALID_SOCKET;
+/* Remove an entry from the session cache. */
+static void
+session_cache_drop(const char *key)
+{
+    int ix;
 
-#if defined(OPENSSL110) /*[*/
-    s->ctx = SSL_CTX_new(TLS_method());
-#else /*][*/
-    s->ctx = SSL_CTX_new(SSLv23_method());
-#endif /*]*/
-    if (s->ctx == NULL) {
-	sioc_set_error("SSL_CTX_new failed");
-	goto fail;
+    if (key == NULL || (ix = session_cache_find(key)) < 0) {
+	return;
     }
-    SSL_CTX_set_options(s->ctx, SSL_OP_ALL);
-    SSL_CTX_set_info_callback(s->ctx, client_info_callback);
-    SSL_CTX_set_default_passwd_cb_userdata(s->ctx, s);
-    SSL_CTX_set_default_passwd_cb(s->ctx, passwd_cb);
+    Free(session_cache[ix].key);
+    SSL_SESSION_free(session_cache[ix].session);
+    memmove(&session_cache[ix], &session_cache[ix + 1],
+	    (SESSION_CACHE_MAX - ix - 1) * sizeof(session_cache[0]));
+    session_cache[SESSION_CACHE_MAX - 1].key = NULL;
+    session_cache[SESSION_CACHE_MAX - 1].session = NULL;
+}
 
-    s->config = config;
+/*
+ * Store a session in the cache, most recent first, evicting the oldest
+ * entry if the cache is full. The cache takes over the reference.
+ */
+static void
+session_cache_store(const char *key, SSL_SESSION *session)
+{
+    session_cache_drop(key);
+    if (session_cache[SESSION_CACHE_MAX - 1].key != NULL) {
+	Free(session_cache[SESSION_CACHE_MAX - 1].key);
+	SSL_SESSION_free(session_cache[SESSION_CACHE_MAX - 1].session);
+    }
+    memmove(&session_cache[1], &session_cache[0],
+	    (SESSION_CACHE_MAX - 1) * sizeof(session_cache[0]));
+    session_cache[0].key = NewString(key);
+    session_cache[0].session = session;
+}
 
-    vtrace("TLS: will%s verify host certificate\n",
-	    s->config->verify_host_cert? "": " not");
+/*
+ * New session callback. This is called at the end of a handshake, and for
+ * TLS 1.3, whenever the server sends a session ticket.
+ */
+static int
+new_session_cb(SSL *con, SSL_SESSION *session)
+{
+    ssl_sio_t *s = (ssl_sio_t *)SSL_get_app_data(con);
 
-    if (password != NULL) {
-	s->password = NewString(password);
+    if (s == NULL || s->session_key == NULL) {
+	return 0;
     }
+    session_cache_store(s->session_key, session);
+    return 1;
+}
 
-    /* Parse the -accepthostname option. */
-    if (s->config->accept_hostname != NULL) {
-	if (!strcasecmp(s->config->accept_hostname, "any") ||
-	    !strcmp(s->config->accept_hostname, "*")) {
-	    s->accept_dnsname = "*";
-	} else if (!strncasecmp(s->config->accept_hostname, "DNS:", 4) &&
-		    s->config->accept_hostname[4] != '\0') {
-	    s->accept_dnsname = &s->config->accept_hostname[4];
-	} else if (!strncasecmp(s->config->accept_hostname, "IP:", 3) &&
-		    s->config->accept_hostname[3] != '\0') {
-	    sioc_set_error("Cannot use 'IP:' for acceptHostname");
-	    goto fail;
+/* Build the shared context key for a configuration. */
+static char *
+ctx_key(const tls_config_t *config)
+{
+#define SK(x)	(((x) != NULL)? (x): "")
+    return xs_buffer("%s\n%s\n%s\n%s\n%s\n%s\n%s", SK(config->ca_dir),
+	    SK(config->ca_file), SK(config->chain_file), SK(config->cert_file),
+	    SK(config->cert_file_type), SK(config->key_file),
+	    SK(config->key_file_type));
+#undef SK
+}
+
+/*
+ * Release a reference to a shared context. The most recently released idle
+ * context is kept, so a reconnect does not have to build it again.
+ */
+static void
+ctx_release(shared_ctx_t *c)
+{
+    shared_ctx_t **prev = &shared_ctxs;
+
+    if (--c->refcount > 0) {
+	return;
+    }
+    while (*prev != NULL) {
+	shared_ctx_t *d = *prev;
+
+	if (d != c && d->refcount == 0) {
+	    *prev = d->next;
+	    SSL_CTX_free(d->ctx);
+	    Free(d->key);
+	    Free(d);
 	} else {
-	    s->accept_dnsname = s->config->accept_hostname;
+	    prev = &d->next;
 	}
     }
+}
 
-    /* Pull in the CA certificate file. */
-    if (s->config->ca_file != NULL || s->config->ca_dir != NULL) {
-	if (SSL_CTX_load_verify_locations(s->ctx, s->config->ca_file,
-		    s->config->ca_dir) != 1) {
+/*
+ * Load the CA store for a shared context. This is deferred until a
+ * connection actually needs to verify a host certificate.
+ */
+static bool
+ctx_load_ca(shared_ctx_t *c, const tls_config_t *config)
+{
+    char err_buf[120];
+
+    if (c->ca_loaded) {
+	return true;
+    }
+    if (config->ca_file != NULL || config->ca_dir != NULL) {
+	if (SSL_CTX_load_verify_locations(c->ctx, config->ca_file,
+		    config->ca_dir) != 1) {
 	    sioc_set_error("CA database load (%s%s%s%s%s%s%s%s%s) failed:\n%s",
-		    s->config->ca_file? "file ": "",
-		    s->config->ca_file? "\"": "",
-		    s->config->ca_file? s->config->ca_file: "",
-		    s->config->ca_file? "\"": "",
-		    (s->config->ca_file && s->config->ca_dir)? ", ": "",
-		    s->config->ca_dir? "dir ": "",
-		    s->config->ca_dir? "\"": "",
-		    s->config->ca_dir? s->config->ca_dir: "",
-		    s->config->ca_dir? "\"": "",
+		    config->ca_file? "file ": "",
+		    config->ca_file? "\"": "",
+		    config->ca_file? config->ca_file: "",
+		    config->ca_file? "\"": "",
+		    (config->ca_file && config->ca_dir)? ", ": "",
+		    config->ca_dir? "dir ": "",
+		    config->ca_dir? "\"": "",
+		    config->ca_dir? config->ca_dir: "",
+		    config->ca_dir? "\"": "",
 		    get_ssl_error(err_buf));
-	    goto fail;
+	    return false;
 	}
     } else {
-	SSL_CTX_set_default_verify_paths(s->ctx);
+	SSL_CTX_set_default_verify_paths(c->ctx);
+    }
+    c->ca_loaded = true;
+    return true;
+}
+
+/*
+ * Get a shared context for a connection, building it if needed.
+ * Returns NULL with the error set on failure.
+ */
+static shared_ctx_t *
+ctx_get(ssl_sio_t *s, sio_init_ret_t *err_ret)
+{
+    char *key = ctx_key(s->config);
+    shared_ctx_t *c;
+    SSL_CTX *ctx;
+    char err_buf[120];
+    int cert_file_type = SSL_FILETYPE_PEM;
+
+    for (c = shared_ctxs; c != NULL; c = c->next) {
+	if (!strcmp(c->key, key)) {
+	    vtrace("TLS: using shared context\n");
+	    Free(key);
+	    c->refcount++;
+	    return c;
+	}
     }
 
+#if defined(OPENSSL110) /*[*/
+    ctx = SSL_CTX_new(TLS_method());
+#else /*][*/
+    ctx = SSL_CTX_new(SSLv23_method());
+#endif /*]*/
+    if (ctx == NULL) {
+	sioc_set_error("SSL_CTX_new failed");
+	goto fail;
+    }
+    SSL_CTX_set_options(ctx, SSL_OP_ALL);
+    SSL_CTX_set_session_cache_mode(ctx,
+	    SSL_SESS_CACHE_CLIENT | SSL_SESS_CACHE_NO_INTERNAL_STORE);
+    SSL_CTX_sess_set_new_cb(ctx, new_session_cb);
+    SSL_CTX_set_info_callback(ctx, client_info_callback);
+    SSL_CTX_set_default_passwd_cb_userdata(ctx, s);
+    SSL_CTX_set_default_passwd_cb(ctx, passwd_cb);
+
     /* Pull in the client certificate file. */
     if (s->config->chain_file != NULL) {
-	if (SSL_CTX_use_certificate_chain_file(s->ctx,
+	if (SSL_CTX_use_certificate_chain_file(ctx,
 		    s->config->chain_file) != 1) {
 	    sioc_set_error("Client certificate chain file load (\"%s\") "
 		    "failed:\n%s", s->config->chain_file,
@@ -565,7 +725,7 @@ sio_init(tls_config_t *config, const char *password, sio_t *sio_ret)
 		    s->config->cert_file_type);
 	    goto fail;
 	}
-	if (SSL_CTX_use_certificate_file(s->ctx, s->config->cert_file,
+	if (SSL_CTX_use_certificate_file(ctx, s->config->cert_file,
 		    cert_file_type) != 1) {
 	    sioc_set_error("Client certificate file load (\"%s\") failed:\n%s",
 		    s->config->cert_file, get_ssl_error(err_buf));
@@ -582,43 +742,147 @@ sio_init(tls_config_t *config, const char *password, sio_t *sio_ret)
 		    s->config->key_file_type);
 	    goto fail;
 	}
-	if (SSL_CTX_use_PrivateKey_file(s->ctx, s->config->key_file,
+	if (SSL_CTX_use_PrivateKey_file(ctx, s->config->key_file,
 		    key_file_type) != 1) {
 	    sioc_set_error("Private key file load (\"%s\") failed:\n%s",
 		    s->config->key_file, get_ssl_error(err_buf));
-	    err_ret = s->need_password? SI_NEED_PASSWORD: SI_WRONG_PASSWORD;
+	    *err_ret = s->need_password? SI_NEED_PASSWORD: SI_WRONG_PASSWORD;
 	    goto fail;
 	}
     } else if (s->config->chain_file != NULL) {
-	if (SSL_CTX_use_PrivateKey_file(s->ctx, s->config->chain_file,
+	if (SSL_CTX_use_PrivateKey_file(ctx, s->config->chain_file,
 		    SSL_FILETYPE_PEM) != 1) {
 	    sioc_set_error("Private key file load (\"%s\") failed:\n%s",
 		    s->config->chain_file, get_ssl_error(err_buf));
-	    err_ret = s->need_password? SI_NEED_PASSWORD: SI_WRONG_PASSWORD;
+	    *err_ret = s->need_password? SI_NEED_PASSWORD: SI_WRONG_PASSWORD;
 	    goto fail;
 	}
     } else if (s->config->cert_file != NULL) {
-	if (SSL_CTX_use_PrivateKey_file(s->ctx, s->config->cert_file,
+	if (SSL_CTX_use_PrivateKey_file(ctx, s->config->cert_file,
 		    cert_file_type) != 1) {
 	    sioc_set_error("Private key file load (\"%s\") failed:\n%s",
 		    s->config->cert_file, get_ssl_error(err_buf));
-	    err_ret = s->need_password? SI_NEED_PASSWORD: SI_WRONG_PASSWORD;
+	    *err_ret = s->need_password? SI_NEED_PASSWORD: SI_WRONG_PASSWORD;
 	    goto fail;
 	}
     }
 
     /* Check the key. */
-    if (s->config->key_file != NULL && SSL_CTX_check_private_key(s->ctx) != 1) {
+    if (s->config->key_file != NULL && SSL_CTX_check_private_key(ctx) != 1) {
 	sioc_set_error("Private key check failed:\n%s", get_ssl_error(err_buf));
 	goto fail;
     }
 
+    /* The key is loaded, so the password is no longer needed. */
+    SSL_CTX_set_default_passwd_cb_userdata(ctx, NULL);
+
+    c = (shared_ctx_t *)Malloc(sizeof(shared_ctx_t));
+    c->key = key;
+    c->ctx = ctx;
+    c->refcount = 1;
+    c->ca_loaded = false;
+    c->next = shared_ctxs;
+    shared_ctxs = c;
+    return c;
+
+fail:
+    if (ctx != NULL) {
+	SSL_CTX_free(ctx);
+    }
+    Free(key);
+    return NULL;
+}
+
+sio_init_ret_t
+sio_init(tls_config_t *config, const char *password, sio_t *sio_ret)
+{
+    ssl_sio_t *s = NULL;
+    sio_init_ret_t err_ret = SI_FAILURE;
+
+    sioc_error_reset();
+
+    /* Base initialization. */
+    base_init();
+
+    s = (ssl_sio_t *)Malloc(sizeof(ssl_sio_t));
+    memset(s, 0, sizeof(*s));
+    s->sock = INVALID_SOCKET;
+
+    s->config = config;
+
+    vtrace("TLS: will%s verify host certificate\n",
+	    s->config->verify_host_cert? "": " not");
+
+    if (password != NULL) {
+	s->password = NewString(password);
+    }
+
+    /* Parse the -accepthostname option. */
+    if (s->config->accept_hostname != NULL) {
+	if (!strcasecmp(s->config->accept_hostname, "any") ||
+	    !strcmp(s->config->accept_hostname, "*")) {
+	    s->accept_dnsname = "*";
+	} else if (!strncasecmp(s->config->accept_hostname, "DNS:", 4) &&
+		    s->config->accept_hostname[4] != '\0') {
+	    s->accept_dnsname = &s->config->accept_hostname[4];
+	} else if (!strncasecmp(s->config->accept_hostname, "IP:", 3) &&
+		    s->config->accept_hostname[3] != '\0') {
+	    sioc_set_error("Cannot use 'IP:' for acceptHostname");
+	    goto fail;
+	} else {
+	    s->accept_dnsname = s->config->accept_hostname;
+	}
+    }
+
+    /* Get the context, loading the certificate and key files. */
+    if ((s->shared = ctx_get(s, &err_ret)) == NULL) {
+	goto fail;
+    }
+    s->ctx = s->shared->ctx;
+
     s->con = SSL_new(s->ctx);
     if (s->con == NULL) {
 	sioc_set_error("SSL_new failed");
 	goto fail;
     }
     SSL_set_verify_depth(s->con, 64);
+    SSL_set_app_data(s->con, s);
+#if defined(SSL_OP_ENABLE_KTLS) /*[*/
+    if (s->config->kernel_tls) {
+	/* Ask for the record layer to be handed to the kernel. */
+	SSL_set_options(s->con, SSL_OP_ENABLE_KTLS);
+    }
+#endif /*]*/
+    if (s->config->release_buffers) {
+	/* Free the record buffers whenever they are empty. */
+	SSL_set_mode(s->con, SSL_MODE_RELEASE_BUFFERS);
+    }
+#if defined(TLSEXT_max_fragment_length_DISABLED) /*[*/
+    if (s->config->max_fragment) {
+	uint8_t mode;
+
+	/*
+	 * Ask the server for smaller records, so both record buffers can be
+	 * smaller. What is sent is limited even if the server says no.
+	 */
+	switch (s->config->max_fragment) {
+	case 512:
+	    mode = TLSEXT_max_fragment_length_512;
+	    break;
+	case 1024:
+	    mode = TLSEXT_max_fragment_length_1024;
+	    break;
+	case 2048:
+	    mode = TLSEXT_max_fragment_length_2048;
+	    break;
+	default:
+	    mode = TLSEXT_max_fragment_length_4096;
+	    break;
+	}
+	SSL_set_tlsext_max_fragment_length(s->con, mode);
+	SSL_set_max_send_fragment(s->con, s->config->max_fragment);
+    }
+#endif /*]*/
 
     /* Success. */
     *sio_ret = (sio_t *)s;
@@ -627,14 +891,15 @@ sio_init(tls_config_t *config, const char *password, sio_t *sio_ret)
 fail:
     /* Failure. */
     if (s != NULL) {
-	if (s->ctx != NULL) {
-	    SSL_CTX_free(s->ctx);
-	    s->ctx = NULL;
-	}
 	if (s->con != NULL) {
 	    SSL_free(s->con);
 	    s->con = NULL;
 	}
+	if (s->shared != NULL) {
+	    ctx_release(s->shared);
+	    s->shared = NULL;
+	    s->ctx = NULL;
+	}
 	if (s->password != NULL) {
 	    Free(s->password);
 	    s->password = NULL;
@@ -757,12 +1022,61 @@ display_cert(varbuf_t *v, X509 *cert, int level, const char *who)
     }
 }
 
+/*
+ * Display the record buffer memory a session uses. OpenSSL does not report
+ * it, so this works it out from the largest record each buffer must hold.
+ */
+static void
+display_memory(varbuf_t *v, SSL *con)
+{
+    ssl_sio_t *s = (ssl_sio_t *)SSL_get_app_data(con);
+    unsigned read_frag = SSL3_RT_MAX_PLAIN_LENGTH;
+    unsigned write_frag = SSL3_RT_MAX_PLAIN_LENGTH;
+
+    if (s == NULL) {
+	return;
+    }
+#if defined(TLSEXT_max_fragment_length_DISABLED) /*[*/
+    if (s->config->max_fragment) {
+	uint8_t mode = SSL_SESSION_get_max_fragment_length(
+		SSL_get_session(con));
+
+	write_frag = s->config->max_fragment;
+	if (mode != TLSEXT_max_fragment_length_DISABLED) {
+	    read_frag = 512U << (mode - 1);
+	}
+	vb_appendf(v, "Max fragment: %d, %s by server\n",
+		s->config->max_fragment,
+		(mode != TLSEXT_max_fragment_length_DISABLED)?
+		    "accepted": "not accepted");
+    }
+#endif /*]*/
+    vb_appendf(v, "Record buffers: about %u bytes read, %u bytes write, "
+	    "%s\n",
+	    read_frag + SSL3_RT_HEADER_LENGTH + SSL3_RT_MAX_ENCRYPTED_OVERHEAD,
+	    write_frag + SSL3_RT_HEADER_LENGTH +
+		SSL3_RT_SEND_MAX_ENCRYPTED_OVERHEAD,
+	    (SSL_get_mode(con) & SSL_MODE_RELEASE_BUFFERS)?
+		"released when idle": "kept while connected");
+}
+
 /* Display session info. */
 static void
 display_session(varbuf_t *v, SSL *con)
 {
     vb_appendf(v, "Version: %s\n", SSL_get_version(con));
     vb_appendf(v, "Cipher: %s\n", SSL_get_cipher_name(con));
+    vb_appendf(v, "Session: %s (%u of %u handshakes resumed)\n",
+	    SSL_session_reused(con)? "resumed": "new", session_resumed,
+	    session_handshakes);
+#if defined(SSL_OP_ENABLE_KTLS) /*[*/
+    if (SSL_get_options(con) & SSL_OP_ENABLE_KTLS) {
+	vb_appendf(v, "Kernel TLS: send %s, receive %s\n",
+		BIO_get_ktls_send(SSL_get_wbio(con))? "on": "off",
+		BIO_get_ktls_recv(SSL_get_rbio(con))? "on": "off");
+    }
+#endif /*]*/
+    display_memory(v, con);
 }
 
 /* Display server certificate info. */
@@ -871,6 +1185,7 @@ sio_negotiate(sio_t sio, socket_t sock, const char *hostname, bool *data)
     varbuf_t v;
     size_t len;
     long vr;
+    int ix;
 
     sioc_error_reset();
 
@@ -917,6 +1232,11 @@ sio_negotiate(sio_t sio, socket_t sock, const char *hostname, bool *data)
 	}
 #endif /*]*/
 
+	/* Load the CA store, if we will need it. */
+	if (s->config->verify_host_cert && !ctx_load_ca(s->shared, s->config)) {
+	    return SIG_FAILURE;
+	}
+
 	SSL_set_verify(s->con, SSL_VERIFY_PEER, ssl_verify_callback);
 
 	/* Set up the TLS/SSL connection. */
@@ -924,6 +1244,13 @@ sio_negotiate(sio_t sio, socket_t sock, const char *hostname, bool *data)
 	    vtrace("OpenSSL sio_negotiate: can't set fd\n");
 	    return SIG_FAILURE;
 	}
+
+	/* Offer the cached session for this host, if there is one. */
+	s->session_key = session_key(s);
+	if ((ix = session_cache_find(s->session_key)) >= 0) {
+	    vtrace("OpenSSL sio_negotiate: offering cached session\n");
+	    SSL_set_session(s->con, session_cache[ix].session);
+	}
     }
 
     current_sio = s;
@@ -938,6 +1265,7 @@ sio_negotiate(sio_t sio, socket_t sock, const char *hostname, bool *data)
     if (s->config->verify_host_cert) {
 	vr = SSL_get_verify_result(s->con);
 	if (vr != X509_V_OK) {
+	    session_cache_drop(s->session_key);
 	    sioc_set_error("Host certificate verification failed:\n%s (%ld)%s",
 		    X509_verify_cert_error_string(vr), vr,
 		    (vr == X509_V_ERR_HOSTNAME_MISMATCH)?
@@ -952,6 +1280,7 @@ sio_negotiate(sio_t sio, socket_t sock, const char *hostname, bool *data)
     if (rv != 1) {
 	char err_buf[120];
 
+	session_cache_drop(s->session_key);
 	sioc_set_error("SSL_connect failed %d:\n%s", rv,
 		get_ssl_error(err_buf));
 	return SIG_FAILURE;
@@ -960,11 +1289,27 @@ sio_negotiate(sio_t sio, socket_t sock, const char *hostname, bool *data)
 #if !defined(OPENSSL102) /*[*/
     /* Check the host certificate. */
     if (!check_cert_name(s)) {
+	session_cache_drop(s->session_key);
 	vtrace("disconnect: check_cert_name failed\n");
 	return SIG_FAILURE;
     }
 #endif /*]*/
 
+    session_handshakes++;
+    if (SSL_session_reused(s->con)) {
+	session_resumed++;
+    }
+    vtrace("OpenSSL sio_negotiate: %s session, %u of %u resumed\n",
+	    SSL_session_reused(s->con)? "resumed": "new", session_resumed,
+	    session_handshakes);
+#if defined(SSL_OP_ENABLE_KTLS) /*[*/
+    if (s->config->kernel_tls) {
+	vtrace("OpenSSL sio_negotiate: kernel TLS send %s, receive %s\n",
+		BIO_get_ktls_send(SSL_get_wbio(s->con))? "on": "off",
+		BIO_get_ktls_recv(SSL_get_rbio(s->con))? "on": "off");
+    }
+#endif /*]*/
+
     /* Display the session info. */
     vb_init(&v);
     display_session(&v, s->con);
@@ -1093,10 +1438,6 @@ sio_close(sio_t sio)
 	return;
     }
 
-    if (s->ctx != NULL) {
-	SSL_CTX_free(s->ctx);
-	s->ctx = NULL;
-    }
     if (s->password != NULL) {
 	Free(s->password);
 	s->password = NULL;
@@ -1113,10 +1454,19 @@ sio_close(sio_t sio)
 	Free(s->server_subjects);
 	s->server_subjects = NULL;
     }
+    if (s->session_key != NULL) {
+	Free(s->session_key);
+	s->session_key = NULL;
+    }
 
     SSL_shutdown(s->con);
     SSL_free(s->con);
     s->con = NULL;
+    if (s->shared != NULL) {
+	ctx_release(s->shared);
+	s->shared = NULL;
+	s->ctx = NULL;
+    }
 
     s->sock = INVALID_SOCKET;
 
@@ -1141,7 +1491,15 @@ sio_options_supported(void)
 {
     return TLS_OPT_CA_DIR | TLS_OPT_CA_FILE | TLS_OPT_CERT_FILE
 	| TLS_OPT_CERT_FILE_TYPE | TLS_OPT_CHAIN_FILE | TLS_OPT_KEY_FILE
-	| TLS_OPT_KEY_FILE_TYPE | TLS_OPT_KEY_PASSWD;
+	| TLS_OPT_KEY_FILE_TYPE | TLS_OPT_KEY_PASSWD
+	| TLS_OPT_RELEASE_BUFFERS
+#if defined(SSL_OP_ENABLE_KTLS) /*[*/
+	| TLS_OPT_KERNEL_TLS
+#endif /*]*/
+#if defined(TLSEXT_max_fragment_length_DISABLED) /*[*/
+	| TLS_OPT_MAX_FRAGMENT
+#endif /*]*/
+	;
 }
 
 /*
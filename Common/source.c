@@ -35,6 +35,7 @@
 #include "wincmn.h"
 #include <errno.h>
 #include <fcntl.h>
+#include <sys/stat.h>
 
 #include "actions.h"
 #include "names.h"
@@ -43,7 +44,6 @@
 #include "task.h"
 #include "trace.h"
 #include "utils.h"
-#include "varbuf.h"
 
 static void source_data(task_cbh handle, const char *buf, size_t len,
 	bool success);
@@ -60,12 +60,37 @@ static tcb_t source_cb = {
     source_run
 };
 
+/*
+ * A Source() file, read into memory and split into lines.
+ *
+ * Files are cached by pathname, and re-read only when their modification
+ * time or size changes, so a script that sources the same file repeatedly
+ * does not re-read it each time.
+ */
+#define SOURCE_CACHE_MAX	8	/* files kept when not in use */
+typedef struct source_file {
+    struct source_file *next;	/* linkage, most recently used first */
+    char *path;			/* expanded pathname */
+    time_t mtime;		/* modification time */
+    time_t read_time;		/* time it was read */
+    off_t size;			/* size */
+    char *text;			/* contents, each line NUL-terminated */
+    char **lines;		/* non-empty lines */
+    int nlines;			/* number of lines */
+    bool eof_newline;		/* true if the last line ended with a newline */
+    int refcount;		/* number of Source() actions using it */
+    bool stale;			/* true if replaced by a newer copy */
+} source_file_t;
+static source_file_t *source_files = NULL;
+
 /* State for one instance of Source. */
 typedef struct {
-    int fd;		/* file descriptor */
-    char *path;		/* pathname */
-    char *name;		/* cb name */
-    char *result; 	/* one line of error result */
+    source_file_t *file;	/* file contents */
+    int line;			/* next line to run */
+    bool aborted;		/* true if a command failed */
+    char *path;			/* pathname */
+    char *name;			/* cb name */
+    char *result; 		/* one line of error result */
 } source_t;
 
 /**
@@ -105,14 +130,144 @@ source_done(task_cbh handle, bool success, bool abort)
 
     if (!success) {
 	vtrace("%s %s  terminated due to error\n", s->name, s->path);
-	close(s->fd);
-	s->fd = -1;
+	s->aborted = true;
 	return true;
     }
 
     return false;
 }
 
+/**
+ * Free a cached Source() file.
+ *
+ * @param[in] f		File to free
+ */
+static void
+source_file_free(source_file_t *f)
+{
+    Free(f->lines);
+    Free(f->text);
+    Free(f->path);
+    Free(f);
+}
+
+/**
+ * Read a Source() file into memory.
+ *
+ * @param[in] fd	Open file descriptor
+ * @param[in] path	Expanded pathname
+ * @param[in] st	File status
+ *
+ * @return File contents, or NULL for a read error
+ */
+static source_file_t *
+source_file_read(int fd, const char *path, struct stat *st)
+{
+    source_file_t *f;
+    size_t len = 0;
+    size_t i;
+    bool in_line = false;
+    int nr;
+
+    f = (source_file_t *)Calloc(1, sizeof(source_file_t));
+    f->text = Malloc(st->st_size + 1);
+    while ((off_t)len < st->st_size &&
+	    (nr = read(fd, f->text + len, st->st_size - len)) != 0) {
+	if (nr < 0) {
+	    Free(f->text);
+	    Free(f);
+	    return NULL;
+	}
+	len += nr;
+    }
+    f->text[len] = '\0';
+
+    /* Split it into lines, skipping empty ones. */
+    f->lines = (char **)Malloc((len / 2 + 1) * sizeof(char *));
+    for (i = 0; i < len; i++) {
+	if (f->text[i] == '\r' || f->text[i] == '\n') {
+	    f->text[i] = '\0';
+	    in_line = false;
+	} else if (!in_line) {
+	    f->lines[f->nlines++] = f->text + i;
+	    in_line = true;
+	}
+    }
+    f->eof_newline = !in_line;
+    f->path = NewString(path);
+    f->mtime = st->st_mtime;
+    f->read_time = time(NULL);
+    f->size = st->st_size;
+    return f;
+}
+
+/**
+ * Find a Source() file in the cache, or read it in.
+ *
+ * @param[in] fd	Open file descriptor
+ * @param[in] path	Expanded pathname
+ *
+ * @return File contents, or NULL for a read error
+ */
+static source_file_t *
+source_file_get(int fd, const char *path)
+{
+    struct stat st;
+    source_file_t **p;
+    source_file_t *f;
+    int n;
+
+    if (fstat(fd, &st) < 0) {
+	return NULL;
+    }
+
+    /* Look it up. */
+    for (p = &source_files; (f = *p) != NULL; p = &f->next) {
+	if (!strcmp(f->path, path)) {
+	    *p = f->next;
+	    /*
+	     * Modification times are in seconds, so a copy read during the
+	     * second it was last modified cannot be trusted.
+	     */
+	    if (f->mtime == st.st_mtime && f->size == st.st_size &&
+		    f->read_time > f->mtime) {
+		vtrace(AnSource "(): using cached copy of %s\n", path);
+		break;
+	    }
+
+	    /* Changed. */
+	    if (f->refcount) {
+		f->stale = true;
+	    } else {
+		source_file_free(f);
+	    }
+	    f = NULL;
+	    break;
+	}
+    }
+
+    if (f == NULL && (f = source_file_read(fd, path, &st)) == NULL) {
+	return NULL;
+    }
+
+    /* Put it at the front, and trim unused files from the end. */
+    f->next = source_files;
+    source_files = f;
+    for (n = 0, p = &source_files; *p != NULL; n++) {
+	source_file_t *g = *p;
+
+	if (n >= SOURCE_CACHE_MAX && !g->refcount) {
+	    *p = g->next;
+	    source_file_free(g);
+	} else {
+	    p = &g->next;
+	}
+    }
+
+    f->refcount++;
+    return f;
+}
+
 /**
  * Free a source conext.
  *
@@ -121,6 +276,12 @@ source_done(task_cbh handle, bool success, bool abort)
 static void
 free_source(source_t *s)
 {
+    source_file_t *f = s->file;
+
+    f->refcount--;
+    if (f->stale && !f->refcount) {
+	source_file_free(f);
+    }
     Replace(s->name, NULL);
     Free(s);
     disable_keyboard(ENABLE, IMPLICIT, AnSource "() completion");
@@ -138,11 +299,10 @@ static bool
 source_run(task_cbh handle, bool *success)
 {
     source_t *s = (source_t *)handle;
-    varbuf_t r;
     char *buf;
 
     /* Check for failure. */
-    if (s->fd == -1) {
+    if (s->aborted) {
 	/* Aborted. */
 	popup_an_error(AnSource "(): %s", s->result? s->result: "failed");
 	free_source(s);
@@ -150,50 +310,21 @@ source_run(task_cbh handle, bool *success)
 	return true;
     }
 
-    vb_init(&r);
-
-    /* Read the next command from the file. */
-    while (true) {
-	char c;
-	int nr;
-
-	nr = read(s->fd, &c, 1);
-	if (nr < 0) {
-	    popup_an_error(AnSource "(%s) read error\n", s->path);
-	    vb_free(&r);
-	    close(s->fd);
-	    free_source(s);
-	    *success = false;
-	    return true;
-	}
-	if (nr == 0) {
-	    if (vb_len(&r) == 0) {
-		vtrace("%s %s EOF\n", s->name, s->path);
-		vb_free(&r);
-		close(s->fd);
-		free_source(s);
-		*success = true;
-		return true;
-	    } else {
-		vtrace("%s %s EOF without newline\n", s->name, s->path);
-		break;
-	    }
-	}
-	if (c == '\r' || c == '\n') {
-	    if (vb_len(&r)) {
-		break;
-	    } else {
-		continue;
-	    }
-	}
-	vb_append(&r, &c, 1);
+    /* Check for EOF. */
+    if (s->line >= s->file->nlines) {
+	vtrace("%s %s EOF\n", s->name, s->path);
+	free_source(s);
+	*success = true;
+	return true;
+    }
+    buf = s->file->lines[s->line++];
+    if (s->line == s->file->nlines && !s->file->eof_newline) {
+	vtrace("%s %s EOF without newline\n", s->name, s->path);
     }
 
     /* Run the command as a macro. */
-    buf = vb_consume(&r);
     vtrace("%s %s read '%s'\n", s->name, s->path, buf);
     push_stack_macro(buf);
-    Free(buf);
 
     /* Not done yet. */
     return false;
@@ -211,6 +342,7 @@ Source_action(ia_t ia, unsigned argc, const char **argv)
 {
     int fd;
     char *expanded_filename;
+    source_file_t *f;
     source_t *s;
     char *name;
 
@@ -225,14 +357,19 @@ Source_action(ia_t ia, unsigned argc, const char **argv)
 	popup_an_errno(errno, "%s", argv[0]);
 	return false;
     }
-#if !defined(_WIN32) /*[*/
-    fcntl(fd, F_SETFD, 1);
-#endif /*]*/
+    f = source_file_get(fd, expanded_filename);
+    close(fd);
     Free(expanded_filename);
+    if (f == NULL) {
+	popup_an_error(AnSource "(%s) read error\n", argv[0]);
+	return false;
+    }
 
-    /* Start reading from the file. */
+    /* Start running the file. */
     s = (source_t *)Malloc(sizeof(source_t) + strlen(argv[0]) + 1);
-    s->fd = fd;
+    s->file = f;
+    s->line = 0;
+    s->aborted = false;
     s->path = (char *)(s + 1);
     strcpy(s->path, argv[0]);
     s->result = NULL;
@@ -0,0 +1,595 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	spans.c
+ *		End-to-end request spans.
+ *
+ * A request from a front end (a b3270 <run> or an httpd command) is
+ * followed through the task queue, the actions it runs, the first 3270
+ * record it sends to the host and the host record that answers it. When
+ * the request is complete, its stages are written to the spanFile as one
+ * line of OpenTelemetry JSON (the OTLP ExportTraceServiceRequest encoding),
+ * with a root span for the request and a child span for each stage.
+ *
+ * The front end's correlation ID is used as the trace ID when it is a
+ * W3C traceparent or 32 hex digits, and is recorded as an attribute
+ * otherwise. Requests are only followed when spanFile is set.
+ */
+
+#include "globals.h"
+
+#include <errno.h>
+#include <inttypes.h>
+
+#include "appres.h"
+#include "lazya.h"
+#include "popups.h"
+#include "resources.h"
+#include "spans.h"
+#include "toggles.h"
+#include "trace.h"
+#include "utils.h"
+#include "varbuf.h"	/* must precede serialize.h */
+#include "serialize.h"
+
+#if defined(_WIN32) /*[*/
+# include <process.h>
+#endif /*]*/
+
+#define TRACE_ID_LEN	32	/* hex digits in a trace ID */
+#define SPAN_ID_LEN	16	/* hex digits in a span ID */
+
+/* Requests waiting for a host response, beyond which the oldest is sent. */
+#define MAX_WAITING	32
+
+/* Span flags. */
+#define SF_EXECUTED	0x01	/* an action has run */
+#define SF_OUTPUT	0x02	/* a record has been sent to the host */
+#define SF_EOR		0x04	/* the host response is being processed */
+#define SF_PROCESSED	0x08	/* the host response has been processed */
+#define SF_DONE		0x10	/* the request is complete */
+#define SF_DISCONNECTED	0x20	/* the host disconnected before answering */
+
+/* OpenTelemetry span kinds and status codes. */
+#define KIND_INTERNAL	1
+#define KIND_SERVER	2
+#define KIND_CLIENT	3
+#define STATUS_OK	1
+#define STATUS_ERROR	2
+
+struct span {
+    llist_t llist;		/* linkage */
+    char trace_id[TRACE_ID_LEN + 1]; /* trace ID */
+    char root_id[SPAN_ID_LEN + 1]; /* ID of the root span */
+    char parent_id[SPAN_ID_LEN + 1]; /* caller's span ID, or empty */
+    char *correlation_id;	/* correlation ID from the front end */
+    const char *source;		/* front end */
+    struct timeval t_received;	/* request received */
+    struct timeval t_exec_start; /* first action started */
+    struct timeval t_exec_end;	/* last action ended */
+    struct timeval t_output;	/* first record sent to the host */
+    struct timeval t_eor_start;	/* host response received */
+    struct timeval t_eor_end;	/* host response processed */
+    struct timeval t_done;	/* request complete */
+    unsigned actions;		/* actions run */
+    size_t bytes_out;		/* record bytes sent */
+    size_t bytes_in;		/* response record bytes */
+    unsigned flags;		/* SF_xxx */
+    bool success;		/* request succeeded */
+};
+
+static llist_t spans = LLIST_INIT(spans);	/* live requests */
+static span_t *current = NULL;	/* request whose actions are running */
+static FILE *sink = NULL;	/* open spanFile */
+static bool sink_failed = false; /* spanFile could not be opened */
+
+/* Generate a random ID of hex digits. */
+static void
+random_id(char *buf, int digits)
+{
+    static bool seeded = false;
+    static const char hex[] = "0123456789abcdef";
+    bool nonzero = false;
+    int i;
+
+    if (!seeded) {
+	struct timeval tv;
+
+	gettimeofday(&tv, NULL);
+#if defined(_WIN32) /*[*/
+	srand((unsigned int)(tv.tv_sec ^ tv.tv_usec) ^
+		(unsigned int)GetCurrentProcessId());
+#else /*][*/
+	srandom((unsigned int)(tv.tv_sec ^ tv.tv_usec) ^
+		((unsigned int)getpid() << 8));
+#endif /*]*/
+	seeded = true;
+    }
+    for (i = 0; i < digits; i++) {
+#if defined(_WIN32) /*[*/
+	buf[i] = hex[rand() & 0xf];
+#else /*][*/
+	buf[i] = hex[random() & 0xf];
+#endif /*]*/
+	nonzero |= buf[i] != '0';
+    }
+    if (!nonzero) {
+	buf[digits - 1] = '1';	/* an all-zero ID is invalid */
+    }
+    buf[digits] = '\0';
+}
+
+/* Check for a non-zero run of lowercase or uppercase hex digits. */
+static bool
+is_hex_id(const char *s, size_t len)
+{
+    bool nonzero = false;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+	if (!isxdigit((unsigned char)s[i])) {
+	    return false;
+	}
+	nonzero |= s[i] != '0';
+    }
+    return nonzero;
+}
+
+/* Copy a hex ID, in lowercase. */
+static void
+copy_id(char *buf, const char *s, size_t len)
+{
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+	buf[i] = tolower((unsigned char)s[i]);
+    }
+    buf[len] = '\0';
+}
+
+/* Open the spanFile, if there is one. */
+static FILE *
+span_sink(void)
+{
+    if (sink != NULL || sink_failed ||
+	    appres.span_file == NULL || !*appres.span_file) {
+	return sink;
+    }
+    if ((sink = fopen(appres.span_file, "a")) == NULL) {
+	popup_an_errno(errno, "%s", appres.span_file);
+	sink_failed = true;
+    }
+    return sink;
+}
+
+/**
+ * Start following a request.
+ *
+ * @param[in] source		Front end name
+ * @param[in] correlation_id	Front end's correlation ID, or NULL
+ *
+ * @return New span, or NULL if requests are not being followed
+ */
+span_t *
+span_new(const char *source, const char *correlation_id)
+{
+    span_t *span;
+    size_t len;
+
+    if (span_sink() == NULL) {
+	return NULL;
+    }
+
+    span = (span_t *)Calloc(1, sizeof(span_t));
+    llist_init(&span->llist);
+    span->source = source;
+    gettimeofday(&span->t_received, NULL);
+
+    /*
+     * Use the trace ID (and parent span ID) from a W3C traceparent, or
+     * a bare 32-digit trace ID. Anything else is just recorded.
+     */
+    len = (correlation_id != NULL)? strlen(correlation_id): 0;
+    if (len == 55 && correlation_id[2] == '-' && correlation_id[35] == '-' &&
+	    correlation_id[52] == '-' &&
+	    is_hex_id(correlation_id + 3, TRACE_ID_LEN) &&
+	    is_hex_id(correlation_id + 36, SPAN_ID_LEN)) {
+	copy_id(span->trace_id, correlation_id + 3, TRACE_ID_LEN);
+	copy_id(span->parent_id, correlation_id + 36, SPAN_ID_LEN);
+    } else if (len == TRACE_ID_LEN &&
+	    is_hex_id(correlation_id, TRACE_ID_LEN)) {
+	copy_id(span->trace_id, correlation_id, TRACE_ID_LEN);
+    } else {
+	random_id(span->trace_id, TRACE_ID_LEN);
+    }
+    random_id(span->root_id, SPAN_ID_LEN);
+    if (correlation_id != NULL) {
+	span->correlation_id = NewString(correlation_id);
+    }
+    LLIST_APPEND(&span->llist, spans);
+    return span;
+}
+
+/**
+ * Check for requests being followed.
+ *
+ * @return true if any requests are being followed
+ */
+bool
+span_active(void)
+{
+    return !llist_isempty(&spans);
+}
+
+/**
+ * An action is about to run on behalf of a request.
+ *
+ * @param[in] span	Request, or NULL
+ *
+ * @return Previous request, to pass to span_leave()
+ */
+span_t *
+span_enter(span_t *span)
+{
+    span_t *prev = current;
+
+    current = span;
+    if (span != NULL) {
+	if (!(span->flags & SF_EXECUTED)) {
+	    gettimeofday(&span->t_exec_start, NULL);
+	    span->flags |= SF_EXECUTED;
+	}
+	span->actions++;
+    }
+    return prev;
+}
+
+/**
+ * An action has finished.
+ *
+ * @param[in] prev	Value returned by span_enter()
+ */
+void
+span_leave(span_t *prev)
+{
+    if (current != NULL) {
+	gettimeofday(&current->t_exec_end, NULL);
+    }
+    current = prev;
+}
+
+/* Return a timestamp in Unix nanoseconds, as a string. */
+static const char *
+unix_nano(struct timeval *tv)
+{
+    return lazyaf("%" PRIu64, ((uint64_t)tv->tv_sec * 1000000000) +
+	    ((uint64_t)tv->tv_usec * 1000));
+}
+
+/* Return the time between two timestamps, in milliseconds. */
+static double
+delta_ms(struct timeval *t1, struct timeval *t0)
+{
+    return ((t1->tv_sec - t0->tv_sec) * 1000.0) +
+	((t1->tv_usec - t0->tv_usec) / 1000.0);
+}
+
+/* Append a string attribute. */
+static void
+attr_string(varbuf_t *r, const char *key, const char *value)
+{
+    vb_appendf(r, "%s{\"key\":\"%s\",\"value\":{\"stringValue\":\"",
+	    (vb_buf(r)[vb_len(r) - 1] == '[')? "": ",", key);
+    ser_json_text(r, value, strlen(value));
+    vb_appends(r, "\"}}");
+}
+
+/* Append an integer attribute. */
+static void
+attr_int(varbuf_t *r, const char *key, uint64_t value)
+{
+    vb_appendf(r, "%s{\"key\":\"%s\",\"value\":{\"intValue\":\"%" PRIu64
+	    "\"}}", (vb_buf(r)[vb_len(r) - 1] == '[')? "": ",", key, value);
+}
+
+/* Append the start of a span. */
+static void
+span_start_json(varbuf_t *r, span_t *span, bool first, const char *name,
+	const char *span_id, const char *parent_id, int kind,
+	struct timeval *t0, struct timeval *t1)
+{
+    vb_appendf(r, "%s{\"traceId\":\"%s\",\"spanId\":\"%s\",", first? "": ",",
+	    span->trace_id, span_id);
+    if (parent_id != NULL && *parent_id) {
+	vb_appendf(r, "\"parentSpanId\":\"%s\",", parent_id);
+    }
+    vb_appendf(r, "\"name\":\"%s\",\"kind\":%d,\"startTimeUnixNano\":\"%s\","
+	    "\"endTimeUnixNano\":\"%s\",\"attributes\":[", name, kind,
+	    unix_nano(t0), unix_nano(t1));
+}
+
+/* Append a child span with no attributes. */
+static void
+child_json(varbuf_t *r, span_t *span, const char *name, int kind,
+	struct timeval *t0, struct timeval *t1)
+{
+    char id[SPAN_ID_LEN + 1];
+
+    random_id(id, SPAN_ID_LEN);
+    span_start_json(r, span, false, name, id, span->root_id, kind, t0, t1);
+}
+
+/* Write a completed request to the spanFile and free it. */
+static void
+span_emit(span_t *span)
+{
+    struct timeval *t_end = &span->t_done;
+    FILE *f = span_sink();
+    varbuf_t r;
+    varbuf_t t;
+
+    llist_unlink(&span->llist);
+    if (current == span) {
+	current = NULL;
+    }
+    if ((span->flags & SF_PROCESSED) &&
+	    delta_ms(&span->t_eor_end, t_end) > 0) {
+	t_end = &span->t_eor_end;
+    }
+
+    /* Summarize it in the trace. */
+    vb_init(&t);
+    if (span->flags & SF_EXECUTED) {
+	vb_appendf(&t, " queue %.3fms execute %.3fms",
+		delta_ms(&span->t_exec_start, &span->t_received),
+		delta_ms(&span->t_exec_end, &span->t_exec_start));
+    }
+    if (span->flags & SF_PROCESSED) {
+	vb_appendf(&t, " host %.3fms process %.3fms",
+		delta_ms(&span->t_eor_start, &span->t_output),
+		delta_ms(&span->t_eor_end, &span->t_eor_start));
+    }
+    vtrace("Request span %s:%s total %.3fms\n", span->trace_id, vb_buf(&t),
+	    delta_ms(t_end, &span->t_received));
+    vb_free(&t);
+
+    if (f == NULL) {
+	goto done;
+    }
+
+    vb_init(&r);
+    vb_appends(&r, "{\"resourceSpans\":[{\"resource\":{\"attributes\":[");
+    attr_string(&r, "service.name", app);
+    attr_string(&r, "service.version", build_rpq_version);
+    attr_int(&r, "process.pid", (uint64_t)getpid());
+    vb_appendf(&r, "]},\"scopeSpans\":[{\"scope\":{\"name\":\"x3270\"},"
+	    "\"spans\":[");
+
+    /* The root span covers the whole request. */
+    span_start_json(&r, span, true, "request", span->root_id,
+	    span->parent_id, KIND_SERVER, &span->t_received, t_end);
+    attr_string(&r, "x3270.source", span->source);
+    if (span->correlation_id != NULL) {
+	attr_string(&r, "x3270.correlation_id", span->correlation_id);
+    }
+    attr_int(&r, "x3270.actions", span->actions);
+    if (span->flags & SF_DISCONNECTED) {
+	attr_string(&r, "x3270.host_response", "disconnected");
+    }
+    vb_appendf(&r, "],\"status\":{\"code\":%d}}",
+	    span->success? STATUS_OK: STATUS_ERROR);
+
+    /* Then one span per stage reached. */
+    if (span->flags & SF_EXECUTED) {
+	child_json(&r, span, "queue", KIND_INTERNAL, &span->t_received,
+		&span->t_exec_start);
+	vb_appends(&r, "]}");
+	child_json(&r, span, "execute", KIND_INTERNAL, &span->t_exec_start,
+		&span->t_exec_end);
+	vb_appends(&r, "]}");
+    }
+    if (span->flags & SF_PROCESSED) {
+	child_json(&r, span, "host", KIND_CLIENT, &span->t_output,
+		&span->t_eor_start);
+	attr_int(&r, "x3270.bytes_sent", span->bytes_out);
+	vb_appends(&r, "]}");
+	child_json(&r, span, "process", KIND_INTERNAL, &span->t_eor_start,
+		&span->t_eor_end);
+	attr_int(&r, "x3270.bytes_received", span->bytes_in);
+	vb_appends(&r, "]}");
+    }
+    vb_appends(&r, "]}]}]}\n");
+    if (fwrite(vb_buf(&r), 1, vb_len(&r), f) != vb_len(&r) || fflush(f)) {
+	vtrace("spanFile write failed: %s\n", strerror(errno));
+    }
+    vb_free(&r);
+
+done:
+    Replace(span->correlation_id, NULL);
+    Free(span);
+}
+
+/**
+ * A request is complete.
+ * If it sent a record to the host, it is written out when the answer
+ * has been processed. Otherwise, it is written out now.
+ *
+ * @param[in] span	Request, or NULL
+ * @param[in] success	true if it succeeded
+ */
+void
+span_done(span_t *span, bool success)
+{
+    unsigned waiting = 0;
+    span_t *s;
+
+    if (span == NULL) {
+	return;
+    }
+    gettimeofday(&span->t_done, NULL);
+    span->flags |= SF_DONE;
+    span->success = success;
+    if (!(span->flags & SF_OUTPUT) ||
+	    (span->flags & (SF_PROCESSED | SF_DISCONNECTED))) {
+	span_emit(span);
+	return;
+    }
+
+    /* Don't wait forever for hosts that do not answer. */
+    FOREACH_LLIST(&spans, s, span_t *) {
+	if ((s->flags & SF_DONE) && !(s->flags & SF_EOR)) {
+	    waiting++;
+	}
+    } FOREACH_LLIST_END(&spans, s, span_t *);
+    if (waiting > MAX_WAITING) {
+	FOREACH_LLIST(&spans, s, span_t *) {
+	    if ((s->flags & SF_DONE) && !(s->flags & SF_EOR)) {
+		span_emit(s);
+		break;
+	    }
+	} FOREACH_LLIST_END(&spans, s, span_t *);
+    }
+}
+
+/**
+ * A 3270 record is being sent to the host.
+ *
+ * @param[in] len	Record length
+ */
+void
+span_output(size_t len)
+{
+    if (current == NULL || (current->flags & (SF_EOR | SF_PROCESSED))) {
+	return;
+    }
+    if (!(current->flags & SF_OUTPUT)) {
+	gettimeofday(&current->t_output, NULL);
+	current->flags |= SF_OUTPUT;
+    }
+    current->bytes_out += len;
+}
+
+/**
+ * A 3270 record from the host is about to be processed. It answers every
+ * request that has sent a record and not been answered yet.
+ *
+ * @param[in] len	Record length
+ */
+void
+span_eor_start(size_t len)
+{
+    struct timeval now;
+    span_t *span;
+
+    if (llist_isempty(&spans)) {
+	return;
+    }
+    gettimeofday(&now, NULL);
+    FOREACH_LLIST(&spans, span, span_t *) {
+	if ((span->flags & (SF_OUTPUT | SF_EOR | SF_PROCESSED)) ==
+		SF_OUTPUT) {
+	    span->t_eor_start = now;
+	    span->bytes_in = len;
+	    span->flags |= SF_EOR;
+	}
+    } FOREACH_LLIST_END(&spans, span, span_t *);
+}
+
+/**
+ * A 3270 record from the host has been processed.
+ */
+void
+span_eor_end(void)
+{
+    struct timeval now;
+    span_t *span;
+
+    if (llist_isempty(&spans)) {
+	return;
+    }
+    gettimeofday(&now, NULL);
+    FOREACH_LLIST(&spans, span, span_t *) {
+	if ((span->flags & (SF_EOR | SF_PROCESSED)) == SF_EOR) {
+	    span->t_eor_end = now;
+	    span->flags |= SF_PROCESSED;
+	    if (span->flags & SF_DONE) {
+		span_emit(span);
+	    }
+	}
+    } FOREACH_LLIST_END(&spans, span, span_t *);
+}
+
+/* The host connected or disconnected. */
+static void
+spans_connect(bool ignored _is_unused)
+{
+    span_t *span;
+
+    if (CONNECTED) {
+	return;
+    }
+    FOREACH_LLIST(&spans, span, span_t *) {
+	if ((span->flags & (SF_OUTPUT | SF_PROCESSED)) == SF_OUTPUT) {
+	    span->flags |= SF_DISCONNECTED;
+	    if (span->flags & SF_DONE) {
+		span_emit(span);
+	    }
+	}
+    } FOREACH_LLIST_END(&spans, span, span_t *);
+}
+
+/* The spanFile resource changed. */
+static bool
+toggle_span_file(const char *name _is_unused, const char *value)
+{
+    FILE *f = NULL;
+
+    if (*value && (f = fopen(value, "a")) == NULL) {
+	popup_an_errno(errno, "%s", value);
+	return false;
+    }
+    if (sink != NULL) {
+	fclose(sink);
+    }
+    sink = f;
+    sink_failed = false;
+    Replace(appres.span_file, *value? NewString(value): NULL);
+    return true;
+}
+
+/**
+ * Span module registration.
+ */
+void
+spans_register(void)
+{
+    register_schange(ST_CONNECT, spans_connect);
+    register_extended_toggle(ResSpanFile, toggle_span_file, NULL, NULL,
+	    (void **)&appres.span_file, XRM_STRING);
+}
@@ -35,7 +35,7 @@
 #include "split_host.h"
 #include "utils.h"
 
-static const char *pfxstr = "AaCcLlNnPpSsBbYyTt";
+static const char *pfxstr = "AaCcLlNnPpSsBbYyTtQq";
 
 /**
  * Return the set of host prefixes.
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	startup.c
+ *		Startup-time markers.
+ *
+ * If the X3270STARTUP environment variable names a file, a line is
+ * appended to it the first time each startup stage is reached:
+ *
+ *   <product> <pid> <stage> <seconds since the epoch> <ms since main()>
+ *
+ * The absolute time lets a harness measure from exec, not just from
+ * main(). When the variable is not set, each marker costs one test.
+ */
+
+#include "globals.h"
+
+#if !defined(_WIN32) /*[*/
+# include <sys/time.h>
+#endif /*]*/
+
+#include "startup.h"
+
+bool startup_tracing = false;
+
+static FILE *startup_file;
+static const char *startup_product;
+static struct timeval startup_main;
+static bool marked[STARTUP_NSTAGES];
+
+static const char *stage_name[STARTUP_NSTAGES] = {
+    "main",
+    "resources",
+    "codepage",
+    "loop",
+    "connect",
+    "negotiated",
+    "host-write",
+    "screen"
+};
+
+/**
+ * Initialize startup tracing. Called first thing in main().
+ *
+ * @param[in] product	product name
+ */
+void
+startup_init(const char *product)
+{
+    char *path = getenv("X3270STARTUP");
+
+    gettimeofday(&startup_main, NULL);
+    if (path == NULL || !*path) {
+	return;
+    }
+    startup_file = fopen(path, "a");
+    if (startup_file == NULL) {
+	return;
+    }
+    startup_product = product;
+    startup_tracing = true;
+    startup_mark_stage(STARTUP_MAIN);
+}
+
+/**
+ * Record a startup stage, if it is the first time it has been reached.
+ * The screen stage only counts once host data has been processed.
+ *
+ * @param[in] stage	stage reached
+ */
+void
+startup_mark_stage(startup_stage_t stage)
+{
+    struct timeval now;
+
+    if (marked[stage] ||
+	    (stage == STARTUP_SCREEN && !marked[STARTUP_HOST_WRITE])) {
+	return;
+    }
+    marked[stage] = true;
+    gettimeofday(&now, NULL);
+    fprintf(startup_file, "%s %d %s %ld.%06ld %.3f\n", startup_product,
+	    (int)getpid(), stage_name[stage], (long)now.tv_sec,
+	    (long)now.tv_usec,
+	    ((now.tv_sec - startup_main.tv_sec) * 1000000.0 +
+	     (now.tv_usec - startup_main.tv_usec)) / 1000.0);
+    fflush(startup_file);
+
+    /* Stop once the last stage is done. */
+    if (stage == STARTUP_SCREEN) {
+	fclose(startup_file);
+	startup_file = NULL;
+	startup_tracing = false;
+    }
+}
@@ -0,0 +1,217 @@
+#!/usr/bin/env python3
+# Startup-time benchmark for the 3270 front ends
+#
+# Runs each emulator against a synthetic 3270 host with X3270STARTUP set,
+# and reports how long after exec() each startup stage was reached:
+#   main        main() entered
+#   resources   command line and resources parsed
+#   codepage    code page initialized
+#   loop        first event loop pass complete
+#   connect     TCP connection complete
+#   negotiated  TELNET negotiation complete, in 3270 mode
+#   host-write  first host write processed
+#   screen      first screen with host data drawn (not s3270 or pr3287)
+#
+# Each emulator is run several times and the median for each stage is
+# printed, as a table or as JSON lines with -json.
+
+import argparse
+import json
+import os
+import pty
+import select
+import socket
+import statistics
+import subprocess
+import sys
+import tempfile
+import threading
+import time
+
+# Telnet and 3270 constants.
+IAC, DO, WILL, SB, SE = 255, 253, 251, 250, 240
+EOR = 239
+TELOPT_BINARY, TELOPT_TTYPE, TELOPT_EOR = 0, 24, 25
+CMD_EW = 0xf5
+WCC_RESTORE = 0xc2
+
+STAGES = ['main', 'resources', 'codepage', 'loop', 'connect', 'negotiated',
+          'host-write', 'screen']
+
+# Process command-line arguments.
+parser = argparse.ArgumentParser(description='3270 startup-time benchmark')
+parser.add_argument('-emulator', action='append',
+        choices=['s3270', 'b3270', 'c3270', 'pr3287', 'x3270'],
+        help='emulator to test (default all that can be found)')
+parser.add_argument('-bindir',
+        help='directory containing the emulators (default $PATH)')
+parser.add_argument('-runs', type=int, default=5,
+        help='number of runs per emulator')
+parser.add_argument('-timeout', type=float, default=10.0,
+        help='seconds to wait for each run')
+parser.add_argument('-json', action='store_true',
+        help='write results as JSON lines')
+args = parser.parse_args()
+
+# Synthetic host. Negotiates TN3270, sends one Erase/Write, then holds the
+# connection open until the emulator goes away.
+class Host:
+    def __init__(self):
+        self.listener = socket.socket()
+        self.listener.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        self.listener.bind(('127.0.0.1', 0))
+        self.listener.listen(1)
+        self.port = self.listener.getsockname()[1]
+        threading.Thread(target=self.serve, daemon=True).start()
+
+    def serve(self):
+        try:
+            conn, _ = self.listener.accept()
+        except OSError:
+            return
+        self.listener.close()
+        try:
+            conn.sendall(bytes([IAC, DO, TELOPT_TTYPE]))
+            self.expect(conn, bytes([IAC, WILL, TELOPT_TTYPE]))
+            conn.sendall(bytes([IAC, SB, TELOPT_TTYPE, 1, IAC, SE]))
+            self.expect(conn, bytes([IAC, SE]))
+            conn.sendall(bytes([IAC, WILL, TELOPT_EOR, IAC, DO, TELOPT_EOR,
+                IAC, WILL, TELOPT_BINARY, IAC, DO, TELOPT_BINARY]))
+            conn.sendall(bytes([CMD_EW, WCC_RESTORE]) +
+                    'startup benchmark'.encode('cp037') + bytes([IAC, EOR]))
+            while conn.recv(4096):
+                pass
+        except OSError:
+            pass
+        conn.close()
+
+    def expect(self, conn, what):
+        buf = b''
+        while what not in buf:
+            d = conn.recv(4096)
+            if not d:
+                raise OSError('Emulator disconnected during negotiation')
+            buf += d
+
+    def close(self):
+        try:
+            self.listener.close()
+        except OSError:
+            pass
+
+# Returns the full path of a program, or None.
+def Find(name):
+    if args.bindir is not None:
+        path = os.path.join(args.bindir, name)
+        return path if os.access(path, os.X_OK) else None
+    for d in os.environ.get('PATH', '').split(os.pathsep):
+        path = os.path.join(d, name)
+        if os.access(path, os.X_OK):
+            return path
+    return None
+
+# Reads the stages logged so far, as a dict of stage to epoch time.
+def ReadStages(path):
+    stages = {}
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) == 5 and fields[2] not in stages:
+                stages[fields[2]] = float(fields[3])
+    return stages
+
+# Runs one emulator once. Returns a dict of stage to ms after exec().
+def Run(name, path):
+    host = Host()
+    hostname = '127.0.0.1:{0}'.format(host.port)
+    fd, log = tempfile.mkstemp(prefix='startup.')
+    os.close(fd)
+    env = dict(os.environ, X3270STARTUP=log)
+    last = 'host-write' if name in ['s3270', 'pr3287'] else 'screen'
+    master = None
+
+    start = time.time()
+    if name == 's3270':
+        proc = subprocess.Popen([path, hostname], env=env,
+                stdin=subprocess.PIPE, stdout=subprocess.DEVNULL,
+                stderr=subprocess.DEVNULL)
+    elif name == 'b3270':
+        # b3270 takes the host from the UI stream.
+        proc = subprocess.Popen([path], env=env, stdin=subprocess.PIPE,
+                stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        proc.stdin.write('<b3270-in><run actions="Connect({0})"/>'.format(
+            hostname).encode('utf-8'))
+        proc.stdin.flush()
+    elif name == 'pr3287':
+        proc = subprocess.Popen([path, '-command', 'cat >/dev/null',
+                hostname], env=env, stdin=subprocess.DEVNULL,
+                stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    elif name == 'c3270':
+        # c3270 needs a terminal.
+        master, slave = pty.openpty()
+        env['TERM'] = env.get('TERM', 'xterm') or 'xterm'
+        proc = subprocess.Popen([path, '-secure', hostname], env=env,
+                stdin=slave, stdout=slave, stderr=slave)
+        os.close(slave)
+    else:
+        proc = subprocess.Popen([path, hostname], env=env,
+                stdin=subprocess.DEVNULL, stdout=subprocess.DEVNULL,
+                stderr=subprocess.DEVNULL)
+
+    # Wait for the last stage, draining the terminal as we go.
+    deadline = start + args.timeout
+    stages = {}
+    while time.time() < deadline:
+        if master is not None:
+            r, _, _ = select.select([master], [], [], 0.01)
+            if r:
+                try:
+                    os.read(master, 65536)
+                except OSError:
+                    pass
+        else:
+            time.sleep(0.01)
+        stages = ReadStages(log)
+        if last in stages or proc.poll() is not None:
+            break
+
+    proc.kill()
+    proc.wait()
+    if master is not None:
+        os.close(master)
+    host.close()
+    stages = ReadStages(log)
+    os.unlink(log)
+    return {s: (t - start) * 1000.0 for s, t in stages.items()}
+
+# Runs every emulator and reports the medians.
+emulators = args.emulator
+if emulators is None:
+    emulators = ['s3270', 'b3270', 'c3270', 'pr3287']
+    if os.environ.get('DISPLAY'):
+        emulators.append('x3270')
+results = []
+for name in emulators:
+    path = Find(name)
+    if path is None:
+        sys.stderr.write('{0}: not found\n'.format(name))
+        continue
+    runs = [Run(name, path) for i in range(args.runs)]
+    result = {'emulator': name, 'runs': args.runs}
+    for stage in STAGES:
+        times = [r[stage] for r in runs if stage in r]
+        if times:
+            result[stage] = round(statistics.median(times), 3)
+    results.append(result)
+
+if args.json:
+    for result in results:
+        print(json.dumps(result))
+else:
+    print('{0:<8}'.format('') +
+            ''.join('{0:>11}'.format(s) for s in STAGES))
+    for result in results:
+        print('{0:<8}'.format(result['emulator']) +
+                ''.join('{0:>11}'.format('{0:.1f}'.format(result[s])
+                    if s in result else '-') for s in STAGES))
+    print('(median ms after exec over {0} runs)'.format(args.runs))
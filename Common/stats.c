@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	stats.c
+ *		Session statistics.
+ *
+ * The counters are plain 64-bit integers, bumped in place by the modules
+ * that own the events, so counting costs one add. Everything else here is
+ * for reporting them.
+ */
+
+#include "globals.h"
+
+#include <inttypes.h>
+
+#include "actions.h"
+#include "lazya.h"
+#include "names.h"
+#include "query.h"
+#include "stats.h"
+#include "utils.h"
+#include "varbuf.h"
+
+uint64_t stats[STAT_MAX];
+
+/* Counter names, used by Query(), b3270 and the httpd. */
+static const char *stat_names[STAT_MAX] = {
+    "bytes-received",
+    "records-received",
+    "bytes-sent",
+    "records-sent",
+    "tls-bytes-received",
+    "tls-bytes-sent",
+    "ft-blocks",
+    "write-cache-hits",
+    "write-cache-misses",
+    "reconnects",
+    "loop-iterations",
+    "wait-usec",
+    "actions",
+    "keyboard-locks",
+    "keyboard-lock-usec",
+    "allocations",
+    "allocated-bytes"
+};
+
+/*
+ * Return the name of a counter.
+ */
+const char *
+stats_name(stat_t s)
+{
+    return stat_names[s];
+}
+
+/*
+ * Clear the per-connection counters.
+ */
+void
+stats_reset(void)
+{
+    memset(stats, 0, STAT_CONNECTION_MAX * sizeof(uint64_t));
+}
+
+/*
+ * Copy the counters.
+ */
+void
+stats_snapshot(uint64_t *snap)
+{
+    stats[STAT_ALLOCS] = malloc_count;
+    stats[STAT_ALLOC_BYTES] = malloc_bytes;
+    memcpy(snap, stats, sizeof(stats));
+}
+
+/*
+ * Format the counters, then the actions that have been run.
+ */
+const char *
+stats_dump(void)
+{
+    uint64_t snap[STAT_MAX];
+    varbuf_t r;
+    int i;
+    action_elt_t *e;
+    bool any = false;
+
+    stats_snapshot(snap);
+    vb_init(&r);
+    for (i = 0; i < STAT_MAX; i++) {
+	vb_appendf(&r, "%s%s %" PRIu64, i? " ": "", stat_names[i], snap[i]);
+    }
+    FOREACH_LLIST(&actions_list, e, action_elt_t *) {
+	if (e->runs) {
+	    vb_appendf(&r, "%s %s %" PRIu64, any? "": "\nactions", e->t.name,
+		    e->runs);
+	    any = true;
+	}
+    } FOREACH_LLIST_END(&actions_list, e, action_elt_t *);
+    return lazya(vb_consume(&r));
+}
+
+/*
+ * Format the counters in OpenMetrics text format.
+ * Counters kept in microseconds are reported in seconds.
+ */
+const char *
+stats_metrics(void)
+{
+    uint64_t snap[STAT_MAX];
+    varbuf_t r;
+    int i;
+    action_elt_t *e;
+
+    stats_snapshot(snap);
+    vb_init(&r);
+    for (i = 0; i < STAT_MAX; i++) {
+	char *name = lazyaf("x3270_%s", stat_names[i]);
+	size_t sl = strlen(name);
+	bool usec = sl > 5 && !strcmp(name + sl - 5, "-usec");
+	char *s;
+
+	if (usec) {
+	    name = lazyaf("%.*s_seconds", (int)(sl - 5), name);
+	}
+	for (s = name; *s; s++) {
+	    if (*s == '-') {
+		*s = '_';
+	    }
+	}
+	vb_appendf(&r, "# TYPE %s counter\n", name);
+	if (usec) {
+	    vb_appendf(&r, "%s_total %.6f\n", name, snap[i] / 1000000.0);
+	} else {
+	    vb_appendf(&r, "%s_total %" PRIu64 "\n", name, snap[i]);
+	}
+    }
+
+    vb_appends(&r, "# TYPE x3270_action_runs counter\n");
+    FOREACH_LLIST(&actions_list, e, action_elt_t *) {
+	if (e->runs) {
+	    vb_appendf(&r, "x3270_action_runs_total{action=\"%s\"} %" PRIu64
+		    "\n", e->t.name, e->runs);
+	}
+    } FOREACH_LLIST_END(&actions_list, e, action_elt_t *);
+    return lazya(vb_consume(&r));
+}
+
+/*
+ * Statistics module registration.
+ */
+void
+stats_register(void)
+{
+    static query_t queries[] = {
+	{ KwStats, stats_dump, NULL, false, false }
+    };
+
+    register_queries(queries, array_count(queries));
+}
@@ -38,6 +38,7 @@
 #include <sys/un.h>
 #include <netinet/in.h>
 #include <arpa/inet.h>
+#include <regex.h>
 #else /*][*/
 #include "wincmn.h"
 #endif /*]*/
@@ -45,6 +46,7 @@
 #include <fcntl.h>
 #include <signal.h>
 #include <assert.h>
+#include <inttypes.h>
 
 #include "3270ds.h"
 #include "appres.h"
@@ -59,6 +61,7 @@
 #include "childscript.h"
 #include "copyright.h"
 #include "ctlrc.h"
+#include "footprint.h"
 #include "unicodec.h"
 #include "ft.h"
 #include "host.h"
@@ -68,6 +71,7 @@
 #include "menubar.h"
 #include "names.h"
 #include "nvt.h"
+#include "observe.h"
 #include "opts.h"
 #include "peerscript.h"
 #include "popups.h"
@@ -76,7 +80,9 @@
 #include "s3270_proto.h"
 #include "screen.h"
 #include "source.h"
+#include "spans.h"
 #include "split_host.h"
+#include "stats.h"
 #include "stdinscript.h"
 #include "stringscript.h"
 #include "task.h"
@@ -91,8 +97,6 @@
 
 #include "w3misc.h"
 
-#define NVT_SAVE_SIZE	4096
-
 /* Maximum size of a macro. */
 #define MSC_BUF	1024
 
@@ -129,6 +133,8 @@ typedef struct task {
 	TS_WAIT_DISC,	/* awaiting completion of Wait(Disconnect) */
 	TS_WAIT_IFIELD,	/* awaiting completion of Wait(InputField) */
 	TS_WAIT_UNLOCK,	/* awaiting completion of Wait(Unlock) */
+	TS_WAIT_SETTLED,/* awaiting completion of Wait(Settled) */
+	TS_WAIT_MATCH,	/* awaiting completion of Wait(String/Regex) */
 	TS_EXPECTING,	/* awaiting completion of Expect() */
 	TS_PASSTHRU,	/* awaiting completion of a pass-through action */
 	TS_XWAIT	/* extended wait */
@@ -140,6 +146,10 @@ typedef struct task {
     unsigned long child_msec;	/* child time */
     ioid_t expect_id;	/* timeout ID for Expect() */
     ioid_t wait_id;	/* timeout ID for Wait() */
+    ioid_t settle_id;	/* timeout ID for Wait(Settled) quiet interval */
+    unsigned long wake_gen; /* wake_gen when the wait was last checked */
+    unsigned long wake_screen; /* screen_generation, ditto */
+    int wake_cursor;	/* cursor_addr, ditto */
     int passthru_index;	/* UI passthru command index */
     int depth;		/* depth on stack */
     bool fatal;		/* tear everything down after completion */
@@ -151,8 +161,25 @@ typedef struct task {
     struct {
 	char   *text;	/* text to match */
 	size_t	len;	/* length of match */
+	size_t *fail;	/* failure function for text */
+	size_t	matched; /* length of partial match so far */
+	size_t	pos;	/* value of nvt_save_total when last scanned */
     } expect;
 
+    /* Wait(String) and Wait(Regex) fields. */
+    struct {
+	char   *text;	/* text to match */
+	bool	is_regex; /* text is a regular expression */
+#if !defined(_WIN32) /*[*/
+	regex_t	re;	/* compiled expression */
+#endif /*]*/
+	bool	field;	/* search the field containing the cursor */
+	bool	force_utf8; /* compare in UTF-8 */
+	int	row, col, rows, cols; /* region to search */
+	unsigned long *row_gen;	/* row generations when last scanned */
+	unsigned long screen_gen; /* screen_generation, ditto (field) */
+    } match;
+
     /* Macro fields. */
     struct {
 	char   *msc;	/* input buffer */
@@ -165,6 +192,8 @@ typedef struct task {
     struct task_cbx {	/* ST_CB context: */
 	const tcb_t *cb;	/*  callback block */
 	task_cbh handle;	/*  handle */
+	struct task *hash_next;	/*  handle hash chain */
+	span_t *span;		/*  request span, or NULL */
     } cbx;
 
 } task_t;
@@ -172,6 +201,20 @@ static task_t *current_task = NULL;	/* the current task */
 static int passthru_index = 0;
 static peer_listen_t global_peer_listen = NULL;
 
+/*
+ * Resources used by a task stack: the CPU time spent running it, the event
+ * loop passes that found it runnable, the actions it ran and the bytes it
+ * exchanged with its owner (a peer script, an httpd session, a child
+ * script and so on).
+ */
+typedef struct {
+    uint64_t cpu_usec;	/* CPU time spent running tasks */
+    uint64_t wakeups;	/* event loop passes that ran tasks */
+    uint64_t actions;	/* actions run */
+    uint64_t bytes_in;	/* command bytes received */
+    uint64_t bytes_out;	/* result bytes sent */
+} task_usage_t;
+
 /* List of active task stacks. */
 typedef struct _taskq {
     llist_t llist;	/* linkage */
@@ -183,10 +226,40 @@ typedef struct _taskq {
     unsigned short index;	/* index, for debug display */
     bool deleted;	/* delete flag */
     bool output_wait_needed; /* should Wait(Output) block? */
+    task_usage_t usage;	/* resources used */
 } taskq_t;
 static llist_t taskq = LLIST_INIT(taskq);
 static unsigned short taskq_index = 1;
 
+/*
+ * Callback tasks, hashed by handle, so the data and completion callbacks
+ * from peer scripts, the httpd and the UI can find their task without
+ * walking every stack. Newer tasks are found first.
+ */
+#define CB_HASH		256	/* must be a power of 2 */
+#define CB_HASH_IX(h)	((unsigned)(((uintptr_t)(h) >> 4) * 2654435761U) & \
+			    (CB_HASH - 1))
+static task_t *cb_hash[CB_HASH];
+
+/* Usage of the most recently completed task stacks, for Query(TaskUsage). */
+#define USAGE_DONE	32	/* completed stacks remembered */
+#define USAGE_TOP	20	/* stacks listed */
+typedef struct {
+    char *name;		/* unique name, or NULL if the slot is empty */
+    task_usage_t usage;	/* resources used */
+} task_usage_done_t;
+static task_usage_done_t usage_done[USAGE_DONE];
+static int usage_done_next = 0;
+
+/*
+ * Task counts, kept up to date as tasks are created, change state and
+ * are freed.
+ */
+static unsigned n_queued = 0;	/* idle, waiting for input or a child */
+static unsigned n_running = 0;	/* running, or needing their run callback */
+static unsigned n_blocked = 0;	/* blocked on a wait condition */
+static unsigned n_script = 0;	/* not generated by the user interface */
+
 typedef struct _owait {
     struct _owait *next;	/* linkage */
     const tcb_t *cb;		/* callback block */
@@ -208,6 +281,8 @@ static const char *task_state_name[] = {
     "WAIT_DISC",
     "WAIT_IFIELD",
     "WAIT_UNLOCK",
+    "WAIT_SETTLED",
+    "WAIT_MATCH",
     "EXPECTING",
     "PASSTHRU",
     "XWAIT"
@@ -215,8 +290,10 @@ static const char *task_state_name[] = {
 
 static struct macro_def *macro_last = (struct macro_def *) NULL;
 static unsigned char *nvt_save_buf;
+static size_t   nvt_save_size = NVT_SAVE_SIZE;
 static size_t   nvt_save_cnt = 0;
 static int      nvt_save_ix = 0;
+static size_t   nvt_save_total = 0;	/* bytes ever stored, modulo wrap */
 static const char *st_name[NUM_ST] = {
     "Macro",		/* MACRO */
     "Callback"		/* CB */
@@ -235,12 +312,42 @@ static void task_pop(void);
 static void wait_timed_out(ioid_t id);
 static task_t *task_redirect_to(void);
 static bool expect_matches(task_t *task);
+static void expect_free(task_t *task);
+static bool match_init(unsigned np, const char **pr, bool force_utf8);
+static bool match_screen(task_t *task);
+static void match_free(task_t *task);
+static void task_codepage_changed(bool ignored);
+static void task_status_changed(bool ignored);
 
 /* Macro that defines that the keyboard is locked due to user input. */
 #define KBWAIT_MASK	(KL_OIA_LOCKED|KL_OIA_TWAIT|KL_DEFERRED_UNLOCK|KL_ENTER_INHIBIT|KL_AWAITING_FIRST)
 #define KBWAIT	(kybdlock & KBWAIT_MASK)
 #define CKBWAIT	(toggled(AID_WAIT) && KBWAIT)
 
+/*
+ * Wakeup generation. Bumped on each event that could satisfy a blocked task
+ * (connection state changes, keyboard lock changes, file transfer completion,
+ * and any task resuming), so that run_taskq() only re-evaluates a wait
+ * condition after something it depends on has happened. Screen contents and
+ * the cursor address are tracked separately, by value.
+ */
+static unsigned long wake_gen = 1;
+
+/* States whose wait conditions are re-evaluated only on a wakeup. */
+#define WAKE_DRIVEN(state) \
+    ((state) == TS_KBWAIT || \
+     (state) == TS_CONNECT_WAIT || \
+     (state) == TS_FT_WAIT || \
+     (state) == TS_WAIT_NVT || \
+     (state) == TS_WAIT_3270 || \
+     (state) == TS_WAIT_OUTPUT || \
+     (state) == TS_SWAIT_OUTPUT || \
+     (state) == TS_WAIT_DISC || \
+     (state) == TS_WAIT_IFIELD || \
+     (state) == TS_WAIT_UNLOCK || \
+     (state) == TS_WAIT_SETTLED || \
+     (state) == TS_WAIT_MATCH)
+
 /* Macro that defines when it's safe to continue a Wait()ing task. */
 #define CAN_PROCEED \
     (IN_SSCP || \
@@ -277,6 +384,7 @@ static action_t Ebcdic1_action;
 static action_t EbcdicField_action;
 static action_t Execute_action;
 static action_t Expect_action;
+static action_t Fields_action;
 static action_t KeyboardDisable_action;
 static action_t Macro_action;
 static action_t NvtText_action;
@@ -331,8 +439,8 @@ trace_task_output(task_t *s, const char *fmt, ...)
     st = msgbuf;
     while ((c = *st++)) {
 	if (c == '\n') {
-	    vtrace("Output for " TASK_NAME_FMT ": '%.*s'\n", TASK_sNAME(s),
-		    (int)((st - 1) - m), m);
+	    vctrace(TC_TASK, "Output for " TASK_NAME_FMT ": '%.*s'\n",
+		    TASK_sNAME(s), (int)((st - 1) - m), m);
 	    m = st;
 	    continue;
 	}
@@ -407,11 +515,170 @@ macros_init(void)
     }
 }
 
+/*
+ * Host write timing, for Wait(Settled).
+ *
+ * Wait(Settled) completes when the keyboard is unlocked and the host has
+ * not written for a quiet interval. The interval is settleTime, or with
+ * settleLearn, one learned for each host: the longest gap seen between a
+ * write that left the keyboard unlocked and a further write that followed
+ * it without any input from us, plus a margin.
+ */
+#define SETTLE_SAMPLES	3	/* unlocking writes seen before trusting */
+#define SETTLE_MIN_MS	20	/* shortest learned interval */
+typedef struct settle_host {
+    struct settle_host *next;	/* linkage */
+    char *host;			/* host name */
+    unsigned long gap_ms;	/* longest trailing-write gap seen */
+    unsigned samples;		/* number of unlocking writes seen */
+} settle_host_t;
+static settle_host_t *settle_hosts = NULL;
+static settle_host_t *settle_current = NULL;
+static struct timeval settle_last_output;	/* time of last host write */
+static bool settle_last_unlocked;	/* last write left keyboard unlocked */
+static uint64_t settle_last_tx;		/* bytes sent as of last write */
+
+/* Return the number of milliseconds since a time. */
+static unsigned long
+settle_ms_since(struct timeval *tv)
+{
+    struct timeval now;
+
+    gettimeofday(&now, NULL);
+    if (now.tv_sec < tv->tv_sec) {
+	return 0;
+    }
+    return ((now.tv_sec - tv->tv_sec) * 1000L) +
+	((now.tv_usec - tv->tv_usec) / 1000L);
+}
+
+/* Return the quiet interval for Wait(Settled), in milliseconds. */
+static unsigned long
+settle_interval(void)
+{
+    unsigned long ms;
+
+    if (!appres.settle_learn || settle_current == NULL ||
+	    settle_current->samples < SETTLE_SAMPLES) {
+	return appres.settle_time_ms;
+    }
+    ms = settle_current->gap_ms + (settle_current->gap_ms / 2);
+    if (ms < SETTLE_MIN_MS) {
+	ms = SETTLE_MIN_MS;
+    }
+    if (ms > (unsigned long)appres.settle_time_ms) {
+	ms = appres.settle_time_ms;
+    }
+    return ms;
+}
+
+/* Note a write from the host. */
+static void
+settle_host_output(void)
+{
+    bool unlocked = !(kybdlock &
+	    (KL_OIA_TWAIT | KL_OIA_LOCKED | KL_AWAITING_FIRST));
+
+    if (settle_current != NULL && settle_last_output.tv_sec != 0) {
+	if (settle_last_unlocked && stats[STAT_BYTES_TX] == settle_last_tx) {
+	    unsigned long gap = settle_ms_since(&settle_last_output);
+
+	    /* A write after the keyboard was unlocked. */
+	    if (gap < (unsigned long)appres.settle_time_ms &&
+		    gap > settle_current->gap_ms) {
+		settle_current->gap_ms = gap;
+		vctrace(TC_TASK, "Settle gap for %s is now %lums\n",
+			settle_current->host, gap);
+	    }
+	} else if (unlocked) {
+	    settle_current->samples++;
+	}
+    }
+    gettimeofday(&settle_last_output, NULL);
+    settle_last_unlocked = unlocked;
+    settle_last_tx = stats[STAT_BYTES_TX];
+}
+
+/* Track the host for Wait(Settled) across connections. */
+static void
+settle_connect(bool connected)
+{
+    settle_host_t *h;
+
+    settle_last_output.tv_sec = 0;
+    settle_current = NULL;
+    if (!connected || current_host == NULL) {
+	return;
+    }
+    for (h = settle_hosts; h != NULL; h = h->next) {
+	if (!strcasecmp(h->host, current_host)) {
+	    break;
+	}
+    }
+    if (h == NULL) {
+	h = (settle_host_t *)Calloc(1, sizeof(settle_host_t));
+	h->host = NewString(current_host);
+	h->next = settle_hosts;
+	settle_hosts = h;
+    }
+    settle_current = h;
+}
+
+/* Timeout for Wait(Settled), to check the quiet interval again. */
+static void
+settle_timed_out(ioid_t id)
+{
+    taskq_t *q;
+    task_t *s;
+
+    FOREACH_LLIST(&taskq, q, taskq_t *) {
+	for (s = q->top; s != NULL; s = s->next) {
+	    if (s->settle_id == id) {
+		s->settle_id = NULL_IOID;
+	    }
+	}
+    } FOREACH_LLIST_END(&taskq, q, taskq_t *);
+    task_wakeup();
+}
+
+/**
+ * Check for the keyboard unlocked and the host quiet, for Wait(Settled).
+ * If the keyboard is unlocked but the host is not yet quiet, set a timeout
+ * to check again.
+ *
+ * @param[in,out] s	Task to check, or NULL
+ *
+ * @return true if settled
+ */
+static bool
+task_settled(task_t *s)
+{
+    unsigned long interval;
+    unsigned long since;
+
+    if (HALF_CONNECTED || KBWAIT) {
+	return false;
+    }
+    if (settle_last_output.tv_sec == 0) {
+	return true;
+    }
+    interval = settle_interval();
+    since = settle_ms_since(&settle_last_output);
+    if (since >= interval) {
+	return true;
+    }
+    if (s != NULL && s->settle_id == NULL_IOID) {
+	s->settle_id = AddTimeOut(interval - since, settle_timed_out);
+    }
+    return false;
+}
+
 /* Callbacks for state changes. */
 static void
-task_connect(bool connected _is_unused)
+task_connect(bool connected)
 {
     macros_init();
+    settle_connect(connected);
 }
 
 static void
@@ -469,6 +736,101 @@ ignore_action(ia_t ia, unsigned argc, const char **argv)
     return true;
 }
 
+/*
+ * Resize the NVT save buffer, keeping the newest data.
+ *
+ * nvt_save_total is not changed, so an Expect() in progress picks up where it
+ * left off, or starts over if the data it was scanning has been discarded.
+ */
+static void
+nvt_save_resize(size_t size)
+{
+    unsigned char *buf;
+    size_t keep = (nvt_save_cnt < size)? nvt_save_cnt: size;
+    size_t ix = (nvt_save_ix + nvt_save_size - keep) % nvt_save_size;
+    size_t i;
+
+    if (size == nvt_save_size) {
+	return;
+    }
+    buf = (unsigned char *)Malloc(size);
+    for (i = 0; i < keep; i++) {
+	buf[i] = nvt_save_buf[(ix + i) % nvt_save_size];
+    }
+    Free(nvt_save_buf);
+    nvt_save_buf = buf;
+    nvt_save_size = size;
+    nvt_save_cnt = keep;
+    nvt_save_ix = (int)(keep % size);
+    vtrace("NVT save buffer is now %zu bytes\n", size);
+}
+
+/* Resize the NVT save buffer to match the resource, if it has changed. */
+static void
+nvt_save_check_size(void)
+{
+    if (appres.nvt_save_size < NVT_SAVE_MIN ||
+	    appres.nvt_save_size > NVT_SAVE_MAX) {
+	appres.nvt_save_size = NVT_SAVE_SIZE;
+    }
+    nvt_save_resize((size_t)appres.nvt_save_size);
+}
+
+/* Extended toggle for the NVT save buffer size. */
+static bool
+nvt_save_size_toggle_upcall(const char *name, const char *value)
+{
+    unsigned long l;
+    char *end;
+
+    if (!*value) {
+	appres.nvt_save_size = NVT_SAVE_SIZE;
+	nvt_save_check_size();
+	return true;
+    }
+
+    l = strtoul(value, &end, 10);
+    if (*end != '\0' || l < NVT_SAVE_MIN || l > NVT_SAVE_MAX) {
+	popup_an_error("Invalid %s value (must be %d..%d)", name, NVT_SAVE_MIN,
+		NVT_SAVE_MAX);
+	return false;
+    }
+    appres.nvt_save_size = (int)l;
+    nvt_save_check_size();
+    return true;
+}
+
+/* The AidWait toggle changed, which can unblock a task. */
+static void
+toggle_aid_wait(toggle_index_t ix _is_unused, enum toggle_type tt _is_unused)
+{
+    task_wakeup();
+}
+
+/* Footprint of the NVT save buffer. */
+static size_t
+nvt_save_footprint(void)
+{
+    return (nvt_save_buf != NULL)? nvt_save_size: 0;
+}
+
+/* Footprint of the task stacks. */
+static size_t
+task_footprint(void)
+{
+    taskq_t *q;
+    task_t *s;
+    size_t bytes = 0;
+
+    FOREACH_LLIST(&taskq, q, taskq_t *) {
+	bytes += sizeof(taskq_t);
+	for (s = q->top; s != NULL; s = s->next) {
+	    bytes += sizeof(task_t);
+	}
+    } FOREACH_LLIST_END(&taskq, q, taskq_t *);
+    return bytes;
+}
+
 /**
  * Task module registration.
  */
@@ -489,6 +851,7 @@ task_register(void)
 	{ AnEbcdicField,	EbcdicField_action, 0 },
 	{ AnExecute,		Execute_action, ACTION_KE },
 	{ AnExpect,		Expect_action, 0 },
+	{ AnFields,		Fields_action, 0 },
 	{ Anignore,		ignore_action, ACTION_KE },
 	{ AnInfo,		Info_action, 0 },
 	{ AnKeyboardDisable,	KeyboardDisable_action, 0 },
@@ -508,15 +871,25 @@ task_register(void)
 	{ AnPrinter,		Printer_action, ACTION_KE },
     };
     static toggle_register_t toggles[] = {
-	{ AID_WAIT,	NULL,	0 }
+	{ AID_WAIT,	toggle_aid_wait,	0 }
     };
     static xres_t task_xresources[] = {
 	{ ResMacros,		V_WILD },
     };
+    static footprint_t footprints[] = {
+	{ "nvt-save",		nvt_save_footprint,	false },
+	{ "tasks",		task_footprint,		false }
+    };
 
     /* Register for state changes. */
     register_schange_ordered(ST_CONNECT, task_connect, 2000);
     register_schange_ordered(ST_3270_MODE, task_in3270, 2000);
+    register_schange(ST_CODEPAGE, task_codepage_changed);
+    register_schange(ST_NEGOTIATING, task_status_changed);
+    register_schange(ST_CONNECT, task_status_changed);
+    register_schange(ST_3270_MODE, task_status_changed);
+    register_schange(ST_LINE_MODE, task_status_changed);
+    register_schange(ST_REMODEL, task_status_changed);
 
     /* Register actions.*/
     register_actions(task_actions, array_count(task_actions));
@@ -530,14 +903,38 @@ task_register(void)
     /* Register extended toggle. */
     register_extended_toggle(ResScriptPort, scriptport_toggle_upcall, NULL,
 	   canonical_bind_opt_res, (void **)&appres.script_port, XRM_STRING);
+    register_extended_toggle(ResNvtSaveSize, nvt_save_size_toggle_upcall,
+	    NULL, NULL, (void **)&appres.nvt_save_size, XRM_INT);
 
     /* Register resources. */
     register_xresources(task_xresources, array_count(task_xresources));
 
+    /* Register the buffer sizes. */
+    register_footprints(footprints, array_count(footprints));
+
+    /* Register the request span module. */
+    spans_register();
+
     /* This doesn't go here, but it needs to happen once. */
     nvt_save_buf = (unsigned char *)Malloc(NVT_SAVE_SIZE);
 }
 
+/*
+ * Add a task to (delta 1) or remove it from (delta -1) the count for its
+ * state.
+ */
+static void
+task_count(task_t *s, int delta)
+{
+    if (s->state >= MIN_WAITING_STATE) {
+	n_blocked += delta;
+    } else if (s->state == TS_IDLE) {
+	n_queued += delta;
+    } else {
+	n_running += delta;
+    }
+}
+
 /**
  * Set the state of a task.
  *
@@ -549,14 +946,50 @@ static void
 task_set_state(task_t *s, enum task_state state, const char *why)
 {
     if (s->state != state) {
-	vtrace(TASK_NAME_FMT " %s -> %s (%s)\n", TASK_sNAME(s),
+	vctrace(TC_TASK, TASK_NAME_FMT " %s -> %s (%s)\n", TASK_sNAME(s),
 		task_state_name[s->state],
 		task_state_name[state],
 		why);
+	task_count(s, -1);
 	s->state = state;
+	task_count(s, 1);
+	s->wake_gen = 0;
     }
 }
 
+/**
+ * Note an event that could allow a blocked task to proceed.
+ */
+void
+task_wakeup(void)
+{
+    wake_gen++;
+}
+
+/**
+ * Check for a task that has already been checked since the last relevant
+ * event, and stamp it as checked.
+ *
+ * @param[in,out] s	task to check
+ *
+ * @return true if the task's wait condition cannot have changed
+ */
+static bool
+task_still_blocked(task_t *s)
+{
+    if (!WAKE_DRIVEN(s->state)) {
+	return false;
+    }
+    if (s->wake_gen == wake_gen && s->wake_screen == screen_generation &&
+	    s->wake_cursor == cursor_addr) {
+	return true;
+    }
+    s->wake_gen = wake_gen;
+    s->wake_screen = screen_generation;
+    s->wake_cursor = cursor_addr;
+    return false;
+}
+
 /* Allocate a new task. */
 static task_t *
 new_task(enum task_type type, taskq_t *q)
@@ -573,9 +1006,11 @@ new_task(enum task_type type, taskq_t *q)
     s->success = true;
     s->expect_id = NULL_IOID;
     s->wait_id = NULL_IOID;
+    s->settle_id = NULL_IOID;
     gettimeofday(&s->t0, NULL);
     s->child_msec = 0L;
     s->fatal = false;
+    task_count(s, 1);
 
     return s;
 }
@@ -586,25 +1021,8 @@ new_task(enum task_type type, taskq_t *q)
 static void
 task_status_set(void)
 {
-    taskq_t *q;
-    bool any = false;
-
-    FOREACH_LLIST(&taskq, q, taskq_t *) {
-	task_t *s;
-
-	for (s = q->top; s != NULL; s = s->next) {
-	    if (!s->is_ui) {
-		any = true;
-		break;
-	    }
-	}
-	if (any) {
-	    break;
-	}
-    } FOREACH_LLIST_END(&taskq, q, taskq_t *);
-
-    menubar_as_set(any);
-    vstatus_script(any);
+    menubar_as_set(n_script > 0);
+    vstatus_script(n_script > 0);
 }
 
 /*
@@ -618,6 +1036,9 @@ task_push_onto(taskq_t *q, enum task_type type, bool is_ui)
 
     s = new_task(type, q);
     s->is_ui = is_ui;
+    if (!is_ui) {
+	n_script++;
+    }
     q->top = s;
     if (current_task != NULL && q == current_task->taskq) {
 	current_task = s;
@@ -644,10 +1065,32 @@ free_task(task_t *t)
     if (t->wait_id != NULL_IOID) {
 	RemoveTimeOut(t->wait_id);
     }
+    if (t->settle_id != NULL_IOID) {
+	RemoveTimeOut(t->settle_id);
+    }
+
+    /* Take it out of the counts and the callback hash. */
+    task_count(t, -1);
+    if (!t->is_ui) {
+	n_script--;
+    }
+    if (t->type == ST_CB) {
+	task_t **p;
+
+	for (p = &cb_hash[CB_HASH_IX(t->cbx.handle)]; *p != NULL;
+		p = &(*p)->cbx.hash_next) {
+	    if (*p == t) {
+		*p = t->cbx.hash_next;
+		break;
+	    }
+	}
+	span_done(t->cbx.span, t->success);
+    }
 
     /* Free auxiliary buffers. */
     Replace(t->macro.msc, NULL);
-    Replace(t->expect.text, NULL);
+    expect_free(t);
+    match_free(t);
     
     /* Free the structure. */
     Free(t);
@@ -661,7 +1104,7 @@ task_pop(void)
     unsigned long msec;
     struct timeval t1;
 
-    vtrace(TASK_NAME_FMT " complete, %s\n", TASK_NAME,
+    vctrace(TC_TASK, TASK_NAME_FMT " complete, %s\n", TASK_NAME,
 	    current_task->success? "success": "failure");
 
     /*
@@ -688,7 +1131,7 @@ task_pop(void)
 	taskq_t *q = current_task->taskq;
 
 	assert(q != NULL);
-	vtrace("CB(%s)[#%u] complete\n", q->name, q->index);
+	vctrace(TC_TASK, "CB(%s)[#%u] complete\n", q->name, q->index);
 
 	/* Do not delete the taskq yet -- someone might be walking it. */
 	q->top = NULL;
@@ -797,15 +1240,281 @@ cleanup_socket(bool b _is_unused)
 }
 #endif /*]*/
 
+enum em_stat { EM_CONTINUE, EM_ERROR };
+
+/*
+ * Cache of parsed commands.
+ *
+ * Commands run from Source() files and macro definitions are usually the
+ * same text over and over. The first time a command is parsed, its action
+ * and parameters are saved here, keyed by the command text, and later runs
+ * skip the parser and action lookup.
+ */
+#define CMD_CACHE_HASH		256	/* must be a power of 2 */
+#define CMD_CACHE_MAX		512	/* maximum number of entries */
+#define CMD_CACHE_TEXT_MAX	1024	/* longest command text cached */
+typedef struct cmd_cache {
+    llist_t llist;		/* LRU linkage, most recent first */
+    struct cmd_cache *hash_next; /* hash chain */
+    unsigned hash;		/* hash of text */
+    size_t text_len;		/* length of text */
+    char *text;			/* command text, to the end of the line */
+    size_t consumed;		/* length of the first command in text */
+    action_elt_t *action;	/* resolved action */
+    unsigned generation;	/* actions_generation when resolved */
+    unsigned param_count;	/* number of parameters */
+    const char **params;	/* parameters */
+    int busy;			/* nonzero while the action is running */
+} cmd_cache_t;
+static cmd_cache_t *cmd_cache_hash[CMD_CACHE_HASH];
+static llist_t cmd_cache_lru = LLIST_INIT(cmd_cache_lru);
+static unsigned cmd_cache_count = 0;
+
+/* Hash command text (FNV-1a). */
+static unsigned
+cmd_cache_hash_text(const char *text, size_t len)
+{
+    unsigned h = 2166136261U;
+    size_t i;
+
+    for (i = 0; i < len; i++) {
+	h = (h ^ (unsigned char)text[i]) * 16777619U;
+    }
+    return h;
+}
+
+/* Remove an entry from the command cache and free it. */
+static void
+cmd_cache_free(cmd_cache_t *cc)
+{
+    cmd_cache_t **p;
+
+    for (p = &cmd_cache_hash[cc->hash & (CMD_CACHE_HASH - 1)]; *p != NULL;
+	    p = &(*p)->hash_next) {
+	if (*p == cc) {
+	    *p = cc->hash_next;
+	    break;
+	}
+    }
+    llist_unlink(&cc->llist);
+    cmd_cache_count--;
+    Free(cc);
+}
+
+/**
+ * Look up a command in the cache.
+ *
+ * @param[in] text	Command text
+ *
+ * @return Cache entry, or NULL
+ */
+static cmd_cache_t *
+cmd_cache_find(const char *text)
+{
+    size_t len = strlen(text);
+    unsigned h;
+    cmd_cache_t *cc;
+
+    if (len > CMD_CACHE_TEXT_MAX) {
+	return NULL;
+    }
+    h = cmd_cache_hash_text(text, len);
+    for (cc = cmd_cache_hash[h & (CMD_CACHE_HASH - 1)]; cc != NULL;
+	    cc = cc->hash_next) {
+	if (cc->hash == h && cc->text_len == len &&
+		!memcmp(cc->text, text, len)) {
+	    break;
+	}
+    }
+    if (cc == NULL) {
+	return NULL;
+    }
+    if (cc->generation != actions_generation) {
+	/* New actions could change what an abbreviation means. */
+	if (!cc->busy) {
+	    cmd_cache_free(cc);
+	}
+	return NULL;
+    }
+
+    /* Move it to the front of the LRU list. */
+    llist_unlink(&cc->llist);
+    LLIST_PREPEND(&cc->llist, cmd_cache_lru);
+    return cc;
+}
+
+/**
+ * Add a parsed command to the cache.
+ *
+ * @param[in] text		Command text
+ * @param[in] consumed		Length of the first command in text
+ * @param[in] action		Resolved action
+ * @param[in] param_count	Number of parameters
+ * @param[in] params		Parameters
+ */
+static void
+cmd_cache_store(const char *text, size_t consumed, action_elt_t *action,
+	unsigned param_count, const char **params)
+{
+    size_t len = strlen(text);
+    size_t size;
+    cmd_cache_t *cc;
+    char *p;
+    unsigned i;
+
+    if (len > CMD_CACHE_TEXT_MAX) {
+	return;
+    }
+
+    /* Make room, skipping entries that are running. */
+    if (cmd_cache_count >= CMD_CACHE_MAX) {
+	llist_t *l;
+
+	for (l = cmd_cache_lru.prev; l != &cmd_cache_lru; l = l->prev) {
+	    if (!((cmd_cache_t *)l)->busy) {
+		cmd_cache_free((cmd_cache_t *)l);
+		break;
+	    }
+	}
+	if (cmd_cache_count >= CMD_CACHE_MAX) {
+	    return;
+	}
+    }
+
+    /* Allocate the entry, parameter array and strings in one block. */
+    size = sizeof(cmd_cache_t) + (param_count * sizeof(const char *)) +
+	len + 1;
+    for (i = 0; i < param_count; i++) {
+	size += strlen(params[i]) + 1;
+    }
+    cc = (cmd_cache_t *)Malloc(size);
+    cc->params = (const char **)(cc + 1);
+    p = (char *)(cc->params + param_count);
+    cc->text = p;
+    memcpy(p, text, len + 1);
+    p += len + 1;
+    for (i = 0; i < param_count; i++) {
+	size_t sl = strlen(params[i]) + 1;
+
+	memcpy(p, params[i], sl);
+	cc->params[i] = p;
+	p += sl;
+    }
+    cc->text_len = len;
+    cc->hash = cmd_cache_hash_text(text, len);
+    cc->consumed = consumed;
+    cc->action = action;
+    cc->generation = actions_generation;
+    cc->param_count = param_count;
+    cc->busy = 0;
+    cc->hash_next = cmd_cache_hash[cc->hash & (CMD_CACHE_HASH - 1)];
+    cmd_cache_hash[cc->hash & (CMD_CACHE_HASH - 1)] = cc;
+    llist_init(&cc->llist);
+    LLIST_PREPEND(&cc->llist, cmd_cache_lru);
+    cmd_cache_count++;
+}
+
+/*
+ * Find the request span for the running task: that of the nearest cb
+ * beneath it on its stack.
+ */
+static span_t *
+task_span(void)
+{
+    task_t *s;
+
+    if (!span_active()) {
+	return NULL;
+    }
+    for (s = current_task; s != NULL; s = s->next) {
+	if (s->type == ST_CB && s->cbx.span != NULL) {
+	    return s->cbx.span;
+	}
+    }
+    return NULL;
+}
+
+/*
+ * Execute a command from the cache.
+ */
+static enum em_stat
+execute_cached(enum iaction cause, cmd_cache_t *cc, char *s, char **np,
+	char *buf, size_t buflen)
+{
+    size_t alen;
+    span_t *prev_span;
+
+    if (cc->action->t.ia_restrict != IA_NONE &&
+	    cause != cc->action->t.ia_restrict) {
+	popup_an_error("Action %s is invalid in this context",
+		cc->action->t.name);
+	return EM_ERROR;
+    }
+
+    *np = s + cc->consumed;
+
+    /* Record the action. */
+    alen = cc->consumed;
+    if (alen > buflen - 1) {
+	alen = buflen - 1;
+    }
+    strncpy(buf, s, alen);
+    buf[alen] = '\0';
+
+    cc->busy++;
+    prev_span = span_enter(task_span());
+    run_action_entry(cc->action, cause, cc->param_count,
+	    cc->param_count? cc->params: NULL);
+    span_leave(prev_span);
+    cc->busy--;
+
+    /* Refresh the screen, in case the action changed it. */
+    screen_disp(false);
+
+    /* If it produced an error message, it failed. */
+    if (!current_task->success) {
+	return EM_ERROR;
+    }
+
+    trace_rollover_check();
+
+    return EM_CONTINUE;
+}
+
+/*
+ * Command arena: the action name and parameters of the command being
+ * parsed, each NUL-terminated and unescaped, and the parameter array. It
+ * is reused for each command. Unescaping never makes text longer, so the
+ * remaining length of the command is enough room.
+ */
+typedef struct {
+    char *text;			/* name and parameters */
+    size_t text_size;		/* allocated size of text */
+    const char **params;	/* parameter array */
+    unsigned params_size;	/* allocated size of params */
+} cmd_arena_t;
+static cmd_arena_t cmd_arena;
+static bool cmd_arena_busy = false;
+
+/* Finish with a command arena. */
+static void
+cmd_arena_release(cmd_arena_t *arena)
+{
+    if (arena == &cmd_arena) {
+	cmd_arena_busy = false;
+    } else {
+	Replace(arena->text, NULL);
+	Replace(arena->params, NULL);
+    }
+}
+
 /*
  * Interpret and execute a script or macro command.
  */
-enum em_stat { EM_CONTINUE, EM_ERROR };
 static enum em_stat
 execute_command(enum iaction cause, char *s, char **np, char *buf,
 	size_t buflen)
 {
-#   define MAX_ANAME	64
     enum {
 	ME_GND,		/* before action name */
 	ME_COMMENT,	/* within a comment */
@@ -825,18 +1534,19 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
 	ME_S_PARMx	/* space: saw whitespace after parameter */
     } state = ME_GND;
     char c;
-    char aname[MAX_ANAME+1];
-    int nx = 0;
+    cmd_arena_t local_arena = { NULL, 0, NULL, 0 };
+    cmd_arena_t *arena;
+    char *aname;		/* action name */
+    char *wp;			/* write pointer into the arena */
+    size_t len;
     unsigned param_count = 0;		/* parameter count */
-    unsigned vbcount = 0;	/* allocated parameter count */
-    varbuf_t *r = NULL;		/* accumulated parameters */
     int failreason = 0;
-    action_elt_t *e;
     action_elt_t *any = NULL;
-    action_elt_t *exact = NULL;
     unsigned i;
     enum em_stat rc = EM_ERROR;	/* failure return code */
     char *s_orig = s;
+    cmd_cache_t *cc;
+    span_t *prev_span;
     static const char *fail_text[] = {
 	/*1*/ "Action name must begin with an alphanumeric character",
 	/*2*/ "Syntax error in action name",
@@ -846,15 +1556,27 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
 	/*6*/ "Syntax error: unclosed \""
     };
 #define fail(n) { failreason = n; goto failure; }
+#define ADD(c)		*wp++ = (c)
+#define END_PARM()	{ *wp++ = '\0'; param_count++; }
 
-    while ((c = *s++)) {
+    if ((cc = cmd_cache_find(s)) != NULL) {
+	return execute_cached(cause, cc, s, np, buf, buflen);
+    }
 
-	if ((param_count + 1) > vbcount) {
-	    /* Allocate a varbuf for the next parameter. */
-	    r = (varbuf_t *)Realloc(r, (param_count + 1) * sizeof(varbuf_t));
-	    vb_init(&r[param_count]);
-	    vbcount = param_count + 1;
-	}
+    /*
+     * Use the shared arena, unless an action run from here has come back
+     * for another command.
+     */
+    arena = cmd_arena_busy? &local_arena: &cmd_arena;
+    cmd_arena_busy = true;
+    len = strlen(s);
+    if (arena->text_size < len + 2) {
+	arena->text_size = len + 2;
+	Replace(arena->text, (char *)Malloc(arena->text_size));
+    }
+    aname = wp = arena->text;
+
+    while ((c = *s++)) {
 
 	switch (state) {
 	case ME_GND:
@@ -862,8 +1584,7 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
 		continue;
 	    } else if (isalnum((unsigned char)c)) {
 		state = ME_FUNCTION;
-		nx = 0;
-		aname[nx++] = c;
+		ADD(c);
 	    } else if (c == '!' || c == '#') {
 		state = ME_COMMENT;
 	    } else {
@@ -874,17 +1595,14 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
 	    break;
 	case ME_FUNCTION:	/* within function name */
 	    if (c == '(' || isspace((unsigned char)c)) {
-		aname[nx] = '\0';
+		ADD('\0');
 		if (c == '(') {
-		    nx = 0;
 		    state = ME_LPAREN;
 		} else {
 		    state = ME_FUNCTIONx;
 		}
 	    } else if (isalnum((unsigned char)c) || c == '_' || c == '-') {
-		if (nx < MAX_ANAME) {
-		    aname[nx++] = c;
-		}
+		ADD(c);
 	    } else {
 		fail(2);
 	    }
@@ -893,15 +1611,12 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
 	    if (isspace((unsigned char)c)) {
 		continue;
 	    } else if (c == '(') {
-		nx = 0;
 		state = ME_LPAREN;
 	    } else if (c == '"') {
-		nx = 0;
 		state = ME_S_QPARM;
 	    } else {
 		state = ME_S_PARM;
-		nx = 0;
-		vb_append(&r[param_count], &c, 1);
+		ADD(c);
 	    }
 	    break;
 	case ME_LPAREN:
@@ -911,60 +1626,60 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
 	    } else if (c == '"') {
 		state = ME_P_QPARM;
 	    } else if (c == ',') {
-		param_count++;
+		END_PARM();
 		state = ME_LPAREN_COMMA;
 	    } else if (c == ')') {
 		goto success;
 	    } else {
 		state = ME_P_PARM;
-		vb_append(&r[param_count], &c, 1);
+		ADD(c);
 	    }
 	    break;
 	case ME_P_PARM:
 	    if (isspace((unsigned char)c)) {
-		param_count++;
+		END_PARM();
 		state = ME_P_PARMx;
 	    } else if (c == ')') {
-		param_count++;
+		END_PARM();
 		goto success;
 	    } else if (c == ',') {
-		param_count++;
+		END_PARM();
 		state = ME_LPAREN_COMMA;
 	    } else {
-		vb_append(&r[param_count], &c, 1);
+		ADD(c);
 	    }
 	    break;
 	case ME_P_BSL:
 	    if (c != '"') {
-		vb_append(&r[param_count], "\\", 1);
+		ADD('\\');
 	    }
 	    if (c == '\\') {
 		state = ME_P_BSL2;
 	    } else {
-		vb_append(&r[param_count], &c, 1);
+		ADD(c);
 		state = ME_P_QPARM;
 	    }
 	    break;
 	case ME_P_BSL2:
 	    if (c == '"') {
-		param_count++;
+		END_PARM();
 		state = ME_P_PARMx;
 	    } else {
-		vb_append(&r[param_count], "\\", 1);
+		ADD('\\');
 		if (c != '\\') {
-		    vb_append(&r[param_count], &c, 1);
+		    ADD(c);
 		    state = ME_P_QPARM;
 		}
 	    }
 	    break;
 	case ME_P_QPARM:
 	    if (c == '"') {
-		param_count++;
+		END_PARM();
 		state = ME_P_PARMx;
 	    } else if (c == '\\') {
 		state = ME_P_BSL;
 	    } else {
-		vb_append(&r[param_count], &c, 1);
+		ADD(c);
 	    }
 	    break;
 	case ME_P_PARMx:
@@ -980,43 +1695,43 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
 	    break;
 	case ME_S_PARM:
 	    if (isspace((unsigned char)c)) {
-		param_count++;
+		END_PARM();
 		state = ME_S_PARMx;
 	    } else {
-		vb_append(&r[param_count], &c, 1);
+		ADD(c);
 	    }
 	    break;
 	case ME_S_BSL:
 	    if (c != '"') {
-		vb_append(&r[param_count], "\\", 1);
+		ADD('\\');
 	    }
 	    if (c == '\\') {
 		state = ME_S_BSL2;
 	    } else {
-		vb_append(&r[param_count], &c, 1);
+		ADD(c);
 		state = ME_S_QPARM;
 	    }
 	    break;
 	case ME_S_BSL2:
 	    if (c == '"') {
-		param_count++;
+		END_PARM();
 		state = ME_S_PARMx;
 	    } else {
-		vb_append(&r[param_count], "\\", 1);
+		ADD('\\');
 		if (c != '\\') {
-		    vb_append(&r[param_count], &c, 1);
+		    ADD(c);
 		    state = ME_S_QPARM;
 		}
 	    }
 	    break;
 	case ME_S_QPARM:
 	    if (c == '"') {
-		param_count++;
+		END_PARM();
 		state = ME_S_PARMx;
 	    } else if (c == '\\') {
 		state = ME_S_BSL;
 	    } else {
-		vb_append(&r[param_count], &c, 1);
+		ADD(c);
 	    }
 	    break;
 	case ME_S_PARMx:
@@ -1025,7 +1740,7 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
 	    } else if (c == '"') {
 		state = ME_S_QPARM;
 	    } else {
-		vb_append(&r[param_count], &c, 1);
+		ADD(c);
 		state = ME_S_PARM;
 	    }
 	    break;
@@ -1035,7 +1750,7 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
     /* Terminal state. */
     switch (state) {
     case ME_FUNCTION:	/* mid-function-name */
-	aname[nx] = '\0';
+	ADD('\0');
 	break;
     case ME_FUNCTIONx:	/* space after function */
 	break;
@@ -1049,7 +1764,7 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
     case ME_S_PARMx:	/* space after space-style parameter */
 	break;
     case ME_S_PARM:	/* mid space-style parameter */
-	param_count++;
+	END_PARM();
 	break;
     case ME_S_QPARM:	/* inside quoted parameter */
     case ME_P_QPARM:
@@ -1064,7 +1779,7 @@ execute_command(enum iaction cause, char *s, char **np, char *buf,
 
 success:
     if (state == ME_LPAREN_COMMA) {
-	param_count++;
+	END_PARM();
     }
 
     if (c) {
@@ -1098,23 +1813,16 @@ success:
      * should be added that include the substitutions.
      */
 
-    /* Search the action list. */
-    FOREACH_LLIST(&actions_list, e, action_elt_t *) {
-	if (!strcasecmp(aname, e->t.name)) {
-	    exact = any = e;
-	    break;
+    /* Look up the action, by exact name or by abbreviation. */
+    any = lookup_action(aname);
+    if (any == NULL) {
+	bool ambiguous;
+
+	any = lookup_action_prefix(aname, &ambiguous);
+	if (ambiguous) {
+	    popup_an_error("Ambiguous action name: %s", aname);
+	    goto silent_failure;
 	}
-    } FOREACH_LLIST_END(&actions_list, e, action_elt_t *);
-    if (exact == NULL) {
-	FOREACH_LLIST(&actions_list, e, action_elt_t *) {
-	    if (!strncasecmp(aname, e->t.name, strlen(aname))) {
-		if (any != NULL) {
-		    popup_an_error("Ambiguous action name: %s", aname);
-		    goto silent_failure;
-		}
-		any = e;
-	    }
-	} FOREACH_LLIST_END(&actions_list, e, action_elt_t *);
     }
 
     if (any != NULL) {
@@ -1128,13 +1836,24 @@ success:
 	}
 
 	if (param_count) {
-	    /* Create the parameter array. */
-	    params = (const char **)Malloc(param_count * sizeof(const char *));
+	    /* Point the parameter array at the text after the name. */
+	    char *p = aname + strlen(aname) + 1;
+
+	    if (arena->params_size < param_count) {
+		arena->params_size = param_count;
+		Replace(arena->params, (const char **)Malloc(param_count *
+			    sizeof(const char *)));
+	    }
+	    params = arena->params;
 	    for (i = 0; i < param_count; i++) {
-		params[i] = vb_buf(&r[i])? vb_buf(&r[i]) : NewString("");
+		params[i] = p;
+		p += strlen(p) + 1;
 	    }
 	}
 
+	/* Save it for next time. */
+	cmd_cache_store(s_orig, *np - s_orig, any, param_count, params);
+
 	/* Record the action. */
 	alen = *np - s_orig;
 	if (alen > buflen - 1) {
@@ -1143,17 +1862,12 @@ success:
 	strncpy(buf, s_orig, alen);
 	buf[alen] = '\0';
 
+	prev_span = span_enter(task_span());
 	run_action_entry(any, cause, param_count, param_count? params: NULL);
+	span_leave(prev_span);
 
-	if (vbcount) {
-	    /* Free the varbuf array. */
-	    Free((char *)params);
-	    for (i = 0; i < vbcount; i++) {
-		vb_free(&r[i]);
-	    }
-	    Free(r);
-	    r = NULL;
-	}
+	/* Done with the arena. */
+	cmd_arena_release(arena);
 
 	/* Refresh the screen, in case the action changed it. */
 	screen_disp(false);
@@ -1175,14 +1889,11 @@ failure:
     popup_an_error("%s at column %d", fail_text[failreason-1],
 	    (int)(s - s_orig) );
 silent_failure:
-    if (vbcount) {
-	for (i = 0; i < vbcount; i++) {
-	    vb_free(&r[i]);
-	}
-	Free(r);
-    }
+    cmd_arena_release(arena);
     return rc;
 
+#undef END_PARM
+#undef ADD
 #undef fail
 }
 
@@ -1240,7 +1951,7 @@ run_macro(void)
     enum em_stat es;
     bool fatal = false;
 
-    vtrace(TASK_NAME_FMT " running\n", TASK_NAME);
+    vctrace(TC_TASK, TASK_NAME_FMT " running\n", TASK_NAME);
 
     /*
      * Keep executing commands off the line until one pauses or
@@ -1255,7 +1966,7 @@ run_macro(void)
 	 * Check for command failure.
 	 */
 	if (!s->success) {
-	    vtrace(TASK_NAME_FMT " failed\n", TASK_NAME);
+	    vctrace(TC_TASK, TASK_NAME_FMT " failed\n", TASK_NAME);
 
 	    /* Propagate it. */
 	    if (s->next != NULL) {
@@ -1265,7 +1976,7 @@ run_macro(void)
 	}
 
 	task_set_state(s, TS_RUNNING, "executing");
-	vtrace(TASK_NAME_FMT " '%s'\n", TASK_NAME, no_ctrl(a));
+	vctrace(TC_TASK, TASK_NAME_FMT " '%s'\n", TASK_NAME, no_ctrl(a));
 	s->success = true;
 
 	if (s->type == ST_MACRO &&
@@ -1289,7 +2000,7 @@ run_macro(void)
 
 	/* Macro could not execute.  Abort it. */
 	if (es == EM_ERROR) {
-	    vtrace(TASK_NAME_FMT " error\n", TASK_NAME);
+	    vctrace(TC_TASK, TASK_NAME_FMT " error\n", TASK_NAME);
 
 	    /* Propagate it. */
 	    s->success = false;
@@ -1416,15 +2127,21 @@ push_cb(const char *buf, size_t len, const tcb_t *cb, task_cbh handle)
 	q->output_wait_needed = find_owait(cb);
 	LLIST_APPEND(&q->llist, taskq);
 	name = q->unique_name = xs_buffer("CB(%s)[#%u]", q->name, q->index);
-	vtrace("%s started%s\n", name, q->output_wait_needed? " (owait)": "");
+	vctrace(TC_TASK, "%s started%s\n", name,
+		q->output_wait_needed? " (owait)": "");
     } else {
 	q = current_task->taskq;
     }
+    if (buf) {
+	q->usage.bytes_in += len;
+    }
 
     /* Push a callback. */
     s = task_push_onto(q, ST_CB, is_ui);
     s->cbx.cb = cb;
     s->cbx.handle = handle;
+    s->cbx.hash_next = cb_hash[CB_HASH_IX(handle)];
+    cb_hash[CB_HASH_IX(handle)] = s;
     if (name == NULL) {
 	name = lazyaf(TASK_NAME_FMT, TASK_sNAME(s));
     }
@@ -1460,18 +2177,13 @@ push_cb(const char *buf, size_t len, const tcb_t *cb, task_cbh handle)
 static task_t *
 task_find_cb(task_cbh handle)
 {
-    taskq_t *q;
-
-    FOREACH_LLIST(&taskq, q, taskq_t *) {
-	task_t *s;
+    task_t *s;
 
-	for (s = q->top; s != NULL; s = s->next) {
-	    if (s->type == ST_CB && s->cbx.handle == handle) {
-		return s;
-	    }
+    for (s = cb_hash[CB_HASH_IX(handle)]; s != NULL; s = s->cbx.hash_next) {
+	if (s->cbx.handle == handle) {
+	    return s;
 	}
-    } FOREACH_LLIST_END(&taskq, q, taskq_t *);
-
+    }
     return NULL;
 }
 
@@ -1525,6 +2237,7 @@ task_result(task_t *s, const char *msg, bool success)
 	sl--;
     }
     trace_task_output(s, "%.*s\n", (int)sl, text);
+    s->taskq->usage.bytes_out += sl;
     (*s->cbx.cb->data)(s->cbx.handle, text, sl, success);
 
     Free(text);
@@ -1581,6 +2294,7 @@ task_info(const char *fmt, ...)
 	    if ((s = task_redirect_to()) != NULL) {
 		assert(s->type == ST_CB);
 		trace_task_output(current_task, "%.*s\n", nc, msg);
+		s->taskq->usage.bytes_out += nc;
 		(*s->cbx.cb->data)(s->cbx.handle, msg, nc, true);
 	    } else {
 		fprintf(stderr, "%.*s\n", (int)nc, msg);
@@ -1600,7 +2314,7 @@ task_info(const char *fmt, ...)
 static void
 task_disconnect_abort(task_t *s)
 {
-    vtrace("Canceling " TASK_NAME_FMT "\n", TASK_sNAME(s));
+    vctrace(TC_TASK, "Canceling " TASK_NAME_FMT "\n", TASK_sNAME(s));
 
     assert(s->type == ST_MACRO);
     assert(s->next != NULL);
@@ -1703,19 +2417,55 @@ connect_errno(int e, const char *fmt, ...)
 }
 
 /**
- * Run one task queue.
+ * Return the CPU time used by the process, in microseconds.
+ *
+ * @return CPU time
+ */
+static uint64_t
+cpu_usec(void)
+{
+#if defined(_WIN32) /*[*/
+    FILETIME create, exit, kernel, user;
+    ULARGE_INTEGER k, u;
+
+    if (!GetProcessTimes(GetCurrentProcess(), &create, &exit, &kernel,
+		&user)) {
+	return 0;
+    }
+    k.LowPart = kernel.dwLowDateTime;
+    k.HighPart = kernel.dwHighDateTime;
+    u.LowPart = user.dwLowDateTime;
+    u.HighPart = user.dwHighDateTime;
+    return (k.QuadPart + u.QuadPart) / 10;
+#else /*][*/
+# if defined(CLOCK_PROCESS_CPUTIME_ID) /*[*/
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts) == 0) {
+	return (ts.tv_sec * (uint64_t)1000000) + (ts.tv_nsec / 1000);
+    }
+# endif /*]*/
+    return (uint64_t)clock() * 1000000 / CLOCKS_PER_SEC;
+#endif /*]*/
+}
+
+/**
+ * Run the tasks on the current task queue.
+ *
+ * @param[out] t0	CPU time when the first task was restarted
+ * @param[out] started	set to true when the first task is restarted
  *
  * @return True if one or more tasks were processed.
  */
 static bool
-run_taskq(void)
+run_taskq_tasks(uint64_t *t0, bool *started)
 {
     bool any = false;
 
     while (true) {
 	bool need_run = false;
 
-	if (current_task == NULL) {
+	if (current_task == NULL || task_still_blocked(current_task)) {
 	    return any;
 	}
 
@@ -1768,6 +2518,17 @@ run_taskq(void)
 	    }
 	    break;
 
+	case TS_WAIT_SETTLED:
+	    if (!PCONNECTED) {
+		task_disconnect_abort(current_task);
+		any = true;
+		break;
+	    }
+	    if (!task_settled(current_task)) {
+		return any;
+	    }
+	    break;
+
 	case TS_WAIT_IFIELD:
 	    if (!PCONNECTED) {
 		task_disconnect_abort(current_task);
@@ -1821,6 +2582,19 @@ run_taskq(void)
 		return any;
 	    }
 
+	case TS_WAIT_MATCH:
+	    if (!PCONNECTED) {
+		match_free(current_task);
+		task_disconnect_abort(current_task);
+		any = true;
+		break;
+	    }
+	    if (match_screen(current_task)) {
+		any = true;
+		break;
+	    }
+	    return any;
+
 	case TS_EXPECTING:
 	    if (!PCONNECTED) {
 		task_disconnect_abort(current_task);
@@ -1843,6 +2617,11 @@ run_taskq(void)
 	/* Restart the task. */
 
 	any = true;
+	if (!*started) {
+	    *t0 = cpu_usec();
+	    *started = true;
+	}
+	task_wakeup();
 
 	task_set_state(current_task, TS_IDLE, "about to resume");
 
@@ -1850,6 +2629,10 @@ run_taskq(void)
 	    RemoveTimeOut(current_task->wait_id);
 	    current_task->wait_id = NULL_IOID;
 	}
+	if (current_task->settle_id != NULL_IOID) {
+	    RemoveTimeOut(current_task->settle_id);
+	    current_task->settle_id = NULL_IOID;
+	}
 
 	switch (current_task->type) {
 	case ST_MACRO:
@@ -1868,6 +2651,48 @@ run_taskq(void)
     return any;
 }
 
+/**
+ * Run one task queue, charging what it uses to the queue.
+ *
+ * @param[in,out] q	Task queue
+ *
+ * @return True if one or more tasks were processed.
+ */
+static bool
+run_taskq(taskq_t *q)
+{
+    uint64_t t0 = 0;
+    bool started = false;
+    uint64_t actions = stats[STAT_ACTIONS];
+    bool any;
+
+    current_task = q->top;
+    any = run_taskq_tasks(&t0, &started);
+    if (started) {
+	q->usage.cpu_usec += cpu_usec() - t0;
+    }
+    if (any) {
+	q->usage.wakeups++;
+	q->usage.actions += stats[STAT_ACTIONS] - actions;
+    }
+    return any;
+}
+
+/**
+ * Remember the usage of a task queue that has completed.
+ *
+ * @param[in] q		Task queue
+ */
+static void
+usage_save(taskq_t *q)
+{
+    task_usage_done_t *u = &usage_done[usage_done_next];
+
+    Replace(u->name, NewString(q->unique_name));
+    u->usage = q->usage;
+    usage_done_next = (usage_done_next + 1) % USAGE_DONE;
+}
+
 /**
  * Run pending tasks.
  */
@@ -1884,10 +2709,10 @@ restart:
     /* Walk each queue, and run the tasks on it. */
     FOREACH_LLIST(&taskq, q, taskq_t *) {
 	if (q->top != NULL) {
-	    current_task = q->top;
-	    any |= run_taskq();
+	    any |= run_taskq(q);
 	}
 	if (q->deleted) {
+	    usage_save(q);
 	    llist_unlink(&q->llist);
 	    Free(q->unique_name);
 	    Free(q);
@@ -1948,19 +2773,119 @@ set_output_needed(bool needed)
  */
 
 /*
- * Dump a range of screen locations.
+ * Multi-byte text of each EBCDIC code in the base character set, as
+ * Ascii() displays it, indexed by UTF-8 forcing, monocase and code.
+ * Built as needed, and discarded when the code page changes.
+ */
+typedef struct {
+    char mb[15];
+    unsigned char len;	/* 0 if not built yet */
+} ascii_text_t;
+static ascii_text_t ascii_text[2][2][256];
+
+/* The code page changed. */
+static void
+task_codepage_changed(bool ignored _is_unused)
+{
+    memset(ascii_text, 0, sizeof(ascii_text));
+}
+
+/* Append a byte to a buffer in hex. */
+static void
+vb_append_hex(varbuf_t *r, unsigned char c)
+{
+    static const char hex[] = "0123456789abcdef";
+    char x[2];
+
+    x[0] = hex[c >> 4];
+    x[1] = hex[c & 0x0f];
+    vb_append(r, x, 2);
+}
+
+/*
+ * Append the text of one screen location to a buffer.
+ * Returns false if the location is the right half of a DBCS character, and
+ * contributes nothing.
+ */
+static bool
+ascii_cell(varbuf_t *r, struct ea *buf, int baddr, bool *is_zero,
+	bool force_utf8)
+{
+    char mb[16];
+    ucs4_t uc;
+    size_t xlen;
+
+    if (!buf[baddr].fa && !*is_zero && buf[baddr].cs == CS_BASE &&
+	    !buf[baddr].ucs4 && ctlr_dbcs_state_ea(baddr, buf) == DBCS_NONE) {
+	/* Plain SBCS 3270 text: use the table. */
+	ascii_text_t *t =
+	    &ascii_text[force_utf8][toggled(MONOCASE)][buf[baddr].ec];
+
+	if (!t->len) {
+	    xlen = ebcdic_to_multibyte_fx(buf[baddr].ec, CS_BASE, mb,
+		    sizeof(mb), EUO_BLANK_UNDEF |
+		     (toggled(MONOCASE)? EUO_TOUPPER: 0),
+		    &uc, force_utf8);
+	    if (xlen < 1 || xlen - 1 > sizeof(t->mb)) {
+		/* Can't happen, but don't cache it. */
+		vb_append(r, mb, xlen? xlen - 1: 0);
+		return true;
+	    }
+	    memcpy(t->mb, mb, xlen - 1);
+	    t->len = (unsigned char)xlen;
+	}
+	vb_append(r, t->mb, t->len - 1);
+	return true;
+    }
+
+    if (buf[baddr].fa) {
+	*is_zero = FA_IS_ZERO(buf[baddr].fa);
+	vb_appends(r, " ");
+    } else if (*is_zero) {
+	vb_appends(r, " ");
+    } else if (IS_RIGHT(ctlr_dbcs_state_ea(baddr, buf))) {
+	return false;
+    } else {
+	if (is_nvt(&buf[baddr], false, &uc)) {
+	    /* NVT-mode text. */
+	    if (toggled(MONOCASE)) {
+		uc = u_toupper(uc);
+	    }
+	    xlen = unicode_to_multibyte_f(uc, mb, sizeof(mb), force_utf8);
+	    vb_append(r, mb, xlen - 1);
+	} else {
+	    /* 3270-mode text. */
+	    if (IS_LEFT(ctlr_dbcs_state_ea(baddr, buf))) {
+		xlen = ebcdic_to_multibyte_f((buf[baddr].ec << 8) |
+			buf[baddr + 1].ec,
+			mb, sizeof(mb), force_utf8);
+		vb_append(r, mb, xlen - 1);
+	    } else {
+		xlen = ebcdic_to_multibyte_fx(buf[baddr].ec,
+			buf[baddr].cs, mb, sizeof(mb),
+			EUO_BLANK_UNDEF |
+			 (toggled(MONOCASE)? EUO_TOUPPER: 0),
+			&uc, force_utf8);
+		vb_append(r, mb, xlen - 1);
+	    }
+	}
+    }
+    return true;
+}
+
+/*
+ * Dump a range of screen locations into a buffer, one newline-terminated
+ * line per non-empty row.
  * Returns true if anything was dumped.
  */
 static bool
-dump_range(int first, int len, bool in_ascii, struct ea *buf,
-    int rel_rows _is_unused, int rel_cols, bool force_utf8)
+dump_range(varbuf_t *r, int first, int len, bool in_ascii, struct ea *buf,
+    int rel_rows, int rel_cols, bool force_utf8)
 {
     int i;
     bool any = false;
     bool is_zero = false;
-    varbuf_t r;
-
-    vb_init(&r);
+    size_t row_start = vb_len(r);
 
     /*
      * If the client has looked at the live screen, then if they later
@@ -1979,58 +2904,30 @@ dump_range(int first, int len, bool in_ascii, struct ea *buf,
 	set_output_needed(true);
     }
 
-    is_zero = FA_IS_ZERO(get_field_attribute(first));
+    if (buf == ea_buf) {
+	is_zero = FA_IS_ZERO(get_field_attribute(first));
+    } else {
+	int baddr = first;
+	int n;
+
+	/* Find the field attribute in effect in the saved image. */
+	for (n = 0; n < rel_rows * rel_cols && !buf[baddr].fa; n++) {
+	    baddr = (baddr? baddr: rel_rows * rel_cols) - 1;
+	}
+	is_zero = buf[baddr].fa && FA_IS_ZERO(buf[baddr].fa);
+    }
 
     for (i = 0; i < len; i++) {
 	if (i && !((first + i) % rel_cols)) {
-	    action_output("%s", vb_buf(&r));
-	    vb_reset(&r);
+	    if (vb_len(r) > row_start) {
+		vb_append(r, "\n", 1);
+	    }
+	    row_start = vb_len(r);
 	    any = false;
 	}
 	if (in_ascii) {
-	    char mb[16];
-	    ucs4_t uc;
-	    size_t j;
-	    size_t xlen;
-
-	    if (buf[first + i].fa) {
-		is_zero = FA_IS_ZERO(buf[first + i].fa);
-		vb_appends(&r, " ");
-	    } else if (is_zero) {
-		vb_appends(&r, " ");
-	    } else if (IS_RIGHT(ctlr_dbcs_state(first + i))) {
+	    if (!ascii_cell(r, buf, first + i, &is_zero, force_utf8)) {
 		continue;
-	    } else {
-		if (is_nvt(&buf[first + i], false, &uc)) {
-		    /* NVT-mode text. */
-		    if (toggled(MONOCASE)) {
-			uc = u_toupper(uc);
-		    }
-		    xlen = unicode_to_multibyte_f(uc, mb, sizeof(mb),
-			    force_utf8);
-		    for (j = 0; j < xlen - 1; j++) {
-			vb_appendf(&r, "%c", mb[j]);
-		    }
-		} else {
-		    /* 3270-mode text. */
-		    if (IS_LEFT(ctlr_dbcs_state(first + i))) {
-			xlen = ebcdic_to_multibyte_f((buf[first + i].ec << 8) |
-				buf[first + i + 1].ec,
-				mb, sizeof(mb), force_utf8);
-			for (j = 0; j < xlen - 1; j++) {
-			    vb_appendf(&r, "%c", mb[j]);
-			}
-		    } else {
-			xlen = ebcdic_to_multibyte_fx(buf[first + i].ec,
-				buf[first + i].cs, mb, sizeof(mb),
-				EUO_BLANK_UNDEF |
-				 (toggled(MONOCASE)? EUO_TOUPPER: 0),
-				&uc, force_utf8);
-			for (j = 0; j < xlen - 1; j++) {
-			    vb_appendf(&r, "%c", mb[j]);
-			}
-		    }
-		}
 	    }
 	} else {
 	    ebc_t ebc = 0;
@@ -2048,17 +2945,49 @@ dump_range(int first, int len, bool in_ascii, struct ea *buf,
 		/* 3270-mode text. */
 		ebc = buf[first + i].ec;
 	    }
-	    vb_appendf(&r, "%s%02x", any ? " " : "", ebc);
+	    if (any) {
+		vb_append(r, " ", 1);
+	    }
+	    vb_append_hex(r, ebc);
 	}
 	any = true;
     }
-    if (any) {
-	action_output("%s", vb_buf(&r));
+    if (any && vb_len(r) > row_start) {
+	vb_append(r, "\n", 1);
     }
-    vb_free(&r);
     return any;
 }
 
+/*
+ * Render a screen image other than the live one as text, the way Ascii()
+ * would. Returns a malloc'd string, one newline-terminated line per row.
+ */
+char *
+dump_screen_text(struct ea *buf, int rows, int cols, bool force_utf8)
+{
+    varbuf_t r;
+
+    vb_init(&r);
+    dump_range(&r, 0, rows * cols, true, buf, rows, cols, force_utf8);
+    return vb_consume(&r);
+}
+
+/*
+ * Send the lines collected by dump_range() as a single block of output,
+ * or if 'blank' is set, an empty line instead.
+ */
+static void
+dump_output(varbuf_t *r, bool blank)
+{
+    if (blank) {
+	action_output("%s", "\n");
+    } else if (vb_len(r)) {
+	/* Drop the final newline; action_output() separates the lines. */
+	action_output("%.*s", (int)vb_len(r) - 1, vb_buf(r));
+    }
+    vb_free(r);
+}
+
 static bool
 dump_fixed(const char **params, unsigned count, int origin, const char *name,
 	bool in_ascii, struct ea *buf, int rel_rows, int rel_cols,
@@ -2066,6 +2995,7 @@ dump_fixed(const char **params, unsigned count, int origin, const char *name,
 {
     int row, col, len, rows = 0, cols = 0;
     bool any = false;
+    varbuf_t r;
 
     switch (count) {
     case 0:	/* everything */
@@ -2113,20 +3043,19 @@ dump_fixed(const char **params, unsigned count, int origin, const char *name,
 	popup_an_error("%s: Invalid argument", name);
 	return false;
     }
+    vb_init(&r);
     if (count < 4) {
-	any |= dump_range((row * rel_cols) + col, len, in_ascii, buf, rel_rows,
-		rel_cols, force_utf8);
+	any |= dump_range(&r, (row * rel_cols) + col, len, in_ascii, buf,
+		rel_rows, rel_cols, force_utf8);
     } else {
 	int i;
 
 	for (i = 0; i < rows; i++) {
-	    any |= dump_range(((row+i) * rel_cols) + col, cols, in_ascii, buf,
-		    rel_rows, rel_cols, force_utf8);
+	    any |= dump_range(&r, ((row+i) * rel_cols) + col, cols, in_ascii,
+		    buf, rel_rows, rel_cols, force_utf8);
 	}
     }
-    if (!any) {
-	action_output("%s", "\n");
-    }
+    dump_output(&r, !any);
     return true;
 }
 
@@ -2136,6 +3065,7 @@ dump_field(unsigned count, const char *name, bool in_ascii, bool force_utf8)
     int faddr;
     int start, baddr;
     int len = 0;
+    varbuf_t r;
 
     if (count != 0) {
 	popup_an_error("%s() requires 0 arguments", name);
@@ -2156,7 +3086,17 @@ dump_field(unsigned count, const char *name, bool in_ascii, bool force_utf8)
 	len++;
 	INC_BA(baddr);
     } while (baddr != start);
-    dump_range(start, len, in_ascii, ea_buf, ROWS, COLS, force_utf8);
+    vb_init(&r);
+    if (start + len > ROWS * COLS) {
+	/* The field wraps. */
+	dump_range(&r, start, (ROWS * COLS) - start, in_ascii, ea_buf, ROWS,
+		COLS, force_utf8);
+	dump_range(&r, 0, len - ((ROWS * COLS) - start), in_ascii, ea_buf,
+		ROWS, COLS, force_utf8);
+    } else {
+	dump_range(&r, start, len, in_ascii, ea_buf, ROWS, COLS, force_utf8);
+    }
+    dump_output(&r, false);
     return true;
 }
 
@@ -2200,10 +3140,87 @@ Ebcdic1_action(ia_t ia _is_unused, unsigned argc, const char **argv)
 }
 
 static bool
-EbcdicField_action(ia_t ia _is_unused, unsigned argc, const char **argv)
+EbcdicField_action(ia_t ia _is_unused, unsigned argc, const char **argv)
+{
+    action_debug(AnEbcdicField, ia, argc, argv);
+    return dump_field(argc, AnEbcdicField, false, IA_UTF8(ia));
+}
+
+/*
+ * Fields action.
+ *
+ * Writes one line per field, in buffer order:
+ *  start row and column (1-origin), start offset and length of the field
+ *   contents (following the field attribute)
+ *  field attribute, foreground, background and highlighting, in hex
+ *  flags: P or U (protected/unprotected), M or - (modified),
+ *   H or - (hidden)
+ *  the contents, as Ascii() would display them
+ * With 'unprotected' and/or 'modified', only fields with those properties
+ * are listed.
+ */
+static bool
+Fields_action(ia_t ia, unsigned argc, const char **argv)
 {
-    action_debug(AnEbcdicField, ia, argc, argv);
-    return dump_field(argc, AnEbcdicField, false, IA_UTF8(ia));
+    bool unprotected_only = false;
+    bool modified_only = false;
+    const int *fas;
+    int nfa;
+    int i;
+    unsigned j;
+    varbuf_t r;
+
+    action_debug(AnFields, ia, argc, argv);
+    for (j = 0; j < argc; j++) {
+	if (!strcasecmp(argv[j], KwUnprotected)) {
+	    unprotected_only = true;
+	} else if (!strcasecmp(argv[j], KwModified)) {
+	    modified_only = true;
+	} else {
+	    return action_args_are(AnFields, KwUnprotected, KwModified, NULL);
+	}
+    }
+    if (!formatted) {
+	popup_an_error(AnFields "(): Screen is not formatted");
+	return false;
+    }
+
+    /* Like Ascii, this enables Wait(Output). */
+    if (current_task != NULL) {
+	set_output_needed(true);
+    }
+
+    vb_init(&r);
+    nfa = ctlr_field_addrs(&fas);
+    for (i = 0; i < nfa; i++) {
+	struct ea *faea = &ea_buf[fas[i]];
+	unsigned char fa = faea->fa;
+	int start = (fas[i] + 1) % (ROWS * COLS);
+	int len = fas[(i + 1) % nfa] - start;
+	bool is_zero = FA_IS_ZERO(fa);
+	int k;
+
+	if ((unprotected_only && FA_IS_PROTECTED(fa)) ||
+		(modified_only && !FA_IS_MODIFIED(fa))) {
+	    continue;
+	}
+	if (len < 0) {
+	    len += ROWS * COLS;
+	}
+	vb_appendf(&r, "%d %d %d %d %02x %02x %02x %02x %c%c%c ",
+		(start / COLS) + 1, (start % COLS) + 1, start, len,
+		fa, faea->fg, faea->bg, faea->gr? (faea->gr | 0xf0): 0,
+		FA_IS_PROTECTED(fa)? 'P': 'U',
+		FA_IS_MODIFIED(fa)? 'M': '-',
+		is_zero? 'H': '-');
+	for (k = 0; k < len; k++) {
+	    ascii_cell(&r, ea_buf, (start + k) % (ROWS * COLS), &is_zero,
+		    IA_UTF8(ia));
+	}
+	vb_append(&r, "\n", 1);
+    }
+    dump_output(&r, false);
+    return true;
 }
 
 static unsigned char
@@ -2238,6 +3255,7 @@ do_read_buffer(const char **params, unsigned num_params, struct ea *buf,
     unsigned char current_ic = 0x00;
     enum { RB_ASCII, RB_EBCDIC, RB_UNICODE } mode = RB_ASCII;
     varbuf_t r;
+    varbuf_t out;
     bool field = false;
     int field_baddr = 0;
     bool any = false;
@@ -2294,11 +3312,14 @@ do_read_buffer(const char **params, unsigned num_params, struct ea *buf,
 	baddr = 0;
     }
 
+    /* Rows are collected in 'out' and sent together. */
     vb_init(&r);
+    vb_init(&out);
     for (;;) {
 	if (!field && !(baddr % COLS)) {
 	    if (baddr) {
-		action_output("%s", vb_buf(&r) + 1);
+		vb_append(&out, vb_buf(&r) + 1, vb_len(&r) - 1);
+		vb_append(&out, "\n", 1);
 	    }
 	    vb_reset(&r);
 	}
@@ -2376,7 +3397,8 @@ do_read_buffer(const char **params, unsigned num_params, struct ea *buf,
 		if (buf[baddr].cs & CS_GE) {
 		    vb_appendf(&r, " GE(%02x)", buf[baddr].ec);
 		} else {
-		    vb_appendf(&r, " %02x", buf[baddr].ec);
+		    vb_append(&r, " ", 1);
+		    vb_append_hex(&r, buf[baddr].ec);
 		}
 	    } else if (mode == RB_ASCII) {
 		bool done = false;
@@ -2397,7 +3419,7 @@ do_read_buffer(const char **params, unsigned num_params, struct ea *buf,
 		    }
 		    vb_appends(&r, " ");
 		    for (j = 0; j < len-1; j++) {
-			vb_appendf(&r, "%02x", mb[j] & 0xff);
+			vb_append_hex(&r, mb[j] & 0xff);
 		    }
 		    done = true;
 		} else if (IS_RIGHT(ctlr_dbcs_state(baddr))) {
@@ -2436,7 +3458,7 @@ do_read_buffer(const char **params, unsigned num_params, struct ea *buf,
 			vb_appends(&r, "00");
 		    } else {
 			for (j = 0; mb[j]; j++) {
-			    vb_appendf(&r, "%02x", mb[j] & 0xff);
+			    vb_append_hex(&r, mb[j] & 0xff);
 			}
 		    }
 		}
@@ -2486,7 +3508,13 @@ do_read_buffer(const char **params, unsigned num_params, struct ea *buf,
 	}
 	any = true;
     }
-    action_output("%s%s", field? "Contents: ": "", vb_buf(&r) + 1);
+    if (field) {
+	action_output("Contents: %s", vb_buf(&r) + 1);
+    } else {
+	vb_appends(&out, vb_buf(&r) + 1);
+	action_output("%s", vb_buf(&out));
+    }
+    vb_free(&out);
     vb_free(&r);
     return true;
 }
@@ -2501,6 +3529,19 @@ ReadBuffer_action(ia_t ia _is_unused, unsigned argc, const char **argv)
     return do_read_buffer(argv, argc, ea_buf, IA_UTF8(ia));
 }
 
+/* Cached status line fields. */
+static struct {
+    bool valid;			/* fields are valid */
+    enum cstate cstate;		/* connection state they were built for */
+    char em_mode;		/* emulator mode */
+    int model_num;		/* model number */
+    int rows;			/* rows */
+    int cols;			/* columns */
+    unsigned long window;	/* window ID */
+    varbuf_t middle;		/* fields 4 through 8 */
+    char window_str[24];	/* field 11, with its leading space */
+} status_cache;
+
 /*
  * The script prompt is preceeded by a status line with 11 fields:
  *
@@ -2529,47 +3570,20 @@ ReadBuffer_action(ia_t ia _is_unused, unsigned argc, const char **argv)
  *  9 cursor row
  * 10 cursor col
  * 11 main window id
+ *
+ * Fields 4 through 8 change only with the connection state, mode or model,
+ * so they are formatted once and kept until one of those changes.
+ *
+ * @return Status line, valid until the next call
  */
-static char *
+static const char *
 status_string(void)
 {
-    char kb_stat;
-    char fmt_stat;
-    char prot_stat;
-    char *connect_stat = NULL;
+    static varbuf_t r;
     char em_mode;
-    char *r;
-
-    if (!kybdlock) {
-	kb_stat = 'U';
-    } else {
-	kb_stat = 'L';
-    }
-
-    if (formatted) {
-	fmt_stat = 'F';
-    } else {
-	fmt_stat = 'U';
-    }
-
-    if (!formatted) {
-	prot_stat = 'U';
-    } else {
-	unsigned char fa;
-
-	fa = get_field_attribute(cursor_addr);
-	if (FA_IS_PROTECTED(fa)) {
-	    prot_stat = 'P';
-	} else {
-	    prot_stat = 'U';
-	}
-    }
-
-    if (cstate > RECONNECTING) {
-	connect_stat = xs_buffer("C(%s)", current_host);
-    } else {
-	connect_stat = NewString("N");
-    }
+    char prefix[6];
+    char cursor[32];
+    unsigned long window;
 
     if (PCONNECTED) {
 	if (IN_NVT) {
@@ -2587,19 +3601,62 @@ status_string(void)
 	em_mode = 'N';
     }
 
-    r = xs_buffer("%c %c %c %s %c %d %d %d %d %d 0x%lx",
-	    kb_stat,
-	    fmt_stat,
-	    prot_stat,
-	    connect_stat,
-	    em_mode,
-	    model_num,
-	    ROWS, COLS,
-	    cursor_addr / COLS, cursor_addr % COLS,
-	    screen_window_number());
+    /*
+     * Rebuild the cached fields if they have been invalidated. The screen
+     * dimensions can change without a state change (an Erase/Write Alternate
+     * switches to the alternate size), so those are checked directly.
+     */
+    window = screen_window_number();
+    if (!status_cache.valid ||
+	    status_cache.cstate != cstate ||
+	    status_cache.em_mode != em_mode ||
+	    status_cache.model_num != model_num ||
+	    status_cache.rows != ROWS ||
+	    status_cache.cols != COLS ||
+	    status_cache.window != window) {
+	vb_reset(&status_cache.middle);
+	if (cstate > RECONNECTING) {
+	    vb_appendf(&status_cache.middle, "C(%s)", current_host);
+	} else {
+	    vb_appends(&status_cache.middle, "N");
+	}
+	vb_appendf(&status_cache.middle, " %c %d %d %d", em_mode, model_num,
+		ROWS, COLS);
+	snprintf(status_cache.window_str, sizeof(status_cache.window_str),
+		" 0x%lx", window);
+	status_cache.cstate = cstate;
+	status_cache.em_mode = em_mode;
+	status_cache.model_num = model_num;
+	status_cache.rows = ROWS;
+	status_cache.cols = COLS;
+	status_cache.window = window;
+	status_cache.valid = true;
+    }
+
+    /* Keyboard, formatting and protection. */
+    prefix[0] = kybdlock? 'L': 'U';
+    prefix[1] = ' ';
+    prefix[2] = formatted? 'F': 'U';
+    prefix[3] = ' ';
+    prefix[4] = (formatted &&
+	    FA_IS_PROTECTED(get_field_attribute(cursor_addr)))? 'P': 'U';
+    prefix[5] = ' ';
+
+    vb_reset(&r);
+    vb_append(&r, prefix, sizeof(prefix));
+    vb_append(&r, vb_buf(&status_cache.middle), vb_len(&status_cache.middle));
+    snprintf(cursor, sizeof(cursor), " %d %d", cursor_addr / COLS,
+	    cursor_addr % COLS);
+    vb_appends(&r, cursor);
+    vb_appends(&r, status_cache.window_str);
+    return vb_buf(&r);
+}
 
-    Free(connect_stat);
-    return r;
+/* Invalidate the cached status line fields. */
+static void
+task_status_changed(bool ignored _is_unused)
+{
+    status_cache.valid = false;
 }
 
 /* Call a run callback. */
@@ -2608,10 +3665,10 @@ call_run(task_t *s)
 {
     bool success;
 
-    vtrace("Running " TASK_NAME_FMT "\n", TASK_NAME);
+    vctrace(TC_TASK, "Running " TASK_NAME_FMT "\n", TASK_NAME);
     if ((*current_task->cbx.cb->run)(current_task->cbx.handle, &success)) {
 	/* CB is complete. */
-	vtrace(TASK_NAME_FMT " is complete, %s\n", TASK_NAME,
+	vctrace(TC_TASK, TASK_NAME_FMT " is complete, %s\n", TASK_NAME,
 		success? "success": "failure");
 	current_task->success = success;
 	if (current_task->next) {
@@ -2633,7 +3690,7 @@ task_done(bool success)
 
     assert(current_task->type == ST_CB);
 
-    vtrace(TASK_NAME_FMT " child task done, %s\n", TASK_NAME,
+    vctrace(TC_TASK, TASK_NAME_FMT " child task done, %s\n", TASK_NAME,
 	    success? "success": "failure");
 
     /* Tell the callback its child is done. */
@@ -2656,7 +3713,7 @@ char *
 task_cb_prompt(task_cbh handle)
 {
     task_t *s;
-    char *st;
+    const char *st;
     char *t;
 
     s = task_find_cb(handle);
@@ -2669,10 +3726,27 @@ task_cb_prompt(task_cbh handle)
     t = lazyaf("%s %ld.%03ld", st,
 	    s->child_msec / 1000L,
 	    s->child_msec % 1000L);
-    Free(st);
     return t;
 }
 
+/**
+ * Attach a request span to a cb.
+ *
+ * @param[in] handle	handle
+ * @param[in] span	span, or NULL
+ */
+void
+task_cb_span(task_cbh handle, span_t *span)
+{
+    task_t *s = task_find_cb(handle);
+
+    if (s == NULL) {
+	span_done(span, false);
+	return;
+    }
+    s->cbx.span = span;
+}
+
 /**
  * Return the child execution time for a cb.
  *
@@ -2699,15 +3773,37 @@ static int snap_cols = 0;
 static int snap_field_start = -1;
 static int snap_field_length = -1;
 static int snap_caddr = 0;
+static unsigned long *snap_row_gen = NULL;	/* row generations copied */
 
 static void
 snap_save(void)
 {
+    int row;
+
     set_output_needed(true);
-    Replace(snap_status, status_string());
+    Replace(snap_status, NewString(status_string()));
+
+    /*
+     * Copy only the rows that have changed since the last snapshot. A
+     * change in dimensions means starting over.
+     */
+    if (snap_buf == NULL || snap_rows != ROWS || snap_cols != COLS) {
+	Replace(snap_buf, (struct ea *)Malloc(ROWS*COLS*sizeof(struct ea)));
+	Replace(snap_row_gen,
+		(unsigned long *)Malloc(ROWS * sizeof(unsigned long)));
+	for (row = 0; row < ROWS; row++) {
+	    snap_row_gen[row] = ctlr_row_generation(row) - 1;
+	}
+    }
+    for (row = 0; row < ROWS; row++) {
+	unsigned long gen = ctlr_row_generation(row);
 
-    Replace(snap_buf, (struct ea *)Malloc(ROWS*COLS*sizeof(struct ea)));
-    memcpy(snap_buf, ea_buf, ROWS*COLS*sizeof(struct ea));
+	if (snap_row_gen[row] != gen) {
+	    memcpy(snap_buf + (row * COLS), ea_buf + (row * COLS),
+		    COLS * sizeof(struct ea));
+	    snap_row_gen[row] = gen;
+	}
+    }
 
     snap_rows = ROWS;
     snap_cols = COLS;
@@ -2904,7 +4000,7 @@ Snap_action(ia_t ia _is_unused, unsigned argc, const char **argv)
  * Wait for various conditions.
  */
 static bool
-Wait_action(ia_t ia _is_unused, unsigned argc, const char **argv)
+Wait_action(ia_t ia, unsigned argc, const char **argv)
 {
     enum task_state next_state = TS_WAIT_IFIELD;
     float tmo = -1.0;
@@ -2927,16 +4023,16 @@ Wait_action(ia_t ia _is_unused, unsigned argc, const char **argv)
 	pr = argv;
     }
 
-    if (np > 1) {
-	popup_an_error("Too many arguments to " AnWait " ()"
-		"or invalid timeout value");
-	return false;
-    }
     if (current_task == NULL || current_task->state != TS_RUNNING) {
 	popup_an_error(AnWait "() can only be called from scripts or macros");
 	return false;
     }
-    if (np == 1) {
+    if (np > 1) {
+	if (!match_init(np, pr, IA_UTF8(ia))) {
+	    return false;
+	}
+	next_state = TS_WAIT_MATCH;
+    } else if (np == 1) {
 	if (!strcasecmp(pr[0], KwNvtMode) || !strcasecmp(pr[0], KwAnsi)) {
 	    if (!IN_NVT) {
 		next_state = TS_WAIT_NVT;
@@ -2964,14 +4060,18 @@ Wait_action(ia_t ia _is_unused, unsigned argc, const char **argv)
 	    } else {
 		return true;
 	    }
+	} else if (!strcasecmp(pr[0], KwSettled)) {
+	    next_state = TS_WAIT_SETTLED;
 	} else if (tmo > 0.0 && !strcasecmp(pr[0], KwSeconds)) {
 	    next_state = TS_TIME_WAIT;
 	} else if (strcasecmp(pr[0], KwInputField)) {
 	    return action_args_are(AnWait, KwInputField, KwNvtMode, Kw3270Mode,
-		    KwOutput, KwSeconds, KwDisconnect, KwUnlock, NULL);
+		    KwOutput, KwSeconds, KwDisconnect, KwUnlock, KwSettled,
+		    KwString, KwRegex, NULL);
 	}
     }
     if (next_state != TS_TIME_WAIT && !(CONNECTED || HALF_CONNECTED)) {
+	match_free(current_task);
 	popup_an_error(AnWait "(): Not connected");
 	return false;
     }
@@ -2980,6 +4080,12 @@ Wait_action(ia_t ia _is_unused, unsigned argc, const char **argv)
     if (next_state == TS_WAIT_IFIELD && CAN_PROCEED) {
 	return true;
     }
+    if (next_state == TS_WAIT_MATCH && match_screen(current_task)) {
+	return true;
+    }
+    if (next_state == TS_WAIT_SETTLED && task_settled(NULL)) {
+	return true;
+    }
 
     /* No, wait for it to happen. */
     task_set_state(current_task, next_state, AnWait "()");
@@ -3019,7 +4125,7 @@ pause_timed_out(ioid_t id)
     } FOREACH_LLIST_END(&taskq, q, taskq_t *);
 
     if (!found) {
-	vtrace("pause_timed_out: no match\n");
+	vctrace(TC_TASK, "pause_timed_out: no match\n");
 	return;
     }
 
@@ -3073,6 +4179,7 @@ task_host_output(void)
     taskq_t *q;
 
     set_output_needed(false);
+    settle_host_output();
 
     FOREACH_LLIST(&taskq, q, taskq_t *) {
 	task_t *s;
@@ -3125,9 +4232,19 @@ task_active(void)
     return current_task != NULL;
 }
 
-/* Translate an expect string (uses C escape syntax). */
+/* Return whether any tasks are running or blocked. */
+bool
+task_pending(void)
+{
+    return n_running + n_blocked > 0;
+}
+
+/*
+ * Translate an expect string (uses C escape syntax).
+ * If new_only is set, only NVT data that arrives later will be matched.
+ */
 static void
-expand_expect(task_t *task, const char *s)
+expand_expect(task_t *task, const char *s, bool new_only)
 {
     char *t = Malloc(strlen(s) + 1);
     char c;
@@ -3210,53 +4327,295 @@ expand_expect(task_t *task, const char *s)
 	}
     }
     task->expect.len = t - task->expect.text;
+
+    /*
+     * Build the failure function for the text: fail[i] is the length of
+     * the longest proper prefix of text[0..i] that is also a suffix of it.
+     */
+    task->expect.fail = (size_t *)Malloc((task->expect.len + 1) *
+	    sizeof(size_t));
+    if (task->expect.len) {
+	size_t i, k = 0;
+
+	task->expect.fail[0] = 0;
+	for (i = 1; i < task->expect.len; i++) {
+	    while (k && task->expect.text[i] != task->expect.text[k]) {
+		k = task->expect.fail[k - 1];
+	    }
+	    if (task->expect.text[i] == task->expect.text[k]) {
+		k++;
+	    }
+	    task->expect.fail[i] = k;
+	}
+    }
+
+    /*
+     * Start scanning at the oldest saved NVT data, or if new_only is set, at
+     * the next NVT data to arrive.
+     */
+    task->expect.matched = 0;
+    task->expect.pos = new_only? nvt_save_total: nvt_save_total - nvt_save_cnt;
 }
 
-/* 'mem' version of strstr */
-static char *
-memstr(char *s1, char *s2, int n1, int n2)
+/* Free the state for an expect string. */
+static void
+expect_free(task_t *task)
 {
-    int i;
+    Replace(task->expect.text, NULL);
+    Replace(task->expect.fail, NULL);
+}
+
+/*
+ * Check for a match against an expect string.
+ *
+ * The partial match is remembered between calls, so only the NVT data that
+ * has arrived since the last call is scanned. If some of the data the
+ * partial match depends on has since been discarded, the scan starts over
+ * with the oldest saved data.
+ */
+static bool
+expect_matches(task_t *task)
+{
+    size_t unscanned = nvt_save_total - task->expect.pos;
+    size_t k = task->expect.matched;
+    size_t ix;
+
+    if (task->expect.len == 0) {
+	expect_free(task);
+	return true;
+    }
+
+    if (unscanned + k > nvt_save_cnt) {
+	unscanned = nvt_save_cnt;
+	k = 0;
+    }
+
+    ix = (nvt_save_ix + nvt_save_size - unscanned) % nvt_save_size;
+    while (unscanned) {
+	char c = (char)nvt_save_buf[ix];
 
-    for (i = 0; i <= n1 - n2; i++, s1++) {
-	if (*s1 == *s2 && !memcmp(s1, s2, n2)) {
-	    return s1;
+	ix = (ix + 1) % nvt_save_size;
+	unscanned--;
+	while (k && c != task->expect.text[k]) {
+	    k = task->expect.fail[k - 1];
+	}
+	if (c == task->expect.text[k] && ++k == task->expect.len) {
+	    /* Consume everything through the end of the match. */
+	    nvt_save_cnt = unscanned;
+	    expect_free(task);
+	    return true;
 	}
     }
-    return NULL;
+
+    task->expect.matched = k;
+    task->expect.pos = nvt_save_total;
+    return false;
+}
+
+/* Free the Wait(String) and Wait(Regex) state in a task. */
+static void
+match_free(task_t *task)
+{
+    if (task->match.text == NULL) {
+	return;
+    }
+#if !defined(_WIN32) /*[*/
+    if (task->match.is_regex) {
+	regfree(&task->match.re);
+    }
+#endif /*]*/
+    Replace(task->match.text, NULL);
+    Replace(task->match.row_gen, NULL);
 }
 
-/* Check for a match against an expect string. */
+/*
+ * Set up the current task for Wait(String) or Wait(Regex).
+ * The arguments are the keyword, the text, and either nothing (the whole
+ * screen), Field (the field containing the cursor) or four numbers giving a
+ * 0-origin region, as for Ascii().
+ */
 static bool
-expect_matches(task_t *task)
+match_init(unsigned np, const char **pr, bool force_utf8)
 {
-    size_t ix, i;
-    unsigned char buf[NVT_SAVE_SIZE];
-    char *t;
+    const char *name = lazyaf(AnWait "(%s)", pr[0]);
+    bool is_regex = !strcasecmp(pr[0], KwRegex);
+    bool field = false;
+    int region[4] = { 0, 0, -1, -1 };
 
-    ix = (nvt_save_ix + NVT_SAVE_SIZE - nvt_save_cnt) % NVT_SAVE_SIZE;
-    for (i = 0; i < nvt_save_cnt; i++) {
-	buf[i] = nvt_save_buf[(ix + i) % NVT_SAVE_SIZE];
+    if (!is_regex && strcasecmp(pr[0], KwString)) {
+	popup_an_error("Too many arguments to " AnWait " ()"
+		"or invalid timeout value");
+	return false;
+    }
+    if (np == 3 && !strcasecmp(pr[2], KwField)) {
+	field = true;
+    } else if (np == 6) {
+	int i;
+
+	for (i = 0; i < 4; i++) {
+	    char *ptr;
+	    long l = strtol(pr[2 + i], &ptr, 10);
+
+	    if (ptr == pr[2 + i] || *ptr != '\0' || l < 0) {
+		popup_an_error("%s: Invalid argument", name);
+		return false;
+	    }
+	    region[i] = (int)l;
+	}
+	if (region[2] == 0 || region[3] == 0 ||
+		region[0] + region[2] > ROWS || region[1] + region[3] > COLS) {
+	    popup_an_error("%s: Invalid argument", name);
+	    return false;
+	}
+    } else if (np != 2) {
+	popup_an_error("%s requires 1, 2 or 5 arguments", name);
+	return false;
+    }
+
+    match_free(current_task);
+#if defined(_WIN32) /*[*/
+    if (is_regex) {
+	popup_an_error("%s: Not supported on this platform", name);
+	return false;
+    }
+#else /*][*/
+    if (is_regex) {
+	int rv = regcomp(&current_task->match.re, pr[1],
+		REG_EXTENDED | REG_NOSUB);
+
+	if (rv != 0) {
+	    char errbuf[256];
+
+	    regerror(rv, &current_task->match.re, errbuf, sizeof(errbuf));
+	    popup_an_error("%s: %s", name, errbuf);
+	    return false;
+	}
+    }
+#endif /*]*/
+
+    current_task->match.text = NewString(pr[1]);
+    current_task->match.is_regex = is_regex;
+    current_task->match.field = field;
+    current_task->match.force_utf8 = force_utf8;
+    current_task->match.row = region[0];
+    current_task->match.col = region[1];
+    current_task->match.rows = region[2];
+    current_task->match.cols = region[3];
+    current_task->match.row_gen =
+	(unsigned long *)Calloc(maxROWS, sizeof(unsigned long));
+    current_task->match.screen_gen = 0;
+    return true;
+}
+
+/* Search one range of the screen for a Wait(String) or Wait(Regex) match. */
+static bool
+match_range(task_t *task, int first, int len)
+{
+    varbuf_t r;
+    bool is_zero = FA_IS_ZERO(get_field_attribute(first));
+    bool found;
+    int i;
+
+    vb_init(&r);
+    for (i = 0; i < len; i++) {
+	ascii_cell(&r, ea_buf, (first + i) % (ROWS * COLS), &is_zero,
+		task->match.force_utf8);
     }
-    t = memstr((char *)buf, task->expect.text, (int)nvt_save_cnt,
-	    (int)task->expect.len);
-    if (t != NULL) {
-	nvt_save_cnt -= ((unsigned char *)t - buf) + task->expect.len;
-	Replace(task->expect.text, NULL);
+#if !defined(_WIN32) /*[*/
+    if (task->match.is_regex) {
+	found = !regexec(&task->match.re, vb_buf(&r), 0, NULL, 0);
+    } else
+#endif /*]*/
+    found = strstr(vb_buf(&r), task->match.text) != NULL;
+    vb_free(&r);
+    return found;
+}
+
+/*
+ * Check a task for a Wait(String) or Wait(Regex) match.
+ *
+ * Only the rows that have changed since the last check are searched; a
+ * field is searched again after any change to the screen. A match must lie
+ * within one row of a region.
+ */
+static bool
+match_screen(task_t *task)
+{
+    bool found = false;
+
+    if (task->match.text == NULL) {
 	return true;
+    }
+
+    if (task->match.field) {
+	if (task->match.screen_gen != screen_generation) {
+	    task->match.screen_gen = screen_generation;
+	    if (formatted) {
+		int start, baddr;
+		int len = 0;
+
+		start = find_field_attribute(cursor_addr);
+		INC_BA(start);
+		baddr = start;
+		do {
+		    if (ea_buf[baddr].fa) {
+			break;
+		    }
+		    len++;
+		    INC_BA(baddr);
+		} while (baddr != start);
+		found = match_range(task, start, len);
+	    }
+	}
     } else {
-	return false;
+	int row0 = task->match.row;
+	int col0 = task->match.col;
+	int rows = (task->match.rows < 0)? ROWS: task->match.rows;
+	int cols = (task->match.cols < 0)? COLS: task->match.cols;
+	int row;
+
+	/* The screen may have shrunk since the wait began. */
+	if (row0 + rows > ROWS) {
+	    rows = ROWS - row0;
+	}
+	if (col0 + cols > COLS) {
+	    cols = COLS - col0;
+	}
+
+	for (row = row0; !found && row < row0 + rows && cols > 0; row++) {
+	    unsigned long gen = ctlr_row_generation(row);
+
+	    if (task->match.row_gen[row] == gen) {
+		continue;
+	    }
+	    task->match.row_gen[row] = gen;
+	    found = match_range(task, (row * COLS) + col0, cols);
+	}
     }
+
+    if (found) {
+	match_free(task);
+    }
+    return found;
 }
 
 /* Store an NVT character for use by the Expect action. */
 void
 task_store(unsigned char c)
 {
+    /* Pass it to any observers. */
+    observe_nvt(c);
+
+    /* Pick up a change to the buffer size from the resource. */
+    if ((size_t)appres.nvt_save_size != nvt_save_size) {
+	nvt_save_check_size();
+    }
+
     /* Save the character in the buffer. */
     nvt_save_buf[nvt_save_ix++] = c;
-    nvt_save_ix %= NVT_SAVE_SIZE;
-    if (nvt_save_cnt < NVT_SAVE_SIZE) {
+    nvt_save_ix %= nvt_save_size;
+    nvt_save_total++;
+    if (nvt_save_cnt < nvt_save_size) {
 	nvt_save_cnt++;
     }
 }
@@ -3280,10 +4639,10 @@ NvtText_action(ia_t ia, unsigned argc, const char **argv)
 	return true;
     }
 
-    ix = (nvt_save_ix + NVT_SAVE_SIZE - nvt_save_cnt) % NVT_SAVE_SIZE;
+    ix = (nvt_save_ix + nvt_save_size - nvt_save_cnt) % nvt_save_size;
     vb_init(&r);
     for (i = 0; i < nvt_save_cnt; i++) {
-	c = nvt_save_buf[(ix + i) % NVT_SAVE_SIZE];
+	c = nvt_save_buf[(ix + i) % nvt_save_size];
 	if (!(c & ~0x1f)) switch (c) {
 	    case '\n':
 		vb_appends(&r, "\\n");
@@ -3378,11 +4737,11 @@ expect_timed_out(ioid_t id)
     } FOREACH_LLIST_END(&taskq, q, taskq_t *);
 
     if (!found) {
-	vtrace("expect_timed_out: no match\n");
+	vctrace(TC_TASK, "expect_timed_out: no match\n");
 	return;
     }
 
-    Replace(s->expect.text, NULL);
+    expect_free(s);
 
     current_task = s;
     popup_an_error(AnExpect "(): Timed out");
@@ -3416,7 +4775,7 @@ wait_timed_out(ioid_t id)
     } FOREACH_LLIST_END(&taskq, q, taskq_t *);
 
     if (!found) {
-	vtrace("wait_timed_out: no match\n");
+	vctrace(TC_TASK, "wait_timed_out: no match\n");
 	return;
     }
 
@@ -3429,6 +4788,7 @@ wait_timed_out(ioid_t id)
     }
 
     /* Pop up the error message. */
+    match_free(s);
     popup_an_error_to(s, AnWait "(): Timed out");
 
     /* Forget the ID. */
@@ -3441,10 +4801,12 @@ wait_timed_out(ioid_t id)
 static bool
 Expect_action(ia_t ia, unsigned argc, const char **argv)
 {
-    int tmo;
+    int tmo = 30;
+    bool new_only = false;
+    unsigned i;
 
     action_debug(AnExpect, ia, argc, argv);
-    if (check_argc(AnExpect, argc, 1, 2) < 0) {
+    if (check_argc(AnExpect, argc, 1, 3) < 0) {
 	return false;
     }
 
@@ -3453,18 +4815,20 @@ Expect_action(ia_t ia, unsigned argc, const char **argv)
 	popup_an_error(AnExpect "() is valid only when connected in NVT mode");
 	return false;
     }
-    if (argc == 2) {
-	tmo = atoi(argv[1]);
+    for (i = 1; i < argc; i++) {
+	if (!strcasecmp(argv[i], KwNew)) {
+	    new_only = true;
+	    continue;
+	}
+	tmo = atoi(argv[i]);
 	if (tmo < 1 || tmo > 600) {
-	    popup_an_error(AnExpect "(): Invalid timeout: %s", argv[1]);
+	    popup_an_error(AnExpect "(): Invalid timeout: %s", argv[i]);
 	    return false;
 	}
-    } else {
-	tmo = 30;
     }
 
     /* See if the text is there already; if not, wait for it. */
-    expand_expect(current_task, argv[0]);
+    expand_expect(current_task, argv[0], new_only);
     if (!expect_matches(current_task)) {
 	current_task->expect_id = AddTimeOut(tmo * 1000, expect_timed_out);
 	task_set_state(current_task, TS_EXPECTING, AnExpect "()");
@@ -3555,19 +4919,19 @@ abortq(taskq_t *q)
 
 	/* Don't abort a peer script. */
 	if (s->type == ST_CB && (s->cbx.cb->flags & CB_PEER)) {
-	    vtrace("Abort skipping peer\n");
+	    vctrace(TC_TASK, "Abort skipping peer\n");
 	    continue;
 	}
 
 	/* Abort the cb. */
 	if (s->type == ST_CB) {
-	    vtrace("Canceling " TASK_NAME_FMT "\n", TASK_sNAME(s));
+	    vctrace(TC_TASK, "Canceling " TASK_NAME_FMT "\n", TASK_sNAME(s));
 	    task_result(s, "Canceled", false);
 	    (*s->cbx.cb->done)(s->cbx.handle, true, true);
 	}
 
 	/* Free the task -- this is not a pop */
-	vtrace("Freeing " TASK_NAME_FMT "\n", TASK_sNAME(s));
+	vctrace(TC_TASK, "Freeing " TASK_NAME_FMT "\n", TASK_sNAME(s));
 	free_task(s);
 
 	/* Take it out of the taskq. */
@@ -3593,7 +4957,7 @@ abort_script_by_cb(const char *cb_name)
     /* child_ignore_output(); */ /* Needed? */
 #endif /*]*/
 
-    vtrace("Canceling all pending scripts for %s\n", cb_name);
+    vctrace(TC_TASK, "Canceling all pending scripts for %s\n", cb_name);
 
     FOREACH_LLIST(&taskq, q, taskq_t *) {
 	if (!strcmp(cb_name, q->cb->shortname)) {
@@ -3618,7 +4982,7 @@ abort_queue(const char *unique_name)
     /* child_ignore_output(); */ /* Needed? */
 #endif /*]*/
 
-    vtrace("Canceling all pending scripts for %s\n", unique_name);
+    vctrace(TC_TASK, "Canceling all pending scripts for %s\n", unique_name);
 
     FOREACH_LLIST(&taskq, q, taskq_t *) {
 	if (!strcmp(unique_name, q->unique_name)) {
@@ -3641,7 +5005,7 @@ abort_script(void)
     child_ignore_output();
 #endif /*]*/
 
-    vtrace("Canceling all pending scripts\n");
+    vctrace(TC_TASK, "Canceling all pending scripts\n");
 
     /*
      * - Call the kill callbacks for every cb.
@@ -3657,19 +5021,20 @@ abort_script(void)
 
 	    /* Don't abort a peer script. */
 	    if (s->type == ST_CB && (s->cbx.cb->flags & CB_PEER)) {
-		vtrace("Abort skipping peer\n");
+		vctrace(TC_TASK, "Abort skipping peer\n");
 		continue;
 	    }
 
 	    /* Abort the cb. */
 	    if (s->type == ST_CB) {
-		vtrace("Canceling " TASK_NAME_FMT "\n", TASK_sNAME(s));
+		vctrace(TC_TASK, "Canceling " TASK_NAME_FMT "\n",
+			TASK_sNAME(s));
 		task_result(s, "Canceled", false);
 		(*s->cbx.cb->done)(s->cbx.handle, true, true);
 	    }
 
 	    /* Free the task -- this is not a pop */
-	    vtrace("Freeing " TASK_NAME_FMT "\n", TASK_sNAME(s));
+	    vctrace(TC_TASK, "Freeing " TASK_NAME_FMT "\n", TASK_sNAME(s));
 	    free_task(s);
 
 	    /* Take it out of the taskq. */
@@ -3762,10 +5127,110 @@ task_get_tasks(void)
 		    last? last: "");
 	}
     } FOREACH_LLIST_END(&taskq, q, taskq_t *);
+    vb_appendf(&r, "%u idle, %u running, %u blocked\n", n_queued, n_running,
+	    n_blocked);
 
     return vb_consume(&r);
 }
 
+/* One line of the task usage report. */
+typedef struct {
+    const char *name;
+    bool done;
+    const task_usage_t *usage;
+} usage_line_t;
+
+/* Order usage report lines by CPU time, largest first. */
+static int
+usage_compare(const void *a, const void *b)
+{
+    const usage_line_t *ua = (const usage_line_t *)a;
+    const usage_line_t *ub = (const usage_line_t *)b;
+
+    if (ua->usage->cpu_usec > ub->usage->cpu_usec) {
+	return -1;
+    }
+    return ua->usage->cpu_usec < ub->usage->cpu_usec;
+}
+
+/**
+ * Report the resources used by each task queue, running or recently
+ * completed, in decreasing order of CPU time.
+ *
+ * @return Report text, one line per queue, or NULL if there are none
+ */
+const char *
+task_get_usage(void)
+{
+    usage_line_t *lines;
+    unsigned n = 0;
+    unsigned nq = 0;
+    unsigned i;
+    taskq_t *q;
+    varbuf_t r;
+
+    FOREACH_LLIST(&taskq, q, taskq_t *) {
+	nq++;
+    } FOREACH_LLIST_END(&taskq, q, taskq_t *);
+    lines = (usage_line_t *)Malloc((nq + USAGE_DONE) * sizeof(usage_line_t));
+    FOREACH_LLIST(&taskq, q, taskq_t *) {
+	lines[n].name = q->unique_name;
+	lines[n].done = q->deleted;
+	lines[n++].usage = &q->usage;
+    } FOREACH_LLIST_END(&taskq, q, taskq_t *);
+    for (i = 0; i < USAGE_DONE; i++) {
+	if (usage_done[i].name != NULL) {
+	    lines[n].name = usage_done[i].name;
+	    lines[n].done = true;
+	    lines[n++].usage = &usage_done[i].usage;
+	}
+    }
+    if (n == 0) {
+	Free(lines);
+	return NULL;
+    }
+    qsort(lines, n, sizeof(usage_line_t), usage_compare);
+
+    vb_init(&r);
+    for (i = 0; i < n && i < USAGE_TOP; i++) {
+	const task_usage_t *u = lines[i].usage;
+
+	vb_appendf(&r, "%s%s %s cpu-ms %.3f wakeups %" PRIu64 " actions %"
+		PRIu64 " bytes-in %" PRIu64 " bytes-out %" PRIu64,
+		i? "\n": "",
+		lines[i].name,
+		lines[i].done? "done": "active",
+		u->cpu_usec / 1000.0,
+		u->wakeups,
+		u->actions,
+		u->bytes_in,
+		u->bytes_out);
+    }
+    Free(lines);
+    return lazya(vb_consume(&r));
+}
+
+/**
+ * Make the script connection the current action came from an observer of
+ * host output.
+ *
+ * @param[in] what	What to observe (OBS_SCREEN and/or OBS_NVT), or 0
+ *			to stop
+ * @param[in] limit	How far it may fall behind, in bytes
+ *
+ * @return True if the connection can observe
+ */
+bool
+task_observe(unsigned what, size_t limit)
+{
+    task_t *redirect = task_redirect_to();
+
+    if (redirect == NULL || redirect->cbx.cb->observe == NULL) {
+	return false;
+    }
+    return (*redirect->cbx.cb->observe)(redirect->cbx.handle, what, limit);
+}
+
 /* Capabilities action, sets flags in the current CB. */
 static bool
 Capabilities_action(ia_t ia, unsigned argc, const char **argv)
@@ -3780,6 +5245,7 @@ Capabilities_action(ia_t ia, unsigned argc, const char **argv)
     } fname[] = {
 	{ CBF_INTERACTIVE, "interactive" },
 	{ CBF_PWINPUT, "pwinput" },
+	{ CBF_FRAMED, "framed" },
 	{ 0, NULL }
     };
 
@@ -3809,7 +5275,7 @@ Capabilities_action(ia_t ia, unsigned argc, const char **argv)
     for (i = 0; i < argc; i++) {
 	for (j = 0; fname[j].name != NULL; j++) {
 	    if (!strcasecmp(argv[i], fname[j].name)) {
-		flags |= fname[i].flag;
+		flags |= fname[j].flag;
 		break;
 	    }
 	}
@@ -3819,6 +5285,12 @@ Capabilities_action(ia_t ia, unsigned argc, const char **argv)
 	}
     }
 
+    if ((flags & CBF_FRAMED) && !(redirect->cbx.cb->flags & CB_FRAMING)) {
+	popup_an_error(AnCapabilities "(): framed protocol not supported on "
+		"this task type");
+	return false;
+    }
+
     if (flags) {
 	(*redirect->cbx.cb->setflags)(redirect->cbx.handle, flags);
     }
@@ -4064,7 +5536,7 @@ sample_continue_input(void *handle, const char *text)
 {
     sample_per_type_t *state = (sample_per_type_t *)handle;
 
-    vtrace("Continuing RequestInput\n");
+    vctrace(TC_TASK, "Continuing RequestInput\n");
     action_output("You said '%s'", text);
 
     /* Remember for next time. */
@@ -4082,7 +5554,7 @@ sample_abort_input(void *handle)
 {
     sample_per_type_t *state = (sample_per_type_t *)handle;
 
-    vtrace("Canceling RequestInput\n");
+    vctrace(TC_TASK, "Canceling RequestInput\n");
     if (state != NULL) {
 	Replace(state->previous, NewString("[canceled]"));
     }
@@ -4094,7 +5566,7 @@ sample_abort_session(void *handle)
 {
     sample_per_type_t *state = (sample_per_type_t *)handle;
 
-    vtrace("Canceling input request session\n");
+    vctrace(TC_TASK, "Canceling input request session\n");
     if (state != NULL) {
 	Replace(state->previous, NULL);
 	Free(state);
@@ -41,8 +41,12 @@
 
 #if !defined(_WIN32) /*[*/
 # include <sys/ioctl.h>
+# include <sys/uio.h>
 # include <netinet/in.h>
+# include <netinet/tcp.h>
+# include <poll.h>
 #endif /*]*/
+#include <limits.h>
 #define TELCMDS 1
 #define TELOPTS 1
 #include "arpa_telnet.h"
@@ -65,8 +69,12 @@
 #include "b8.h"
 #include "boolstr.h"
 #include "ctlrc.h"
+#include "footprint.h"
+#include "varbuf.h"	/* must precede hibernate.h and sioc.h */
+#include "hibernate.h"
 #include "host.h"
 #include "indent_s.h"
+#include "keylat.h"
 #include "kybd.h"
 #include "lazya.h"
 #include "linemode.h"
@@ -77,9 +85,10 @@
 #include "resolver.h"
 #include "resources.h"
 #include "sio.h"
-#include "varbuf.h"	/* must precede sioc.h */
 #include "sioc.h"
+#include "spans.h"
 #include "split_host.h"
+#include "startup.h"
 #include "stats.h"
 #include "task.h"
 #include "telnet.h"
@@ -100,6 +109,20 @@
 # define TELOPT_NAWS	31
 #endif /*]*/
 
+/* Scatter/gather output vectors. */
+#if defined(_WIN32) /*[*/
+typedef WSABUF netvec_t;
+# define NV_BASE(v)	((v).buf)
+# define NV_LEN(v)	((v).len)
+#else /*][*/
+typedef struct iovec netvec_t;
+# define NV_BASE(v)	((v).iov_base)
+# define NV_LEN(v)	((v).iov_len)
+#endif /*]*/
+#if !defined(IOV_MAX) /*[*/
+# define IOV_MAX	16
+#endif /*]*/
+
 #if !defined(TELOPT_STARTTLS) /*[*/
 # define TELOPT_STARTTLS	46
 #endif /*]*/
@@ -107,6 +130,8 @@
 
 #define BUFSZ		32768
 #define TRACELINE	72
+#define LINEDUMP_MAX	32
+#define NOP_SLACK_MS	1000	/* NOPs can be sent up to 1s late */
 
 #define N_OPTS		256
 
@@ -119,10 +144,6 @@
 /* Globals */
 char    	*hostname = NULL;
 time_t          ns_time;
-int             ns_brcvd;
-int             ns_rrcvd;
-int             ns_bsent;
-int             ns_rsent;
 unsigned char  *obuf;		/* 3270 output buffer */
 unsigned char  *obptr = (unsigned char *) NULL;
 bool            linemode = true;
@@ -148,8 +169,10 @@ static unsigned char *ibuf = (unsigned char *) NULL;
 			/* 3270 input buffer */
 static unsigned char *ibptr;
 static int      ibuf_size = 0;	/* size of ibuf */
+static unsigned ibuf_grows = 0;	/* number of times ibuf has grown */
 static unsigned char *obuf_base = NULL;
 static int	obuf_size = 0;
+static unsigned obuf_grows = 0;	/* number of times obuf has grown */
 static unsigned char *netrbuf = NULL;
 			/* network input buffer */
 static unsigned char *sbbuf = NULL;
@@ -215,13 +238,18 @@ static ntim_t ntim = NTIM_UNKNOWN;
 static ntim_t parse_ntim(const char *value);
 
 static bool telnet_fsm(unsigned char c);
+static void trace_nvt_char(unsigned char c);
 static void net_rawout(unsigned const char *buf, size_t len);
+static void net_send_pending(void);
+static bool net_write_failed(void);
 static void check_in3270(void);
 static void store3270in(unsigned char c);
+static void store3270in_bulk(const unsigned char *buf, size_t len);
 static void check_linemode(bool init);
 static int non_blocking(bool on);
 static void net_connected(void);
 static void connection_complete(void);
+static void remove_output(void);
 static int tn3270e_negotiate(void);
 static int process_eor(void);
 static const char *tn3270e_function_names(const unsigned char *, int);
@@ -319,6 +347,19 @@ static bool need_tls_follows = false;
 
 static bool net_connect_pending;
 
+/*
+ * NVT output, and 3270 replies generated while processing host records,
+ * waiting to be sent in one piece.
+ */
+#define NVT_OUT_MAX	4096
+#define REPLY_OUT_MAX	65536
+static varbuf_t pending_out;
+static bool batch_replies = false;
+#if defined(TCP_CORK) /*[*/
+static bool net_corked = false;
+#endif /*]*/
+static bool net_closing = false;
+
 #if !defined(_WIN32) /*[*/
 static void output_possible(iosrc_t fd, ioid_t id);
 #endif /*]*/
@@ -374,6 +415,23 @@ static int resolver_pipe[2] = { -1, -1 };
 static int resolver_slot = -1;
 static iosrc_t resolver_event = INVALID_IOSRC;
 
+#if !defined(_WIN32) /*[*/
+/*
+ * Connection racing (RFC 8305). While the connection to haddr[ha_ix] is
+ * pending, further addresses are tried at RACE_DELAY_MS intervals. The
+ * first attempt to complete becomes the connection and the rest are closed.
+ */
+#define RACE_DELAY_MS	250
+static struct {
+    socket_t s;
+    int ix;
+    ioid_t output_id;
+} racer[NUM_HA];
+static int n_racers = 0;
+static int race_next_ix = 0;	/* next haddr[] entry to try */
+static ioid_t race_timeout_id = NULL_IOID;
+#endif /*]*/
+
 #if defined(_WIN32) /*[*/
 void
 popup_a_sockerr(const char *fmt, ...)
@@ -409,17 +467,337 @@ connect_timed_out(ioid_t id _is_unused)
     host_disconnect(true);
 }
 
+/*
+ * Set the options for the low-latency (Q:) host profile: no Nagle delay,
+ * interactive priority and DSCP, and optional keepalive timing. Failures
+ * are traced, but do not stop the connection.
+ */
+static void
+set_latency_options(socket_t s, int family)
+{
+    int on = 1;
+#if !defined(_WIN32) /*[*/
+    int tos;
+#endif /*]*/
+
+    if (setsockopt(s, IPPROTO_TCP, TCP_NODELAY, (char *)&on,
+		sizeof(on)) < 0) {
+	vctrace(TC_TELNET, "setsockopt(TCP_NODELAY): %s\n",
+		socket_strerror(socket_errno()));
+    }
+#if defined(SO_PRIORITY) /*[*/
+    {
+	int priority = 6;	/* TC_PRIO_INTERACTIVE */
+
+	if (setsockopt(s, SOL_SOCKET, SO_PRIORITY, (char *)&priority,
+		    sizeof(priority)) < 0) {
+	    vctrace(TC_TELNET, "setsockopt(SO_PRIORITY): %s\n",
+		    socket_strerror(socket_errno()));
+	}
+    }
+#endif /*]*/
+
+#if !defined(_WIN32) /*[*/
+    /* The DSCP is the top six bits of the TOS or traffic class byte. */
+    if (appres.latency_dscp > 0 && appres.latency_dscp < 64) {
+	tos = appres.latency_dscp << 2;
+	if (family == AF_INET) {
+	    if (setsockopt(s, IPPROTO_IP, IP_TOS, (char *)&tos,
+			sizeof(tos)) < 0) {
+		vctrace(TC_TELNET, "setsockopt(IP_TOS): %s\n",
+			strerror(errno));
+	    }
+	}
+# if defined(IPV6_TCLASS) /*[*/
+	if (family == AF_INET6) {
+	    if (setsockopt(s, IPPROTO_IPV6, IPV6_TCLASS, (char *)&tos,
+			sizeof(tos)) < 0) {
+		vctrace(TC_TELNET, "setsockopt(IPV6_TCLASS): %s\n",
+			strerror(errno));
+	    }
+	}
+# endif /*]*/
+    }
+
+    /* Keepalive timing: idle,interval,count, in seconds. */
+    if (appres.latency_keepalive != NULL && *appres.latency_keepalive) {
+	int idle, intvl, cnt;
+	char extra;
+
+	if (sscanf(appres.latency_keepalive, "%d,%d,%d%c", &idle, &intvl,
+		    &cnt, &extra) != 3 || idle <= 0 || intvl <= 0 || cnt <= 0) {
+	    popup_an_error("Invalid %s '%s'", ResLatencyKeepalive,
+		    appres.latency_keepalive);
+	    return;
+	}
+# if defined(TCP_KEEPIDLE) /*[*/
+	setsockopt(s, IPPROTO_TCP, TCP_KEEPIDLE, (char *)&idle, sizeof(idle));
+# elif defined(TCP_KEEPALIVE) /*][*/
+	setsockopt(s, IPPROTO_TCP, TCP_KEEPALIVE, (char *)&idle, sizeof(idle));
+# endif /*]*/
+# if defined(TCP_KEEPINTVL) /*[*/
+	setsockopt(s, IPPROTO_TCP, TCP_KEEPINTVL, (char *)&intvl,
+		sizeof(intvl));
+# endif /*]*/
+# if defined(TCP_KEEPCNT) /*[*/
+	setsockopt(s, IPPROTO_TCP, TCP_KEEPCNT, (char *)&cnt, sizeof(cnt));
+# endif /*]*/
+    }
+#endif /*]*/
+}
+
+/*
+ * Ask for the next ACK to go out at once, rather than being delayed. Linux
+ * clears this after a while, so it is set again around each AID and read.
+ */
+static void
+net_quickack(void)
+{
+#if defined(TCP_QUICKACK) /*[*/
+    int on = 1;
+
+    if (HOST_FLAG(LOW_LATENCY_HOST) && sock != INVALID_SOCKET &&
+	    !local_process) {
+	setsockopt(sock, IPPROTO_TCP, TCP_QUICKACK, (char *)&on, sizeof(on));
+    }
+#endif /*]*/
+}
+
+/* Set options for inline out-of-band data and keepalives. */
+static bool
+set_sock_options(socket_t s, int family)
+{
+    int			on = 1;
+#if defined(OMTU) /*[*/
+    int			mtu = OMTU;
+#endif /*]*/
+
+    if (setsockopt(s, SOL_SOCKET, SO_OOBINLINE, (char *)&on,
+		sizeof(on)) < 0) {
+	popup_a_sockerr("setsockopt(SO_OOBINLINE)");
+	return false;
+    }
+    if (setsockopt(s, SOL_SOCKET, SO_KEEPALIVE, (char *)&on,
+		sizeof(on)) < 0) {
+	popup_a_sockerr("setsockopt(SO_KEEPALIVE)");
+	return false;
+    }
+#if defined(OMTU) /*[*/
+    if (setsockopt(s, SOL_SOCKET, SO_SNDBUF, (char *)&mtu,
+		sizeof(mtu)) < 0) {
+	popup_a_sockerr("setsockopt(SO_SNDBUF)");
+	return false;
+    }
+#endif /*]*/
+    if (HOST_FLAG(LOW_LATENCY_HOST)) {
+	set_latency_options(s, family);
+    }
+    return true;
+}
+
+#if !defined(_WIN32) /*[*/
+/*
+ * Order haddr[] so that address families alternate, starting with the
+ * family of the first address, as described in RFC 8305.
+ */
+static void
+interleave_addresses(void)
+{
+    sockaddr_46_t new_haddr[NUM_HA];
+    socklen_t new_len[NUM_HA];
+    bool used[NUM_HA];
+    bool want_v4 = haddr[0].sa.sa_family == AF_INET;
+    int i, j;
+
+    memset(used, 0, sizeof(used));
+    for (i = 0; i < num_ha; i++) {
+	/* Take the first unused address of the wanted family, if any. */
+	for (j = 0; j < num_ha; j++) {
+	    if (!used[j] && (haddr[j].sa.sa_family == AF_INET) == want_v4) {
+		break;
+	    }
+	}
+	if (j >= num_ha) {
+	    for (j = 0; used[j]; j++) {
+	    }
+	}
+	used[j] = true;
+	new_haddr[i] = haddr[j];
+	new_len[i] = ha_len[j];
+	want_v4 = haddr[j].sa.sa_family != AF_INET;
+    }
+    memcpy(haddr, new_haddr, num_ha * sizeof(haddr[0]));
+    memcpy(ha_len, new_len, num_ha * sizeof(ha_len[0]));
+}
+
+/* Close the racing connection attempts. */
+static void
+race_cancel(void)
+{
+    int i;
+
+    for (i = 0; i < n_racers; i++) {
+	RemoveInput(racer[i].output_id);
+	SOCK_CLOSE(racer[i].s);
+    }
+    n_racers = 0;
+    if (race_timeout_id != NULL_IOID) {
+	RemoveTimeOut(race_timeout_id);
+	race_timeout_id = NULL_IOID;
+    }
+}
+
+/* Remove an entry from racer[], without closing it. */
+static void
+race_remove(int i)
+{
+    RemoveInput(racer[i].output_id);
+    memmove(&racer[i], &racer[i + 1], (n_racers - i - 1) * sizeof(racer[0]));
+    n_racers--;
+}
+
+static void race_output_possible(iosrc_t fd, ioid_t id);
+
+/* Start a connection attempt to the next untried address. */
+static void
+race_start(void)
+{
+    while (race_next_ix < num_ha) {
+	int ix = race_next_ix++;
+	socket_t s;
+	char hn[256];
+	char pn[256];
+	char *errmsg;
+	int f;
+
+	if ((s = socket(haddr[ix].sa.sa_family, SOCK_STREAM, IPPROTO_TCP)) ==
+		INVALID_SOCKET) {
+	    vctrace(TC_TELNET, "socket: %s\n", strerror(errno));
+	    continue;
+	}
+	if (!set_sock_options(s, haddr[ix].sa.sa_family) ||
+		(f = fcntl(s, F_GETFL, 0)) == -1 ||
+		fcntl(s, F_SETFL, f | O_NDELAY) < 0) {
+	    SOCK_CLOSE(s);
+	    continue;
+	}
+	fcntl(s, F_SETFD, 1);
+
+	if (numeric_host_and_port(&haddr[ix].sa, ha_len[ix], hn, sizeof(hn),
+		    pn, sizeof(pn), &errmsg)) {
+	    vctrace(TC_TELNET, "Also trying %s, port %s...\n", hn, pn);
+	}
+	if (connect(s, &haddr[ix].sa, ha_len[ix]) == -1 &&
+		!IS_EINPROGRESS(socket_errno()) &&
+		socket_errno() != SE_EWOULDBLOCK) {
+	    vctrace(TC_TELNET, "Connect failed: %s\n", strerror(errno));
+	    SOCK_CLOSE(s);
+	    continue;
+	}
+
+	/* Completion (or failure) shows up as output possible. */
+	racer[n_racers].s = s;
+	racer[n_racers].ix = ix;
+	racer[n_racers].output_id = AddOutput(s, race_output_possible);
+	n_racers++;
+	return;
+    }
+}
+
+/* Time to start another connection attempt. */
+static void
+race_timed_out(ioid_t id _is_unused)
+{
+    race_timeout_id = NULL_IOID;
+    race_start();
+    if (race_next_ix < num_ha) {
+	race_timeout_id = AddTimeOut(RACE_DELAY_MS, race_timed_out);
+    }
+}
+
+/* Replace the primary connection attempt with racer[i]. */
+static void
+race_promote(int i)
+{
+    socket_t old_sock = sock;
+
+    /* Switch inputs to the new socket before closing the old one. */
+    remove_output();
+    sock = racer[i].s;
+    ha_ix = racer[i].ix;
+    race_remove(i);
+    host_newfd(sock);
+    SOCK_CLOSE(old_sock);
+}
+
+/* A racing connection attempt completed or failed. */
+static void
+race_output_possible(iosrc_t fd _is_unused, ioid_t id)
+{
+    int i;
+    int err = 0;
+    socklen_t len = sizeof(err);
+
+    for (i = 0; i < n_racers; i++) {
+	if (racer[i].output_id == id) {
+	    break;
+	}
+    }
+    if (i >= n_racers) {
+	return;
+    }
+
+    if (getsockopt(racer[i].s, SOL_SOCKET, SO_ERROR, (char *)&err,
+		&len) < 0) {
+	err = errno;
+    }
+    if (err != 0) {
+	vctrace(TC_TELNET, "Connection attempt %d failed: %s\n",
+		racer[i].ix + 1, strerror(err));
+	SOCK_CLOSE(racer[i].s);
+	race_remove(i);
+
+	/* Don't wait to try the next one. */
+	race_start();
+	return;
+    }
+
+    /* This one won. */
+    vctrace(TC_TELNET, "Connection attempt %d completed first\n",
+	    racer[i].ix + 1);
+    race_promote(i);
+    race_cancel();
+    if (cstate == TCP_PENDING) {
+	connection_complete();
+    }
+}
+
+/*
+ * The primary connection attempt failed. Returns true if a racing attempt
+ * has taken its place.
+ */
+static bool
+race_fallback(void)
+{
+    if (n_racers == 0) {
+	/* Continue with the next untried address, if any. */
+	ha_ix = race_next_ix - 1;
+	return false;
+    }
+    race_promote(0);
+    output_id = AddOutput(sock, output_possible);
+    race_start();
+    return true;
+}
+#endif /*]*/
+
 /* Connect to one of the addresses in haddr[]. */
 static iosrc_t
 connect_to(int ix, bool noisy, bool *pending)
 {
-    int			on = 1;
     char		hn[256];
     char		pn[256];
     char		*errmsg;
-#if defined(OMTU) /*[*/
-    int			mtu = OMTU;
-#endif /*]*/
 #   define close_fail	{ SOCK_CLOSE(sock); \
     			  sock = INVALID_SOCKET; \
     			  return INVALID_IOSRC; \
@@ -432,24 +810,9 @@ connect_to(int ix, bool noisy, bool *pending)
 	return INVALID_IOSRC;
     }
 
-    /* set options for inline out-of-band data and keepalives */
-    if (setsockopt(sock, SOL_SOCKET, SO_OOBINLINE, (char *)&on,
-		sizeof(on)) < 0) {
-	popup_a_sockerr("setsockopt(SO_OOBINLINE)");
-	close_fail;
-    }
-    if (setsockopt(sock, SOL_SOCKET, SO_KEEPALIVE, (char *)&on,
-		sizeof(on)) < 0) {
-	popup_a_sockerr("setsockopt(SO_KEEPALIVE)");
+    if (!set_sock_options(sock, haddr[ix].sa.sa_family)) {
 	close_fail;
     }
-#if defined(OMTU) /*[*/
-    if (setsockopt(sock, SOL_SOCKET, SO_SNDBUF, (char *)&mtu,
-		sizeof(mtu)) < 0) {
-	popup_a_sockerr("setsockopt(SO_SNDBUF)");
-	close_fail;
-    }
-#endif /*]*/
 
     /* set the socket to be non-delaying */
     if (non_blocking(true) < 0) {
@@ -471,7 +834,7 @@ connect_to(int ix, bool noisy, bool *pending)
 
     if (numeric_host_and_port(&haddr[ix].sa, ha_len[ix], hn, sizeof(hn), pn,
 		sizeof(pn), &errmsg)) {
-	vtrace("Trying %s, port %s...\n", hn, pn);
+	vctrace(TC_TELNET, "Trying %s, port %s...\n", hn, pn);
 	telnet_gui_connecting(hn, pn);
     }
 
@@ -485,10 +848,16 @@ connect_to(int ix, bool noisy, bool *pending)
     if (connect(sock, &haddr[ix].sa, ha_len[ix]) == -1) {
 	if (socket_errno() == SE_EWOULDBLOCK ||
 		IS_EINPROGRESS(socket_errno())) {
-	    vtrace("TCP connection pending.\n");
+	    vctrace(TC_TELNET, "TCP connection pending.\n");
 	    *pending = true;
 #if !defined(_WIN32) /*[*/
 	    output_id = AddOutput(sock, output_possible);
+
+	    /* Race the remaining addresses. */
+	    race_next_ix = ix + 1;
+	    if (race_next_ix < num_ha && race_timeout_id == NULL_IOID) {
+		race_timeout_id = AddTimeOut(RACE_DELAY_MS, race_timed_out);
+	    }
 #endif /*]*/
 	} else {
 	    if (noisy) {
@@ -552,6 +921,9 @@ finish_connect(iosrc_t *iosrc)
     }
 
     /* Try each of the haddrs. */
+#if !defined(_WIN32) /*[*/
+    interleave_addresses();
+#endif /*]*/
     ha_ix = 0;
     while (ha_ix < num_ha) {
 	bool pending = false;
@@ -593,18 +965,19 @@ resolve_done(iosrc_t fd, ioid_t id)
     /* Might be a canceled request. */
     slot = (int)slot_byte;
     if (slot != resolver_slot) {
-	vtrace("Cleaning up canceled resolver slot %d\n", slot);
+	vctrace(TC_TELNET, "Cleaning up canceled resolver slot %d\n", slot);
 	cleanup_host_and_port(slot);
 	return;
     }
 
     rv = collect_host_and_port(slot, &haddr[0].sa, sizeof(haddr[0]), ha_len,
-	    &current_port, &errmsg, NUM_HA, &num_ha);
+	    proxy_pending? &proxy_port: &current_port, &errmsg,
+	    proxy_pending? 1: NUM_HA, &num_ha);
     if (RHP_IS_ERROR(rv)) {
 	connect_error("%s", errmsg);
 	return;
     }
-    vtrace("Resolution complete, %d address%s\n", num_ha, 
+    vctrace(TC_TELNET, "Resolution complete, %d address%s\n", num_ha, 
 	    (num_ha == 1)? "": "es");
 
     /* Proceed with the connection. */
@@ -616,6 +989,34 @@ resolve_done(iosrc_t fd, ioid_t id)
     }
 }
 
+/* Set up the resolver pipe, the first time through. */
+static bool
+resolver_init(void)
+{
+    int rv;
+
+    if (resolver_pipe[0] != -1) {
+	return true;
+    }
+
+#if !defined(_WIN32) /*[*/
+    rv = pipe(resolver_pipe);
+#else /*][*/
+    rv = _pipe(resolver_pipe, 512, _O_BINARY);
+#endif /*]*/
+    if (rv < 0) {
+	connect_error("resolver pipe: %s", strerror(errno));
+	return false;
+    }
+#if !defined(_WIN32) /*[*/
+    AddInput(resolver_pipe[0], resolve_done);
+#else /*][*/
+    resolver_event = CreateEvent(NULL, FALSE, FALSE, NULL);
+    AddInput(resolver_event, resolve_done);
+#endif /*]*/
+    return true;
+}
+
 /*
  * net_connect
  *	Establish a telnet socket to the given host passed as an argument.
@@ -644,10 +1045,7 @@ net_connect(const char *host, char *portname, char *accept, bool ls,
     }
 
     linemode_init();
-    ns_brcvd = 0;
-    ns_rrcvd = 0;
-    ns_bsent = 0;
-    ns_rsent = 0;
+    stats_reset();
 
     environ_init();
 
@@ -660,6 +1058,9 @@ net_connect(const char *host, char *portname, char *accept, bool ls,
     /* set up temporary termtype */
     net_set_default_termtype();
 
+    /* Reuse recent name lookups for up to dnsCacheTtl seconds. */
+    set_resolver_cache_ttl(appres.dns_cache_ttl);
+
     /* get the passthru host and port number */
     if (HOST_FLAG(PASSTHRU_HOST)) {
 	const char *hn;
@@ -728,18 +1129,28 @@ net_connect(const char *host, char *portname, char *accept, bool ls,
 	/*
 	 * XXX: We don't try multiple addresses for a proxy
 	 * host.
+	 *
+	 * Only the proxy host is resolved here, and in the background; the
+	 * target host name is passed to the proxy as-is.
 	 */
 	rhp_t rv;
-	int nr;
 
-	rv = resolve_host_and_port(proxy_host, proxy_portname, &proxy_port,
-		&haddr[0].sa, sizeof(haddr[0]), &ha_len[0], &errmsg, 1, &nr);
+	if (!resolver_init()) {
+	    return NC_FAILED;
+	}
+	rv = resolve_host_and_port_a(proxy_host, proxy_portname, &proxy_port,
+		&haddr[0].sa, sizeof(haddr[0]), ha_len, &errmsg, 1, &num_ha,
+		&resolver_slot, resolver_pipe[1], resolver_event);
 	if (RHP_IS_ERROR(rv)) {
 	    connect_error("%s", errmsg);
 	    return NC_FAILED;
 	}
-	num_ha = 1;
 	ha_ix = 0;
+
+	if (rv == RHP_PENDING) {
+	    vctrace(TC_TELNET, "Resolver slot is %d (proxy)\n", resolver_slot);
+	    return NC_RESOLVING;
+	}
     } else {
 #if defined(LOCAL_PROCESS) /*[*/
 	if (ls) {
@@ -748,24 +1159,8 @@ net_connect(const char *host, char *portname, char *accept, bool ls,
 #endif /*]*/
 	    rhp_t rv;
 
-	    if (resolver_pipe[0] == -1) {
-		int rv;
-
-#if !defined(_WIN32) /*[*/
-		rv = pipe(resolver_pipe);
-#else /*][*/
-		rv = _pipe(resolver_pipe, 512, _O_BINARY);
-#endif /*]*/
-		if (rv < 0) {
-		    connect_error("resolver pipe: %s", strerror(errno));
-		    return NC_FAILED;
-		}
-#if !defined(_WIN32) /*[*/
-		AddInput(resolver_pipe[0], resolve_done);
-#else /*][*/
-		resolver_event = CreateEvent(NULL, FALSE, FALSE, NULL);
-		AddInput(resolver_event, resolve_done);
-#endif /*]*/
+	    if (!resolver_init()) {
+		return NC_FAILED;
 	    }
 
 #if defined(LOCAL_PROCESS) /*[*/
@@ -781,7 +1176,7 @@ net_connect(const char *host, char *portname, char *accept, bool ls,
 	    ha_ix = 0;
 
 	    if (rv == RHP_PENDING) {
-		vtrace("Resolver slot is %d\n", resolver_slot);
+		vctrace(TC_TELNET, "Resolver slot is %d\n", resolver_slot);
 		return NC_RESOLVING;
 	    }
 #if defined(LOCAL_PROCESS) /*[*/
@@ -893,10 +1288,11 @@ send_nop(ioid_t id _is_unused)
 {
     static unsigned char nop[] = { IAC, NOP };
 
-    vtrace("SENT NOP\n");
+    vctrace(TC_TELNET, "SENT NOP\n");
     net_rawout(nop, sizeof(nop));
     if (cstate != NOT_CONNECTED) {
-	nop_timeout_id = AddTimeOut(appres.nop_seconds * 1000, send_nop);
+	nop_timeout_id = AddTimeOutCoalesced(appres.nop_seconds * 1000,
+	    NOP_SLACK_MS, send_nop);
     } else {
 	nop_timeout_id = NULL_IOID;
     }
@@ -945,10 +1341,7 @@ net_connected_complete(void)
 
     /* clear statistics and flags */
     time(&ns_time);
-    ns_brcvd = 0;
-    ns_rrcvd = 0;
-    ns_bsent = 0;
-    ns_rsent = 0;
+    stats_reset();
     syncing = 0;
     tn3270e_negotiated = 0;
     tn3270e_submode = E_UNBOUND;
@@ -969,7 +1362,8 @@ net_connected_complete(void)
 
     /* set up NOP transmission */
     if (appres.nop_seconds != 0) {
-	nop_timeout_id = AddTimeOut(appres.nop_seconds * 1000, send_nop);
+	nop_timeout_id = AddTimeOutCoalesced(appres.nop_seconds * 1000,
+	    NOP_SLACK_MS, send_nop);
     }
 }
 
@@ -978,14 +1372,22 @@ net_connected(void)
 {
     bool data = false;
 
+    startup_mark(STARTUP_CONNECT);
+
     /* Cancel the timeout. */
     if (connect_timeout_id != NULL_IOID) {
 	RemoveTimeOut(connect_timeout_id);
 	connect_timeout_id = NULL_IOID;
     }
+#if !defined(_WIN32) /*[*/
+
+    /* The connection is made, so stop racing. */
+    race_cancel();
+#endif /*]*/
 
     if (cstate != TLS_PENDING) {
-	vtrace("Connected to %s, port %u.\n", hostname, current_port);
+	vctrace(TC_TELNET, "Connected to %s, port %u.\n", hostname,
+		current_port);
     }
 
     if (proxy_pending) {
@@ -995,18 +1397,19 @@ net_connected(void)
 	proxy_pending = false;
 
 	/* Negotiate with the proxy. */
-	vtrace("Connected to proxy server %s, port %u.\n", proxy_host,
-		proxy_port);
+	vctrace(TC_TELNET, "Connected to proxy server %s, port %u.\n",
+		proxy_host, proxy_port);
 
 	change_cstate(PROXY_PENDING, "net_connected");
 
+	proxy_set_local_dns(appres.proxy_local_dns);
 	ret = proxy_negotiate(sock, proxy_user, hostname, current_port, false);
 	if (ret == PX_FAILURE) {
 	    host_disconnect(true);
 	    return;
 	}
 	if (ret == PX_WANTMORE) {
-	    vtrace("Proxy needs more data\n");
+	    vctrace(TC_TELNET, "Proxy needs more data\n");
 	    return;
 	}
     }
@@ -1026,14 +1429,14 @@ net_connected(void)
 	    return;
 	}
 	if (rv == SIG_WANTMORE) {
-	    vtrace("Need more TLS data\n");
+	    vctrace(TC_TELNET, "Need more TLS data\n");
 	    return;
 	}
 
 	secure_connection = true;
 	session = indent_s(sio_session_info(sio));
 	cert = indent_s(sio_server_cert_info(sio));
-	vtrace("Connection is now secure.\n"
+	vctrace(TC_TELNET, "Connection is now secure.\n"
 		"Provider: %s\n"
 		"Session:\n%s\nServer certificate:\n%s\n",
 		sio_provider(), session, cert);
@@ -1048,7 +1451,7 @@ net_connected(void)
     net_connected_complete();
 
     if (data) {
-	vtrace("Reading extra data after negotiation\n");
+	vctrace(TC_TELNET, "Reading extra data after negotiation\n");
 	net_input(INVALID_IOSRC, NULL_IOID);
     }
 }
@@ -1137,7 +1540,7 @@ output_possible(iosrc_t fd _is_unused, ioid_t id _is_unused)
 # define COMPLETE_CONNECT(s)	connect(s, &haddr[ha_ix].sa, sizeof(haddr[0]))
 #endif /*]*/
 
-    vtrace("Output possible\n");
+    vctrace(TC_TELNET, "Output possible\n");
 
     /*
      * Try a connect() again to see if the connection completed sucessfully.
@@ -1150,8 +1553,11 @@ output_possible(iosrc_t fd _is_unused, ioid_t id _is_unused)
      */
     if (COMPLETE_CONNECT(sock) < 0) {
 	if (errno != EISCONN) {
-	    vtrace("RCVD socket error %d (%s)\n", socket_errno(),
+	    vctrace(TC_TELNET, "RCVD socket error %d (%s)\n", socket_errno(),
 		    strerror(errno));
+	    if (cstate == TCP_PENDING && race_fallback()) {
+		return;
+	    }
 	    popup_a_sockerr("Connection%s failed",
 		    proxy_pending? " to proxy server": "");
 	    host_disconnect(true);
@@ -1174,6 +1580,17 @@ output_possible(iosrc_t fd _is_unused, ioid_t id _is_unused)
 void
 net_disconnect(bool including_tls)
 {
+    /* Send what the user typed before the connection goes away. */
+    if (CONNECTED) {
+	net_closing = true;
+	net_flush_output();
+	net_closing = false;
+    }
+    vb_reset(&pending_out);
+#if defined(TCP_CORK) /*[*/
+    net_corked = false;
+#endif /*]*/
+
     if (including_tls && sio != NULL) {
 	sio_close(sio);
 	sio = NULL;
@@ -1183,13 +1600,16 @@ net_disconnect(bool including_tls)
     if (CONNECTED) {
 	shutdown(sock, 2);
     }
+
+    /* Stop watching for output before the socket goes away. */
+    remove_output();
     SOCK_CLOSE(sock);
     sock = INVALID_SOCKET;
 #if defined(_WIN32) /*[*/
     CloseHandle(sock_handle);
     sock_handle = INVALID_HANDLE_VALUE;
 #endif /*]*/
-    vtrace("SENT disconnect\n");
+    vctrace(TC_TELNET, "SENT disconnect\n");
 
     /* Cancel proxy. */
     if (proxy_type != PT_NONE) {
@@ -1203,6 +1623,11 @@ net_disconnect(bool including_tls)
 	RemoveTimeOut(connect_timeout_id);
 	connect_timeout_id = NULL_IOID;
     }
+#if !defined(_WIN32) /*[*/
+
+    /* Cancel connection racing. */
+    race_cancel();
+#endif /*]*/
 
     /* Cancel NOPs. */
     if (nop_timeout_id != NULL_IOID) {
@@ -1213,9 +1638,6 @@ net_disconnect(bool including_tls)
     /* We're not connected to an LU any more. */
     vstatus_lu(NULL);
 
-    /* We have no more interest in output buffer space. */
-    remove_output();
-
     /* If we refused TLS and never entered 3270 mode, say so. */
     if (refused_tls && !any_host_data) {
 	if (!appres.tls.starttls) {
@@ -1251,10 +1673,15 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
     register unsigned char *cp;
     int	nr;
     bool ignore_tls = false;
+    size_t total = 0;
 
 #if defined(_WIN32) /*[*/
     WSANETWORKEVENTS events;
+#endif /*]*/
 
+    hibernate_touch();
+
+#if defined(_WIN32) /*[*/
     /*
      * Make the socket non-blocking.
      * Note that WSAEventSelect does this automatically (and won't allow
@@ -1276,7 +1703,7 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 	host_disconnect(true);
 	return;
     }
-    vtrace("net_input: NetworkEvents 0x%lx%s%s%s\n",
+    vctrace(TC_TELNET, "net_input: NetworkEvents 0x%lx%s%s%s\n",
 	    events.lNetworkEvents,
 	    (events.lNetworkEvents & FD_CONNECT) ? " CONNECT": "",
 	    (events.lNetworkEvents & FD_CLOSE) ? " CLOSE": "",
@@ -1296,7 +1723,7 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 		}
 	    }
 	} else {
-	    vtrace("Spurious net_input call\n");
+	    vctrace(TC_TELNET, "Spurious net_input call\n");
 	    return;
 	}
     }
@@ -1307,7 +1734,7 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 	proxy_negotiate_ret_t ret = proxy_continue();
 
 	if (ret == PX_WANTMORE) {
-	    vtrace("Proxy needs more data\n");
+	    vctrace(TC_TELNET, "Proxy needs more data\n");
 	    return;
 	}
 	if (ret == PX_FAILURE) {
@@ -1335,9 +1762,11 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 	}
     }
 
+read_more:
     nvt_data = 0;
 
-    vtrace("Reading host socket%s\n", secure_connection? " via TLS": "");
+    vctrace(TC_TELNET, "Reading host socket%s\n",
+	    secure_connection? " via TLS": "");
 
     if (secure_connection) {
 	/*
@@ -1362,11 +1791,15 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 	}
     }
     gettimeofday(&net_last_recv_ts, NULL);
-    vtrace("Host socket read complete nr=%d\n", nr);
+    vctrace(TC_TELNET, "Host socket read complete nr=%d\n", nr);
     if (nr < 0) {
 	if ((secure_connection && nr == SIO_EWOULDBLOCK) ||
 	    (!secure_connection && socket_errno() == SE_EWOULDBLOCK)) {
-	    vtrace("EWOULDBLOCK\n");
+	    vctrace(TC_TELNET, "EWOULDBLOCK\n");
+	    if (total > 0) {
+		/* Read-ahead drained the socket. */
+		goto done;
+	    }
 	    return;
 	}
 	if (secure_connection && !ignore_tls) {
@@ -1380,14 +1813,19 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 	}
 #if defined(LOCAL_PROCESS) /*[*/
 	if (errno == EIO && local_process) {
-	    vtrace("RCVD local process disconnect\n");
+	    vctrace(TC_TELNET, "RCVD local process disconnect\n");
 	    host_disconnect(false);
 	    return;
 	}
 #endif /*]*/
-	vtrace("RCVD socket error %d (%s)\n", socket_errno(),
+	vctrace(TC_TELNET, "RCVD socket error %d (%s)\n", socket_errno(),
 		socket_strerror(socket_errno()));
 	if (cstate == TCP_PENDING) {
+#if !defined(_WIN32) /*[*/
+	    if (race_fallback()) {
+		return;
+	    }
+#endif /*]*/
 	    if (ha_ix == num_ha - 1) {
 		popup_a_sockerr(AnConnect "() to %s%s, port %d",
 			(proxy_type != PT_NONE)? "proxy ": "",
@@ -1414,7 +1852,7 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 	return;
     } else if (nr == 0) {
 	/* Host disconnected. */
-	vtrace("RCVD disconnect\n");
+	vctrace(TC_TELNET, "RCVD disconnect\n");
 	host_disconnect(false);
 	return;
     }
@@ -1426,10 +1864,14 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 	net_connected();
 	remove_output();
     }
+    net_quickack();
 
     trace_netdata('<', netrbuf, nr);
 
-    ns_brcvd += nr;
+    stats_add(STAT_BYTES_RX, nr);
+    if (secure_connection) {
+	stats_add(STAT_TLS_BYTES_RX, nr);
+    }
     stats_poke();
     for (cp = netrbuf; cp < (netrbuf + nr); cp++) {
 #if defined(LOCAL_PROCESS) /*[*/
@@ -1446,6 +1888,41 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 	    nvt_process((unsigned int) *cp);
 	} else {
 #endif /*]*/
+	    if (telnet_state == TNS_DATA && cstate != TELNET_PENDING &&
+		    !(IN_NVT && !IN_E)) {
+		/*
+		 * Fast path for 3270 data: copy everything up to the next IAC
+		 * into the input buffer at once. memchr() is vectorized by the
+		 * C library, so only IAC sequences go through the FSM.
+		 */
+		size_t left = (netrbuf + nr) - cp;
+		unsigned char *iac = HOST_FLAG(NO_TELNET_HOST)?
+		    NULL: (unsigned char *)memchr(cp, IAC, left);
+		size_t run = (iac != NULL)? (size_t)(iac - cp): left;
+
+		if (run > 0) {
+		    store3270in_bulk(cp, run);
+		    cp += run - 1;
+		    continue;
+		}
+	    }
+	    if (telnet_state == TNS_DATA && cstate != TELNET_PENDING &&
+		    IN_NVT && !IN_E && !syncing) {
+		/* Likewise for runs of NVT text. */
+		size_t run = nvt_process_run(cp, (netrbuf + nr) - cp);
+
+		if (run > 0) {
+		    if (TRACING_CATEGORY(TC_TELNET)) {
+			size_t i;
+
+			for (i = 0; i < run; i++) {
+			    trace_nvt_char(cp[i]);
+			}
+		    }
+		    cp += run - 1;
+		    continue;
+		}
+	    }
 	    if (!telnet_fsm(*cp)) {
 		ctlr_dbcs_postprocess();
 		host_disconnect(true);
@@ -1456,6 +1933,24 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 #endif /*]*/
     }
 
+    /*
+     * If the host may have sent more, keep reading (up to the budget) before
+     * returning to the event loop, so back-to-back records are all applied
+     * to the screen before it is redrawn and before the task queue runs.
+     */
+    total += nr;
+    if (sock != INVALID_SOCKET &&
+	    cstate >= TELNET_PENDING &&
+#if defined(LOCAL_PROCESS) /*[*/
+	    !local_process &&
+#endif /*]*/
+	    (nr == BUFSZ || secure_connection) &&
+	    total < (size_t)appres.net_read_budget) {
+	net_nvt_break();
+	goto read_more;
+    }
+
+done:
     if (IN_NVT) {
 	ctlr_dbcs_postprocess();
     }
@@ -1463,7 +1958,7 @@ net_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 
 #if defined(_WIN32) /*[*/
     if (events.lNetworkEvents & FD_CLOSE) {
-	vtrace("RCVD disconnect\n");
+	vctrace(TC_TELNET, "RCVD disconnect\n");
 	host_disconnect(false);
     }
 #endif /*]*/
@@ -1512,7 +2007,8 @@ send_naws(void)
     sprintf(naws_msg + naws_len, "%c%c", IAC, SE);
     naws_len += 2;
     net_rawout((unsigned char *)naws_msg, naws_len);
-    vtrace("SENT %s NAWS %d %d %s\n", cmd(SB), XMIT_COLS, XMIT_ROWS, cmd(SE));
+    vctrace(TC_TELNET, "SENT %s NAWS %d %d %s\n", cmd(SB), XMIT_COLS,
+	    XMIT_ROWS, cmd(SE));
 }
 
 
@@ -1587,6 +2083,26 @@ force_local(char *s)
  *	Telnet finite-state machine.
  *	Returns true for okay, false for errors.
  */
+/* Trace one byte of NVT data. */
+static void
+trace_nvt_char(unsigned char c)
+{
+    char *see_chr;
+    size_t sl;
+
+    if (!nvt_data) {
+	vctrace(TC_TELNET, "<.. ");
+	nvt_data = 4;
+    }
+    see_chr = ctl_see((int) c);
+    nvt_data += (sl = strlen(see_chr));
+    if (nvt_data >= TRACELINE) {
+	vctrace(TC_TELNET, " ...\n... ");
+	nvt_data = 4 + sl;
+    }
+    vctrace(TC_TELNET, "%s", see_chr);
+}
+
 static bool
 telnet_fsm(unsigned char c)
 {
@@ -1612,17 +2128,7 @@ telnet_fsm(unsigned char c)
 	    ps_process();
 	}
 	if (IN_NVT && !IN_E) {
-	    if (!nvt_data) {
-		vtrace("<.. ");
-		nvt_data = 4;
-	    }
-	    see_chr = ctl_see((int) c);
-	    nvt_data += (sl = strlen(see_chr));
-	    if (nvt_data >= TRACELINE) {
-		vtrace(" ...\n... ");
-		nvt_data = 4 + sl;
-	    }
-	    vtrace("%s", see_chr);
+	    trace_nvt_char(c);
 	    if (!syncing) {
 		if (((linemode && appres.linemode.onlcr) ||
 		     (!linemode && charmode_onlcr))
@@ -1637,22 +2143,22 @@ telnet_fsm(unsigned char c)
 	break;
     case TNS_IAC:	/* process a telnet command */
 	if (c != EOR && c != IAC) {
-	    vtrace("RCVD %s ", cmd(c));
+	    vctrace(TC_TELNET, "RCVD %s ", cmd(c));
 	}
 	switch (c) {
 	case IAC:	/* escaped IAC, insert it */
 	    if (IN_NVT && !IN_E) {
 		if (!nvt_data) {
-		    vtrace("<.. ");
+		    vctrace(TC_TELNET, "<.. ");
 		    nvt_data = 4;
 		}
 		see_chr = ctl_see((int) c);
 		nvt_data += (sl = strlen(see_chr));
 		if (nvt_data >= TRACELINE) {
-		    vtrace(" ...\n ...");
+		    vctrace(TC_TELNET, " ...\n ...");
 		    nvt_data = 4 + sl;
 		}
-		vtrace("%s", see_chr);
+		vctrace(TC_TELNET, "%s", see_chr);
 		nvt_process((unsigned int) c);
 	    } else {
 		store3270in(c);
@@ -1661,15 +2167,24 @@ telnet_fsm(unsigned char c)
 	    break;
 	case EOR:	/* eor, process accumulated input */
 	    if (IN_3270 || (IN_E && tn3270e_negotiated)) {
-		ns_rrcvd++;
+		bool failed;
+
+		stats_inc(STAT_RECORDS_RX);
 		stats_poke();
-		if (process_eor()) {
+
+		/* Replies to this record are sent from the event loop. */
+		batch_replies = true;
+		span_eor_start(ibptr - ibuf);
+		failed = process_eor();
+		span_eor_end();
+		batch_replies = false;
+		if (failed) {
 		    return false;
 		}
 	    } else {
 		Warning("EOR received when not in 3270 mode, ignored.");
 	    }
-	    vtrace("RCVD EOR\n");
+	    vctrace(TC_TELNET, "RCVD EOR\n");
 	    ibptr = ibuf;
 	    telnet_state = TNS_DATA;
 	    break;
@@ -1693,7 +2208,7 @@ telnet_fsm(unsigned char c)
 	    sbptr = sbbuf;
 	    break;
 	case DM:
-	    vtrace("\n");
+	    vctrace(TC_TELNET, "\n");
 	    if (syncing) {
 		syncing = 0;
 #if !defined(_WIN32) /*[*/
@@ -1706,17 +2221,17 @@ telnet_fsm(unsigned char c)
 	    break;
 	case GA:
 	case NOP:
-	    vtrace("\n");
+	    vctrace(TC_TELNET, "\n");
 	    telnet_state = TNS_DATA;
 	    break;
 	default:
-	    vtrace("???\n");
+	    vctrace(TC_TELNET, "???\n");
 	    telnet_state = TNS_DATA;
 	    break;
 	}
 	break;
     case TNS_WILL:	/* telnet WILL DO OPTION command */
-	vtrace("%s\n", opt(c));
+	vctrace(TC_TELNET, "%s\n", opt(c));
 	switch (c) {
 	case TELOPT_SGA:
 	case TELOPT_BINARY:
@@ -1729,14 +2244,14 @@ telnet_fsm(unsigned char c)
 		    hisopts[c] = 1;
 		    do_opt[2] = c;
 		    net_rawout(do_opt, sizeof(do_opt));
-		    vtrace("SENT %s %s\n", cmd(DO), opt(c));
+		    vctrace(TC_TELNET, "SENT %s %s\n", cmd(DO), opt(c));
 
 		    /* For UTS, volunteer to do EOR when they do. */
 		    if (c == TELOPT_EOR && !myopts[c]) {
 			myopts[c] = 1;
 			will_opt[2] = c;
 			net_rawout(will_opt, sizeof(will_opt));
-			vtrace("SENT %s %s\n", cmd(WILL), opt(c));
+			vctrace(TC_TELNET, "SENT %s %s\n", cmd(WILL), opt(c));
 		    }
 
 		    check_in3270();
@@ -1747,25 +2262,25 @@ telnet_fsm(unsigned char c)
 	default:
 	    dont_opt[2] = c;
 	    net_rawout(dont_opt, sizeof(dont_opt));
-	    vtrace("SENT %s %s\n", cmd(DONT), opt(c));
+	    vctrace(TC_TELNET, "SENT %s %s\n", cmd(DONT), opt(c));
 	    break;
 	}
 	telnet_state = TNS_DATA;
 	break;
     case TNS_WONT:	/* telnet WONT DO OPTION command */
-	vtrace("%s\n", opt(c));
+	vctrace(TC_TELNET, "%s\n", opt(c));
 	if (hisopts[c]) {
 	    hisopts[c] = 0;
 	    dont_opt[2] = c;
 	    net_rawout(dont_opt, sizeof(dont_opt));
-	    vtrace("SENT %s %s\n", cmd(DONT), opt(c));
+	    vctrace(TC_TELNET, "SENT %s %s\n", cmd(DONT), opt(c));
 	    check_in3270();
 	    check_linemode(false);
 	}
 	telnet_state = TNS_DATA;
 	break;
     case TNS_DO:	/* telnet PLEASE DO OPTION command */
-	vtrace("%s\n", opt(c));
+	vctrace(TC_TELNET, "%s\n", opt(c));
 	switch (c) {
 	case TELOPT_BINARY:
 	case TELOPT_EOR:
@@ -1812,7 +2327,7 @@ telnet_fsm(unsigned char c)
 		}
 		will_opt[2] = c;
 		net_rawout(will_opt, sizeof(will_opt));
-		vtrace("SENT %s %s\n", cmd(WILL), opt(c));
+		vctrace(TC_TELNET, "SENT %s %s\n", cmd(WILL), opt(c));
 		check_in3270();
 		check_linemode(false);
 	    }
@@ -1829,7 +2344,7 @@ telnet_fsm(unsigned char c)
 		 * follows is TLS.
 		 */
 		net_rawout(follows_msg, sizeof(follows_msg));
-		vtrace("SENT %s %s FOLLOWS %s\n", cmd(SB),
+		vctrace(TC_TELNET, "SENT %s %s FOLLOWS %s\n", cmd(SB),
 			opt(TELOPT_STARTTLS), cmd(SE));
 		need_tls_follows = true;
 	    }
@@ -1838,18 +2353,18 @@ telnet_fsm(unsigned char c)
 	wont:
 	    wont_opt[2] = c;
 	    net_rawout(wont_opt, sizeof(wont_opt));
-	    vtrace("SENT %s %s\n", cmd(WONT), opt(c));
+	    vctrace(TC_TELNET, "SENT %s %s\n", cmd(WONT), opt(c));
 	    break;
 	}
 	telnet_state = TNS_DATA;
 	break;
     case TNS_DONT:	/* telnet PLEASE DON'T DO OPTION command */
-	vtrace("%s\n", opt(c));
+	vctrace(TC_TELNET, "%s\n", opt(c));
 	if (myopts[c]) {
 	    myopts[c] = 0;
 	    wont_opt[2] = c;
 	    net_rawout(wont_opt, sizeof(wont_opt));
-	    vtrace("SENT %s %s\n", cmd(WONT), opt(c));
+	    vctrace(TC_TELNET, "SENT %s %s\n", cmd(WONT), opt(c));
 	    check_in3270();
 	    check_linemode(false);
 	}
@@ -1873,7 +2388,8 @@ telnet_fsm(unsigned char c)
 		size_t tt_len, tb_len;
 		char *tt_out;
 
-		vtrace("%s %s\n", opt(sbbuf[0]), telquals[sbbuf[1]]);
+		vctrace(TC_TELNET, "%s %s\n", opt(sbbuf[0]),
+			telquals[sbbuf[1]]);
 		if (lus != NULL && try_lu == NULL) {
 		    /* None of the LUs worked. */
 		    connect_error("Cannot connect to specified LU");
@@ -1901,8 +2417,8 @@ telnet_fsm(unsigned char c)
 
 		vstatus_lu(connected_lu);
 
-		vtrace("SENT %s %s %s %s%s%s %s\n", cmd(SB), opt(TELOPT_TTYPE),
-			telquals[TELQUAL_IS], termtype,
+		vctrace(TC_TELNET, "SENT %s %s %s %s%s%s %s\n", cmd(SB),
+			opt(TELOPT_TTYPE), telquals[TELQUAL_IS], termtype,
 			(try_lu != NULL && *try_lu)? "@": "",
 			(try_lu != NULL && *try_lu)? try_lu: "",
 			cmd(SE));
@@ -1929,14 +2445,14 @@ telnet_fsm(unsigned char c)
 		if (!telnet_new_environ(sbbuf + 2, (sbptr - sbbuf - 3),
 			    &reply_buf, &reply_buflen, &trace_in,
 			    &trace_out)) {
-		    vtrace("%s %s [error]\n", opt(sbbuf[0]),
+		    vctrace(TC_TELNET, "%s %s [error]\n", opt(sbbuf[0]),
 			    telquals[sbbuf[1]]);
 		} else {
-		    vtrace("%s\n", trace_in);
+		    vctrace(TC_TELNET, "%s\n", trace_in);
 		    Free(trace_in);
 		    net_rawout(reply_buf, reply_buflen);
 		    Free(reply_buf);
-		    vtrace("SENT %s\n", trace_out);
+		    vctrace(TC_TELNET, "SENT %s\n", trace_out);
 		    Free(trace_out);
 		}
 
@@ -1950,7 +2466,8 @@ telnet_fsm(unsigned char c)
 		if (deferred_will_ttype && myopts[TELOPT_TTYPE]) {
 		    will_opt[2] = TELOPT_TTYPE;
 		    net_rawout(will_opt, sizeof(will_opt));
-		    vtrace("SENT %s %s\n", cmd(WILL), opt(TELOPT_TTYPE));
+		    vctrace(TC_TELNET, "SENT %s %s\n", cmd(WILL),
+			    opt(TELOPT_TTYPE));
 		    check_in3270();
 		    check_linemode(false);
 		    deferred_will_ttype = false;
@@ -2001,7 +2518,7 @@ tn3270e_request(void)
     net_hexnvt_out_framed((unsigned char *)tt_out, tb_len, true);
     Free(tt_out);
 
-    vtrace("SENT %s %s DEVICE-TYPE REQUEST %s%s%s %s\n",
+    vctrace(TC_TELNET, "SENT %s %s DEVICE-TYPE REQUEST %s%s%s %s\n",
 	cmd(SB), opt(TELOPT_TN3270E), xtn,
 	(try_lu != NULL && *try_lu)? " CONNECT ": "",
 	(try_lu != NULL && *try_lu)? try_lu: "",
@@ -2016,12 +2533,12 @@ tn3270e_request(void)
 static void
 backoff_tn3270e(const char *why)
 {
-    vtrace("Aborting TN3270E: %s\n", why);
+    vctrace(TC_TELNET, "Aborting TN3270E: %s\n", why);
 
     /* Tell the host 'no'. */
     wont_opt[2] = TELOPT_TN3270E;
     net_rawout(wont_opt, sizeof(wont_opt));
-    vtrace("SENT %s %s\n", cmd(WONT), opt(TELOPT_TN3270E));
+    vctrace(TC_TELNET, "SENT %s %s\n", cmd(WONT), opt(TELOPT_TN3270E));
 
     /* Restore the LU list; we may need to run it again in TN3270 mode. */
     setup_lus();
@@ -2051,22 +2568,22 @@ tn3270e_negotiate(void)
 	}
     }
 
-    vtrace("TN3270E ");
+    vctrace(TC_TELNET, "TN3270E ");
 
     switch (sbbuf[1]) {
     case TN3270E_OP_SEND:
 	if (sbbuf[2] == TN3270E_OP_DEVICE_TYPE) {
 	    /* Host wants us to send our device type. */
-	    vtrace("SEND DEVICE-TYPE SE\n");
+	    vctrace(TC_TELNET, "SEND DEVICE-TYPE SE\n");
 	    tn3270e_request();
 	} else {
-	    vtrace("SEND ??%u SE\n", sbbuf[2]);
+	    vctrace(TC_TELNET, "SEND ??%u SE\n", sbbuf[2]);
 	}
 	break;
 
     case TN3270E_OP_DEVICE_TYPE:
 	/* Device type negotiation. */
-	vtrace("DEVICE-TYPE ");
+	vctrace(TC_TELNET, "DEVICE-TYPE ");
 	switch (sbbuf[2]) {
 	case TN3270E_OP_IS: {
 	    int tnlen, snlen;
@@ -2106,8 +2623,8 @@ tn3270e_negotiate(void)
 		connected_lu = reported_lu;
 	    }
 
-	    vtrace("IS %s CONNECT %s SE\n", tnlen? connected_type: "",
-		    snlen? connected_lu: "");
+	    vctrace(TC_TELNET, "IS %s CONNECT %s SE\n",
+		    tnlen? connected_type: "", snlen? connected_lu: "");
 
 	    if (snlen) {
 		vstatus_lu(connected_lu);
@@ -2119,7 +2636,7 @@ tn3270e_negotiate(void)
 	    }
 	case TN3270E_OP_REJECT:
 	    /* Device type failure. */
-	    vtrace("REJECT REASON %s SE\n", rsn(sbbuf[4]));
+	    vctrace(TC_TELNET, "REJECT REASON %s SE\n", rsn(sbbuf[4]));
 	    if (sbbuf[4] == TN3270E_REASON_UNSUPPORTED_REQ) {
 		backoff_tn3270e("Host rejected request type");
 		break;
@@ -2138,19 +2655,19 @@ tn3270e_negotiate(void)
 
 	    break;
 	default:
-	    vtrace("??%u SE\n", sbbuf[2]);
+	    vctrace(TC_TELNET, "??%u SE\n", sbbuf[2]);
 	    break;
 	}
 	break;
 
     case TN3270E_OP_FUNCTIONS:
 	/* Functions negotiation. */
-	vtrace("FUNCTIONS ");
+	vctrace(TC_TELNET, "FUNCTIONS ");
 
 	switch (sbbuf[2]) {
 	case TN3270E_OP_REQUEST:
 	    /* Host is telling us what functions they want. */
-	    vtrace("REQUEST %s SE\n",
+	    vctrace(TC_TELNET, "REQUEST %s SE\n",
 		    tn3270e_function_names(sbbuf+3, sblen-3));
 
 	    tn3270e_fdecode(sbbuf+3, sblen-3, &e_rcvd);
@@ -2159,7 +2676,7 @@ tn3270e_negotiate(void)
 		b8_copy(&e_funcs, &e_rcvd);
 		tn3270e_subneg_send(TN3270E_OP_IS, &e_funcs);
 		tn3270e_negotiated = 1;
-		vtrace("TN3270E option negotiation complete.\n");
+		vctrace(TC_TELNET, "TN3270E option negotiation complete.\n");
 		check_in3270();
 	    } else {
 		/*
@@ -2173,7 +2690,8 @@ tn3270e_negotiate(void)
 
 	case TN3270E_OP_IS:
 	    /* They accept our last request, or a subset thereof. */
-	    vtrace("IS %s SE\n", tn3270e_function_names(sbbuf+3, sblen-3));
+	    vctrace(TC_TELNET, "IS %s SE\n",
+		    tn3270e_function_names(sbbuf+3, sblen-3));
 	    tn3270e_fdecode(sbbuf+3, sblen-3, &e_rcvd);
 	    if (b8_none_added(&e_funcs, &e_rcvd)) {
 		/* They want what we want, or less.  Done. */
@@ -2187,7 +2705,7 @@ tn3270e_negotiate(void)
 		break;
 	    }
 	    tn3270e_negotiated = 1;
-	    vtrace("TN3270E option negotiation complete.\n");
+	    vctrace(TC_TELNET, "TN3270E option negotiation complete.\n");
 
 	    /*
 	     * If the host does not support BIND_IMAGE, then we
@@ -2203,13 +2721,13 @@ tn3270e_negotiate(void)
 	    break;
 
 	default:
-	    vtrace("??%u SE\n", sbbuf[2]);
+	    vctrace(TC_TELNET, "??%u SE\n", sbbuf[2]);
 	    break;
 	}
 	break;
 
     default:
-	vtrace("??%u SE\n", sbbuf[1]);
+	vctrace(TC_TELNET, "??%u SE\n", sbbuf[1]);
     }
 
     /* Good enough for now. */
@@ -2276,7 +2794,7 @@ tn3270e_subneg_send(unsigned char op, b8_t *funcs)
     net_rawout(proto_buf, proto_len);
 
     /* Complete and send out the trace text. */
-    vtrace("SENT %s %s FUNCTIONS %s %s %s\n",
+    vctrace(TC_TELNET, "SENT %s %s FUNCTIONS %s %s %s\n",
 	    cmd(SB), opt(TELOPT_TN3270E),
 	    (op == TN3270E_OP_REQUEST)? "REQUEST": "IS",
 	    tn3270e_function_names(proto_buf + 5, proto_len - 7),
@@ -2492,7 +3010,7 @@ process_eor(void)
 	unsigned char *s;
 	enum pds rv;
 
-	vtrace("RCVD TN3270E(%s%s %s %u)\n",
+	vctrace(TC_TELNET, "RCVD TN3270E(%s%s %s %u)\n",
 		e_dt(h->data_type),
 		e_rq(h->data_type, h->request_flag),
 		e_rsp(h->data_type, h->response_flag),
@@ -2508,6 +3026,7 @@ process_eor(void)
 	    check_in3270();
 	    response_required = h->response_flag;
 	    rv = process_ds(ibuf + EH_SIZE, (ibptr - ibuf) - EH_SIZE);
+	    startup_mark(STARTUP_HOST_WRITE);
 	    if (rv < 0 && response_required != TN3270E_RSF_NO_RESPONSE) {
 		tn3270e_nak(rv);
 	    }
@@ -2597,6 +3116,7 @@ process_eor(void)
 	}
     } else {
 	process_ds(ibuf, ibptr - ibuf);
+	startup_mark(STARTUP_HOST_WRITE);
     }
     return 0;
 }
@@ -2610,11 +3130,11 @@ net_exception(iosrc_t fd _is_unused, ioid_t id _is_unused)
 {
 #if defined(LOCAL_PROCESS) /*[*/
     if (local_process) {
-	vtrace("RCVD exception\n");
+	vctrace(TC_TELNET, "RCVD exception\n");
     } else
 #endif /*[*/
     {
-	vtrace("RCVD urgent data indication\n");
+	vctrace(TC_TELNET, "RCVD urgent data indication\n");
 	if (!syncing) {
 	    syncing = 1;
 	    x_except_off();
@@ -2647,13 +3167,90 @@ net_cookedout(const char *buf, size_t len)
     if (toggled(TRACING)) {
 	size_t i;
 
-	vtrace(">");
+	vctrace(TC_TELNET, ">");
 	for (i = 0; i < len; i++) {
-	    vtrace(" %s", ctl_see((int)*(buf+i)));
+	    vctrace(TC_TELNET, " %s", ctl_see((int)*(buf+i)));
 	}
-	vtrace("\n");
+	vctrace(TC_TELNET, "\n");
+    }
+
+    /*
+     * Typed characters and String() text arrive a character or two at a
+     * time. Collect them and send them when the event loop is about to
+     * wait, rather than making a system call for each one.
+     */
+    vb_append(&pending_out, buf, len);
+    if (vb_len(&pending_out) >= NVT_OUT_MAX) {
+	net_flush_output();
+    }
+}
+
+/*
+ * net_set_cork
+ *	Turn TCP_CORK on or off, so a burst of replies goes out in full
+ *	segments.
+ */
+#if defined(TCP_CORK) /*[*/
+static void
+net_set_cork(bool on)
+{
+    int value = on;
+
+    if (setsockopt(sock, IPPROTO_TCP, TCP_CORK, (char *)&value,
+		sizeof(value)) < 0) {
+	vctrace(TC_TELNET, "setsockopt(TCP_CORK): %s\n",
+		socket_strerror(socket_errno()));
+	return;
+    }
+    net_corked = on;
+}
+#endif /*]*/
+
+/*
+ * net_flush_output
+ *	Send any collected NVT output and 3270 replies to the host.
+ */
+void
+net_flush_output(void)
+{
+    net_send_pending();
+#if defined(TCP_CORK) /*[*/
+    if (net_corked && sock != INVALID_SOCKET) {
+	net_set_cork(false);
+    }
+    net_corked = false;
+#endif /*]*/
+}
+
+/*
+ * net_send_pending
+ *	Send the collected output, leaving the socket corked.
+ */
+static void
+net_send_pending(void)
+{
+    varbuf_t out;
+
+    if (vb_len(&pending_out) == 0) {
+	return;
+    }
+    if (sock == INVALID_SOCKET) {
+	vb_reset(&pending_out);
+	return;
+    }
+
+    /* Take the buffer, so a failed write cannot re-enter. */
+    out = pending_out;
+    vb_init(&pending_out);
+    net_rawout((unsigned const char *)vb_buf(&out), vb_len(&out));
+
+    /* Keep the storage for the next time. */
+    if (pending_out.buf == NULL) {
+	pending_out = out;
+	vb_reset(&pending_out);
+    } else {
+	vb_free(&out);
     }
-    net_rawout((unsigned const char *)buf, len);
 }
 
 /*
@@ -2686,6 +3283,9 @@ net_rawout(unsigned const char *buf, size_t len)
 {
     int nw;
 
+    /* Anything collected goes first. */
+    net_send_pending();
+
     trace_netdata('>', buf, len);
 
     while (len) {
@@ -2712,25 +3312,16 @@ net_rawout(unsigned const char *buf, size_t len)
 	    nw = send(sock, (const char *) buf, (int)n2w, 0);
 	}
 	if (nw < 0) {
-	    if (secure_connection) {
-		connect_error("%s", sio_last_error());
-		host_disconnect(false);
-		return;
-	    }
-	    vtrace("RCVD socket error %d (%s)\n", socket_errno(),
-		    socket_strerror(socket_errno()));
-	    if (socket_errno() == SE_EPIPE || socket_errno() == SE_ECONNRESET) {
-		host_disconnect(false);
-		return;
-	    } else if (socket_errno() == SE_EINTR) {
+	    if (net_write_failed()) {
 		goto bot;
-	    } else {
-		popup_a_sockerr("Socket write");
-		host_disconnect(true);
-		return;
 	    }
+	    return;
+	}
+	stats_add(STAT_BYTES_TX, nw);
+	keylat_wire();
+	if (secure_connection) {
+	    stats_add(STAT_TLS_BYTES_TX, nw);
 	}
-	ns_bsent += nw;
 	stats_poke();
 	len -= nw;
 	buf += nw;
@@ -2744,6 +3335,141 @@ net_rawout(unsigned const char *buf, size_t len)
     }
 }
 
+/*
+ * net_write_failed
+ *	Handle a failed write to the host.
+ *	Returns true if the write should be retried, false if the connection
+ *	has been torn down.
+ */
+static bool
+net_write_failed(void)
+{
+    if (net_closing) {
+	/* Already on the way down; drop the rest. */
+	vctrace(TC_TELNET, "RCVD socket error %d (%s) while closing\n",
+		socket_errno(), socket_strerror(socket_errno()));
+	return false;
+    }
+    if (secure_connection) {
+	connect_error("%s", sio_last_error());
+	host_disconnect(false);
+	return false;
+    }
+    vctrace(TC_TELNET, "RCVD socket error %d (%s)\n", socket_errno(),
+	    socket_strerror(socket_errno()));
+    if (socket_errno() == SE_EPIPE || socket_errno() == SE_ECONNRESET) {
+	host_disconnect(false);
+	return false;
+    } else if (socket_errno() == SE_EINTR) {
+	return true;
+    } else {
+	popup_a_sockerr("Socket write");
+	host_disconnect(true);
+	return false;
+    }
+}
+
+/*
+ * trace_netdatav
+ *	Trace a vector of network data as if it were one contiguous buffer.
+ */
+static void
+trace_netdatav(char direction, const netvec_t *vec, int nvec)
+{
+    size_t offset = 0;
+    int i;
+
+    if (!toggled(TRACING) || !TRACING_CATEGORY(TC_TELNET)) {
+	return;
+    }
+    for (i = 0; i < nvec; i++) {
+	offset += NV_LEN(vec[i]);
+    }
+    if (trace_net_record(direction, offset)) {
+	for (i = 0; i < nvec; i++) {
+	    trace_net_append((const unsigned char *)NV_BASE(vec[i]),
+		    NV_LEN(vec[i]));
+	}
+	return;
+    }
+    offset = 0;
+    for (i = 0; i < nvec; i++) {
+	const unsigned char *buf = (const unsigned char *)NV_BASE(vec[i]);
+	size_t j;
+
+	for (j = 0; j < (size_t)NV_LEN(vec[i]); j++, offset++) {
+	    if (!(offset % LINEDUMP_MAX)) {
+		ntvtrace("%s%c 0x%-3x ", (offset? "\n": ""), direction,
+			(unsigned)offset);
+	    }
+	    ntvtrace("%02x", buf[j]);
+	}
+    }
+    ntvtrace("\n");
+}
+
+/*
+ * net_rawoutv
+ *	Send a vector of buffers to the host with as few system calls as
+ *	possible. The vector is modified. Not used for TLS, which needs a
+ *	contiguous buffer.
+ */
+static void
+net_rawoutv(netvec_t *vec, int nvec)
+{
+    net_send_pending();
+    trace_netdatav('>', vec, nvec);
+
+    while (nvec > 0) {
+	int n = (nvec > IOV_MAX)? IOV_MAX: nvec;
+	ssize_t nw;
+
+	if (NV_LEN(vec[0]) == 0) {
+	    vec++;
+	    nvec--;
+	    continue;
+	}
+#if defined(_WIN32) /*[*/
+	{
+	    DWORD sent;
+
+	    if (WSASend(sock, vec, n, &sent, 0, NULL, NULL) == SOCKET_ERROR) {
+		nw = -1;
+	    } else {
+		nw = sent;
+	    }
+	}
+#else /*][*/
+	nw = writev(sock, vec, n);
+#endif /*]*/
+	if (nw < 0) {
+	    if (net_write_failed()) {
+		continue;
+	    }
+	    return;
+	}
+	stats_add(STAT_BYTES_TX, nw);
+	keylat_wire();
+	if (secure_connection) {
+	    stats_add(STAT_TLS_BYTES_TX, nw);
+	}
+	stats_poke();
+
+	/* Skip what was written. */
+	while (nw > 0 && nvec > 0) {
+	    if ((size_t)nw >= (size_t)NV_LEN(vec[0])) {
+		nw -= NV_LEN(vec[0]);
+		vec++;
+		nvec--;
+	    } else {
+		NV_BASE(vec[0]) = (char *)NV_BASE(vec[0]) + nw;
+		NV_LEN(vec[0]) -= nw;
+		nw = 0;
+	    }
+	}
+    }
+}
+
 /*
  * net_hexnvt_out_framed
  *	Send uncontrolled user data to the host in NVT mode, performing IAC
@@ -2874,7 +3600,8 @@ check_in3270(void)
 	    tn3270e_submode = E_UNBOUND;
 	    tn3270e_bound = 0;
 	}
-	vtrace("Now operating in %s mode.\n", state_name[new_cstate]);
+	vctrace(TC_TELNET, "Now operating in %s mode.\n",
+		state_name[new_cstate]);
 	if (FULL_SESSION) {
 	    any_host_data = true;
 	}
@@ -2882,6 +3609,32 @@ check_in3270(void)
     }
 }
 
+/*
+ * grow_record_buffer
+ *	Make a 3270 record buffer at least 'need' bytes long, doubling its
+ *	size as many times as necessary. Record buffers are never shrunk, so
+ *	they keep their high-water size across records and connections, and
+ *	in steady state this does not allocate.
+ */
+static void
+grow_record_buffer(unsigned char **buf, int *size, size_t need,
+	const char *name, unsigned *grows)
+{
+    size_t new_size = *size? (size_t)*size: BUFSIZ;
+
+    if (need <= (size_t)*size) {
+	return;
+    }
+    while (new_size < need) {
+	new_size *= 2;
+    }
+    *buf = (unsigned char *)Realloc((char *)*buf, new_size);
+    *size = (int)new_size;
+    (*grows)++;
+    vctrace(TC_TELNET, "3270 %s buffer grew to %d bytes (%u time%s)\n", name,
+	    *size, *grows, (*grows == 1)? "": "s");
+}
+
 /*
  * store3270in
  *	Store a character in the 3270 input buffer, checking for buffer
@@ -2891,36 +3644,51 @@ static void
 store3270in(unsigned char c)
 {
     if (ibptr - ibuf >= ibuf_size) {
-	ibuf_size += BUFSIZ;
-	ibuf = (unsigned char *)Realloc((char *)ibuf, ibuf_size);
-	ibptr = ibuf + ibuf_size - BUFSIZ;
+	size_t used = ibptr - ibuf;
+
+	grow_record_buffer(&ibuf, &ibuf_size, used + 1, "input", &ibuf_grows);
+	ibptr = ibuf + used;
     }
     *ibptr++ = c;
 }
 
+/*
+ * store3270in_bulk
+ *	Store a run of characters in the 3270 input buffer, reallocating ibuf
+ *	if necessary.
+ */
+static void
+store3270in_bulk(const unsigned char *buf, size_t len)
+{
+    size_t used = ibptr - ibuf;
+
+    if (used + len > (size_t)ibuf_size) {
+	grow_record_buffer(&ibuf, &ibuf_size, used + len, "input",
+		&ibuf_grows);
+	ibptr = ibuf + used;
+    }
+    memcpy(ibptr, buf, len);
+    ibptr += len;
+}
+
 /*
  * space3270out
  *	Ensure that <n> more characters will fit in the 3270 output buffer.
- *	Allocates the buffer in BUFSIZ chunks.
+ *	Grows the buffer geometrically.
  *	Allocates hidden space at the front of the buffer for TN3270E.
  */
 void
 space3270out(size_t n)
 {
     size_t nc = 0;	/* amount of data currently in obuf */
-    unsigned more = 0;
 
     if (obuf_size) {
 	nc = obptr - obuf;
     }
 
-    while ((nc + n + EH_SIZE) > (obuf_size + more)) {
-	more += BUFSIZ;
-    }
-
-    if (more) {
-	obuf_size += more;
-	obuf_base = (unsigned char *)Realloc((char *)obuf_base, obuf_size);
+    if ((nc + n + EH_SIZE) > (size_t)obuf_size) {
+	grow_record_buffer(&obuf_base, &obuf_size, nc + n + EH_SIZE, "output",
+		&obuf_grows);
 	obuf = obuf_base + EH_SIZE;
 	obptr = obuf + nc;
     }
@@ -2964,7 +3732,7 @@ check_linemode(bool init)
 	}
 	st_changed(ST_LINE_MODE, linemode);
 	if (!init) {
-	    vtrace("Operating in %s mode.\n",
+	    vctrace(TC_TELNET, "Operating in %s mode.\n",
 		    linemode? "line": "character-at-a-time");
 	}
 	if (IN_NVT) {
@@ -3025,16 +3793,18 @@ opt(unsigned char c)
 }
 
 
-#define LINEDUMP_MAX	32
-
 void
 trace_netdata(char direction, unsigned const char *buf, size_t len)
 {
     size_t offset;
 
-    if (!toggled(TRACING)) {
+    if (!toggled(TRACING) || !TRACING_CATEGORY(TC_TELNET)) {
 	    return;
     }
+    if (trace_net_record(direction, len)) {
+	trace_net_append(buf, len);
+	return;
+    }
     for (offset = 0; offset < len; offset++) {
 	if (!(offset % LINEDUMP_MAX)) {
 	    ntvtrace("%s%c 0x%-3x ", (offset? "\n": ""), direction,
@@ -3045,23 +3815,75 @@ trace_netdata(char direction, unsigned const char *buf, size_t len)
     ntvtrace("\n");
 }
 
+/*
+ * net_queue_reply
+ *	Add an expanded 3270 record to the collected output. Replies generated
+ *	while processing host records (Query Replies, Read Partition and Read
+ *	Modified responses, DFT acknowledgements and upload data) are sent
+ *	together when the event loop is about to wait.
+ */
+static void
+net_queue_reply(unsigned const char *buf, size_t len)
+{
+    static unsigned char iac_eor[] = { IAC, EOR };
+
+#if defined(TCP_CORK) /*[*/
+    if (appres.output_cork && !net_corked
+# if defined(LOCAL_PROCESS) /*[*/
+	    && !local_process
+# endif /*]*/
+	    ) {
+	net_set_cork(true);
+    }
+#endif /*]*/
+
+    /* Copy, doubling each IAC. */
+    while (len > 0) {
+	unsigned const char *iac = (unsigned const char *)memchr(buf, IAC, len);
+	size_t n = (iac != NULL)? (size_t)(iac + 1 - buf): len;
+
+	vb_append(&pending_out, (const char *)buf, n);
+	if (iac != NULL) {
+	    vb_append(&pending_out, (const char *)iac, 1);
+	}
+	buf += n;
+	len -= n;
+    }
+    vb_append(&pending_out, (const char *)iac_eor, sizeof(iac_eor));
+
+    if (vb_len(&pending_out) >= REPLY_OUT_MAX) {
+	net_send_pending();
+    }
+}
+
 /*
  * net_output
  *	Send 3270 output over the network:
  *	- Prepend TN3270E header
  *	- Expand IAC to IAC IAC
  *	- Append IAC EOR
+ *
+ *	Replies to host records are collected and sent from the event loop.
+ *	Otherwise, unless TLS is active, this is done with a single gathered
+ *	write of the buffer in place: each IAC ends one segment and starts the
+ *	next, so it is sent twice without copying the record.
  */
 void
 net_output(void)
 {
     static unsigned char *xobuf = NULL;
     static int xobuf_len = 0;
-    int need_resize = 0;
+    static unsigned xobuf_grows = 0;
+    static netvec_t *vec = NULL;
+    static int vec_len = 0;
+    static unsigned char iac_eor[] = { IAC, EOR };
     unsigned char *nxoptr, *xoptr;
 
 #define BSTART	((IN_TN3270E || IN_SSCP)? obuf_base: obuf)
 
+    net_quickack();
+    span_output(obptr - BSTART);
+
     /* Set the TN3720E header. */
     if (IN_TN3270E || IN_SSCP) {
 	tn3270e_header *h = (tn3270e_header *)obuf_base;
@@ -3080,21 +3902,68 @@ net_output(void)
 	h->seq_number[0] = (e_xmit_seq >> 8) & 0xff;
 	h->seq_number[1] = e_xmit_seq & 0xff;
 
-	vtrace("SENT TN3270E(%s NO-RESPONSE %u)\n",
+	vctrace(TC_TELNET, "SENT TN3270E(%s NO-RESPONSE %u)\n",
 		IN_TN3270E? "3270-DATA": "SSCP-LU-DATA", e_xmit_seq);
 	if (b8_bit_is_set(&e_funcs, TN3270E_FUNC_RESPONSES)) {
 		e_xmit_seq = (e_xmit_seq + 1) & 0x7fff;
 	}
     }
 
-    /* Reallocate the expanded output buffer. */
-    while (xobuf_len <  (obptr - BSTART + 1) * 2) {
-	xobuf_len += BUFSZ;
-	need_resize++;
+    /* Replies to host records wait for the event loop. */
+    if (batch_replies) {
+	net_queue_reply(BSTART, obptr - BSTART);
+	vctrace(TC_TELNET, "QUEUED EOR\n");
+	stats_inc(STAT_RECORDS_TX);
+	stats_poke();
+	return;
     }
-    if (need_resize) {
-	Replace(xobuf, (unsigned char *)Malloc(xobuf_len));
+
+#if !defined(OMTU) /*[*/
+    if (!secure_connection) {
+	unsigned char *seg = BSTART;
+	unsigned char *iac;
+	int nvec = 0;
+
+	/* Build the vector, splitting the record after each IAC. */
+	nxoptr = BSTART;
+	for (;;) {
+	    if (nvec + 2 >= vec_len) {
+		vec_len = vec_len? (vec_len * 2): 16;
+		vec = (netvec_t *)Realloc(vec, vec_len * sizeof(netvec_t));
+	    }
+	    iac = (nxoptr < obptr)?
+		(unsigned char *)memchr(nxoptr, IAC, obptr - nxoptr): NULL;
+	    if (iac == NULL) {
+		break;
+	    }
+	    NV_BASE(vec[nvec]) = (char *)seg;
+	    NV_LEN(vec[nvec]) = (iac + 1) - seg;
+	    nvec++;
+	    seg = iac;
+	    nxoptr = iac + 1;
+	}
+	if (seg < obptr) {
+	    NV_BASE(vec[nvec]) = (char *)seg;
+	    NV_LEN(vec[nvec]) = obptr - seg;
+	    nvec++;
+	}
+
+	/* Append the IAC EOR and transmit. */
+	NV_BASE(vec[nvec]) = (char *)iac_eor;
+	NV_LEN(vec[nvec]) = sizeof(iac_eor);
+	nvec++;
+	net_rawoutv(vec, nvec);
+
+	vctrace(TC_TELNET, "SENT EOR\n");
+	stats_inc(STAT_RECORDS_TX);
+	stats_poke();
+	return;
     }
+#endif /*]*/
+
+    /* Reallocate the expanded output buffer. */
+    grow_record_buffer(&xobuf, &xobuf_len, (obptr - BSTART + 1) * 2,
+	    "expanded output", &xobuf_grows);
 
     /* Copy and expand IACs. */
     xoptr = xobuf;
@@ -3110,12 +3979,54 @@ net_output(void)
     *xoptr++ = EOR;
     net_rawout(xobuf, xoptr - xobuf);
 
-    vtrace("SENT EOR\n");
-    ns_rsent++;
+    vctrace(TC_TELNET, "SENT EOR\n");
+    stats_inc(STAT_RECORDS_TX);
     stats_poke();
 #undef BSTART
 }
 
+/*
+ * net_busy_poll
+ *	After an AID in the low-latency (Q:) profile, spin for up to
+ *	latencyBusyPoll microseconds waiting for the host's reply, so the
+ *	event loop finds it ready instead of going to sleep for it. The reply
+ *	itself is processed by the event loop as usual.
+ */
+void
+net_busy_poll(void)
+{
+#if !defined(_WIN32) /*[*/
+    struct pollfd pfd;
+    struct timeval start, now;
+    long elapsed;
+    int ready;
+
+    if (!HOST_FLAG(LOW_LATENCY_HOST) || appres.latency_busy_poll <= 0 ||
+	    !CONNECTED || sock == INVALID_SOCKET) {
+	return;
+    }
+
+    pfd.fd = sock;
+    pfd.events = POLLIN;
+    gettimeofday(&start, NULL);
+    for (;;) {
+	ready = poll(&pfd, 1, 0);
+	gettimeofday(&now, NULL);
+	elapsed = (now.tv_sec - start.tv_sec) * 1000000L +
+	    (now.tv_usec - start.tv_usec);
+	if (ready > 0) {
+	    vctrace(TC_TELNET, "Busy poll: host replied after %ldus\n",
+		    elapsed);
+	    return;
+	}
+	if (ready < 0 || elapsed < 0 || elapsed >= appres.latency_busy_poll) {
+	    break;
+	}
+    }
+    vctrace(TC_TELNET, "Busy poll: no reply after %ldus\n", elapsed);
+#endif /*]*/
+}
+
 /* Send a TN3270E positive response to the server. */
 static void
 tn3270e_ack(void)
@@ -3139,7 +4050,8 @@ tn3270e_ack(void)
     rsp_buf[rsp_len++] = TN3270E_POS_DEVICE_END;
     rsp_buf[rsp_len++] = IAC;
     rsp_buf[rsp_len++] = EOR;
-    vtrace("SENT TN3270E(RESPONSE POSITIVE-RESPONSE %u) DEVICE-END\n",
+    vctrace(TC_TELNET,
+	    "SENT TN3270E(RESPONSE POSITIVE-RESPONSE %u) DEVICE-END\n",
 	    h_in->seq_number[0] << 8 | h_in->seq_number[1]);
     net_rawout(rsp_buf, rsp_len);
 }
@@ -3177,7 +4089,7 @@ tn3270e_nak(enum pds rv)
     }
     rsp_buf[rsp_len++] = IAC;
     rsp_buf[rsp_len++] = EOR;
-    vtrace("SENT TN3270E(RESPONSE NEGATIVE-RESPONSE %u) %s\n",
+    vctrace(TC_TELNET, "SENT TN3270E(RESPONSE NEGATIVE-RESPONSE %u) %s\n",
 	    h_in->seq_number[0] << 8 | h_in->seq_number[1], neg);
     net_rawout(rsp_buf, rsp_len);
 }
@@ -3282,12 +4194,12 @@ net_linemode(void)
 	if (hisopts[TELOPT_ECHO]) {
 	    dont_opt[2] = TELOPT_ECHO;
 	    net_rawout(dont_opt, sizeof(dont_opt));
-	    vtrace("SENT %s %s\n", cmd(DONT), opt(TELOPT_ECHO));
+	    vctrace(TC_TELNET, "SENT %s %s\n", cmd(DONT), opt(TELOPT_ECHO));
 	}
 	if (hisopts[TELOPT_SGA]) {
 	    dont_opt[2] = TELOPT_SGA;
 	    net_rawout(dont_opt, sizeof(dont_opt));
-	    vtrace("SENT %s %s\n", cmd(DONT), opt(TELOPT_SGA));
+	    vctrace(TC_TELNET, "SENT %s %s\n", cmd(DONT), opt(TELOPT_SGA));
 	}
     } else {
 	hisopts[TELOPT_ECHO] = 0;
@@ -3306,12 +4218,12 @@ net_charmode(void)
 	if (!hisopts[TELOPT_ECHO]) {
 	    do_opt[2] = TELOPT_ECHO;
 	    net_rawout(do_opt, sizeof(do_opt));
-	    vtrace("SENT %s %s\n", cmd(DO), opt(TELOPT_ECHO));
+	    vctrace(TC_TELNET, "SENT %s %s\n", cmd(DO), opt(TELOPT_ECHO));
 	}
 	if (!hisopts[TELOPT_SGA]) {
 	    do_opt[2] = TELOPT_SGA;
 	    net_rawout(do_opt, sizeof(do_opt));
-	    vtrace("SENT %s %s\n", cmd(DO), opt(TELOPT_SGA));
+	    vctrace(TC_TELNET, "SENT %s %s\n", cmd(DO), opt(TELOPT_SGA));
 	}
     } else {
 	hisopts[TELOPT_ECHO] = 1;
@@ -3333,7 +4245,7 @@ net_break(char c)
 
 	/* I don't know if we should first send TELNET synch ? */
 	net_rawout(buf, sizeof(buf));
-	vtrace("SENT BREAK\n");
+	vctrace(TC_TELNET, "SENT BREAK\n");
     } else if (c != '\0') {
 	net_rawout((unsigned char *)&c, 1);
     }
@@ -3352,7 +4264,7 @@ net_interrupt(char c)
 
 	/* I don't know if we should first send TELNET synch ? */
 	net_rawout(buf, sizeof(buf));
-	vtrace("SENT IP\n");
+	vctrace(TC_TELNET, "SENT IP\n");
     } else if (c != '\0') {
 	net_rawout((unsigned char *)&c, 1);
     }
@@ -3381,7 +4293,7 @@ net_abort(void)
 	    break;
 	case E_SSCP:
 	    net_rawout(buf, sizeof(buf));
-	    vtrace("SENT AO\n");
+	    vctrace(TC_TELNET, "SENT AO\n");
 	    if (tn3270e_bound || !b8_bit_is_set(&e_funcs,
 					TN3270E_FUNC_BIND_IMAGE)) {
 		    tn3270e_submode = E_3270;
@@ -3390,7 +4302,7 @@ net_abort(void)
 	    break;
 	case E_3270:
 	    net_rawout(buf, sizeof(buf));
-	    vtrace("SENT AO\n");
+	    vctrace(TC_TELNET, "SENT AO\n");
 	    tn3270e_submode = E_SSCP;
 	    check_in3270();
 	    break;
@@ -3527,7 +4439,7 @@ non_blocking(bool on)
 # if defined(FIONBIO) /*[*/
     IOCTL_T i = on? 1: 0;
 
-    vtrace("Making host socket %sblocking\n", on? "non-": "");
+    vctrace(TC_TELNET, "Making host socket %sblocking\n", on? "non-": "");
     if (sock == INVALID_SOCKET) {
 	return 0;
     }
@@ -3539,7 +4451,7 @@ non_blocking(bool on)
 # else /*][*/
     int f;
 
-    vtrace("Making host socket %sblocking\n", on? "non-": "");
+    vctrace(TC_TELNET, "Making host socket %sblocking\n", on? "non-": "");
     if (sock == INVALID_SOCKET) {
 	return 0;
     }
@@ -3578,7 +4490,7 @@ net_starttls_continue(void)
 	return;
     }
     if (ret == SIG_WANTMORE) {
-	vtrace("Need more TLS data\n");
+	vctrace(TC_TELNET, "Need more TLS data\n");
 	if (starttls_pending == NOT_CONNECTED) {
 	    starttls_pending = cstate;
 	    change_cstate(TLS_PENDING, "net_starttls_continue");
@@ -3591,7 +4503,7 @@ net_starttls_continue(void)
     /* Success. */
     session = indent_s(sio_session_info(sio));
     cert = indent_s(sio_server_cert_info(sio));
-    vtrace("TLS negotiated connection complete. "
+    vctrace(TC_TELNET, "TLS negotiated connection complete. "
 	    "Connection is now secure.\n"
 	    "Provider: %s\n"
 	    "Session:\n%s\nServer certificate:\n%s\n",
@@ -3622,7 +4534,7 @@ net_starttls_continue(void)
 
     if (data) {
 	/* Got extra data with the negotiation. */
-	vtrace("Reading extra data after negotiation\n");
+	vctrace(TC_TELNET, "Reading extra data after negotiation\n");
 	net_input(INVALID_IOSRC, NULL_IOID);
     }
 }
@@ -3637,14 +4549,14 @@ continue_tls(unsigned char *sbbuf, int len)
     /* Make sure the option is FOLLOWS. */
     if (len < 2 || sbbuf[1] != TLS_FOLLOWS) {
 	/* Trace the junk. */
-	vtrace("%s ? %s\n", opt(TELOPT_STARTTLS), cmd(SE));
+	vctrace(TC_TELNET, "%s ? %s\n", opt(TELOPT_STARTTLS), cmd(SE));
 	connect_error("TLS negotiation failure");
 	host_disconnect(true);
 	return;
     }
 
     /* Trace what we got. */
-    vtrace("%s FOLLOWS %s\n", opt(TELOPT_STARTTLS), cmd(SE));
+    vctrace(TC_TELNET, "%s FOLLOWS %s\n", opt(TELOPT_STARTTLS), cmd(SE));
 
     /* Negotiate. */
     net_starttls_continue();
@@ -3727,6 +4639,32 @@ net_getsockname(void *buf, int *len)
     return getsockname(sock, buf, (socklen_t *)(void *)len);
 }
 
+/*
+ * Return the numeric address of the host we are directly connected to, or
+ * NULL if there is no direct TCP connection (not connected, a proxy or
+ * passthru gateway is in use, or the session is a local process).
+ */
+const char *
+net_peer_address(void)
+{
+    sockaddr_46_t sa;
+    socklen_t len = sizeof(sa);
+    char hn[256];
+    char pn[256];
+    char *errmsg;
+
+    if (!CONNECTED || sock == INVALID_SOCKET || local_process ||
+	    proxy_type != PT_NONE || HOST_FLAG(PASSTHRU_HOST)) {
+	return NULL;
+    }
+    if (getpeername(sock, &sa.sa, &len) < 0 ||
+	    !numeric_host_and_port(&sa.sa, len, hn, sizeof(hn), pn, sizeof(pn),
+		&errmsg)) {
+	return NULL;
+    }
+    return lazyaf("%s", hn);
+}
+
 /* Return a text version of the current proxy type, or NULL. */
 const char *
 net_proxy_type(void)
@@ -3920,7 +4858,8 @@ net_nop_seconds(void)
 
     /* Restart with the new interval. */
     if (cstate >= TELNET_PENDING) {
-	nop_timeout_id = AddTimeOut(appres.nop_seconds * 1000, send_nop);
+	nop_timeout_id = AddTimeOutCoalesced(appres.nop_seconds * 1000,
+	    NOP_SLACK_MS, send_nop);
     }
 }
 
@@ -3929,7 +4868,7 @@ void
 net_nvt_break(void)
 {
     if (nvt_data) {
-	vtrace("\n");
+	vctrace(TC_TELNET, "\n");
 	nvt_data = 0;
     }
 }
@@ -4012,10 +4951,29 @@ toggle_ntim(const char *name, const char *value)
     return true;
 }
 
+/* Footprint of the network buffers. */
+static size_t
+ibuf_footprint(void)
+{
+    return ibuf_size + (netrbuf != NULL? BUFSZ: 0) +
+	(sbbuf != NULL? 1024: 0);
+}
+
+static size_t
+obuf_footprint(void)
+{
+    return obuf_size;
+}
+
 /* Module registration. */
 void
 net_register(void)
 {
+    static footprint_t footprints[] = {
+	{ "telnet-ibuf", ibuf_footprint, false },
+	{ "telnet-obuf", obuf_footprint, false }
+    };
+
     /* Register for state changes. */
     register_schange(ST_REMODEL, net_remodel);
 
@@ -4025,4 +4983,7 @@ net_register(void)
     register_extended_toggle(ResNoTelnetInputMode, toggle_ntim, NULL,
 	    canonicalize_ntim,
 	    (void **)&appres.interactive.no_telnet_input_mode, XRM_STRING);
+
+    /* Register the buffer sizes. */
+    register_footprints(footprints, array_count(footprints));
 }
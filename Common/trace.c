@@ -38,6 +38,10 @@
 #include <signal.h>
 #include <fcntl.h>
 #include <limits.h>
+#include <sys/stat.h>
+#if !defined(_WIN32) /*[*/
+# include <sys/wait.h>
+#endif /*]*/
 #include "3270ds.h"
 #include "appres.h"
 #include "ctlr.h"
@@ -47,6 +51,7 @@
 #include "child.h"
 #include "ctlrc.h"
 #include "find_console.h"
+#include "footprint.h"
 #include "fprint_screen.h"
 #include "lazya.h"
 #include "menubar.h"
@@ -57,6 +62,7 @@
 #include "product.h"
 #include "resources.h"
 #include "save.h"
+#include "simd_glue.h"
 #include "status.h"
 #include "task.h"
 #include "telnet.h"
@@ -72,6 +78,11 @@
 # include "winprint.h"
 #endif /*]*/
 
+/* This file defines the functions the trace.h macros call. */
+#undef vtrace
+#undef ntvtrace
+#undef trace_ds
+
 /* Size of the data stream trace buffer. */
 #define TRACE_DS_BUFSIZE	(4*1024)
 
@@ -97,6 +108,35 @@
 # define IS_EILSEQ(e)	0
 #endif /*]*/
 
+/* Size of the trace file output buffer. */
+#define TRACE_BUFSIZE	65536
+#define SETTRACEBUF(s)	setvbuf(s, NULL, _IOFBF, TRACE_BUFSIZE)
+
+/*
+ * Binary trace files.
+ *
+ * A binary trace file starts with TRACE_BIN_MAGIC, followed by records. Each
+ * record starts with a one-byte type.
+ *
+ * Text records hold exactly what vtrace() or ntvtrace() would have written,
+ * minus the timestamps, terminated by a NUL. Timestamped text records have
+ * the time in seconds and microseconds between the type and the text.
+ * Successive calls are appended to the same text record until one of them
+ * needs a new timestamp.
+ *
+ * Network records have the time, the length of the data, and the raw bytes
+ * that trace_netdata() would have dumped in hex. The direction ('<' or '>')
+ * is the record type. Numbers are 32 bits, big-endian.
+ *
+ * The Playback/tracedecode utility turns a binary trace back into the usual
+ * text form.
+ */
+#define TRACE_BIN_MAGIC		"x3trc\001\r\n"
+#define TRACE_BIN_MAGIC_LEN	8
+#define TRACE_BIN_HDR_LEN	13	/* type, seconds, microseconds, length */
+#define TRACE_BIN_TEXT_TS	'T'	/* text, timestamped */
+#define TRACE_BIN_TEXT		't'	/* text, not timestamped */
+
 /* Typedefs */
 
 /* Statics */
@@ -110,7 +150,15 @@ static FILE    *tracef = NULL;
 static char    *tracef_bufptr = NULL;
 static off_t	tracef_size = 0;
 static off_t	tracef_max = 0;
+static off_t	tracef_total_max = 0;
+#if !defined(_WIN32) /*[*/
+static pid_t	trace_compress_pid = -1;
+static ioid_t	trace_compress_id = NULL_IOID;
+#endif /*]*/
 static char    *onetime_tracefile_name = NULL;
+static bool	tracef_dirty = false;
+static bool	tracef_binary = false;
+static char	tracef_bin_text = 0;
 
 static void	vwtrace(bool do_ts, const char *fmt, va_list args);
 static void	wtrace(bool do_ts, const char *fmt, ...);
@@ -120,10 +168,52 @@ static void	stop_tracing(void);
 /* Globals */
 bool		trace_skipping = false;
 char	       *tracefile_name = NULL;
+unsigned	trace_categories = 0;
 
 /* Statics */
 static bool 	 wrote_ts = false;
 
+/* Trace category names, in trace_category_t order. */
+static const char *trace_category_names[TC_COUNT] = {
+    "telnet", "ds", "kybd", "task", "http", "other"
+};
+
+/*
+ * Parse the traceCategories resource.
+ * Returns a mask of the categories to trace.
+ */
+static unsigned
+parse_trace_categories(void)
+{
+    static const char *delims = ", \t";
+    char *s, *name;
+    unsigned mask = 0;
+
+    if (appres.trace_categories == NULL || !*appres.trace_categories) {
+	return TCM_ALL;
+    }
+    s = NewString(appres.trace_categories);
+    for (name = strtok(s, delims); name != NULL; name = strtok(NULL, delims)) {
+	int i;
+
+	if (!strcasecmp(name, "all")) {
+	    mask = TCM_ALL;
+	    continue;
+	}
+	for (i = 0; i < TC_COUNT; i++) {
+	    if (!strcasecmp(name, trace_category_names[i])) {
+		mask |= TCM(i);
+		break;
+	    }
+	}
+	if (i >= TC_COUNT) {
+	    xs_warning("Unknown trace category '%s'", name);
+	}
+    }
+    Free(s);
+    return mask;
+}
+
 /* display a (row,col) */
 const char *
 rcba(int baddr)
@@ -301,6 +391,157 @@ gen_ts(void)
 	    (int)(tv.tv_usec / 1000L));
 }
 
+/*
+ * Write raw data to the trace file.
+ * Returns true for success, false if tracing has stopped.
+ */
+static bool
+trace_write(const void *buf, size_t len)
+{
+    if (fwrite(buf, len, 1, tracef) == 1) {
+	tracef_size += len;
+	if (tracef == stdout) {
+	    fflush(tracef);
+	} else {
+	    tracef_dirty = true;
+	}
+	return true;
+    }
+    if (errno != EPIPE) {
+	popup_an_errno(errno, "Write to trace file failed");
+    }
+    stop_tracing();
+    return false;
+}
+
+/* Store a 32-bit big-endian value. */
+static void
+put32(unsigned char *p, unsigned long v)
+{
+    p[0] = (unsigned char)(v >> 24);
+    p[1] = (unsigned char)(v >> 16);
+    p[2] = (unsigned char)(v >> 8);
+    p[3] = (unsigned char)v;
+}
+
+/*
+ * Write a binary trace record header. Text records have no length, and
+ * untimestamped text records have no time.
+ * Returns true for success, false if tracing has stopped.
+ */
+static bool
+trace_bin_header(char type, size_t len)
+{
+    struct timeval tv;
+    unsigned char hdr[TRACE_BIN_HDR_LEN];
+    size_t hlen = 1;
+
+    hdr[0] = (unsigned char)type;
+    if (type != TRACE_BIN_TEXT) {
+	gettimeofday(&tv, NULL);
+	put32(hdr + 1, (unsigned long)tv.tv_sec);
+	put32(hdr + 5, (unsigned long)tv.tv_usec);
+	hlen += 8;
+	if (type != TRACE_BIN_TEXT_TS) {
+	    put32(hdr + 9, (unsigned long)len);
+	    hlen += 4;
+	}
+    }
+    return trace_write(hdr, hlen);
+}
+
+/* Terminate an open binary text record. */
+static void
+trace_bin_close(void)
+{
+    if (tracef_bin_text && tracef != NULL) {
+	tracef_bin_text = 0;
+	trace_write("", 1);
+    }
+    tracef_bin_text = 0;
+}
+
+/* Write text to a binary trace file. */
+static void
+trace_bin_text(bool do_ts, const char *buf, size_t len)
+{
+    bool need_ts = false;
+    size_t i;
+
+    /* Follow the timestamp logic in vwtrace() to see if one is needed. */
+    for (i = 0; i < len; i++) {
+	if (do_ts && !wrote_ts) {
+	    need_ts = true;
+	    wrote_ts = true;
+	}
+	if (buf[i] == '\n') {
+	    wrote_ts = false;
+	}
+    }
+
+    /*
+     * Start a new record if there is a new timestamp, or if untimestamped
+     * text would otherwise land in a timestamped record.
+     */
+    if (need_ts || !tracef_bin_text ||
+	    (!do_ts && tracef_bin_text == TRACE_BIN_TEXT_TS)) {
+	char type = need_ts? TRACE_BIN_TEXT_TS: TRACE_BIN_TEXT;
+
+	trace_bin_close();
+	if (!trace_bin_header(type, 0)) {
+	    return;
+	}
+	tracef_bin_text = type;
+    }
+    trace_write(buf, len);
+}
+
+/*
+ * Start a binary network data record.
+ * Returns true if the record was started, in which case the caller supplies
+ * exactly 'len' bytes of data with trace_net_append(). Returns false if
+ * tracing is off, the trace is not binary or a trace file header is being
+ * built, in which case the caller traces the data as text.
+ */
+bool
+trace_net_record(char direction, size_t len)
+{
+    if (!toggled(TRACING) || tracef == NULL || !tracef_binary ||
+	    tracef_bufptr != NULL) {
+	return false;
+    }
+    trace_bin_close();
+    if (tracef != NULL) {
+	trace_bin_header(direction, len);
+    }
+    return true;
+}
+
+/* Append data to a binary network data record. */
+void
+trace_net_append(const unsigned char *buf, size_t len)
+{
+    if (tracef != NULL && len) {
+	trace_write(buf, len);
+    }
+}
+
+/* Start a new trace file, writing the magic number if it is binary. */
+static void
+trace_file_start(void)
+{
+    tracef_binary = appres.trace_binary;
+    SETTRACEBUF(tracef);
+#if defined(_WIN32) /*[*/
+    if (tracef_binary) {
+	_setmode(_fileno(tracef), _O_BINARY);
+    }
+#endif /*]*/
+    if (tracef_binary && tracef_size == 0) {
+	trace_write(TRACE_BIN_MAGIC, TRACE_BIN_MAGIC_LEN);
+    }
+}
+
 /*
  * Write to the trace file, varargs style.
  * This is the only function that actually does output to the trace file --
@@ -333,6 +574,11 @@ vwtrace(bool do_ts, const char *fmt, va_list args)
     n2w_left = strlen(buf);
     bp = buf;
 
+    if (tracef_binary) {
+	trace_bin_text(do_ts, buf, n2w_left);
+	goto done;
+    }
+
     while (n2w_left > 0) {
 	char *nl;
 	bool wrote_nl = false;
@@ -342,7 +588,7 @@ vwtrace(bool do_ts, const char *fmt, va_list args)
 		ts = gen_ts();
 	    }
 	    fwrite(ts, strlen(ts), 1, tracef);
-	    fflush(tracef);
+	    tracef_size += strlen(ts);
 	    wrote_ts = true;
 	}
 
@@ -356,7 +602,12 @@ vwtrace(bool do_ts, const char *fmt, va_list args)
 
 	nw = fwrite(bp, n2w, 1, tracef);
 	if (nw == 1) {
-	    fflush(tracef);
+	    tracef_size += n2w;
+	    if (tracef == stdout) {
+		fflush(tracef);
+	    } else {
+		tracef_dirty = true;
+	    }
 	} else {
 	    if (errno != EPIPE && !IS_EILSEQ(errno)) {
 		popup_an_errno(errno, "Write to trace file failed");
@@ -375,8 +626,6 @@ vwtrace(bool do_ts, const char *fmt, va_list args)
 	n2w_left -= n2w;
     }
 
-    tracef_size = ftello(tracef);
-
 done:
     if (buf != NULL) {
 	Free(buf);
@@ -397,19 +646,288 @@ wtrace(bool do_ts, const char *fmt, ...)
     }
 }
 
+/*
+ * Write out buffered trace output.
+ *
+ * Trace output is fully buffered, so that a busy trace costs a write per
+ * buffer rather than one per line. The event loop calls this function
+ * before it waits, so the trace file is current whenever the emulator is
+ * idle.
+ */
+void
+trace_flush(void)
+{
+    trace_bin_close();
+    if (tracef_dirty && tracef != NULL) {
+	if (fflush(tracef) != 0 && errno != EPIPE) {
+	    popup_an_errno(errno, "Write to trace file failed");
+	}
+	tracef_dirty = false;
+    }
+}
+
 static void
 stop_tracing(void)
 {
+    trace_bin_close();
     if (tracef != NULL && tracef != stdout) {
 	fclose(tracef);
     }
     tracef = NULL;
+    trace_categories = 0;
     if (toggled(TRACING)) {
 	toggle_toggle(TRACING);
 	menubar_retoggle(TRACING);
     }
 }
 
+/*
+ * Return the name of trace file generation n, with a suffix for a compressed
+ * generation.
+ */
+static char *
+generation_name(int n, const char *suffix)
+{
+#if defined(_WIN32) /*[*/
+    char *period = strrchr(tracefile_name, '.');
+
+    if (period != NULL) {
+	return xs_buffer("%.*s.%d%s%s", (int)(period - tracefile_name),
+		tracefile_name, n, period, suffix);
+    }
+#endif /*]*/
+    return xs_buffer("%s.%d%s", tracefile_name, n, suffix);
+}
+
+/*
+ * Return the file name suffix for the traceFileCompress command, or "" if
+ * rolled-over trace files are not compressed.
+ */
+static const char *
+compress_suffix(void)
+{
+#if !defined(_WIN32) /*[*/
+    static struct {
+	const char *program;
+	const char *suffix;
+    } suffixes[] = {
+	{ "gzip", ".gz" },
+	{ "pigz", ".gz" },
+	{ "zstd", ".zst" },
+	{ "xz", ".xz" },
+	{ "bzip2", ".bz2" },
+	{ NULL, NULL }
+    };
+    const char *cmd = appres.trace_file_compress;
+    const char *slash;
+    size_t len;
+    int i;
+
+    if (cmd == NULL || !*cmd) {
+	return "";
+    }
+    while (*cmd == ' ') {
+	cmd++;
+    }
+    len = strcspn(cmd, " ");
+    for (slash = cmd; slash < cmd + len; slash++) {
+	if (*slash == '/') {
+	    len -= (slash + 1) - cmd;
+	    cmd = slash + 1;
+	}
+    }
+    for (i = 0; suffixes[i].program != NULL; i++) {
+	if (strlen(suffixes[i].program) == len &&
+		!strncmp(suffixes[i].program, cmd, len)) {
+	    return suffixes[i].suffix;
+	}
+    }
+    return ".z";
+#else /*][*/
+    return "";
+#endif /*]*/
+}
+
+/* Remove trace file generation n, compressed or not. */
+static void
+remove_generation(int n, const char *suffix)
+{
+    char *name = generation_name(n, "");
+
+    unlink(name);
+    Free(name);
+    if (*suffix) {
+	name = generation_name(n, suffix);
+	unlink(name);
+	Free(name);
+    }
+}
+
+/* Rename trace file generation n to n+1, compressed or not. */
+static void
+shift_generation(int n, const char *suffix)
+{
+    char *from = generation_name(n, "");
+    char *to = generation_name(n + 1, "");
+
+    rename(from, to);
+    Free(from);
+    Free(to);
+    if (*suffix) {
+	from = generation_name(n, suffix);
+	to = generation_name(n + 1, suffix);
+	rename(from, to);
+	Free(from);
+	Free(to);
+    }
+}
+
+/* Return the size of trace file generation n, or 0 if it does not exist. */
+static off_t
+generation_size(int n, const char *suffix)
+{
+    struct stat buf;
+    char *name = generation_name(n, "");
+    off_t size = 0;
+
+    if (stat(name, &buf) == 0) {
+	size += buf.st_size;
+    }
+    Free(name);
+    if (*suffix) {
+	name = generation_name(n, suffix);
+	if (stat(name, &buf) == 0) {
+	    size += buf.st_size;
+	}
+	Free(name);
+    }
+    return size;
+}
+
+#if !defined(_WIN32) /*[*/
+/* The trace file compression process exited. */
+static void
+trace_compress_exited(ioid_t id, int status _is_unused)
+{
+    if (id == trace_compress_id) {
+	trace_compress_pid = -1;
+	trace_compress_id = NULL_IOID;
+    }
+}
+
+/*
+ * Compress a rolled-over trace file in the background.
+ *
+ * The child process runs the traceFileCompress command as a filter, then
+ * removes the uncompressed file if it succeeded, or the partial compressed
+ * file if it failed. It does not depend on the emulator after it starts, so
+ * it finishes even if the emulator exits first.
+ */
+static void
+compress_generation(const char *name)
+{
+    char *out = xs_buffer("%s%s", name, compress_suffix());
+    int in_fd, out_fd;
+    pid_t pid;
+    int status;
+
+    switch (trace_compress_pid = fork_child()) {
+    case 0:	/* child process */
+	if ((in_fd = open(name, O_RDONLY)) < 0) {
+	    perror(name);
+	    _exit(1);
+	}
+	if ((out_fd = open(out, O_WRONLY | O_CREAT | O_TRUNC, 0666)) < 0) {
+	    perror(out);
+	    _exit(1);
+	}
+	switch ((pid = fork())) {
+	case 0:
+	    dup2(in_fd, 0);
+	    dup2(out_fd, 1);
+	    close(in_fd);
+	    close(out_fd);
+	    execl("/bin/sh", "/bin/sh", "-c", appres.trace_file_compress,
+		    (char *)NULL);
+	    _exit(1);
+	    break;
+	case -1:
+	    perror("fork");
+	    unlink(out);
+	    _exit(1);
+	    break;
+	default:
+	    break;
+	}
+	close(in_fd);
+	close(out_fd);
+	if (waitpid(pid, &status, 0) == pid && WIFEXITED(status) &&
+		WEXITSTATUS(status) == 0) {
+	    unlink(name);
+	} else {
+	    unlink(out);
+	}
+	_exit(0);
+	break;
+    default:	/* parent */
+	vtrace("Compressing %s with '%s'\n", name, appres.trace_file_compress);
+	trace_compress_id = AddChild(trace_compress_pid, trace_compress_exited);
+	break;
+    case -1:	/* error */
+	popup_an_errno(errno, "fork() failed");
+	break;
+    }
+    Free(out);
+}
+#endif /*]*/
+
+/*
+ * Roll the trace file over into numbered generations: the file just closed
+ * becomes generation 1, and the oldest generation past
+ * traceFileGenerations, or past traceFileTotalSize in total, is removed.
+ */
+static void
+rollover_generations(void)
+{
+    const char *suffix = compress_suffix();
+    char *name;
+    off_t total = 0;
+    int i;
+
+#if !defined(_WIN32) /*[*/
+    if (trace_compress_pid != -1) {
+	/* Let the last compression finish before renaming its files. */
+	waitpid(trace_compress_pid, NULL, 0);
+	trace_compress_pid = -1;
+	trace_compress_id = NULL_IOID;
+    }
+#endif /*]*/
+
+    remove_generation(appres.trace_file_generations, suffix);
+    for (i = appres.trace_file_generations - 1; i >= 1; i--) {
+	shift_generation(i, suffix);
+    }
+    name = generation_name(1, "");
+    rename(tracefile_name, name);
+
+    /* Enforce the total size, keeping at least the newest generation. */
+    if (tracef_total_max != 0) {
+	for (i = 1; i <= appres.trace_file_generations; i++) {
+	    total += generation_size(i, suffix);
+	    if (i > 1 && total > tracef_total_max) {
+		remove_generation(i, suffix);
+	    }
+	}
+    }
+
+#if !defined(_WIN32) /*[*/
+    if (*suffix) {
+	compress_generation(name);
+    }
+#endif /*]*/
+    Free(name);
+}
+
 /* Check for a trace file rollover event. */
 void
 trace_rollover_check(void)
@@ -428,33 +946,40 @@ trace_rollover_check(void)
 
 	/* Close up this file. */
 	wtrace(true, "Trace rolled over\n");
+	trace_bin_close();
 	fclose(tracef);
 	tracef = NULL;
 
-		/* Unlink and rename the alternate file. */
+	if (appres.trace_file_generations > 0) {
+	    rollover_generations();
+	} else {
+	    /* Unlink and rename the alternate file. */
 #if defined(_WIN32) /*[*/
-	period = strrchr(tracefile_name, '.');
-	if (period != NULL) {
-	    alt_filename = xs_buffer("%.*s-%s", (int)(period - tracefile_name),
-		    tracefile_name, period);
-	} else
+	    period = strrchr(tracefile_name, '.');
+	    if (period != NULL) {
+		alt_filename = xs_buffer("%.*s-%s",
+			(int)(period - tracefile_name), tracefile_name,
+			period);
+	    } else
 #endif /*]*/
-	{
-	    alt_filename = xs_buffer("%s-", tracefile_name);
+	    {
+		alt_filename = xs_buffer("%s-", tracefile_name);
+	    }
+	    unlink(alt_filename);
+	    rename(tracefile_name, alt_filename);
+	    Free(alt_filename);
+	    alt_filename = NULL;
 	}
-	unlink(alt_filename);
-	rename(tracefile_name, alt_filename);
-	Free(alt_filename);
-	alt_filename = NULL;
 	tracef = fopen(tracefile_name, "w");
 	if (tracef == NULL) {
+	    trace_categories = 0;
 	    popup_an_errno(errno, "%s", tracefile_name);
 	    return;
 	}
 
 	/* Initialize it. */
 	tracef_size = 0L;
-	SETLINEBUF(tracef);
+	trace_file_start();
 	new_header = create_tracefile_header("rolled over");
 	wtrace(false, new_header);
 	Free(new_header);
@@ -481,6 +1006,7 @@ create_tracefile_header(const char *trace_mode)
     wtrace(true, "Trace %s\n", trace_mode);
     wtrace(false, " Version: %s\n", build);
     wtrace(false, " Build options: %s\n", build_options());
+    wtrace(false, " SIMD kernels: %s\n", simd_describe());
     save_yourself();
     wtrace(false, " Command: %s\n", command_string);
     wtrace(false, " Model %s, %d rows x %d cols", model_name, maxROWS, maxCOLS);
@@ -612,53 +1138,69 @@ create_tracefile_header(const char *trace_mode)
     return buf;
 }
 
-/* Calculate the tracefile maximum size. */
-static void
-get_tracef_max(void)
+/*
+ * Parse a trace file size, a number with an optional K or M suffix.
+ * Returns 0 for none, or -1 for a bad value.
+ */
+static off_t
+parse_trace_size(const char *value)
 {
-    static bool calculated = false;
+    off_t size;
     char *ptr;
-    bool bad = false;
 
-    if (calculated) {
-	return;
+    if (value == NULL ||
+	!strcmp(value, "0") ||
+	!strncasecmp(value, "none", strlen(value))) {
+	return 0;
     }
 
-    calculated = true;
-
-    if (appres.trace_file_size == NULL ||
-	!strcmp(appres.trace_file_size, "0") ||
-	!strncasecmp(appres.trace_file_size, "none",
-		     strlen(appres.trace_file_size))) {
-	tracef_max = 0;
-	return;
+    size = strtoul(value, &ptr, 0);
+    if (size == 0 || ptr == value || *(ptr + 1)) {
+	return -1;
     }
-
-    tracef_max = strtoul(appres.trace_file_size, &ptr, 0);
-    if (tracef_max == 0 || ptr == appres.trace_file_size || *(ptr + 1)) {
-	bad = true;
-    } else switch (*ptr) {
+    switch (*ptr) {
     case 'k':
     case 'K':
-	tracef_max *= 1024;
+	size *= 1024;
 	break;
     case 'm':
     case 'M':
-	tracef_max *= 1024 * 1024;
+	size *= 1024 * 1024;
 	break;
     case '\0':
 	break;
     default:
-	bad = true;
-	break;
+	return -1;
+    }
+    return size;
+}
+
+/* Calculate the tracefile maximum size. */
+static void
+get_tracef_max(void)
+{
+    static bool calculated = false;
+
+    if (calculated) {
+	return;
     }
 
-    if (bad) {
+    calculated = true;
+
+    tracef_max = parse_trace_size(appres.trace_file_size);
+    if (tracef_max < 0) {
 	tracef_max = MIN_TRACEFILE_SIZE;
 	trace_gui_bad_size(MIN_TRACEFILE_SIZE_NAME);
-    } else if (tracef_max < MIN_TRACEFILE_SIZE) {
+    } else if (tracef_max != 0 && tracef_max < MIN_TRACEFILE_SIZE) {
 	tracef_max = MIN_TRACEFILE_SIZE;
     }
+
+    tracef_total_max = parse_trace_size(appres.trace_file_total_size);
+    if (tracef_total_max < 0) {
+	popup_an_error("Invalid %s value '%s'", ResTraceFileTotalSize,
+		appres.trace_file_total_size);
+	tracef_total_max = 0;
+    }
 }
 
 /* Parse the name '/dev/fd<n>', so we can simulate it. */
@@ -777,6 +1319,7 @@ tracefile_ok(const char *tfn)
 
     if (!strcmp(stfn, "stdout")) {
 	tracef = stdout;
+	tracef_binary = false;
     } else {
 	bool append = false;
 
@@ -803,14 +1346,16 @@ tracefile_ok(const char *tfn)
 	}
 	tracef_size = ftello(tracef);
 	Replace(tracefile_name, NewString(append? stfn + 2: stfn));
-	SETLINEBUF(tracef);
+	trace_file_start();
 #if !defined(_WIN32) /*[*/
 	fcntl(fileno(tracef), F_SETFD, 1);
 #endif /*]*/
     }
+    trace_categories = parse_trace_categories();
 
     /* Start the monitor window. */
-    if (tracef != stdout && appres.trace_monitor && product_has_display()) {
+    if (tracef != stdout && !tracef_binary && appres.trace_monitor &&
+	    product_has_display()) {
 #if !defined(_WIN32) /*[*/
 	start_trace_window(stfn);
 #else /*][*/
@@ -1010,6 +1555,13 @@ Trace_action(ia_t ia, unsigned argc, const char **argv)
     return true;
 }
 
+/* Footprint of the trace file buffer. */
+static size_t
+trace_footprint(void)
+{
+    return (tracef != NULL)? TRACE_BUFSIZE: 0;
+}
+
 /**
  * Trace module registration.
  */
@@ -1024,10 +1576,16 @@ trace_register(void)
 	  toggle_tracing,
 	  TOGGLE_NEED_INIT | TOGGLE_NEED_CLEANUP },
     };
+    static footprint_t footprints[] = {
+	{ "trace-buffer",	trace_footprint,	false }
+    };
 
     /* Register our actions. */
     register_actions(actions, array_count(actions));
 
     /* Register our toggles. */
     register_toggles(toggles, array_count(toggles));
+
+    /* Register the buffer size. */
+    register_footprints(footprints, array_count(footprints));
 }
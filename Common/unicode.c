@@ -71,6 +71,29 @@ typedef const char *ici_t;	/* new iconv */
 
 bool dbcs_allowed = true;
 
+#if !defined(_WIN32) /*[*/
+/*
+ * Translation caches for single-byte locales (other than UTF-8), filled in
+ * as characters are first translated.
+ *
+ * sb_u2mb maps the BMP to a local byte, with a bitmap of the entries that
+ * are valid. sb_mb2u maps local bytes to Unicode.
+ */
+#define SB_BMP		0x10000
+enum sb_state {
+    SB_UNKNOWN,		/* not looked up yet */
+    SB_OK,		/* valid translation */
+    SB_BAD		/* invalid byte */
+};
+static bool sb_locale = false;
+static unsigned char *sb_u2mb = NULL;
+static unsigned char *sb_u2mb_known = NULL;
+static ucs4_t sb_mb2u[256];
+static unsigned char sb_mb2u_state[256];
+
+static void sb_init(void);
+#endif /*]*/
+
 #if defined(_WIN32) /*[*/
 int u_local_cp;
 #endif /*]*/
@@ -83,12 +106,28 @@ int u_local_cp;
 #define UT_SIZE		190
 #define UT_OFFSET	0x41
 
+/*
+ * Unicode-to-EBCDIC reverse index, built from a translation table on first
+ * use. Latin-1 is mapped directly; everything else is in a small
+ * open-addressed hash. A code of 0 means no translation.
+ */
+#define RX_HASH		512	/* power of 2, well over UT_SIZE */
+
+typedef struct {
+    unsigned char latin[256];	/* EBCDIC code for U+0000 through U+00FF */
+    struct {
+	ucs4_t u;		/* Unicode value, 0 for an empty slot */
+	unsigned char e;	/* EBCDIC code */
+    } hash[RX_HASH];
+} rindex_t;
+
 typedef struct {
     char *name;
     unsigned short code[UT_SIZE];
     const char *host_codepage;
     const char *cgcsgid;
     bool is_dbcs;
+    rindex_t *rindex;		/* reverse index, built on first use */
 } uni_t;
 
 static uni_t uni[] = {
@@ -305,6 +344,30 @@ cpalias_t cpaliases[] = {
 
 static uni_t *cur_uni = NULL;
 
+/*
+ * SBCS translation tables, built from the current code page on first use and
+ * discarded by set_uni().  There is one table for each combination of
+ * character set (base or APL) and the flags that affect the translation.
+ */
+#define XT_FLAGS	(EUO_UPRIV | EUO_ASCII_BOX | EUO_APL_CIRCLED | \
+			 EUO_TOUPPER)
+#define XT_COUNT	32	/* 2 character sets x 16 flag combinations */
+#define XT_MB_MAX	16	/* longest multi-byte sequence cached */
+#define XT_UNCACHED	0xff	/* mb_len value: use the slow path */
+
+typedef struct {
+    ucs4_t ucs4[256];		/* Unicode value, 0 for no translation */
+    unsigned char mb_len[256];	/* multi-byte length, including the NUL */
+    char mb[256][XT_MB_MAX];	/* local multi-byte representation */
+} xlate_t;
+
+static xlate_t *xlate[XT_COUNT];
+
+static ucs4_t ebcdic_to_unicode_nc(ebc_t c, unsigned char cs,
+	unsigned flags);
+static size_t ebcdic_to_multibyte_nc(ebc_t ebc, unsigned char cs, char mb[],
+	size_t mb_len, unsigned flags, ucs4_t *ucp);
+
 static void
 codepage_list_one(bool dbcs)
 {
@@ -348,14 +411,10 @@ codepage_list(void)
 }
 
 /*
- * Translate a single EBCDIC character in an arbitrary character set to
- * Unicode.  Note that CS_DBCS is never used -- use CS_BASE and pass an
- * EBCDIC character > 0xff.
- *
- * Returns 0 for no translation.
+ * Uncached version of ebcdic_to_unicode.
  */
-ucs4_t
-ebcdic_to_unicode(ebc_t c, unsigned char cs, unsigned flags)
+static ucs4_t
+ebcdic_to_unicode_nc(ebc_t c, unsigned char cs, unsigned flags)
 {
     ucs4_t uc;
 
@@ -388,6 +447,81 @@ ebcdic_to_unicode(ebc_t c, unsigned char cs, unsigned flags)
     return uc;
 }
 
+/*
+ * Free the SBCS translation tables, because the code page has changed.
+ */
+static void
+xlate_free(void)
+{
+    int i;
+
+    for (i = 0; i < XT_COUNT; i++) {
+	Replace(xlate[i], NULL);
+    }
+}
+
+/*
+ * Find the SBCS translation table for a character set and set of flags.
+ * Returns NULL if the character set has no table.
+ */
+static xlate_t *
+xlate_get(unsigned char cs, unsigned flags)
+{
+    bool apl;
+    int ix;
+    int c;
+    xlate_t *x;
+
+    if ((cs & CS_GE) || ((cs & CS_MASK) == CS_APL)) {
+	apl = true;
+    } else if (cs == CS_BASE) {
+	apl = false;
+    } else {
+	return NULL;
+    }
+    flags &= XT_FLAGS;
+    ix = (apl? 16: 0) |
+	((flags & (EUO_UPRIV | EUO_ASCII_BOX)) >> 1) |
+	((flags & (EUO_APL_CIRCLED | EUO_TOUPPER)) >> 2);
+    if (xlate[ix] != NULL) {
+	return xlate[ix];
+    }
+
+    /* Build it. */
+    x = (xlate_t *)Malloc(sizeof(xlate_t));
+    for (c = 0; c < 256; c++) {
+	size_t nc = ebcdic_to_multibyte_nc(c, apl? CS_APL: CS_BASE, x->mb[c],
+		XT_MB_MAX, flags, &x->ucs4[c]);
+
+	if ((nc == 0 && x->ucs4[c] != 0) || nc > XT_MB_MAX) {
+	    /* Translation failed in some odd way; don't try to cache it. */
+	    x->mb_len[c] = XT_UNCACHED;
+	} else {
+	    x->mb_len[c] = (unsigned char)nc;
+	}
+    }
+    xlate[ix] = x;
+    return x;
+}
+
+/*
+ * Translate a single EBCDIC character in an arbitrary character set to
+ * Unicode.  Note that CS_DBCS is never used -- use CS_BASE and pass an
+ * EBCDIC character > 0xff.
+ *
+ * Returns 0 for no translation.
+ */
+ucs4_t
+ebcdic_to_unicode(ebc_t c, unsigned char cs, unsigned flags)
+{
+    xlate_t *x;
+
+    if (c < 256 && (x = xlate_get(cs, flags & ~EUO_TOUPPER)) != NULL) {
+	return x->ucs4[c];
+    }
+    return ebcdic_to_unicode_nc(c, cs, flags);
+}
+
 /*
  * Translate a single EBCDIC character in the base or DBCS character sets to
  *  Unicode.
@@ -442,6 +576,98 @@ ebcdic_base_to_unicode(ebc_t c, unsigned flags)
     }
 }
 
+/* Returns the hash slot to start probing for a Unicode value. */
+static unsigned
+rindex_hash(ucs4_t u)
+{
+    return (u ^ (u >> 9)) & (RX_HASH - 1);
+}
+
+/*
+ * Add a mapping to a reverse index. The first mapping for a given Unicode
+ * value wins, to match a linear scan of the table.
+ */
+static void
+rindex_add(rindex_t *r, ucs4_t u, unsigned char e)
+{
+    unsigned h;
+
+    if (u < 256) {
+	if (r->latin[u] == 0) {
+	    r->latin[u] = e;
+	}
+	return;
+    }
+    for (h = rindex_hash(u); r->hash[h].u != 0; h = (h + 1) & (RX_HASH - 1)) {
+	if (r->hash[h].u == u) {
+	    return;
+	}
+    }
+    r->hash[h].u = u;
+    r->hash[h].e = e;
+}
+
+/*
+ * Look up a Unicode value in a reverse index.
+ * Returns the EBCDIC code, or 0 if there is none.
+ */
+static unsigned char
+rindex_find(const rindex_t *r, ucs4_t u)
+{
+    unsigned h;
+
+    if (u < 256) {
+	return r->latin[u];
+    }
+    for (h = rindex_hash(u); r->hash[h].u != 0; h = (h + 1) & (RX_HASH - 1)) {
+	if (r->hash[h].u == u) {
+	    return r->hash[h].e;
+	}
+    }
+    return 0;
+}
+
+/*
+ * Get the reverse index for the current code page.
+ * Indices are kept for the life of the process, so switching back to a code
+ * page does not rebuild its index.
+ */
+static const rindex_t *
+rindex_cur(void)
+{
+    if (cur_uni->rindex == NULL) {
+	rindex_t *r = (rindex_t *)Calloc(1, sizeof(rindex_t));
+	int i;
+
+	for (i = 0; i < UT_SIZE; i++) {
+	    rindex_add(r, cur_uni->code[i], UT_OFFSET + i);
+	}
+	cur_uni->rindex = r;
+    }
+    return cur_uni->rindex;
+}
+
+/* Get the reverse index for the APL (GE) character set. */
+static const rindex_t *
+rindex_apl(void)
+{
+    static rindex_t *r = NULL;
+
+    if (r == NULL) {
+	ebc_t e;
+
+	r = (rindex_t *)Calloc(1, sizeof(rindex_t));
+	for (e = 0x70; e <= 0xfe; e++) {
+	    int iuc = apl_to_unicode(e, EUO_NONE);
+
+	    if (iuc >= 0) {
+		rindex_add(r, (ucs4_t)iuc, (unsigned char)e);
+	    }
+	}
+    }
+    return r;
+}
+
 /*
  * Map a UCS-4 character to an EBCDIC character.
  * Returns 0 for failure, nonzero for success.
@@ -449,7 +675,6 @@ ebcdic_base_to_unicode(ebc_t c, unsigned flags)
 ebc_t
 unicode_to_ebcdic(ucs4_t u)
 {
-    int i;
     ebc_t d;
 
     if (!u) {
@@ -459,11 +684,11 @@ unicode_to_ebcdic(ucs4_t u)
 	return 0x40;
     }
 
-    for (i = 0; i < UT_SIZE; i++) {
-	if (cur_uni->code[i] == u) {
-	    return UT_OFFSET + i;
-	}
+    d = rindex_find(rindex_cur(), u);
+    if (d) {
+	return d;
     }
+
     /* See if it's DBCS. */
     d = unicode_to_ebcdic_dbcs(u);
     if (d) {
@@ -488,14 +713,7 @@ unicode_to_ebcdic_ge(ucs4_t u, bool *ge, bool prefer_apl)
     e_cur = unicode_to_ebcdic(u);
 
     /* Find the character in the APL code page. */
-    for (e_apl = 0x70; e_apl <= 0xfe; e_apl++) {
-	if ((ucs4_t)apl_to_unicode(e_apl, EUO_NONE) == u) {
-	    break;
-	}
-    }
-    if (e_apl > 0xfe) {
-	e_apl = 0;
-    }
+    e_apl = rindex_find(rindex_apl(), u);
 
     if (e_apl != 0 && ((e_cur == 0) || prefer_apl)) {
 	*ge = true;
@@ -537,6 +755,7 @@ set_uni(const char *cpname, int local_cp _is_unused,
     bool cannot_fail = false;
 
     check_apl_consistency(apl2uc);
+    xlate_free();
 
 #if defined(_WIN32) /*[*/
     u_local_cp = local_cp;
@@ -639,9 +858,32 @@ set_uni(const char *cpname, int local_cp _is_unused,
     }
 #endif /*]*/
 
+#if !defined(_WIN32) /*[*/
+    if (rc) {
+	sb_init();
+    }
+#endif /*]*/
+
     return rc;
 }
 
+#if !defined(_WIN32) /*[*/
+/*
+ * Set up the single-byte translation caches, if the locale is single-byte.
+ * The locale does not change, so the tables are kept across code page
+ * changes.
+ */
+static void
+sb_init(void)
+{
+    sb_locale = !is_utf8 && MB_CUR_MAX == 1;
+    if (sb_locale && sb_u2mb == NULL) {
+	sb_u2mb = (unsigned char *)Calloc(SB_BMP + (SB_BMP / 8), 1);
+	sb_u2mb_known = sb_u2mb + SB_BMP;
+    }
+}
+#endif /*]*/
+
 /* See if the given alias matches the given canonical code page name. */
 bool
 codepage_matches_alias(const char *alias, const char *canon)
@@ -830,6 +1072,41 @@ fail:
 size_t
 ebcdic_to_multibyte_x(ebc_t ebc, unsigned char cs, char mb[],
 	size_t mb_len, unsigned flags, ucs4_t *ucp)
+{
+    xlate_t *x;
+
+    if (ebc < 256 && (x = xlate_get(cs, flags)) != NULL) {
+	size_t nc = x->mb_len[ebc];
+
+	if (nc == 0) {
+	    if (ucp != NULL) {
+		*ucp = 0;
+	    }
+	    if (flags & EUO_BLANK_UNDEF) {
+		mb[0] = ' ';
+		mb[1] = '\0';
+		return 2;
+	    } else {
+		return 0;
+	    }
+	}
+	if (nc != XT_UNCACHED && nc <= mb_len) {
+	    if (ucp != NULL) {
+		*ucp = x->ucs4[ebc];
+	    }
+	    memcpy(mb, x->mb[ebc], nc);
+	    return nc;
+	}
+    }
+    return ebcdic_to_multibyte_nc(ebc, cs, mb, mb_len, flags, ucp);
+}
+
+/*
+ * Uncached version of ebcdic_to_multibyte_x.
+ */
+static size_t
+ebcdic_to_multibyte_nc(ebc_t ebc, unsigned char cs, char mb[],
+	size_t mb_len, unsigned flags, ucs4_t *ucp)
 {
     ucs4_t uc;
 #if defined(_WIN32) /*[*/
@@ -848,7 +1125,7 @@ ebcdic_to_multibyte_x(ebc_t ebc, unsigned char cs, char mb[],
 #endif /*]*/
 
     /* Translate from EBCDIC to Unicode. */
-    uc = ebcdic_to_unicode(ebc, cs, flags);
+    uc = ebcdic_to_unicode_nc(ebc, cs, flags);
     if (ucp != NULL) {
 	*ucp = uc;
     }
@@ -1025,11 +1302,17 @@ ebcdic_to_multibyte_string(unsigned char *ebc, size_t ebc_len, char mb[],
 	size_t mb_len)
 {
     size_t nmb = 0;
+    xlate_t *x = xlate_get(CS_BASE, EUO_NONE);
 
     while (ebc_len && mb_len) {
-	size_t xlen;
+	size_t xlen = x->mb_len[*ebc];
 
-	xlen = ebcdic_to_multibyte(*ebc, mb, mb_len);
+	if (xlen != 0 && xlen != XT_UNCACHED && xlen <= mb_len) {
+	    /* Table-driven translation. */
+	    memcpy(mb, x->mb[*ebc], xlen);
+	} else {
+	    xlen = ebcdic_to_multibyte(*ebc, mb, mb_len);
+	}
 	if (xlen) {
 	    mb += xlen - 1;
 	    mb_len -= (xlen - 1);
@@ -1078,6 +1361,138 @@ multibyte_to_unicode(const char *mb, size_t mb_len, int *consumedp,
     return multibyte_to_unicode_f(mb, mb_len, consumedp, errorp, false);
 }
 
+/*
+ * Translate a multi-byte character in the current (non-UTF-8) locale to UCS-4,
+ * without using the single-byte cache.
+ */
+static ucs4_t
+multibyte_to_unicode_nc(const char *mb, size_t mb_len, int *consumedp,
+	enum me_fail *errorp)
+{
+    ucs4_t ucs4;
+
+#if defined(_WIN32) /*[*/
+    wchar_t wc[3];
+    unsigned i;
+    int nw;
+
+    /* Use MultiByteToWideChar() to get from the ANSI codepage to UTF-16. */
+    for (i = 1; i <= mb_len; i++) {
+	nw = MultiByteToWideChar(u_local_cp, MB_ERR_INVALID_CHARS,
+		mb, i, wc, 3);
+	if (nw != 0)
+	    break;
+    }
+    if (i > mb_len) {
+	*errorp = ME_INVALID;
+	return 0;
+    }
+    *consumedp = i;
+    ucs4 = wc[0];
+#elif defined(UNICODE_WCHAR) /*][*/
+
+    /* wchar_t's are Unicode. */
+    wchar_t wc[3];
+    int nw;
+
+    /* mbtowc() will translate to Unicode. */
+    nw = mbtowc(wc, mb, mb_len);
+    if (nw == -1) {
+	if (errno == EILSEQ)
+	    *errorp = ME_INVALID;
+	else
+	    *errorp = ME_SHORT;
+	nw = mbtowc(NULL, NULL, 0);
+	return 0;
+    }
+
+    /*
+     * Reset the shift state.
+     * XXX: Doing this will ruin the shift state if this function is called
+     * repeatedly to process a string.  There should probably be a parameter
+     * passed in to control whether or not to reset the shift state, or
+     * perhaps there should be a function to translate a string.
+     */
+    *consumedp = nw;
+    nw = mbtowc(NULL, NULL, 0);
+
+    ucs4 = wc[0];
+#else /*][*/
+
+    /* wchar_t's have unknown encoding. */
+    ici_t inbuf;
+    char *outbuf;
+    size_t inbytesleft, outbytesleft;
+    char utf8buf[16];
+    size_t ibl;
+
+    /* Translate from local MB to UTF-8 using iconv(). */
+    for (ibl = 1; ibl <= mb_len; ibl++) {
+	size_t xnw;
+
+	inbuf = (ici_t)mb;
+	outbuf = utf8buf;
+	inbytesleft = ibl;
+	outbytesleft = sizeof(utf8buf);
+	xnw = iconv(i_mb2u, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
+	if (xnw == (size_t)-1) {
+	    if (errno == EILSEQ) {
+		*errorp = ME_INVALID;
+		iconv(i_mb2u, NULL, NULL, NULL, NULL);
+		return 0;
+	    } else {
+		if (ibl == mb_len) {
+		    *errorp = ME_SHORT;
+		    iconv(i_mb2u, NULL, NULL, NULL, NULL);
+		    return 0;
+		}
+	    }
+	} else
+	    break;
+    }
+    *consumedp = ibl - inbytesleft;
+
+    /* Translate from UTF-8 to UCS-4. */
+    utf8_to_unicode(utf8buf, sizeof(utf8buf) - outbytesleft, &ucs4);
+#endif /*]*/
+
+    return ucs4;
+}
+
+#if !defined(_WIN32) /*[*/
+/*
+ * Translate a byte in a single-byte locale to UCS-4, using the cache.
+ */
+static ucs4_t
+sb_to_unicode(const char *mb, size_t mb_len, int *consumedp,
+	enum me_fail *errorp)
+{
+    unsigned char c = (unsigned char)mb[0];
+
+    if (sb_mb2u_state[c] == SB_UNKNOWN) {
+	int consumed;
+	enum me_fail error = ME_NONE;
+	ucs4_t ucs4 = multibyte_to_unicode_nc(mb, 1, &consumed, &error);
+
+	if (ucs4 != 0 && consumed == 1) {
+	    sb_mb2u[c] = ucs4;
+	    sb_mb2u_state[c] = SB_OK;
+	} else if (ucs4 == 0 && error == ME_INVALID) {
+	    sb_mb2u_state[c] = SB_BAD;
+	} else {
+	    /* Something odd; don't cache it. */
+	    return multibyte_to_unicode_nc(mb, mb_len, consumedp, errorp);
+	}
+    }
+    if (sb_mb2u_state[c] == SB_BAD) {
+	*errorp = ME_INVALID;
+	return 0;
+    }
+    *consumedp = 1;
+    return sb_mb2u[c];
+}
+#endif /*]*/
+
 /*
  * Translate a multi-byte character in the current locale to UCS-4.
  *
@@ -1106,92 +1521,15 @@ multibyte_to_unicode_f(const char *mb, size_t mb_len, int *consumedp,
 	    return 0;
 	}
 	*consumedp = nw;
-    } else {
-#if defined(_WIN32) /*[*/
-	wchar_t wc[3];
-	unsigned i;
-
-	/* Use MultiByteToWideChar() to get from the ANSI codepage to UTF-16. */
-	for (i = 1; i <= mb_len; i++) {
-	    nw = MultiByteToWideChar(u_local_cp, MB_ERR_INVALID_CHARS,
-		    mb, i, wc, 3);
-	    if (nw != 0)
-		break;
-	}
-	if (i > mb_len) {
-	    *errorp = ME_INVALID;
-	    return 0;
-	}
-	*consumedp = i;
-	ucs4 = wc[0];
-#elif defined(UNICODE_WCHAR) /*][*/
-
-	/* wchar_t's are Unicode. */
-	wchar_t wc[3];
-
-	/* mbtowc() will translate to Unicode. */
-	nw = mbtowc(wc, mb, mb_len);
-	if (nw == -1) {
-	    if (errno == EILSEQ)
-		*errorp = ME_INVALID;
-	    else
-		*errorp = ME_SHORT;
-	    nw = mbtowc(NULL, NULL, 0);
-	    return 0;
-	}
-
-	/*
-	 * Reset the shift state.
-	 * XXX: Doing this will ruin the shift state if this function is called
-	 * repeatedly to process a string.  There should probably be a parameter
-	 * passed in to control whether or not to reset the shift state, or
-	 * perhaps there should be a function to translate a string.
-	 */
-	*consumedp = nw;
-	nw = mbtowc(NULL, NULL, 0);
-
-	ucs4 = wc[0];
-#else /*][*/
-
-	/* wchar_t's have unknown encoding. */
-	ici_t inbuf;
-	char *outbuf;
-	size_t inbytesleft, outbytesleft;
-	char utf8buf[16];
-	size_t ibl;
-
-	/* Translate from local MB to UTF-8 using iconv(). */
-	for (ibl = 1; ibl <= mb_len; ibl++) {
-	    size_t xnw;
-
-	    inbuf = (ici_t)mb;
-	    outbuf = utf8buf;
-	    inbytesleft = ibl;
-	    outbytesleft = sizeof(utf8buf);
-	    xnw = iconv(i_mb2u, &inbuf, &inbytesleft, &outbuf, &outbytesleft);
-	    if (xnw == (size_t)-1) {
-		if (errno == EILSEQ) {
-		    *errorp = ME_INVALID;
-		    iconv(i_mb2u, NULL, NULL, NULL, NULL);
-		    return 0;
-		} else {
-		    if (ibl == mb_len) {
-			*errorp = ME_SHORT;
-			iconv(i_mb2u, NULL, NULL, NULL, NULL);
-			return 0;
-		    }
-		}
-	    } else
-	    	break;
-	}
-	*consumedp = ibl - inbytesleft;
-
-	/* Translate from UTF-8 to UCS-4. */
-	utf8_to_unicode(utf8buf, sizeof(utf8buf) - outbytesleft, &ucs4);
-#endif /*]*/
+	return ucs4;
     }
 
-    return ucs4;
+#if !defined(_WIN32) /*[*/
+    if (sb_locale && mb_len > 0 && mb[0] != '\0') {
+	return sb_to_unicode(mb, mb_len, consumedp, errorp);
+    }
+#endif /*]*/
+    return multibyte_to_unicode_nc(mb, mb_len, consumedp, errorp);
 }
 
 /*
@@ -1207,8 +1545,81 @@ multibyte_to_unicode_string(const char *mb, size_t mb_len, ucs4_t *ucs4,
     enum me_fail error;
     int nr = 0;
 
+#if defined(USE_ICONV) /*[*/
+    if (!is_utf8 && !force_utf8 && !sb_locale) {
+	/*
+	 * Let iconv translate the whole string to UTF-8 in one call, then
+	 * decode that.
+	 */
+	char *u8 = Malloc((mb_len * 4) + 1);
+	ici_t inbuf = (ici_t)mb;
+	char *outbuf = u8;
+	size_t inbytesleft = mb_len;
+	size_t outbytesleft = mb_len * 4;
+	bool failed;
+	char *s;
+	size_t len;
+
+	failed = iconv(i_mb2u, &inbuf, &inbytesleft, &outbuf, &outbytesleft)
+	    == (size_t)-1;
+	iconv(i_mb2u, NULL, NULL, NULL, NULL);
+
+	/* Decode what was translated, stopping at a NUL. */
+	s = u8;
+	len = outbuf - u8;
+	while (u_len && len) {
+	    int nw = utf8_to_unicode(s, (int)len, ucs4);
+
+	    if (nw <= 0 || *ucs4 == 0) {
+		break;
+	    }
+	    ucs4++;
+	    u_len--;
+	    s += nw;
+	    len -= nw;
+	    nr++;
+	}
+	Free(u8);
+	if (failed && u_len && !len) {
+	    /* The translation stopped before the buffer filled. */
+	    return -1;
+	}
+	return nr;
+    }
+#endif /*]*/
+
     error = ME_NONE;
 
+    if (is_utf8 || force_utf8) {
+	/* Copy runs of ASCII directly, and decode the rest one at a time. */
+	while (u_len && mb_len) {
+	    size_t run = utf8_ascii_run(mb, (mb_len < u_len)? mb_len: u_len);
+	    size_t i;
+
+	    for (i = 0; i < run; i++) {
+		ucs4[i] = (unsigned char)mb[i];
+	    }
+	    ucs4 += run;
+	    u_len -= run;
+	    mb += run;
+	    mb_len -= run;
+	    nr += (int)run;
+	    if (!u_len || !mb_len) {
+		break;
+	    }
+
+	    if ((*ucs4++ = multibyte_to_unicode_f(mb, mb_len, &consumed,
+			    &error, true)) == 0) {
+		break;
+	    }
+	    u_len--;
+	    mb += consumed;
+	    mb_len -= consumed;
+	    nr++;
+	}
+	return (error != ME_NONE)? -1: nr;
+    }
+
     while (u_len && mb_len &&
 	    (*ucs4++ = multibyte_to_unicode_f(mb, mb_len, &consumed,
 					    &error, force_utf8)) != 0) {
@@ -1314,10 +1725,11 @@ multibyte_to_ebcdic_string(char *mb, size_t mb_len, unsigned char *ebc,
 }
 
 /*
- * Translate a UCS-4 character to a local multi-byte string.
+ * Translate a UCS-4 character to a local multi-byte string, without using
+ * the single-byte cache.
  */
-int
-unicode_to_multibyte(ucs4_t ucs4, char *mb, size_t mb_len)
+static int
+unicode_to_multibyte_nc(ucs4_t ucs4, char *mb, size_t mb_len)
 {
 #if defined(_WIN32) /*[*/
     wchar_t wuc = ucs4;
@@ -1399,6 +1811,123 @@ unicode_to_multibyte(ucs4_t ucs4, char *mb, size_t mb_len)
 #endif /*]*/
 }
 
+/*
+ * Translate a UCS-4 character to a local multi-byte string.
+ */
+int
+unicode_to_multibyte(ucs4_t ucs4, char *mb, size_t mb_len)
+{
+#if !defined(_WIN32) /*[*/
+    if (sb_locale && ucs4 < SB_BMP && mb_len >= 2) {
+	unsigned char bit = 1 << (ucs4 & 7);
+
+	if (!(sb_u2mb_known[ucs4 >> 3] & bit)) {
+	    char xmb[16];
+
+	    if (unicode_to_multibyte_nc(ucs4, xmb, sizeof(xmb)) != 2) {
+		/* Something odd; don't cache it. */
+		return unicode_to_multibyte_nc(ucs4, mb, mb_len);
+	    }
+	    sb_u2mb[ucs4] = xmb[0];
+	    sb_u2mb_known[ucs4 >> 3] |= bit;
+	}
+	mb[0] = sb_u2mb[ucs4];
+	mb[1] = '\0';
+	return 2;
+    }
+#endif /*]*/
+    return unicode_to_multibyte_nc(ucs4, mb, mb_len);
+}
+
+/*
+ * Translate a UCS-4 string to a local multi-byte string.
+ * Characters with no local representation become '?'.
+ * NULL-terminates the result, and returns its length, not including the
+ * NULL.
+ */
+size_t
+unicode_to_multibyte_string(const ucs4_t *ucs4, size_t u_len, char *mb,
+	size_t mb_len)
+{
+    size_t nmb = 0;
+
+    if (mb_len == 0) {
+	return 0;
+    }
+
+#if defined(USE_ICONV) /*[*/
+    if (!is_utf8 && !sb_locale) {
+	/*
+	 * Translate the whole string to UTF-8, then let iconv translate it
+	 * in one call.
+	 */
+	char *u8 = Malloc((u_len * 6) + 1);
+	size_t nu8 = 0;
+	size_t i;
+	ici_t inbuf;
+	char *outbuf;
+	size_t inbytesleft, outbytesleft;
+
+	for (i = 0; i < u_len; i++) {
+	    int n = unicode_to_utf8(ucs4[i], u8 + nu8);
+
+	    if (n > 0) {
+		nu8 += n;
+	    }
+	}
+
+	inbuf = u8;
+	inbytesleft = nu8;
+	outbuf = mb;
+	outbytesleft = mb_len - 1;
+	while (inbytesleft &&
+		iconv(i_u2mb, &inbuf, &inbytesleft, &outbuf, &outbytesleft)
+		    == (size_t)-1) {
+	    ucs4_t skip;
+	    int n;
+
+	    if (errno != EILSEQ || !outbytesleft) {
+		break;
+	    }
+
+	    /* No translation for this character. */
+	    *outbuf++ = '?';
+	    outbytesleft--;
+	    n = utf8_to_unicode(inbuf, (int)inbytesleft, &skip);
+	    if (n <= 0) {
+		n = 1;
+	    }
+	    inbuf += n;
+	    inbytesleft -= n;
+	}
+
+	/* Return to the initial shift state. */
+	iconv(i_u2mb, NULL, NULL, &outbuf, &outbytesleft);
+	Free(u8);
+	*outbuf = '\0';
+	return outbuf - mb;
+    }
+#endif /*]*/
+
+    /* Translate one character at a time. */
+    while (u_len) {
+	char xmb[16];
+	int nc = unicode_to_multibyte(*ucs4, xmb, sizeof(xmb));
+
+	if (nc > 1) {
+	    if (nmb + (nc - 1) > mb_len - 1) {
+		break;
+	    }
+	    memcpy(mb + nmb, xmb, nc - 1);
+	    nmb += nc - 1;
+	}
+	ucs4++;
+	u_len--;
+    }
+    mb[nmb] = '\0';
+    return nmb;
+}
+
 /*
  * Unicode to multibyte conversion, with UTF-8 override.
  */
@@ -38,174 +38,76 @@
 
 /*
  * DBCS EBCDIC-to-Unicode translation tables.
+ *
+ * Each direction is a 512-entry index of 128-character rows, plus the rows
+ * that are actually populated. An index entry is the row number plus one, or
+ * 0 if the row is empty. The tables contain no pointers, so they need no
+ * relocations and stay in read-only data, which is never paged in unless a
+ * DBCS code page is selected.
  */
 
+typedef char uni16_row_t[256];
+
 typedef struct {
     char *name;
     const char *codepage;
-    const char *u2ebc[512];	/* Unicode to EBCDIC vectors */
-    const char *ebc2u[512];	/* EBCDIC to Unicode vectors */
+    const unsigned short *u2ebc_ix;	/* Unicode to EBCDIC row index */
+    const uni16_row_t *u2ebc;		/* Unicode to EBCDIC rows */
+    const unsigned short *ebc2u_ix;	/* EBCDIC to Unicode row index */
+    const uni16_row_t *ebc2u;		/* EBCDIC to Unicode rows */
 } uni16_t;
 
-static uni16_t uni16[] = {
-    { "cp930", "0x0172012c" /* 370, 300 */,
-/* Unicode to EBCDIC DBCS translation table for ibm-300_P110-1997 */ {
-/* 0000 */ NULL,
+/* Unicode to EBCDIC DBCS translation table for ibm-300_P110-1997 */
+static const unsigned short cp930_u2ebc_ix[512] = {
+/* 0000 */ 0, 1, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0, 0, 0, 0, 0,
+/* 0800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2000 */ 4, 0, 5, 6, 7, 8, 9, 0, 0, 0, 10, 11, 12, 0, 0, 0,
+/* 2800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3000 */ 13, 14, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 4000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 4800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 17, 18, 19,
+/* 5000 */ 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35,
+/* 5800 */ 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51,
+/* 6000 */ 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67,
+/* 6800 */ 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83,
+/* 7000 */ 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99,
+/* 7800 */ 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+/* 8000 */ 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128, 129, 130, 131,
+/* 8800 */ 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147,
+/* 9000 */ 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163,
+/* 9800 */ 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179,
+/* a000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* a800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* e000 */ 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195,
+/* e800 */ 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
+/* f000 */ 212, 213, 214, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* f800 */ 215, 0, 216, 217, 218, 0, 0, 0, 0, 0, 0, 0, 0, 0, 219, 220
+};
+static const uni16_row_t cp930_u2ebc[] = {
 /* 0080 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x42\x6a\x44\x6a\x44\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xed\x44\x4b\x00\x00\x00\x00\x44\x50\x00\x00\x43\x79\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x7a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x7b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 0100 */ NULL,
-/* 0180 */ NULL,
-/* 0200 */ NULL,
-/* 0280 */ NULL,
-/* 0300 */ NULL,
 /* 0380 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\x61\x41\x62\x41\x63\x41\x64\x41\x65\x41\x66\x41\x67\x41\x68\x41\x69\x41\x6a\x41\x6b\x41\x6c\x41\x6d\x41\x6e\x41\x6f\x41\x70\x41\x71\x00\x00\x41\x72\x41\x73\x41\x74\x41\x75\x41\x76\x41\x77\x41\x78\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\x41\x41\x42\x41\x43\x41\x44\x41\x45\x41\x46\x41\x47\x41\x48\x41\x49\x41\x4a\x41\x4b\x41\x4c\x41\x4d\x41\x4e\x41\x4f\x41\x50\x41\x51\x00\x00\x41\x52\x41\x53\x41\x54\x41\x55\x41\x56\x41\x57\x41\x58\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 0400 */ "\x00\x00\x41\xc6\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\xc0\x41\xc1\x41\xc2\x41\xc3\x41\xc4\x41\xc5\x41\xc7\x41\xc8\x41\xc9\x41\xca\x41\xcb\x41\xcc\x41\xcd\x41\xce\x41\xcf\x41\xd0\x41\xd1\x41\xd2\x41\xd3\x41\xd4\x41\xd5\x41\xd6\x41\xd7\x41\xd8\x41\xd9\x41\xda\x41\xdb\x41\xdc\x41\xdd\x41\xde\x41\xdf\x41\xe0\x41\x80\x41\x81\x41\x82\x41\x83\x41\x84\x41\x85\x41\x87\x41\x88\x41\x89\x41\x8a\x41\x8b\x41\x8c\x41\x8d\x41\x8e\x41\x8f\x41\x90\x41\x91\x41\x92\x41\x93\x41\x94\x41\x95\x41\x96\x41\x97\x41\x98\x41\x99\x41\x9a\x41\x9b\x41\x9c\x41\x9d\x41\x9e\x41\x9f\x41\xa0\x00\x00\x41\x86\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 0480 */ NULL,
-/* 0500 */ NULL,
-/* 0580 */ NULL,
-/* 0600 */ NULL,
-/* 0680 */ NULL,
-/* 0700 */ NULL,
-/* 0780 */ NULL,
-/* 0800 */ NULL,
-/* 0880 */ NULL,
-/* 0900 */ NULL,
-/* 0980 */ NULL,
-/* 0a00 */ NULL,
-/* 0a80 */ NULL,
-/* 0b00 */ NULL,
-/* 0b80 */ NULL,
-/* 0c00 */ NULL,
-/* 0c80 */ NULL,
-/* 0d00 */ NULL,
-/* 0d80 */ NULL,
-/* 0e00 */ NULL,
-/* 0e80 */ NULL,
-/* 0f00 */ NULL,
-/* 0f80 */ NULL,
-/* 1000 */ NULL,
-/* 1080 */ NULL,
-/* 1100 */ NULL,
-/* 1180 */ NULL,
-/* 1200 */ NULL,
-/* 1280 */ NULL,
-/* 1300 */ NULL,
-/* 1380 */ NULL,
-/* 1400 */ NULL,
-/* 1480 */ NULL,
-/* 1500 */ NULL,
-/* 1580 */ NULL,
-/* 1600 */ NULL,
-/* 1680 */ NULL,
-/* 1700 */ NULL,
-/* 1780 */ NULL,
-/* 1800 */ NULL,
-/* 1880 */ NULL,
-/* 1900 */ NULL,
-/* 1980 */ NULL,
-/* 1a00 */ NULL,
-/* 1a80 */ NULL,
-/* 1b00 */ NULL,
-/* 1b80 */ NULL,
-/* 1c00 */ NULL,
-/* 1c80 */ NULL,
-/* 1d00 */ NULL,
-/* 1d80 */ NULL,
-/* 1e00 */ NULL,
-/* 1e80 */ NULL,
-/* 1f00 */ NULL,
-/* 1f80 */ NULL,
 /* 2000 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x5a\x00\x00\x00\x00\x00\x00\x44\x4a\x00\x00\x44\x7c\x00\x00\x44\x61\x44\x71\x00\x00\x00\x00\x44\x62\x44\x72\x00\x00\x00\x00\x43\x77\x43\x78\x00\x00\x00\x00\x00\x00\x44\x7e\x44\x7f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x73\x00\x00\x44\xee\x44\xef\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2080 */ NULL,
 /* 2100 */ "\x00\x00\x00\x00\x00\x00\x44\x4e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\xf1\x41\xf2\x41\xf3\x41\xf4\x41\xf5\x41\xf6\x41\xf7\x41\xf8\x41\xf9\x41\xfa\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\xb1\x41\xb2\x41\xb3\x41\xb4\x41\xb5\x41\xb6\x41\xb7\x41\xb8\x41\xb9\x41\xba\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2180 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xf1\x44\xf2\x44\xf0\x44\xf3\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x6e\x00\x00\x43\x6f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2200 */ "\x43\x70\x00\x00\x43\x4e\x43\x71\x00\x00\x00\x00\x00\x00\x43\x4f\x43\x64\x00\x00\x00\x00\x43\x65\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x42\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x5f\x00\x00\x00\x00\x43\x61\x44\x4d\x00\x00\x43\x4b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x6c\x43\x6d\x43\x6b\x43\x6a\x43\x62\x43\x63\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x68\x44\x78\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x5c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x4c\x43\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x44\x67\x44\x77\x00\x00\x00\x00\x43\x5d\x43\x5e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2280 */ "\x00\x00\x00\x00\x43\x68\x43\x69\x00\x00\x00\x00\x43\x66\x43\x67\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x4c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2300 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x4d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2380 */ NULL,
-/* 2400 */ NULL,
-/* 2480 */ NULL,
 /* 2500 */ "\x43\x7c\x43\xb7\x43\x7d\x43\xb8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x7e\x00\x00\x00\x00\x43\xb9\x43\x7f\x00\x00\x00\x00\x43\xe1\x43\xb1\x00\x00\x00\x00\x43\xe3\x43\xb0\x00\x00\x00\x00\x43\xe2\x43\xb2\x43\xee\x00\x00\x00\x00\x43\xe9\x00\x00\x00\x00\x43\xe4\x43\xb4\x43\xf0\x00\x00\x00\x00\x43\xeb\x00\x00\x00\x00\x43\xe6\x43\xb3\x00\x00\x00\x00\x43\xea\x43\xef\x00\x00\x00\x00\x43\xe5\x43\xb5\x00\x00\x00\x00\x43\xec\x43\xf1\x00\x00\x00\x00\x43\xe7\x43\xb6\x00\x00\x00\x00\x43\xed\x00\x00\x00\x00\x43\xf2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\xe8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2580 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xea\x44\xe9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe3\x44\xe2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xec\x44\xeb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe8\x44\xe7\x00\x00\x00\x00\x00\x00\x44\xe0\x00\x00\x00\x00\x44\xe4\x44\xe1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x7a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2600 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe6\x44\xe5\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x79\x00\x00\x44\x69\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x76\x00\x00\x00\x00\x43\x75\x00\x00\x43\x74\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2680 */ NULL,
-/* 2700 */ NULL,
-/* 2780 */ NULL,
-/* 2800 */ NULL,
-/* 2880 */ NULL,
-/* 2900 */ NULL,
-/* 2980 */ NULL,
-/* 2a00 */ NULL,
-/* 2a80 */ NULL,
-/* 2b00 */ NULL,
-/* 2b80 */ NULL,
-/* 2c00 */ NULL,
-/* 2c80 */ NULL,
-/* 2d00 */ NULL,
-/* 2d80 */ NULL,
-/* 2e00 */ NULL,
-/* 2e80 */ NULL,
-/* 2f00 */ NULL,
-/* 2f80 */ NULL,
 /* 3000 */ "\x40\x40\x43\x44\x43\x41\x44\x5b\x00\x00\x44\x5d\x44\x5e\x44\x5f\x44\x64\x44\x74\x44\x65\x44\x75\x43\x42\x43\x43\x44\x42\x44\x43\x44\x66\x44\x76\x44\x6c\x44\x7d\x44\x63\x44\x73\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\xa1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x47\x44\x81\x44\x48\x44\x82\x44\x49\x44\x83\x44\x51\x44\x84\x44\x52\x44\x85\x44\x86\x44\xc0\x44\x87\x44\xc1\x44\x88\x44\xc2\x44\x89\x44\xc3\x44\x8a\x44\xc4\x44\x8c\x44\xc5\x44\x8d\x44\xc6\x44\x8e\x44\xc7\x44\x8f\x44\xc8\x44\x90\x44\xc9\x44\x91\x44\xca\x44\x92\x44\xcb\x44\x56\x44\x93\x44\xcc\x44\x94\x44\xcd\x44\x95\x44\xce\x44\x96\x44\x97\x44\x98\x44\x99\x44\x9a\x44\x9d\x44\xcf\x44\xd5\x44\x9e\x44\xd0\x44\xd6\x44\x9f\x44\xd1\x44\xd7\x44\xa2\x44\xd2\x44\xd8\x44\xa3\x44\xd3\x44\xd9\x44\xa4\x44\xa5",
 /* 3080 */ "\x44\xa6\x44\xa7\x44\xa8\x44\x53\x44\xa9\x44\x54\x44\xaa\x44\x55\x44\xac\x44\xad\x44\xae\x44\xaf\x44\xba\x44\xbb\x44\x57\x44\xbc\x44\xda\x44\xdb\x44\x46\x44\xbd\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\xbe\x43\xbf\x44\xdc\x44\xdd\x00\x00\x00\x00\x43\x47\x43\x81\x43\x48\x43\x82\x43\x49\x43\x83\x43\x51\x43\x84\x43\x52\x43\x85\x43\x86\x43\xc0\x43\x87\x43\xc1\x43\x88\x43\xc2\x43\x89\x43\xc3\x43\x8a\x43\xc4\x43\x8c\x43\xc5\x43\x8d\x43\xc6\x43\x8e\x43\xc7\x43\x8f\x43\xc8\x43\x90\x43\xc9\x43\x91\x43\xca\x43\x92\x43\xcb\x43\x56\x43\x93\x43\xcc\x43\x94\x43\xcd\x43\x95\x43\xce\x43\x96\x43\x97\x43\x98\x43\x99\x43\x9a\x43\x9d\x43\xcf\x43\xd5\x43\x9e\x43\xd0\x43\xd6\x43\x9f\x43\xd1\x43\xd7\x43\xa2\x43\xd2\x43\xd8\x43\xa3\x43\xd3\x43\xd9\x43\xa4\x43\xa5\x43\xa6\x43\xa7\x43\xa8\x43\x53\x43\xa9\x43\x54\x43\xaa\x43\x55\x43\xac\x43\xad\x43\xae\x43\xaf\x43\xba\x43\xbb\x43\x57\x43\xbc\x43\xda\x43\xdb\x43\x46\x43\xbd\x43\xd4\x43\x59\x43\x5a\x00\x00\x00\x00\x00\x00\x00\x00\x43\x45\x43\x58\x43\xdc\x43\xdd\x00\x00",
-/* 3100 */ NULL,
-/* 3180 */ NULL,
 /* 3200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 3280 */ NULL,
-/* 3300 */ NULL,
-/* 3380 */ NULL,
-/* 3400 */ NULL,
-/* 3480 */ NULL,
-/* 3500 */ NULL,
-/* 3580 */ NULL,
-/* 3600 */ NULL,
-/* 3680 */ NULL,
-/* 3700 */ NULL,
-/* 3780 */ NULL,
-/* 3800 */ NULL,
-/* 3880 */ NULL,
-/* 3900 */ NULL,
-/* 3980 */ NULL,
-/* 3a00 */ NULL,
-/* 3a80 */ NULL,
-/* 3b00 */ NULL,
-/* 3b80 */ NULL,
-/* 3c00 */ NULL,
-/* 3c80 */ NULL,
-/* 3d00 */ NULL,
-/* 3d80 */ NULL,
-/* 3e00 */ NULL,
-/* 3e80 */ NULL,
-/* 3f00 */ NULL,
-/* 3f80 */ NULL,
-/* 4000 */ NULL,
-/* 4080 */ NULL,
-/* 4100 */ NULL,
-/* 4180 */ NULL,
-/* 4200 */ NULL,
-/* 4280 */ NULL,
-/* 4300 */ NULL,
-/* 4380 */ NULL,
-/* 4400 */ NULL,
-/* 4480 */ NULL,
-/* 4500 */ NULL,
-/* 4580 */ NULL,
-/* 4600 */ NULL,
-/* 4680 */ NULL,
-/* 4700 */ NULL,
-/* 4780 */ NULL,
-/* 4800 */ NULL,
-/* 4880 */ NULL,
-/* 4900 */ NULL,
-/* 4980 */ NULL,
-/* 4a00 */ NULL,
-/* 4a80 */ NULL,
-/* 4b00 */ NULL,
-/* 4b80 */ NULL,
-/* 4c00 */ NULL,
-/* 4c80 */ NULL,
-/* 4d00 */ NULL,
-/* 4d80 */ NULL,
 /* 4e00 */ "\x45\x41\x4b\xce\x00\x00\x45\x47\x00\x00\x00\x00\x00\x00\x45\x4d\x49\xd3\x45\x43\x45\x5e\x45\x5f\x00\x00\x46\xaf\x47\x89\x00\x00\x56\x42\x4d\xec\x00\x00\x00\x00\x4f\x97\x56\x43\x46\x9b\x57\x75\x4d\x56\x50\xc5\x00\x00\x00\x00\x00\x00\x00\x00\x4f\x62\x00\x00\x00\x00\x48\x83\x00\x00\x00\x00\x00\x00\x00\x00\x48\x7c\x00\x00\x56\x44\x00\x00\x56\x45\x00\x00\x00\x00\x45\x5c\x00\x00\x00\x00\x00\x00\x56\x46\x4c\xb8\x00\x00\x00\x00\x00\x00\x56\x47\x00\x00\x46\x7a\x48\xab\x00\x00\x47\x62\x54\xc8\x00\x00\x00\x00\x56\x48\x00\x00\x00\x00\x56\x49\x4b\x9f\x00\x00\x45\x8a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\xd8\x00\x00\x55\xa9\x54\xa5\x4f\x6c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x62\xd0\x56\x4a\x49\x47\x56\x4b\x4b\xbd\x00\x00\x00\x00\x00\x00\x45\x49\x4e\xb5\x47\x49\x00\x00\x00\x00\x56\x4c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4b\xbf\x00\x00\x4a\x98\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x49\x70\x00\x00",
 /* 4e80 */ "\x47\xc0\x00\x00\x56\x4d\x00\x00\x00\x00\x56\x4e\x4b\xb1\x00\x00\x47\xc2\x48\x96\x56\x4f\x45\xce\x45\x42\x00\x00\x56\x50\x00\x00\x00\x00\x49\x9d\x4b\x74\x00\x00\x45\x45\x45\x6d\x00\x00\x00\x00\x4b\xe4\x50\xe8\x00\x00\x55\xdc\x48\x67\x00\x00\x56\x52\x51\x67\x56\x53\x4c\xce\x56\x54\x00\x00\x47\x8e\x4f\x7f\x4f\xfa\x00\x00\x4b\xac\x00\x00\x00\x00\x4b\x73\x45\x75\x4e\x52\x49\x9c\x00\x00\x56\x55\x00\x00\x00\x00\x56\x56\x00\x00\x00\x00\x56\x57\x00\x00\x00\x00\x00\x00\x45\x93\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x53\xd9\x47\x76\x56\x5c\x00\x00\x56\x5a\x00\x00\x56\x5b\x50\x85\x00\x00\x00\x00\x45\xe0\x48\x4b\x00\x00\x56\x59\x56\x58\x4b\xe5\x00\x00\x00\x00\x00\x00\x00\x00\x54\x65\x48\xb5\x47\x55\x56\x5e\x47\x5d\x48\xa2\x00\x00\x00\x00\x00\x00\x44\x5c\x56\x5f\x56\x61\x00\x00\x56\x5d\x00\x00\x45\x9a\x49\xc3\x46\xf6\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x56\x60\x4d\x71\x00\x00\x4d\xed\x00\x00\x48\x69\x00\x00\x00\x00\x00\x00\x48\xb2\x53\x41\x00\x00\x00\x00\x00\x00\x4a\x55\x56\x62\x00\x00\x00\x00\x00\x00",
 /* 4f00 */ "\x56\x65\x47\xd2\x00\x00\x56\x66\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x56\x63\x45\xb2\x00\x00\x00\x00\x4d\x99\x4e\x9f\x4a\x83\x50\xf6\x4a\x81\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\xbd\x00\x00\x56\x64\x48\xd9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x49\xa6\x56\x68\x00\x00\x00\x00\x00\x00\x49\xc9\x00\x00\x54\x4a\x00\x00\x46\xf4\x56\x6a\x50\x8a\x00\x00\x4b\xbc\x54\x61\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4e\xdf\x00\x00\x00\x00\x4e\xfe\x56\x6c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x47\xc8\x48\xa4\x46\xe0\x45\x76\x4c\xe6\x00\x00\x46\x96\x00\x00\x47\x70\x56\x6e\x56\x6b\x00\x00\x49\xc1\x56\x67\x56\x6f\x45\x94\x56\x69\x56\x6d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x56\x79\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x56\x7c\x56\x7a\x00\x00\x00\x00\x48\x76\x00\x00\x4b\x94\x51\xe2\x00\x00\x00\x00\x00\x00\x00\x00\x56\x77\x54\x62\x00\x00\x00\x00\x48\xb6",
@@ -370,134 +272,6 @@ static uni16_t uni16[] = {
 /* 9e80 */ "\x00\x00\x68\x45\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x46\x00\x00\x00\x00\x68\x47\x68\x48\x00\x00\x00\x00\x00\x00\x00\x00\x68\x4a\x51\xf9\x51\x9e\x00\x00\x68\x49\x00\x00\x4c\xf3\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x4b\x00\x00\x51\x9b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x4c\x4a\xe0\x00\x00\x00\x00\x53\xb4\x68\x4e\x00\x00\x00\x00\x68\x4f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x52\x61\x55\x5f\x00\x00\x00\x00\x68\x4d\x52\x61\x55\x5f\x48\xa7\x68\x50\x00\x00\x68\x51\x4e\xea\x00\x00\x00\x00\x00\x00\x00\x00\x4a\xc6\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x53\x55\xae\x51\xa7\x68\x54\x68\x55\x68\x56\x46\x79\x00\x00\x68\x57\x00\x00\x00\x00\x00\x00\x5e\x90\x4d\xbc\x00\x00\x51\xdd\x68\x58\x68\x5a\x68\x59\x00\x00\x68\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x68\x5c\x00\x00\x00\x00\x68\x5d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x5e\x00\x00\x00\x00\x00\x00\x00\x00\x68\x5f\x00\x00\x68\x60\x68\x61\x00\x00\x68\x62\x00\x00\x68\x63\x68\x64\x68\x65\x00\x00\x00\x00",
 /* 9f00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x66\x68\x67\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x51\xaa\x00\x00\x00\x00\x00\x00\x00\x00\x4f\xaf\x00\x00\x68\x69\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x50\xcb\x68\x6a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x6b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4c\xfd\x00\x00\x00\x00\x68\x6c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x6d\x51\xf5\x00\x00\x00\x00\x68\x6e\x68\x6f\x00\x00\x00\x00\x68\x70\x00\x00\x68\x71\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x73\x68\x74\x68\x75\x4c\x80\x68\x72\x00\x00\x00\x00\x68\x76\x68\x77\x00\x00\x00\x00\x68\x79\x00\x00\x68\x78\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x7b\x00\x00\x00\x00\x00\x00\x68\x7c\x68\x7a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 9f80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x48\xca\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x7d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x68\x7e\x5f\xf7\x00\x00\x00\x00\x68\x7f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* a000 */ NULL,
-/* a080 */ NULL,
-/* a100 */ NULL,
-/* a180 */ NULL,
-/* a200 */ NULL,
-/* a280 */ NULL,
-/* a300 */ NULL,
-/* a380 */ NULL,
-/* a400 */ NULL,
-/* a480 */ NULL,
-/* a500 */ NULL,
-/* a580 */ NULL,
-/* a600 */ NULL,
-/* a680 */ NULL,
-/* a700 */ NULL,
-/* a780 */ NULL,
-/* a800 */ NULL,
-/* a880 */ NULL,
-/* a900 */ NULL,
-/* a980 */ NULL,
-/* aa00 */ NULL,
-/* aa80 */ NULL,
-/* ab00 */ NULL,
-/* ab80 */ NULL,
-/* ac00 */ NULL,
-/* ac80 */ NULL,
-/* ad00 */ NULL,
-/* ad80 */ NULL,
-/* ae00 */ NULL,
-/* ae80 */ NULL,
-/* af00 */ NULL,
-/* af80 */ NULL,
-/* b000 */ NULL,
-/* b080 */ NULL,
-/* b100 */ NULL,
-/* b180 */ NULL,
-/* b200 */ NULL,
-/* b280 */ NULL,
-/* b300 */ NULL,
-/* b380 */ NULL,
-/* b400 */ NULL,
-/* b480 */ NULL,
-/* b500 */ NULL,
-/* b580 */ NULL,
-/* b600 */ NULL,
-/* b680 */ NULL,
-/* b700 */ NULL,
-/* b780 */ NULL,
-/* b800 */ NULL,
-/* b880 */ NULL,
-/* b900 */ NULL,
-/* b980 */ NULL,
-/* ba00 */ NULL,
-/* ba80 */ NULL,
-/* bb00 */ NULL,
-/* bb80 */ NULL,
-/* bc00 */ NULL,
-/* bc80 */ NULL,
-/* bd00 */ NULL,
-/* bd80 */ NULL,
-/* be00 */ NULL,
-/* be80 */ NULL,
-/* bf00 */ NULL,
-/* bf80 */ NULL,
-/* c000 */ NULL,
-/* c080 */ NULL,
-/* c100 */ NULL,
-/* c180 */ NULL,
-/* c200 */ NULL,
-/* c280 */ NULL,
-/* c300 */ NULL,
-/* c380 */ NULL,
-/* c400 */ NULL,
-/* c480 */ NULL,
-/* c500 */ NULL,
-/* c580 */ NULL,
-/* c600 */ NULL,
-/* c680 */ NULL,
-/* c700 */ NULL,
-/* c780 */ NULL,
-/* c800 */ NULL,
-/* c880 */ NULL,
-/* c900 */ NULL,
-/* c980 */ NULL,
-/* ca00 */ NULL,
-/* ca80 */ NULL,
-/* cb00 */ NULL,
-/* cb80 */ NULL,
-/* cc00 */ NULL,
-/* cc80 */ NULL,
-/* cd00 */ NULL,
-/* cd80 */ NULL,
-/* ce00 */ NULL,
-/* ce80 */ NULL,
-/* cf00 */ NULL,
-/* cf80 */ NULL,
-/* d000 */ NULL,
-/* d080 */ NULL,
-/* d100 */ NULL,
-/* d180 */ NULL,
-/* d200 */ NULL,
-/* d280 */ NULL,
-/* d300 */ NULL,
-/* d380 */ NULL,
-/* d400 */ NULL,
-/* d480 */ NULL,
-/* d500 */ NULL,
-/* d580 */ NULL,
-/* d600 */ NULL,
-/* d680 */ NULL,
-/* d700 */ NULL,
-/* d780 */ NULL,
-/* d800 */ NULL,
-/* d880 */ NULL,
-/* d900 */ NULL,
-/* d980 */ NULL,
-/* da00 */ NULL,
-/* da80 */ NULL,
-/* db00 */ NULL,
-/* db80 */ NULL,
-/* dc00 */ NULL,
-/* dc80 */ NULL,
-/* dd00 */ NULL,
-/* dd80 */ NULL,
-/* de00 */ NULL,
-/* de80 */ NULL,
-/* df00 */ NULL,
-/* df80 */ NULL,
 /* e000 */ "\x69\x41\x69\x42\x69\x43\x69\x44\x69\x45\x69\x46\x69\x47\x69\x48\x69\x49\x69\x4a\x69\x4b\x69\x4c\x69\x4d\x69\x4e\x69\x4f\x69\x50\x69\x51\x69\x52\x69\x53\x69\x54\x69\x55\x69\x56\x69\x57\x69\x58\x69\x59\x69\x5a\x69\x5b\x69\x5c\x69\x5d\x69\x5e\x69\x5f\x69\x60\x69\x61\x69\x62\x69\x63\x69\x64\x69\x65\x69\x66\x69\x67\x69\x68\x69\x69\x69\x6a\x69\x6b\x69\x6c\x69\x6d\x69\x6e\x69\x6f\x69\x70\x69\x71\x69\x72\x69\x73\x69\x74\x69\x75\x69\x76\x69\x77\x69\x78\x69\x79\x69\x7a\x69\x7b\x69\x7c\x69\x7d\x69\x7e\x69\x7f\x69\x80\x69\x81\x69\x82\x69\x83\x69\x84\x69\x85\x69\x86\x69\x87\x69\x88\x69\x89\x69\x8a\x69\x8b\x69\x8c\x69\x8d\x69\x8e\x69\x8f\x69\x90\x69\x91\x69\x92\x69\x93\x69\x94\x69\x95\x69\x96\x69\x97\x69\x98\x69\x99\x69\x9a\x69\x9b\x69\x9c\x69\x9d\x69\x9e\x69\x9f\x69\xa0\x69\xa1\x69\xa2\x69\xa3\x69\xa4\x69\xa5\x69\xa6\x69\xa7\x69\xa8\x69\xa9\x69\xaa\x69\xab\x69\xac\x69\xad\x69\xae\x69\xaf\x69\xb0\x69\xb1\x69\xb2\x69\xb3\x69\xb4\x69\xb5\x69\xb6\x69\xb7\x69\xb8\x69\xb9\x69\xba\x69\xbb\x69\xbc\x69\xbd\x69\xbe\x69\xbf\x69\xc0",
 /* e080 */ "\x69\xc1\x69\xc2\x69\xc3\x69\xc4\x69\xc5\x69\xc6\x69\xc7\x69\xc8\x69\xc9\x69\xca\x69\xcb\x69\xcc\x69\xcd\x69\xce\x69\xcf\x69\xd0\x69\xd1\x69\xd2\x69\xd3\x69\xd4\x69\xd5\x69\xd6\x69\xd7\x69\xd8\x69\xd9\x69\xda\x69\xdb\x69\xdc\x69\xdd\x69\xde\x69\xdf\x69\xe0\x69\xe1\x69\xe2\x69\xe3\x69\xe4\x69\xe5\x69\xe6\x69\xe7\x69\xe8\x69\xe9\x69\xea\x69\xeb\x69\xec\x69\xed\x69\xee\x69\xef\x69\xf0\x69\xf1\x69\xf2\x69\xf3\x69\xf4\x69\xf5\x69\xf6\x69\xf7\x69\xf8\x69\xf9\x69\xfa\x69\xfb\x69\xfc\x69\xfd\x69\xfe\x6a\x41\x6a\x42\x6a\x43\x6a\x44\x6a\x45\x6a\x46\x6a\x47\x6a\x48\x6a\x49\x6a\x4a\x6a\x4b\x6a\x4c\x6a\x4d\x6a\x4e\x6a\x4f\x6a\x50\x6a\x51\x6a\x52\x6a\x53\x6a\x54\x6a\x55\x6a\x56\x6a\x57\x6a\x58\x6a\x59\x6a\x5a\x6a\x5b\x6a\x5c\x6a\x5d\x6a\x5e\x6a\x5f\x6a\x60\x6a\x61\x6a\x62\x6a\x63\x6a\x64\x6a\x65\x6a\x66\x6a\x67\x6a\x68\x6a\x69\x6a\x6a\x6a\x6b\x6a\x6c\x6a\x6d\x6a\x6e\x6a\x6f\x6a\x70\x6a\x71\x6a\x72\x6a\x73\x6a\x74\x6a\x75\x6a\x76\x6a\x77\x6a\x78\x6a\x79\x6a\x7a\x6a\x7b\x6a\x7c\x6a\x7d\x6a\x7e\x6a\x7f\x6a\x80\x6a\x81\x6a\x82",
 /* e100 */ "\x6a\x83\x6a\x84\x6a\x85\x6a\x86\x6a\x87\x6a\x88\x6a\x89\x6a\x8a\x6a\x8b\x6a\x8c\x6a\x8d\x6a\x8e\x6a\x8f\x6a\x90\x6a\x91\x6a\x92\x6a\x93\x6a\x94\x6a\x95\x6a\x96\x6a\x97\x6a\x98\x6a\x99\x6a\x9a\x6a\x9b\x6a\x9c\x6a\x9d\x6a\x9e\x6a\x9f\x6a\xa0\x6a\xa1\x6a\xa2\x6a\xa3\x6a\xa4\x6a\xa5\x6a\xa6\x6a\xa7\x6a\xa8\x6a\xa9\x6a\xaa\x6a\xab\x6a\xac\x6a\xad\x6a\xae\x6a\xaf\x6a\xb0\x6a\xb1\x6a\xb2\x6a\xb3\x6a\xb4\x6a\xb5\x6a\xb6\x6a\xb7\x6a\xb8\x6a\xb9\x6a\xba\x6a\xbb\x6a\xbc\x6a\xbd\x6a\xbe\x6a\xbf\x6a\xc0\x6a\xc1\x6a\xc2\x6a\xc3\x6a\xc4\x6a\xc5\x6a\xc6\x6a\xc7\x6a\xc8\x6a\xc9\x6a\xca\x6a\xcb\x6a\xcc\x6a\xcd\x6a\xce\x6a\xcf\x6a\xd0\x6a\xd1\x6a\xd2\x6a\xd3\x6a\xd4\x6a\xd5\x6a\xd6\x6a\xd7\x6a\xd8\x6a\xd9\x6a\xda\x6a\xdb\x6a\xdc\x6a\xdd\x6a\xde\x6a\xdf\x6a\xe0\x6a\xe1\x6a\xe2\x6a\xe3\x6a\xe4\x6a\xe5\x6a\xe6\x6a\xe7\x6a\xe8\x6a\xe9\x6a\xea\x6a\xeb\x6a\xec\x6a\xed\x6a\xee\x6a\xef\x6a\xf0\x6a\xf1\x6a\xf2\x6a\xf3\x6a\xf4\x6a\xf5\x6a\xf6\x6a\xf7\x6a\xf8\x6a\xf9\x6a\xfa\x6a\xfb\x6a\xfc\x6a\xfd\x6a\xfe\x6b\x41\x6b\x42\x6b\x43\x6b\x44",
@@ -533,166 +307,51 @@ static uni16_t uni16[] = {
 /* f000 */ "\x7e\xab\x7e\xac\x7e\xad\x7e\xae\x7e\xaf\x7e\xb0\x7e\xb1\x7e\xb2\x7e\xb3\x7e\xb4\x7e\xb5\x7e\xb6\x7e\xb7\x7e\xb8\x7e\xb9\x7e\xba\x7e\xbb\x7e\xbc\x7e\xbd\x7e\xbe\x7e\xbf\x7e\xc0\x7e\xc1\x7e\xc2\x7e\xc3\x7e\xc4\x7e\xc5\x7e\xc6\x7e\xc7\x7e\xc8\x7e\xc9\x7e\xca\x7e\xcb\x7e\xcc\x7e\xcd\x7e\xce\x7e\xcf\x7e\xd0\x7e\xd1\x7e\xd2\x7e\xd3\x7e\xd4\x7e\xd5\x7e\xd6\x7e\xd7\x7e\xd8\x7e\xd9\x7e\xda\x7e\xdb\x7e\xdc\x7e\xdd\x7e\xde\x7e\xdf\x7e\xe0\x7e\xe1\x7e\xe2\x7e\xe3\x7e\xe4\x7e\xe5\x7e\xe6\x7e\xe7\x7e\xe8\x7e\xe9\x7e\xea\x7e\xeb\x7e\xec\x7e\xed\x7e\xee\x7e\xef\x7e\xf0\x7e\xf1\x7e\xf2\x7e\xf3\x7e\xf4\x7e\xf5\x7e\xf6\x7e\xf7\x7e\xf8\x7e\xf9\x7e\xfa\x7e\xfb\x7e\xfc\x7e\xfd\x7e\xfe\x7f\x41\x7f\x42\x7f\x43\x7f\x44\x7f\x45\x7f\x46\x7f\x47\x7f\x48\x7f\x49\x7f\x4a\x7f\x4b\x7f\x4c\x7f\x4d\x7f\x4e\x7f\x4f\x7f\x50\x7f\x51\x7f\x52\x7f\x53\x7f\x54\x7f\x55\x7f\x56\x7f\x57\x7f\x58\x7f\x59\x7f\x5a\x7f\x5b\x7f\x5c\x7f\x5d\x7f\x5e\x7f\x5f\x7f\x60\x7f\x61\x7f\x62\x7f\x63\x7f\x64\x7f\x65\x7f\x66\x7f\x67\x7f\x68\x7f\x69\x7f\x6a\x7f\x6b\x7f\x6c",
 /* f080 */ "\x7f\x6d\x7f\x6e\x7f\x6f\x7f\x70\x7f\x71\x7f\x72\x7f\x73\x7f\x74\x7f\x75\x7f\x76\x7f\x77\x7f\x78\x7f\x79\x7f\x7a\x7f\x7b\x7f\x7c\x7f\x7d\x7f\x7e\x7f\x7f\x7f\x80\x7f\x81\x7f\x82\x7f\x83\x7f\x84\x7f\x85\x7f\x86\x7f\x87\x7f\x88\x7f\x89\x7f\x8a\x7f\x8b\x7f\x8c\x7f\x8d\x7f\x8e\x7f\x8f\x7f\x90\x7f\x91\x7f\x92\x7f\x93\x7f\x94\x7f\x95\x7f\x96\x7f\x97\x7f\x98\x7f\x99\x7f\x9a\x7f\x9b\x7f\x9c\x7f\x9d\x7f\x9e\x7f\x9f\x7f\xa0\x7f\xa1\x7f\xa2\x7f\xa3\x7f\xa4\x7f\xa5\x7f\xa6\x7f\xa7\x7f\xa8\x7f\xa9\x7f\xaa\x7f\xab\x7f\xac\x7f\xad\x7f\xae\x7f\xaf\x7f\xb0\x7f\xb1\x7f\xb2\x7f\xb3\x7f\xb4\x7f\xb5\x7f\xb6\x7f\xb7\x7f\xb8\x7f\xb9\x7f\xba\x7f\xbb\x7f\xbc\x7f\xbd\x7f\xbe\x7f\xbf\x7f\xc0\x7f\xc1\x7f\xc2\x7f\xc3\x7f\xc4\x7f\xc5\x7f\xc6\x7f\xc7\x7f\xc8\x7f\xc9\x7f\xca\x7f\xcb\x7f\xcc\x7f\xcd\x7f\xce\x7f\xcf\x7f\xd0\x7f\xd1\x7f\xd2\x7f\xd3\x7f\xd4\x7f\xd5\x7f\xd6\x7f\xd7\x7f\xd8\x7f\xd9\x7f\xda\x7f\xdb\x7f\xdc\x7f\xdd\x7f\xde\x7f\xdf\x7f\xe0\x7f\xe1\x7f\xe2\x7f\xe3\x7f\xe4\x7f\xe5\x7f\xe6\x7f\xe7\x7f\xe8\x7f\xe9\x7f\xea\x7f\xeb\x7f\xec",
 /* f100 */ "\x7f\xed\x7f\xee\x7f\xef\x7f\xf0\x7f\xf1\x7f\xf2\x7f\xf3\x7f\xf4\x7f\xf5\x7f\xf6\x7f\xf7\x7f\xf8\x7f\xf9\x7f\xfa\x7f\xfb\x7f\xfc\x7f\xfd\x7f\xfe\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* f180 */ NULL,
-/* f200 */ NULL,
-/* f280 */ NULL,
-/* f300 */ NULL,
-/* f380 */ NULL,
-/* f400 */ NULL,
-/* f480 */ NULL,
-/* f500 */ NULL,
-/* f580 */ NULL,
-/* f600 */ NULL,
-/* f680 */ NULL,
-/* f700 */ NULL,
-/* f780 */ NULL,
 /* f800 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* f880 */ NULL,
 /* f900 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x5b\xc9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* f980 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x66\x74\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* fa00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x57\x8e\x58\x77\x58\x82\x59\x80\x5b\xae\x5c\x66\x5c\x78\x5e\x49\x5e\x8a\x5f\x7a\x5f\xd2\x5f\xd5\x5f\xd9\x5f\xdd\x60\x59\x60\xad\x61\x77\x62\xb9\x62\xce\x62\xe2\x63\xee\x64\x8e\x64\xf1\x65\x49\x65\x66\x65\xb8\x65\xc6\x66\x78\x66\xdd\x66\xdf\x66\xe6\x67\xf4\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* fa80 */ NULL,
-/* fb00 */ NULL,
-/* fb80 */ NULL,
-/* fc00 */ NULL,
-/* fc80 */ NULL,
-/* fd00 */ NULL,
-/* fd80 */ NULL,
-/* fe00 */ NULL,
-/* fe80 */ NULL,
 /* ff00 */ "\x00\x00\x42\x5a\x42\x7f\x42\x7b\x42\xe0\x42\x6c\x42\x50\x42\x7d\x42\x4d\x42\x5d\x42\x5c\x42\x4e\x42\x6b\x00\x00\x42\x4b\x42\x61\x42\xf0\x42\xf1\x42\xf2\x42\xf3\x42\xf4\x42\xf5\x42\xf6\x42\xf7\x42\xf8\x42\xf9\x42\x7a\x42\x5e\x42\x4c\x42\x7e\x42\x6e\x42\x6f\x42\x7c\x42\xc1\x42\xc2\x42\xc3\x42\xc4\x42\xc5\x42\xc6\x42\xc7\x42\xc8\x42\xc9\x42\xd1\x42\xd2\x42\xd3\x42\xd4\x42\xd5\x42\xd6\x42\xd7\x42\xd8\x42\xd9\x42\xe2\x42\xe3\x42\xe4\x42\xe5\x42\xe6\x42\xe7\x42\xe8\x42\xe9\x44\x44\x43\xe0\x44\x45\x44\x70\x42\x6d\x42\x79\x42\x81\x42\x82\x42\x83\x42\x84\x42\x85\x42\x86\x42\x87\x42\x88\x42\x89\x42\x91\x42\x92\x42\x93\x42\x94\x42\x95\x42\x96\x42\x97\x42\x98\x42\x99\x42\xa2\x42\xa3\x42\xa4\x42\xa5\x42\xa6\x42\xa7\x42\xa8\x42\xa9\x42\xc0\x42\x4f\x42\xd0\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* ff80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x4a\x42\x4a\x42\x5f\x42\xa1\x00\x00\x42\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-/* EBCDIC DBCS to Unicode translation table for ibm-300_P110-1997 */ {
-/* 0000 */ NULL,
-/* 0080 */ NULL,
-/* 0100 */ NULL,
-/* 0180 */ NULL,
-/* 0200 */ NULL,
-/* 0280 */ NULL,
-/* 0300 */ NULL,
-/* 0380 */ NULL,
-/* 0400 */ NULL,
-/* 0480 */ NULL,
-/* 0500 */ NULL,
-/* 0580 */ NULL,
-/* 0600 */ NULL,
-/* 0680 */ NULL,
-/* 0700 */ NULL,
-/* 0780 */ NULL,
-/* 0800 */ NULL,
-/* 0880 */ NULL,
-/* 0900 */ NULL,
-/* 0980 */ NULL,
-/* 0a00 */ NULL,
-/* 0a80 */ NULL,
-/* 0b00 */ NULL,
-/* 0b80 */ NULL,
-/* 0c00 */ NULL,
-/* 0c80 */ NULL,
-/* 0d00 */ NULL,
-/* 0d80 */ NULL,
-/* 0e00 */ NULL,
-/* 0e80 */ NULL,
-/* 0f00 */ NULL,
-/* 0f80 */ NULL,
-/* 1000 */ NULL,
-/* 1080 */ NULL,
-/* 1100 */ NULL,
-/* 1180 */ NULL,
-/* 1200 */ NULL,
-/* 1280 */ NULL,
-/* 1300 */ NULL,
-/* 1380 */ NULL,
-/* 1400 */ NULL,
-/* 1480 */ NULL,
-/* 1500 */ NULL,
-/* 1580 */ NULL,
-/* 1600 */ NULL,
-/* 1680 */ NULL,
-/* 1700 */ NULL,
-/* 1780 */ NULL,
-/* 1800 */ NULL,
-/* 1880 */ NULL,
-/* 1900 */ NULL,
-/* 1980 */ NULL,
-/* 1a00 */ NULL,
-/* 1a80 */ NULL,
-/* 1b00 */ NULL,
-/* 1b80 */ NULL,
-/* 1c00 */ NULL,
-/* 1c80 */ NULL,
-/* 1d00 */ NULL,
-/* 1d80 */ NULL,
-/* 1e00 */ NULL,
-/* 1e80 */ NULL,
-/* 1f00 */ NULL,
-/* 1f80 */ NULL,
-/* 2000 */ NULL,
-/* 2080 */ NULL,
-/* 2100 */ NULL,
-/* 2180 */ NULL,
-/* 2200 */ NULL,
-/* 2280 */ NULL,
-/* 2300 */ NULL,
-/* 2380 */ NULL,
-/* 2400 */ NULL,
-/* 2480 */ NULL,
-/* 2500 */ NULL,
-/* 2580 */ NULL,
-/* 2600 */ NULL,
-/* 2680 */ NULL,
-/* 2700 */ NULL,
-/* 2780 */ NULL,
-/* 2800 */ NULL,
-/* 2880 */ NULL,
-/* 2900 */ NULL,
-/* 2980 */ NULL,
-/* 2a00 */ NULL,
-/* 2a80 */ NULL,
-/* 2b00 */ NULL,
-/* 2b80 */ NULL,
-/* 2c00 */ NULL,
-/* 2c80 */ NULL,
-/* 2d00 */ NULL,
-/* 2d80 */ NULL,
-/* 2e00 */ NULL,
-/* 2e80 */ NULL,
-/* 2f00 */ NULL,
-/* 2f80 */ NULL,
-/* 3000 */ NULL,
-/* 3080 */ NULL,
-/* 3100 */ NULL,
-/* 3180 */ NULL,
-/* 3200 */ NULL,
-/* 3280 */ NULL,
-/* 3300 */ NULL,
-/* 3380 */ NULL,
-/* 3400 */ NULL,
-/* 3480 */ NULL,
-/* 3500 */ NULL,
-/* 3580 */ NULL,
-/* 3600 */ NULL,
-/* 3680 */ NULL,
-/* 3700 */ NULL,
-/* 3780 */ NULL,
-/* 3800 */ NULL,
-/* 3880 */ NULL,
-/* 3900 */ NULL,
-/* 3980 */ NULL,
-/* 3a00 */ NULL,
-/* 3a80 */ NULL,
-/* 3b00 */ NULL,
-/* 3b80 */ NULL,
-/* 3c00 */ NULL,
-/* 3c80 */ NULL,
-/* 3d00 */ NULL,
-/* 3d80 */ NULL,
-/* 3e00 */ NULL,
-/* 3e80 */ NULL,
-/* 3f00 */ NULL,
-/* 3f80 */ NULL,
+/* ff80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x4a\x42\x4a\x42\x5f\x42\xa1\x00\x00\x42\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+/* EBCDIC DBCS to Unicode translation table for ibm-300_P110-1997 */
+static const unsigned short cp930_ebc2u_ix[512] = {
+/* 0000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 0800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 4000 */ 1, 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+/* 4800 */ 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+/* 5000 */ 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+/* 5800 */ 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+/* 6000 */ 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+/* 6800 */ 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+/* 7000 */ 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+/* 7800 */ 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+/* 8000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 8800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 9000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 9800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* a000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* a800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* e000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* e800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* f000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* f800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const uni16_row_t cp930_ebc2u[] = {
 /* 4000 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x30\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 4080 */ NULL,
 /* 4100 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\xb1\x03\xb2\x03\xb3\x03\xb4\x03\xb5\x03\xb6\x03\xb7\x03\xb8\x03\xb9\x03\xba\x03\xbb\x03\xbc\x03\xbd\x03\xbe\x03\xbf\x03\xc0\x03\xc1\x03\xc3\x03\xc4\x03\xc5\x03\xc6\x03\xc7\x03\xc8\x03\xc9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\x91\x03\x92\x03\x93\x03\x94\x03\x95\x03\x96\x03\x97\x03\x98\x03\x99\x03\x9a\x03\x9b\x03\x9c\x03\x9d\x03\x9e\x03\x9f\x03\xa0\x03\xa1\x03\xa3\x03\xa4\x03\xa5\x03\xa6\x03\xa7\x03\xa8\x03\xa9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 4180 */ "\x04\x30\x04\x31\x04\x32\x04\x33\x04\x34\x04\x35\x04\x51\x04\x36\x04\x37\x04\x38\x04\x39\x04\x3a\x04\x3b\x04\x3c\x04\x3d\x04\x3e\x04\x3f\x04\x40\x04\x41\x04\x42\x04\x43\x04\x44\x04\x45\x04\x46\x04\x47\x04\x48\x04\x49\x04\x4a\x04\x4b\x04\x4c\x04\x4d\x04\x4e\x04\x4f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x21\x70\x21\x71\x21\x72\x21\x73\x21\x74\x21\x75\x21\x76\x21\x77\x21\x78\x21\x79\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x04\x10\x04\x11\x04\x12\x04\x13\x04\x14\x04\x15\x04\x01\x04\x16\x04\x17\x04\x18\x04\x19\x04\x1a\x04\x1b\x04\x1c\x04\x1d\x04\x1e\x04\x1f\x04\x20\x04\x21\x04\x22\x04\x23\x04\x24\x04\x25\x04\x26\x04\x27\x04\x28\x04\x29\x04\x2a\x04\x2b\x04\x2c\x04\x2d\x04\x2e\x04\x2f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x21\x60\x21\x61\x21\x62\x21\x63\x21\x64\x21\x65\x21\x66\x21\x67\x21\x68\x21\x69\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 4200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xe1\xff\x0e\xff\x1c\xff\x08\xff\x0b\xff\x5c\xff\x06\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x01\xff\xe5\xff\x0a\xff\x09\xff\x1b\xff\xe2\x22\x12\xff\x0f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xa6\xff\x0c\xff\x05\xff\x3f\xff\x1e\xff\x1f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x40\xff\x1a\xff\x03\xff\x20\xff\x07\xff\x1d\xff\x02",
@@ -818,422 +477,66 @@ static uni16_t uni16[] = {
 /* 7e00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xef\x96\xef\x97\xef\x98\xef\x99\xef\x9a\xef\x9b\xef\x9c\xef\x9d\xef\x9e\xef\x9f\xef\xa0\xef\xa1\xef\xa2\xef\xa3\xef\xa4\xef\xa5\xef\xa6\xef\xa7\xef\xa8\xef\xa9\xef\xaa\xef\xab\xef\xac\xef\xad\xef\xae\xef\xaf\xef\xb0\xef\xb1\xef\xb2\xef\xb3\xef\xb4\xef\xb5\xef\xb6\xef\xb7\xef\xb8\xef\xb9\xef\xba\xef\xbb\xef\xbc\xef\xbd\xef\xbe\xef\xbf\xef\xc0\xef\xc1\xef\xc2\xef\xc3\xef\xc4\xef\xc5\xef\xc6\xef\xc7\xef\xc8\xef\xc9\xef\xca\xef\xcb\xef\xcc\xef\xcd\xef\xce\xef\xcf\xef\xd0\xef\xd1\xef\xd2\xef\xd3\xef\xd4",
 /* 7e80 */ "\xef\xd5\xef\xd6\xef\xd7\xef\xd8\xef\xd9\xef\xda\xef\xdb\xef\xdc\xef\xdd\xef\xde\xef\xdf\xef\xe0\xef\xe1\xef\xe2\xef\xe3\xef\xe4\xef\xe5\xef\xe6\xef\xe7\xef\xe8\xef\xe9\xef\xea\xef\xeb\xef\xec\xef\xed\xef\xee\xef\xef\xef\xf0\xef\xf1\xef\xf2\xef\xf3\xef\xf4\xef\xf5\xef\xf6\xef\xf7\xef\xf8\xef\xf9\xef\xfa\xef\xfb\xef\xfc\xef\xfd\xef\xfe\xef\xff\xf0\x00\xf0\x01\xf0\x02\xf0\x03\xf0\x04\xf0\x05\xf0\x06\xf0\x07\xf0\x08\xf0\x09\xf0\x0a\xf0\x0b\xf0\x0c\xf0\x0d\xf0\x0e\xf0\x0f\xf0\x10\xf0\x11\xf0\x12\xf0\x13\xf0\x14\xf0\x15\xf0\x16\xf0\x17\xf0\x18\xf0\x19\xf0\x1a\xf0\x1b\xf0\x1c\xf0\x1d\xf0\x1e\xf0\x1f\xf0\x20\xf0\x21\xf0\x22\xf0\x23\xf0\x24\xf0\x25\xf0\x26\xf0\x27\xf0\x28\xf0\x29\xf0\x2a\xf0\x2b\xf0\x2c\xf0\x2d\xf0\x2e\xf0\x2f\xf0\x30\xf0\x31\xf0\x32\xf0\x33\xf0\x34\xf0\x35\xf0\x36\xf0\x37\xf0\x38\xf0\x39\xf0\x3a\xf0\x3b\xf0\x3c\xf0\x3d\xf0\x3e\xf0\x3f\xf0\x40\xf0\x41\xf0\x42\xf0\x43\xf0\x44\xf0\x45\xf0\x46\xf0\x47\xf0\x48\xf0\x49\xf0\x4a\xf0\x4b\xf0\x4c\xf0\x4d\xf0\x4e\xf0\x4f\xf0\x50\xf0\x51\xf0\x52\xf0\x53\x00\x00",
 /* 7f00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf0\x54\xf0\x55\xf0\x56\xf0\x57\xf0\x58\xf0\x59\xf0\x5a\xf0\x5b\xf0\x5c\xf0\x5d\xf0\x5e\xf0\x5f\xf0\x60\xf0\x61\xf0\x62\xf0\x63\xf0\x64\xf0\x65\xf0\x66\xf0\x67\xf0\x68\xf0\x69\xf0\x6a\xf0\x6b\xf0\x6c\xf0\x6d\xf0\x6e\xf0\x6f\xf0\x70\xf0\x71\xf0\x72\xf0\x73\xf0\x74\xf0\x75\xf0\x76\xf0\x77\xf0\x78\xf0\x79\xf0\x7a\xf0\x7b\xf0\x7c\xf0\x7d\xf0\x7e\xf0\x7f\xf0\x80\xf0\x81\xf0\x82\xf0\x83\xf0\x84\xf0\x85\xf0\x86\xf0\x87\xf0\x88\xf0\x89\xf0\x8a\xf0\x8b\xf0\x8c\xf0\x8d\xf0\x8e\xf0\x8f\xf0\x90\xf0\x91\xf0\x92",
-/* 7f80 */ "\xf0\x93\xf0\x94\xf0\x95\xf0\x96\xf0\x97\xf0\x98\xf0\x99\xf0\x9a\xf0\x9b\xf0\x9c\xf0\x9d\xf0\x9e\xf0\x9f\xf0\xa0\xf0\xa1\xf0\xa2\xf0\xa3\xf0\xa4\xf0\xa5\xf0\xa6\xf0\xa7\xf0\xa8\xf0\xa9\xf0\xaa\xf0\xab\xf0\xac\xf0\xad\xf0\xae\xf0\xaf\xf0\xb0\xf0\xb1\xf0\xb2\xf0\xb3\xf0\xb4\xf0\xb5\xf0\xb6\xf0\xb7\xf0\xb8\xf0\xb9\xf0\xba\xf0\xbb\xf0\xbc\xf0\xbd\xf0\xbe\xf0\xbf\xf0\xc0\xf0\xc1\xf0\xc2\xf0\xc3\xf0\xc4\xf0\xc5\xf0\xc6\xf0\xc7\xf0\xc8\xf0\xc9\xf0\xca\xf0\xcb\xf0\xcc\xf0\xcd\xf0\xce\xf0\xcf\xf0\xd0\xf0\xd1\xf0\xd2\xf0\xd3\xf0\xd4\xf0\xd5\xf0\xd6\xf0\xd7\xf0\xd8\xf0\xd9\xf0\xda\xf0\xdb\xf0\xdc\xf0\xdd\xf0\xde\xf0\xdf\xf0\xe0\xf0\xe1\xf0\xe2\xf0\xe3\xf0\xe4\xf0\xe5\xf0\xe6\xf0\xe7\xf0\xe8\xf0\xe9\xf0\xea\xf0\xeb\xf0\xec\xf0\xed\xf0\xee\xf0\xef\xf0\xf0\xf0\xf1\xf0\xf2\xf0\xf3\xf0\xf4\xf0\xf5\xf0\xf6\xf0\xf7\xf0\xf8\xf0\xf9\xf0\xfa\xf0\xfb\xf0\xfc\xf0\xfd\xf0\xfe\xf0\xff\xf1\x00\xf1\x01\xf1\x02\xf1\x03\xf1\x04\xf1\x05\xf1\x06\xf1\x07\xf1\x08\xf1\x09\xf1\x0a\xf1\x0b\xf1\x0c\xf1\x0d\xf1\x0e\xf1\x0f\xf1\x10\xf1\x11\x00\x00",
-/* 8000 */ NULL,
-/* 8080 */ NULL,
-/* 8100 */ NULL,
-/* 8180 */ NULL,
-/* 8200 */ NULL,
-/* 8280 */ NULL,
-/* 8300 */ NULL,
-/* 8380 */ NULL,
-/* 8400 */ NULL,
-/* 8480 */ NULL,
-/* 8500 */ NULL,
-/* 8580 */ NULL,
-/* 8600 */ NULL,
-/* 8680 */ NULL,
-/* 8700 */ NULL,
-/* 8780 */ NULL,
-/* 8800 */ NULL,
-/* 8880 */ NULL,
-/* 8900 */ NULL,
-/* 8980 */ NULL,
-/* 8a00 */ NULL,
-/* 8a80 */ NULL,
-/* 8b00 */ NULL,
-/* 8b80 */ NULL,
-/* 8c00 */ NULL,
-/* 8c80 */ NULL,
-/* 8d00 */ NULL,
-/* 8d80 */ NULL,
-/* 8e00 */ NULL,
-/* 8e80 */ NULL,
-/* 8f00 */ NULL,
-/* 8f80 */ NULL,
-/* 9000 */ NULL,
-/* 9080 */ NULL,
-/* 9100 */ NULL,
-/* 9180 */ NULL,
-/* 9200 */ NULL,
-/* 9280 */ NULL,
-/* 9300 */ NULL,
-/* 9380 */ NULL,
-/* 9400 */ NULL,
-/* 9480 */ NULL,
-/* 9500 */ NULL,
-/* 9580 */ NULL,
-/* 9600 */ NULL,
-/* 9680 */ NULL,
-/* 9700 */ NULL,
-/* 9780 */ NULL,
-/* 9800 */ NULL,
-/* 9880 */ NULL,
-/* 9900 */ NULL,
-/* 9980 */ NULL,
-/* 9a00 */ NULL,
-/* 9a80 */ NULL,
-/* 9b00 */ NULL,
-/* 9b80 */ NULL,
-/* 9c00 */ NULL,
-/* 9c80 */ NULL,
-/* 9d00 */ NULL,
-/* 9d80 */ NULL,
-/* 9e00 */ NULL,
-/* 9e80 */ NULL,
-/* 9f00 */ NULL,
-/* 9f80 */ NULL,
-/* a000 */ NULL,
-/* a080 */ NULL,
-/* a100 */ NULL,
-/* a180 */ NULL,
-/* a200 */ NULL,
-/* a280 */ NULL,
-/* a300 */ NULL,
-/* a380 */ NULL,
-/* a400 */ NULL,
-/* a480 */ NULL,
-/* a500 */ NULL,
-/* a580 */ NULL,
-/* a600 */ NULL,
-/* a680 */ NULL,
-/* a700 */ NULL,
-/* a780 */ NULL,
-/* a800 */ NULL,
-/* a880 */ NULL,
-/* a900 */ NULL,
-/* a980 */ NULL,
-/* aa00 */ NULL,
-/* aa80 */ NULL,
-/* ab00 */ NULL,
-/* ab80 */ NULL,
-/* ac00 */ NULL,
-/* ac80 */ NULL,
-/* ad00 */ NULL,
-/* ad80 */ NULL,
-/* ae00 */ NULL,
-/* ae80 */ NULL,
-/* af00 */ NULL,
-/* af80 */ NULL,
-/* b000 */ NULL,
-/* b080 */ NULL,
-/* b100 */ NULL,
-/* b180 */ NULL,
-/* b200 */ NULL,
-/* b280 */ NULL,
-/* b300 */ NULL,
-/* b380 */ NULL,
-/* b400 */ NULL,
-/* b480 */ NULL,
-/* b500 */ NULL,
-/* b580 */ NULL,
-/* b600 */ NULL,
-/* b680 */ NULL,
-/* b700 */ NULL,
-/* b780 */ NULL,
-/* b800 */ NULL,
-/* b880 */ NULL,
-/* b900 */ NULL,
-/* b980 */ NULL,
-/* ba00 */ NULL,
-/* ba80 */ NULL,
-/* bb00 */ NULL,
-/* bb80 */ NULL,
-/* bc00 */ NULL,
-/* bc80 */ NULL,
-/* bd00 */ NULL,
-/* bd80 */ NULL,
-/* be00 */ NULL,
-/* be80 */ NULL,
-/* bf00 */ NULL,
-/* bf80 */ NULL,
-/* c000 */ NULL,
-/* c080 */ NULL,
-/* c100 */ NULL,
-/* c180 */ NULL,
-/* c200 */ NULL,
-/* c280 */ NULL,
-/* c300 */ NULL,
-/* c380 */ NULL,
-/* c400 */ NULL,
-/* c480 */ NULL,
-/* c500 */ NULL,
-/* c580 */ NULL,
-/* c600 */ NULL,
-/* c680 */ NULL,
-/* c700 */ NULL,
-/* c780 */ NULL,
-/* c800 */ NULL,
-/* c880 */ NULL,
-/* c900 */ NULL,
-/* c980 */ NULL,
-/* ca00 */ NULL,
-/* ca80 */ NULL,
-/* cb00 */ NULL,
-/* cb80 */ NULL,
-/* cc00 */ NULL,
-/* cc80 */ NULL,
-/* cd00 */ NULL,
-/* cd80 */ NULL,
-/* ce00 */ NULL,
-/* ce80 */ NULL,
-/* cf00 */ NULL,
-/* cf80 */ NULL,
-/* d000 */ NULL,
-/* d080 */ NULL,
-/* d100 */ NULL,
-/* d180 */ NULL,
-/* d200 */ NULL,
-/* d280 */ NULL,
-/* d300 */ NULL,
-/* d380 */ NULL,
-/* d400 */ NULL,
-/* d480 */ NULL,
-/* d500 */ NULL,
-/* d580 */ NULL,
-/* d600 */ NULL,
-/* d680 */ NULL,
-/* d700 */ NULL,
-/* d780 */ NULL,
-/* d800 */ NULL,
-/* d880 */ NULL,
-/* d900 */ NULL,
-/* d980 */ NULL,
-/* da00 */ NULL,
-/* da80 */ NULL,
-/* db00 */ NULL,
-/* db80 */ NULL,
-/* dc00 */ NULL,
-/* dc80 */ NULL,
-/* dd00 */ NULL,
-/* dd80 */ NULL,
-/* de00 */ NULL,
-/* de80 */ NULL,
-/* df00 */ NULL,
-/* df80 */ NULL,
-/* e000 */ NULL,
-/* e080 */ NULL,
-/* e100 */ NULL,
-/* e180 */ NULL,
-/* e200 */ NULL,
-/* e280 */ NULL,
-/* e300 */ NULL,
-/* e380 */ NULL,
-/* e400 */ NULL,
-/* e480 */ NULL,
-/* e500 */ NULL,
-/* e580 */ NULL,
-/* e600 */ NULL,
-/* e680 */ NULL,
-/* e700 */ NULL,
-/* e780 */ NULL,
-/* e800 */ NULL,
-/* e880 */ NULL,
-/* e900 */ NULL,
-/* e980 */ NULL,
-/* ea00 */ NULL,
-/* ea80 */ NULL,
-/* eb00 */ NULL,
-/* eb80 */ NULL,
-/* ec00 */ NULL,
-/* ec80 */ NULL,
-/* ed00 */ NULL,
-/* ed80 */ NULL,
-/* ee00 */ NULL,
-/* ee80 */ NULL,
-/* ef00 */ NULL,
-/* ef80 */ NULL,
-/* f000 */ NULL,
-/* f080 */ NULL,
-/* f100 */ NULL,
-/* f180 */ NULL,
-/* f200 */ NULL,
-/* f280 */ NULL,
-/* f300 */ NULL,
-/* f380 */ NULL,
-/* f400 */ NULL,
-/* f480 */ NULL,
-/* f500 */ NULL,
-/* f580 */ NULL,
-/* f600 */ NULL,
-/* f680 */ NULL,
-/* f700 */ NULL,
-/* f780 */ NULL,
-/* f800 */ NULL,
-/* f880 */ NULL,
-/* f900 */ NULL,
-/* f980 */ NULL,
-/* fa00 */ NULL,
-/* fa80 */ NULL,
-/* fb00 */ NULL,
-/* fb80 */ NULL,
-/* fc00 */ NULL,
-/* fc80 */ NULL,
-/* fd00 */ NULL,
-/* fd80 */ NULL,
-/* fe00 */ NULL,
-/* fe80 */ NULL,
-/* ff00 */ NULL,
-/* ff80 */ NULL }
-    },
-    { "cp935", "0x04380345" /* 1080, 837 */,
-/* Unicode to EBCDIC DBCS translation table for ibm-837_P100-2000 */ {
-/* 0000 */ NULL,
+/* 7f80 */ "\xf0\x93\xf0\x94\xf0\x95\xf0\x96\xf0\x97\xf0\x98\xf0\x99\xf0\x9a\xf0\x9b\xf0\x9c\xf0\x9d\xf0\x9e\xf0\x9f\xf0\xa0\xf0\xa1\xf0\xa2\xf0\xa3\xf0\xa4\xf0\xa5\xf0\xa6\xf0\xa7\xf0\xa8\xf0\xa9\xf0\xaa\xf0\xab\xf0\xac\xf0\xad\xf0\xae\xf0\xaf\xf0\xb0\xf0\xb1\xf0\xb2\xf0\xb3\xf0\xb4\xf0\xb5\xf0\xb6\xf0\xb7\xf0\xb8\xf0\xb9\xf0\xba\xf0\xbb\xf0\xbc\xf0\xbd\xf0\xbe\xf0\xbf\xf0\xc0\xf0\xc1\xf0\xc2\xf0\xc3\xf0\xc4\xf0\xc5\xf0\xc6\xf0\xc7\xf0\xc8\xf0\xc9\xf0\xca\xf0\xcb\xf0\xcc\xf0\xcd\xf0\xce\xf0\xcf\xf0\xd0\xf0\xd1\xf0\xd2\xf0\xd3\xf0\xd4\xf0\xd5\xf0\xd6\xf0\xd7\xf0\xd8\xf0\xd9\xf0\xda\xf0\xdb\xf0\xdc\xf0\xdd\xf0\xde\xf0\xdf\xf0\xe0\xf0\xe1\xf0\xe2\xf0\xe3\xf0\xe4\xf0\xe5\xf0\xe6\xf0\xe7\xf0\xe8\xf0\xe9\xf0\xea\xf0\xeb\xf0\xec\xf0\xed\xf0\xee\xf0\xef\xf0\xf0\xf0\xf1\xf0\xf2\xf0\xf3\xf0\xf4\xf0\xf5\xf0\xf6\xf0\xf7\xf0\xf8\xf0\xf9\xf0\xfa\xf0\xfb\xf0\xfc\xf0\xfd\xf0\xfe\xf0\xff\xf1\x00\xf1\x01\xf1\x02\xf1\x03\xf1\x04\xf1\x05\xf1\x06\xf1\x07\xf1\x08\xf1\x09\xf1\x0a\xf1\x0b\xf1\x0c\xf1\x0d\xf1\x0e\xf1\x0f\xf1\x10\xf1\x11\x00\x00"
+};
+
+/* Unicode to EBCDIC DBCS translation table for ibm-837_P100-2000 */
+static const unsigned short cp935_u2ebc_ix[512] = {
+/* 0000 */ 0, 1, 2, 3, 0, 4, 0, 5, 6, 0, 0, 0, 0, 0, 0, 0,
+/* 0800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2000 */ 7, 0, 8, 9, 10, 11, 12, 0, 13, 14, 15, 16, 17, 0, 0, 0,
+/* 2800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3000 */ 18, 19, 20, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 4000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 4800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 23, 24, 25,
+/* 5000 */ 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+/* 5800 */ 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+/* 6000 */ 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+/* 6800 */ 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+/* 7000 */ 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+/* 7800 */ 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+/* 8000 */ 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+/* 8800 */ 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153,
+/* 9000 */ 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169,
+/* 9800 */ 170, 171, 172, 173, 174, 175, 176, 0, 177, 178, 0, 0, 179, 180, 181, 182,
+/* a000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* a800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* e000 */ 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 0,
+/* e800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* f000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* f800 */ 198, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 199, 200
+};
+static const uni16_row_t cp935_u2ebc[] = {
 /* 0080 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x88\x00\x00\x00\x00\x44\x6a\x44\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xed\x44\x4b\x00\x00\x00\x00\x44\x50\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x7a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x44\x46\x42\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x48\x46\x46\x46\x5a\x00\x00\x46\x4c\x46\x4a\x00\x00\x00\x00\x00\x00\x00\x00\x46\x50\x46\x4e\x00\x00\x00\x00\x00\x00\x44\x7b\x00\x00\x46\x54\x46\x52\x00\x00\x46\x59\x00\x00\x00\x00\x00\x00",
 /* 0100 */ "\x00\x00\x46\x41\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x45\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x47\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x49\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x4d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x51\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 0180 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x43\x00\x00\x46\x4b\x00\x00\x46\x4f\x00\x00\x46\x53\x00\x00\x46\x55\x00\x00\x46\x56\x00\x00\x46\x57\x00\x00\x46\x58\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 0200 */ NULL,
 /* 0280 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x46\x00\x00\x45\x45\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 0300 */ NULL,
 /* 0380 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\x61\x41\x62\x41\x63\x41\x64\x41\x65\x41\x66\x41\x67\x41\x68\x41\x69\x41\x6a\x41\x6b\x41\x6c\x41\x6d\x41\x6e\x41\x6f\x41\x70\x41\x71\x00\x00\x41\x72\x41\x73\x41\x74\x41\x75\x41\x76\x41\x77\x41\x78\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\x41\x41\x42\x41\x43\x41\x44\x41\x45\x41\x46\x41\x47\x41\x48\x41\x49\x41\x4a\x41\x4b\x41\x4c\x41\x4d\x41\x4e\x41\x4f\x41\x50\x41\x51\x00\x00\x41\x52\x41\x53\x41\x54\x41\x55\x41\x56\x41\x57\x41\x58\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 0400 */ "\x00\x00\x41\xc6\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\xc0\x41\xc1\x41\xc2\x41\xc3\x41\xc4\x41\xc5\x41\xc7\x41\xc8\x41\xc9\x41\xca\x41\xcb\x41\xcc\x41\xcd\x41\xce\x41\xcf\x41\xd0\x41\xd1\x41\xd2\x41\xd3\x41\xd4\x41\xd5\x41\xd6\x41\xd7\x41\xd8\x41\xd9\x41\xda\x41\xdb\x41\xdc\x41\xdd\x41\xde\x41\xdf\x41\xe0\x41\x80\x41\x81\x41\x82\x41\x83\x41\x84\x41\x85\x41\x87\x41\x88\x41\x89\x41\x8a\x41\x8b\x41\x8c\x41\x8d\x41\x8e\x41\x8f\x41\x90\x41\x91\x41\x92\x41\x93\x41\x94\x41\x95\x41\x96\x41\x97\x41\x98\x41\x99\x41\x9a\x41\x9b\x41\x9c\x41\x9d\x41\x9e\x41\x9f\x41\xa0\x00\x00\x41\x86\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 0480 */ NULL,
-/* 0500 */ NULL,
-/* 0580 */ NULL,
-/* 0600 */ NULL,
-/* 0680 */ NULL,
-/* 0700 */ NULL,
-/* 0780 */ NULL,
-/* 0800 */ NULL,
-/* 0880 */ NULL,
-/* 0900 */ NULL,
-/* 0980 */ NULL,
-/* 0a00 */ NULL,
-/* 0a80 */ NULL,
-/* 0b00 */ NULL,
-/* 0b80 */ NULL,
-/* 0c00 */ NULL,
-/* 0c80 */ NULL,
-/* 0d00 */ NULL,
-/* 0d80 */ NULL,
-/* 0e00 */ NULL,
-/* 0e80 */ NULL,
-/* 0f00 */ NULL,
-/* 0f80 */ NULL,
-/* 1000 */ NULL,
-/* 1080 */ NULL,
-/* 1100 */ NULL,
-/* 1180 */ NULL,
-/* 1200 */ NULL,
-/* 1280 */ NULL,
-/* 1300 */ NULL,
-/* 1380 */ NULL,
-/* 1400 */ NULL,
-/* 1480 */ NULL,
-/* 1500 */ NULL,
-/* 1580 */ NULL,
-/* 1600 */ NULL,
-/* 1680 */ NULL,
-/* 1700 */ NULL,
-/* 1780 */ NULL,
-/* 1800 */ NULL,
-/* 1880 */ NULL,
-/* 1900 */ NULL,
-/* 1980 */ NULL,
-/* 1a00 */ NULL,
-/* 1a80 */ NULL,
-/* 1b00 */ NULL,
-/* 1b80 */ NULL,
-/* 1c00 */ NULL,
-/* 1c80 */ NULL,
-/* 1d00 */ NULL,
-/* 1d80 */ NULL,
-/* 1e00 */ NULL,
-/* 1e80 */ NULL,
-/* 1f00 */ NULL,
-/* 1f80 */ NULL,
 /* 2000 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x5a\x00\x00\x00\x00\x00\x00\x00\x00\x44\x4a\x44\x7c\x00\x00\x44\x61\x44\x71\x00\x00\x00\x00\x44\x62\x44\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x7e\x44\x7f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x8b\x00\x00\x44\xee\x44\xef\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2080 */ NULL,
 /* 2100 */ "\x00\x00\x00\x00\x00\x00\x44\x4e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\xf1\x41\xf2\x41\xf3\x41\xf4\x41\xf5\x41\xf6\x41\xf7\x41\xf8\x41\xf9\x41\xfa\x41\xfb\x41\xfc\x00\x00\x00\x00\x00\x00\x00\x00\x41\xb1\x41\xb2\x41\xb3\x41\xb4\x41\xb5\x41\xb6\x41\xb7\x41\xb8\x41\xb9\x41\xba\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2180 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xf1\x44\xf2\x44\xf0\x44\xf3\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x69\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x66\x00\x00\x45\x65\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x6b\x00\x00\x00\x00\x45\x77\x44\x4d\x00\x00\x45\x6e\x00\x00\x00\x00\x00\x00\x00\x00\x45\x6d\x00\x00\x45\x63\x45\x64\x45\x68\x45\x67\x45\x71\x00\x00\x00\x00\x45\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x68\x44\x78\x45\x62\x45\x6a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x76\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x75\x00\x00\x00\x00\x00\x00\x45\x74\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x4c\x45\x73\x00\x00\x00\x00\x44\x67\x44\x77\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x79\x45\x7a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2280 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x70\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x6c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2300 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x6f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2380 */ NULL,
 /* 2400 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\xe1\x45\xe2\x45\xe3\x45\xe4\x45\xe5\x45\xe6\x45\xe7\x45\xe8\x45\xe9\x45\xea\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\xc5\x45\xc6\x45\xc7\x45\xc8\x45\xc9\x45\xca\x45\xcb\x45\xcc\x45\xcd\x45\xce\x45\xcf\x45\xd0",
 /* 2480 */ "\x45\xd1\x45\xd2\x45\xd3\x45\xd4\x45\xd5\x45\xd6\x45\xd7\x45\xd8\x45\xb1\x45\xb2\x45\xb3\x45\xb4\x45\xb5\x45\xb6\x45\xb7\x45\xb8\x45\xb9\x45\xba\x45\xbb\x45\xbc\x45\xbd\x45\xbe\x45\xbf\x45\xc0\x45\xc1\x45\xc2\x45\xc3\x45\xc4\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2500 */ "\x46\xa4\x46\xa5\x46\xa6\x46\xa7\x46\xa8\x46\xa9\x46\xaa\x46\xab\x46\xac\x46\xad\x46\xae\x46\xaf\x46\xb0\x46\xb1\x46\xb2\x46\xb3\x46\xb4\x46\xb5\x46\xb6\x46\xb7\x46\xb8\x46\xb9\x46\xba\x46\xbb\x46\xbc\x46\xbd\x46\xbe\x46\xbf\x46\xc0\x46\xc1\x46\xc2\x46\xc3\x46\xc4\x46\xc5\x46\xc6\x46\xc7\x46\xc8\x46\xc9\x46\xca\x46\xcb\x46\xcc\x46\xcd\x46\xce\x46\xcf\x46\xd0\x46\xd1\x46\xd2\x46\xd3\x46\xd4\x46\xd5\x46\xd6\x46\xd7\x46\xd8\x46\xd9\x46\xda\x46\xdb\x46\xdc\x46\xdd\x46\xde\x46\xdf\x46\xe0\x46\xe1\x46\xe2\x46\xe3\x46\xe4\x46\xe5\x46\xe6\x46\xe7\x46\xe8\x46\xe9\x46\xea\x46\xeb\x46\xec\x46\xed\x46\xee\x46\xef\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2580 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xea\x44\xe9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe3\x44\xe2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xec\x44\xeb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe8\x44\xe7\x00\x00\x00\x00\x00\x00\x44\xe0\x00\x00\x00\x00\x44\xe4\x44\xe1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2600 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe6\x44\xe5\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x79\x00\x00\x44\x69\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2680 */ NULL,
-/* 2700 */ NULL,
-/* 2780 */ NULL,
-/* 2800 */ NULL,
-/* 2880 */ NULL,
-/* 2900 */ NULL,
-/* 2980 */ NULL,
-/* 2a00 */ NULL,
-/* 2a80 */ NULL,
-/* 2b00 */ NULL,
-/* 2b80 */ NULL,
-/* 2c00 */ NULL,
-/* 2c80 */ NULL,
-/* 2d00 */ NULL,
-/* 2d80 */ NULL,
-/* 2e00 */ NULL,
-/* 2e80 */ NULL,
-/* 2f00 */ NULL,
-/* 2f80 */ NULL,
 /* 3000 */ "\x40\x40\x43\x44\x43\x41\x44\x5b\x00\x00\x44\x5d\x44\x5e\x44\x5f\x44\x64\x44\x74\x44\x65\x44\x75\x43\x42\x43\x43\x44\x42\x44\x43\x44\x66\x44\x76\x44\x6c\x44\x7d\x44\x63\x44\x73\x45\x5b\x45\x5c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x47\x44\x81\x44\x48\x44\x82\x44\x49\x44\x83\x44\x51\x44\x84\x44\x52\x44\x85\x44\x86\x44\xc0\x44\x87\x44\xc1\x44\x88\x44\xc2\x44\x89\x44\xc3\x44\x8a\x44\xc4\x44\x8c\x44\xc5\x44\x8d\x44\xc6\x44\x8e\x44\xc7\x44\x8f\x44\xc8\x44\x90\x44\xc9\x44\x91\x44\xca\x44\x92\x44\xcb\x44\x56\x44\x93\x44\xcc\x44\x94\x44\xcd\x44\x95\x44\xce\x44\x96\x44\x97\x44\x98\x44\x99\x44\x9a\x44\x9d\x44\xcf\x44\xd5\x44\x9e\x44\xd0\x44\xd6\x44\x9f\x44\xd1\x44\xd7\x44\xa2\x44\xd2\x44\xd8\x44\xa3\x44\xd3\x44\xd9\x44\xa4\x44\xa5",
 /* 3080 */ "\x44\xa6\x44\xa7\x44\xa8\x44\x53\x44\xa9\x44\x54\x44\xaa\x44\x55\x44\xac\x44\xad\x44\xae\x44\xaf\x44\xba\x44\xbb\x44\x57\x44\xbc\x44\xda\x44\xdb\x44\x46\x44\xbd\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\xbe\x43\xbf\x44\xdc\x44\xdd\x00\x00\x00\x00\x43\x47\x43\x81\x43\x48\x43\x82\x43\x49\x43\x83\x43\x51\x43\x84\x43\x52\x43\x85\x43\x86\x43\xc0\x43\x87\x43\xc1\x43\x88\x43\xc2\x43\x89\x43\xc3\x43\x8a\x43\xc4\x43\x8c\x43\xc5\x43\x8d\x43\xc6\x43\x8e\x43\xc7\x43\x8f\x43\xc8\x43\x90\x43\xc9\x43\x91\x43\xca\x43\x92\x43\xcb\x43\x56\x43\x93\x43\xcc\x43\x94\x43\xcd\x43\x95\x43\xce\x43\x96\x43\x97\x43\x98\x43\x99\x43\x9a\x43\x9d\x43\xcf\x43\xd5\x43\x9e\x43\xd0\x43\xd6\x43\x9f\x43\xd1\x43\xd7\x43\xa2\x43\xd2\x43\xd8\x43\xa3\x43\xd3\x43\xd9\x43\xa4\x43\xa5\x43\xa6\x43\xa7\x43\xa8\x43\x53\x43\xa9\x43\x54\x43\xaa\x43\x55\x43\xac\x43\xad\x43\xae\x43\xaf\x43\xba\x43\xbb\x43\x57\x43\xbc\x43\xda\x43\xdb\x43\x46\x43\xbd\x43\xd4\x43\x59\x43\x5a\x00\x00\x00\x00\x00\x00\x00\x00\x43\x45\x43\x58\x43\xdc\x43\xdd\x00\x00",
 /* 3100 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x65\x46\x66\x46\x67\x46\x68\x46\x69\x46\x6a\x46\x6b\x46\x6c\x46\x6d\x46\x6e\x46\x6f\x46\x70\x46\x71\x46\x72\x46\x73\x46\x74\x46\x75\x46\x76\x46\x77\x46\x78\x46\x79\x46\x7a\x46\x7b\x46\x7c\x46\x7d\x46\x7e\x46\x7f\x46\x80\x46\x81\x46\x82\x46\x83\x46\x84\x46\x85\x46\x86\x46\x87\x46\x88\x46\x89\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 3180 */ NULL,
 /* 3200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\xf1\x45\xf2\x45\xf3\x45\xf4\x45\xf5\x45\xf6\x45\xf7\x45\xf8\x45\xf9\x45\xfa\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 3280 */ NULL,
-/* 3300 */ NULL,
-/* 3380 */ NULL,
-/* 3400 */ NULL,
-/* 3480 */ NULL,
-/* 3500 */ NULL,
-/* 3580 */ NULL,
-/* 3600 */ NULL,
-/* 3680 */ NULL,
-/* 3700 */ NULL,
-/* 3780 */ NULL,
-/* 3800 */ NULL,
-/* 3880 */ NULL,
-/* 3900 */ NULL,
-/* 3980 */ NULL,
-/* 3a00 */ NULL,
-/* 3a80 */ NULL,
-/* 3b00 */ NULL,
-/* 3b80 */ NULL,
-/* 3c00 */ NULL,
-/* 3c80 */ NULL,
-/* 3d00 */ NULL,
-/* 3d80 */ NULL,
-/* 3e00 */ NULL,
-/* 3e80 */ NULL,
-/* 3f00 */ NULL,
-/* 3f80 */ NULL,
-/* 4000 */ NULL,
-/* 4080 */ NULL,
-/* 4100 */ NULL,
-/* 4180 */ NULL,
-/* 4200 */ NULL,
-/* 4280 */ NULL,
-/* 4300 */ NULL,
-/* 4380 */ NULL,
-/* 4400 */ NULL,
-/* 4480 */ NULL,
-/* 4500 */ NULL,
-/* 4580 */ NULL,
-/* 4600 */ NULL,
-/* 4680 */ NULL,
-/* 4700 */ NULL,
-/* 4780 */ NULL,
-/* 4800 */ NULL,
-/* 4880 */ NULL,
-/* 4900 */ NULL,
-/* 4980 */ NULL,
-/* 4a00 */ NULL,
-/* 4a80 */ NULL,
-/* 4b00 */ NULL,
-/* 4b80 */ NULL,
-/* 4c00 */ NULL,
-/* 4c80 */ NULL,
-/* 4d00 */ NULL,
-/* 4d80 */ NULL,
 /* 4e00 */ "\x59\xba\x4b\xa0\x00\x00\x53\xde\x00\x00\x00\x00\x00\x00\x57\x93\x5b\x69\x54\xfc\x55\x6f\x58\x62\x5c\xa1\x49\xba\x5a\x8c\x00\x00\x5c\xa3\x4a\x94\x00\x00\x5c\x48\x54\x72\x5c\xa6\x55\xbf\x00\x00\x54\x91\x49\x9c\x59\xb4\x4a\xd3\x4b\xaa\x56\x5f\x5c\xa8\x00\x00\x00\x00\x00\x00\x4b\xa9\x00\x00\x51\x5d\x59\x6f\x00\x00\x55\x45\x5c\xac\x00\x00\x4c\xf5\x59\x5e\x62\x7c\x5b\xcf\x00\x00\x00\x00\x4c\x82\x00\x00\x4a\xad\x00\x00\x51\x79\x00\x00\x5c\xbb\x00\x00\x57\x89\x4b\x44\x57\xa9\x5b\xf6\x00\x00\x50\xf5\x4f\xd8\x5c\xae\x00\x00\x00\x00\x00\x00\x52\xca\x00\x00\x4f\xc2\x00\x00\x5c\xb0\x52\x54\x59\xe4\x00\x00\x5b\xad\x57\xd9\x5b\x47\x4d\xf4\x4c\x46\x50\xd5\x00\x00\x53\xb8\x53\x72\x54\x67\x00\x00\x4d\x74\x00\x00\x4a\x6b\x59\xd1\x00\x00\x00\x00\x5c\xbe\x4f\xc4\x53\xf1\x59\xb1\x58\x50\x58\x88\x00\x00\x00\x00\x00\x00\x00\x00\x55\xe8\x00\x00\x00\x00\x5c\xbf\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x51\xf1\x51\xd1\x00\x00\x54\xe8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x54\x4c\x00\x00",
 /* 4e80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x51\x6b\x00\x00\x5a\x89\x5b\x9a\x00\x00\x55\xc1\x4b\xfd\x5c\xa0\x5a\x7a\x50\x98\x00\x00\x5a\xc5\x4e\x45\x5c\xc0\x57\xe4\x4f\xad\x00\x00\x00\x00\x5c\xa7\x00\x00\x59\x67\x58\xa8\x00\x00\x00\x00\x00\x00\x5c\xbc\x5d\x90\x57\x97\x50\x5a\x00\x00\x4f\x5b\x4d\xa4\x59\xdf\x49\xf9\x4d\xdf\x52\xb5\x00\x00\x58\x8e\x4f\xa8\x57\x44\x51\x61\x00\x00\x00\x00\x00\x00\x54\x77\x5d\x92\x00\x00\x5d\x95\x00\x00\x00\x00\x00\x00\x00\x00\x54\xca\x5c\xe8\x00\x00\x00\x00\x00\x00\x59\xd9\x55\xb1\x54\xc9\x5c\xeb\x5c\xe9\x5c\xc5\x4f\x97\x53\xcc\x4a\x91\x00\x00\x5c\xea\x4f\x92\x4f\x8a\x00\x00\x54\xd3\x4a\xd2\x00\x00\x00\x00\x51\xd7\x00\x00\x49\xd5\x5c\x70\x55\xca\x56\x9c\x5b\x6c\x4c\xb5\x58\x69\x00\x00\x00\x00\x00\x00\x5d\x7a\x5c\xef\x54\x4a\x00\x00\x5c\xed\x00\x00\x4a\xf9\x51\x8f\x59\xd3\x00\x00\x00\x00\x5c\xec\x00\x00\x59\xc6\x5c\xee\x52\x67\x00\x00\x00\x00\x00\x00\x59\x97\x00\x00\x5b\xd8\x5c\xf1\x00\x00\x5c\xf4\x4e\xfd\x4e\xda\x00\x00\x00\x00\x00\x00\x54\xcd\x00\x00\x4c\x7d\x00\x00\x4c\x62",
 /* 4f00 */ "\x00\x00\x53\xf2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x5c\xf7\x59\xc0\x00\x00\x00\x00\x57\xe8\x4e\xbe\x4c\x9d\x4c\x45\x58\xdc\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x5b\xd9\x5a\x65\x4e\x90\x4e\x82\x5c\xf0\x00\x00\x00\x00\x55\x41\x57\xaf\x4a\xaa\x00\x00\x5c\xf2\x00\x00\x55\x6b\x5c\xf5\x51\xd6\x5c\xf6\x00\x00\x00\x00\x57\xb0\x5c\xf8\x00\x00\x00\x00\x00\x00\x49\xad\x4d\x60\x00\x00\x5d\x43\x00\x00\x48\xe8\x00\x00\x51\x87\x00\x00\x55\x8d\x00\x00\x56\x65\x00\x00\x56\x66\x5d\x44\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4b\x89\x00\x00\x00\x00\x4b\x4b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x57\xba\x4b\x6d\x5c\x41\x5c\x95\x5a\x73\x00\x00\x56\xe4\x00\x00\x4d\xcd\x00\x00\x5d\x42\x5d\x7c\x5a\x81\x5c\xfc\x4c\x91\x5c\x98\x5c\xfd\x5c\xf9\x5d\x41\x52\xe2\x00\x00\x00\x00\x5a\x56\x5c\xf3\x5d\x7d\x00\x00\x5c\xfa\x00\x00\x53\x86\x00\x00\x00\x00\x50\xcf\x00\x00\x00\x00\x59\x91\x48\xda\x00\x00\x00\x00\x4e\xd0\x5d\x46\x00\x00\x5d\x45\x00\x00\x00\x00\x00\x00\x00\x00\x5d\x4c\x5d\x4e\x00\x00\x5d\x4b\x55\xb8",
@@ -1389,143 +692,12 @@ static uni16_t uni16[] = {
 /* 9a00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x51\xec\x5a\xa5\x57\x74\x59\x51\x4a\x7b\x54\x9e\x00\x00\x49\xb4\x51\xbe\x63\xdf\x55\xba\x63\xe0\x63\xe1\x4f\xd3\x63\xe2\x5c\x44\x57\x75\x63\xe4\x4e\xdc\x63\xe3",
 /* 9a80 */ "\x63\xe5\x63\xe6\x51\xed\x00\x00\x4f\x5e\x63\xe7\x51\xe5\x4d\xa6\x63\xe8\x00\x00\x63\xe9\x4a\x72\x59\x8a\x00\x00\x00\x00\x50\x45\x63\xea\x53\xee\x63\xeb\x63\xec\x00\x00\x00\x00\x63\xed\x53\xac\x63\xee\x00\x00\x55\x47\x63\xef\x63\xf0\x63\xf1\x63\x59\x63\xf2\x63\xf3\x51\xe1\x63\xf4\x63\xf5\x5b\xe7\x63\xf6\x00\x00\x63\xf7\x4d\x67\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x5b\x6c\x5a\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x5e\x6c\x5c\x4d\xa0\x00\x00\x6c\x5f\x00\x00\x6c\x60\x00\x00\x00\x00\x00\x00\x6c\x62\x6c\x61\x6c\x64\x00\x00\x00\x00\x6c\x63\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x65\x6c\x66\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x67\x00\x00\x56\x89\x00\x00\x00\x00\x00\x00\x00\x00\x4c\xde\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x74\x00\x00\x6c\x75\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x76\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x78\x00\x00\x6c\x7a\x00\x00\x6c\x77\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x7b\x00\x00\x6c\x79\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 9b00 */ "\x00\x00\x00\x00\x00\x00\x5c\x77\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x7c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x7d\x00\x00\x00\x00\x00\x00\x6c\x7e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x7f\x00\x00\x00\x00\x00\x00\x6c\x81\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x5e\x6b\x00\x00\x00\x00\x5c\xa9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x63\x98\x4d\x8e\x00\x00\x00\x00\x00\x00\x00\x00\x50\x9e\x4e\x8b\x6c\x69\x53\xc6\x6c\x68\x00\x00\x6c\x6a\x6c\x6c\x6c\x6b\x00\x00\x00\x00\x00\x00\x6c\x6d\x00\x00\x57\xb9\x00\x00\x6c\x6e\x00\x00\x00\x00\x52\xa6\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 9b80 */ NULL,
 /* 9c00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x5a\x84\x00\x00\x00\x00\x6b\xce",
 /* 9c80 */ "\x00\x00\x51\xb2\x6b\xcf\x00\x00\x00\x00\x6b\xd0\x6b\xd1\x6b\xd2\x6b\xd3\x00\x00\x00\x00\x6b\xd5\x00\x00\x49\x4b\x6b\xd6\x00\x00\x6b\xd7\x6b\xd8\x6b\xd9\x00\x00\x6b\xda\x6b\xdb\x00\x00\x00\x00\x00\x00\x00\x00\x6b\xdc\x6b\xdd\x58\x6a\x00\x00\x6b\xde\x6b\xdf\x6b\xe0\x6b\xe1\x6b\xe2\x6b\xe3\x50\xef\x6b\xe4\x6b\xe5\x6b\xe6\x6b\xe7\x6b\xe8\x00\x00\x6b\xe9\x00\x00\x6b\xea\x6b\xeb\x00\x00\x6b\xec\x6b\xed\x6b\xee\x6b\xef\x6b\xf0\x6b\xf1\x6b\xf2\x6b\xf3\x4f\xa7\x00\x00\x6b\xf4\x6b\xf5\x6b\xf6\x6b\xf7\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x54\xf9\x6b\xf8\x6b\xf9\x6b\xfa\x6b\xfb\x00\x00\x00\x00\x6b\xfc\x6b\xfd\x6c\x41\x6c\x42\x6c\x43\x6c\x44\x6c\x45\x00\x00\x00\x00\x6c\x46\x6c\x47\x6c\x48\x49\x8f\x6c\x49\x6c\x4a\x6c\x4b\x00\x00\x00\x00\x6c\x4c\x6c\x4d\x51\x7b\x6c\x4e\x00\x00\x00\x00\x6c\x4f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 9d00 */ NULL,
-/* 9d80 */ NULL,
 /* 9e00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x52\xf0\x68\xae\x4e\xa5\x68\xaf\x52\x9a\x00\x00\x53\x58\x59\x5b\x00\x00\x68\xb0\x68\xb1\x68\xb2\x68\xb3\x68\xb4\x59\x5c\x00\x00\x59\x8d\x00\x00\x68\xb6\x68\xb5\x5a\xa6\x00\x00\x57\x72\x68\xb7\x68\xb9\x68\xb8\x68\xba\x68\xbb\x00\x00\x00\x00\x4c\xea\x68\xbc\x4d\xe7\x00\x00\x68\xbd\x68\xbe\x4f\xe8\x68\xbf\x4b\xeb\x68\xc0\x68\xc1\x68\xc2\x68\xc3\x54\xb4\x68\xc4\x68\xc5\x00\x00\x68\xc6\x53\x95\x00\x00\x68\xc7\x00\x00\x00\x00\x00\x00\x68\xc8\x00\x00\x68\xc9\x6c\x5d\x00\x00\x68\xca\x68\xcb\x68\xcc\x00\x00\x68\xcd\x00\x00\x00\x00\x00\x00\x00\x00\x68\xce\x4d\xd6\x00\x00\x68\xcf\x68\xd0\x68\xd1\x68\xd2\x68\xd3\x68\xd4\x68\xd5\x68\xd7\x00\x00\x00\x00\x5a\x45\x68\xd6\x00\x00\x68\xd8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6b\x5a\x51\xb8",
 /* 9e80 */ "\x00\x00\x00\x00\x6c\x85\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x86\x6c\x87\x00\x00\x00\x00\x6c\x88\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x89\x51\xb3\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x8b\x00\x00\x6c\x8c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x51\xf2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6a\xef\x00\x00\x00\x00\x00\x00\x6a\xee\x00\x00\x00\x00\x51\xe8\x00\x00\x6c\x82\x6c\x83\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4e\x66\x00\x00\x00\x00\x00\x00\x00\x00\x5d\x85\x00\x00\x00\x00\x00\x00\x55\xf1\x50\xe7\x68\xa3\x00\x00\x4d\xd9\x00\x00\x00\x00\x54\x4d\x00\x00\x00\x00\x00\x00\x52\xab\x00\x00\x00\x00\x6c\x8d\x6c\x8e\x6c\x8f\x00\x00\x6c\x91\x6c\x90\x00\x00\x6c\x92\x00\x00\x00\x00\x6c\x95\x00\x00\x6c\x94\x00\x00\x6c\x93\x6c\x96\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x97\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x67\x8a\x00\x00\x67\x8b\x67\x8c\x00\x00\x6b\xbb\x00\x00",
 /* 9f00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6b\xbc\x00\x00\x6b\xbd\x4b\xa5\x00\x00\x5c\xbd\x00\x00\x00\x00\x4d\x64\x00\x00\x00\x00\x00\x00\x5c\xba\x00\x00\x5e\xb0\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x55\xf2\x00\x00\x6c\x98\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x99\x00\x00\x00\x00\x6c\x9a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x9c\x00\x00\x6c\x9b\x00\x00\x49\x67\x00\x00\x6c\x9d\x6c\x9e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x6c\x9f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x53\xea\x66\xb3\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4a\x7d",
 /* 9f80 */ "\x6b\xb2\x00\x00\x00\x00\x6b\xb3\x51\x85\x6b\xb4\x6b\xb5\x6b\xb6\x6b\xb7\x6b\xb8\x6b\xb9\x54\xa2\x6b\xba\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x51\x9b\x4d\x48\x67\x89\x00\x00\x00\x00\x00\x00\x4d\x8b\x5d\x7f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* a000 */ NULL,
-/* a080 */ NULL,
-/* a100 */ NULL,
-/* a180 */ NULL,
-/* a200 */ NULL,
-/* a280 */ NULL,
-/* a300 */ NULL,
-/* a380 */ NULL,
-/* a400 */ NULL,
-/* a480 */ NULL,
-/* a500 */ NULL,
-/* a580 */ NULL,
-/* a600 */ NULL,
-/* a680 */ NULL,
-/* a700 */ NULL,
-/* a780 */ NULL,
-/* a800 */ NULL,
-/* a880 */ NULL,
-/* a900 */ NULL,
-/* a980 */ NULL,
-/* aa00 */ NULL,
-/* aa80 */ NULL,
-/* ab00 */ NULL,
-/* ab80 */ NULL,
-/* ac00 */ NULL,
-/* ac80 */ NULL,
-/* ad00 */ NULL,
-/* ad80 */ NULL,
-/* ae00 */ NULL,
-/* ae80 */ NULL,
-/* af00 */ NULL,
-/* af80 */ NULL,
-/* b000 */ NULL,
-/* b080 */ NULL,
-/* b100 */ NULL,
-/* b180 */ NULL,
-/* b200 */ NULL,
-/* b280 */ NULL,
-/* b300 */ NULL,
-/* b380 */ NULL,
-/* b400 */ NULL,
-/* b480 */ NULL,
-/* b500 */ NULL,
-/* b580 */ NULL,
-/* b600 */ NULL,
-/* b680 */ NULL,
-/* b700 */ NULL,
-/* b780 */ NULL,
-/* b800 */ NULL,
-/* b880 */ NULL,
-/* b900 */ NULL,
-/* b980 */ NULL,
-/* ba00 */ NULL,
-/* ba80 */ NULL,
-/* bb00 */ NULL,
-/* bb80 */ NULL,
-/* bc00 */ NULL,
-/* bc80 */ NULL,
-/* bd00 */ NULL,
-/* bd80 */ NULL,
-/* be00 */ NULL,
-/* be80 */ NULL,
-/* bf00 */ NULL,
-/* bf80 */ NULL,
-/* c000 */ NULL,
-/* c080 */ NULL,
-/* c100 */ NULL,
-/* c180 */ NULL,
-/* c200 */ NULL,
-/* c280 */ NULL,
-/* c300 */ NULL,
-/* c380 */ NULL,
-/* c400 */ NULL,
-/* c480 */ NULL,
-/* c500 */ NULL,
-/* c580 */ NULL,
-/* c600 */ NULL,
-/* c680 */ NULL,
-/* c700 */ NULL,
-/* c780 */ NULL,
-/* c800 */ NULL,
-/* c880 */ NULL,
-/* c900 */ NULL,
-/* c980 */ NULL,
-/* ca00 */ NULL,
-/* ca80 */ NULL,
-/* cb00 */ NULL,
-/* cb80 */ NULL,
-/* cc00 */ NULL,
-/* cc80 */ NULL,
-/* cd00 */ NULL,
-/* cd80 */ NULL,
-/* ce00 */ NULL,
-/* ce80 */ NULL,
-/* cf00 */ NULL,
-/* cf80 */ NULL,
-/* d000 */ NULL,
-/* d080 */ NULL,
-/* d100 */ NULL,
-/* d180 */ NULL,
-/* d200 */ NULL,
-/* d280 */ NULL,
-/* d300 */ NULL,
-/* d380 */ NULL,
-/* d400 */ NULL,
-/* d480 */ NULL,
-/* d500 */ NULL,
-/* d580 */ NULL,
-/* d600 */ NULL,
-/* d680 */ NULL,
-/* d700 */ NULL,
-/* d780 */ NULL,
-/* d800 */ NULL,
-/* d880 */ NULL,
-/* d900 */ NULL,
-/* d980 */ NULL,
-/* da00 */ NULL,
-/* da80 */ NULL,
-/* db00 */ NULL,
-/* db80 */ NULL,
-/* dc00 */ NULL,
-/* dc80 */ NULL,
-/* dd00 */ NULL,
-/* dd80 */ NULL,
-/* de00 */ NULL,
-/* de80 */ NULL,
-/* df00 */ NULL,
-/* df80 */ NULL,
 /* e000 */ "\x76\x41\x76\x42\x76\x43\x76\x44\x76\x45\x76\x46\x76\x47\x76\x48\x76\x49\x76\x4a\x76\x4b\x76\x4c\x76\x4d\x76\x4e\x76\x4f\x76\x50\x76\x51\x76\x52\x76\x53\x76\x54\x76\x55\x76\x56\x76\x57\x76\x58\x76\x59\x76\x5a\x76\x5b\x76\x5c\x76\x5d\x76\x5e\x76\x5f\x76\x60\x76\x61\x76\x62\x76\x63\x76\x64\x76\x65\x76\x66\x76\x67\x76\x68\x76\x69\x76\x6a\x76\x6b\x76\x6c\x76\x6d\x76\x6e\x76\x6f\x76\x70\x76\x71\x76\x72\x76\x73\x76\x74\x76\x75\x76\x76\x76\x77\x76\x78\x76\x79\x76\x7a\x76\x7b\x76\x7c\x76\x7d\x76\x7e\x76\x7f\x76\x81\x76\x82\x76\x83\x76\x84\x76\x85\x76\x86\x76\x87\x76\x88\x76\x89\x76\x8a\x76\x8b\x76\x8c\x76\x8d\x76\x8e\x76\x8f\x76\x90\x76\x91\x76\x92\x76\x93\x76\x94\x76\x95\x76\x96\x76\x97\x76\x98\x76\x99\x76\x9a\x76\x9b\x76\x9c\x76\x9d\x76\x9e\x76\x9f\x76\xa0\x76\xa1\x76\xa2\x76\xa3\x76\xa4\x76\xa5\x76\xa6\x76\xa7\x76\xa8\x76\xa9\x76\xaa\x76\xab\x76\xac\x76\xad\x76\xae\x76\xaf\x76\xb0\x76\xb1\x76\xb2\x76\xb3\x76\xb4\x76\xb5\x76\xb6\x76\xb7\x76\xb8\x76\xb9\x76\xba\x76\xbb\x76\xbc\x76\xbd\x76\xbe\x76\xbf\x76\xc0\x76\xc1",
 /* e080 */ "\x76\xc2\x76\xc3\x76\xc4\x76\xc5\x76\xc6\x76\xc7\x76\xc8\x76\xc9\x76\xca\x76\xcb\x76\xcc\x76\xcd\x76\xce\x76\xcf\x76\xd0\x76\xd1\x76\xd2\x76\xd3\x76\xd4\x76\xd5\x76\xd6\x76\xd7\x76\xd8\x76\xd9\x76\xda\x76\xdb\x76\xdc\x76\xdd\x76\xde\x76\xdf\x76\xe0\x76\xe1\x76\xe2\x76\xe3\x76\xe4\x76\xe5\x76\xe6\x76\xe7\x76\xe8\x76\xe9\x76\xea\x76\xeb\x76\xec\x76\xed\x76\xee\x76\xef\x76\xf0\x76\xf1\x76\xf2\x76\xf3\x76\xf4\x76\xf5\x76\xf6\x76\xf7\x76\xf8\x76\xf9\x76\xfa\x76\xfb\x76\xfc\x76\xfd\x77\x41\x77\x42\x77\x43\x77\x44\x77\x45\x77\x46\x77\x47\x77\x48\x77\x49\x77\x4a\x77\x4b\x77\x4c\x77\x4d\x77\x4e\x77\x4f\x77\x50\x77\x51\x77\x52\x77\x53\x77\x54\x77\x55\x77\x56\x77\x57\x77\x58\x77\x59\x77\x5a\x77\x5b\x77\x5c\x77\x5d\x77\x5e\x77\x5f\x77\x60\x77\x61\x77\x62\x77\x63\x77\x64\x77\x65\x77\x66\x77\x67\x77\x68\x77\x69\x77\x6a\x77\x6b\x77\x6c\x77\x6d\x77\x6e\x77\x6f\x77\x70\x77\x71\x77\x72\x77\x73\x77\x74\x77\x75\x77\x76\x77\x77\x77\x78\x77\x79\x77\x7a\x77\x7b\x77\x7c\x77\x7d\x77\x7e\x77\x7f\x77\x81\x77\x82\x77\x83\x77\x84\x77\x85",
 /* e100 */ "\x77\x86\x77\x87\x77\x88\x77\x89\x77\x8a\x77\x8b\x77\x8c\x77\x8d\x77\x8e\x77\x8f\x77\x90\x77\x91\x77\x92\x77\x93\x77\x94\x77\x95\x77\x96\x77\x97\x77\x98\x77\x99\x77\x9a\x77\x9b\x77\x9c\x77\x9d\x77\x9e\x77\x9f\x77\xa0\x77\xa1\x77\xa2\x77\xa3\x77\xa4\x77\xa5\x77\xa6\x77\xa7\x77\xa8\x77\xa9\x77\xaa\x77\xab\x77\xac\x77\xad\x77\xae\x77\xaf\x77\xb0\x77\xb1\x77\xb2\x77\xb3\x77\xb4\x77\xb5\x77\xb6\x77\xb7\x77\xb8\x77\xb9\x77\xba\x77\xbb\x77\xbc\x77\xbd\x77\xbe\x77\xbf\x77\xc0\x77\xc1\x77\xc2\x77\xc3\x77\xc4\x77\xc5\x77\xc6\x77\xc7\x77\xc8\x77\xc9\x77\xca\x77\xcb\x77\xcc\x77\xcd\x77\xce\x77\xcf\x77\xd0\x77\xd1\x77\xd2\x77\xd3\x77\xd4\x77\xd5\x77\xd6\x77\xd7\x77\xd8\x77\xd9\x77\xda\x77\xdb\x77\xdc\x77\xdd\x77\xde\x77\xdf\x77\xe0\x77\xe1\x77\xe2\x77\xe3\x77\xe4\x77\xe5\x77\xe6\x77\xe7\x77\xe8\x77\xe9\x77\xea\x77\xeb\x77\xec\x77\xed\x77\xee\x77\xef\x77\xf0\x77\xf1\x77\xf2\x77\xf3\x77\xf4\x77\xf5\x77\xf6\x77\xf7\x77\xf8\x77\xf9\x77\xfa\x77\xfb\x77\xfc\x77\xfd\x78\x41\x78\x42\x78\x43\x78\x44\x78\x45\x78\x46\x78\x47\x78\x48",
@@ -1541,186 +713,48 @@ static uni16_t uni16[] = {
 /* e600 */ "\x7e\x61\x7e\x62\x7e\x63\x7e\x64\x7e\x65\x7e\x66\x7e\x67\x7e\x68\x7e\x69\x7e\x6a\x7e\x6b\x7e\x6c\x7e\x6d\x7e\x6e\x7e\x6f\x7e\x70\x7e\x71\x7e\x72\x7e\x73\x7e\x74\x7e\x75\x7e\x76\x7e\x77\x7e\x78\x7e\x79\x7e\x7a\x7e\x7b\x7e\x7c\x7e\x7d\x7e\x7e\x7e\x7f\x7e\x81\x7e\x82\x7e\x83\x7e\x84\x7e\x85\x7e\x86\x7e\x87\x7e\x88\x7e\x89\x7e\x8a\x7e\x8b\x7e\x8c\x7e\x8d\x7e\x8e\x7e\x8f\x7e\x90\x7e\x91\x7e\x92\x7e\x93\x7e\x94\x7e\x95\x7e\x96\x7e\x97\x7e\x98\x7e\x99\x7e\x9a\x7e\x9b\x7e\x9c\x7e\x9d\x7e\x9e\x7e\x9f\x7e\xa0\x7e\xa1\x7e\xa2\x7e\xa3\x7e\xa4\x7e\xa5\x7e\xa6\x7e\xa7\x7e\xa8\x7e\xa9\x7e\xaa\x7e\xab\x7e\xac\x7e\xad\x7e\xae\x7e\xaf\x7e\xb0\x7e\xb1\x7e\xb2\x7e\xb3\x7e\xb4\x7e\xb5\x7e\xb6\x7e\xb7\x7e\xb8\x7e\xb9\x7e\xba\x7e\xbb\x7e\xbc\x7e\xbd\x7e\xbe\x7e\xbf\x7e\xc0\x7e\xc1\x7e\xc2\x7e\xc3\x7e\xc4\x7e\xc5\x7e\xc6\x7e\xc7\x7e\xc8\x7e\xc9\x7e\xca\x7e\xcb\x7e\xcc\x7e\xcd\x7e\xce\x7e\xcf\x7e\xd0\x7e\xd1\x7e\xd2\x7e\xd3\x7e\xd4\x7e\xd5\x7e\xd6\x7e\xd7\x7e\xd8\x7e\xd9\x7e\xda\x7e\xdb\x7e\xdc\x7e\xdd\x7e\xde\x7e\xdf\x7e\xe0\x7e\xe1",
 /* e680 */ "\x7e\xe2\x7e\xe3\x7e\xe4\x7e\xe5\x7e\xe6\x7e\xe7\x7e\xe8\x7e\xe9\x7e\xea\x7e\xeb\x7e\xec\x7e\xed\x7e\xee\x7e\xef\x7e\xf0\x7e\xf1\x7e\xf2\x7e\xf3\x7e\xf4\x7e\xf5\x7e\xf6\x7e\xf7\x7e\xf8\x7e\xf9\x7e\xfa\x7e\xfb\x7e\xfc\x7e\xfd\x7f\x41\x7f\x42\x7f\x43\x7f\x44\x7f\x45\x7f\x46\x7f\x47\x7f\x48\x7f\x49\x7f\x4a\x7f\x4b\x7f\x4c\x7f\x4d\x7f\x4e\x7f\x4f\x7f\x50\x7f\x51\x7f\x52\x7f\x53\x7f\x54\x7f\x55\x7f\x56\x7f\x57\x7f\x58\x7f\x59\x7f\x5a\x7f\x5b\x7f\x5c\x7f\x5d\x7f\x5e\x7f\x5f\x7f\x60\x7f\x61\x7f\x62\x7f\x63\x7f\x64\x7f\x65\x7f\x66\x7f\x67\x7f\x68\x7f\x69\x7f\x6a\x7f\x6b\x7f\x6c\x7f\x6d\x7f\x6e\x7f\x6f\x7f\x70\x7f\x71\x7f\x72\x7f\x73\x7f\x74\x7f\x75\x7f\x76\x7f\x77\x7f\x78\x7f\x79\x7f\x7a\x7f\x7b\x7f\x7c\x7f\x7d\x7f\x7e\x7f\x7f\x7f\x81\x7f\x82\x7f\x83\x7f\x84\x7f\x85\x7f\x86\x7f\x87\x7f\x88\x7f\x89\x7f\x8a\x7f\x8b\x7f\x8c\x7f\x8d\x7f\x8e\x7f\x8f\x7f\x90\x7f\x91\x7f\x92\x7f\x93\x7f\x94\x7f\x95\x7f\x96\x7f\x97\x7f\x98\x7f\x99\x7f\x9a\x7f\x9b\x7f\x9c\x7f\x9d\x7f\x9e\x7f\x9f\x7f\xa0\x7f\xa1\x7f\xa2\x7f\xa3\x7f\xa4\x7f\xa5",
 /* e700 */ "\x7f\xa6\x7f\xa7\x7f\xa8\x7f\xa9\x7f\xaa\x7f\xab\x7f\xac\x7f\xad\x7f\xae\x7f\xaf\x7f\xb0\x7f\xb1\x7f\xb2\x7f\xb3\x7f\xb4\x7f\xb5\x7f\xb6\x7f\xb7\x7f\xb8\x7f\xb9\x7f\xba\x7f\xbb\x7f\xbc\x7f\xbd\x7f\xbe\x7f\xbf\x7f\xc0\x7f\xc1\x7f\xc2\x7f\xc3\x7f\xc4\x7f\xc5\x7f\xc6\x7f\xc7\x7f\xc8\x7f\xc9\x7f\xca\x7f\xcb\x7f\xcc\x7f\xcd\x7f\xce\x7f\xcf\x7f\xd0\x7f\xd1\x7f\xd2\x7f\xd3\x7f\xd4\x7f\xd5\x7f\xd6\x7f\xd7\x7f\xd8\x7f\xd9\x7f\xda\x7f\xdb\x7f\xdc\x7f\xdd\x7f\xde\x7f\xdf\x7f\xe0\x7f\xe1\x7f\xe2\x7f\xe3\x7f\xe4\x7f\xe5\x7f\xe6\x7f\xe7\x7f\xe8\x7f\xe9\x7f\xea\x7f\xeb\x7f\xec\x7f\xed\x7f\xee\x7f\xef\x7f\xf0\x7f\xf1\x7f\xf2\x7f\xf3\x7f\xf4\x7f\xf5\x7f\xf6\x7f\xf7\x7f\xf8\x7f\xf9\x7f\xfa\x7f\xfb\x7f\xfc\x7f\xfd\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* e780 */ NULL,
-/* e800 */ NULL,
-/* e880 */ NULL,
-/* e900 */ NULL,
-/* e980 */ NULL,
-/* ea00 */ NULL,
-/* ea80 */ NULL,
-/* eb00 */ NULL,
-/* eb80 */ NULL,
-/* ec00 */ NULL,
-/* ec80 */ NULL,
-/* ed00 */ NULL,
-/* ed80 */ NULL,
-/* ee00 */ NULL,
-/* ee80 */ NULL,
-/* ef00 */ NULL,
-/* ef80 */ NULL,
-/* f000 */ NULL,
-/* f080 */ NULL,
-/* f100 */ NULL,
-/* f180 */ NULL,
-/* f200 */ NULL,
-/* f280 */ NULL,
-/* f300 */ NULL,
-/* f380 */ NULL,
-/* f400 */ NULL,
-/* f480 */ NULL,
-/* f500 */ NULL,
-/* f580 */ NULL,
-/* f600 */ NULL,
-/* f680 */ NULL,
-/* f700 */ NULL,
-/* f780 */ NULL,
 /* f800 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x5b\x44\x5c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* f880 */ NULL,
-/* f900 */ NULL,
-/* f980 */ NULL,
-/* fa00 */ NULL,
-/* fa80 */ NULL,
-/* fb00 */ NULL,
-/* fb80 */ NULL,
-/* fc00 */ NULL,
-/* fc80 */ NULL,
-/* fd00 */ NULL,
-/* fd80 */ NULL,
-/* fe00 */ NULL,
-/* fe80 */ NULL,
 /* ff00 */ "\x00\x00\x42\x5a\x42\x7f\x42\x7b\x42\xe0\x42\x6c\x42\x50\x42\x7d\x42\x4d\x42\x5d\x42\x5c\x42\x4e\x42\x6b\x42\x60\x42\x4b\x42\x61\x42\xf0\x42\xf1\x42\xf2\x42\xf3\x42\xf4\x42\xf5\x42\xf6\x42\xf7\x42\xf8\x42\xf9\x42\x7a\x42\x5e\x42\x4c\x42\x7e\x42\x6e\x42\x6f\x42\x7c\x42\xc1\x42\xc2\x42\xc3\x42\xc4\x42\xc5\x42\xc6\x42\xc7\x42\xc8\x42\xc9\x42\xd1\x42\xd2\x42\xd3\x42\xd4\x42\xd5\x42\xd6\x42\xd7\x42\xd8\x42\xd9\x42\xe2\x42\xe3\x42\xe4\x42\xe5\x42\xe6\x42\xe7\x42\xe8\x42\xe9\x44\x44\x43\xe0\x44\x45\x44\x70\x42\x6d\x42\x79\x42\x81\x42\x82\x42\x83\x42\x84\x42\x85\x42\x86\x42\x87\x42\x88\x42\x89\x42\x91\x42\x92\x42\x93\x42\x94\x42\x95\x42\x96\x42\x97\x42\x98\x42\x99\x42\xa2\x42\xa3\x42\xa4\x42\xa5\x42\xa6\x42\xa7\x42\xa8\x42\xa9\x42\xc0\x42\x4f\x42\xd0\x43\xa1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* ff80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x4a\x42\x4a\x42\x5f\x42\xa1\x42\x6a\x42\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-/* EBCDIC DBCS to Unicode translation table for ibm-837_P100-2000 */ {
-/* 0000 */ NULL,
-/* 0080 */ NULL,
-/* 0100 */ NULL,
-/* 0180 */ NULL,
-/* 0200 */ NULL,
-/* 0280 */ NULL,
-/* 0300 */ NULL,
-/* 0380 */ NULL,
-/* 0400 */ NULL,
-/* 0480 */ NULL,
-/* 0500 */ NULL,
-/* 0580 */ NULL,
-/* 0600 */ NULL,
-/* 0680 */ NULL,
-/* 0700 */ NULL,
-/* 0780 */ NULL,
-/* 0800 */ NULL,
-/* 0880 */ NULL,
-/* 0900 */ NULL,
-/* 0980 */ NULL,
-/* 0a00 */ NULL,
-/* 0a80 */ NULL,
-/* 0b00 */ NULL,
-/* 0b80 */ NULL,
-/* 0c00 */ NULL,
-/* 0c80 */ NULL,
-/* 0d00 */ NULL,
-/* 0d80 */ NULL,
-/* 0e00 */ NULL,
-/* 0e80 */ NULL,
-/* 0f00 */ NULL,
-/* 0f80 */ NULL,
-/* 1000 */ NULL,
-/* 1080 */ NULL,
-/* 1100 */ NULL,
-/* 1180 */ NULL,
-/* 1200 */ NULL,
-/* 1280 */ NULL,
-/* 1300 */ NULL,
-/* 1380 */ NULL,
-/* 1400 */ NULL,
-/* 1480 */ NULL,
-/* 1500 */ NULL,
-/* 1580 */ NULL,
-/* 1600 */ NULL,
-/* 1680 */ NULL,
-/* 1700 */ NULL,
-/* 1780 */ NULL,
-/* 1800 */ NULL,
-/* 1880 */ NULL,
-/* 1900 */ NULL,
-/* 1980 */ NULL,
-/* 1a00 */ NULL,
-/* 1a80 */ NULL,
-/* 1b00 */ NULL,
-/* 1b80 */ NULL,
-/* 1c00 */ NULL,
-/* 1c80 */ NULL,
-/* 1d00 */ NULL,
-/* 1d80 */ NULL,
-/* 1e00 */ NULL,
-/* 1e80 */ NULL,
-/* 1f00 */ NULL,
-/* 1f80 */ NULL,
-/* 2000 */ NULL,
-/* 2080 */ NULL,
-/* 2100 */ NULL,
-/* 2180 */ NULL,
-/* 2200 */ NULL,
-/* 2280 */ NULL,
-/* 2300 */ NULL,
-/* 2380 */ NULL,
-/* 2400 */ NULL,
-/* 2480 */ NULL,
-/* 2500 */ NULL,
-/* 2580 */ NULL,
-/* 2600 */ NULL,
-/* 2680 */ NULL,
-/* 2700 */ NULL,
-/* 2780 */ NULL,
-/* 2800 */ NULL,
-/* 2880 */ NULL,
-/* 2900 */ NULL,
-/* 2980 */ NULL,
-/* 2a00 */ NULL,
-/* 2a80 */ NULL,
-/* 2b00 */ NULL,
-/* 2b80 */ NULL,
-/* 2c00 */ NULL,
-/* 2c80 */ NULL,
-/* 2d00 */ NULL,
-/* 2d80 */ NULL,
-/* 2e00 */ NULL,
-/* 2e80 */ NULL,
-/* 2f00 */ NULL,
-/* 2f80 */ NULL,
-/* 3000 */ NULL,
-/* 3080 */ NULL,
-/* 3100 */ NULL,
-/* 3180 */ NULL,
-/* 3200 */ NULL,
-/* 3280 */ NULL,
-/* 3300 */ NULL,
-/* 3380 */ NULL,
-/* 3400 */ NULL,
-/* 3480 */ NULL,
-/* 3500 */ NULL,
-/* 3580 */ NULL,
-/* 3600 */ NULL,
-/* 3680 */ NULL,
-/* 3700 */ NULL,
-/* 3780 */ NULL,
-/* 3800 */ NULL,
-/* 3880 */ NULL,
-/* 3900 */ NULL,
-/* 3980 */ NULL,
-/* 3a00 */ NULL,
-/* 3a80 */ NULL,
-/* 3b00 */ NULL,
-/* 3b80 */ NULL,
-/* 3c00 */ NULL,
-/* 3c80 */ NULL,
-/* 3d00 */ NULL,
-/* 3d80 */ NULL,
-/* 3e00 */ NULL,
-/* 3e80 */ NULL,
-/* 3f00 */ NULL,
-/* 3f80 */ NULL,
+/* ff80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x4a\x42\x4a\x42\x5f\x42\xa1\x42\x6a\x42\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+/* EBCDIC DBCS to Unicode translation table for ibm-837_P100-2000 */
+static const unsigned short cp935_ebc2u_ix[512] = {
+/* 0000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 0800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 4000 */ 1, 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 0, 0,
+/* 4800 */ 0, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28,
+/* 5000 */ 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44,
+/* 5800 */ 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60,
+/* 6000 */ 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76,
+/* 6800 */ 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 0, 0, 0, 0, 0, 0,
+/* 7000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 88, 89, 90,
+/* 7800 */ 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
+/* 8000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 8800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 9000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 9800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* a000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* a800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* e000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* e800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* f000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* f800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const uni16_row_t cp935_ebc2u[] = {
 /* 4000 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x30\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 4080 */ NULL,
 /* 4100 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\xb1\x03\xb2\x03\xb3\x03\xb4\x03\xb5\x03\xb6\x03\xb7\x03\xb8\x03\xb9\x03\xba\x03\xbb\x03\xbc\x03\xbd\x03\xbe\x03\xbf\x03\xc0\x03\xc1\x03\xc3\x03\xc4\x03\xc5\x03\xc6\x03\xc7\x03\xc8\x03\xc9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\x91\x03\x92\x03\x93\x03\x94\x03\x95\x03\x96\x03\x97\x03\x98\x03\x99\x03\x9a\x03\x9b\x03\x9c\x03\x9d\x03\x9e\x03\x9f\x03\xa0\x03\xa1\x03\xa3\x03\xa4\x03\xa5\x03\xa6\x03\xa7\x03\xa8\x03\xa9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 4180 */ "\x04\x30\x04\x31\x04\x32\x04\x33\x04\x34\x04\x35\x04\x51\x04\x36\x04\x37\x04\x38\x04\x39\x04\x3a\x04\x3b\x04\x3c\x04\x3d\x04\x3e\x04\x3f\x04\x40\x04\x41\x04\x42\x04\x43\x04\x44\x04\x45\x04\x46\x04\x47\x04\x48\x04\x49\x04\x4a\x04\x4b\x04\x4c\x04\x4d\x04\x4e\x04\x4f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x21\x70\x21\x71\x21\x72\x21\x73\x21\x74\x21\x75\x21\x76\x21\x77\x21\x78\x21\x79\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x04\x10\x04\x11\x04\x12\x04\x13\x04\x14\x04\x15\x04\x01\x04\x16\x04\x17\x04\x18\x04\x19\x04\x1a\x04\x1b\x04\x1c\x04\x1d\x04\x1e\x04\x1f\x04\x20\x04\x21\x04\x22\x04\x23\x04\x24\x04\x25\x04\x26\x04\x27\x04\x28\x04\x29\x04\x2a\x04\x2b\x04\x2c\x04\x2d\x04\x2e\x04\x2f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x21\x60\x21\x61\x21\x62\x21\x63\x21\x64\x21\x65\x21\x66\x21\x67\x21\x68\x21\x69\x21\x6a\x21\x6b\x00\x00\x00\x00\x00\x00",
 /* 4200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xe1\xff\x0e\xff\x1c\xff\x08\xff\x0b\xff\x5c\xff\x06\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x01\xff\xe5\xff\x0a\xff\x09\xff\x1b\xff\xe2\xff\x0d\xff\x0f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xe4\xff\x0c\xff\x05\xff\x3f\xff\x1e\xff\x1f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x40\xff\x1a\xff\x03\xff\x20\xff\x07\xff\x1d\xff\x02",
@@ -1733,9 +767,6 @@ static uni16_t uni16[] = {
 /* 4580 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xa4\x00\x00\x00\x00\x20\x30\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x24\x88\x24\x89\x24\x8a\x24\x8b\x24\x8c\x24\x8d\x24\x8e\x24\x8f\x24\x90\x24\x91\x24\x92\x24\x93\x24\x94\x24\x95\x24\x96\x24\x97\x24\x98\x24\x99\x24\x9a\x24\x9b\x24\x74\x24\x75\x24\x76\x24\x77\x24\x78\x24\x79\x24\x7a\x24\x7b\x24\x7c\x24\x7d\x24\x7e\x24\x7f\x24\x80\x24\x81\x24\x82\x24\x83\x24\x84\x24\x85\x24\x86\x24\x87\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x24\x60\x24\x61\x24\x62\x24\x63\x24\x64\x24\x65\x24\x66\x24\x67\x24\x68\x24\x69\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x32\x20\x32\x21\x32\x22\x32\x23\x32\x24\x32\x25\x32\x26\x32\x27\x32\x28\x32\x29\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 4600 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x01\x01\x00\xe1\x01\xce\x00\xe0\x01\x13\x00\xe9\x01\x1b\x00\xe8\x01\x2b\x00\xed\x01\xd0\x00\xec\x01\x4d\x00\xf3\x01\xd2\x00\xf2\x01\x6b\x00\xfa\x01\xd4\x00\xf9\x01\xd6\x01\xd8\x01\xda\x01\xdc\x00\xfc\x00\xea\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x31\x05\x31\x06\x31\x07\x31\x08\x31\x09\x31\x0a\x31\x0b\x31\x0c\x31\x0d\x31\x0e\x31\x0f\x31\x10\x31\x11\x31\x12\x31\x13\x31\x14\x31\x15\x31\x16\x31\x17\x31\x18\x31\x19\x31\x1a\x31\x1b\x31\x1c\x31\x1d\x31\x1e\x31\x1f",
 /* 4680 */ "\x31\x20\x31\x21\x31\x22\x31\x23\x31\x24\x31\x25\x31\x26\x31\x27\x31\x28\x31\x29\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x25\x00\x25\x01\x25\x02\x25\x03\x25\x04\x25\x05\x25\x06\x25\x07\x25\x08\x25\x09\x25\x0a\x25\x0b\x25\x0c\x25\x0d\x25\x0e\x25\x0f\x25\x10\x25\x11\x25\x12\x25\x13\x25\x14\x25\x15\x25\x16\x25\x17\x25\x18\x25\x19\x25\x1a\x25\x1b\x25\x1c\x25\x1d\x25\x1e\x25\x1f\x25\x20\x25\x21\x25\x22\x25\x23\x25\x24\x25\x25\x25\x26\x25\x27\x25\x28\x25\x29\x25\x2a\x25\x2b\x25\x2c\x25\x2d\x25\x2e\x25\x2f\x25\x30\x25\x31\x25\x32\x25\x33\x25\x34\x25\x35\x25\x36\x25\x37\x25\x38\x25\x39\x25\x3a\x25\x3b\x25\x3c\x25\x3d\x25\x3e\x25\x3f\x25\x40\x25\x41\x25\x42\x25\x43\x25\x44\x25\x45\x25\x46\x25\x47\x25\x48\x25\x49\x25\x4a\x25\x4b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 4700 */ NULL,
-/* 4780 */ NULL,
-/* 4800 */ NULL,
 /* 4880 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x55\x4a\x96\x3f\x57\xc3\x63\x28\x54\xce\x55\x09\x54\xc0\x76\x91\x76\x4c\x85\x3c\x77\xee\x82\x7e\x78\x8d\x72\x31\x96\x98\x97\x8d\x6c\x28\x5b\x89\x4f\xfa\x63\x09\x66\x97\x5c\xb8\x80\xfa\x68\x48\x80\xae\x66\x02\x76\xce\x51\xf9\x65\x56\x71\xac\x7f\xf1\x88\x84\x50\xb2\x59\x65\x61\xca\x6f\xb3\x82\xad\x63\x4c\x62\x52\x53\xed\x54\x27\x7b\x06\x51\x6b\x75\xa4\x5d\xf4\x62\xd4\x8d\xcb\x97\x76\x62\x8a\x80\x19\x57\x5d\x97\x38\x7f\x62\x72\x38\x76\x7d\x67\xcf\x76\x7e\x64\x46\x4f\x70\x8d\x25\x62\xdc\x7a\x17\x65\x91\x73\xed\x64\x2c\x62\x73\x82\x2c\x98\x81\x67\x7f\x72\x48\x62\x6e\x62\xcc\x4f\x34\x74\xe3\x53\x4a\x52\x9e\x7e\xca\x90\xa6\x5e\x2e\x68\x86\x69\x9c\x81\x80\x7e\xd1\x68\xd2\x78\xc5\x86\x8c\x95\x51\x50\x8d\x8c\x24\x82\xde\x80\xde\x53\x05\x89\x12\x52\x65\x00\x00\x00\x00",
 /* 4900 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x85\x84\x96\xf9\x4f\xdd\x58\x21\x99\x71\x5b\x9d\x62\xb1\x62\xa5\x66\xb4\x8c\x79\x9c\x8d\x72\x06\x67\x6f\x78\x91\x60\xb2\x53\x51\x53\x17\x8f\x88\x80\xcc\x8d\x1d\x94\xa1\x50\x0d\x72\xc8\x59\x07\x60\xeb\x71\x19\x88\xab\x59\x54\x82\xef\x67\x2c\x7b\x28\x5d\x29\x7e\xf7\x75\x2d\x6c\xf5\x8e\x66\x8f\xf8\x90\x3c\x9f\x3b\x6b\xd4\x91\x19\x7b\x14\x5f\x7c\x78\xa7\x84\xd6\x85\x3d\x6b\xd5\x6b\xd9\x6b\xd6\x5e\x01\x5e\x87\x75\xf9\x95\xed\x65\x5d\x5f\x0a\x5f\xc5\x8f\x9f\x58\xc1\x81\xc2\x90\x7f\x96\x5b\x97\xad\x8f\xb9",
 /* 4980 */ "\x00\x00\x7f\x16\x8d\x2c\x62\x41\x4f\xbf\x53\xd8\x53\x5e\x8f\xa8\x8f\xa9\x8f\xab\x90\x4d\x68\x07\x5f\x6a\x81\x98\x88\x68\x9c\xd6\x61\x8b\x52\x2b\x76\x2a\x5f\x6c\x65\x8c\x6f\xd2\x6e\xe8\x5b\xbe\x64\x48\x51\x75\x51\xb0\x67\xc4\x4e\x19\x79\xc9\x99\x7c\x70\xb3\x75\xc5\x5e\x76\x73\xbb\x83\xe0\x64\xad\x62\xe8\x94\xb5\x6c\xe2\x53\x5a\x52\xc3\x64\x0f\x94\xc2\x7b\x94\x4f\x2f\x5e\x1b\x82\x36\x81\x16\x81\x8a\x6e\x24\x6c\xca\x9a\x73\x63\x55\x53\x5c\x54\xfa\x88\x65\x57\xe0\x4e\x0d\x5e\x03\x6b\x65\x7c\x3f\x90\xe8\x60\x16\x64\xe6\x73\x1c\x88\xc1\x67\x50\x62\x4d\x8d\x22\x77\x6c\x8e\x29\x91\xc7\x5f\x69\x83\xdc\x85\x21\x99\x10\x53\xc2\x86\x95\x6b\x8b\x60\xed\x60\xe8\x70\x7f\x82\xcd\x82\x31\x4e\xd3\x6c\xa7\x85\xcf\x64\xcd\x7c\xd9\x69\xfd\x66\xf9\x83\x49\x53\x95\x7b\x56\x4f\xa7\x51\x8c\x6d\x4b\x5c\x42\x8e\x6d\x63\xd2\x53\xc9\x83\x2c\x83\x36\x67\xe5\x78\xb4\x64\x3d\x5b\xdf\x5c\x94\x5d\xee\x8b\xe7\x62\xc6\x67\xf4\x8c\x7a\x64\x00\x63\xba\x87\x49\x99\x8b\x8c\x17\x7f\x20\x94\xf2\x4e\xa7\x96\x10\x98\xa4\x66\x0c\x73\x16\x00\x00\x00\x00",
@@ -1809,24 +840,6 @@ static uni16_t uni16[] = {
 /* 6b80 */ "\x00\x00\x8e\x35\x8e\x3d\x8e\x31\x8e\x49\x8e\x41\x8e\x42\x8e\x51\x8e\x52\x8e\x4a\x8e\x70\x8e\x76\x8e\x7c\x8e\x6f\x8e\x74\x8e\x85\x8e\x8f\x8e\x94\x8e\x90\x8e\x9c\x8e\x9e\x8c\x78\x8c\x82\x8c\x8a\x8c\x85\x8c\x98\x8c\x94\x65\x9b\x89\xd6\x89\xde\x89\xda\x89\xdc\x89\xe5\x89\xeb\x89\xef\x8a\x3e\x8b\x26\x97\x53\x96\xe9\x96\xf3\x96\xef\x97\x06\x97\x01\x97\x08\x97\x0f\x97\x0e\x97\x2a\x97\x2d\x97\x30\x97\x3e\x9f\x80\x9f\x83\x9f\x85\x9f\x86\x9f\x87\x9f\x88\x9f\x89\x9f\x8a\x9f\x8c\x9e\xfe\x9f\x0b\x9f\x0d\x96\xb9\x96\xbc\x96\xbd\x96\xce\x96\xd2\x77\xbf\x96\xe0\x92\x8e\x92\xae\x92\xc8\x93\x3e\x93\x6a\x93\xca\x93\x8f\x94\x3e\x94\x6b\x9c\x7f\x9c\x82\x9c\x85\x9c\x86\x9c\x87\x9c\x88\x7a\x23\x9c\x8b\x9c\x8e\x9c\x90\x9c\x91\x9c\x92\x9c\x94\x9c\x95\x9c\x9a\x9c\x9b\x9c\x9e\x9c\x9f\x9c\xa0\x9c\xa1\x9c\xa2\x9c\xa3\x9c\xa5\x9c\xa6\x9c\xa7\x9c\xa8\x9c\xa9\x9c\xab\x9c\xad\x9c\xae\x9c\xb0\x9c\xb1\x9c\xb2\x9c\xb3\x9c\xb4\x9c\xb5\x9c\xb6\x9c\xb7\x9c\xba\x9c\xbb\x9c\xbc\x9c\xbd\x9c\xc4\x9c\xc5\x9c\xc6\x9c\xc7\x9c\xca\x9c\xcb\x00\x00\x00\x00",
 /* 6c00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x9c\xcc\x9c\xcd\x9c\xce\x9c\xcf\x9c\xd0\x9c\xd3\x9c\xd4\x9c\xd5\x9c\xd7\x9c\xd8\x9c\xd9\x9c\xdc\x9c\xdd\x9c\xdf\x9c\xe2\x97\x7c\x97\x85\x97\x91\x97\x92\x97\x94\x97\xaf\x97\xab\x97\xa3\x97\xb2\x97\xb4\x9a\xb1\x9a\xb0\x9a\xb7\x9e\x58\x9a\xb6\x9a\xba\x9a\xbc\x9a\xc1\x9a\xc0\x9a\xc5\x9a\xc2\x9a\xcb\x9a\xcc\x9a\xd1\x9b\x45\x9b\x43\x9b\x47\x9b\x49\x9b\x48\x9b\x4d\x9b\x51\x98\xe8\x99\x0d\x99\x2e\x99\x55\x99\x54\x9a\xdf\x9a\xe1\x9a\xe6\x9a\xef\x9a\xeb\x9a\xfb\x9a\xed\x9a\xf9\x9b\x08\x9b\x0f\x9b\x13\x9b\x1f",
 /* 6c80 */ "\x00\x00\x9b\x23\x9e\xbd\x9e\xbe\x7e\x3b\x9e\x82\x9e\x87\x9e\x88\x9e\x8b\x9e\x92\x93\xd6\x9e\x9d\x9e\x9f\x9e\xdb\x9e\xdc\x9e\xdd\x9e\xe0\x9e\xdf\x9e\xe2\x9e\xe9\x9e\xe7\x9e\xe5\x9e\xea\x9e\xef\x9f\x22\x9f\x2c\x9f\x2f\x9f\x39\x9f\x37\x9f\x3d\x9f\x3e\x9f\x44\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 6d00 */ NULL,
-/* 6d80 */ NULL,
-/* 6e00 */ NULL,
-/* 6e80 */ NULL,
-/* 6f00 */ NULL,
-/* 6f80 */ NULL,
-/* 7000 */ NULL,
-/* 7080 */ NULL,
-/* 7100 */ NULL,
-/* 7180 */ NULL,
-/* 7200 */ NULL,
-/* 7280 */ NULL,
-/* 7300 */ NULL,
-/* 7380 */ NULL,
-/* 7400 */ NULL,
-/* 7480 */ NULL,
-/* 7500 */ NULL,
-/* 7580 */ NULL,
 /* 7600 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe0\x00\xe0\x01\xe0\x02\xe0\x03\xe0\x04\xe0\x05\xe0\x06\xe0\x07\xe0\x08\xe0\x09\xe0\x0a\xe0\x0b\xe0\x0c\xe0\x0d\xe0\x0e\xe0\x0f\xe0\x10\xe0\x11\xe0\x12\xe0\x13\xe0\x14\xe0\x15\xe0\x16\xe0\x17\xe0\x18\xe0\x19\xe0\x1a\xe0\x1b\xe0\x1c\xe0\x1d\xe0\x1e\xe0\x1f\xe0\x20\xe0\x21\xe0\x22\xe0\x23\xe0\x24\xe0\x25\xe0\x26\xe0\x27\xe0\x28\xe0\x29\xe0\x2a\xe0\x2b\xe0\x2c\xe0\x2d\xe0\x2e\xe0\x2f\xe0\x30\xe0\x31\xe0\x32\xe0\x33\xe0\x34\xe0\x35\xe0\x36\xe0\x37\xe0\x38\xe0\x39\xe0\x3a\xe0\x3b\xe0\x3c\xe0\x3d\xe0\x3e",
 /* 7680 */ "\x00\x00\xe0\x3f\xe0\x40\xe0\x41\xe0\x42\xe0\x43\xe0\x44\xe0\x45\xe0\x46\xe0\x47\xe0\x48\xe0\x49\xe0\x4a\xe0\x4b\xe0\x4c\xe0\x4d\xe0\x4e\xe0\x4f\xe0\x50\xe0\x51\xe0\x52\xe0\x53\xe0\x54\xe0\x55\xe0\x56\xe0\x57\xe0\x58\xe0\x59\xe0\x5a\xe0\x5b\xe0\x5c\xe0\x5d\xe0\x5e\xe0\x5f\xe0\x60\xe0\x61\xe0\x62\xe0\x63\xe0\x64\xe0\x65\xe0\x66\xe0\x67\xe0\x68\xe0\x69\xe0\x6a\xe0\x6b\xe0\x6c\xe0\x6d\xe0\x6e\xe0\x6f\xe0\x70\xe0\x71\xe0\x72\xe0\x73\xe0\x74\xe0\x75\xe0\x76\xe0\x77\xe0\x78\xe0\x79\xe0\x7a\xe0\x7b\xe0\x7c\xe0\x7d\xe0\x7e\xe0\x7f\xe0\x80\xe0\x81\xe0\x82\xe0\x83\xe0\x84\xe0\x85\xe0\x86\xe0\x87\xe0\x88\xe0\x89\xe0\x8a\xe0\x8b\xe0\x8c\xe0\x8d\xe0\x8e\xe0\x8f\xe0\x90\xe0\x91\xe0\x92\xe0\x93\xe0\x94\xe0\x95\xe0\x96\xe0\x97\xe0\x98\xe0\x99\xe0\x9a\xe0\x9b\xe0\x9c\xe0\x9d\xe0\x9e\xe0\x9f\xe0\xa0\xe0\xa1\xe0\xa2\xe0\xa3\xe0\xa4\xe0\xa5\xe0\xa6\xe0\xa7\xe0\xa8\xe0\xa9\xe0\xaa\xe0\xab\xe0\xac\xe0\xad\xe0\xae\xe0\xaf\xe0\xb0\xe0\xb1\xe0\xb2\xe0\xb3\xe0\xb4\xe0\xb5\xe0\xb6\xe0\xb7\xe0\xb8\xe0\xb9\xe0\xba\xe0\xbb\x00\x00\x00\x00",
 /* 7700 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe0\xbc\xe0\xbd\xe0\xbe\xe0\xbf\xe0\xc0\xe0\xc1\xe0\xc2\xe0\xc3\xe0\xc4\xe0\xc5\xe0\xc6\xe0\xc7\xe0\xc8\xe0\xc9\xe0\xca\xe0\xcb\xe0\xcc\xe0\xcd\xe0\xce\xe0\xcf\xe0\xd0\xe0\xd1\xe0\xd2\xe0\xd3\xe0\xd4\xe0\xd5\xe0\xd6\xe0\xd7\xe0\xd8\xe0\xd9\xe0\xda\xe0\xdb\xe0\xdc\xe0\xdd\xe0\xde\xe0\xdf\xe0\xe0\xe0\xe1\xe0\xe2\xe0\xe3\xe0\xe4\xe0\xe5\xe0\xe6\xe0\xe7\xe0\xe8\xe0\xe9\xe0\xea\xe0\xeb\xe0\xec\xe0\xed\xe0\xee\xe0\xef\xe0\xf0\xe0\xf1\xe0\xf2\xe0\xf3\xe0\xf4\xe0\xf5\xe0\xf6\xe0\xf7\xe0\xf8\xe0\xf9\xe0\xfa",
@@ -1846,422 +859,66 @@ static uni16_t uni16[] = {
 /* 7e00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe5\xe0\xe5\xe1\xe5\xe2\xe5\xe3\xe5\xe4\xe5\xe5\xe5\xe6\xe5\xe7\xe5\xe8\xe5\xe9\xe5\xea\xe5\xeb\xe5\xec\xe5\xed\xe5\xee\xe5\xef\xe5\xf0\xe5\xf1\xe5\xf2\xe5\xf3\xe5\xf4\xe5\xf5\xe5\xf6\xe5\xf7\xe5\xf8\xe5\xf9\xe5\xfa\xe5\xfb\xe5\xfc\xe5\xfd\xe5\xfe\xe5\xff\xe6\x00\xe6\x01\xe6\x02\xe6\x03\xe6\x04\xe6\x05\xe6\x06\xe6\x07\xe6\x08\xe6\x09\xe6\x0a\xe6\x0b\xe6\x0c\xe6\x0d\xe6\x0e\xe6\x0f\xe6\x10\xe6\x11\xe6\x12\xe6\x13\xe6\x14\xe6\x15\xe6\x16\xe6\x17\xe6\x18\xe6\x19\xe6\x1a\xe6\x1b\xe6\x1c\xe6\x1d\xe6\x1e",
 /* 7e80 */ "\x00\x00\xe6\x1f\xe6\x20\xe6\x21\xe6\x22\xe6\x23\xe6\x24\xe6\x25\xe6\x26\xe6\x27\xe6\x28\xe6\x29\xe6\x2a\xe6\x2b\xe6\x2c\xe6\x2d\xe6\x2e\xe6\x2f\xe6\x30\xe6\x31\xe6\x32\xe6\x33\xe6\x34\xe6\x35\xe6\x36\xe6\x37\xe6\x38\xe6\x39\xe6\x3a\xe6\x3b\xe6\x3c\xe6\x3d\xe6\x3e\xe6\x3f\xe6\x40\xe6\x41\xe6\x42\xe6\x43\xe6\x44\xe6\x45\xe6\x46\xe6\x47\xe6\x48\xe6\x49\xe6\x4a\xe6\x4b\xe6\x4c\xe6\x4d\xe6\x4e\xe6\x4f\xe6\x50\xe6\x51\xe6\x52\xe6\x53\xe6\x54\xe6\x55\xe6\x56\xe6\x57\xe6\x58\xe6\x59\xe6\x5a\xe6\x5b\xe6\x5c\xe6\x5d\xe6\x5e\xe6\x5f\xe6\x60\xe6\x61\xe6\x62\xe6\x63\xe6\x64\xe6\x65\xe6\x66\xe6\x67\xe6\x68\xe6\x69\xe6\x6a\xe6\x6b\xe6\x6c\xe6\x6d\xe6\x6e\xe6\x6f\xe6\x70\xe6\x71\xe6\x72\xe6\x73\xe6\x74\xe6\x75\xe6\x76\xe6\x77\xe6\x78\xe6\x79\xe6\x7a\xe6\x7b\xe6\x7c\xe6\x7d\xe6\x7e\xe6\x7f\xe6\x80\xe6\x81\xe6\x82\xe6\x83\xe6\x84\xe6\x85\xe6\x86\xe6\x87\xe6\x88\xe6\x89\xe6\x8a\xe6\x8b\xe6\x8c\xe6\x8d\xe6\x8e\xe6\x8f\xe6\x90\xe6\x91\xe6\x92\xe6\x93\xe6\x94\xe6\x95\xe6\x96\xe6\x97\xe6\x98\xe6\x99\xe6\x9a\xe6\x9b\x00\x00\x00\x00",
 /* 7f00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe6\x9c\xe6\x9d\xe6\x9e\xe6\x9f\xe6\xa0\xe6\xa1\xe6\xa2\xe6\xa3\xe6\xa4\xe6\xa5\xe6\xa6\xe6\xa7\xe6\xa8\xe6\xa9\xe6\xaa\xe6\xab\xe6\xac\xe6\xad\xe6\xae\xe6\xaf\xe6\xb0\xe6\xb1\xe6\xb2\xe6\xb3\xe6\xb4\xe6\xb5\xe6\xb6\xe6\xb7\xe6\xb8\xe6\xb9\xe6\xba\xe6\xbb\xe6\xbc\xe6\xbd\xe6\xbe\xe6\xbf\xe6\xc0\xe6\xc1\xe6\xc2\xe6\xc3\xe6\xc4\xe6\xc5\xe6\xc6\xe6\xc7\xe6\xc8\xe6\xc9\xe6\xca\xe6\xcb\xe6\xcc\xe6\xcd\xe6\xce\xe6\xcf\xe6\xd0\xe6\xd1\xe6\xd2\xe6\xd3\xe6\xd4\xe6\xd5\xe6\xd6\xe6\xd7\xe6\xd8\xe6\xd9\xe6\xda",
-/* 7f80 */ "\x00\x00\xe6\xdb\xe6\xdc\xe6\xdd\xe6\xde\xe6\xdf\xe6\xe0\xe6\xe1\xe6\xe2\xe6\xe3\xe6\xe4\xe6\xe5\xe6\xe6\xe6\xe7\xe6\xe8\xe6\xe9\xe6\xea\xe6\xeb\xe6\xec\xe6\xed\xe6\xee\xe6\xef\xe6\xf0\xe6\xf1\xe6\xf2\xe6\xf3\xe6\xf4\xe6\xf5\xe6\xf6\xe6\xf7\xe6\xf8\xe6\xf9\xe6\xfa\xe6\xfb\xe6\xfc\xe6\xfd\xe6\xfe\xe6\xff\xe7\x00\xe7\x01\xe7\x02\xe7\x03\xe7\x04\xe7\x05\xe7\x06\xe7\x07\xe7\x08\xe7\x09\xe7\x0a\xe7\x0b\xe7\x0c\xe7\x0d\xe7\x0e\xe7\x0f\xe7\x10\xe7\x11\xe7\x12\xe7\x13\xe7\x14\xe7\x15\xe7\x16\xe7\x17\xe7\x18\xe7\x19\xe7\x1a\xe7\x1b\xe7\x1c\xe7\x1d\xe7\x1e\xe7\x1f\xe7\x20\xe7\x21\xe7\x22\xe7\x23\xe7\x24\xe7\x25\xe7\x26\xe7\x27\xe7\x28\xe7\x29\xe7\x2a\xe7\x2b\xe7\x2c\xe7\x2d\xe7\x2e\xe7\x2f\xe7\x30\xe7\x31\xe7\x32\xe7\x33\xe7\x34\xe7\x35\xe7\x36\xe7\x37\xe7\x38\xe7\x39\xe7\x3a\xe7\x3b\xe7\x3c\xe7\x3d\xe7\x3e\xe7\x3f\xe7\x40\xe7\x41\xe7\x42\xe7\x43\xe7\x44\xe7\x45\xe7\x46\xe7\x47\xe7\x48\xe7\x49\xe7\x4a\xe7\x4b\xe7\x4c\xe7\x4d\xe7\x4e\xe7\x4f\xe7\x50\xe7\x51\xe7\x52\xe7\x53\xe7\x54\xe7\x55\xe7\x56\xe7\x57\x00\x00\x00\x00",
-/* 8000 */ NULL,
-/* 8080 */ NULL,
-/* 8100 */ NULL,
-/* 8180 */ NULL,
-/* 8200 */ NULL,
-/* 8280 */ NULL,
-/* 8300 */ NULL,
-/* 8380 */ NULL,
-/* 8400 */ NULL,
-/* 8480 */ NULL,
-/* 8500 */ NULL,
-/* 8580 */ NULL,
-/* 8600 */ NULL,
-/* 8680 */ NULL,
-/* 8700 */ NULL,
-/* 8780 */ NULL,
-/* 8800 */ NULL,
-/* 8880 */ NULL,
-/* 8900 */ NULL,
-/* 8980 */ NULL,
-/* 8a00 */ NULL,
-/* 8a80 */ NULL,
-/* 8b00 */ NULL,
-/* 8b80 */ NULL,
-/* 8c00 */ NULL,
-/* 8c80 */ NULL,
-/* 8d00 */ NULL,
-/* 8d80 */ NULL,
-/* 8e00 */ NULL,
-/* 8e80 */ NULL,
-/* 8f00 */ NULL,
-/* 8f80 */ NULL,
-/* 9000 */ NULL,
-/* 9080 */ NULL,
-/* 9100 */ NULL,
-/* 9180 */ NULL,
-/* 9200 */ NULL,
-/* 9280 */ NULL,
-/* 9300 */ NULL,
-/* 9380 */ NULL,
-/* 9400 */ NULL,
-/* 9480 */ NULL,
-/* 9500 */ NULL,
-/* 9580 */ NULL,
-/* 9600 */ NULL,
-/* 9680 */ NULL,
-/* 9700 */ NULL,
-/* 9780 */ NULL,
-/* 9800 */ NULL,
-/* 9880 */ NULL,
-/* 9900 */ NULL,
-/* 9980 */ NULL,
-/* 9a00 */ NULL,
-/* 9a80 */ NULL,
-/* 9b00 */ NULL,
-/* 9b80 */ NULL,
-/* 9c00 */ NULL,
-/* 9c80 */ NULL,
-/* 9d00 */ NULL,
-/* 9d80 */ NULL,
-/* 9e00 */ NULL,
-/* 9e80 */ NULL,
-/* 9f00 */ NULL,
-/* 9f80 */ NULL,
-/* a000 */ NULL,
-/* a080 */ NULL,
-/* a100 */ NULL,
-/* a180 */ NULL,
-/* a200 */ NULL,
-/* a280 */ NULL,
-/* a300 */ NULL,
-/* a380 */ NULL,
-/* a400 */ NULL,
-/* a480 */ NULL,
-/* a500 */ NULL,
-/* a580 */ NULL,
-/* a600 */ NULL,
-/* a680 */ NULL,
-/* a700 */ NULL,
-/* a780 */ NULL,
-/* a800 */ NULL,
-/* a880 */ NULL,
-/* a900 */ NULL,
-/* a980 */ NULL,
-/* aa00 */ NULL,
-/* aa80 */ NULL,
-/* ab00 */ NULL,
-/* ab80 */ NULL,
-/* ac00 */ NULL,
-/* ac80 */ NULL,
-/* ad00 */ NULL,
-/* ad80 */ NULL,
-/* ae00 */ NULL,
-/* ae80 */ NULL,
-/* af00 */ NULL,
-/* af80 */ NULL,
-/* b000 */ NULL,
-/* b080 */ NULL,
-/* b100 */ NULL,
-/* b180 */ NULL,
-/* b200 */ NULL,
-/* b280 */ NULL,
-/* b300 */ NULL,
-/* b380 */ NULL,
-/* b400 */ NULL,
-/* b480 */ NULL,
-/* b500 */ NULL,
-/* b580 */ NULL,
-/* b600 */ NULL,
-/* b680 */ NULL,
-/* b700 */ NULL,
-/* b780 */ NULL,
-/* b800 */ NULL,
-/* b880 */ NULL,
-/* b900 */ NULL,
-/* b980 */ NULL,
-/* ba00 */ NULL,
-/* ba80 */ NULL,
-/* bb00 */ NULL,
-/* bb80 */ NULL,
-/* bc00 */ NULL,
-/* bc80 */ NULL,
-/* bd00 */ NULL,
-/* bd80 */ NULL,
-/* be00 */ NULL,
-/* be80 */ NULL,
-/* bf00 */ NULL,
-/* bf80 */ NULL,
-/* c000 */ NULL,
-/* c080 */ NULL,
-/* c100 */ NULL,
-/* c180 */ NULL,
-/* c200 */ NULL,
-/* c280 */ NULL,
-/* c300 */ NULL,
-/* c380 */ NULL,
-/* c400 */ NULL,
-/* c480 */ NULL,
-/* c500 */ NULL,
-/* c580 */ NULL,
-/* c600 */ NULL,
-/* c680 */ NULL,
-/* c700 */ NULL,
-/* c780 */ NULL,
-/* c800 */ NULL,
-/* c880 */ NULL,
-/* c900 */ NULL,
-/* c980 */ NULL,
-/* ca00 */ NULL,
-/* ca80 */ NULL,
-/* cb00 */ NULL,
-/* cb80 */ NULL,
-/* cc00 */ NULL,
-/* cc80 */ NULL,
-/* cd00 */ NULL,
-/* cd80 */ NULL,
-/* ce00 */ NULL,
-/* ce80 */ NULL,
-/* cf00 */ NULL,
-/* cf80 */ NULL,
-/* d000 */ NULL,
-/* d080 */ NULL,
-/* d100 */ NULL,
-/* d180 */ NULL,
-/* d200 */ NULL,
-/* d280 */ NULL,
-/* d300 */ NULL,
-/* d380 */ NULL,
-/* d400 */ NULL,
-/* d480 */ NULL,
-/* d500 */ NULL,
-/* d580 */ NULL,
-/* d600 */ NULL,
-/* d680 */ NULL,
-/* d700 */ NULL,
-/* d780 */ NULL,
-/* d800 */ NULL,
-/* d880 */ NULL,
-/* d900 */ NULL,
-/* d980 */ NULL,
-/* da00 */ NULL,
-/* da80 */ NULL,
-/* db00 */ NULL,
-/* db80 */ NULL,
-/* dc00 */ NULL,
-/* dc80 */ NULL,
-/* dd00 */ NULL,
-/* dd80 */ NULL,
-/* de00 */ NULL,
-/* de80 */ NULL,
-/* df00 */ NULL,
-/* df80 */ NULL,
-/* e000 */ NULL,
-/* e080 */ NULL,
-/* e100 */ NULL,
-/* e180 */ NULL,
-/* e200 */ NULL,
-/* e280 */ NULL,
-/* e300 */ NULL,
-/* e380 */ NULL,
-/* e400 */ NULL,
-/* e480 */ NULL,
-/* e500 */ NULL,
-/* e580 */ NULL,
-/* e600 */ NULL,
-/* e680 */ NULL,
-/* e700 */ NULL,
-/* e780 */ NULL,
-/* e800 */ NULL,
-/* e880 */ NULL,
-/* e900 */ NULL,
-/* e980 */ NULL,
-/* ea00 */ NULL,
-/* ea80 */ NULL,
-/* eb00 */ NULL,
-/* eb80 */ NULL,
-/* ec00 */ NULL,
-/* ec80 */ NULL,
-/* ed00 */ NULL,
-/* ed80 */ NULL,
-/* ee00 */ NULL,
-/* ee80 */ NULL,
-/* ef00 */ NULL,
-/* ef80 */ NULL,
-/* f000 */ NULL,
-/* f080 */ NULL,
-/* f100 */ NULL,
-/* f180 */ NULL,
-/* f200 */ NULL,
-/* f280 */ NULL,
-/* f300 */ NULL,
-/* f380 */ NULL,
-/* f400 */ NULL,
-/* f480 */ NULL,
-/* f500 */ NULL,
-/* f580 */ NULL,
-/* f600 */ NULL,
-/* f680 */ NULL,
-/* f700 */ NULL,
-/* f780 */ NULL,
-/* f800 */ NULL,
-/* f880 */ NULL,
-/* f900 */ NULL,
-/* f980 */ NULL,
-/* fa00 */ NULL,
-/* fa80 */ NULL,
-/* fb00 */ NULL,
-/* fb80 */ NULL,
-/* fc00 */ NULL,
-/* fc80 */ NULL,
-/* fd00 */ NULL,
-/* fd80 */ NULL,
-/* fe00 */ NULL,
-/* fe80 */ NULL,
-/* ff00 */ NULL,
-/* ff80 */ NULL }
-    },
-    { "cp937", "0x03a70343" /* 935, 835 */,
-/* Unicode to EBCDIC DBCS translation table for ibm-937_P110-1999 */ {
-/* 0000 */ NULL,
+/* 7f80 */ "\x00\x00\xe6\xdb\xe6\xdc\xe6\xdd\xe6\xde\xe6\xdf\xe6\xe0\xe6\xe1\xe6\xe2\xe6\xe3\xe6\xe4\xe6\xe5\xe6\xe6\xe6\xe7\xe6\xe8\xe6\xe9\xe6\xea\xe6\xeb\xe6\xec\xe6\xed\xe6\xee\xe6\xef\xe6\xf0\xe6\xf1\xe6\xf2\xe6\xf3\xe6\xf4\xe6\xf5\xe6\xf6\xe6\xf7\xe6\xf8\xe6\xf9\xe6\xfa\xe6\xfb\xe6\xfc\xe6\xfd\xe6\xfe\xe6\xff\xe7\x00\xe7\x01\xe7\x02\xe7\x03\xe7\x04\xe7\x05\xe7\x06\xe7\x07\xe7\x08\xe7\x09\xe7\x0a\xe7\x0b\xe7\x0c\xe7\x0d\xe7\x0e\xe7\x0f\xe7\x10\xe7\x11\xe7\x12\xe7\x13\xe7\x14\xe7\x15\xe7\x16\xe7\x17\xe7\x18\xe7\x19\xe7\x1a\xe7\x1b\xe7\x1c\xe7\x1d\xe7\x1e\xe7\x1f\xe7\x20\xe7\x21\xe7\x22\xe7\x23\xe7\x24\xe7\x25\xe7\x26\xe7\x27\xe7\x28\xe7\x29\xe7\x2a\xe7\x2b\xe7\x2c\xe7\x2d\xe7\x2e\xe7\x2f\xe7\x30\xe7\x31\xe7\x32\xe7\x33\xe7\x34\xe7\x35\xe7\x36\xe7\x37\xe7\x38\xe7\x39\xe7\x3a\xe7\x3b\xe7\x3c\xe7\x3d\xe7\x3e\xe7\x3f\xe7\x40\xe7\x41\xe7\x42\xe7\x43\xe7\x44\xe7\x45\xe7\x46\xe7\x47\xe7\x48\xe7\x49\xe7\x4a\xe7\x4b\xe7\x4c\xe7\x4d\xe7\x4e\xe7\x4f\xe7\x50\xe7\x51\xe7\x52\xe7\x53\xe7\x54\xe7\x55\xe7\x56\xe7\x57\x00\x00\x00\x00"
+};
+
+/* Unicode to EBCDIC DBCS translation table for ibm-937_P110-1999 */
+static const unsigned short cp937_u2ebc_ix[512] = {
+/* 0000 */ 0, 1, 0, 0, 0, 2, 0, 3, 4, 0, 0, 0, 0, 0, 0, 0,
+/* 0800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2000 */ 5, 0, 6, 7, 8, 9, 10, 0, 11, 0, 12, 13, 14, 0, 15, 0,
+/* 2800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3000 */ 16, 17, 18, 0, 19, 20, 0, 21, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 4000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 4800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 22, 23, 24, 25,
+/* 5000 */ 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+/* 5800 */ 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+/* 6000 */ 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+/* 6800 */ 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+/* 7000 */ 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+/* 7800 */ 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+/* 8000 */ 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+/* 8800 */ 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153,
+/* 9000 */ 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169,
+/* 9800 */ 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185,
+/* a000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* a800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* e000 */ 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201,
+/* e800 */ 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+/* f000 */ 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233,
+/* f800 */ 234, 0, 0, 0, 235, 0, 0, 0, 0, 0, 0, 0, 236, 0, 237, 238
+};
+static const uni16_row_t cp937_u2ebc[] = {
 /* 0080 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6a\x44\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x42\xa1\x44\xed\x44\x4b\x00\x00\x00\x00\x44\xee\x00\x00\x43\x79\x46\xe5\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x7a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x7b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 0100 */ NULL,
-/* 0180 */ NULL,
-/* 0200 */ NULL,
 /* 0280 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x53\x00\x00\x45\x51\x45\x52\x45\x54\x00\x00\x47\x52\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x55\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 0300 */ NULL,
 /* 0380 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\x61\x41\x62\x41\x63\x41\x64\x41\x65\x41\x66\x41\x67\x41\x68\x41\x69\x41\x6a\x41\x6b\x41\x6c\x41\x6d\x41\x6e\x41\x6f\x41\x70\x41\x71\x00\x00\x41\x72\x41\x73\x41\x74\x41\x75\x41\x76\x41\x77\x41\x78\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\x41\x41\x42\x41\x43\x41\x44\x41\x45\x41\x46\x41\x47\x41\x48\x41\x49\x41\x4a\x41\x4b\x41\x4c\x41\x4d\x41\x4e\x41\x4f\x41\x50\x41\x51\x00\x00\x41\x52\x41\x53\x41\x54\x41\x55\x41\x56\x41\x57\x41\x58\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 0400 */ "\x00\x00\x41\xc6\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\xc0\x41\xc1\x41\xc2\x41\xc3\x41\xc4\x41\xc5\x41\xc7\x41\xc8\x41\xc9\x41\xca\x41\xcb\x41\xcc\x41\xcd\x41\xce\x41\xcf\x41\xd0\x41\xd1\x41\xd2\x41\xd3\x41\xd4\x41\xd5\x41\xd6\x41\xd7\x41\xd8\x41\xd9\x41\xda\x41\xdb\x41\xdc\x41\xdd\x41\xde\x41\xdf\x41\xe0\x41\x80\x41\x81\x41\x82\x41\x83\x41\x84\x41\x85\x41\x87\x41\x88\x41\x89\x41\x8a\x41\x8b\x41\x8c\x41\x8d\x41\x8e\x41\x8f\x41\x90\x41\x91\x41\x92\x41\x93\x41\x94\x41\x95\x41\x96\x41\x97\x41\x98\x41\x99\x41\x9a\x41\x9b\x41\x9c\x41\x9d\x41\x9e\x41\x9f\x41\xa0\x00\x00\x41\x86\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 0480 */ NULL,
-/* 0500 */ NULL,
-/* 0580 */ NULL,
-/* 0600 */ NULL,
-/* 0680 */ NULL,
-/* 0700 */ NULL,
-/* 0780 */ NULL,
-/* 0800 */ NULL,
-/* 0880 */ NULL,
-/* 0900 */ NULL,
-/* 0980 */ NULL,
-/* 0a00 */ NULL,
-/* 0a80 */ NULL,
-/* 0b00 */ NULL,
-/* 0b80 */ NULL,
-/* 0c00 */ NULL,
-/* 0c80 */ NULL,
-/* 0d00 */ NULL,
-/* 0d80 */ NULL,
-/* 0e00 */ NULL,
-/* 0e80 */ NULL,
-/* 0f00 */ NULL,
-/* 0f80 */ NULL,
-/* 1000 */ NULL,
-/* 1080 */ NULL,
-/* 1100 */ NULL,
-/* 1180 */ NULL,
-/* 1200 */ NULL,
-/* 1280 */ NULL,
-/* 1300 */ NULL,
-/* 1380 */ NULL,
-/* 1400 */ NULL,
-/* 1480 */ NULL,
-/* 1500 */ NULL,
-/* 1580 */ NULL,
-/* 1600 */ NULL,
-/* 1680 */ NULL,
-/* 1700 */ NULL,
-/* 1780 */ NULL,
-/* 1800 */ NULL,
-/* 1880 */ NULL,
-/* 1900 */ NULL,
-/* 1980 */ NULL,
-/* 1a00 */ NULL,
-/* 1a80 */ NULL,
-/* 1b00 */ NULL,
-/* 1b80 */ NULL,
-/* 1c00 */ NULL,
-/* 1c80 */ NULL,
-/* 1d00 */ NULL,
-/* 1d80 */ NULL,
-/* 1e00 */ NULL,
-/* 1e80 */ NULL,
-/* 1f00 */ NULL,
-/* 1f80 */ NULL,
 /* 2000 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x5a\x00\x00\x00\x00\x44\x4a\x44\x4a\x00\x00\x00\x00\x00\x00\x44\x61\x44\x71\x00\x00\x00\x00\x44\x62\x44\x72\x00\x00\x00\x00\x43\x77\x43\x78\x00\x00\x00\x00\x00\x00\x44\x7e\x44\x7f\x43\x45\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x73\x00\x00\x44\x50\x44\xef\x00\x00\x42\x79\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6b\x00\x00\x00\x00\x42\xa1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2080 */ NULL,
 /* 2100 */ "\x00\x00\x00\x00\x00\x00\x44\x4e\x00\x00\x46\xbb\x00\x00\x00\x00\x00\x00\x46\xdb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\xf1\x41\xf2\x41\xf3\x41\xf4\x41\xf5\x41\xf6\x41\xf7\x41\xf8\x41\xf9\x41\xfa\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\xb1\x41\xb2\x41\xb3\x41\xb4\x41\xb5\x41\xb6\x41\xb7\x41\xb8\x41\xb9\x41\xba\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2180 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xf1\x44\xf2\x44\xf0\x44\xf3\x00\x00\x00\x00\x46\xd4\x46\xd5\x46\xd7\x46\xd6\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xef\x46\xf0\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x6e\x00\x00\x43\x6f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xee\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2200 */ "\x43\x70\x00\x00\x43\x4e\x43\x71\x00\x00\x00\x00\x00\x00\x43\x4f\x43\x64\x00\x00\x00\x00\x43\x65\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xda\x00\x00\x00\x00\x00\x00\x00\x00\x46\xc5\x00\x00\x00\x00\x43\x61\x44\x4d\x46\xcc\x46\xcb\x00\x00\x00\x00\x42\x4f\x00\x00\x44\x7c\x00\x00\x43\x6c\x43\x6d\x46\xc8\x46\xc9\x46\xd0\x43\x63\x00\x00\x46\xd1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x68\x44\x78\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\xa1\x43\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xc6\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x4c\x46\xc7\x00\x00\x00\x00\x00\x00\x00\x00\x44\x67\x44\x77\x00\x00\x00\x00\x43\x5d\x43\x5e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2280 */ "\x00\x00\x00\x00\x43\x68\x43\x69\x00\x00\x00\x00\x43\x66\x43\x67\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xd2\x00\x00\x00\x00\x00\x00\x46\xd3\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xca\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xcd\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2300 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x4d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2380 */ NULL,
 /* 2400 */ "\x47\x81\x47\x82\x47\x83\x47\x84\x47\x85\x47\x86\x47\x87\x47\x88\x47\x89\x47\x8a\x47\x8b\x47\x8c\x47\x8d\x47\x8e\x47\x8f\x47\x90\x47\x91\x47\x92\x47\x93\x47\x94\x47\x95\x47\x96\x47\x97\x47\x98\x47\x99\x47\x9a\x47\x9b\x47\x9c\x47\x9d\x47\x9e\x47\x9f\x47\xa0\x00\x00\x47\xa1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x41\x46\x42\x46\x43\x46\x44\x46\x45\x46\x46\x46\x47\x46\x48\x46\x49\x46\x4a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x51\x46\x52\x46\x53\x46\x54\x46\x55\x46\x56\x46\x57\x46\x58\x46\x59\x46\x5a\x00\x00\x00\x00",
-/* 2480 */ NULL,
 /* 2500 */ "\x46\x75\x43\xb7\x46\x76\x43\xb8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x78\x00\x00\x00\x00\x43\xb9\x46\x79\x00\x00\x00\x00\x43\xe1\x46\x7a\x00\x00\x00\x00\x43\xe3\x46\x7b\x00\x00\x00\x00\x43\xe2\x46\x73\x43\xee\x00\x00\x00\x00\x43\xe9\x00\x00\x00\x00\x43\xe4\x46\x72\x43\xf0\x00\x00\x00\x00\x43\xeb\x00\x00\x00\x00\x43\xe6\x46\x71\x00\x00\x00\x00\x43\xea\x43\xef\x00\x00\x00\x00\x43\xe5\x46\x70\x00\x00\x00\x00\x43\xec\x43\xf1\x00\x00\x00\x00\x43\xe7\x46\x6f\x00\x00\x00\x00\x43\xed\x00\x00\x00\x00\x43\xf2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\xe8\x00\x00\x00\x00\x00\x00\x00\x00\x46\x81\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x82\x00\x00\x00\x00\x46\x84\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x83\x00\x00\x00\x00\x46\x7c\x46\x7d\x46\x7f\x46\x7e\x46\x89\x46\x8a\x46\x8b\x46\xb7\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2580 */ "\x00\x00\x46\x60\x46\x61\x46\x62\x46\x63\x46\x64\x46\x65\x46\x66\x46\x67\x46\x6e\x46\x6d\x46\x6c\x46\x6b\x46\x6a\x46\x69\x46\x68\x00\x00\x00\x00\x00\x00\x00\x00\x46\x74\x46\x77\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xea\x44\xe9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe3\x44\xe2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xec\x44\xeb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe8\x44\xe7\x00\x00\x00\x00\x00\x00\x44\xe0\x00\x00\x00\x00\x44\xe4\x44\xe1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x85\x46\x86\x46\x88\x46\x87\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x7a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2600 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe6\x44\xe5\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x79\x00\x00\x44\x69\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x76\x00\x00\x00\x00\x43\x75\x00\x00\x43\x74\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2680 */ NULL,
 /* 2700 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x42\x5c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2780 */ NULL,
-/* 2800 */ NULL,
-/* 2880 */ NULL,
-/* 2900 */ NULL,
-/* 2980 */ NULL,
-/* 2a00 */ NULL,
-/* 2a80 */ NULL,
-/* 2b00 */ NULL,
-/* 2b80 */ NULL,
-/* 2c00 */ NULL,
-/* 2c80 */ NULL,
-/* 2d00 */ NULL,
-/* 2d80 */ NULL,
-/* 2e00 */ NULL,
-/* 2e80 */ NULL,
-/* 2f00 */ NULL,
-/* 2f80 */ NULL,
 /* 3000 */ "\x40\x40\x43\x44\x43\x41\x46\xb9\x00\x00\x44\x5d\x44\x5e\x44\x5f\x44\x64\x44\x74\x44\x65\x44\x75\x43\x42\x43\x43\x44\x42\x44\x43\x44\x66\x44\x76\x44\x6c\x44\x7d\x44\x63\x44\x73\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xe9\x46\xea\x00\x00\x00\x00\x45\x41\x45\x42\x45\x43\x45\x44\x45\x45\x45\x46\x45\x47\x45\x48\x45\x49\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x47\x44\x81\x44\x48\x44\x82\x44\x49\x44\x83\x44\x51\x44\x84\x44\x52\x44\x85\x44\x86\x44\xc0\x44\x87\x44\xc1\x44\x88\x44\xc2\x44\x89\x44\xc3\x44\x8a\x44\xc4\x44\x8c\x44\xc5\x44\x8d\x44\xc6\x44\x8e\x44\xc7\x44\x8f\x44\xc8\x44\x90\x44\xc9\x44\x91\x44\xca\x44\x92\x44\xcb\x44\x56\x44\x93\x44\xcc\x44\x94\x44\xcd\x44\x95\x44\xce\x44\x96\x44\x97\x44\x98\x44\x99\x44\x9a\x44\x9d\x44\xcf\x44\xd5\x44\x9e\x44\xd0\x44\xd6\x44\x9f\x44\xd1\x44\xd7\x44\xa2\x44\xd2\x44\xd8\x44\xa3\x44\xd3\x44\xd9\x44\xa4\x44\xa5",
 /* 3080 */ "\x44\xa6\x44\xa7\x44\xa8\x44\x53\x44\xa9\x44\x54\x44\xaa\x44\x55\x44\xac\x44\xad\x44\xae\x44\xaf\x44\xba\x44\xbb\x44\x57\x44\xbc\x44\xda\x44\xdb\x44\x46\x44\xbd\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\xbe\x43\xbf\x44\xdc\x44\xdd\x00\x00\x00\x00\x43\x47\x43\x81\x43\x48\x43\x82\x43\x49\x43\x83\x43\x51\x43\x84\x43\x52\x43\x85\x43\x86\x43\xc0\x43\x87\x43\xc1\x43\x88\x43\xc2\x43\x89\x43\xc3\x43\x8a\x43\xc4\x43\x8c\x43\xc5\x43\x8d\x43\xc6\x43\x8e\x43\xc7\x43\x8f\x43\xc8\x43\x90\x43\xc9\x43\x91\x43\xca\x43\x92\x43\xcb\x43\x56\x43\x93\x43\xcc\x43\x94\x43\xcd\x43\x95\x43\xce\x43\x96\x43\x97\x43\x98\x43\x99\x43\x9a\x43\x9d\x43\xcf\x43\xd5\x43\x9e\x43\xd0\x43\xd6\x43\x9f\x43\xd1\x43\xd7\x43\xa2\x43\xd2\x43\xd8\x43\xa3\x43\xd3\x43\xd9\x43\xa4\x43\xa5\x43\xa6\x43\xa7\x43\xa8\x43\x53\x43\xa9\x43\x54\x43\xaa\x43\x55\x43\xac\x43\xad\x43\xae\x43\xaf\x43\xba\x43\xbb\x43\x57\x43\xbc\x43\xda\x43\xdb\x43\x46\x43\xbd\x43\xd4\x43\x59\x43\x5a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x58\x43\xdc\x43\xdd\x00\x00",
 /* 3100 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x56\x45\x57\x45\x58\x45\x59\x45\x5a\x45\x5b\x45\x5c\x45\x5d\x45\x5e\x45\x5f\x45\x60\x45\x61\x45\x62\x45\x63\x45\x64\x45\x65\x45\x66\x45\x67\x45\x68\x45\x69\x45\x6a\x45\x6b\x45\x6c\x45\x6d\x45\x6e\x45\x6f\x45\x70\x45\x71\x45\x72\x45\x73\x45\x74\x45\x75\x45\x76\x45\x77\x45\x78\x45\x79\x45\x7a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 3180 */ NULL,
 /* 3200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 3280 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xba\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 3300 */ NULL,
 /* 3380 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xe2\x46\xe3\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xdd\x46\xde\x46\xdf\x00\x00\x00\x00\x46\xe1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xe4\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\xe0\x00\x00\x00\x00\x46\xcf\x46\xce\x00\x00\x00\x00\x46\xdc\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 3400 */ NULL,
-/* 3480 */ NULL,
-/* 3500 */ NULL,
-/* 3580 */ NULL,
-/* 3600 */ NULL,
-/* 3680 */ NULL,
-/* 3700 */ NULL,
-/* 3780 */ NULL,
-/* 3800 */ NULL,
-/* 3880 */ NULL,
-/* 3900 */ NULL,
-/* 3980 */ NULL,
-/* 3a00 */ NULL,
-/* 3a80 */ NULL,
-/* 3b00 */ NULL,
-/* 3b80 */ NULL,
-/* 3c00 */ NULL,
-/* 3c80 */ NULL,
-/* 3d00 */ NULL,
-/* 3d80 */ NULL,
-/* 3e00 */ NULL,
-/* 3e80 */ NULL,
-/* 3f00 */ NULL,
-/* 3f80 */ NULL,
-/* 4000 */ NULL,
-/* 4080 */ NULL,
-/* 4100 */ NULL,
-/* 4180 */ NULL,
-/* 4200 */ NULL,
-/* 4280 */ NULL,
-/* 4300 */ NULL,
-/* 4380 */ NULL,
-/* 4400 */ NULL,
-/* 4480 */ NULL,
-/* 4500 */ NULL,
-/* 4580 */ NULL,
-/* 4600 */ NULL,
-/* 4680 */ NULL,
-/* 4700 */ NULL,
-/* 4780 */ NULL,
-/* 4800 */ NULL,
-/* 4880 */ NULL,
-/* 4900 */ NULL,
-/* 4980 */ NULL,
-/* 4a00 */ NULL,
-/* 4a80 */ NULL,
-/* 4b00 */ NULL,
-/* 4b80 */ NULL,
-/* 4c00 */ NULL,
-/* 4c80 */ NULL,
-/* 4d00 */ NULL,
-/* 4d80 */ NULL,
 /* 4e00 */ "\x4c\x41\x4c\x43\x00\x00\x4c\x44\x00\x00\x00\x00\x00\x00\x69\x46\x4c\x57\x4c\x55\x4c\x58\x4c\x56\x69\x47\x4c\x83\x69\x50\x69\x4e\x4c\x82\x4c\x81\x00\x00\x00\x00\x4c\xe1\x4c\xe0\x4c\xdf\x00\x00\x4c\xe2\x4c\xde\x00\x00\x00\x00\x00\x00\x00\x00\x4d\xa1\x4d\xa2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4f\xe3\x00\x00\x48\x42\x00\x00\x00\x00\x4c\x59\x00\x00\x4c\x84\x69\x51\x00\x00\x4c\x85\x69\x64\x4e\x8c\x6b\x52\x00\x00\x00\x00\x48\x43\x00\x00\x4c\x5a\x4c\x86\x00\x00\x4c\xe3\x69\x65\x00\x00\x00\x00\x48\x44\x00\x00\x00\x00\x69\x41\x4c\x45\x00\x00\x4c\x5c\x00\x00\x69\x48\x4c\x5d\x00\x00\x00\x00\x4c\x87\x00\x00\x4c\xe4\x4c\xe6\x4c\xe5\x00\x00\x00\x00\x4d\xa3\x4d\xa4\x00\x00\x00\x00\x4f\xe4\x00\x00\x53\xfd\x4c\x42\x00\x00\x00\x00\x69\x42\x4c\x46\x4c\x5f\x4c\x5e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4d\xa5\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4f\xe5\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x56\x92\x72\x6f",
 /* 4e80 */ "\x00\x00\x00\x00\x5b\xa9\x79\x77\x79\x78\x48\x46\x4c\x47\x00\x00\x4c\x89\x00\x00\x00\x00\x4f\xe6\x4c\x48\x69\x49\x4c\x60\x00\x00\x00\x00\x4c\x8a\x4c\x8c\x69\x52\x4c\x8d\x4c\x8b\x00\x00\x00\x00\x00\x00\x4d\xa6\x00\x00\x4f\xe7\x00\x00\x00\x00\x4f\xe8\x51\xe6\x48\x48\x4c\x61\x4c\x8e\x00\x00\x4d\xa7\x4d\xa9\x4d\xa8\x00\x00\x4e\x8d\x00\x00\x00\x00\x4f\xe9\x4f\xea\x51\xe7\x51\xe8\x00\x00\x00\x00\x00\x00\x00\x00\x54\x41\x00\x00\x00\x00\x79\x79\x00\x00\x00\x00\x8f\x66\x4c\x49\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4c\x90\x4c\x8f\x69\x53\x4c\x91\x4c\x97\x00\x00\x4c\x92\x4c\x93\x69\x55\x69\x54\x4c\x95\x4c\x96\x00\x00\x4c\x94\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4c\xe9\x4c\xea\x4c\xeb\x4c\xec\x4c\xe8\x4c\xef\x69\x6b\x00\x00\x69\x67\x69\x6a\x4c\xf0\x4d\x43\x00\x00\x69\x69\x00\x00\x4c\xed\x4c\xee\x4c\xe7\x00\x00\x00\x00\x69\x66\x69\x68\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4d\xb6\x69\x90\x4d\xb3\x4d\xb7\x69\x9a\x69\x8e\x4d\xb4\x69\x92\x00\x00\x00\x00\x00\x00\x4d\xb5\x00\x00\x4d\xb8\x00\x00\x4d\xaa",
 /* 4f00 */ "\x69\x91\x4d\xb9\x69\x95\x00\x00\x69\x99\x69\x96\x00\x00\x00\x00\x69\x93\x4d\xab\x4d\xad\x4d\xba\x00\x00\x4d\xaf\x69\x8b\x4d\xb2\x4d\xb0\x4d\xb1\x69\x9b\x69\x98\x69\x8f\x4d\xae\x00\x00\x00\x00\x69\x8c\x4d\xac\x00\x00\x00\x00\x00\x00\x69\x94\x00\x00\x00\x00\x00\x00\x00\x00\x69\x97\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x69\x8d\x6a\x48\x00\x00\x4e\xa3\x4e\x96\x00\x00\x00\x00\x6a\x49\x4e\x93\x00\x00\x4e\xa5\x00\x00\x4e\x9b\x00\x00\x4e\x9a\x69\xfa\x4e\x9e\x4e\x99\x6a\x42\x6a\x4a\x00\x00\x6a\x46\x00\x00\x4e\x9c\x00\x00\x00\x00\x4e\x9f\x4e\x90\x4e\xa8\x69\xfc\x00\x00\x00\x00\x6b\x5e\x4e\x8e\x4e\xa4\x4e\x8f\x4e\x97\x4e\x98\x6a\x44\x69\xfd\x4e\x9d\x4e\x95\x69\xf9\x4e\x91\x6a\x47\x4e\xa6\x4e\xa9\x4e\x94\x4e\xa1\x4e\xa7\x4e\x92\x6a\x45\x4e\xa2\x6a\x4b\x69\xfb\x4e\xa0\x6a\x41\x00\x00\x00\x00\x6a\x43\x00\x00\x4f\xf8\x6b\x60\x6b\x6c\x4f\xf0\x00\x00\x6b\x6d\x4f\xeb\x4f\xf5\x00\x00\x00\x00\x4f\xee\x6b\x5a\x4f\xf6\x6b\x59\x6b\x5d\x6b\x64\x6b\x62\x50\x41\x4f\xf9\x6b\x54\x6b\x56\x4f\xfb\x4f\xef",
@@ -2426,134 +1083,6 @@ static uni16_t uni16[] = {
 /* 9e80 */ "\x7c\xf5\x00\x00\x5d\xed\x83\xbb\x00\x00\x00\x00\x86\xbb\x86\xbc\x86\xba\x89\x58\x89\x57\x65\x52\x8b\x4e\x89\x59\x8b\x4d\x00\x00\x00\x00\x8c\xe1\x66\xdb\x66\xdd\x8c\xe0\x00\x00\x00\x00\x66\xdc\x00\x00\x8e\x60\x8e\x62\x8e\x61\x8f\x5a\x67\xd0\x00\x00\x68\x7b\x90\xf7\x91\x74\x00\x00\x00\x00\x91\xc2\x59\x47\x00\x00\x80\x6f\x00\x00\x62\x4b\x00\x00\x00\x00\x00\x00\x86\xbe\x86\xbd\x00\x00\x89\x5a\x00\x00\x00\x00\x00\x00\x66\xde\x67\x7c\x8f\xf5\x91\xbb\x00\x00\x00\x00\x00\x00\x59\x48\x5f\xf9\x00\x00\x62\x4c\x00\x00\x8c\xe2\x00\x00\x90\xa5\x5b\xa6\x00\x00\x00\x00\x00\x00\x00\x00\x89\x5b\x00\x00\x00\x00\x00\x00\x68\xb0\x5b\xa7\x62\x4d\x65\x53\x90\xa6\x5b\xa8\x00\x00\x83\xbc\x63\xbc\x86\xbf\x86\xc0\x00\x00\x63\xbb\x00\x00\x89\x5c\x65\x57\x65\x55\x65\x56\x65\x54\x8b\x4f\x66\x48\x00\x00\x00\x00\x00\x00\x8e\x64\x8e\x63\x8e\x66\x8e\x65\x67\x7d\x00\x00\x00\x00\x8f\x5b\x00\x00\x8f\x5d\x8f\x5c\x67\xd1\x8f\xf6\x00\x00\x90\xa7\x90\xa8\x68\x7c\x91\x75\x91\x8f\x68\xc1\x00\x00\x79\x76\x86\xc1\x89\x5d\x8c\xe3\x7c\xf6\x00\x00\x89\x5e",
 /* 9f00 */ "\x8b\x51\x8b\x50\x00\x00\x00\x00\x00\x00\x00\x00\x90\xa9\x68\x9e\x00\x00\x91\x76\x91\x90\x00\x00\x00\x00\x00\x00\x5d\xee\x83\xbd\x83\xbe\x00\x00\x86\xc2\x5d\xef\x00\x00\x66\x49\x8b\x52\x00\x00\x8f\x5f\x67\xd2\x8f\x60\x8f\x5e\x90\xaa\x00\x00\x90\xf8\x00\x00\x5d\xf0\x00\x00\x89\x61\x89\x60\x89\x5f\x8b\x53\x00\x00\x00\x00\x8b\x57\x8b\x56\x8b\x55\x8b\x54\x66\x4a\x8c\xe4\x8e\x68\x67\x7e\x8e\x67\x8f\x61\x8f\xf9\x8f\xf8\x68\x50\x8f\xf7\x90\xad\x90\xac\x90\xab\x00\x00\x00\x00\x5f\xfa\x00\x00\x86\xc3\x65\x58\x00\x00\x8c\xe5\x8c\xe6\x8f\xfa\x90\xae\x00\x00\x00\x00\x90\xf9\x91\x77\x91\xa9\x91\xc4\x5f\xfb\x65\x59\x8b\x58\x8c\xe7\x8f\x62\x90\xaf\x00\x00\x00\x00\x62\x4f\x00\x00\x89\x62\x8b\x59\x8c\xe8\x8c\xe9\x8c\xea\x8e\x6d\x00\x00\x8e\x69\x67\xd3\x8e\x6c\x8e\x6b\x67\x7f\x8e\x6a\x67\x82\x00\x00\x67\x81\x8f\x64\x8f\x63\x67\xd4\x67\xd5\x00\x00\x00\x00\x68\x52\x8f\xfb\x68\x51\x00\x00\x90\xb2\x90\xb3\x90\xb1\x90\xb0\x68\xa0\x00\x00\x90\xfa\x90\xfb\x90\xfc\x68\x9f\x91\x78\x91\x7b\x91\x7a\x91\x79\x00\x00\x00\x00\x91\xc3\x00\x00",
 /* 9f80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x63\xbd\x00\x00\x00\x00\x66\x51\x8e\x6e\x8f\x65\x00\x00\x68\x53\x8f\xfc\x00\x00\x00\x00\x91\xc5\x00\x00\x00\x00\x00\x00\x63\xbe\x00\x00\x00\x00\x00\x00\x89\x63\x00\x00\x8f\xfd\x00\x00\x91\x91\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* a000 */ NULL,
-/* a080 */ NULL,
-/* a100 */ NULL,
-/* a180 */ NULL,
-/* a200 */ NULL,
-/* a280 */ NULL,
-/* a300 */ NULL,
-/* a380 */ NULL,
-/* a400 */ NULL,
-/* a480 */ NULL,
-/* a500 */ NULL,
-/* a580 */ NULL,
-/* a600 */ NULL,
-/* a680 */ NULL,
-/* a700 */ NULL,
-/* a780 */ NULL,
-/* a800 */ NULL,
-/* a880 */ NULL,
-/* a900 */ NULL,
-/* a980 */ NULL,
-/* aa00 */ NULL,
-/* aa80 */ NULL,
-/* ab00 */ NULL,
-/* ab80 */ NULL,
-/* ac00 */ NULL,
-/* ac80 */ NULL,
-/* ad00 */ NULL,
-/* ad80 */ NULL,
-/* ae00 */ NULL,
-/* ae80 */ NULL,
-/* af00 */ NULL,
-/* af80 */ NULL,
-/* b000 */ NULL,
-/* b080 */ NULL,
-/* b100 */ NULL,
-/* b180 */ NULL,
-/* b200 */ NULL,
-/* b280 */ NULL,
-/* b300 */ NULL,
-/* b380 */ NULL,
-/* b400 */ NULL,
-/* b480 */ NULL,
-/* b500 */ NULL,
-/* b580 */ NULL,
-/* b600 */ NULL,
-/* b680 */ NULL,
-/* b700 */ NULL,
-/* b780 */ NULL,
-/* b800 */ NULL,
-/* b880 */ NULL,
-/* b900 */ NULL,
-/* b980 */ NULL,
-/* ba00 */ NULL,
-/* ba80 */ NULL,
-/* bb00 */ NULL,
-/* bb80 */ NULL,
-/* bc00 */ NULL,
-/* bc80 */ NULL,
-/* bd00 */ NULL,
-/* bd80 */ NULL,
-/* be00 */ NULL,
-/* be80 */ NULL,
-/* bf00 */ NULL,
-/* bf80 */ NULL,
-/* c000 */ NULL,
-/* c080 */ NULL,
-/* c100 */ NULL,
-/* c180 */ NULL,
-/* c200 */ NULL,
-/* c280 */ NULL,
-/* c300 */ NULL,
-/* c380 */ NULL,
-/* c400 */ NULL,
-/* c480 */ NULL,
-/* c500 */ NULL,
-/* c580 */ NULL,
-/* c600 */ NULL,
-/* c680 */ NULL,
-/* c700 */ NULL,
-/* c780 */ NULL,
-/* c800 */ NULL,
-/* c880 */ NULL,
-/* c900 */ NULL,
-/* c980 */ NULL,
-/* ca00 */ NULL,
-/* ca80 */ NULL,
-/* cb00 */ NULL,
-/* cb80 */ NULL,
-/* cc00 */ NULL,
-/* cc80 */ NULL,
-/* cd00 */ NULL,
-/* cd80 */ NULL,
-/* ce00 */ NULL,
-/* ce80 */ NULL,
-/* cf00 */ NULL,
-/* cf80 */ NULL,
-/* d000 */ NULL,
-/* d080 */ NULL,
-/* d100 */ NULL,
-/* d180 */ NULL,
-/* d200 */ NULL,
-/* d280 */ NULL,
-/* d300 */ NULL,
-/* d380 */ NULL,
-/* d400 */ NULL,
-/* d480 */ NULL,
-/* d500 */ NULL,
-/* d580 */ NULL,
-/* d600 */ NULL,
-/* d680 */ NULL,
-/* d700 */ NULL,
-/* d780 */ NULL,
-/* d800 */ NULL,
-/* d880 */ NULL,
-/* d900 */ NULL,
-/* d980 */ NULL,
-/* da00 */ NULL,
-/* da80 */ NULL,
-/* db00 */ NULL,
-/* db80 */ NULL,
-/* dc00 */ NULL,
-/* dc80 */ NULL,
-/* dd00 */ NULL,
-/* dd80 */ NULL,
-/* de00 */ NULL,
-/* de80 */ NULL,
-/* df00 */ NULL,
-/* df80 */ NULL,
 /* e000 */ "\xc2\x41\xc2\x42\xc2\x43\xc2\x44\xc2\x45\xc2\x46\xc2\x47\xc2\x48\xc2\x49\xc2\x4a\xc2\x4b\xc2\x4c\xc2\x4d\xc2\x4e\xc2\x4f\xc2\x50\xc2\x51\xc2\x52\xc2\x53\xc2\x54\xc2\x55\xc2\x56\xc2\x57\xc2\x58\xc2\x59\xc2\x5a\xc2\x5b\xc2\x5c\xc2\x5d\xc2\x5e\xc2\x5f\xc2\x60\xc2\x61\xc2\x62\xc2\x63\xc2\x64\xc2\x65\xc2\x66\xc2\x67\xc2\x68\xc2\x69\xc2\x6a\xc2\x6b\xc2\x6c\xc2\x6d\xc2\x6e\xc2\x6f\xc2\x70\xc2\x71\xc2\x72\xc2\x73\xc2\x74\xc2\x75\xc2\x76\xc2\x77\xc2\x78\xc2\x79\xc2\x7a\xc2\x7b\xc2\x7c\xc2\x7d\xc2\x7e\xc2\x7f\xc2\x81\xc2\x82\xc2\x83\xc2\x84\xc2\x85\xc2\x86\xc2\x87\xc2\x88\xc2\x89\xc2\x8a\xc2\x8b\xc2\x8c\xc2\x8d\xc2\x8e\xc2\x8f\xc2\x90\xc2\x91\xc2\x92\xc2\x93\xc2\x94\xc2\x95\xc2\x96\xc2\x97\xc2\x98\xc2\x99\xc2\x9a\xc2\x9b\xc2\x9c\xc2\x9d\xc2\x9e\xc2\x9f\xc2\xa0\xc2\xa1\xc2\xa2\xc2\xa3\xc2\xa4\xc2\xa5\xc2\xa6\xc2\xa7\xc2\xa8\xc2\xa9\xc2\xaa\xc2\xab\xc2\xac\xc2\xad\xc2\xae\xc2\xaf\xc2\xb0\xc2\xb1\xc2\xb2\xc2\xb3\xc2\xb4\xc2\xb5\xc2\xb6\xc2\xb7\xc2\xb8\xc2\xb9\xc2\xba\xc2\xbb\xc2\xbc\xc2\xbd\xc2\xbe\xc2\xbf\xc2\xc0\xc2\xc1",
 /* e080 */ "\xc2\xc2\xc2\xc3\xc2\xc4\xc2\xc5\xc2\xc6\xc2\xc7\xc2\xc8\xc2\xc9\xc2\xca\xc2\xcb\xc2\xcc\xc2\xcd\xc2\xce\xc2\xcf\xc2\xd0\xc2\xd1\xc2\xd2\xc2\xd3\xc2\xd4\xc2\xd5\xc2\xd6\xc2\xd7\xc2\xd8\xc2\xd9\xc2\xda\xc2\xdb\xc2\xdc\xc2\xdd\xc2\xde\xc2\xdf\xc2\xe0\xc2\xe1\xc2\xe2\xc2\xe3\xc2\xe4\xc2\xe5\xc2\xe6\xc2\xe7\xc2\xe8\xc2\xe9\xc2\xea\xc2\xeb\xc2\xec\xc2\xed\xc2\xee\xc2\xef\xc2\xf0\xc2\xf1\xc2\xf2\xc2\xf3\xc2\xf4\xc2\xf5\xc2\xf6\xc2\xf7\xc2\xf8\xc2\xf9\xc2\xfa\xc2\xfb\xc2\xfc\xc2\xfd\xc3\x41\xc3\x42\xc3\x43\xc3\x44\xc3\x45\xc3\x46\xc3\x47\xc3\x48\xc3\x49\xc3\x4a\xc3\x4b\xc3\x4c\xc3\x4d\xc3\x4e\xc3\x4f\xc3\x50\xc3\x51\xc3\x52\xc3\x53\xc3\x54\xc3\x55\xc3\x56\xc3\x57\xc3\x58\xc3\x59\xc3\x5a\xc3\x5b\xc3\x5c\xc3\x5d\xc3\x5e\xc3\x5f\xc3\x60\xc3\x61\xc3\x62\xc3\x63\xc3\x64\xc3\x65\xc3\x66\xc3\x67\xc3\x68\xc3\x69\xc3\x6a\xc3\x6b\xc3\x6c\xc3\x6d\xc3\x6e\xc3\x6f\xc3\x70\xc3\x71\xc3\x72\xc3\x73\xc3\x74\xc3\x75\xc3\x76\xc3\x77\xc3\x78\xc3\x79\xc3\x7a\xc3\x7b\xc3\x7c\xc3\x7d\xc3\x7e\xc3\x7f\xc3\x81\xc3\x82\xc3\x83\xc3\x84\xc3\x85",
 /* e100 */ "\xc3\x86\xc3\x87\xc3\x88\xc3\x89\xc3\x8a\xc3\x8b\xc3\x8c\xc3\x8d\xc3\x8e\xc3\x8f\xc3\x90\xc3\x91\xc3\x92\xc3\x93\xc3\x94\xc3\x95\xc3\x96\xc3\x97\xc3\x98\xc3\x99\xc3\x9a\xc3\x9b\xc3\x9c\xc3\x9d\xc3\x9e\xc3\x9f\xc3\xa0\xc3\xa1\xc3\xa2\xc3\xa3\xc3\xa4\xc3\xa5\xc3\xa6\xc3\xa7\xc3\xa8\xc3\xa9\xc3\xaa\xc3\xab\xc3\xac\xc3\xad\xc3\xae\xc3\xaf\xc3\xb0\xc3\xb1\xc3\xb2\xc3\xb3\xc3\xb4\xc3\xb5\xc3\xb6\xc3\xb7\xc3\xb8\xc3\xb9\xc3\xba\xc3\xbb\xc3\xbc\xc3\xbd\xc3\xbe\xc3\xbf\xc3\xc0\xc3\xc1\xc3\xc2\xc3\xc3\xc3\xc4\xc3\xc5\xc3\xc6\xc3\xc7\xc3\xc8\xc3\xc9\xc3\xca\xc3\xcb\xc3\xcc\xc3\xcd\xc3\xce\xc3\xcf\xc3\xd0\xc3\xd1\xc3\xd2\xc3\xd3\xc3\xd4\xc3\xd5\xc3\xd6\xc3\xd7\xc3\xd8\xc3\xd9\xc3\xda\xc3\xdb\xc3\xdc\xc3\xdd\xc3\xde\xc3\xdf\xc3\xe0\xc3\xe1\xc3\xe2\xc3\xe3\xc3\xe4\xc3\xe5\xc3\xe6\xc3\xe7\xc3\xe8\xc3\xe9\xc3\xea\xc3\xeb\xc3\xec\xc3\xed\xc3\xee\xc3\xef\xc3\xf0\xc3\xf1\xc3\xf2\xc3\xf3\xc3\xf4\xc3\xf5\xc3\xf6\xc3\xf7\xc3\xf8\xc3\xf9\xc3\xfa\xc3\xfb\xc3\xfc\xc3\xfd\xc4\x41\xc4\x42\xc4\x43\xc4\x44\xc4\x45\xc4\x46\xc4\x47\xc4\x48",
@@ -2603,152 +1132,49 @@ static uni16_t uni16[] = {
 /* f700 */ "\xe1\x7d\xe1\x7e\xe1\x7f\xe1\x81\xe1\x82\xe1\x83\xe1\x84\xe1\x85\xe1\x86\xe1\x87\xe1\x88\xe1\x89\xe1\x8a\xe1\x8b\xe1\x8c\xe1\x8d\xe1\x8e\xe1\x8f\xe1\x90\xe1\x91\xe1\x92\xe1\x93\xe1\x94\xe1\x95\xe1\x96\xe1\x97\xe1\x98\xe1\x99\xe1\x9a\xe1\x9b\xe1\x9c\xe1\x9d\xe1\x9e\xe1\x9f\xe1\xa0\xe1\xa1\xe1\xa2\xe1\xa3\xe1\xa4\xe1\xa5\xe1\xa6\xe1\xa7\xe1\xa8\xe1\xa9\xe1\xaa\xe1\xab\xe1\xac\xe1\xad\xe1\xae\xe1\xaf\xe1\xb0\xe1\xb1\xe1\xb2\xe1\xb3\xe1\xb4\xe1\xb5\xe1\xb6\xe1\xb7\xe1\xb8\xe1\xb9\xe1\xba\xe1\xbb\xe1\xbc\xe1\xbd\xe1\xbe\xe1\xbf\xe1\xc0\xe1\xc1\xe1\xc2\xe1\xc3\xe1\xc4\xe1\xc5\xe1\xc6\xe1\xc7\xe1\xc8\xe1\xc9\xe1\xca\xe1\xcb\xe1\xcc\xe1\xcd\xe1\xce\xe1\xcf\xe1\xd0\xe1\xd1\xe1\xd2\xe1\xd3\xe1\xd4\xe1\xd5\xe1\xd6\xe1\xd7\xe1\xd8\xe1\xd9\xe1\xda\xe1\xdb\xe1\xdc\xe1\xdd\xe1\xde\xe1\xdf\xe1\xe0\xe1\xe1\xe1\xe2\xe1\xe3\xe1\xe4\xe1\xe5\xe1\xe6\xe1\xe7\xe1\xe8\xe1\xe9\xe1\xea\xe1\xeb\xe1\xec\xe1\xed\xe1\xee\xe1\xef\xe1\xf0\xe1\xf1\xe1\xf2\xe1\xf3\xe1\xf4\xe1\xf5\xe1\xf6\xe1\xf7\xe1\xf8\xe1\xf9\xe1\xfa\xe1\xfb\xe1\xfc\xe1\xfd",
 /* f780 */ "\xe2\x41\xe2\x42\xe2\x43\xe2\x44\xe2\x45\xe2\x46\xe2\x47\xe2\x48\xe2\x49\xe2\x4a\xe2\x4b\xe2\x4c\xe2\x4d\xe2\x4e\xe2\x4f\xe2\x50\xe2\x51\xe2\x52\xe2\x53\xe2\x54\xe2\x55\xe2\x56\xe2\x57\xe2\x58\xe2\x59\xe2\x5a\xe2\x5b\xe2\x5c\xe2\x5d\xe2\x5e\xe2\x5f\xe2\x60\xe2\x61\xe2\x62\xe2\x63\xe2\x64\xe2\x65\xe2\x66\xe2\x67\xe2\x68\xe2\x69\xe2\x6a\xe2\x6b\xe2\x6c\xe2\x6d\xe2\x6e\xe2\x6f\xe2\x70\xe2\x71\xe2\x72\xe2\x73\xe2\x74\xe2\x75\xe2\x76\xe2\x77\xe2\x78\xe2\x79\xe2\x7a\xe2\x7b\xe2\x7c\xe2\x7d\xe2\x7e\xe2\x7f\xe2\x81\xe2\x82\xe2\x83\xe2\x84\xe2\x85\xe2\x86\xe2\x87\xe2\x88\xe2\x89\xe2\x8a\xe2\x8b\xe2\x8c\xe2\x8d\xe2\x8e\xe2\x8f\xe2\x90\xe2\x91\xe2\x92\xe2\x93\xe2\x94\xe2\x95\xe2\x96\xe2\x97\xe2\x98\xe2\x99\xe2\x9a\xe2\x9b\xe2\x9c\xe2\x9d\xe2\x9e\xe2\x9f\xe2\xa0\xe2\xa1\xe2\xa2\xe2\xa3\xe2\xa4\xe2\xa5\xe2\xa6\xe2\xa7\xe2\xa8\xe2\xa9\xe2\xaa\xe2\xab\xe2\xac\xe2\xad\xe2\xae\xe2\xaf\xe2\xb0\xe2\xb1\xe2\xb2\xe2\xb3\xe2\xb4\xe2\xb5\xe2\xb6\xe2\xb7\xe2\xb8\xe2\xb9\xe2\xba\xe2\xbb\xe2\xbc\xe2\xbd\xe2\xbe\xe2\xbf\xe2\xc0\xe2\xc1",
 /* f800 */ "\xe2\xc2\xe2\xc3\xe2\xc4\xe2\xc5\xe2\xc6\xe2\xc7\xe2\xc8\xe2\xc9\xe2\xca\xe2\xcb\xe2\xcc\xe2\xcd\xe2\xce\xe2\xcf\xe2\xd0\xe2\xd1\xe2\xd2\xe2\xd3\xe2\xd4\xe2\xd5\xe2\xd6\xe2\xd7\xe2\xd8\xe2\xd9\xe2\xda\xe2\xdb\xe2\xdc\xe2\xdd\xe2\xde\xe2\xdf\xe2\xe0\xe2\xe1\xe2\xe2\xe2\xe3\xe2\xe4\xe2\xe5\xe2\xe6\xe2\xe7\xe2\xe8\xe2\xe9\xe2\xea\xe2\xeb\xe2\xec\xe2\xed\xe2\xee\xe2\xef\xe2\xf0\xe2\xf1\xe2\xf2\xe2\xf3\xe2\xf4\xe2\xf5\xe2\xf6\xe2\xf7\xe2\xf8\xe2\xf9\xe2\xfa\xe2\xfb\xe2\xfc\xe2\xfd\x00\x00\x00\x00\x44\x5c\x46\xa8\x46\xa9\x46\xaa\x46\xab\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* f880 */ NULL,
-/* f900 */ NULL,
-/* f980 */ NULL,
 /* fa00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x69\x4b\x7a\xa4\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* fa80 */ NULL,
-/* fb00 */ NULL,
-/* fb80 */ NULL,
-/* fc00 */ NULL,
-/* fc80 */ NULL,
-/* fd00 */ NULL,
-/* fd80 */ NULL,
 /* fe00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x47\x41\x46\xa7\x47\x49\x46\xb6\x46\xbc\x46\xac\x46\xad\x46\xae\x46\xaf\x46\xb0\x46\xb1\x46\xa4\x46\xa5\x46\xb2\x46\xb3\x46\xb4\x46\xb5\x46\xa0\x46\xa1\x46\xa2\x46\xa3\x00\x00\x00\x00\x00\x00\x00\x00\x46\xbe\x46\xbf\x46\xc2\x46\xc3\x46\xc0\x46\xc1\x46\xbd\x47\x42\x47\x43\x47\x44\x00\x00\x47\x45\x47\x46\x47\x47\x47\x48\x47\x4a\x47\x4b\x47\x4c\x47\x4d\x47\x4e\x47\x4f\x47\x50\x47\x53\x47\x54\x46\xc4\x47\x55\x47\x56\x47\x57\x47\x58\x47\x59\x00\x00\x47\x5a\x47\x5b\x47\x5c\x47\x5d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* fe80 */ NULL,
 /* ff00 */ "\x00\x00\x42\x5a\x42\x7f\x42\x7b\x42\xe0\x42\x6c\x42\x50\x42\x7d\x42\x4d\x42\x5d\x46\xb8\x42\x4e\x42\x6b\x42\x60\x42\x4b\x42\x61\x42\xf0\x42\xf1\x42\xf2\x42\xf3\x42\xf4\x42\xf5\x42\xf6\x42\xf7\x42\xf8\x42\xf9\x42\x7a\x42\x5e\x42\x4c\x42\x7e\x42\x6e\x42\x6f\x42\x7c\x42\xc1\x42\xc2\x42\xc3\x42\xc4\x42\xc5\x42\xc6\x42\xc7\x42\xc8\x42\xc9\x42\xd1\x42\xd2\x42\xd3\x42\xd4\x42\xd5\x42\xd6\x42\xd7\x42\xd8\x42\xd9\x42\xe2\x42\xe3\x42\xe4\x42\xe5\x42\xe6\x42\xe7\x42\xe8\x42\xe9\x44\x44\x43\xe0\x44\x45\x44\x70\x42\x6d\x00\x00\x42\x81\x42\x82\x42\x83\x42\x84\x42\x85\x42\x86\x42\x87\x42\x88\x42\x89\x42\x91\x42\x92\x42\x93\x42\x94\x42\x95\x42\x96\x42\x97\x42\x98\x42\x99\x42\xa2\x42\xa3\x42\xa4\x42\xa5\x42\xa6\x42\xa7\x42\xa8\x42\xa9\x42\xc0\x42\x4f\x42\xd0\x43\xa1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* ff80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x4a\x42\x4a\x42\x5f\x47\x51\x42\x6a\x42\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-/* EBCDIC DBCS to Unicode translation table for ibm-937_P110-1999 */ {
-/* 0000 */ NULL,
-/* 0080 */ NULL,
-/* 0100 */ NULL,
-/* 0180 */ NULL,
-/* 0200 */ NULL,
-/* 0280 */ NULL,
-/* 0300 */ NULL,
-/* 0380 */ NULL,
-/* 0400 */ NULL,
-/* 0480 */ NULL,
-/* 0500 */ NULL,
-/* 0580 */ NULL,
-/* 0600 */ NULL,
-/* 0680 */ NULL,
-/* 0700 */ NULL,
-/* 0780 */ NULL,
-/* 0800 */ NULL,
-/* 0880 */ NULL,
-/* 0900 */ NULL,
-/* 0980 */ NULL,
-/* 0a00 */ NULL,
-/* 0a80 */ NULL,
-/* 0b00 */ NULL,
-/* 0b80 */ NULL,
-/* 0c00 */ NULL,
-/* 0c80 */ NULL,
-/* 0d00 */ NULL,
-/* 0d80 */ NULL,
-/* 0e00 */ NULL,
-/* 0e80 */ NULL,
-/* 0f00 */ NULL,
-/* 0f80 */ NULL,
-/* 1000 */ NULL,
-/* 1080 */ NULL,
-/* 1100 */ NULL,
-/* 1180 */ NULL,
-/* 1200 */ NULL,
-/* 1280 */ NULL,
-/* 1300 */ NULL,
-/* 1380 */ NULL,
-/* 1400 */ NULL,
-/* 1480 */ NULL,
-/* 1500 */ NULL,
-/* 1580 */ NULL,
-/* 1600 */ NULL,
-/* 1680 */ NULL,
-/* 1700 */ NULL,
-/* 1780 */ NULL,
-/* 1800 */ NULL,
-/* 1880 */ NULL,
-/* 1900 */ NULL,
-/* 1980 */ NULL,
-/* 1a00 */ NULL,
-/* 1a80 */ NULL,
-/* 1b00 */ NULL,
-/* 1b80 */ NULL,
-/* 1c00 */ NULL,
-/* 1c80 */ NULL,
-/* 1d00 */ NULL,
-/* 1d80 */ NULL,
-/* 1e00 */ NULL,
-/* 1e80 */ NULL,
-/* 1f00 */ NULL,
-/* 1f80 */ NULL,
-/* 2000 */ NULL,
-/* 2080 */ NULL,
-/* 2100 */ NULL,
-/* 2180 */ NULL,
-/* 2200 */ NULL,
-/* 2280 */ NULL,
-/* 2300 */ NULL,
-/* 2380 */ NULL,
-/* 2400 */ NULL,
-/* 2480 */ NULL,
-/* 2500 */ NULL,
-/* 2580 */ NULL,
-/* 2600 */ NULL,
-/* 2680 */ NULL,
-/* 2700 */ NULL,
-/* 2780 */ NULL,
-/* 2800 */ NULL,
-/* 2880 */ NULL,
-/* 2900 */ NULL,
-/* 2980 */ NULL,
-/* 2a00 */ NULL,
-/* 2a80 */ NULL,
-/* 2b00 */ NULL,
-/* 2b80 */ NULL,
-/* 2c00 */ NULL,
-/* 2c80 */ NULL,
-/* 2d00 */ NULL,
-/* 2d80 */ NULL,
-/* 2e00 */ NULL,
-/* 2e80 */ NULL,
-/* 2f00 */ NULL,
-/* 2f80 */ NULL,
-/* 3000 */ NULL,
-/* 3080 */ NULL,
-/* 3100 */ NULL,
-/* 3180 */ NULL,
-/* 3200 */ NULL,
-/* 3280 */ NULL,
-/* 3300 */ NULL,
-/* 3380 */ NULL,
-/* 3400 */ NULL,
-/* 3480 */ NULL,
-/* 3500 */ NULL,
-/* 3580 */ NULL,
-/* 3600 */ NULL,
-/* 3680 */ NULL,
-/* 3700 */ NULL,
-/* 3780 */ NULL,
-/* 3800 */ NULL,
-/* 3880 */ NULL,
-/* 3900 */ NULL,
-/* 3980 */ NULL,
-/* 3a00 */ NULL,
-/* 3a80 */ NULL,
-/* 3b00 */ NULL,
-/* 3b80 */ NULL,
-/* 3c00 */ NULL,
-/* 3c80 */ NULL,
-/* 3d00 */ NULL,
-/* 3d80 */ NULL,
-/* 3e00 */ NULL,
-/* 3e80 */ NULL,
-/* 3f00 */ NULL,
-/* 3f80 */ NULL,
+/* ff80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x4a\x42\x4a\x42\x5f\x47\x51\x42\x6a\x42\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+/* EBCDIC DBCS to Unicode translation table for ibm-937_P110-1999 */
+static const unsigned short cp937_ebc2u_ix[512] = {
+/* 0000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 0800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 4000 */ 1, 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 0, 11, 12, 13, 14,
+/* 4800 */ 15, 16, 17, 0, 0, 0, 0, 0, 18, 19, 20, 21, 22, 23, 24, 25,
+/* 5000 */ 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+/* 5800 */ 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+/* 6000 */ 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+/* 6800 */ 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+/* 7000 */ 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+/* 7800 */ 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+/* 8000 */ 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+/* 8800 */ 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153,
+/* 9000 */ 154, 155, 156, 157, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 9800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* a000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* a800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c000 */ 0, 0, 0, 0, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169,
+/* c800 */ 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185,
+/* d000 */ 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201,
+/* d800 */ 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+/* e000 */ 218, 219, 220, 221, 222, 223, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* e800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* f000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* f800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+static const uni16_row_t cp937_ebc2u[] = {
 /* 4000 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x30\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 4080 */ NULL,
 /* 4100 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\xb1\x03\xb2\x03\xb3\x03\xb4\x03\xb5\x03\xb6\x03\xb7\x03\xb8\x03\xb9\x03\xba\x03\xbb\x03\xbc\x03\xbd\x03\xbe\x03\xbf\x03\xc0\x03\xc1\x03\xc3\x03\xc4\x03\xc5\x03\xc6\x03\xc7\x03\xc8\x03\xc9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\x91\x03\x92\x03\x93\x03\x94\x03\x95\x03\x96\x03\x97\x03\x98\x03\x99\x03\x9a\x03\x9b\x03\x9c\x03\x9d\x03\x9e\x03\x9f\x03\xa0\x03\xa1\x03\xa3\x03\xa4\x03\xa5\x03\xa6\x03\xa7\x03\xa8\x03\xa9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 4180 */ "\x04\x30\x04\x31\x04\x32\x04\x33\x04\x34\x04\x35\x04\x51\x04\x36\x04\x37\x04\x38\x04\x39\x04\x3a\x04\x3b\x04\x3c\x04\x3d\x04\x3e\x04\x3f\x04\x40\x04\x41\x04\x42\x04\x43\x04\x44\x04\x45\x04\x46\x04\x47\x04\x48\x04\x49\x04\x4a\x04\x4b\x04\x4c\x04\x4d\x04\x4e\x04\x4f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x21\x70\x21\x71\x21\x72\x21\x73\x21\x74\x21\x75\x21\x76\x21\x77\x21\x78\x21\x79\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x04\x10\x04\x11\x04\x12\x04\x13\x04\x14\x04\x15\x04\x01\x04\x16\x04\x17\x04\x18\x04\x19\x04\x1a\x04\x1b\x04\x1c\x04\x1d\x04\x1e\x04\x1f\x04\x20\x04\x21\x04\x22\x04\x23\x04\x24\x04\x25\x04\x26\x04\x27\x04\x28\x04\x29\x04\x2a\x04\x2b\x04\x2c\x04\x2d\x04\x2e\x04\x2f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x21\x60\x21\x61\x21\x62\x21\x63\x21\x64\x21\x65\x21\x66\x21\x67\x21\x68\x21\x69\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 4200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xe1\xff\x0e\xff\x1c\xff\x08\xff\x0b\xff\x5c\xff\x06\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x01\xff\xe5\x27\x3d\xff\x09\xff\x1b\xff\xe2\xff\x0d\xff\x0f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xe4\xff\x0c\xff\x05\xff\x3f\xff\x1e\xff\x1f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x20\x35\xff\x1a\xff\x03\xff\x20\xff\x07\xff\x1d\xff\x02",
@@ -2758,7 +1184,6 @@ static uni16_t uni16[] = {
 /* 4400 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x30\x0e\x30\x0f\xff\x3b\xff\x3d\x30\x92\x30\x41\x30\x43\x30\x45\x20\x14\x00\xb1\x22\x60\x22\x1e\x21\x03\x00\x00\x20\x32\x30\x47\x30\x49\x30\x83\x30\x85\x30\x87\x30\x63\x30\x8e\x00\x00\x00\x00\x20\x10\x02\xba\xf8\x3e\x30\x05\x30\x06\x30\x07\x00\xa8\x20\x18\x20\x1c\x30\x14\x30\x08\x30\x0a\x30\x10\x22\x66\x22\x34\x26\x42\x00\xa7\x20\x3b\x30\x12\x32\x31\x21\x16\x21\x21\xff\x3e\x20\x19\x20\x1d\x30\x15\x30\x09\x30\x0b\x30\x11\x22\x67\x22\x35\x26\x40\x00\xd7\x00\xf7\x22\x25\x30\x13\x20\x25\x20\x26",
 /* 4480 */ "\x00\x00\x30\x42\x30\x44\x30\x46\x30\x48\x30\x4a\x30\x4b\x30\x4d\x30\x4f\x30\x51\x30\x53\x00\x00\x30\x55\x30\x57\x30\x59\x30\x5b\x30\x5d\x30\x5f\x30\x61\x30\x64\x30\x66\x30\x68\x30\x6a\x30\x6b\x30\x6c\x30\x6d\x30\x6e\x00\x00\x00\x00\x30\x6f\x30\x72\x30\x75\x00\x00\x00\x00\x30\x78\x30\x7b\x30\x7e\x30\x7f\x30\x80\x30\x81\x30\x82\x30\x84\x30\x86\x00\x00\x30\x88\x30\x89\x30\x8a\x30\x8b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x30\x8c\x30\x8d\x30\x8f\x30\x93\x00\x00\x00\x00\x30\x4c\x30\x4e\x30\x50\x30\x52\x30\x54\x30\x56\x30\x58\x30\x5a\x30\x5c\x30\x5e\x30\x60\x30\x62\x30\x65\x30\x67\x30\x69\x30\x70\x30\x73\x30\x76\x30\x79\x30\x7c\x00\x00\x30\x71\x30\x74\x30\x77\x30\x7a\x30\x7d\x30\x90\x30\x91\x30\x9d\x30\x9e\x00\x00\x00\x00\x25\xcb\x25\xcf\x25\xb3\x25\xb2\x25\xce\x26\x06\x26\x05\x25\xc7\x25\xc6\x25\xa1\x25\xa0\x25\xbd\x25\xbc\x00\xb0\x00\xb4\x20\x33\x21\x92\x21\x90\x21\x91\x21\x93\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 4500 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x30\x21\x30\x22\x30\x23\x30\x24\x30\x25\x30\x26\x30\x27\x30\x28\x30\x29\x53\x41\x53\x44\x53\x45\x00\x00\x00\x00\x00\x00\x00\x00\x02\xc9\x02\xca\x02\xc7\x02\xcb\x02\xd9\x31\x05\x31\x06\x31\x07\x31\x08\x31\x09\x31\x0a\x31\x0b\x31\x0c\x31\x0d\x31\x0e\x31\x0f\x31\x10\x31\x11\x31\x12\x31\x13\x31\x14\x31\x15\x31\x16\x31\x17\x31\x18\x31\x19\x31\x1a\x31\x1b\x31\x1c\x31\x1d\x31\x1e\x31\x1f\x31\x20\x31\x21\x31\x22\x31\x23\x31\x24\x31\x25\x31\x26\x31\x27\x31\x28\x31\x29\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 4580 */ NULL,
 /* 4600 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x24\x60\x24\x61\x24\x62\x24\x63\x24\x64\x24\x65\x24\x66\x24\x67\x24\x68\x24\x69\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x24\x74\x24\x75\x24\x76\x24\x77\x24\x78\x24\x79\x24\x7a\x24\x7b\x24\x7c\x24\x7d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x25\x81\x25\x82\x25\x83\x25\x84\x25\x85\x25\x86\x25\x87\x25\x88\x25\x8f\x25\x8e\x25\x8d\x25\x8c\x25\x8b\x25\x8a\x25\x89\x25\x3c\x25\x34\x25\x2c\x25\x24\x25\x1c\x25\x94\x25\x00\x25\x02\x25\x95\x25\x0c\x25\x10\x25\x14\x25\x18\x25\x6d\x25\x6e\x25\x70\x25\x6f",
 /* 4680 */ "\x00\x00\x25\x50\x25\x5e\x25\x6a\x25\x61\x25\xe2\x25\xe3\x25\xe5\x25\xe4\x25\x71\x25\x72\x25\x73\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfe\x41\xfe\x42\xfe\x43\xfe\x44\xfe\x3b\xfe\x3c\x00\x00\xfe\x31\xf8\x3f\xf8\x40\xf8\x41\xf8\x42\xfe\x35\xfe\x36\xfe\x37\xfe\x38\xfe\x39\xfe\x3a\xfe\x3d\xfe\x3e\xfe\x3f\xfe\x40\xfe\x33\x25\x74\xff\x0a\x30\x03\x32\xa3\x21\x05\xfe\x34\xfe\x4f\xfe\x49\xfe\x4a\xfe\x4d\xfe\x4e\xfe\x4b\xfe\x4c\xfe\x61\x22\x1a\x22\x52\x22\x61\x22\x29\x22\x2a\x22\xa5\x22\x20\x22\x1f\x22\xbf\x33\xd2\x33\xd1\x22\x2b\x22\x2e\x22\x95\x22\x99\x21\x96\x21\x97\x21\x99\x21\x98\x00\x00\x00\x00\x22\x15\x21\x09\x33\xd5\x33\x9c\x33\x9d\x33\x9e\x33\xce\x33\xa1\x33\x8e\x33\x8f\x33\xc4\x00\xb7\x00\x00\x00\x00\x00\x00\x30\x1d\x30\x1e\x00\x00\x00\x00\x00\x00\x21\xe7\x21\xb8\x21\xb9\x51\x59\x51\x5b\x51\x5e\x51\x5d\x51\x61\x51\x63\x55\xe7\x74\xe9\x7c\xce\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 4700 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfe\x30\xfe\x50\xfe\x51\xfe\x52\xfe\x54\xfe\x55\xfe\x56\xfe\x57\xfe\x32\xfe\x58\xfe\x59\xfe\x5a\xfe\x5b\xfe\x5c\xfe\x5d\xfe\x5e\xff\xe3\x02\xcd\xfe\x5f\xfe\x60\xfe\x62\xfe\x63\xfe\x64\xfe\x65\xfe\x66\xfe\x68\xfe\x69\xfe\x6a\xfe\x6b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
@@ -2766,11 +1191,6 @@ static uni16_t uni16[] = {
 /* 4800 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4e\x00\x4e\x28\x4e\x36\x4e\x3f\x4e\x59\x4e\x85\x4e\x8c\x4e\xa0\x4e\xba\x51\x3f\x51\x65\x51\x6b\x51\x82\x51\x96\x51\xab\x51\xe0\x51\xf5\x52\x00\x52\x9b\x52\xf9\x53\x15\x53\x1a\x53\x38\x53\x41\x53\x5c\x53\x69\x53\x82\x53\xb6\x53\xc8\x53\xe3\x56\xd7\x57\x1f\x58\xeb\x59\x0a\x59\x15\x59\x27\x59\x73\x5b\x50\x5b\x80\x5b\xf8\x5c\x0f\x5c\x22\x5c\x38\x5c\x6e\x5c\x71\x5d\xdb\x5d\xe5\x5d\xf1\x5d\xfe\x5e\x72\x5e\x7a\x5e\x7f\x5e\xf4\x5e\xfe\x5f\x0b\x5f\x13\x5f\x50\x5f\x61\x5f\x73\x5f\xc3\x62\x08\x62\x36\x62\x4b",
 /* 4880 */ "\x00\x00\x65\x2f\x65\x34\x65\x87\x65\x97\x65\xa4\x65\xb9\x65\xe0\x65\xe5\x66\xf0\x67\x08\x67\x28\x6b\x20\x6b\x62\x6b\x79\x6b\xb3\x6b\xcb\x6b\xd4\x6b\xdb\x6c\x0f\x6c\x14\x6c\x34\x70\x6b\x72\x2a\x72\x36\x72\x3b\x72\x3f\x72\x47\x72\x59\x72\x5b\x72\xac\x73\x84\x73\x89\x74\xdc\x74\xe6\x75\x18\x75\x1f\x75\x28\x75\x30\x75\x8b\x75\x92\x76\x76\x76\x7d\x76\xae\x76\xbf\x76\xee\x77\xdb\x77\xe2\x77\xf3\x79\x3a\x79\xb8\x79\xbe\x7a\x74\x7a\xcb\x7a\xf9\x7c\x73\x7c\xf8\x7f\x36\x7f\x51\x7f\x8a\x7f\xbd\x80\x01\x80\x0c\x80\x12\x80\x33\x80\x7f\x80\x89\x81\xe3\x81\xea\x81\xf3\x81\xfc\x82\x0c\x82\x1b\x82\x1f\x82\x6e\x82\x72\x82\x78\x86\x4d\x86\x6b\x88\x40\x88\x4c\x88\x63\x89\x7e\x89\x8b\x89\xd2\x8a\x00\x8c\x37\x8c\x46\x8c\x55\x8c\x78\x8c\x9d\x8d\x64\x8d\x70\x8d\xb3\x8e\xab\x8e\xca\x8f\x9b\x8f\xb0\x8f\xb5\x90\x91\x91\x49\x91\xc6\x91\xcc\x91\xd1\x95\x77\x95\x80\x96\x1c\x96\xb6\x96\xb9\x96\xe8\x97\x52\x97\x5e\x97\x62\x97\x69\x97\xcb\x97\xed\x97\xf3\x98\x01\x98\xa8\x98\xdb\x98\xdf\x99\x96\x99\x99\x99\xac\x9a\xa8\x9a\xd8\x00\x00\x00\x00",
 /* 4900 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x9a\xdf\x9b\x25\x9b\x2f\x9b\x32\x9b\x3c\x9b\x5a\x9c\xe5\x9e\x75\x9e\x7f\x9e\xa5\x9e\xbb\x9e\xc3\x9e\xcd\x9e\xd1\x9e\xf9\x9e\xfd\x9f\x0e\x9f\x13\x9f\x20\x9f\x3b\x9f\x4a\x9f\x52\x9f\x8d\x9f\x9c\x9f\xa0\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 4980 */ NULL,
-/* 4a00 */ NULL,
-/* 4a80 */ NULL,
-/* 4b00 */ NULL,
-/* 4b80 */ NULL,
 /* 4c00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4e\x00\x4e\x59\x4e\x01\x4e\x03\x4e\x43\x4e\x5d\x4e\x86\x4e\x8c\x4e\xba\x51\x3f\x51\x65\x51\x6b\x51\xe0\x52\x00\x52\x01\x52\x9b\x53\x15\x53\x41\x53\x5c\x53\xc8\x4e\x09\x4e\x0b\x4e\x08\x4e\x0a\x4e\x2b\x4e\x38\x51\xe1\x4e\x45\x4e\x48\x4e\x5f\x4e\x5e\x4e\x8e\x4e\xa1\x51\x40\x52\x03\x52\xfa\x53\x43\x53\xc9\x53\xe3\x57\x1f\x58\xeb\x59\x15\x59\x27\x59\x73\x5b\x50\x5b\x51\x5b\x53\x5b\xf8\x5c\x0f\x5c\x22\x5c\x38\x5c\x71\x5d\xdd\x5d\xe5\x5d\xf1\x5d\xf2\x5d\xf3\x5d\xfe\x5e\x72\x5e\xfe\x5f\x0b\x5f\x13\x62\x4d",
 /* 4c80 */ "\x00\x00\x4e\x11\x4e\x10\x4e\x0d\x4e\x2d\x4e\x30\x4e\x39\x4e\x4b\x5c\x39\x4e\x88\x4e\x91\x4e\x95\x4e\x92\x4e\x94\x4e\xa2\x4e\xc1\x4e\xc0\x4e\xc3\x4e\xc6\x4e\xc7\x4e\xcd\x4e\xca\x4e\xcb\x4e\xc4\x51\x43\x51\x41\x51\x67\x51\x6d\x51\x6e\x51\x6c\x51\x97\x51\xf6\x52\x06\x52\x07\x52\x08\x52\xfb\x52\xfe\x52\xff\x53\x16\x53\x39\x53\x48\x53\x47\x53\x45\x53\x5e\x53\x84\x53\xcb\x53\xca\x53\xcd\x58\xec\x59\x29\x59\x2b\x59\x2a\x59\x2d\x5b\x54\x5c\x11\x5c\x24\x5c\x3a\x5c\x6f\x5d\xf4\x5e\x7b\x5e\xff\x5f\x14\x5f\x15\x5f\xc3\x62\x08\x62\x36\x62\x4b\x62\x4e\x65\x2f\x65\x87\x65\x97\x65\xa4\x65\xb9\x65\xe5\x66\xf0\x67\x08\x67\x28\x6b\x20\x6b\x62\x6b\x79\x6b\xcb\x6b\xd4\x6b\xdb\x6c\x0f\x6c\x34\x70\x6b\x72\x2a\x72\x36\x72\x3b\x72\x47\x72\x59\x72\x5b\x72\xac\x73\x8b\x4e\x19\x4e\x16\x4e\x15\x4e\x14\x4e\x18\x4e\x3b\x4e\x4d\x4e\x4f\x4e\x4e\x4e\xe5\x4e\xd8\x4e\xd4\x4e\xd5\x4e\xd6\x4e\xd7\x4e\xe3\x4e\xe4\x4e\xd9\x4e\xde\x51\x45\x51\x44\x51\x89\x51\x8a\x51\xac\x51\xf9\x51\xfa\x51\xf8\x52\x0a\x52\xa0\x52\x9f\x53\x05\x53\x06\x00\x00\x00\x00",
 /* 4d00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x53\x17\x53\x1d\x4e\xdf\x53\x4a\x53\x49\x53\x61\x53\x60\x53\x6f\x53\x6e\x53\xbb\x53\xef\x53\xe4\x53\xf3\x53\xec\x53\xee\x53\xe9\x53\xe8\x53\xfc\x53\xf8\x53\xf5\x53\xeb\x53\xe6\x53\xea\x53\xf2\x53\xf1\x53\xf0\x53\xe5\x53\xed\x53\xfb\x56\xdb\x56\xda\x59\x16\x59\x2e\x59\x31\x59\x74\x59\x76\x5b\x55\x5b\x83\x5c\x3c\x5d\xe8\x5d\xe7\x5d\xe6\x5e\x02\x5e\x03\x5e\x73\x5e\x7c\x5f\x01\x5f\x18\x5f\x17\x5f\xc5\x62\x0a\x62\x53\x62\x54\x62\x52\x62\x51\x65\xa5\x65\xe6\x67\x2e\x67\x2c\x67\x2a\x67\x2b\x67\x2d\x6b\x63",
@@ -2911,102 +1331,6 @@ static uni16_t uni16[] = {
 /* 9080 */ "\x00\x00\x97\xc5\x98\x00\x9a\x56\x9a\x59\x9b\x1e\x9b\x1f\x9b\x20\x9c\x52\x9c\x58\x9c\x50\x9c\x4a\x9c\x4d\x9c\x4b\x9c\x55\x9c\x59\x9c\x4c\x9c\x4e\x9d\xfb\x9d\xf7\x9d\xef\x9d\xe3\x9d\xeb\x9d\xf8\x9d\xe4\x9d\xf6\x9d\xe1\x9d\xee\x9d\xe6\x9d\xf2\x9d\xf0\x9d\xe2\x9d\xec\x9d\xf4\x9d\xf3\x9d\xe8\x9d\xed\x9e\xc2\x9e\xd0\x9e\xf2\x9e\xf3\x9f\x06\x9f\x1c\x9f\x38\x9f\x37\x9f\x36\x9f\x43\x9f\x4f\x9f\x71\x9f\x70\x9f\x6e\x9f\x6f\x56\xd3\x56\xcd\x5b\x4e\x5c\x6d\x65\x2d\x66\xed\x66\xee\x6b\x13\x70\x5f\x70\x61\x70\x5d\x70\x60\x72\x23\x74\xdb\x74\xe5\x77\xd5\x79\x38\x79\xb7\x79\xb6\x7c\x6a\x7e\x97\x7f\x89\x82\x6d\x86\x43\x88\x38\x88\x37\x88\x35\x88\x4b\x8b\x94\x8b\x95\x8e\x9e\x8e\x9f\x8e\xa0\x8e\x9d\x91\xbe\x91\xbd\x91\xc2\x94\x6b\x94\x68\x94\x69\x96\xe5\x97\x46\x97\x43\x97\x47\x97\xc7\x97\xe5\x9a\x5e\x9a\xd5\x9b\x59\x9c\x63\x9c\x67\x9c\x66\x9c\x62\x9c\x5e\x9c\x60\x9e\x02\x9d\xfe\x9e\x07\x9e\x03\x9e\x06\x9e\x05\x9e\x00\x9e\x01\x9e\x09\x9d\xff\x9d\xfd\x9e\x04\x9e\xa0\x9f\x1e\x9f\x46\x9f\x74\x9f\x75\x9f\x76\x56\xd4\x00\x00\x00\x00",
 /* 9100 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x65\x2e\x65\xb8\x6b\x18\x6b\x19\x6b\x17\x6b\x1a\x70\x62\x72\x26\x72\xaa\x77\xd8\x77\xd9\x79\x39\x7c\x69\x7c\x6b\x7c\xf6\x7e\x9a\x7e\x98\x7e\x9b\x7e\x99\x81\xe0\x81\xe1\x86\x46\x86\x47\x86\x48\x89\x79\x89\x7a\x89\x7c\x89\x7b\x89\xff\x8b\x98\x8b\x99\x8e\xa5\x8e\xa4\x8e\xa3\x94\x6e\x94\x6d\x94\x6f\x94\x71\x94\x73\x97\x49\x98\x72\x99\x5f\x9c\x68\x9c\x6e\x9c\x6d\x9e\x0b\x9e\x0d\x9e\x10\x9e\x0f\x9e\x12\x9e\x11\x9e\xa1\x9e\xf5\x9f\x09\x9f\x47\x9f\x78\x9f\x7b\x9f\x7a\x9f\x79\x57\x1e\x70\x66\x7c\x6f\x88\x3c",
 /* 9180 */ "\x00\x00\x8d\xb2\x8e\xa6\x91\xc3\x94\x74\x94\x78\x94\x76\x94\x75\x9a\x60\x9c\x74\x9c\x73\x9c\x71\x9c\x75\x9e\x14\x9e\x13\x9e\xf6\x9f\x0a\x9f\xa4\x70\x68\x70\x65\x7c\xf7\x86\x6a\x88\x3e\x88\x3d\x88\x3f\x8b\x9e\x8c\x9c\x8e\xa9\x8e\xc9\x97\x4b\x98\x73\x98\x74\x98\xcc\x99\x61\x99\xab\x9a\x64\x9a\x66\x9a\x67\x9b\x24\x9e\x15\x9e\x17\x9f\x48\x62\x07\x6b\x1e\x72\x27\x86\x4c\x8e\xa8\x94\x82\x94\x80\x94\x81\x9a\x69\x9a\x68\x9b\x2e\x9e\x19\x72\x29\x86\x4b\x8b\x9f\x94\x83\x9c\x79\x9e\xb7\x76\x75\x9a\x6b\x9c\x7a\x9e\x1d\x70\x69\x70\x6a\x9e\xa4\x9f\x7e\x9f\x49\x9f\x98\x69\x1e\x6e\xb8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 9200 */ NULL,
-/* 9280 */ NULL,
-/* 9300 */ NULL,
-/* 9380 */ NULL,
-/* 9400 */ NULL,
-/* 9480 */ NULL,
-/* 9500 */ NULL,
-/* 9580 */ NULL,
-/* 9600 */ NULL,
-/* 9680 */ NULL,
-/* 9700 */ NULL,
-/* 9780 */ NULL,
-/* 9800 */ NULL,
-/* 9880 */ NULL,
-/* 9900 */ NULL,
-/* 9980 */ NULL,
-/* 9a00 */ NULL,
-/* 9a80 */ NULL,
-/* 9b00 */ NULL,
-/* 9b80 */ NULL,
-/* 9c00 */ NULL,
-/* 9c80 */ NULL,
-/* 9d00 */ NULL,
-/* 9d80 */ NULL,
-/* 9e00 */ NULL,
-/* 9e80 */ NULL,
-/* 9f00 */ NULL,
-/* 9f80 */ NULL,
-/* a000 */ NULL,
-/* a080 */ NULL,
-/* a100 */ NULL,
-/* a180 */ NULL,
-/* a200 */ NULL,
-/* a280 */ NULL,
-/* a300 */ NULL,
-/* a380 */ NULL,
-/* a400 */ NULL,
-/* a480 */ NULL,
-/* a500 */ NULL,
-/* a580 */ NULL,
-/* a600 */ NULL,
-/* a680 */ NULL,
-/* a700 */ NULL,
-/* a780 */ NULL,
-/* a800 */ NULL,
-/* a880 */ NULL,
-/* a900 */ NULL,
-/* a980 */ NULL,
-/* aa00 */ NULL,
-/* aa80 */ NULL,
-/* ab00 */ NULL,
-/* ab80 */ NULL,
-/* ac00 */ NULL,
-/* ac80 */ NULL,
-/* ad00 */ NULL,
-/* ad80 */ NULL,
-/* ae00 */ NULL,
-/* ae80 */ NULL,
-/* af00 */ NULL,
-/* af80 */ NULL,
-/* b000 */ NULL,
-/* b080 */ NULL,
-/* b100 */ NULL,
-/* b180 */ NULL,
-/* b200 */ NULL,
-/* b280 */ NULL,
-/* b300 */ NULL,
-/* b380 */ NULL,
-/* b400 */ NULL,
-/* b480 */ NULL,
-/* b500 */ NULL,
-/* b580 */ NULL,
-/* b600 */ NULL,
-/* b680 */ NULL,
-/* b700 */ NULL,
-/* b780 */ NULL,
-/* b800 */ NULL,
-/* b880 */ NULL,
-/* b900 */ NULL,
-/* b980 */ NULL,
-/* ba00 */ NULL,
-/* ba80 */ NULL,
-/* bb00 */ NULL,
-/* bb80 */ NULL,
-/* bc00 */ NULL,
-/* bc80 */ NULL,
-/* bd00 */ NULL,
-/* bd80 */ NULL,
-/* be00 */ NULL,
-/* be80 */ NULL,
-/* bf00 */ NULL,
-/* bf80 */ NULL,
-/* c000 */ NULL,
-/* c080 */ NULL,
-/* c100 */ NULL,
-/* c180 */ NULL,
 /* c200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe0\x00\xe0\x01\xe0\x02\xe0\x03\xe0\x04\xe0\x05\xe0\x06\xe0\x07\xe0\x08\xe0\x09\xe0\x0a\xe0\x0b\xe0\x0c\xe0\x0d\xe0\x0e\xe0\x0f\xe0\x10\xe0\x11\xe0\x12\xe0\x13\xe0\x14\xe0\x15\xe0\x16\xe0\x17\xe0\x18\xe0\x19\xe0\x1a\xe0\x1b\xe0\x1c\xe0\x1d\xe0\x1e\xe0\x1f\xe0\x20\xe0\x21\xe0\x22\xe0\x23\xe0\x24\xe0\x25\xe0\x26\xe0\x27\xe0\x28\xe0\x29\xe0\x2a\xe0\x2b\xe0\x2c\xe0\x2d\xe0\x2e\xe0\x2f\xe0\x30\xe0\x31\xe0\x32\xe0\x33\xe0\x34\xe0\x35\xe0\x36\xe0\x37\xe0\x38\xe0\x39\xe0\x3a\xe0\x3b\xe0\x3c\xe0\x3d\xe0\x3e",
 /* c280 */ "\x00\x00\xe0\x3f\xe0\x40\xe0\x41\xe0\x42\xe0\x43\xe0\x44\xe0\x45\xe0\x46\xe0\x47\xe0\x48\xe0\x49\xe0\x4a\xe0\x4b\xe0\x4c\xe0\x4d\xe0\x4e\xe0\x4f\xe0\x50\xe0\x51\xe0\x52\xe0\x53\xe0\x54\xe0\x55\xe0\x56\xe0\x57\xe0\x58\xe0\x59\xe0\x5a\xe0\x5b\xe0\x5c\xe0\x5d\xe0\x5e\xe0\x5f\xe0\x60\xe0\x61\xe0\x62\xe0\x63\xe0\x64\xe0\x65\xe0\x66\xe0\x67\xe0\x68\xe0\x69\xe0\x6a\xe0\x6b\xe0\x6c\xe0\x6d\xe0\x6e\xe0\x6f\xe0\x70\xe0\x71\xe0\x72\xe0\x73\xe0\x74\xe0\x75\xe0\x76\xe0\x77\xe0\x78\xe0\x79\xe0\x7a\xe0\x7b\xe0\x7c\xe0\x7d\xe0\x7e\xe0\x7f\xe0\x80\xe0\x81\xe0\x82\xe0\x83\xe0\x84\xe0\x85\xe0\x86\xe0\x87\xe0\x88\xe0\x89\xe0\x8a\xe0\x8b\xe0\x8c\xe0\x8d\xe0\x8e\xe0\x8f\xe0\x90\xe0\x91\xe0\x92\xe0\x93\xe0\x94\xe0\x95\xe0\x96\xe0\x97\xe0\x98\xe0\x99\xe0\x9a\xe0\x9b\xe0\x9c\xe0\x9d\xe0\x9e\xe0\x9f\xe0\xa0\xe0\xa1\xe0\xa2\xe0\xa3\xe0\xa4\xe0\xa5\xe0\xa6\xe0\xa7\xe0\xa8\xe0\xa9\xe0\xaa\xe0\xab\xe0\xac\xe0\xad\xe0\xae\xe0\xaf\xe0\xb0\xe0\xb1\xe0\xb2\xe0\xb3\xe0\xb4\xe0\xb5\xe0\xb6\xe0\xb7\xe0\xb8\xe0\xb9\xe0\xba\xe0\xbb\x00\x00\x00\x00",
 /* c300 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe0\xbc\xe0\xbd\xe0\xbe\xe0\xbf\xe0\xc0\xe0\xc1\xe0\xc2\xe0\xc3\xe0\xc4\xe0\xc5\xe0\xc6\xe0\xc7\xe0\xc8\xe0\xc9\xe0\xca\xe0\xcb\xe0\xcc\xe0\xcd\xe0\xce\xe0\xcf\xe0\xd0\xe0\xd1\xe0\xd2\xe0\xd3\xe0\xd4\xe0\xd5\xe0\xd6\xe0\xd7\xe0\xd8\xe0\xd9\xe0\xda\xe0\xdb\xe0\xdc\xe0\xdd\xe0\xde\xe0\xdf\xe0\xe0\xe0\xe1\xe0\xe2\xe0\xe3\xe0\xe4\xe0\xe5\xe0\xe6\xe0\xe7\xe0\xe8\xe0\xe9\xe0\xea\xe0\xeb\xe0\xec\xe0\xed\xe0\xee\xe0\xef\xe0\xf0\xe0\xf1\xe0\xf2\xe0\xf3\xe0\xf4\xe0\xf5\xe0\xf6\xe0\xf7\xe0\xf8\xe0\xf9\xe0\xfa",
@@ -3072,132 +1396,58 @@ static uni16_t uni16[] = {
 /* e100 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf6\xc4\xf6\xc5\xf6\xc6\xf6\xc7\xf6\xc8\xf6\xc9\xf6\xca\xf6\xcb\xf6\xcc\xf6\xcd\xf6\xce\xf6\xcf\xf6\xd0\xf6\xd1\xf6\xd2\xf6\xd3\xf6\xd4\xf6\xd5\xf6\xd6\xf6\xd7\xf6\xd8\xf6\xd9\xf6\xda\xf6\xdb\xf6\xdc\xf6\xdd\xf6\xde\xf6\xdf\xf6\xe0\xf6\xe1\xf6\xe2\xf6\xe3\xf6\xe4\xf6\xe5\xf6\xe6\xf6\xe7\xf6\xe8\xf6\xe9\xf6\xea\xf6\xeb\xf6\xec\xf6\xed\xf6\xee\xf6\xef\xf6\xf0\xf6\xf1\xf6\xf2\xf6\xf3\xf6\xf4\xf6\xf5\xf6\xf6\xf6\xf7\xf6\xf8\xf6\xf9\xf6\xfa\xf6\xfb\xf6\xfc\xf6\xfd\xf6\xfe\xf6\xff\xf7\x00\xf7\x01\xf7\x02",
 /* e180 */ "\x00\x00\xf7\x03\xf7\x04\xf7\x05\xf7\x06\xf7\x07\xf7\x08\xf7\x09\xf7\x0a\xf7\x0b\xf7\x0c\xf7\x0d\xf7\x0e\xf7\x0f\xf7\x10\xf7\x11\xf7\x12\xf7\x13\xf7\x14\xf7\x15\xf7\x16\xf7\x17\xf7\x18\xf7\x19\xf7\x1a\xf7\x1b\xf7\x1c\xf7\x1d\xf7\x1e\xf7\x1f\xf7\x20\xf7\x21\xf7\x22\xf7\x23\xf7\x24\xf7\x25\xf7\x26\xf7\x27\xf7\x28\xf7\x29\xf7\x2a\xf7\x2b\xf7\x2c\xf7\x2d\xf7\x2e\xf7\x2f\xf7\x30\xf7\x31\xf7\x32\xf7\x33\xf7\x34\xf7\x35\xf7\x36\xf7\x37\xf7\x38\xf7\x39\xf7\x3a\xf7\x3b\xf7\x3c\xf7\x3d\xf7\x3e\xf7\x3f\xf7\x40\xf7\x41\xf7\x42\xf7\x43\xf7\x44\xf7\x45\xf7\x46\xf7\x47\xf7\x48\xf7\x49\xf7\x4a\xf7\x4b\xf7\x4c\xf7\x4d\xf7\x4e\xf7\x4f\xf7\x50\xf7\x51\xf7\x52\xf7\x53\xf7\x54\xf7\x55\xf7\x56\xf7\x57\xf7\x58\xf7\x59\xf7\x5a\xf7\x5b\xf7\x5c\xf7\x5d\xf7\x5e\xf7\x5f\xf7\x60\xf7\x61\xf7\x62\xf7\x63\xf7\x64\xf7\x65\xf7\x66\xf7\x67\xf7\x68\xf7\x69\xf7\x6a\xf7\x6b\xf7\x6c\xf7\x6d\xf7\x6e\xf7\x6f\xf7\x70\xf7\x71\xf7\x72\xf7\x73\xf7\x74\xf7\x75\xf7\x76\xf7\x77\xf7\x78\xf7\x79\xf7\x7a\xf7\x7b\xf7\x7c\xf7\x7d\xf7\x7e\xf7\x7f\x00\x00\x00\x00",
 /* e200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf7\x80\xf7\x81\xf7\x82\xf7\x83\xf7\x84\xf7\x85\xf7\x86\xf7\x87\xf7\x88\xf7\x89\xf7\x8a\xf7\x8b\xf7\x8c\xf7\x8d\xf7\x8e\xf7\x8f\xf7\x90\xf7\x91\xf7\x92\xf7\x93\xf7\x94\xf7\x95\xf7\x96\xf7\x97\xf7\x98\xf7\x99\xf7\x9a\xf7\x9b\xf7\x9c\xf7\x9d\xf7\x9e\xf7\x9f\xf7\xa0\xf7\xa1\xf7\xa2\xf7\xa3\xf7\xa4\xf7\xa5\xf7\xa6\xf7\xa7\xf7\xa8\xf7\xa9\xf7\xaa\xf7\xab\xf7\xac\xf7\xad\xf7\xae\xf7\xaf\xf7\xb0\xf7\xb1\xf7\xb2\xf7\xb3\xf7\xb4\xf7\xb5\xf7\xb6\xf7\xb7\xf7\xb8\xf7\xb9\xf7\xba\xf7\xbb\xf7\xbc\xf7\xbd\xf7\xbe",
-/* e280 */ "\x00\x00\xf7\xbf\xf7\xc0\xf7\xc1\xf7\xc2\xf7\xc3\xf7\xc4\xf7\xc5\xf7\xc6\xf7\xc7\xf7\xc8\xf7\xc9\xf7\xca\xf7\xcb\xf7\xcc\xf7\xcd\xf7\xce\xf7\xcf\xf7\xd0\xf7\xd1\xf7\xd2\xf7\xd3\xf7\xd4\xf7\xd5\xf7\xd6\xf7\xd7\xf7\xd8\xf7\xd9\xf7\xda\xf7\xdb\xf7\xdc\xf7\xdd\xf7\xde\xf7\xdf\xf7\xe0\xf7\xe1\xf7\xe2\xf7\xe3\xf7\xe4\xf7\xe5\xf7\xe6\xf7\xe7\xf7\xe8\xf7\xe9\xf7\xea\xf7\xeb\xf7\xec\xf7\xed\xf7\xee\xf7\xef\xf7\xf0\xf7\xf1\xf7\xf2\xf7\xf3\xf7\xf4\xf7\xf5\xf7\xf6\xf7\xf7\xf7\xf8\xf7\xf9\xf7\xfa\xf7\xfb\xf7\xfc\xf7\xfd\xf7\xfe\xf7\xff\xf8\x00\xf8\x01\xf8\x02\xf8\x03\xf8\x04\xf8\x05\xf8\x06\xf8\x07\xf8\x08\xf8\x09\xf8\x0a\xf8\x0b\xf8\x0c\xf8\x0d\xf8\x0e\xf8\x0f\xf8\x10\xf8\x11\xf8\x12\xf8\x13\xf8\x14\xf8\x15\xf8\x16\xf8\x17\xf8\x18\xf8\x19\xf8\x1a\xf8\x1b\xf8\x1c\xf8\x1d\xf8\x1e\xf8\x1f\xf8\x20\xf8\x21\xf8\x22\xf8\x23\xf8\x24\xf8\x25\xf8\x26\xf8\x27\xf8\x28\xf8\x29\xf8\x2a\xf8\x2b\xf8\x2c\xf8\x2d\xf8\x2e\xf8\x2f\xf8\x30\xf8\x31\xf8\x32\xf8\x33\xf8\x34\xf8\x35\xf8\x36\xf8\x37\xf8\x38\xf8\x39\xf8\x3a\xf8\x3b\x00\x00\x00\x00",
-/* e300 */ NULL,
-/* e380 */ NULL,
-/* e400 */ NULL,
-/* e480 */ NULL,
-/* e500 */ NULL,
-/* e580 */ NULL,
-/* e600 */ NULL,
-/* e680 */ NULL,
-/* e700 */ NULL,
-/* e780 */ NULL,
-/* e800 */ NULL,
-/* e880 */ NULL,
-/* e900 */ NULL,
-/* e980 */ NULL,
-/* ea00 */ NULL,
-/* ea80 */ NULL,
-/* eb00 */ NULL,
-/* eb80 */ NULL,
-/* ec00 */ NULL,
-/* ec80 */ NULL,
-/* ed00 */ NULL,
-/* ed80 */ NULL,
-/* ee00 */ NULL,
-/* ee80 */ NULL,
-/* ef00 */ NULL,
-/* ef80 */ NULL,
-/* f000 */ NULL,
-/* f080 */ NULL,
-/* f100 */ NULL,
-/* f180 */ NULL,
-/* f200 */ NULL,
-/* f280 */ NULL,
-/* f300 */ NULL,
-/* f380 */ NULL,
-/* f400 */ NULL,
-/* f480 */ NULL,
-/* f500 */ NULL,
-/* f580 */ NULL,
-/* f600 */ NULL,
-/* f680 */ NULL,
-/* f700 */ NULL,
-/* f780 */ NULL,
-/* f800 */ NULL,
-/* f880 */ NULL,
-/* f900 */ NULL,
-/* f980 */ NULL,
-/* fa00 */ NULL,
-/* fa80 */ NULL,
-/* fb00 */ NULL,
-/* fb80 */ NULL,
-/* fc00 */ NULL,
-/* fc80 */ NULL,
-/* fd00 */ NULL,
-/* fd80 */ NULL,
-/* fe00 */ NULL,
-/* fe80 */ NULL,
-/* ff00 */ NULL,
-/* ff80 */ NULL }
-    },
-    { "cp1388", "0x03a90345" /* 937, 837 */,
-/* Unicode to EBCDIC DBCS translation table for ibm-1388_P103-2001 */ {
-/* 0000 */ NULL,
+/* e280 */ "\x00\x00\xf7\xbf\xf7\xc0\xf7\xc1\xf7\xc2\xf7\xc3\xf7\xc4\xf7\xc5\xf7\xc6\xf7\xc7\xf7\xc8\xf7\xc9\xf7\xca\xf7\xcb\xf7\xcc\xf7\xcd\xf7\xce\xf7\xcf\xf7\xd0\xf7\xd1\xf7\xd2\xf7\xd3\xf7\xd4\xf7\xd5\xf7\xd6\xf7\xd7\xf7\xd8\xf7\xd9\xf7\xda\xf7\xdb\xf7\xdc\xf7\xdd\xf7\xde\xf7\xdf\xf7\xe0\xf7\xe1\xf7\xe2\xf7\xe3\xf7\xe4\xf7\xe5\xf7\xe6\xf7\xe7\xf7\xe8\xf7\xe9\xf7\xea\xf7\xeb\xf7\xec\xf7\xed\xf7\xee\xf7\xef\xf7\xf0\xf7\xf1\xf7\xf2\xf7\xf3\xf7\xf4\xf7\xf5\xf7\xf6\xf7\xf7\xf7\xf8\xf7\xf9\xf7\xfa\xf7\xfb\xf7\xfc\xf7\xfd\xf7\xfe\xf7\xff\xf8\x00\xf8\x01\xf8\x02\xf8\x03\xf8\x04\xf8\x05\xf8\x06\xf8\x07\xf8\x08\xf8\x09\xf8\x0a\xf8\x0b\xf8\x0c\xf8\x0d\xf8\x0e\xf8\x0f\xf8\x10\xf8\x11\xf8\x12\xf8\x13\xf8\x14\xf8\x15\xf8\x16\xf8\x17\xf8\x18\xf8\x19\xf8\x1a\xf8\x1b\xf8\x1c\xf8\x1d\xf8\x1e\xf8\x1f\xf8\x20\xf8\x21\xf8\x22\xf8\x23\xf8\x24\xf8\x25\xf8\x26\xf8\x27\xf8\x28\xf8\x29\xf8\x2a\xf8\x2b\xf8\x2c\xf8\x2d\xf8\x2e\xf8\x2f\xf8\x30\xf8\x31\xf8\x32\xf8\x33\xf8\x34\xf8\x35\xf8\x36\xf8\x37\xf8\x38\xf8\x39\xf8\x3a\xf8\x3b\x00\x00\x00\x00"
+};
+
+/* Unicode to EBCDIC DBCS translation table for ibm-1388_P103-2001 */
+static const unsigned short cp1388_u2ebc_ix[512] = {
+/* 0000 */ 0, 1, 2, 3, 4, 5, 0, 6, 7, 0, 0, 0, 8, 9, 0, 0,
+/* 0800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 11,
+/* 1000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1800 */ 12, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2000 */ 14, 15, 16, 17, 18, 19, 20, 0, 21, 22, 23, 24, 25, 0, 0, 0,
+/* 2800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 26, 0, 27,
+/* 3000 */ 28, 29, 30, 0, 31, 32, 0, 33, 34, 35, 36, 37, 38, 39, 40, 41,
+/* 3800 */ 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57,
+/* 4000 */ 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73,
+/* 4800 */ 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+/* 5000 */ 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+/* 5800 */ 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121,
+/* 6000 */ 122, 123, 124, 125, 126, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137,
+/* 6800 */ 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153,
+/* 7000 */ 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169,
+/* 7800 */ 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185,
+/* 8000 */ 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201,
+/* 8800 */ 202, 203, 204, 205, 206, 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217,
+/* 9000 */ 218, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233,
+/* 9800 */ 234, 235, 236, 237, 238, 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249,
+/* a000 */ 250, 251, 252, 253, 254, 255, 256, 257, 258, 259, 0, 0, 0, 0, 0, 0,
+/* a800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* b800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* c800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* d800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* e000 */ 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270, 271, 272, 273, 274, 275,
+/* e800 */ 276, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* f000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* f800 */ 277, 0, 278, 279, 280, 0, 281, 282, 0, 0, 0, 0, 283, 284, 285, 286
+};
+static const uni16_row_t cp1388_u2ebc[] = {
 /* 0080 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x88\x00\x00\x00\x00\x44\x6a\x44\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xed\x44\x4b\x00\x00\x00\x00\x44\x50\x00\x00\x00\x00\x43\x45\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x7a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x44\x46\x42\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x48\x46\x46\x46\x5a\x00\x00\x46\x4c\x46\x4a\x00\x00\x00\x00\x00\x00\x00\x00\x46\x50\x46\x4e\x00\x00\x00\x00\x00\x00\x44\x7b\x00\x00\x46\x54\x46\x52\x00\x00\x46\x59\x00\x00\x00\x00\x00\x00",
 /* 0100 */ "\x00\x00\x46\x41\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x45\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x47\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x49\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x5d\x00\x00\x00\x00\x00\x00\x46\x5e\x00\x00\x00\x00\x00\x00\x00\x00\x46\x4d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x51\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 0180 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x43\x00\x00\x46\x4b\x00\x00\x46\x4f\x00\x00\x46\x53\x00\x00\x46\x55\x00\x00\x46\x56\x00\x00\x46\x57\x00\x00\x46\x58\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x5f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 0200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x60\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 0280 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x46\x00\x00\x45\x45\xcd\x41\xcd\x42\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\x43\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 0300 */ NULL,
 /* 0380 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\x61\x41\x62\x41\x63\x41\x64\x41\x65\x41\x66\x41\x67\x41\x68\x41\x69\x41\x6a\x41\x6b\x41\x6c\x41\x6d\x41\x6e\x41\x6f\x41\x70\x41\x71\x00\x00\x41\x72\x41\x73\x41\x74\x41\x75\x41\x76\x41\x77\x41\x78\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\x41\x41\x42\x41\x43\x41\x44\x41\x45\x41\x46\x41\x47\x41\x48\x41\x49\x41\x4a\x41\x4b\x41\x4c\x41\x4d\x41\x4e\x41\x4f\x41\x50\x41\x51\x00\x00\x41\x52\x41\x53\x41\x54\x41\x55\x41\x56\x41\x57\x41\x58\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 0400 */ "\x00\x00\x41\xc6\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\xc0\x41\xc1\x41\xc2\x41\xc3\x41\xc4\x41\xc5\x41\xc7\x41\xc8\x41\xc9\x41\xca\x41\xcb\x41\xcc\x41\xcd\x41\xce\x41\xcf\x41\xd0\x41\xd1\x41\xd2\x41\xd3\x41\xd4\x41\xd5\x41\xd6\x41\xd7\x41\xd8\x41\xd9\x41\xda\x41\xdb\x41\xdc\x41\xdd\x41\xde\x41\xdf\x41\xe0\x41\x80\x41\x81\x41\x82\x41\x83\x41\x84\x41\x85\x41\x87\x41\x88\x41\x89\x41\x8a\x41\x8b\x41\x8c\x41\x8d\x41\x8e\x41\x8f\x41\x90\x41\x91\x41\x92\x41\x93\x41\x94\x41\x95\x41\x96\x41\x97\x41\x98\x41\x99\x41\x9a\x41\x9b\x41\x9c\x41\x9d\x41\x9e\x41\x9f\x41\xa0\x00\x00\x41\x86\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 0480 */ NULL,
-/* 0500 */ NULL,
-/* 0580 */ NULL,
 /* 0600 */ "\x47\x5d\x47\x5e\x47\x5f\x47\x60\x47\x61\x47\x62\x47\x63\x47\x64\x47\x65\x47\x66\x47\x67\x47\x68\x47\x69\x47\x6a\x47\x6b\x47\x6c\x47\x6d\x47\x6e\x47\x6f\x47\x70\x47\x71\x47\x72\x47\x73\x47\x74\x47\x75\x47\x76\x47\x77\x47\x78\x47\x79\x47\x7a\x47\x7b\x47\x7c\x47\x7d\x47\x7e\x47\x7f\x47\x80\x47\x81\x47\x82\x47\x83\x47\x84\x47\x85\x47\x86\x47\x87\x47\x88\x47\x89\x47\x8a\x47\x8b\x47\x8c\x47\x8d\x47\x8e\x47\x8f\x47\x90\x47\x91\x47\x92\x47\x93\x47\x94\x47\x95\x47\x96\x47\x97\x47\x98\x47\x99\x47\x9a\x47\x9b\x47\x9c\x47\x9d\x47\x9e\x47\x9f\x47\xa0\x47\xa1\x47\xa2\x47\xa3\x47\xa4\x47\xa5\x47\xa6\x47\xa7\x47\xa8\x47\xa9\x47\xaa\x47\xab\x47\xac\x47\xad\x47\xae\x47\xaf\x47\xb0\x47\xb1\x47\xb2\x47\xb3\x47\xb4\x47\xb5\x47\xb6\x47\xb7\x47\xb8\x47\xb9\x47\xba\x47\xbb\x47\xbc\x47\xbd\x47\xbe\x47\xbf\x47\xc0\x47\xc1\x47\xc2\x47\xc3\x47\xc4\x47\xc5\x47\xc6\x47\xc7\x47\xc8\x47\xc9\x47\xca\x47\xcb\x47\xcc\x47\xcd\x47\xce\x47\xcf\x47\xd0\x47\xd1\x47\xd2\x47\xd3\x47\xd4\x47\xd5\x47\xd6\x47\xd7\x47\xd8\x47\xd9\x47\xda\x47\xdb\x47\xdc",
 /* 0680 */ "\x47\xdd\x47\xde\x47\xdf\x47\xe0\x47\xe1\x47\xe2\x47\xe3\x47\xe4\x47\xe5\x47\xe6\x47\xe7\x47\xe8\x47\xe9\x47\xea\x47\xeb\x47\xec\x47\xed\x47\xee\x47\xef\x47\xf0\x47\xf1\x47\xf2\x47\xf3\x47\xf4\x47\xf5\x47\xf6\x47\xf7\x47\xf8\x47\xf9\x47\xfa\x47\xfb\x47\xfc\x47\xfd\x47\xfe\x48\x41\x48\x42\x48\x43\x48\x44\x48\x45\x48\x46\x48\x47\x48\x48\x48\x49\x48\x4a\x48\x4b\x48\x4c\x48\x4d\x48\x4e\x48\x4f\x48\x50\x48\x51\x48\x52\x48\x53\x48\x54\x48\x55\x48\x56\x48\x57\x48\x58\x48\x59\x48\x5a\x48\x5b\x48\x5c\x48\x5d\x48\x5e\x48\x5f\x48\x60\x48\x61\x48\x62\x48\x63\x48\x64\x48\x65\x48\x66\x48\x67\x48\x68\x48\x69\x48\x6a\x48\x6b\x48\x6c\x48\x6d\x48\x6e\x48\x6f\x48\x70\x48\x71\x48\x72\x48\x73\x48\x74\x48\x75\x48\x76\x48\x77\x48\x78\x48\x79\x48\x7a\x48\x7b\x48\x7c\x48\x7d\x48\x7e\x48\x7f\x48\x80\x48\x81\x48\x82\x48\x83\x48\x84\x48\x85\x48\x86\x48\x87\x48\x88\x48\x89\x48\x8a\x48\x8b\x48\x8c\x48\x8d\x48\x8e\x48\x8f\x48\x90\x48\x91\x48\x92\x48\x93\x48\x94\x48\x95\x48\x96\x48\x97\x48\x98\x48\x99\x48\x9a\x48\x9b\x48\x9c\x48\x9d\x48\x9e",
-/* 0700 */ NULL,
-/* 0780 */ NULL,
-/* 0800 */ NULL,
-/* 0880 */ NULL,
-/* 0900 */ NULL,
-/* 0980 */ NULL,
-/* 0a00 */ NULL,
-/* 0a80 */ NULL,
-/* 0b00 */ NULL,
-/* 0b80 */ NULL,
-/* 0c00 */ NULL,
-/* 0c80 */ NULL,
-/* 0d00 */ NULL,
-/* 0d80 */ NULL,
-/* 0e00 */ NULL,
-/* 0e80 */ NULL,
 /* 0f00 */ "\x6d\x41\x6d\x42\x6d\x43\x6d\x44\x6d\x45\x6d\x46\x6d\x47\x6d\x48\x6d\x49\x6d\x4a\x6d\x4b\x6d\x4c\x6d\x4d\x6d\x4e\x6d\x4f\x6d\x50\x6d\x51\x6d\x52\x6d\x53\x6d\x54\x6d\x55\x6d\x56\x6d\x57\x6d\x58\x6d\x59\x6d\x5a\x6d\x5b\x6d\x5c\x6d\x5d\x6d\x5e\x6d\x5f\x6d\x60\x6d\x61\x6d\x62\x6d\x63\x6d\x64\x6d\x65\x6d\x66\x6d\x67\x6d\x68\x6d\x69\x6d\x6a\x6d\x6b\x6d\x6c\x6d\x6d\x6d\x6e\x6d\x6f\x6d\x70\x6d\x71\x6d\x72\x6d\x73\x6d\x74\x6d\x75\x6d\x76\x6d\x77\x6d\x78\x6d\x79\x6d\x7a\x6d\x7b\x6d\x7c\x6d\x7d\x6d\x7e\x6d\x7f\x6d\x80\x6d\x81\x6d\x82\x6d\x83\x6d\x84\x6d\x85\x6d\x86\x6d\x87\x6d\x88\x6d\x89\x6d\x8a\x6d\x8b\x6d\x8c\x6d\x8d\x6d\x8e\x6d\x8f\x6d\x90\x6d\x91\x6d\x92\x6d\x93\x6d\x94\x6d\x95\x6d\x96\x6d\x97\x6d\x98\x6d\x99\x6d\x9a\x6d\x9b\x6d\x9c\x6d\x9d\x6d\x9e\x6d\x9f\x6d\xa0\x6d\xa1\x6d\xa2\x6d\xa3\x6d\xa4\x6d\xa5\x6d\xa6\x6d\xa7\x6d\xa8\x6d\xa9\x6d\xaa\x6d\xab\x6d\xac\x6d\xad\x6d\xae\x6d\xaf\x6d\xb0\x6d\xb1\x6d\xb2\x6d\xb3\x6d\xb4\x6d\xb5\x6d\xb6\x6d\xb7\x6d\xb8\x6d\xb9\x6d\xba\x6d\xbb\x6d\xbc\x6d\xbd\x6d\xbe\x6d\xbf\x6d\xc0",
 /* 0f80 */ "\x6d\xc1\x6d\xc2\x6d\xc3\x6d\xc4\x6d\xc5\x6d\xc6\x6d\xc7\x6d\xc8\x6d\xc9\x6d\xca\x6d\xcb\x6d\xcc\x6d\xcd\x6d\xce\x6d\xcf\x6d\xd0\x6d\xd1\x6d\xd2\x6d\xd3\x6d\xd4\x6d\xd5\x6d\xd6\x6d\xd7\x6d\xd8\x6d\xd9\x6d\xda\x6d\xdb\x6d\xdc\x6d\xdd\x6d\xde\x6d\xdf\x6d\xe0\x6d\xe1\x6d\xe2\x6d\xe3\x6d\xe4\x6d\xe5\x6d\xe6\x6d\xe7\x6d\xe8\x6d\xe9\x6d\xea\x6d\xeb\x6d\xec\x6d\xed\x6d\xee\x6d\xef\x6d\xf0\x6d\xf1\x6d\xf2\x6d\xf3\x6d\xf4\x6d\xf5\x6d\xf6\x6d\xf7\x6d\xf8\x6d\xf9\x6d\xfa\x6d\xfb\x6d\xfc\x6d\xfd\x6d\xfe\x6e\x41\x6e\x42\x6e\x43\x6e\x44\x6e\x45\x6e\x46\x6e\x47\x6e\x48\x6e\x49\x6e\x4a\x6e\x4b\x6e\x4c\x6e\x4d\x6e\x4e\x6e\x4f\x6e\x50\x6e\x51\x6e\x52\x6e\x53\x6e\x54\x6e\x55\x6e\x56\x6e\x57\x6e\x58\x6e\x59\x6e\x5a\x6e\x5b\x6e\x5c\x6e\x5d\x6e\x5e\x6e\x5f\x6e\x60\x6e\x61\x6e\x62\x6e\x63\x6e\x64\x6e\x65\x6e\x66\x6e\x67\x6e\x68\x6e\x69\x6e\x6a\x6e\x6b\x6e\x6c\x6e\x6d\x6e\x6e\x6e\x6f\x6e\x70\x6e\x71\x6e\x72\x6e\x73\x6e\x74\x6e\x75\x6e\x76\x6e\x77\x6e\x78\x6e\x79\x6e\x7a\x6e\x7b\x6e\x7c\x6e\x7d\x6e\x7e\x6e\x7f\x6e\x80\x6e\x81\x6e\x82",
-/* 1000 */ NULL,
-/* 1080 */ NULL,
-/* 1100 */ NULL,
-/* 1180 */ NULL,
-/* 1200 */ NULL,
-/* 1280 */ NULL,
-/* 1300 */ NULL,
-/* 1380 */ NULL,
-/* 1400 */ NULL,
-/* 1480 */ NULL,
-/* 1500 */ NULL,
-/* 1580 */ NULL,
-/* 1600 */ NULL,
-/* 1680 */ NULL,
-/* 1700 */ NULL,
-/* 1780 */ NULL,
 /* 1800 */ "\x6e\x83\x6e\x84\x6e\x85\x6e\x86\x6e\x87\x6e\x88\x6e\x89\x6e\x8a\x6e\x8b\x6e\x8c\x6e\x8d\x6e\x8e\x6e\x8f\x6e\x90\x6e\x91\x6e\x92\x6e\x93\x6e\x94\x6e\x95\x6e\x96\x6e\x97\x6e\x98\x6e\x99\x6e\x9a\x6e\x9b\x6e\x9c\x6e\x9d\x6e\x9e\x6e\x9f\x6e\xa0\x6e\xa1\x6e\xa2\x6e\xa3\x6e\xa4\x6e\xa5\x6e\xa6\x6e\xa7\x6e\xa8\x6e\xa9\x6e\xaa\x6e\xab\x6e\xac\x6e\xad\x6e\xae\x6e\xaf\x6e\xb0\x6e\xb1\x6e\xb2\x6e\xb3\x6e\xb4\x6e\xb5\x6e\xb6\x6e\xb7\x6e\xb8\x6e\xb9\x6e\xba\x6e\xbb\x6e\xbc\x6e\xbd\x6e\xbe\x6e\xbf\x6e\xc0\x6e\xc1\x6e\xc2\x6e\xc3\x6e\xc4\x6e\xc5\x6e\xc6\x6e\xc7\x6e\xc8\x6e\xc9\x6e\xca\x6e\xcb\x6e\xcc\x6e\xcd\x6e\xce\x6e\xcf\x6e\xd0\x6e\xd1\x6e\xd2\x6e\xd3\x6e\xd4\x6e\xd5\x6e\xd6\x6e\xd7\x6e\xd8\x6e\xd9\x6e\xda\x6e\xdb\x6e\xdc\x6e\xdd\x6e\xde\x6e\xdf\x6e\xe0\x6e\xe1\x6e\xe2\x6e\xe3\x6e\xe4\x6e\xe5\x6e\xe6\x6e\xe7\x6e\xe8\x6e\xe9\x6e\xea\x6e\xeb\x6e\xec\x6e\xed\x6e\xee\x6e\xef\x6e\xf0\x6e\xf1\x6e\xf2\x6e\xf3\x6e\xf4\x6e\xf5\x6e\xf6\x6e\xf7\x6e\xf8\x6e\xf9\x6e\xfa\x6e\xfb\x6e\xfc\x6e\xfd\x6e\xfe\x6f\x41\x6f\x42\x6f\x43\x6f\x44",
 /* 1880 */ "\x6f\x45\x6f\x46\x6f\x47\x6f\x48\x6f\x49\x6f\x4a\x6f\x4b\x6f\x4c\x6f\x4d\x6f\x4e\x6f\x4f\x6f\x50\x6f\x51\x6f\x52\x6f\x53\x6f\x54\x6f\x55\x6f\x56\x6f\x57\x6f\x58\x6f\x59\x6f\x5a\x6f\x5b\x6f\x5c\x6f\x5d\x6f\x5e\x6f\x5f\x6f\x60\x6f\x61\x6f\x62\x6f\x63\x6f\x64\x6f\x65\x6f\x66\x6f\x67\x6f\x68\x6f\x69\x6f\x6a\x6f\x6b\x6f\x6c\x6f\x6d\x6f\x6e\x6f\x6f\x6f\x70\x6f\x71\x6f\x72\x6f\x73\x6f\x74\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 1900 */ NULL,
-/* 1980 */ NULL,
-/* 1a00 */ NULL,
-/* 1a80 */ NULL,
-/* 1b00 */ NULL,
-/* 1b80 */ NULL,
-/* 1c00 */ NULL,
-/* 1c80 */ NULL,
-/* 1d00 */ NULL,
-/* 1d80 */ NULL,
-/* 1e00 */ NULL,
-/* 1e80 */ NULL,
-/* 1f00 */ NULL,
-/* 1f80 */ NULL,
 /* 2000 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x5a\x00\x00\x00\x00\xcd\x44\xcd\x45\x44\x4a\x44\x7c\x00\x00\x44\x61\x44\x71\x00\x00\x00\x00\x44\x62\x44\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x7e\x44\x7f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x8b\x00\x00\x44\xee\x44\xef\x00\x00\xcd\x46\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2080 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\xeb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2100 */ "\x00\x00\x00\x00\x00\x00\x44\x4e\x00\x00\xcd\x47\x00\x00\x00\x00\x00\x00\xcd\x48\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x41\xf1\x41\xf2\x41\xf3\x41\xf4\x41\xf5\x41\xf6\x41\xf7\x41\xf8\x41\xf9\x41\xfa\x41\xfb\x41\xfc\x00\x00\x00\x00\x00\x00\x00\x00\x41\xb1\x41\xb2\x41\xb3\x41\xb4\x41\xb5\x41\xb6\x41\xb7\x41\xb8\x41\xb9\x41\xba\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
@@ -3205,38 +1455,18 @@ static uni16_t uni16[] = {
 /* 2200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x69\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x66\x00\x00\x45\x65\x00\x00\x00\x00\x00\x00\xcd\x4d\x00\x00\x00\x00\x00\x00\x00\x00\x45\x6b\x00\x00\x00\x00\x45\x77\x44\x4d\xcd\x4e\x45\x6e\x00\x00\x00\x00\xcd\x4f\x00\x00\x45\x6d\x00\x00\x45\x63\x45\x64\x45\x68\x45\x67\x45\x71\x00\x00\x00\x00\x45\x72\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x68\x44\x78\x45\x62\x45\x6a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x76\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x75\x00\x00\x00\x00\x00\x00\x45\x74\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\x50\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x4c\x45\x73\x00\x00\x00\x00\x44\x67\x44\x77\xcd\x51\xcd\x52\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x79\x45\x7a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2280 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\x90\x00\x00\x00\x00\x00\x00\x45\x70\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x6c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\x53\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2300 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\x6f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2380 */ NULL,
 /* 2400 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\xe1\x45\xe2\x45\xe3\x45\xe4\x45\xe5\x45\xe6\x45\xe7\x45\xe8\x45\xe9\x45\xea\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\xc5\x45\xc6\x45\xc7\x45\xc8\x45\xc9\x45\xca\x45\xcb\x45\xcc\x45\xcd\x45\xce\x45\xcf\x45\xd0",
 /* 2480 */ "\x45\xd1\x45\xd2\x45\xd3\x45\xd4\x45\xd5\x45\xd6\x45\xd7\x45\xd8\x45\xb1\x45\xb2\x45\xb3\x45\xb4\x45\xb5\x45\xb6\x45\xb7\x45\xb8\x45\xb9\x45\xba\x45\xbb\x45\xbc\x45\xbd\x45\xbe\x45\xbf\x45\xc0\x45\xc1\x45\xc2\x45\xc3\x45\xc4\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2500 */ "\x46\xa4\x46\xa5\x46\xa6\x46\xa7\x46\xa8\x46\xa9\x46\xaa\x46\xab\x46\xac\x46\xad\x46\xae\x46\xaf\x46\xb0\x46\xb1\x46\xb2\x46\xb3\x46\xb4\x46\xb5\x46\xb6\x46\xb7\x46\xb8\x46\xb9\x46\xba\x46\xbb\x46\xbc\x46\xbd\x46\xbe\x46\xbf\x46\xc0\x46\xc1\x46\xc2\x46\xc3\x46\xc4\x46\xc5\x46\xc6\x46\xc7\x46\xc8\x46\xc9\x46\xca\x46\xcb\x46\xcc\x46\xcd\x46\xce\x46\xcf\x46\xd0\x46\xd1\x46\xd2\x46\xd3\x46\xd4\x46\xd5\x46\xd6\x46\xd7\x46\xd8\x46\xd9\x46\xda\x46\xdb\x46\xdc\x46\xdd\x46\xde\x46\xdf\x46\xe0\x46\xe1\x46\xe2\x46\xe3\x46\xe4\x46\xe5\x46\xe6\x46\xe7\x46\xe8\x46\xe9\x46\xea\x46\xeb\x46\xec\x46\xed\x46\xee\x46\xef\x00\x00\x00\x00\x00\x00\x00\x00\xcd\x54\xcd\x55\xcd\x56\xcd\x57\xcd\x58\xcd\x59\xcd\x5a\xcd\x5b\xcd\x5c\xcd\x5d\xcd\x5e\xcd\x5f\xcd\x60\xcd\x61\xcd\x62\xcd\x63\xcd\x64\xcd\x65\xcd\x66\xcd\x67\xcd\x68\xcd\x69\xcd\x6a\xcd\x6b\xcd\x6c\xcd\x6d\xcd\x6e\xcd\x6f\xcd\x70\xcd\x71\xcd\x72\xcd\x73\xcd\x74\xcd\x75\xcd\x76\xcd\x77\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2580 */ "\x00\x00\xcd\x78\xcd\x79\xcd\x7a\xcd\x7b\xcd\x7c\xcd\x7d\xcd\x7e\xcd\x7f\xcd\x81\xcd\x82\xcd\x83\xcd\x84\xcd\x85\xcd\x86\xcd\x87\x00\x00\x00\x00\x00\x00\xcd\x88\xcd\x89\xcd\x8a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xea\x44\xe9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe3\x44\xe2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xec\x44\xeb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe8\x44\xe7\x00\x00\x00\x00\x00\x00\x44\xe0\x00\x00\x00\x00\x44\xe4\x44\xe1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\x8b\xcd\x8c\xcd\x8d\xcd\x8e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 2600 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\xe6\x44\xe5\x00\x00\x00\x00\xcd\x8f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x79\x00\x00\x44\x69\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2680 */ NULL,
-/* 2700 */ NULL,
-/* 2780 */ NULL,
-/* 2800 */ NULL,
-/* 2880 */ NULL,
-/* 2900 */ NULL,
-/* 2980 */ NULL,
-/* 2a00 */ NULL,
-/* 2a80 */ NULL,
-/* 2b00 */ NULL,
-/* 2b80 */ NULL,
-/* 2c00 */ NULL,
-/* 2c80 */ NULL,
-/* 2d00 */ NULL,
-/* 2d80 */ NULL,
-/* 2e00 */ NULL,
 /* 2e80 */ "\x00\x00\xce\x56\x00\x00\x00\x00\xce\x5a\x00\x00\x00\x00\x00\x00\xce\x5d\x00\x00\x00\x00\xce\x5e\xce\x63\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x64\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x71\x00\x00\x00\x00\xce\x74\x00\x00\x00\x00\x00\x00\xce\x77\x00\x00\x00\x00\x00\x00\x00\x00\xce\x79\x00\x00\x00\x00\xce\x7a\xce\x7b\x00\x00\x00\x00\x00\x00\xce\x7f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x8a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 2f00 */ NULL,
 /* 2f80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\xca\xcd\xcb\xcd\xcc\xcd\xcd\xcd\xce\xcd\xcf\xcd\xd0\xcd\xd1\xcd\xd2\xcd\xd3\xcd\xd4\xcd\xd5\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 3000 */ "\x40\x40\x43\x44\x43\x41\x44\x5b\x00\x00\x44\x5d\x44\x5e\x44\x5f\x44\x64\x44\x74\x44\x65\x44\x75\x43\x42\x43\x43\x44\x42\x44\x43\x44\x66\x44\x76\x44\x6c\x44\x7d\x44\x63\x44\x73\x45\x5b\x45\x5c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\x91\xcd\x92\x00\x00\x00\x00\xcd\x93\xcd\x94\xcd\x95\xcd\x96\xcd\x97\xcd\x98\xcd\x99\xcd\x9a\xcd\x9b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\xc9\x00\x00\x00\x00\x44\x47\x44\x81\x44\x48\x44\x82\x44\x49\x44\x83\x44\x51\x44\x84\x44\x52\x44\x85\x44\x86\x44\xc0\x44\x87\x44\xc1\x44\x88\x44\xc2\x44\x89\x44\xc3\x44\x8a\x44\xc4\x44\x8c\x44\xc5\x44\x8d\x44\xc6\x44\x8e\x44\xc7\x44\x8f\x44\xc8\x44\x90\x44\xc9\x44\x91\x44\xca\x44\x92\x44\xcb\x44\x56\x44\x93\x44\xcc\x44\x94\x44\xcd\x44\x95\x44\xce\x44\x96\x44\x97\x44\x98\x44\x99\x44\x9a\x44\x9d\x44\xcf\x44\xd5\x44\x9e\x44\xd0\x44\xd6\x44\x9f\x44\xd1\x44\xd7\x44\xa2\x44\xd2\x44\xd8\x44\xa3\x44\xd3\x44\xd9\x44\xa4\x44\xa5",
 /* 3080 */ "\x44\xa6\x44\xa7\x44\xa8\x44\x53\x44\xa9\x44\x54\x44\xaa\x44\x55\x44\xac\x44\xad\x44\xae\x44\xaf\x44\xba\x44\xbb\x44\x57\x44\xbc\x44\xda\x44\xdb\x44\x46\x44\xbd\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\xbe\x43\xbf\x44\xdc\x44\xdd\x00\x00\x00\x00\x43\x47\x43\x81\x43\x48\x43\x82\x43\x49\x43\x83\x43\x51\x43\x84\x43\x52\x43\x85\x43\x86\x43\xc0\x43\x87\x43\xc1\x43\x88\x43\xc2\x43\x89\x43\xc3\x43\x8a\x43\xc4\x43\x8c\x43\xc5\x43\x8d\x43\xc6\x43\x8e\x43\xc7\x43\x8f\x43\xc8\x43\x90\x43\xc9\x43\x91\x43\xca\x43\x92\x43\xcb\x43\x56\x43\x93\x43\xcc\x43\x94\x43\xcd\x43\x95\x43\xce\x43\x96\x43\x97\x43\x98\x43\x99\x43\x9a\x43\x9d\x43\xcf\x43\xd5\x43\x9e\x43\xd0\x43\xd6\x43\x9f\x43\xd1\x43\xd7\x43\xa2\x43\xd2\x43\xd8\x43\xa3\x43\xd3\x43\xd9\x43\xa4\x43\xa5\x43\xa6\x43\xa7\x43\xa8\x43\x53\x43\xa9\x43\x54\x43\xaa\x43\x55\x43\xac\x43\xad\x43\xae\x43\xaf\x43\xba\x43\xbb\x43\x57\x43\xbc\x43\xda\x43\xdb\x43\x46\x43\xbd\x43\xd4\x43\x59\x43\x5a\x00\x00\x00\x00\x00\x00\x00\x00\x43\x45\x43\x58\x43\xdc\x43\xdd\x00\x00",
 /* 3100 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x65\x46\x66\x46\x67\x46\x68\x46\x69\x46\x6a\x46\x6b\x46\x6c\x46\x6d\x46\x6e\x46\x6f\x46\x70\x46\x71\x46\x72\x46\x73\x46\x74\x46\x75\x46\x76\x46\x77\x46\x78\x46\x79\x46\x7a\x46\x7b\x46\x7c\x46\x7d\x46\x7e\x46\x7f\x46\x80\x46\x81\x46\x82\x46\x83\x46\x84\x46\x85\x46\x86\x46\x87\x46\x88\x46\x89\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 3180 */ NULL,
 /* 3200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x45\xf1\x45\xf2\x45\xf3\x45\xf4\x45\xf5\x45\xf6\x45\xf7\x45\xf8\x45\xf9\x45\xfa\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x44\x6d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 3280 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\x9c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 3300 */ NULL,
 /* 3380 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\x9d\xcd\x9e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\x9f\xcd\xa0\xcd\xa1\x00\x00\x00\x00\xcd\xa2\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\xa3\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\xa4\x00\x00\x00\x00\xcd\xa5\xcd\xa6\x00\x00\x00\x00\xcd\xa7\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 3400 */ "\xcf\x41\xcf\x42\xcf\x43\xcf\x44\xcf\x45\xcf\x46\xcf\x47\xcf\x48\xcf\x49\xcf\x4a\xcf\x4b\xcf\x4c\xcf\x4d\xcf\x4e\xcf\x4f\xcf\x50\xcf\x51\xcf\x52\xcf\x53\xcf\x54\xcf\x55\xcf\x56\xcf\x57\xcf\x58\xcf\x59\xcf\x5a\xcf\x5b\xcf\x5c\xcf\x5d\xcf\x5e\xcf\x5f\xcf\x60\xcf\x61\xcf\x62\xcf\x63\xcf\x64\xcf\x65\xcf\x66\xcf\x67\xcf\x68\xcf\x69\xcf\x6a\xcf\x6b\xcf\x6c\xcf\x6d\xcf\x6e\xcf\x6f\xcf\x70\xcf\x71\xcf\x72\xcf\x73\xcf\x74\xcf\x75\xcf\x76\xcf\x77\xcf\x78\xcf\x79\xcf\x7a\xcf\x7b\xcf\x7c\xcf\x7d\xcf\x7e\xcf\x7f\xcf\x80\xcf\x81\xcf\x82\xcf\x83\xcf\x84\xcf\x85\xcf\x86\xcf\x87\xce\x5c\xcf\x88\xcf\x89\xcf\x8a\xcf\x8b\xcf\x8c\xcf\x8d\xcf\x8e\xcf\x8f\xcf\x90\xcf\x91\xcf\x92\xcf\x93\xcf\x94\xcf\x95\xcf\x96\xcf\x97\xcf\x98\xcf\x99\xcf\x9a\xcf\x9b\xcf\x9c\xcf\x9d\xcf\x9e\xcf\x9f\xcf\xa0\xcf\xa1\xcf\xa2\xcf\xa3\xcf\xa4\xcf\xa5\xcf\xa6\xcf\xa7\xcf\xa8\xcf\xa9\xcf\xaa\xcf\xab\xcf\xac\xcf\xad\xcf\xae\xcf\xaf\xcf\xb0\xcf\xb1\xcf\xb2\xce\x5b\xcf\xb3\xcf\xb4\xcf\xb5\xcf\xb6\xcf\xb7\xcf\xb8\xcf\xb9\xcf\xba\xcf\xbb\xcf\xbc\xcf\xbd\xcf\xbe",
 /* 3480 */ "\xcf\xbf\xcf\xc0\xcf\xc1\xcf\xc2\xcf\xc3\xcf\xc4\xcf\xc5\xcf\xc6\xcf\xc7\xcf\xc8\xcf\xc9\xcf\xca\xcf\xcb\xcf\xcc\xcf\xcd\xcf\xce\xcf\xcf\xcf\xd0\xcf\xd1\xcf\xd2\xcf\xd3\xcf\xd4\xcf\xd5\xcf\xd6\xcf\xd7\xcf\xd8\xcf\xd9\xcf\xda\xcf\xdb\xcf\xdc\xcf\xdd\xcf\xde\xcf\xdf\xcf\xe0\xcf\xe1\xcf\xe2\xcf\xe3\xcf\xe4\xcf\xe5\xcf\xe6\xcf\xe7\xcf\xe8\xcf\xe9\xcf\xea\xcf\xeb\xcf\xec\xcf\xed\xcf\xee\xcf\xef\xcf\xf0\xcf\xf1\xcf\xf2\xcf\xf3\xcf\xf4\xcf\xf5\xcf\xf6\xcf\xf7\xcf\xf8\xcf\xf9\xcf\xfa\xcf\xfb\xcf\xfc\xcf\xfd\xcf\xfe\xd0\x41\xd0\x42\xd0\x43\xd0\x44\xd0\x45\xd0\x46\xd0\x47\xd0\x48\xd0\x49\xd0\x4a\xd0\x4b\xd0\x4c\xd0\x4d\xd0\x4e\xd0\x4f\xd0\x50\xd0\x51\xd0\x52\xd0\x53\xd0\x54\xd0\x55\xd0\x56\xd0\x57\xd0\x58\xd0\x59\xd0\x5a\xd0\x5b\xd0\x5c\xd0\x5d\xd0\x5e\xd0\x5f\xd0\x60\xd0\x61\xd0\x62\xd0\x63\xd0\x64\xd0\x65\xd0\x66\xd0\x67\xd0\x68\xd0\x69\xd0\x6a\xd0\x6b\xd0\x6c\xd0\x6d\xd0\x6e\xd0\x6f\xd0\x70\xd0\x71\xd0\x72\xd0\x73\xd0\x74\xd0\x75\xd0\x76\xd0\x77\xd0\x78\xd0\x79\xd0\x7a\xd0\x7b\xd0\x7c\xd0\x7d\xd0\x7e\xd0\x7f\xd0\x80",
@@ -3464,124 +1694,6 @@ static uni16_t uni16[] = {
 /* a380 */ "\x73\xfd\x73\xfe\x74\x41\x74\x42\x74\x43\x74\x44\x74\x45\x74\x46\x74\x47\x74\x48\x74\x49\x74\x4a\x74\x4b\x74\x4c\x74\x4d\x74\x4e\x74\x4f\x74\x50\x74\x51\x74\x52\x74\x53\x74\x54\x74\x55\x74\x56\x74\x57\x74\x58\x74\x59\x74\x5a\x74\x5b\x74\x5c\x74\x5d\x74\x5e\x74\x5f\x74\x60\x74\x61\x74\x62\x74\x63\x74\x64\x74\x65\x74\x66\x74\x67\x74\x68\x74\x69\x74\x6a\x74\x6b\x74\x6c\x74\x6d\x74\x6e\x74\x6f\x74\x70\x74\x71\x74\x72\x74\x73\x74\x74\x74\x75\x74\x76\x74\x77\x74\x78\x74\x79\x74\x7a\x74\x7b\x74\x7c\x74\x7d\x74\x7e\x74\x7f\x74\x80\x74\x81\x74\x82\x74\x83\x74\x84\x74\x85\x74\x86\x74\x87\x74\x88\x74\x89\x74\x8a\x74\x8b\x74\x8c\x74\x8d\x74\x8e\x74\x8f\x74\x90\x74\x91\x74\x92\x74\x93\x74\x94\x74\x95\x74\x96\x74\x97\x74\x98\x74\x99\x74\x9a\x74\x9b\x74\x9c\x74\x9d\x74\x9e\x74\x9f\x74\xa0\x74\xa1\x74\xa2\x74\xa3\x74\xa4\x74\xa5\x74\xa6\x74\xa7\x74\xa8\x74\xa9\x74\xaa\x74\xab\x74\xac\x74\xad\x74\xae\x74\xaf\x74\xb0\x74\xb1\x74\xb2\x74\xb3\x74\xb4\x74\xb5\x74\xb6\x74\xb7\x74\xb8\x74\xb9\x74\xba\x74\xbb\x74\xbc\x74\xbd\x74\xbe",
 /* a400 */ "\x74\xbf\x74\xc0\x74\xc1\x74\xc2\x74\xc3\x74\xc4\x74\xc5\x74\xc6\x74\xc7\x74\xc8\x74\xc9\x74\xca\x74\xcb\x74\xcc\x74\xcd\x74\xce\x74\xcf\x74\xd0\x74\xd1\x74\xd2\x74\xd3\x74\xd4\x74\xd5\x74\xd6\x74\xd7\x74\xd8\x74\xd9\x74\xda\x74\xdb\x74\xdc\x74\xdd\x74\xde\x74\xdf\x74\xe0\x74\xe1\x74\xe2\x74\xe3\x74\xe4\x74\xe5\x74\xe6\x74\xe7\x74\xe8\x74\xe9\x74\xea\x74\xeb\x74\xec\x74\xed\x74\xee\x74\xef\x74\xf0\x74\xf1\x74\xf2\x74\xf3\x74\xf4\x74\xf5\x74\xf6\x74\xf7\x74\xf8\x74\xf9\x74\xfa\x74\xfb\x74\xfc\x74\xfd\x74\xfe\x75\x41\x75\x42\x75\x43\x75\x44\x75\x45\x75\x46\x75\x47\x75\x48\x75\x49\x75\x4a\x75\x4b\x75\x4c\x75\x4d\x75\x4e\x75\x4f\x75\x50\x75\x51\x75\x52\x75\x53\x75\x54\x75\x55\x75\x56\x75\x57\x75\x58\x75\x59\x75\x5a\x75\x5b\x75\x5c\x75\x5d\x75\x5e\x75\x5f\x75\x60\x75\x61\x75\x62\x75\x63\x75\x64\x75\x65\x75\x66\x75\x67\x75\x68\x75\x69\x75\x6a\x75\x6b\x75\x6c\x75\x6d\x75\x6e\x75\x6f\x75\x70\x75\x71\x75\x72\x75\x73\x75\x74\x75\x75\x75\x76\x75\x77\x75\x78\x75\x79\x75\x7a\x75\x7b\x75\x7c\x75\x7d\x75\x7e\x75\x7f\x75\x80",
 /* a480 */ "\x75\x81\x75\x82\x75\x83\x75\x84\x75\x85\x75\x86\x75\x87\x75\x88\x75\x89\x75\x8a\x75\x8b\x75\x8c\x75\x8d\x75\x8e\x75\x8f\x75\x90\x75\x91\x75\x92\x75\x93\x75\x94\x75\x95\x75\x96\x75\x97\x75\x98\x75\x99\x75\x9a\x75\x9b\x75\x9c\x75\x9d\x75\x9e\x75\x9f\x75\xa0\x75\xa1\x75\xa2\x75\xa3\x75\xa4\x75\xa5\x75\xa6\x75\xa7\x75\xa8\x75\xa9\x75\xaa\x75\xab\x75\xac\x75\xad\x75\xae\x75\xaf\x75\xb0\x75\xb1\x75\xb2\x75\xb3\x75\xb4\x75\xb5\x75\xb6\x75\xb7\x75\xb8\x75\xb9\x75\xba\x75\xbb\x75\xbc\x75\xbd\x75\xbe\x75\xbf\x75\xc0\x75\xc1\x75\xc2\x75\xc3\x75\xc4\x75\xc5\x75\xc6\x75\xc7\x75\xc8\x75\xc9\x75\xca\x75\xcb\x75\xcc\x75\xcd\x75\xce\x75\xcf\x75\xd0\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* a500 */ NULL,
-/* a580 */ NULL,
-/* a600 */ NULL,
-/* a680 */ NULL,
-/* a700 */ NULL,
-/* a780 */ NULL,
-/* a800 */ NULL,
-/* a880 */ NULL,
-/* a900 */ NULL,
-/* a980 */ NULL,
-/* aa00 */ NULL,
-/* aa80 */ NULL,
-/* ab00 */ NULL,
-/* ab80 */ NULL,
-/* ac00 */ NULL,
-/* ac80 */ NULL,
-/* ad00 */ NULL,
-/* ad80 */ NULL,
-/* ae00 */ NULL,
-/* ae80 */ NULL,
-/* af00 */ NULL,
-/* af80 */ NULL,
-/* b000 */ NULL,
-/* b080 */ NULL,
-/* b100 */ NULL,
-/* b180 */ NULL,
-/* b200 */ NULL,
-/* b280 */ NULL,
-/* b300 */ NULL,
-/* b380 */ NULL,
-/* b400 */ NULL,
-/* b480 */ NULL,
-/* b500 */ NULL,
-/* b580 */ NULL,
-/* b600 */ NULL,
-/* b680 */ NULL,
-/* b700 */ NULL,
-/* b780 */ NULL,
-/* b800 */ NULL,
-/* b880 */ NULL,
-/* b900 */ NULL,
-/* b980 */ NULL,
-/* ba00 */ NULL,
-/* ba80 */ NULL,
-/* bb00 */ NULL,
-/* bb80 */ NULL,
-/* bc00 */ NULL,
-/* bc80 */ NULL,
-/* bd00 */ NULL,
-/* bd80 */ NULL,
-/* be00 */ NULL,
-/* be80 */ NULL,
-/* bf00 */ NULL,
-/* bf80 */ NULL,
-/* c000 */ NULL,
-/* c080 */ NULL,
-/* c100 */ NULL,
-/* c180 */ NULL,
-/* c200 */ NULL,
-/* c280 */ NULL,
-/* c300 */ NULL,
-/* c380 */ NULL,
-/* c400 */ NULL,
-/* c480 */ NULL,
-/* c500 */ NULL,
-/* c580 */ NULL,
-/* c600 */ NULL,
-/* c680 */ NULL,
-/* c700 */ NULL,
-/* c780 */ NULL,
-/* c800 */ NULL,
-/* c880 */ NULL,
-/* c900 */ NULL,
-/* c980 */ NULL,
-/* ca00 */ NULL,
-/* ca80 */ NULL,
-/* cb00 */ NULL,
-/* cb80 */ NULL,
-/* cc00 */ NULL,
-/* cc80 */ NULL,
-/* cd00 */ NULL,
-/* cd80 */ NULL,
-/* ce00 */ NULL,
-/* ce80 */ NULL,
-/* cf00 */ NULL,
-/* cf80 */ NULL,
-/* d000 */ NULL,
-/* d080 */ NULL,
-/* d100 */ NULL,
-/* d180 */ NULL,
-/* d200 */ NULL,
-/* d280 */ NULL,
-/* d300 */ NULL,
-/* d380 */ NULL,
-/* d400 */ NULL,
-/* d480 */ NULL,
-/* d500 */ NULL,
-/* d580 */ NULL,
-/* d600 */ NULL,
-/* d680 */ NULL,
-/* d700 */ NULL,
-/* d780 */ NULL,
-/* d800 */ NULL,
-/* d880 */ NULL,
-/* d900 */ NULL,
-/* d980 */ NULL,
-/* da00 */ NULL,
-/* da80 */ NULL,
-/* db00 */ NULL,
-/* db80 */ NULL,
-/* dc00 */ NULL,
-/* dc80 */ NULL,
-/* dd00 */ NULL,
-/* dd80 */ NULL,
-/* de00 */ NULL,
-/* de80 */ NULL,
-/* df00 */ NULL,
-/* df80 */ NULL,
 /* e000 */ "\x76\x41\x76\x42\x76\x43\x76\x44\x76\x45\x76\x46\x76\x47\x76\x48\x76\x49\x76\x4a\x76\x4b\x76\x4c\x76\x4d\x76\x4e\x76\x4f\x76\x50\x76\x51\x76\x52\x76\x53\x76\x54\x76\x55\x76\x56\x76\x57\x76\x58\x76\x59\x76\x5a\x76\x5b\x76\x5c\x76\x5d\x76\x5e\x76\x5f\x76\x60\x76\x61\x76\x62\x76\x63\x76\x64\x76\x65\x76\x66\x76\x67\x76\x68\x76\x69\x76\x6a\x76\x6b\x76\x6c\x76\x6d\x76\x6e\x76\x6f\x76\x70\x76\x71\x76\x72\x76\x73\x76\x74\x76\x75\x76\x76\x76\x77\x76\x78\x76\x79\x76\x7a\x76\x7b\x76\x7c\x76\x7d\x76\x7e\x76\x7f\x76\x81\x76\x82\x76\x83\x76\x84\x76\x85\x76\x86\x76\x87\x76\x88\x76\x89\x76\x8a\x76\x8b\x76\x8c\x76\x8d\x76\x8e\x76\x8f\x76\x90\x76\x91\x76\x92\x76\x93\x76\x94\x76\x95\x76\x96\x76\x97\x76\x98\x76\x99\x76\x9a\x76\x9b\x76\x9c\x76\x9d\x76\x9e\x76\x9f\x76\xa0\x76\xa1\x76\xa2\x76\xa3\x76\xa4\x76\xa5\x76\xa6\x76\xa7\x76\xa8\x76\xa9\x76\xaa\x76\xab\x76\xac\x76\xad\x76\xae\x76\xaf\x76\xb0\x76\xb1\x76\xb2\x76\xb3\x76\xb4\x76\xb5\x76\xb6\x76\xb7\x76\xb8\x76\xb9\x76\xba\x76\xbb\x76\xbc\x76\xbd\x76\xbe\x76\xbf\x76\xc0\x76\xc1",
 /* e080 */ "\x76\xc2\x76\xc3\x76\xc4\x76\xc5\x76\xc6\x76\xc7\x76\xc8\x76\xc9\x76\xca\x76\xcb\x76\xcc\x76\xcd\x76\xce\x76\xcf\x76\xd0\x76\xd1\x76\xd2\x76\xd3\x76\xd4\x76\xd5\x76\xd6\x76\xd7\x76\xd8\x76\xd9\x76\xda\x76\xdb\x76\xdc\x76\xdd\x76\xde\x76\xdf\x76\xe0\x76\xe1\x76\xe2\x76\xe3\x76\xe4\x76\xe5\x76\xe6\x76\xe7\x76\xe8\x76\xe9\x76\xea\x76\xeb\x76\xec\x76\xed\x76\xee\x76\xef\x76\xf0\x76\xf1\x76\xf2\x76\xf3\x76\xf4\x76\xf5\x76\xf6\x76\xf7\x76\xf8\x76\xf9\x76\xfa\x76\xfb\x76\xfc\x76\xfd\x77\x41\x77\x42\x77\x43\x77\x44\x77\x45\x77\x46\x77\x47\x77\x48\x77\x49\x77\x4a\x77\x4b\x77\x4c\x77\x4d\x77\x4e\x77\x4f\x77\x50\x77\x51\x77\x52\x77\x53\x77\x54\x77\x55\x77\x56\x77\x57\x77\x58\x77\x59\x77\x5a\x77\x5b\x77\x5c\x77\x5d\x77\x5e\x77\x5f\x77\x60\x77\x61\x77\x62\x77\x63\x77\x64\x77\x65\x77\x66\x77\x67\x77\x68\x77\x69\x77\x6a\x77\x6b\x77\x6c\x77\x6d\x77\x6e\x77\x6f\x77\x70\x77\x71\x77\x72\x77\x73\x77\x74\x77\x75\x77\x76\x77\x77\x77\x78\x77\x79\x77\x7a\x77\x7b\x77\x7c\x77\x7d\x77\x7e\x77\x7f\x77\x81\x77\x82\x77\x83\x77\x84\x77\x85",
 /* e100 */ "\x77\x86\x77\x87\x77\x88\x77\x89\x77\x8a\x77\x8b\x77\x8c\x77\x8d\x77\x8e\x77\x8f\x77\x90\x77\x91\x77\x92\x77\x93\x77\x94\x77\x95\x77\x96\x77\x97\x77\x98\x77\x99\x77\x9a\x77\x9b\x77\x9c\x77\x9d\x77\x9e\x77\x9f\x77\xa0\x77\xa1\x77\xa2\x77\xa3\x77\xa4\x77\xa5\x77\xa6\x77\xa7\x77\xa8\x77\xa9\x77\xaa\x77\xab\x77\xac\x77\xad\x77\xae\x77\xaf\x77\xb0\x77\xb1\x77\xb2\x77\xb3\x77\xb4\x77\xb5\x77\xb6\x77\xb7\x77\xb8\x77\xb9\x77\xba\x77\xbb\x77\xbc\x77\xbd\x77\xbe\x77\xbf\x77\xc0\x77\xc1\x77\xc2\x77\xc3\x77\xc4\x77\xc5\x77\xc6\x77\xc7\x77\xc8\x77\xc9\x77\xca\x77\xcb\x77\xcc\x77\xcd\x77\xce\x77\xcf\x77\xd0\x77\xd1\x77\xd2\x77\xd3\x77\xd4\x77\xd5\x77\xd6\x77\xd7\x77\xd8\x77\xd9\x77\xda\x77\xdb\x77\xdc\x77\xdd\x77\xde\x77\xdf\x77\xe0\x77\xe1\x77\xe2\x77\xe3\x77\xe4\x77\xe5\x77\xe6\x77\xe7\x77\xe8\x77\xe9\x77\xea\x77\xeb\x77\xec\x77\xed\x77\xee\x77\xef\x77\xf0\x77\xf1\x77\xf2\x77\xf3\x77\xf4\x77\xf5\x77\xf6\x77\xf7\x77\xf8\x77\xf9\x77\xfa\x77\xfb\x77\xfc\x77\xfd\x78\x41\x78\x42\x78\x43\x78\x44\x78\x45\x78\x46\x78\x47\x78\x48",
@@ -3599,184 +1711,55 @@ static uni16_t uni16[] = {
 /* e700 */ "\x7f\xa6\x7f\xa7\x7f\xa8\x7f\xa9\x7f\xaa\x7f\xab\x7f\xac\x7f\xad\x7f\xae\x7f\xaf\x7f\xb0\x7f\xb1\x7f\xb2\x7f\xb3\x7f\xb4\x7f\xb5\x7f\xb6\x7f\xb7\x7f\xb8\x7f\xb9\x7f\xba\x7f\xbb\x7f\xbc\x7f\xbd\x7f\xbe\x7f\xbf\x7f\xc0\x7f\xc1\x7f\xc2\x7f\xc3\x7f\xc4\x7f\xc5\x7f\xc6\x7f\xc7\x7f\xc8\x7f\xc9\x7f\xca\x7f\xcb\x7f\xcc\x7f\xcd\x7f\xce\x7f\xcf\x7f\xd0\x7f\xd1\x7f\xd2\x7f\xd3\x7f\xd4\x7f\xd5\x7f\xd6\x7f\xd7\x7f\xd8\x7f\xd9\x7f\xda\x7f\xdb\x7f\xdc\x7f\xdd\x7f\xde\x7f\xdf\x7f\xe0\x7f\xe1\x7f\xe2\x7f\xe3\x7f\xe4\x7f\xe5\x7f\xe6\x7f\xe7\x7f\xe8\x7f\xe9\x7f\xea\x7f\xeb\x7f\xec\x7f\xed\x7f\xee\x7f\xef\x7f\xf0\x7f\xf1\x7f\xf2\x7f\xf3\x7f\xf4\x7f\xf5\x7f\xf6\x7f\xf7\x7f\xf8\x7f\xf9\x7f\xfa\x7f\xfb\x7f\xfc\x7f\xfd\x80\x41\x80\x42\x80\x43\x80\x44\x80\x45\x80\x46\x80\x47\x80\x48\x80\x49\x80\x4a\x80\x4b\x80\x4c\x80\x4d\x80\x4e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* e780 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfc\x90\xfc\x91\xfc\x92\xfc\x93\xfc\x94\xfc\x95\xfc\x96\xfc\x97\xfc\x98\xfc\x99\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x46\x5c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* e800 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x57\xce\x58\xce\x59\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x5f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x67\x00\x00\x00\x00\x00\x00\x00\x00\xce\x6c\xce\x6d\x00\x00\x00\x00\x00\x00\x00\x00\xce\x72\xce\x73\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x7c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x85\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x96\xce\x97\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\xa6\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* e880 */ NULL,
-/* e900 */ NULL,
-/* e980 */ NULL,
-/* ea00 */ NULL,
-/* ea80 */ NULL,
-/* eb00 */ NULL,
-/* eb80 */ NULL,
-/* ec00 */ NULL,
-/* ec80 */ NULL,
-/* ed00 */ NULL,
-/* ed80 */ NULL,
-/* ee00 */ NULL,
-/* ee80 */ NULL,
-/* ef00 */ NULL,
-/* ef80 */ NULL,
-/* f000 */ NULL,
-/* f080 */ NULL,
-/* f100 */ NULL,
-/* f180 */ NULL,
-/* f200 */ NULL,
-/* f280 */ NULL,
-/* f300 */ NULL,
-/* f380 */ NULL,
-/* f400 */ NULL,
-/* f480 */ NULL,
-/* f500 */ NULL,
-/* f580 */ NULL,
-/* f600 */ NULL,
-/* f680 */ NULL,
-/* f700 */ NULL,
-/* f780 */ NULL,
 /* f800 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x5b\x44\x5c\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* f880 */ NULL,
 /* f900 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x41\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x42\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* f980 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x43\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x44\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x45\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* fa00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x46\xce\x47\xce\x48\xce\x49\x00\x00\xce\x4a\x00\x00\xce\x4b\xce\x4c\x00\x00\x00\x00\x00\x00\xce\x4d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xce\x4e\xce\x4f\xce\x50\x00\x00\xce\x51\xce\x52\x00\x00\x00\x00\xce\x53\xce\x54\xce\x55\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* fa80 */ NULL,
 /* fb00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf8\x47\xf8\x48\xf8\x49\xf8\x4a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf8\x6b\xf8\x6c\xf8\x6d\xf8\x6e\x00\x00\x00\x00",
 /* fb80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf8\x7f\xf8\x80\xf8\x81\xf8\x82\xf8\x83\xf8\x84\xf8\x85\xf8\x86\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf8\x9b\xf8\x9c\xf8\x9d\xf8\x9e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf8\xc4\xf8\xc5\xf8\xc6\xf8\xc7\xf8\xc8\xf8\xc9\xf8\xca\xf8\xcb\xf8\xcc\xf8\xcd\xf8\xce\xf8\xcf\xf8\xd0\xf8\xd1\xf8\xd2\xf8\xd3\xf8\xd4\xf8\xd5\xf8\xd6\xf8\xd7\xf8\xd8\xf8\xd9\xf8\xda\xf8\xdb\xf8\xdc\xf8\xdd\xf8\xde\xf8\xdf\xf8\xe0\xf8\xe1\xf8\xe2\xf8\xe3\xf8\xe4\xf8\xe5\xf8\xe6\xf8\xe7\xf8\xe8\xf8\xe9\xf8\xea\xf8\xeb\xf8\xec\xf8\xed\xf8\xee\xf8\xef\xf8\xf0",
-/* fc00 */ NULL,
-/* fc80 */ NULL,
-/* fd00 */ NULL,
-/* fd80 */ NULL,
 /* fe00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xcd\xa8\x47\x51\x00\x00\x47\x52\x47\x53\x47\x41\x47\x42\x47\x4f\x47\x50\x47\x43\x47\x44\x47\x4d\x47\x4e\x47\x47\x47\x48\x47\x45\x47\x46\x47\x49\x47\x4a\x47\x4b\x47\x4c\x00\x00\x00\x00\x00\x00\x00\x00\xcd\xa9\xcd\xaa\xcd\xab\xcd\xac\xcd\xad\xcd\xae\xcd\xaf\xcd\xb0\xcd\xb1\xcd\xb2\x00\x00\xcd\xb3\xcd\xb4\xcd\xb5\xcd\xb6\x00\x00\xcd\xb7\xcd\xb8\xcd\xb9\xcd\xba\xcd\xbb\xcd\xbc\xcd\xbd\xcd\xbe\xcd\xbf\xcd\xc0\xcd\xc1\xcd\xc2\xcd\xc3\xcd\xc4\x00\x00\xcd\xc5\xcd\xc6\xcd\xc7\xcd\xc8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* fe80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfb\xd0\xfb\xd1\xfb\xd2\xfb\xd3\xfb\xd4\xfb\xd5\xfb\xd6\xfb\xd7\xfb\xd8\xfb\xd9\x00\x00\x00\x00\xfb\xdc\xfb\xdd\xfb\xde\xfb\xdf\x00\x00\x00\x00\x00\x00\x00\x00\xfb\xe4\xfb\xe5\xfb\xe6\xfb\xe7\xfb\xe8\xfb\xe9\xfb\xea\xfb\xeb\xfb\xec\xfb\xed\xfb\xee\xfb\xef\xfb\xf0\xfb\xf1\x00\x00\x00\x00\xfb\xf4\xfb\xf5\xfb\xf6\xfb\xf7\xfb\xf8\xfb\xf9\xfb\xfa\xfb\xfb\xfb\xfc\xfb\xfd\xfb\xfe\xfc\x41\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfc\x52\xfc\x53\xfc\x54\xfc\x55\xfc\x56\xfc\x57\xfc\x58\xfc\x59\xfc\x5a\xfc\x5b\xfc\x5c\xfc\x5d\xfc\x5e\xfc\x5f\xfc\x60\xfc\x61\xfc\x62\xfc\x63\xfc\x64\xfc\x65\xfc\x66\xfc\x67\xfc\x68\xfc\x69\xfc\x6a\xfc\x6b\xfc\x6c\xfc\x6d\xfc\x6e\xfc\x6f\xfc\x70\xfc\x71\xfc\x72\xfc\x73\xfc\x74\xfc\x75\xfc\x76\xfc\x77\xfc\x78\xfc\x79\xfc\x7a\xfc\x7b\xfc\x7c\xfc\x7d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfc\x84\xfc\x85\x00\x00\x00\x00\x00\x00",
 /* ff00 */ "\x00\x00\x42\x5a\x42\x7f\x42\x7b\x42\xe0\x42\x6c\x42\x50\x42\x7d\x42\x4d\x42\x5d\x42\x5c\x42\x4e\x42\x6b\x42\x60\x42\x4b\x42\x61\x42\xf0\x42\xf1\x42\xf2\x42\xf3\x42\xf4\x42\xf5\x42\xf6\x42\xf7\x42\xf8\x42\xf9\x42\x7a\x42\x5e\x42\x4c\x42\x7e\x42\x6e\x42\x6f\x42\x7c\x42\xc1\x42\xc2\x42\xc3\x42\xc4\x42\xc5\x42\xc6\x42\xc7\x42\xc8\x42\xc9\x42\xd1\x42\xd2\x42\xd3\x42\xd4\x42\xd5\x42\xd6\x42\xd7\x42\xd8\x42\xd9\x42\xe2\x42\xe3\x42\xe4\x42\xe5\x42\xe6\x42\xe7\x42\xe8\x42\xe9\x44\x44\x43\xe0\x44\x45\x44\x70\x42\x6d\x42\x79\x42\x81\x42\x82\x42\x83\x42\x84\x42\x85\x42\x86\x42\x87\x42\x88\x42\x89\x42\x91\x42\x92\x42\x93\x42\x94\x42\x95\x42\x96\x42\x97\x42\x98\x42\x99\x42\xa2\x42\xa3\x42\xa4\x42\xa5\x42\xa6\x42\xa7\x42\xa8\x42\xa9\x42\xc0\x42\x4f\x42\xd0\x43\xa1\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* ff80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x4a\x42\x4a\x42\x5f\x42\xa1\x42\x6a\x42\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00" },
-/* EBCDIC DBCS to Unicode translation table for ibm-1388_P103-2001 */ {
-/* 0000 */ NULL,
-/* 0080 */ NULL,
-/* 0100 */ NULL,
-/* 0180 */ NULL,
-/* 0200 */ NULL,
-/* 0280 */ NULL,
-/* 0300 */ NULL,
-/* 0380 */ NULL,
-/* 0400 */ NULL,
-/* 0480 */ NULL,
-/* 0500 */ NULL,
-/* 0580 */ NULL,
-/* 0600 */ NULL,
-/* 0680 */ NULL,
-/* 0700 */ NULL,
-/* 0780 */ NULL,
-/* 0800 */ NULL,
-/* 0880 */ NULL,
-/* 0900 */ NULL,
-/* 0980 */ NULL,
-/* 0a00 */ NULL,
-/* 0a80 */ NULL,
-/* 0b00 */ NULL,
-/* 0b80 */ NULL,
-/* 0c00 */ NULL,
-/* 0c80 */ NULL,
-/* 0d00 */ NULL,
-/* 0d80 */ NULL,
-/* 0e00 */ NULL,
-/* 0e80 */ NULL,
-/* 0f00 */ NULL,
-/* 0f80 */ NULL,
-/* 1000 */ NULL,
-/* 1080 */ NULL,
-/* 1100 */ NULL,
-/* 1180 */ NULL,
-/* 1200 */ NULL,
-/* 1280 */ NULL,
-/* 1300 */ NULL,
-/* 1380 */ NULL,
-/* 1400 */ NULL,
-/* 1480 */ NULL,
-/* 1500 */ NULL,
-/* 1580 */ NULL,
-/* 1600 */ NULL,
-/* 1680 */ NULL,
-/* 1700 */ NULL,
-/* 1780 */ NULL,
-/* 1800 */ NULL,
-/* 1880 */ NULL,
-/* 1900 */ NULL,
-/* 1980 */ NULL,
-/* 1a00 */ NULL,
-/* 1a80 */ NULL,
-/* 1b00 */ NULL,
-/* 1b80 */ NULL,
-/* 1c00 */ NULL,
-/* 1c80 */ NULL,
-/* 1d00 */ NULL,
-/* 1d80 */ NULL,
-/* 1e00 */ NULL,
-/* 1e80 */ NULL,
-/* 1f00 */ NULL,
-/* 1f80 */ NULL,
-/* 2000 */ NULL,
-/* 2080 */ NULL,
-/* 2100 */ NULL,
-/* 2180 */ NULL,
-/* 2200 */ NULL,
-/* 2280 */ NULL,
-/* 2300 */ NULL,
-/* 2380 */ NULL,
-/* 2400 */ NULL,
-/* 2480 */ NULL,
-/* 2500 */ NULL,
-/* 2580 */ NULL,
-/* 2600 */ NULL,
-/* 2680 */ NULL,
-/* 2700 */ NULL,
-/* 2780 */ NULL,
-/* 2800 */ NULL,
-/* 2880 */ NULL,
-/* 2900 */ NULL,
-/* 2980 */ NULL,
-/* 2a00 */ NULL,
-/* 2a80 */ NULL,
-/* 2b00 */ NULL,
-/* 2b80 */ NULL,
-/* 2c00 */ NULL,
-/* 2c80 */ NULL,
-/* 2d00 */ NULL,
-/* 2d80 */ NULL,
-/* 2e00 */ NULL,
-/* 2e80 */ NULL,
-/* 2f00 */ NULL,
-/* 2f80 */ NULL,
-/* 3000 */ NULL,
-/* 3080 */ NULL,
-/* 3100 */ NULL,
-/* 3180 */ NULL,
-/* 3200 */ NULL,
-/* 3280 */ NULL,
-/* 3300 */ NULL,
-/* 3380 */ NULL,
-/* 3400 */ NULL,
-/* 3480 */ NULL,
-/* 3500 */ NULL,
-/* 3580 */ NULL,
-/* 3600 */ NULL,
-/* 3680 */ NULL,
-/* 3700 */ NULL,
-/* 3780 */ NULL,
-/* 3800 */ NULL,
-/* 3880 */ NULL,
-/* 3900 */ NULL,
-/* 3980 */ NULL,
-/* 3a00 */ NULL,
-/* 3a80 */ NULL,
-/* 3b00 */ NULL,
-/* 3b80 */ NULL,
-/* 3c00 */ NULL,
-/* 3c80 */ NULL,
-/* 3d00 */ NULL,
-/* 3d80 */ NULL,
-/* 3e00 */ NULL,
-/* 3e80 */ NULL,
-/* 3f00 */ NULL,
-/* 3f80 */ NULL,
+/* ff80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x43\x4a\x42\x4a\x42\x5f\x42\xa1\x42\x6a\x42\x5b\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+/* EBCDIC DBCS to Unicode translation table for ibm-1388_P103-2001 */
+static const unsigned short cp1388_ebc2u_ix[512] = {
+/* 0000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 0800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 1800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 2800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 3800 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+/* 4000 */ 1, 0, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15,
+/* 4800 */ 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31,
+/* 5000 */ 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47,
+/* 5800 */ 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63,
+/* 6000 */ 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+/* 6800 */ 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95,
+/* 7000 */ 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+/* 7800 */ 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+/* 8000 */ 128, 0, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142,
+/* 8800 */ 143, 144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158,
+/* 9000 */ 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+/* 9800 */ 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190,
+/* a000 */ 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206,
+/* a800 */ 207, 208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222,
+/* b000 */ 223, 224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238,
+/* b800 */ 239, 240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+/* c000 */ 255, 256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270,
+/* c800 */ 271, 272, 273, 274, 275, 276, 277, 278, 279, 0, 280, 281, 282, 283, 284, 285,
+/* d000 */ 286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300, 301,
+/* d800 */ 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315, 316, 317,
+/* e000 */ 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330, 331, 332, 333,
+/* e800 */ 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349,
+/* f000 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 350, 351, 352, 353,
+/* f800 */ 354, 355, 0, 0, 0, 0, 0, 356, 357, 358, 0, 0, 0, 0, 0, 0
+};
+static const uni16_row_t cp1388_ebc2u[] = {
 /* 4000 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x30\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 4080 */ NULL,
 /* 4100 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\xb1\x03\xb2\x03\xb3\x03\xb4\x03\xb5\x03\xb6\x03\xb7\x03\xb8\x03\xb9\x03\xba\x03\xbb\x03\xbc\x03\xbd\x03\xbe\x03\xbf\x03\xc0\x03\xc1\x03\xc3\x03\xc4\x03\xc5\x03\xc6\x03\xc7\x03\xc8\x03\xc9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x03\x91\x03\x92\x03\x93\x03\x94\x03\x95\x03\x96\x03\x97\x03\x98\x03\x99\x03\x9a\x03\x9b\x03\x9c\x03\x9d\x03\x9e\x03\x9f\x03\xa0\x03\xa1\x03\xa3\x03\xa4\x03\xa5\x03\xa6\x03\xa7\x03\xa8\x03\xa9\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* 4180 */ "\x04\x30\x04\x31\x04\x32\x04\x33\x04\x34\x04\x35\x04\x51\x04\x36\x04\x37\x04\x38\x04\x39\x04\x3a\x04\x3b\x04\x3c\x04\x3d\x04\x3e\x04\x3f\x04\x40\x04\x41\x04\x42\x04\x43\x04\x44\x04\x45\x04\x46\x04\x47\x04\x48\x04\x49\x04\x4a\x04\x4b\x04\x4c\x04\x4d\x04\x4e\x04\x4f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x21\x70\x21\x71\x21\x72\x21\x73\x21\x74\x21\x75\x21\x76\x21\x77\x21\x78\x21\x79\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x04\x10\x04\x11\x04\x12\x04\x13\x04\x14\x04\x15\x04\x01\x04\x16\x04\x17\x04\x18\x04\x19\x04\x1a\x04\x1b\x04\x1c\x04\x1d\x04\x1e\x04\x1f\x04\x20\x04\x21\x04\x22\x04\x23\x04\x24\x04\x25\x04\x26\x04\x27\x04\x28\x04\x29\x04\x2a\x04\x2b\x04\x2c\x04\x2d\x04\x2e\x04\x2f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x21\x60\x21\x61\x21\x62\x21\x63\x21\x64\x21\x65\x21\x66\x21\x67\x21\x68\x21\x69\x21\x6a\x21\x6b\x00\x00\x00\x00\x00\x00",
 /* 4200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xe1\xff\x0e\xff\x1c\xff\x08\xff\x0b\xff\x5c\xff\x06\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x01\xff\xe5\xff\x0a\xff\x09\xff\x1b\xff\xe2\xff\x0d\xff\x0f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\xe4\xff\x0c\xff\x05\xff\x3f\xff\x1e\xff\x1f\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xff\x40\xff\x1a\xff\x03\xff\x20\xff\x07\xff\x1d\xff\x02",
@@ -3904,7 +1887,6 @@ static uni16_t uni16[] = {
 /* 7f00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe6\x9c\xe6\x9d\xe6\x9e\xe6\x9f\xe6\xa0\xe6\xa1\xe6\xa2\xe6\xa3\xe6\xa4\xe6\xa5\xe6\xa6\xe6\xa7\xe6\xa8\xe6\xa9\xe6\xaa\xe6\xab\xe6\xac\xe6\xad\xe6\xae\xe6\xaf\xe6\xb0\xe6\xb1\xe6\xb2\xe6\xb3\xe6\xb4\xe6\xb5\xe6\xb6\xe6\xb7\xe6\xb8\xe6\xb9\xe6\xba\xe6\xbb\xe6\xbc\xe6\xbd\xe6\xbe\xe6\xbf\xe6\xc0\xe6\xc1\xe6\xc2\xe6\xc3\xe6\xc4\xe6\xc5\xe6\xc6\xe6\xc7\xe6\xc8\xe6\xc9\xe6\xca\xe6\xcb\xe6\xcc\xe6\xcd\xe6\xce\xe6\xcf\xe6\xd0\xe6\xd1\xe6\xd2\xe6\xd3\xe6\xd4\xe6\xd5\xe6\xd6\xe6\xd7\xe6\xd8\xe6\xd9\xe6\xda",
 /* 7f80 */ "\x00\x00\xe6\xdb\xe6\xdc\xe6\xdd\xe6\xde\xe6\xdf\xe6\xe0\xe6\xe1\xe6\xe2\xe6\xe3\xe6\xe4\xe6\xe5\xe6\xe6\xe6\xe7\xe6\xe8\xe6\xe9\xe6\xea\xe6\xeb\xe6\xec\xe6\xed\xe6\xee\xe6\xef\xe6\xf0\xe6\xf1\xe6\xf2\xe6\xf3\xe6\xf4\xe6\xf5\xe6\xf6\xe6\xf7\xe6\xf8\xe6\xf9\xe6\xfa\xe6\xfb\xe6\xfc\xe6\xfd\xe6\xfe\xe6\xff\xe7\x00\xe7\x01\xe7\x02\xe7\x03\xe7\x04\xe7\x05\xe7\x06\xe7\x07\xe7\x08\xe7\x09\xe7\x0a\xe7\x0b\xe7\x0c\xe7\x0d\xe7\x0e\xe7\x0f\xe7\x10\xe7\x11\xe7\x12\xe7\x13\xe7\x14\xe7\x15\xe7\x16\xe7\x17\xe7\x18\xe7\x19\xe7\x1a\xe7\x1b\xe7\x1c\xe7\x1d\xe7\x1e\xe7\x1f\xe7\x20\xe7\x21\xe7\x22\xe7\x23\xe7\x24\xe7\x25\xe7\x26\xe7\x27\xe7\x28\xe7\x29\xe7\x2a\xe7\x2b\xe7\x2c\xe7\x2d\xe7\x2e\xe7\x2f\xe7\x30\xe7\x31\xe7\x32\xe7\x33\xe7\x34\xe7\x35\xe7\x36\xe7\x37\xe7\x38\xe7\x39\xe7\x3a\xe7\x3b\xe7\x3c\xe7\x3d\xe7\x3e\xe7\x3f\xe7\x40\xe7\x41\xe7\x42\xe7\x43\xe7\x44\xe7\x45\xe7\x46\xe7\x47\xe7\x48\xe7\x49\xe7\x4a\xe7\x4b\xe7\x4c\xe7\x4d\xe7\x4e\xe7\x4f\xe7\x50\xe7\x51\xe7\x52\xe7\x53\xe7\x54\xe7\x55\xe7\x56\xe7\x57\x00\x00\x00\x00",
 /* 8000 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe7\x58\xe7\x59\xe7\x5a\xe7\x5b\xe7\x5c\xe7\x5d\xe7\x5e\xe7\x5f\xe7\x60\xe7\x61\xe7\x62\xe7\x63\xe7\x64\xe7\x65\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* 8080 */ NULL,
 /* 8100 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4e\x02\x4e\x04\x4e\x05\x4e\x06\x4e\x0f\x4e\x12\x4e\x17\x4e\x1f\x4e\x20\x4e\x21\x4e\x23\x4e\x26\x4e\x29\x4e\x2e\x4e\x2f\x4e\x31\x4e\x33\x4e\x35\x4e\x37\x4e\x3c\x4e\x40\x4e\x41\x4e\x42\x4e\x44\x4e\x46\x4e\x4a\x4e\x51\x4e\x55\x4e\x57\x4e\x5a\x4e\x5b\x4e\x62\x4e\x63\x4e\x64\x4e\x65\x4e\x67\x4e\x68\x4e\x6a\x4e\x6b\x4e\x6c\x4e\x6d\x4e\x6e\x4e\x6f\x4e\x72\x4e\x74\x4e\x75\x4e\x76\x4e\x77\x4e\x78\x4e\x79\x4e\x7a\x4e\x7b\x4e\x7c\x4e\x7d\x4e\x7f\x4e\x80\x4e\x81\x4e\x82\x4e\x83\x4e\x84\x4e\x85\x4e\x87\x4e\x8a",
 /* 8180 */ "\x00\x00\x4e\x90\x4e\x96\x4e\x97\x4e\x99\x4e\x9c\x4e\x9d\x4e\x9e\x4e\xa3\x4e\xaa\x4e\xaf\x4e\xb0\x4e\xb1\x4e\xb4\x4e\xb6\x4e\xb7\x4e\xb8\x4e\xb9\x4e\xbc\x4e\xbd\x4e\xbe\x4e\xc8\x4e\xcc\x4e\xcf\x4e\xd0\x4e\xd2\x4e\xda\x4e\xdb\x4e\xdc\x4e\xe0\x4e\xe2\x4e\xe6\x4e\xe7\x4e\xe9\x4e\xed\x4e\xee\x4e\xef\x4e\xf1\x4e\xf4\x4e\xf8\x4e\xf9\x4e\xfa\x4e\xfc\x4e\xfe\x4f\x00\x4f\x02\x4f\x03\x4f\x04\x4f\x05\x4f\x06\x4f\x07\x4f\x08\x4f\x0b\x4f\x0c\x4f\x12\x4f\x13\x4f\x14\x4f\x15\x4f\x16\x4f\x1c\x4f\x1d\x4f\x21\x4f\x23\x4f\x28\x4f\x29\x4f\x2c\x4f\x2d\x4f\x2e\x4f\x31\x4f\x33\x4f\x35\x4f\x37\x4f\x39\x4f\x3b\x4f\x3e\x4f\x3f\x4f\x40\x4f\x41\x4f\x42\x4f\x44\x4f\x45\x4f\x47\x4f\x48\x4f\x49\x4f\x4a\x4f\x4b\x4f\x4c\x4f\x52\x4f\x54\x4f\x56\x4f\x61\x4f\x62\x4f\x66\x4f\x68\x4f\x6a\x4f\x6b\x4f\x6d\x4f\x6e\x4f\x71\x4f\x72\x4f\x75\x4f\x77\x4f\x78\x4f\x79\x4f\x7a\x4f\x7d\x4f\x80\x4f\x81\x4f\x82\x4f\x85\x4f\x86\x4f\x87\x4f\x8a\x4f\x8c\x4f\x8e\x4f\x90\x4f\x92\x4f\x93\x4f\x95\x4f\x96\x4f\x98\x4f\x99\x4f\x9a\x4f\x9c\x4f\x9e\x4f\x9f\x00\x00\x00\x00",
 /* 8200 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4f\xa1\x4f\xa2\x4f\xa4\x4f\xab\x4f\xad\x4f\xb0\x4f\xb1\x4f\xb2\x4f\xb3\x4f\xb4\x4f\xb6\x4f\xb7\x4f\xb8\x4f\xb9\x4f\xba\x4f\xbb\x4f\xbc\x4f\xbd\x4f\xbe\x4f\xc0\x4f\xc1\x4f\xc2\x4f\xc6\x4f\xc7\x4f\xc8\x4f\xc9\x4f\xcb\x4f\xcc\x4f\xcd\x4f\xd2\x4f\xd3\x4f\xd4\x4f\xd5\x4f\xd6\x4f\xd9\x4f\xdb\x4f\xe0\x4f\xe2\x4f\xe4\x4f\xe5\x4f\xe7\x4f\xeb\x4f\xec\x4f\xf0\x4f\xf2\x4f\xf4\x4f\xf5\x4f\xf6\x4f\xf7\x4f\xf9\x4f\xfb\x4f\xfc\x4f\xfd\x4f\xff\x50\x00\x50\x01\x50\x02\x50\x03\x50\x04\x50\x05\x50\x06\x50\x07\x50\x08",
@@ -4056,7 +2038,6 @@ static uni16_t uni16[] = {
 /* cb00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x9e\x78\x9e\x79\x9e\x7a\x9e\x7b\x9e\x7c\x9e\x7d\x9e\x80\x9e\x81\x9e\x83\x9e\x84\x9e\x85\x9e\x86\x9e\x89\x9e\x8a\x9e\x8c\x9e\x8d\x9e\x8e\x9e\x8f\x9e\x90\x9e\x91\x9e\x94\x9e\x95\x9e\x96\x9e\x97\x9e\x98\x9e\x99\x9e\x9a\x9e\x9b\x9e\x9c\x9e\x9e\x9e\xa0\x9e\xa1\x9e\xa2\x9e\xa3\x9e\xa4\x9e\xa5\x9e\xa7\x9e\xa8\x9e\xa9\x9e\xaa\x9e\xab\x9e\xac\x9e\xad\x9e\xae\x9e\xaf\x9e\xb0\x9e\xb1\x9e\xb2\x9e\xb3\x9e\xb5\x9e\xb6\x9e\xb7\x9e\xb9\x9e\xba\x9e\xbc\x9e\xbf\x9e\xc0\x9e\xc1\x9e\xc2\x9e\xc3\x9e\xc5\x9e\xc6\x9e\xc7",
 /* cb80 */ "\x00\x00\x9e\xc8\x9e\xca\x9e\xcb\x9e\xcc\x9e\xd0\x9e\xd2\x9e\xd3\x9e\xd5\x9e\xd6\x9e\xd7\x9e\xd9\x9e\xda\x9e\xde\x9e\xe1\x9e\xe3\x9e\xe4\x9e\xe6\x9e\xe8\x9e\xeb\x9e\xec\x9e\xed\x9e\xee\x9e\xf0\x9e\xf1\x9e\xf2\x9e\xf3\x9e\xf4\x9e\xf5\x9e\xf6\x9e\xf7\x9e\xf8\x9e\xfa\x9e\xfd\x9e\xff\x9f\x00\x9f\x01\x9f\x02\x9f\x03\x9f\x04\x9f\x05\x9f\x06\x9f\x07\x9f\x08\x9f\x09\x9f\x0a\x9f\x0c\x9f\x0f\x9f\x11\x9f\x12\x9f\x14\x9f\x15\x9f\x16\x9f\x18\x9f\x1a\x9f\x1b\x9f\x1c\x9f\x1d\x9f\x1e\x9f\x1f\x9f\x21\x9f\x23\x9f\x24\x9f\x25\x9f\x26\x9f\x27\x9f\x28\x9f\x29\x9f\x2a\x9f\x2b\x9f\x2d\x9f\x2e\x9f\x30\x9f\x31\x9f\x32\x9f\x33\x9f\x34\x9f\x35\x9f\x36\x9f\x38\x9f\x3a\x9f\x3c\x9f\x3f\x9f\x40\x9f\x41\x9f\x42\x9f\x43\x9f\x45\x9f\x46\x9f\x47\x9f\x48\x9f\x49\x9f\x4a\x9f\x4b\x9f\x4c\x9f\x4d\x9f\x4e\x9f\x4f\x9f\x52\x9f\x53\x9f\x54\x9f\x55\x9f\x56\x9f\x57\x9f\x58\x9f\x59\x9f\x5a\x9f\x5b\x9f\x5c\x9f\x5d\x9f\x5e\x9f\x5f\x9f\x60\x9f\x61\x9f\x62\x9f\x63\x9f\x64\x9f\x65\x9f\x66\x9f\x67\x9f\x68\x9f\x69\x9f\x6a\x9f\x6b\x9f\x6c\x9f\x6d\x00\x00\x00\x00",
 /* cc00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x9f\x6e\x9f\x6f\x9f\x70\x9f\x71\x9f\x72\x9f\x73\x9f\x74\x9f\x75\x9f\x76\x9f\x77\x9f\x78\x9f\x79\x9f\x7a\x9f\x7b\x9f\x7c\x9f\x7d\x9f\x7e\x9f\x81\x9f\x82\x9f\x8d\x9f\x8e\x9f\x8f\x9f\x90\x9f\x91\x9f\x92\x9f\x93\x9f\x94\x9f\x95\x9f\x96\x9f\x97\x9f\x98\x9f\x9c\x9f\x9d\x9f\x9e\x9f\xa1\x9f\xa2\x9f\xa3\x9f\xa4\x9f\xa5\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* cc80 */ NULL,
 /* cd00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x02\xca\x02\xcb\x02\xd9\x20\x13\x20\x14\x20\x35\x21\x05\x21\x09\x21\x96\x21\x97\x21\x98\x21\x99\x22\x15\x22\x1f\x22\x23\x22\x52\x22\x66\x22\x67\x22\xbf\x25\x50\x25\x51\x25\x52\x25\x53\x25\x54\x25\x55\x25\x56\x25\x57\x25\x58\x25\x59\x25\x5a\x25\x5b\x25\x5c\x25\x5d\x25\x5e\x25\x5f\x25\x60\x25\x61\x25\x62\x25\x63\x25\x64\x25\x65\x25\x66\x25\x67\x25\x68\x25\x69\x25\x6a\x25\x6b\x25\x6c\x25\x6d\x25\x6e\x25\x6f\x25\x70\x25\x71\x25\x72\x25\x73\x25\x81\x25\x82\x25\x83\x25\x84\x25\x85\x25\x86\x25\x87\x25\x88",
 /* cd80 */ "\x00\x00\x25\x89\x25\x8a\x25\x8b\x25\x8c\x25\x8d\x25\x8e\x25\x8f\x25\x93\x25\x94\x25\x95\x25\xe2\x25\xe3\x25\xe4\x25\xe5\x26\x09\x22\x95\x30\x1d\x30\x1e\x30\x21\x30\x22\x30\x23\x30\x24\x30\x25\x30\x26\x30\x27\x30\x28\x30\x29\x32\xa3\x33\x8e\x33\x8f\x33\x9c\x33\x9d\x33\x9e\x33\xa1\x33\xc4\x33\xce\x33\xd1\x33\xd2\x33\xd5\xfe\x30\xfe\x49\xfe\x4a\xfe\x4b\xfe\x4c\xfe\x4d\xfe\x4e\xfe\x4f\xfe\x50\xfe\x51\xfe\x52\xfe\x54\xfe\x55\xfe\x56\xfe\x57\xfe\x59\xfe\x5a\xfe\x5b\xfe\x5c\xfe\x5d\xfe\x5e\xfe\x5f\xfe\x60\xfe\x61\xfe\x62\xfe\x63\xfe\x64\xfe\x65\xfe\x66\xfe\x68\xfe\x69\xfe\x6a\xfe\x6b\x30\x3e\x2f\xf0\x2f\xf1\x2f\xf2\x2f\xf3\x2f\xf4\x2f\xf5\x2f\xf6\x2f\xf7\x2f\xf8\x2f\xf9\x2f\xfa\x2f\xfb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* ce00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xf9\x2c\xf9\x79\xf9\x95\xf9\xe7\xf9\xf1\xfa\x0c\xfa\x0d\xfa\x0e\xfa\x0f\xfa\x11\xfa\x13\xfa\x14\xfa\x18\xfa\x1f\xfa\x20\xfa\x21\xfa\x23\xfa\x24\xfa\x27\xfa\x28\xfa\x29\x2e\x81\xe8\x16\xe8\x17\xe8\x18\x2e\x84\x34\x73\x34\x47\x2e\x88\x2e\x8b\xe8\x1e\x35\x9e\x36\x1a\x36\x0e\x2e\x8c\x2e\x97\x39\x6e\x39\x18\xe8\x26\x39\xcf\x39\xdf\x3a\x73\x39\xd0\xe8\x2b\xe8\x2c\x3b\x4e\x3c\x6e\x3c\xe0\x2e\xa7\xe8\x31\xe8\x32\x2e\xaa\x40\x56\x41\x5f\x2e\xae\x43\x37\x2e\xb3\x2e\xb6\x2e\xb7\xe8\x3b\x43\xb1\x43\xac\x2e\xbb",
@@ -4127,39 +2108,26 @@ static uni16_t uni16[] = {
 /* ee80 */ "\x4b\x67\x4b\x68\x4b\x69\x4b\x6a\x4b\x6b\x4b\x6c\x4b\x6d\x4b\x6e\x4b\x6f\x4b\x70\x4b\x71\x4b\x72\x4b\x73\x4b\x74\x4b\x75\x4b\x76\x4b\x77\x4b\x78\x4b\x79\x4b\x7a\x4b\x7b\x4b\x7c\x4b\x7d\x4b\x7e\x4b\x7f\x4b\x80\x4b\x81\x4b\x82\x4b\x83\x4b\x84\x4b\x85\x4b\x86\x4b\x87\x4b\x88\x4b\x89\x4b\x8a\x4b\x8b\x4b\x8c\x4b\x8d\x4b\x8e\x4b\x8f\x4b\x90\x4b\x91\x4b\x92\x4b\x93\x4b\x94\x4b\x95\x4b\x96\x4b\x97\x4b\x98\x4b\x99\x4b\x9a\x4b\x9b\x4b\x9c\x4b\x9d\x4b\x9e\x4b\x9f\x4b\xa0\x4b\xa1\x4b\xa2\x4b\xa3\x4b\xa4\x4b\xa5\x4b\xa6\x4b\xa7\x4b\xa8\x4b\xa9\x4b\xaa\x4b\xab\x4b\xac\x4b\xad\x4b\xae\x4b\xaf\x4b\xb0\x4b\xb1\x4b\xb2\x4b\xb3\x4b\xb4\x4b\xb5\x4b\xb6\x4b\xb7\x4b\xb8\x4b\xb9\x4b\xba\x4b\xbb\x4b\xbc\x4b\xbd\x4b\xbe\x4b\xbf\x4b\xc0\x4b\xc1\x4b\xc2\x4b\xc3\x4b\xc4\x4b\xc5\x4b\xc6\x4b\xc7\x4b\xc8\x4b\xc9\x4b\xca\x4b\xcb\x4b\xcc\x4b\xcd\x4b\xce\x4b\xcf\x4b\xd0\x4b\xd1\x4b\xd2\x4b\xd3\x4b\xd4\x4b\xd5\x4b\xd6\x4b\xd7\x4b\xd8\x4b\xd9\x4b\xda\x4b\xdb\x4b\xdc\x4b\xdd\x4b\xde\x4b\xdf\x4b\xe0\x4b\xe1\x4b\xe2\x4b\xe3\x4b\xe4\x4b\xe5\x00\x00",
 /* ef00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4b\xe6\x4b\xe7\x4b\xe8\x4b\xe9\x4b\xea\x4b\xeb\x4b\xec\x4b\xed\x4b\xee\x4b\xef\x4b\xf0\x4b\xf1\x4b\xf2\x4b\xf3\x4b\xf4\x4b\xf5\x4b\xf6\x4b\xf7\x4b\xf8\x4b\xf9\x4b\xfa\x4b\xfb\x4b\xfc\x4b\xfd\x4b\xfe\x4b\xff\x4c\x00\x4c\x01\x4c\x02\x4c\x03\x4c\x04\x4c\x05\x4c\x06\x4c\x07\x4c\x08\x4c\x09\x4c\x0a\x4c\x0b\x4c\x0c\x4c\x0d\x4c\x0e\x4c\x0f\x4c\x10\x4c\x11\x4c\x12\x4c\x13\x4c\x14\x4c\x15\x4c\x16\x4c\x17\x4c\x18\x4c\x19\x4c\x1a\x4c\x1b\x4c\x1c\x4c\x1d\x4c\x1e\x4c\x1f\x4c\x20\x4c\x21\x4c\x22\x4c\x23\x4c\x24",
 /* ef80 */ "\x4c\x25\x4c\x26\x4c\x27\x4c\x28\x4c\x29\x4c\x2a\x4c\x2b\x4c\x2c\x4c\x2d\x4c\x2e\x4c\x2f\x4c\x30\x4c\x31\x4c\x32\x4c\x33\x4c\x34\x4c\x35\x4c\x36\x4c\x37\x4c\x38\x4c\x39\x4c\x3a\x4c\x3b\x4c\x3c\x4c\x3d\x4c\x3e\x4c\x3f\x4c\x40\x4c\x41\x4c\x42\x4c\x43\x4c\x44\x4c\x45\x4c\x46\x4c\x47\x4c\x48\x4c\x49\x4c\x4a\x4c\x4b\x4c\x4c\x4c\x4d\x4c\x4e\x4c\x4f\x4c\x50\x4c\x51\x4c\x52\x4c\x53\x4c\x54\x4c\x55\x4c\x56\x4c\x57\x4c\x58\x4c\x59\x4c\x5a\x4c\x5b\x4c\x5c\x4c\x5d\x4c\x5e\x4c\x5f\x4c\x60\x4c\x61\x4c\x62\x4c\x63\x4c\x64\x4c\x65\x4c\x66\x4c\x67\x4c\x68\x4c\x69\x4c\x6a\x4c\x6b\x4c\x6c\x4c\x6d\x4c\x6e\x4c\x6f\x4c\x70\x4c\x71\x4c\x72\x4c\x73\x4c\x74\x4c\x75\x4c\x76\x4c\x78\x4c\x79\x4c\x7a\x4c\x7b\x4c\x7c\x4c\x7d\x4c\x7e\x4c\x7f\x4c\x80\x4c\x81\x4c\x82\x4c\x83\x4c\x84\x4c\x85\x4c\x86\x4c\x87\x4c\x88\x4c\x89\x4c\x8a\x4c\x8b\x4c\x8c\x4c\x8d\x4c\x8e\x4c\x8f\x4c\x90\x4c\x91\x4c\x92\x4c\x93\x4c\x94\x4c\x95\x4c\x96\x4c\x97\x4c\x98\x4c\x99\x4c\x9a\x4c\x9b\x4c\x9c\x4c\x9d\x4c\x9e\x4c\xa4\x4c\xa5\x4c\xa6\x4c\xa7\x4c\xa8\x4c\xa9\x00\x00",
-/* f000 */ NULL,
-/* f080 */ NULL,
-/* f100 */ NULL,
-/* f180 */ NULL,
-/* f200 */ NULL,
-/* f280 */ NULL,
-/* f300 */ NULL,
-/* f380 */ NULL,
-/* f400 */ NULL,
-/* f480 */ NULL,
-/* f500 */ NULL,
-/* f580 */ NULL,
 /* f600 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4c\xaa\x4c\xab\x4c\xac\x4c\xad\x4c\xae\x4c\xaf\x4c\xb0\x4c\xb1\x4c\xb2\x4c\xb3\x4c\xb4\x4c\xb5\x4c\xb6\x4c\xb7\x4c\xb8\x4c\xb9\x4c\xba\x4c\xbb\x4c\xbc\x4c\xbd\x4c\xbe\x4c\xbf\x4c\xc0\x4c\xc1\x4c\xc2\x4c\xc3\x4c\xc4\x4c\xc5\x4c\xc6\x4c\xc7\x4c\xc8\x4c\xc9\x4c\xca\x4c\xcb\x4c\xcc\x4c\xcd\x4c\xce\x4c\xcf\x4c\xd0\x4c\xd1\x4c\xd2\x4c\xd3\x4c\xd4\x4c\xd5\x4c\xd6\x4c\xd7\x4c\xd8\x4c\xd9\x4c\xda\x4c\xdb\x4c\xdc\x4c\xdd\x4c\xde\x4c\xdf\x4c\xe0\x4c\xe1\x4c\xe2\x4c\xe3\x4c\xe4\x4c\xe5\x4c\xe6\x4c\xe7\x4c\xe8",
 /* f680 */ "\x4c\xe9\x4c\xea\x4c\xeb\x4c\xec\x4c\xed\x4c\xee\x4c\xef\x4c\xf0\x4c\xf1\x4c\xf2\x4c\xf3\x4c\xf4\x4c\xf5\x4c\xf6\x4c\xf7\x4c\xf8\x4c\xf9\x4c\xfa\x4c\xfb\x4c\xfc\x4c\xfd\x4c\xfe\x4c\xff\x4d\x00\x4d\x01\x4d\x02\x4d\x03\x4d\x04\x4d\x05\x4d\x06\x4d\x07\x4d\x08\x4d\x09\x4d\x0a\x4d\x0b\x4d\x0c\x4d\x0d\x4d\x0e\x4d\x0f\x4d\x10\x4d\x11\x4d\x12\x4d\x1a\x4d\x1b\x4d\x1c\x4d\x1d\x4d\x1e\x4d\x1f\x4d\x20\x4d\x21\x4d\x22\x4d\x23\x4d\x24\x4d\x25\x4d\x26\x4d\x27\x4d\x28\x4d\x29\x4d\x2a\x4d\x2b\x4d\x2c\x4d\x2d\x4d\x2e\x4d\x2f\x4d\x30\x4d\x31\x4d\x32\x4d\x33\x4d\x34\x4d\x35\x4d\x36\x4d\x37\x4d\x38\x4d\x39\x4d\x3a\x4d\x3b\x4d\x3c\x4d\x3d\x4d\x3e\x4d\x3f\x4d\x40\x4d\x41\x4d\x42\x4d\x43\x4d\x44\x4d\x45\x4d\x46\x4d\x47\x4d\x48\x4d\x49\x4d\x4a\x4d\x4b\x4d\x4c\x4d\x4d\x4d\x4e\x4d\x4f\x4d\x50\x4d\x51\x4d\x52\x4d\x53\x4d\x54\x4d\x55\x4d\x56\x4d\x57\x4d\x58\x4d\x59\x4d\x5a\x4d\x5b\x4d\x5c\x4d\x5d\x4d\x5e\x4d\x5f\x4d\x60\x4d\x61\x4d\x62\x4d\x63\x4d\x64\x4d\x65\x4d\x66\x4d\x67\x4d\x68\x4d\x69\x4d\x6a\x4d\x6b\x4d\x6c\x4d\x6d\x4d\x6e\x00\x00",
 /* f700 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x4d\x6f\x4d\x70\x4d\x71\x4d\x72\x4d\x73\x4d\x74\x4d\x75\x4d\x76\x4d\x77\x4d\x78\x4d\x79\x4d\x7a\x4d\x7b\x4d\x7c\x4d\x7d\x4d\x7e\x4d\x7f\x4d\x80\x4d\x81\x4d\x82\x4d\x83\x4d\x84\x4d\x85\x4d\x86\x4d\x87\x4d\x88\x4d\x89\x4d\x8a\x4d\x8b\x4d\x8c\x4d\x8d\x4d\x8e\x4d\x8f\x4d\x90\x4d\x91\x4d\x92\x4d\x93\x4d\x94\x4d\x95\x4d\x96\x4d\x97\x4d\x98\x4d\x99\x4d\x9a\x4d\x9b\x4d\x9c\x4d\x9d\x4d\x9e\x4d\x9f\x4d\xa0\x4d\xa1\x4d\xa2\x4d\xa3\x4d\xa4\x4d\xa5\x4d\xa6\x4d\xa7\x4d\xa8\x4d\xa9\x4d\xaa\x4d\xab\x4d\xac\x4d\xad",
 /* f780 */ "\x4d\xaf\x4d\xb0\x4d\xb1\x4d\xb2\x4d\xb3\x4d\xb4\x4d\xb5\x4d\xb6\x4d\xb7\x4d\xb8\x4d\xb9\x4d\xba\x4d\xbb\x4d\xbc\x4d\xbd\x4d\xbe\x4d\xbf\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
 /* f800 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfb\x56\xfb\x57\xfb\x58\xfb\x59\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfb\x7a\xfb\x7b\xfb\x7c\xfb\x7d\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfb\x8e",
 /* f880 */ "\xfb\x8f\xfb\x90\xfb\x91\xfb\x92\xfb\x93\xfb\x94\xfb\x95\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfb\xaa\xfb\xab\xfb\xac\xfb\xad\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfb\xd3\xfb\xd4\xfb\xd5\xfb\xd6\xfb\xd7\xfb\xd8\xfb\xd9\xfb\xda\xfb\xdb\xfb\xdc\xfb\xdd\xfb\xde\xfb\xdf\xfb\xe0\xfb\xe1\xfb\xe2\xfb\xe3\xfb\xe4\xfb\xe5\xfb\xe6\xfb\xe7\xfb\xe8\xfb\xe9\xfb\xea\xfb\xeb\xfb\xec\xfb\xed\xfb\xee\xfb\xef\xfb\xf0\xfb\xf1\xfb\xf2\xfb\xf3\xfb\xf4\xfb\xf5\xfb\xf6\xfb\xf7\xfb\xf8\xfb\xf9\xfb\xfa\xfb\xfb\xfb\xfc\xfb\xfd\xfb\xfe\xfb\xff\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* f900 */ NULL,
-/* f980 */ NULL,
-/* fa00 */ NULL,
-/* fa80 */ NULL,
-/* fb00 */ NULL,
 /* fb80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfe\x89\xfe\x8a\xfe\x8b\xfe\x8c\xfe\x8d\xfe\x8e\xfe\x8f\xfe\x90\xfe\x91\xfe\x92\x00\x00\x00\x00\xfe\x95\xfe\x96\xfe\x97\xfe\x98\x00\x00\x00\x00\x00\x00\x00\x00\xfe\x9d\xfe\x9e\xfe\x9f\xfe\xa0\xfe\xa1\xfe\xa2\xfe\xa3\xfe\xa4\xfe\xa5\xfe\xa6\xfe\xa7\xfe\xa8\xfe\xa9\xfe\xaa\x00\x00\x00\x00\xfe\xad\xfe\xae\xfe\xaf\xfe\xb0\xfe\xb1\xfe\xb2\xfe\xb3\xfe\xb4\xfe\xb5\xfe\xb6\xfe\xb7\x00\x00",
 /* fc00 */ "\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfe\xb8\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xfe\xc9\xfe\xca\xfe\xcb\xfe\xcc\xfe\xcd\xfe\xce\xfe\xcf\xfe\xd0\xfe\xd1\xfe\xd2\xfe\xd3\xfe\xd4\xfe\xd5\xfe\xd6\xfe\xd7\xfe\xd8\xfe\xd9\xfe\xda\xfe\xdb\xfe\xdc\xfe\xdd\xfe\xde\xfe\xdf\xfe\xe0\xfe\xe1\xfe\xe2\xfe\xe3\xfe\xe4\xfe\xe5\xfe\xe6\xfe\xe7\xfe\xe8\xfe\xe9\xfe\xea\xfe\xeb\xfe\xec\xfe\xed\xfe\xee\xfe\xef\xfe\xf0\xfe\xf1\xfe\xf2\xfe\xf3\xfe\xf4\x00\x00\x00\x00",
-/* fc80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\xfe\xfb\xfe\xfc\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe7\x8d\xe7\x8e\xe7\x8f\xe7\x90\xe7\x91\xe7\x92\xe7\x93\xe7\x94\xe7\x95\xe7\x96\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
-/* fd00 */ NULL,
-/* fd80 */ NULL,
-/* fe00 */ NULL,
-/* fe80 */ NULL,
-/* ff00 */ NULL,
-/* ff80 */ NULL }
-    },
+/* fc80 */ "\x00\x00\x00\x00\x00\x00\x00\x00\xfe\xfb\xfe\xfc\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\xe7\x8d\xe7\x8e\xe7\x8f\xe7\x90\xe7\x91\xe7\x92\xe7\x93\xe7\x94\xe7\x95\xe7\x96\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00"
+};
+
+static const uni16_t uni16[] = {
+    { "cp930", "0x0172012c" /* 370, 300 */,
+      cp930_u2ebc_ix, cp930_u2ebc, cp930_ebc2u_ix, cp930_ebc2u },
+    { "cp935", "0x04380345" /* 1080, 837 */,
+      cp935_u2ebc_ix, cp935_u2ebc, cp935_ebc2u_ix, cp935_ebc2u },
+    { "cp937", "0x03a70343" /* 935, 835 */,
+      cp937_u2ebc_ix, cp937_u2ebc, cp937_ebc2u_ix, cp937_ebc2u },
+    { "cp1388", "0x03a90345" /* 937, 837 */,
+      cp1388_u2ebc_ix, cp1388_u2ebc, cp1388_ebc2u_ix, cp1388_ebc2u },
     { NULL }
 };
 
@@ -4181,7 +2149,7 @@ cpalias_t cpaliases16[] = {
     { NULL,			NULL }
 };
 
-static uni16_t *cur_uni16 = NULL;
+static const uni16_t *cur_uni16 = NULL;
 
 /*
  * Translate a single DBCS EBCDIC character to Unicode.
@@ -4201,12 +2169,12 @@ ebcdic_dbcs_to_unicode(ebc_t c, unsigned flags)
 	if (c == 0x4040)
 		return 0x3000;
 
-	row = (c >> 7) & 0x1ff;
-	if (cur_uni16->ebc2u[row] == NULL)
+	row = cur_uni16->ebc2u_ix[(c >> 7) & 0x1ff];
+	if (!row)
 	    	return (flags & EUO_BLANK_UNDEF)? 0x3000: 0;
 	col = (c & 0x7f) * 2;
-	ix = ((cur_uni16->ebc2u[row][col] & 0xff) << 8) |
-	      (cur_uni16->ebc2u[row][col + 1] & 0xff);
+	ix = ((cur_uni16->ebc2u[row - 1][col] & 0xff) << 8) |
+	      (cur_uni16->ebc2u[row - 1][col + 1] & 0xff);
 	if (ix)
 	    	return ix;
 	else
@@ -4228,12 +2196,12 @@ unicode_to_ebcdic_dbcs(ucs4_t u)
 	if (u == 0x3000)
 		return 0x4040;
 
-	row = (u >> 7) & 0x1ff;
-	if (cur_uni16->u2ebc[row] == NULL)
+	row = cur_uni16->u2ebc_ix[(u >> 7) & 0x1ff];
+	if (!row)
 	    	return 0;
 	col = (u & 0x7f) * 2;
-	ix = ((cur_uni16->u2ebc[row][col] & 0xff) << 8) |
-	      (cur_uni16->u2ebc[row][col + 1] & 0xff);
+	ix = ((cur_uni16->u2ebc[row - 1][col] & 0xff) << 8) |
+	      (cur_uni16->u2ebc[row - 1][col + 1] & 0xff);
 	return ix;
 }
 
@@ -33,6 +33,7 @@
 
 #include "globals.h"
 
+#include "simd.h"
 #include "utf8.h"
 
 char *locale_codeset = NULL;
@@ -141,6 +142,19 @@ unicode_to_utf8(ucs4_t ucs4, char *utf8)
     }
 }
 
+/*
+ * Return the length of the run of 7-bit ASCII characters other than NUL at
+ * the start of a string, looking at most at 'len' bytes.
+ *
+ * The bytes are checked many at a time, which makes long runs of ASCII
+ * much cheaper than decoding them one sequence at a time.
+ */
+size_t
+utf8_ascii_run(const char *s, size_t len)
+{
+    return (*simd_ascii_run)((const unsigned char *)s, len);
+}
+
 /*
  * Convert at most 'len' bytes from a UTF-8 string to one UCS-4 character.
  * Returns:
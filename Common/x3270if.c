@@ -93,13 +93,16 @@
 #define NO_STATUS	(-1)
 #define ALL_FIELDS	(-2)
 
+#define BATCH_WINDOW	16384	/* command bytes sent ahead of results */
+#define BATCH_SEP	"== "	/* batch result separator */
+
 #if defined(_WIN32) /*[*/
 #define DIRSEP	'\\'
-#define OPTS	"H:iI:L:s:St:v"
+#define OPTS	"bcH:iI:L:s:St:v"
 #define FD_ENV_REQUIRED	true
 #else /*][*/
 #define DIRSEP '/'
-#define OPTS	"H:iI:L:p:Ps:St:v"
+#define OPTS	"bcH:iI:L:p:Ps:St:v"
 #define FD_ENV_REQUIRED	false
 #endif /*]*/
 
@@ -119,6 +122,8 @@ static char *buf;
 static size_t buf_size = 0;
 
 static void iterative_io(int pid, unsigned short port);
+static int batch_io(int pid, unsigned short port, const char *file,
+	bool coprocess);
 static int single_io(int pid, unsigned short port, socket_t socket, int infd,
 	int outfd, int fn, char *cmd, char **data_ret, char **prompt_ret,
 	itype_t *itype);
@@ -153,6 +158,10 @@ usage:\n\
    display all status fields\n\
  %s [options] -i\n\
    shuttle commands and responses between stdin/stdout and emulator\n\
+ %s [options] -b [file]\n\
+   run commands from a file or stdin over one connection\n\
+ %s [options] -c\n\
+   co-process: run commands from stdin one at a time until EOF\n\
  %s [options] -I <emulator-name> [-H <help-action-name>]\n\
    interactive command window\n\
  %s --version\n\
@@ -162,7 +171,7 @@ options:\n\
 " -p pid   connect to process <pid>\n"
 #endif /*]*/
 " -t port  connect to TCP port <port>\n",
-	    me, me, me, me, me, me);
+	    me, me, me, me, me, me, me, me);
     exit(__LINE__);
 }
 
@@ -202,6 +211,8 @@ main(int argc, char *argv[])
     int fn = NO_STATUS;
     char *ptr;
     int iterative = 0;
+    int batch = 0;
+    bool coprocess = false;
     int pid = 0;
     unsigned short port = 0;
     const char *emulator_name = NULL;
@@ -233,6 +244,13 @@ main(int argc, char *argv[])
     opterr = 0;
     while ((c = getopt(argc, argv, OPTS)) != -1) {
 	switch (c) {
+	case 'b':
+	    batch++;
+	    break;
+	case 'c':
+	    batch++;
+	    coprocess = true;
+	    break;
 	case 'H':
 	    help_name = optarg;
 	    break;
@@ -297,7 +315,13 @@ main(int argc, char *argv[])
     }
 
     /* Validate positional arguments. */
-    if (optind == argc) {
+    if (batch) {
+	/* Batch mode takes an optional file name. */
+	if (batch > 1 || iterative || fn != NO_STATUS ||
+		argc - optind > (coprocess? 0: 1)) {
+	    x3270if_usage();
+	}
+    } else if (optind == argc) {
 	/* No positional arguments. */
 	if (fn == NO_STATUS && !iterative) {
 	    x3270if_usage();
@@ -324,7 +348,10 @@ main(int argc, char *argv[])
 #endif /*]*/
 
     /* Do the I/O. */
-    if (iterative && emulator_name != NULL) {
+    if (batch) {
+	return batch_io(pid, port, (optind < argc)? argv[optind]: NULL,
+		coprocess);
+    } else if (iterative && emulator_name != NULL) {
 	interactive_io(port, emulator_name, help_name, localization);
     } else if (iterative) {
 	iterative_io(pid, port);
@@ -715,6 +742,261 @@ get_ports(socket_t *socket, int *infd, int *outfd)
 #endif /*]*/
 }
 
+/* Batch mode connection: a socket, or a pair of pipes. */
+static socket_t batch_socket = INVALID_SOCKET;
+static int batch_infd = -1;
+static int batch_outfd = -1;
+
+/* Connect to the emulator for batch mode. */
+static void
+batch_connect(int pid, unsigned short port)
+{
+    int port_env;
+
+#if !defined(_WIN32) /*[*/
+    if (pid) {
+	batch_socket = usock(pid);
+	return;
+    }
+#endif /*]*/
+    if (port) {
+	batch_socket = tsock(port);
+    } else if ((port_env = fd_env(PORT_ENV, FD_ENV_REQUIRED)) >= 0) {
+	batch_socket = tsock(port_env);
+    }
+#if !defined(_WIN32) /*[*/
+    else {
+	batch_infd = fd_env(OUTPUT_ENV, true);
+	batch_outfd = fd_env(INPUT_ENV, true);
+    }
+#endif /*]*/
+}
+
+/* Send a command to the emulator in batch mode. */
+static void
+batch_send(const char *s, size_t len)
+{
+    while (len > 0) {
+	int nw;
+
+	if (batch_socket != INVALID_SOCKET) {
+	    nw = send(batch_socket, s, (int)len, 0);
+	} else {
+	    nw = write(batch_outfd, s, (int)len);
+	}
+	if (nw < 0) {
+#if defined(_WIN32) /*[*/
+	    win32_perror("x3270if: send");
+#else /*][*/
+	    perror((batch_socket != INVALID_SOCKET)? "x3270if: send":
+		    "x3270if: write");
+#endif /*]*/
+	    exit(__LINE__);
+	}
+	s += nw;
+	len -= nw;
+    }
+}
+
+/*
+ * Read a command line from a batch file, without the trailing newline.
+ * Returns NULL at EOF. The buffer is reused by the next call.
+ */
+static char *
+batch_getline(FILE *f)
+{
+    static char *line = NULL;
+    static size_t line_size = 0;
+    size_t sl = 0;
+
+    for (;;) {
+	if (line_size - sl < IBS) {
+	    line_size += IBS;
+	    line = Realloc(line, line_size);
+	}
+	if (fgets(line + sl, (int)(line_size - sl), f) == NULL) {
+	    if (sl == 0) {
+		return NULL;
+	    }
+	    break;
+	}
+	sl += strlen(line + sl);
+	if (sl > 0 && line[sl - 1] == '\n') {
+	    break;
+	}
+    }
+    while (sl > 0 && (line[sl - 1] == '\n' || line[sl - 1] == '\r')) {
+	sl--;
+    }
+    line[sl] = '\0';
+    return line;
+}
+
+/*
+ * Run commands from a file (or stdin) over one connection.
+ *
+ * Commands are pipelined: up to BATCH_WINDOW bytes of commands are sent
+ * ahead of their results. In co-process mode, each command is sent only
+ * after the previous result has been written and flushed, so a shell
+ * co-process can read each result before writing the next command.
+ *
+ * Each result is written as its data lines, followed by a separator line:
+ *  == <command-number> ok|error <status-line>
+ * Blank lines and lines beginning with '#' are skipped.
+ *
+ * Returns the exit status: 0 if every command succeeded, 1 otherwise.
+ */
+static int
+batch_io(int pid, unsigned short port, const char *file, bool coprocess)
+{
+    FILE *f = stdin;
+    size_t *sent = NULL;	/* lengths of commands awaiting results */
+    size_t sent_alloc = 0;
+    size_t head = 0, tail = 0;	/* sent[head..tail) are outstanding */
+    size_t ahead = 0;		/* bytes of commands awaiting results */
+    unsigned long n_done = 0;	/* number of results collected */
+    bool eof = false;
+    bool errors = false;
+    char *status = NULL;
+    char *line = NULL;
+    size_t line_size = 0;
+    size_t sl = 0;
+    char rbuf[IBS];
+
+    if (file != NULL && strcmp(file, "-") && (f = fopen(file, "r")) == NULL) {
+	perror(file);
+	exit(__LINE__);
+    }
+    batch_connect(pid, port);
+
+    for (;;) {
+	int nr;
+	int i;
+
+	/* Send commands ahead. */
+	while (!eof && (head == tail || (!coprocess && ahead < BATCH_WINDOW))) {
+	    char *cmd = batch_getline(f);
+	    size_t len;
+
+	    if (cmd == NULL) {
+		eof = true;
+		break;
+	    }
+	    if (!*cmd || *cmd == '#') {
+		continue;
+	    }
+	    if (verbose) {
+		fprintf(stderr, "i+ out %s\n", cmd);
+	    }
+	    len = strlen(cmd);
+	    cmd[len++] = '\n';
+	    batch_send(cmd, len);
+
+	    if (tail == sent_alloc) {
+		if (head > 0) {
+		    memmove(sent, sent + head, (tail - head) * sizeof(size_t));
+		    tail -= head;
+		    head = 0;
+		} else {
+		    sent_alloc += 64;
+		    sent = Realloc(sent, sent_alloc * sizeof(size_t));
+		}
+	    }
+	    sent[tail++] = len;
+	    ahead += len;
+	}
+	if (head == tail) {
+	    /* All done. */
+	    break;
+	}
+
+	/* Collect results. */
+	nr = (batch_socket != INVALID_SOCKET)?
+	    recv(batch_socket, rbuf, IBS, 0): read(batch_infd, rbuf, IBS);
+	if (nr < 0) {
+#if defined(_WIN32) /*[*/
+	    win32_perror("x3270if: recv");
+#else /*][*/
+	    perror((batch_socket != INVALID_SOCKET)? "x3270if: recv":
+		    "x3270if: read");
+#endif /*]*/
+	    exit(__LINE__);
+	}
+	if (nr == 0) {
+	    fflush(stdout);
+	    fprintf(stderr, "x3270if: unexpected EOF, %u command%s pending\n",
+		    (unsigned)(tail - head), (tail - head == 1)? "": "s");
+	    return 1;
+	}
+
+	for (i = 0; i < nr; i++) {
+	    bool ok;
+
+	    if (rbuf[i] != '\n') {
+		if (sl + 1 >= line_size) {
+		    line_size += IBS;
+		    line = Realloc(line, line_size);
+		}
+		line[sl++] = rbuf[i];
+		continue;
+	    }
+
+	    /* Process one line of output. */
+	    if (line == NULL) {
+		line_size = IBS;
+		line = Malloc(line_size);
+	    }
+	    line[sl] = '\0';
+	    sl = 0;
+	    if (verbose) {
+		fprintf(stderr, "i+ in %s\n", line);
+	    }
+	    if (!strncmp(line, DATA_PREFIX, PREFIX_LEN)) {
+		printf("%s\n", line + PREFIX_LEN);
+		continue;
+	    }
+	    if (!strncmp(line, INPUT_PREFIX, PREFIX_LEN) ||
+		    !strncmp(line, PWINPUT_PREFIX, PREFIX_LEN)) {
+		printf("%s\n", line);
+		continue;
+	    }
+	    ok = !strcmp(line, PROMPT_OK);
+	    if (!ok && strcmp(line, PROMPT_ERROR)) {
+		Replace(status, NewString(line));
+		continue;
+	    }
+
+	    /* End of one result. */
+	    if (!ok) {
+		errors = true;
+	    }
+	    ahead -= sent[head++];
+	    if (printf(BATCH_SEP "%lu %s %s\n", ++n_done,
+			ok? PROMPT_OK: PROMPT_ERROR,
+			(status != NULL)? status: "") < 0) {
+		perror("x3270if: printf");
+		exit(__LINE__);
+	    }
+	    Replace(status, NULL);
+	    if (coprocess && fflush(stdout) < 0) {
+		perror("x3270if: fflush");
+		exit(__LINE__);
+	    }
+	}
+    }
+
+    if (fflush(stdout) < 0) {
+	perror("x3270if: fflush");
+	exit(__LINE__);
+    }
+    if (f != stdin) {
+	fclose(f);
+    }
+    Free(sent);
+    Free(line);
+    return errors? 1: 0;
+}
+
 #if !defined(_WIN32) /*[*/
 
 /* Act as a passive pipe to the emulator. */
@@ -30,6 +30,10 @@ XX_FB(x3270if) [option]... [ XX_FI(action) ]
 XX_BR
 XX_FB(x3270if) [option]... XX_DASHED(i)
 XX_BR
+XX_FB(x3270if) [option]... XX_DASHED(b) [XX_FI(file)]
+XX_BR
+XX_FB(x3270if) [option]... XX_DASHED(c)
+XX_BR
 XX_FB(x3270if) [option]... XX_DASHED(I) XX_FI(emulator-name) [XX_DASHED(H) XX_FI(help-action)]
 XX_SH(Description)
 XX_FB(x3270if) provides an interface between scripts and
@@ -2,6 +2,8 @@
 # Grab the DBCS part of a DBCS or MBCS ucm file and output DBCS translation
 # tables.
 
+# Usage: Edbcs_ucm.pl ucm-name [table-prefix]
+
 my $file = $ARGV[0];
 my $in = 0;
 my %d2u;
@@ -29,63 +31,46 @@ while (<TABLE>) {
     }
 }
 
-print "/* Unicode to EBCDIC DBCS translation table for $file */\n";
-my $row = "";
-my $i;
-my $any = 0;
-foreach $i (0..65535) {
-    if ($i && !($i % 128)) {
-	printf "/* %04x */ ", $i - 128;
-	if ($any) {
-	    print "\"$row\",\n";
-	} else {
-	    print "NULL,\n";
-	}
-	$row = "";
-	$any = 0;
-    }
-    if ($u2d{$i}) {
-	$row .= sprintf("\\x%02x\\x%02x",
-	    ($u2d{$i} >> 8) & 0xff, $u2d{$i} & 0xff);
-	$any = 1;
-    } else {
-	$row .= "\\x00\\x00";
-    }
-}
-print "/* ff80 */ ";
-if ($any) {
-    print "\"$row\"";
-} else {
-    print "NULL";
-}
-print " };\n";
+# Dump one direction as a row index plus the populated 128-character rows.
+sub dump_table {
+    my ($title, $name, $map) = @_;
+    my @ix;
+    my @rows;
+    my $r;
+    my $i;
 
-print "/* EBCDIC DBCS to Unicode translation table for $file */\n";
-$row = "";
-$any = 0;
-foreach $i (0..65535) {
-    if ($i && !($i % 128)) {
-	printf "/* %04x */ ", $i - 128;
+    foreach $r (0..511) {
+	my $row = "";
+	my $any = 0;
+	foreach $i ($r * 128..$r * 128 + 127) {
+	    if ($map->{$i}) {
+		$row .= sprintf("\\x%02x\\x%02x",
+		    ($map->{$i} >> 8) & 0xff, $map->{$i} & 0xff);
+		$any = 1;
+	    } else {
+		$row .= "\\x00\\x00";
+	    }
+	}
 	if ($any) {
-	    print "\"$row\",\n";
+	    push @rows, sprintf("/* %04x */ \"%s\"", $r * 128, $row);
+	    push @ix, scalar(@rows);
 	} else {
-	    print "NULL,\n";
+	    push @ix, 0;
 	}
-	$row = "";
-	$any = 0;
     }
-    if ($d2u{$i}) {
-	$row .= sprintf("\\x%02x\\x%02x",
-	    ($d2u{$i} >> 8) & 0xff, $d2u{$i} & 0xff);
-	$any = 1;
-    } else {
-	$row .= "\\x00\\x00";
+
+    print "/* $title translation table for $file */\n";
+    print "static const unsigned short ${name}_ix[512] = {\n";
+    foreach $r (0..31) {
+	printf "/* %04x */ %s%s\n", $r * 16 * 128,
+	    join(", ", @ix[$r * 16..$r * 16 + 15]), ($r < 31)? ",": "";
     }
+    print "};\n";
+    print "static const uni16_row_t ${name}[] = {\n";
+    print join(",\n", @rows), "\n";
+    print "};\n\n";
 }
-print "/* ff80 */ ";
-if ($any) {
-    print "\"$row\"";
-} else {
-    print "NULL";
-}
-print " };\n";
+
+my $cp = $ARGV[1] || "cp";
+dump_table("Unicode to EBCDIC DBCS", "${cp}_u2ebc", \%u2d);
+dump_table("EBCDIC DBCS to Unicode", "${cp}_ebc2u", \%d2u);
@@ -0,0 +1,823 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of Paul Mattes nor his contributors may be used
+ *       to endorse or promote products derived from this software without
+ *       specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Synthetic TN3270 host for x3270 benchmarking
+ *
+ * Accepts any number of emulator connections, negotiates TN3270E (or
+ * TN3270, if the emulator refuses), then sends each one a stream of
+ * generated 3270 records and reports throughput and round-trip latency.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <signal.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <arpa/telnet.h>
+
+#define PORT		4002
+#define RECORDS		1000
+#define MIX		"ewq"
+#define BSIZE		16384
+#define OBUF_MAX	65536	/* stop generating when this much is queued */
+
+#define TELOPT_TN3270E	40
+#define TN3270E_ASSOCIATE	0
+#define TN3270E_CONNECT		1
+#define TN3270E_DEVICE_TYPE	2
+#define TN3270E_FUNCTIONS	3
+#define TN3270E_IS		4
+#define TN3270E_REQUEST		7
+#define TN3270E_SEND		8
+#define TN3270E_FUNC_DATA_STREAM_CTL 1
+
+#define DT_3270_DATA	0x00
+#define DT_NVT_DATA	0x05
+#define EH_SIZE		5
+
+#define CMD_W		0xf1
+#define CMD_EW		0xf5
+#define CMD_WSF		0xf3
+#define ORDER_SF	0x1d
+#define ORDER_SBA	0x11
+#define ORDER_IC	0x13
+#define ORDER_SA	0x28
+#define WCC_RESTORE	0x02
+#define WCC_RESET_MDT	0x01
+
+#define ROWS		24
+#define COLS		80
+#define MAX_ROWS	62	/* largest oversize screen */
+#define MAX_COLS	160
+
+char *me;
+static int port = PORT;
+static int records = RECORDS;
+static const char *mix = MIX;
+static int wait_aid = 0;
+static int json = 0;	/* report results as JSON */
+static int rows = ROWS;	/* screen geometry */
+static int cols = COLS;
+
+/* A connected emulator. */
+typedef struct {
+    int s;		/* socket, or -1 */
+    int tn3270e;	/* negotiated TN3270E */
+    int ready;		/* negotiation complete */
+    int sent;		/* records sent */
+    int waiting;	/* waiting for an AID */
+    double sent_at;	/* when the awaited record was sent */
+    unsigned short seq;	/* TN3270E sequence number */
+    enum {
+	TS_DATA, TS_IAC, TS_WILL, TS_WONT, TS_DO, TS_DONT, TS_SB, TS_SB_IAC
+    } tstate;		/* TELNET input state */
+    unsigned char ibuf[BSIZE]; /* record being received */
+    size_t ilen;
+    unsigned char *obuf; /* output waiting to be sent */
+    size_t olen;
+    size_t osize;
+} host_t;
+static host_t *hosts = NULL;
+static int n_hosts = 0;
+
+/* Statistics. */
+static unsigned long st_connections = 0;
+static unsigned long st_records = 0;
+static unsigned long st_bytes = 0;
+static unsigned long st_rtts = 0;
+static double st_rtt_sum = 0.0;
+static double st_rtt_min = -1.0;
+static double st_rtt_max = 0.0;
+static double st_start = 0.0;
+static volatile sig_atomic_t done = 0;
+
+/* cp037 translations of the printable ASCII characters. */
+static const unsigned char asc2ebc[95] = {
+    0x40, 0x5a, 0x7f, 0x7b, 0x5b, 0x6c, 0x50, 0x7d,	/*  !"#$%&' */
+    0x4d, 0x5d, 0x5c, 0x4e, 0x6b, 0x60, 0x4b, 0x61,	/* ()*+,-./ */
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,	/* 01234567 */
+    0xf8, 0xf9, 0x7a, 0x5e, 0x4c, 0x7e, 0x6e, 0x6f,	/* 89:;<=>? */
+    0x7c, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,	/* @ABCDEFG */
+    0xc8, 0xc9, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6,	/* HIJKLMNO */
+    0xd7, 0xd8, 0xd9, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6,	/* PQRSTUVW */
+    0xe7, 0xe8, 0xe9, 0xba, 0xe0, 0xbb, 0xb0, 0x6d,	/* XYZ[\]^_ */
+    0x79, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,	/* `abcdefg */
+    0x88, 0x89, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96,	/* hijklmno */
+    0x97, 0x98, 0x99, 0xa2, 0xa3, 0xa4, 0xa5, 0xa6,	/* pqrstuvw */
+    0xa7, 0xa8, 0xa9, 0xc0, 0x4f, 0xd0, 0xa1		/* xyz{|}~ */
+};
+
+/* 3270 buffer address encoding. */
+static const unsigned char code_table[64] = {
+    0x40, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+    0xc8, 0xc9, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x50, 0xd1, 0xd2, 0xd3, 0xd4, 0xd5, 0xd6, 0xd7,
+    0xd8, 0xd9, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+    0x60, 0x61, 0xe2, 0xe3, 0xe4, 0xe5, 0xe6, 0xe7,
+    0xe8, 0xe9, 0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f,
+    0xf0, 0xf1, 0xf2, 0xf3, 0xf4, 0xf5, 0xf6, 0xf7,
+    0xf8, 0xf9, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f
+};
+
+void
+usage(void)
+{
+    fprintf(stderr, "usage: %s [-p port] [-n records] [-m mix] [-g colsxrows] "
+	    "[-a] [-j]\n", me);
+    fprintf(stderr, "  -p  port to listen on (default %d)\n", PORT);
+    fprintf(stderr, "  -n  records to send on each connection (default %d)\n",
+	    RECORDS);
+    fprintf(stderr, "  -m  record types to send, in rotation (default %s):\n",
+	    MIX);
+    fprintf(stderr, "        e  Erase/Write with fields\n");
+    fprintf(stderr, "        w  Write with SBA and SA orders\n");
+    fprintf(stderr, "        q  Read Partition Query structured field\n");
+    fprintf(stderr, "        t  NVT text (TN3270E only)\n");
+    fprintf(stderr, "  -g  screen size to fill (default %dx%d, at most %dx%d)\n",
+	    COLS, ROWS, MAX_COLS, MAX_ROWS);
+    fprintf(stderr, "  -a  wait for an AID after each e or w record\n");
+    fprintf(stderr, "  -j  write results as JSON lines\n");
+    exit(1);
+}
+
+/* Returns the current time in seconds. */
+static double
+now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+/* Queue output for a host, optionally doubling IACs. */
+static void
+queue(host_t *h, const unsigned char *buf, size_t len, int escape)
+{
+    size_t i;
+
+    if (h->olen + 2 * len > h->osize) {
+	h->osize = h->olen + 2 * len + BSIZE;
+	h->obuf = realloc(h->obuf, h->osize);
+	if (h->obuf == NULL) {
+	    fprintf(stderr, "Out of memory\n");
+	    exit(1);
+	}
+    }
+    for (i = 0; i < len; i++) {
+	h->obuf[h->olen++] = buf[i];
+	if (escape && buf[i] == IAC) {
+	    h->obuf[h->olen++] = IAC;
+	}
+    }
+}
+
+/* Queue a TELNET command. */
+static void
+queue_cmd(host_t *h, unsigned char cmd, unsigned char opt)
+{
+    unsigned char buf[3];
+
+    buf[0] = IAC;
+    buf[1] = cmd;
+    buf[2] = opt;
+    queue(h, buf, 3, 0);
+}
+
+/* Queue a TN3270E subnegotiation. */
+static void
+queue_sb(host_t *h, const unsigned char *buf, size_t len)
+{
+    unsigned char pfx[3];
+    unsigned char sfx[2];
+
+    pfx[0] = IAC;
+    pfx[1] = SB;
+    pfx[2] = TELOPT_TN3270E;
+    sfx[0] = IAC;
+    sfx[1] = SE;
+    queue(h, pfx, 3, 0);
+    queue(h, buf, len, 1);
+    queue(h, sfx, 2, 0);
+}
+
+/* Add a buffer address to a record, using 14-bit form past 4095. */
+static unsigned char *
+put_addr(unsigned char *cp, int baddr)
+{
+    if (baddr >= 4096) {
+	*cp++ = (baddr >> 8) & 0x3f;
+	*cp++ = baddr & 0xff;
+	return cp;
+    }
+    *cp++ = code_table[(baddr >> 6) & 0x3f];
+    *cp++ = code_table[baddr & 0x3f];
+    return cp;
+}
+
+/* Add ASCII text to a record, in EBCDIC. */
+static unsigned char *
+put_text(unsigned char *cp, const char *text)
+{
+    while (*text) {
+	unsigned char c = (unsigned char)*text++;
+
+	*cp++ = (c >= ' ' && c <= '~')? asc2ebc[c - ' ']: 0x40;
+    }
+    return cp;
+}
+
+/* Generate and queue the next record for a host. */
+static void
+send_record(host_t *h)
+{
+    unsigned char buf[BSIZE];
+    unsigned char *cp = buf;
+    char text[128];
+    int type = mix[h->sent % strlen(mix)];
+    int row;
+    unsigned char eor[2];
+
+    if (type == 't' && !h->tn3270e) {
+	type = 'w';
+    }
+
+    /* TN3270E header. */
+    if (h->tn3270e) {
+	*cp++ = (type == 't')? DT_NVT_DATA: DT_3270_DATA;
+	*cp++ = 0;
+	*cp++ = 0;
+	*cp++ = (h->seq >> 8) & 0xff;
+	*cp++ = h->seq & 0xff;
+	h->seq++;
+    }
+
+    switch (type) {
+    case 'e':
+	/* A formatted screen with a title, some lines and an input field. */
+	*cp++ = CMD_EW;
+	*cp++ = WCC_RESTORE | WCC_RESET_MDT;
+	*cp++ = ORDER_SBA;
+	cp = put_addr(cp, 0);
+	*cp++ = ORDER_SF;
+	*cp++ = 0xf8;	/* protected, intensified */
+	sprintf(text, "LOADHOST SCREEN %d", h->sent);
+	cp = put_text(cp, text);
+	for (row = 2; row < rows - 2; row++) {
+	    *cp++ = ORDER_SBA;
+	    cp = put_addr(cp, row * cols);
+	    *cp++ = ORDER_SF;
+	    *cp++ = 0x60;	/* protected */
+	    sprintf(text, "Line %2d of record %d: the quick brown fox jumps "
+		    "over the lazy dog", row, h->sent);
+	    cp = put_text(cp, text);
+	}
+	*cp++ = ORDER_SBA;
+	cp = put_addr(cp, (rows - 1) * cols);
+	*cp++ = ORDER_SF;
+	*cp++ = 0x60;
+	cp = put_text(cp, "Command ===>");
+	*cp++ = ORDER_SF;
+	*cp++ = 0x40;	/* unprotected */
+	*cp++ = ORDER_IC;
+	*cp++ = ORDER_SBA;
+	cp = put_addr(cp, rows * cols - 1);
+	*cp++ = ORDER_SF;
+	*cp++ = 0x60;
+	break;
+    case 'w':
+	/* Update one line with a colored field. */
+	row = 2 + (h->sent % (rows - 4));
+	*cp++ = CMD_W;
+	*cp++ = wait_aid? WCC_RESTORE: 0;
+	*cp++ = ORDER_SBA;
+	cp = put_addr(cp, row * cols + 1);
+	*cp++ = ORDER_SA;
+	*cp++ = 0x42;	/* foreground color */
+	*cp++ = 0xf0 + (h->sent % 8);
+	sprintf(text, "Updated by record %d", h->sent);
+	cp = put_text(cp, text);
+	*cp++ = ORDER_SA;
+	*cp++ = 0x00;	/* reset */
+	*cp++ = 0x00;
+	break;
+    case 'q':
+	/* Read Partition Query, which the emulator answers by itself. */
+	*cp++ = CMD_WSF;
+	*cp++ = 0x00;
+	*cp++ = 0x05;
+	*cp++ = 0x01;	/* Read Partition */
+	*cp++ = 0xff;
+	*cp++ = 0x02;	/* Query */
+	break;
+    case 't':
+	sprintf(text, "loadhost NVT line %d\r\n", h->sent);
+	memcpy(cp, text, strlen(text));
+	cp += strlen(text);
+	break;
+    default:
+	fprintf(stderr, "Unknown record type '%c'\n", type);
+	exit(1);
+    }
+
+    queue(h, buf, cp - buf, 1);
+    eor[0] = IAC;
+    eor[1] = EOR;
+    queue(h, eor, 2, 0);
+    st_records++;
+    st_bytes += cp - buf;
+    h->sent++;
+    if (type == 'q' || (wait_aid && (type == 'e' || type == 'w'))) {
+	h->waiting = 1;
+	h->sent_at = now();
+    }
+}
+
+/* Switch a host to TN3270 mode, after it refuses TN3270E. */
+static void
+start_tn3270(host_t *h)
+{
+    queue_cmd(h, DO, TELOPT_EOR);
+    queue_cmd(h, WILL, TELOPT_EOR);
+    queue_cmd(h, DO, TELOPT_BINARY);
+    queue_cmd(h, WILL, TELOPT_BINARY);
+    h->ready = 1;
+}
+
+/* Process a TELNET subnegotiation. */
+static void
+process_sb(host_t *h)
+{
+    unsigned char buf[64];
+    size_t i;
+
+    if (h->ilen >= 2 && h->ibuf[0] == TELOPT_TTYPE && h->ibuf[1] == 0) {
+	/* TERMINAL-TYPE IS: finish TN3270 negotiation. */
+	start_tn3270(h);
+	return;
+    }
+    if (h->ilen < 3 || h->ibuf[0] != TELOPT_TN3270E ||
+	    h->ibuf[2] != TN3270E_REQUEST) {
+	return;
+    }
+    switch (h->ibuf[1]) {
+    case TN3270E_DEVICE_TYPE:
+	/* Accept the device type and assign an LU name. */
+	buf[0] = TN3270E_DEVICE_TYPE;
+	buf[1] = TN3270E_IS;
+	for (i = 3; i < h->ilen && i - 1 < 40 &&
+		h->ibuf[i] != TN3270E_CONNECT &&
+		h->ibuf[i] != TN3270E_ASSOCIATE; i++) {
+	    buf[i - 1] = h->ibuf[i];
+	}
+	i--;
+	buf[i++] = TN3270E_CONNECT;
+	sprintf((char *)buf + i, "LOAD%04d", (int)(h - hosts) % 10000);
+	queue_sb(h, buf, i + 8);
+	break;
+    case TN3270E_FUNCTIONS:
+	/* Agree to DATA-STREAM-CTL only. */
+	buf[0] = TN3270E_FUNCTIONS;
+	buf[1] = TN3270E_IS;
+	i = 2;
+	if (memchr(h->ibuf + 3, TN3270E_FUNC_DATA_STREAM_CTL,
+		    h->ilen - 3) != NULL) {
+	    buf[i++] = TN3270E_FUNC_DATA_STREAM_CTL;
+	}
+	queue_sb(h, buf, i);
+	h->tn3270e = 1;
+	h->ready = 1;
+	break;
+    }
+}
+
+/* Process a complete record from a host. */
+static void
+process_record(host_t *h)
+{
+    unsigned char *data = h->ibuf;
+    size_t len = h->ilen;
+
+    if (h->tn3270e) {
+	if (len < EH_SIZE || data[0] != DT_3270_DATA) {
+	    return;
+	}
+	data += EH_SIZE;
+	len -= EH_SIZE;
+    }
+    if (len == 0 || !h->waiting) {
+	return;
+    }
+
+    /* Any AID completes a round trip. */
+    h->waiting = 0;
+    {
+	double rtt = now() - h->sent_at;
+
+	st_rtts++;
+	st_rtt_sum += rtt;
+	if (st_rtt_min < 0.0 || rtt < st_rtt_min) {
+	    st_rtt_min = rtt;
+	}
+	if (rtt > st_rtt_max) {
+	    st_rtt_max = rtt;
+	}
+    }
+}
+
+/* Process input from a host. */
+static void
+process_input(host_t *h, const unsigned char *buf, int nr)
+{
+    int i;
+
+    for (i = 0; i < nr; i++) {
+	unsigned char c = buf[i];
+
+	switch (h->tstate) {
+	case TS_DATA:
+	    if (c == IAC) {
+		h->tstate = TS_IAC;
+	    } else if (h->ilen < BSIZE) {
+		h->ibuf[h->ilen++] = c;
+	    }
+	    break;
+	case TS_IAC:
+	    h->tstate = TS_DATA;
+	    switch (c) {
+	    case IAC:
+		if (h->ilen < BSIZE) {
+		    h->ibuf[h->ilen++] = c;
+		}
+		break;
+	    case EOR:
+		process_record(h);
+		h->ilen = 0;
+		break;
+	    case WILL:
+		h->tstate = TS_WILL;
+		break;
+	    case WONT:
+		h->tstate = TS_WONT;
+		break;
+	    case DO:
+		h->tstate = TS_DO;
+		break;
+	    case DONT:
+		h->tstate = TS_DONT;
+		break;
+	    case SB:
+		h->tstate = TS_SB;
+		h->ilen = 0;
+		break;
+	    }
+	    break;
+	case TS_WILL:
+	    if (c == TELOPT_TN3270E) {
+		unsigned char sb[2];
+
+		sb[0] = TN3270E_SEND;
+		sb[1] = TN3270E_DEVICE_TYPE;
+		queue_sb(h, sb, 2);
+	    } else if (c == TELOPT_TTYPE) {
+		unsigned char sb[6];
+
+		sb[0] = IAC;
+		sb[1] = SB;
+		sb[2] = TELOPT_TTYPE;
+		sb[3] = 1;	/* SEND */
+		sb[4] = IAC;
+		sb[5] = SE;
+		queue(h, sb, 6, 0);
+	    }
+	    h->tstate = TS_DATA;
+	    break;
+	case TS_WONT:
+	    if (c == TELOPT_TN3270E && !h->ready) {
+		queue_cmd(h, DO, TELOPT_TTYPE);
+	    }
+	    h->tstate = TS_DATA;
+	    break;
+	case TS_DO:
+	case TS_DONT:
+	    h->tstate = TS_DATA;
+	    break;
+	case TS_SB:
+	    if (c == IAC) {
+		h->tstate = TS_SB_IAC;
+	    } else if (h->ilen < BSIZE) {
+		h->ibuf[h->ilen++] = c;
+	    }
+	    break;
+	case TS_SB_IAC:
+	    if (c == SE) {
+		process_sb(h);
+		h->ilen = 0;
+		h->tstate = TS_DATA;
+	    } else {
+		if (h->ilen < BSIZE) {
+		    h->ibuf[h->ilen++] = c;
+		}
+		h->tstate = TS_SB;
+	    }
+	    break;
+	}
+    }
+}
+
+/* Close a host connection. */
+static void
+close_host(host_t *h)
+{
+    close(h->s);
+    h->s = -1;
+    free(h->obuf);
+    h->obuf = NULL;
+    h->olen = h->osize = 0;
+}
+
+/* Report statistics. */
+static void
+report(void)
+{
+    double secs = now() - st_start;
+
+    if (secs <= 0.0) {
+	secs = 0.000001;
+    }
+    if (json) {
+	printf("{\"tool\":\"loadhost\",\"mix\":\"%s\",\"connections\":%lu,"
+		"\"records\":%lu,\"bytes\":%lu,\"seconds\":%.6f,"
+		"\"records_per_sec\":%.1f,\"bytes_per_sec\":%.1f,"
+		"\"round_trips\":%lu", mix, st_connections, st_records,
+		st_bytes, secs, st_records / secs, st_bytes / secs, st_rtts);
+	if (st_rtts) {
+	    printf(",\"rtt_min_ms\":%.3f,\"rtt_avg_ms\":%.3f,"
+		    "\"rtt_max_ms\":%.3f", st_rtt_min * 1000.0,
+		    st_rtt_sum / st_rtts * 1000.0, st_rtt_max * 1000.0);
+	}
+	printf("}\n");
+	fflush(stdout);
+	return;
+    }
+    printf("%lu connections, %lu records, %lu bytes in %.3f s "
+	    "(%.1f records/s, %.1f bytes/s)\n", st_connections, st_records,
+	    st_bytes, secs, st_records / secs, st_bytes / secs);
+    if (st_rtts) {
+	printf("%lu round trips: min %.3f ms, avg %.3f ms, max %.3f ms\n",
+		st_rtts, st_rtt_min * 1000.0, st_rtt_sum / st_rtts * 1000.0,
+		st_rtt_max * 1000.0);
+    }
+    fflush(stdout);
+}
+
+/* Signal handler for SIGINT and SIGTERM. */
+static void
+stop(int sig)
+{
+    done = 1;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int c;
+    int s;
+    int one = 1;
+    struct sockaddr_in sin;
+    struct pollfd *pfds = NULL;
+    int active = 0;
+
+    if ((me = strrchr(argv[0], '/')) != NULL) {
+	me++;
+    } else {
+	me = argv[0];
+    }
+
+    while ((c = getopt(argc, argv, "p:n:m:g:aj")) != -1) {
+	switch (c) {
+	case 'p':
+	    port = atoi(optarg);
+	    break;
+	case 'n':
+	    records = atoi(optarg);
+	    if (records < 1) {
+		usage();
+	    }
+	    break;
+	case 'm':
+	    mix = optarg;
+	    if (!*mix || mix[strspn(mix, "ewqt")]) {
+		usage();
+	    }
+	    break;
+	case 'g':
+	    if (sscanf(optarg, "%dx%d", &cols, &rows) != 2 ||
+		    rows < ROWS || rows > MAX_ROWS ||
+		    cols < COLS || cols > MAX_COLS) {
+		usage();
+	    }
+	    break;
+	case 'a':
+	    wait_aid = 1;
+	    break;
+	case 'j':
+	    json = 1;
+	    break;
+	default:
+	    usage();
+	}
+    }
+    if (optind != argc) {
+	usage();
+    }
+
+    /* Listen on a socket. */
+    s = socket(AF_INET, SOCK_STREAM, 0);
+    if (s < 0) {
+	perror("socket");
+	exit(1);
+    }
+    if (setsockopt(s, SOL_SOCKET, SO_REUSEADDR, (char *)&one,
+		sizeof(one)) < 0) {
+	perror("setsockopt");
+	exit(1);
+    }
+    memset(&sin, '\0', sizeof(sin));
+    sin.sin_family = AF_INET;
+    sin.sin_port = htons(port);
+    if (bind(s, (struct sockaddr *)&sin, sizeof(sin)) < 0) {
+	perror("bind");
+	exit(1);
+    }
+    if (listen(s, 1024) < 0) {
+	perror("listen");
+	exit(1);
+    }
+    fcntl(s, F_SETFL, fcntl(s, F_GETFL) | O_NONBLOCK);
+    signal(SIGPIPE, SIG_IGN);
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+
+    fprintf(json? stderr: stdout, "Listening on port %d.\n", port);
+    fflush(json? stderr: stdout);
+
+    while (!done) {
+	int i;
+	int np = 0;
+
+	/* Build the poll list: the listening socket, then the hosts. */
+	pfds = realloc(pfds, (n_hosts + 1) * sizeof(struct pollfd));
+	if (pfds == NULL) {
+	    fprintf(stderr, "Out of memory\n");
+	    exit(1);
+	}
+	pfds[np].fd = s;
+	pfds[np++].events = POLLIN;
+	for (i = 0; i < n_hosts; i++) {
+	    host_t *h = &hosts[i];
+
+	    /* Generate records while there is room. */
+	    while (h->s >= 0 && h->ready && !h->waiting &&
+		    h->sent < records && h->olen < OBUF_MAX) {
+		send_record(h);
+	    }
+	    pfds[np].fd = h->s;
+	    pfds[np].events = (h->s >= 0)? POLLIN: 0;
+	    if (h->olen) {
+		pfds[np].events |= POLLOUT;
+	    }
+	    np++;
+	}
+
+	if (poll(pfds, np, -1) < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    perror("poll");
+	    exit(1);
+	}
+
+	/* Accept new connections. */
+	if (pfds[0].revents & POLLIN) {
+	    int s2;
+
+	    while ((s2 = accept(s, NULL, NULL)) >= 0) {
+		host_t *h = NULL;
+
+		fcntl(s2, F_SETFL, fcntl(s2, F_GETFL) | O_NONBLOCK);
+		for (i = 0; i < n_hosts; i++) {
+		    if (hosts[i].s < 0) {
+			h = &hosts[i];
+			break;
+		    }
+		}
+		if (h == NULL) {
+		    hosts = realloc(hosts, (n_hosts + 1) * sizeof(host_t));
+		    if (hosts == NULL) {
+			fprintf(stderr, "Out of memory\n");
+			exit(1);
+		    }
+		    h = &hosts[n_hosts++];
+		}
+		memset(h, '\0', sizeof(host_t));
+		h->s = s2;
+		h->tstate = TS_DATA;
+		queue_cmd(h, DO, TELOPT_TN3270E);
+		if (!active++ && !st_connections) {
+		    st_start = now();
+		}
+		st_connections++;
+	    }
+	}
+
+	/* Service the hosts. */
+	for (i = 0; i < n_hosts; i++) {
+	    host_t *h = &hosts[i];
+	    struct pollfd *p = &pfds[i + 1];
+
+	    if (h->s < 0 || p->fd != h->s) {
+		continue;
+	    }
+	    if (p->revents & (POLLIN | POLLHUP | POLLERR)) {
+		unsigned char buf[BSIZE];
+		int nr = read(h->s, buf, sizeof(buf));
+
+		if (nr <= 0 && (nr == 0 || errno != EAGAIN)) {
+		    close_host(h);
+		    active--;
+		    continue;
+		}
+		if (nr > 0) {
+		    process_input(h, buf, nr);
+		}
+	    }
+	    if ((p->revents & POLLOUT) && h->olen) {
+		int nw = write(h->s, h->obuf, h->olen);
+
+		if (nw < 0 && errno != EAGAIN) {
+		    close_host(h);
+		    active--;
+		    continue;
+		}
+		if (nw > 0) {
+		    memmove(h->obuf, h->obuf + nw, h->olen - nw);
+		    h->olen -= nw;
+		}
+	    }
+
+	    /* Disconnect when everything has been sent and answered. */
+	    if (h->ready && h->sent >= records && !h->waiting && !h->olen) {
+		close_host(h);
+		active--;
+	    }
+	}
+
+	if (st_connections && !active) {
+	    report();
+	    st_connections = st_records = st_bytes = st_rtts = 0;
+	    st_rtt_sum = st_rtt_max = 0.0;
+	    st_rtt_min = -1.0;
+	}
+    }
+
+    if (st_connections) {
+	report();
+    }
+    return 0;
+}
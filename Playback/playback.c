@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1994-2009, 2014, 2019 Paul Mattes.
+ * Copyright (c) 1994-2009, 2014, 2019, 2026 Paul Mattes.
  * All rights reserved.
  * 
  * Redistribution and use in source and binary forms, with or without
@@ -32,6 +32,9 @@
  */
 
 #include <stdio.h>
+#include <ctype.h>
+#include <errno.h>
+#include <time.h>
 #include <string.h>
 #include <signal.h>
 #include <memory.h>
@@ -40,6 +43,7 @@
 #include <assert.h>
 #include <fcntl.h>
 #include <sys/types.h>
+#include <sys/stat.h>
 #include <sys/time.h>
 #include <sys/socket.h>
 #include <netinet/in.h>
@@ -71,10 +75,78 @@ typedef enum {
 static int step(FILE *f, int s, step_t type);
 static int process_command(FILE *f, int s);
 
+/* Automated replay modes. */
+static enum {
+    M_INTERACTIVE,	/* keyboard-driven */
+    M_REALTIME,		/* honor the trace timestamps */
+    M_FLOOD		/* as fast as the emulator will take it */
+} mode = M_INTERACTIVE;
+static int nconn = 1;
+static int json = 0;	/* report results as JSON */
+static FILE *info;	/* where progress messages go */
+
+/* A block of host data from the trace file, as one read by the emulator. */
+typedef struct {
+    double when;	/* trace time in seconds, or -1 if unknown */
+    size_t len;		/* length of data */
+    unsigned char *data;
+} block_t;
+static block_t *blocks = NULL;
+static int n_blocks = 0;
+static double base_when = -1.0;
+
+/* An emulator connection in an automated mode. */
+typedef struct {
+    int s;		/* socket, or -1 */
+    int ix;		/* next block to send */
+    size_t off;		/* amount of that block already sent */
+    unsigned long bytes; /* total bytes sent */
+    double start;	/* when replay started */
+    double end;		/* when the last block was sent */
+    int done;		/* all blocks sent */
+} conn_t;
+
+#define LINGER_SECS	2.0	/* how long to wait for the emulator to close */
+
+/*
+ * The sidecar index, kept in <trace>.idx. It maps each host record (each
+ * '< 0x0' line) to its file offset and timestamp, so playback can seek
+ * directly to a record or a time instead of stepping through the file.
+ */
+#define INDEX_SUFFIX	".idx"
+#define INDEX_MAGIC	"playback index 1"
+typedef struct {
+    char magic[24];	/* INDEX_MAGIC */
+    off_t size;		/* size of the trace file */
+    time_t mtime;	/* modification time of the trace file */
+    long count;		/* number of entries */
+} index_header_t;
+typedef struct {
+    off_t offset;	/* file offset of the record */
+    double when;	/* trace time in seconds, or -1 if unknown */
+} index_entry_t;
+static index_entry_t *idx = NULL;
+static long n_idx = 0;
+static off_t start_offset = 0;	/* where to start playing */
+
+static void load_blocks(FILE *f);
+static void auto_play(int s);
+static void load_index(FILE *f, const char *name);
+static long find_record(const char *spec);
+static void seek_record(FILE *f, long n);
+
 void
 usage(void)
 {
-    fprintf(stderr, "usage: %s [-p port] file\n", me);
+    fprintf(stderr,
+	    "usage: %s [-p port] [-r|-f] [-n connections] [-j] [-s start] "
+	    "file\n", me);
+    fprintf(stderr, "  -r  replay in real time, following the timestamps\n");
+    fprintf(stderr, "  -f  replay as fast as possible\n");
+    fprintf(stderr, "  -n  replay to this many concurrent connections\n");
+    fprintf(stderr, "  -j  with -r or -f, write results as JSON lines\n");
+    fprintf(stderr, "  -s  start at a record number or [hh:]mm:ss into "
+	    "the trace\n");
     exit(1);
 }
 
@@ -101,6 +173,7 @@ main(int argc, char *argv[])
     int one = 1;
     socklen_t len;
     int flags;
+    char *start = NULL;
 
     /* Parse command-line arguments */
     if ((me = strrchr(argv[0], '/')) != NULL) {
@@ -109,15 +182,38 @@ main(int argc, char *argv[])
 	    me = argv[0];
     }
 
-    while ((c = getopt(argc, argv, "p:")) != -1) {
+    info = stdout;
+    while ((c = getopt(argc, argv, "p:rfn:js:")) != -1) {
 	switch (c) {
 	case 'p':
 	    port = atoi(optarg);
 	    break;
+	case 'r':
+	    mode = M_REALTIME;
+	    break;
+	case 'f':
+	    mode = M_FLOOD;
+	    break;
+	case 'j':
+	    json = 1;
+	    info = stderr;
+	    break;
+	case 's':
+	    start = optarg;
+	    break;
+	case 'n':
+	    nconn = atoi(optarg);
+	    if (nconn < 1 || nconn >= FD_SETSIZE - 4) {
+		usage();
+	    }
+	    break;
 	default:
 	    usage();
 	}
     }
+    if ((nconn > 1 || json) && mode == M_INTERACTIVE) {
+	usage();
+    }
 
     if (argc - optind != 1) {
 	usage();
@@ -130,6 +226,19 @@ main(int argc, char *argv[])
 	exit(1);
     }
 
+    /* Read or build the index, and find the starting point. */
+    load_index(f, argv[optind]);
+    if (start != NULL) {
+	long n = find_record(start);
+
+	if (n < 0) {
+	    fprintf(stderr, "No record matches '%s'.\n", start);
+	    exit(1);
+	}
+	start_offset = idx[n].offset;
+	fprintf(info, "Starting at record %ld.\n", n + 1);
+    }
+
     /* Listen on a socket. */
     s = socket(proto, SOCK_STREAM, 0);
     if (s < 0) {
@@ -152,7 +261,7 @@ main(int argc, char *argv[])
 	perror("bind");
 	exit(1);
     }
-    if (listen(s, 1) < 0) {
+    if (listen(s, nconn) < 0) {
 	perror("listen");
 	exit(1);
     }
@@ -167,6 +276,14 @@ main(int argc, char *argv[])
     }
     signal(SIGPIPE, SIG_IGN);
 
+    /* Run an automated mode. */
+    if (mode != M_INTERACTIVE) {
+	load_blocks(f);
+	for (;;) {
+	    auto_play(s);
+	}
+    }
+
     /* Accept connections and process them. */
     for (;;) {
 	int s2;
@@ -217,7 +334,7 @@ main(int argc, char *argv[])
 		ntohs(addr.sin.sin_port)
 #endif /*]*/
 	);
-	rewind(f);
+	fseeko(f, start_offset, SEEK_SET);
 	pstate = BASE;
 	fdisp = 0;
 	process(f, s2);
@@ -287,6 +404,22 @@ process_command(FILE *f, int s)
 	    usleep(1000000 / 4);
 	}
 	return -1;
+    } else if (!strncmp(t, "g", 1)) {	/* go to record or time */
+	long n;
+
+	if (f == NULL) {
+	    printf("Not connected.\n");
+	    return 0;
+	}
+	t++;
+	while (*t == ' ') {
+	    t++;
+	}
+	if ((n = find_record(t)) < 0) {
+	    printf("No such record.\n");
+	    return 0;
+	}
+	seek_record(f, n);
     } else if (!strncmp(t, "q", 1)) {	/* quit */
 	exit(0);
     } else if (!strncmp(t, "d", 1)) {	/* disconnect */
@@ -301,6 +434,8 @@ s: step line\n\
 r: step record\n\
 t: to mark\n\
 e: play to EOF\n\
+g n: go to record n\n\
+g [hh:]mm:ss: go to the first record at that time into the trace\n\
 q: quit\n\
 d: disconnect\n\
 ?: help\n");
@@ -572,3 +707,488 @@ done:
 
     return 0;
 }
+
+/* Returns the current time in seconds. */
+static double
+now(void)
+{
+    struct timeval tv;
+
+    gettimeofday(&tv, NULL);
+    return (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+/*
+ * Parse a timestamp line in a trace file.
+ *
+ * Returns 1 and sets *when if the line has one, 0 otherwise.
+ */
+static int
+parse_stamp(const char *line, double *when)
+{
+    int yr, mo, dy, hr, mn, sc, ms;
+    struct tm tm;
+
+    if (sscanf(line, "%4d%2d%2d.%2d%2d%2d.%3d ", &yr, &mo, &dy, &hr, &mn,
+		&sc, &ms) != 7) {
+	return 0;
+    }
+    memset(&tm, '\0', sizeof(tm));
+    tm.tm_year = yr - 1900;
+    tm.tm_mon = mo - 1;
+    tm.tm_mday = dy;
+    tm.tm_hour = hr;
+    tm.tm_min = mn;
+    tm.tm_sec = sc;
+    tm.tm_isdst = -1;
+    *when = (double)mktime(&tm) + ms / 1000.0;
+    return 1;
+}
+
+/*
+ * Scan the trace file and build the index in memory.
+ */
+static void
+build_index(FILE *f)
+{
+    char line[BSIZE];
+    double when = -1.0;
+    long alloc = 0;
+    off_t offset;
+
+    rewind(f);
+    for (offset = 0; fgets(line, sizeof(line), f) != NULL;
+	    offset = ftello(f)) {
+	if (line[0] != '<') {
+	    parse_stamp(line, &when);
+	    continue;
+	}
+	if (strncmp(line, "< 0x0 ", 6)) {
+	    continue;
+	}
+	if (n_idx >= alloc) {
+	    alloc = alloc? alloc * 2: 1024;
+	    idx = realloc(idx, alloc * sizeof(index_entry_t));
+	    if (idx == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		exit(1);
+	    }
+	}
+	idx[n_idx].offset = offset;
+	idx[n_idx].when = when;
+	n_idx++;
+    }
+    clearerr(f);
+    rewind(f);
+}
+
+/*
+ * Read the index for a trace file, building it (and saving it, if possible)
+ * if it is missing or stale.
+ */
+static void
+load_index(FILE *f, const char *name)
+{
+    struct stat st;
+    char *iname;
+    FILE *xf;
+    index_header_t h;
+
+    if (fstat(fileno(f), &st) < 0) {
+	perror(name);
+	exit(1);
+    }
+    iname = malloc(strlen(name) + strlen(INDEX_SUFFIX) + 1);
+    if (iname == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	exit(1);
+    }
+    sprintf(iname, "%s%s", name, INDEX_SUFFIX);
+
+    /* Try the existing index. */
+    xf = fopen(iname, "rb");
+    if (xf != NULL) {
+	if (fread(&h, sizeof(h), 1, xf) == 1 &&
+		!strncmp(h.magic, INDEX_MAGIC, sizeof(h.magic)) &&
+		h.size == st.st_size &&
+		h.mtime == st.st_mtime &&
+		h.count >= 0) {
+	    idx = malloc((h.count? h.count: 1) * sizeof(index_entry_t));
+	    if (idx == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		exit(1);
+	    }
+	    if (fread(idx, sizeof(index_entry_t), h.count, xf) ==
+		    (size_t)h.count) {
+		n_idx = h.count;
+		fclose(xf);
+		free(iname);
+		return;
+	    }
+	    free(idx);
+	    idx = NULL;
+	}
+	fclose(xf);
+    }
+
+    /* Build a new one and save it. */
+    fprintf(info, "Indexing %s.\n", name);
+    fflush(info);
+    build_index(f);
+    memset(&h, '\0', sizeof(h));
+    strncpy(h.magic, INDEX_MAGIC, sizeof(h.magic));
+    h.size = st.st_size;
+    h.mtime = st.st_mtime;
+    h.count = n_idx;
+    xf = fopen(iname, "wb");
+    if (xf != NULL) {
+	if (fwrite(&h, sizeof(h), 1, xf) != 1 ||
+		fwrite(idx, sizeof(index_entry_t), n_idx, xf) !=
+		    (size_t)n_idx ||
+		fclose(xf) != 0) {
+	    fprintf(info, "Cannot write %s.\n", iname);
+	    unlink(iname);
+	}
+    }
+    free(iname);
+}
+
+/*
+ * Find a record from a specification: a record number, or a time
+ * ([hh:]mm:ss) since the start of the trace.
+ *
+ * Returns the index of the record, or -1 if there is no match.
+ */
+static long
+find_record(const char *spec)
+{
+    unsigned a, b, c;
+    char extra;
+    double secs, base = -1.0;
+    long lo, hi, i;
+
+    if (sscanf(spec, "%u:%u:%u%c", &a, &b, &c, &extra) == 3) {
+	secs = a * 3600.0 + b * 60.0 + c;
+    } else if (sscanf(spec, "%u:%u%c", &a, &b, &extra) == 2) {
+	secs = a * 60.0 + b;
+    } else {
+	char *end;
+	long n = strtol(spec, &end, 10);
+
+	if (end == spec || *end != '\0' || n < 1 || n > n_idx) {
+	    return -1;
+	}
+	return n - 1;
+    }
+
+    /* Find the first timestamped record. */
+    for (i = 0; i < n_idx; i++) {
+	if (idx[i].when >= 0.0) {
+	    base = idx[i].when;
+	    break;
+	}
+    }
+    if (base < 0.0) {
+	return -1;
+    }
+
+    /* Timestamps only go forward, so search for the first one that fits. */
+    lo = i;
+    hi = n_idx;
+    while (lo < hi) {
+	long mid = lo + (hi - lo) / 2;
+
+	if (idx[mid].when - base < secs) {
+	    lo = mid + 1;
+	} else {
+	    hi = mid;
+	}
+    }
+    return (lo < n_idx)? lo: -1;
+}
+
+/* Move an interactive session to a record. */
+static void
+seek_record(FILE *f, long n)
+{
+    if (fseeko(f, idx[n].offset, SEEK_SET) < 0) {
+	perror("fseeko");
+	return;
+    }
+    pstate = BASE;
+    tstate = T_NONE;
+    fdisp = 0;
+    printf("At record %ld of %ld.\n", n + 1, n_idx);
+}
+
+/*
+ * Read the host data from the trace file for the automated modes.
+ *
+ * Each '< 0x0' line starts a new block; it is stamped with the time of the
+ * most recent timestamped line before it.
+ */
+static void
+load_blocks(FILE *f)
+{
+    char line[BSIZE];
+    double when = -1.0;
+    unsigned long total = 0;
+
+    fseeko(f, start_offset, SEEK_SET);
+    if (start_offset != 0) {
+	/* Pick up the timestamp of the first record from the index. */
+	long i;
+
+	for (i = 0; i < n_idx && idx[i].offset != start_offset; i++) {
+	}
+	if (i < n_idx) {
+	    when = idx[i].when;
+	}
+    }
+    while (fgets(line, sizeof(line), f) != NULL) {
+	unsigned offset;
+	char *cp;
+	block_t *b;
+
+	if (parse_stamp(line, &when)) {
+	    continue;
+	}
+	if (strncmp(line, "< 0x", 4) || sscanf(line + 4, "%x", &offset) != 1) {
+	    continue;
+	}
+	cp = line + 4;
+	while (isxdigit((unsigned char)*cp)) {
+	    cp++;
+	}
+	while (*cp == ' ' || *cp == '\t') {
+	    cp++;
+	}
+
+	if (offset == 0 || n_blocks == 0) {
+	    blocks = realloc(blocks, (n_blocks + 1) * sizeof(block_t));
+	    if (blocks == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		exit(1);
+	    }
+	    if (base_when < 0.0) {
+		base_when = when;
+	    }
+	    blocks[n_blocks].when = when;
+	    blocks[n_blocks].len = 0;
+	    blocks[n_blocks].data = NULL;
+	    n_blocks++;
+	}
+	b = &blocks[n_blocks - 1];
+	while (isxdigit((unsigned char)cp[0]) && isxdigit((unsigned char)cp[1])) {
+	    unsigned byte;
+
+	    sscanf(cp, "%2x", &byte);
+	    b->data = realloc(b->data, b->len + 1);
+	    if (b->data == NULL) {
+		fprintf(stderr, "Out of memory\n");
+		exit(1);
+	    }
+	    b->data[b->len++] = (unsigned char)byte;
+	    total++;
+	    cp += 2;
+	}
+    }
+
+    if (n_blocks == 0) {
+	fprintf(stderr, "No host data in trace file.\n");
+	exit(1);
+    }
+    fprintf(info, "Loaded %d records, %lu bytes.\n", n_blocks, total);
+}
+
+/* Report the throughput of a finished replay. */
+static void
+report(const char *what, int records, unsigned long bytes, double secs)
+{
+    if (secs <= 0.0) {
+	secs = 0.000001;
+    }
+    if (json) {
+	printf("{\"tool\":\"playback\",\"mode\":\"%s\",\"what\":\"%s\","
+		"\"records\":%d,\"bytes\":%lu,\"seconds\":%.6f,"
+		"\"records_per_sec\":%.1f,\"bytes_per_sec\":%.1f}\n",
+		(mode == M_FLOOD)? "flood": "realtime", what, records, bytes,
+		secs, records / secs, bytes / secs);
+    } else {
+	printf("%s: %d records, %lu bytes in %.3f s (%.1f records/s, "
+		"%.1f bytes/s)\n", what, records, bytes, secs, records / secs,
+		bytes / secs);
+    }
+    fflush(stdout);
+}
+
+/*
+ * Replay the trace file to a set of emulator connections, without keyboard
+ * control.
+ */
+static void
+auto_play(int s)
+{
+    conn_t *conns;
+    int i;
+    int active = 0;
+    int records = 0;
+    unsigned long bytes = 0;
+    double first = 0.0, last = 0.0;
+    char buf[BSIZE];
+
+    conns = calloc(nconn, sizeof(conn_t));
+    if (conns == NULL) {
+	fprintf(stderr, "Out of memory\n");
+	exit(1);
+    }
+
+    /* Wait for all of the connections. */
+    fprintf(info, "Waiting for %d connection%s on port %u.\n", nconn,
+	    (nconn == 1)? "": "s", port);
+    fflush(info);
+    while (active < nconn) {
+	fd_set rfds;
+	int s2;
+
+	FD_ZERO(&rfds);
+	FD_SET(s, &rfds);
+	if (select(s + 1, &rfds, NULL, NULL, NULL) < 0) {
+	    perror("select");
+	    exit(1);
+	}
+	s2 = accept(s, NULL, NULL);
+	if (s2 < 0) {
+	    continue;
+	}
+	if (fcntl(s2, F_SETFL, fcntl(s2, F_GETFL) | O_NONBLOCK) < 0) {
+	    perror("fcntl");
+	    exit(1);
+	}
+	conns[active++].s = s2;
+    }
+    first = now();
+    for (i = 0; i < nconn; i++) {
+	conns[i].start = first;
+    }
+
+    /* Send the data and read the responses. */
+    while (active > 0) {
+	fd_set rfds, wfds;
+	int maxfd = -1;
+	double t = now();
+	double wait = -1.0;
+	struct timeval tv;
+
+	FD_ZERO(&rfds);
+	FD_ZERO(&wfds);
+	for (i = 0; i < nconn; i++) {
+	    conn_t *c = &conns[i];
+	    double due;
+
+	    if (c->s < 0) {
+		continue;
+	    }
+	    FD_SET(c->s, &rfds);
+	    if (c->s > maxfd) {
+		maxfd = c->s;
+	    }
+	    if (c->done) {
+		due = c->end + LINGER_SECS;
+	    } else if (mode == M_FLOOD || c->off ||
+		    blocks[c->ix].when < 0.0) {
+		FD_SET(c->s, &wfds);
+		continue;
+	    } else {
+		due = c->start + (blocks[c->ix].when - base_when);
+		if (due <= t) {
+		    FD_SET(c->s, &wfds);
+		    continue;
+		}
+	    }
+	    if (wait < 0.0 || due - t < wait) {
+		wait = due - t;
+	    }
+	}
+	if (wait >= 0.0) {
+	    tv.tv_sec = (long)wait;
+	    tv.tv_usec = (long)((wait - (long)wait) * 1000000.0);
+	}
+	if (select(maxfd + 1, &rfds, &wfds, NULL,
+		    (wait >= 0.0)? &tv: NULL) < 0) {
+	    if (errno == EINTR) {
+		continue;
+	    }
+	    perror("select");
+	    exit(1);
+	}
+	t = now();
+
+	for (i = 0; i < nconn; i++) {
+	    conn_t *c = &conns[i];
+	    int close_it = 0;
+
+	    if (c->s < 0) {
+		continue;
+	    }
+	    if (FD_ISSET(c->s, &rfds)) {
+		int nr = read(c->s, buf, BSIZE);
+
+		if (nr <= 0 && (nr == 0 || errno != EAGAIN)) {
+		    if (!c->done) {
+			fprintf(info, "Emulator disconnected.\n");
+			c->end = t;
+		    }
+		    close_it = 1;
+		}
+	    }
+	    if (!close_it && FD_ISSET(c->s, &wfds)) {
+		block_t *b = &blocks[c->ix];
+		int nw = write(c->s, b->data + c->off, b->len - c->off);
+
+		if (nw < 0 && errno != EAGAIN) {
+		    perror("socket write");
+		    c->end = t;
+		    close_it = 1;
+		} else if (nw > 0) {
+		    c->off += nw;
+		    c->bytes += nw;
+		    if (c->off == b->len) {
+			c->off = 0;
+			if (++c->ix == n_blocks) {
+			    c->done = 1;
+			    c->end = t;
+			    shutdown(c->s, SHUT_WR);
+			}
+		    }
+		}
+	    }
+	    if (!close_it && c->done && t >= c->end + LINGER_SECS) {
+		close_it = 1;
+	    }
+	    if (close_it) {
+		close(c->s);
+		c->s = -1;
+		active--;
+	    }
+	}
+    }
+
+    /* Report. */
+    for (i = 0; i < nconn; i++) {
+	if (nconn > 1) {
+	    char what[32];
+
+	    sprintf(what, "Connection %d", i + 1);
+	    report(what, conns[i].ix, conns[i].bytes,
+		    conns[i].end - conns[i].start);
+	}
+	records += conns[i].ix;
+	bytes += conns[i].bytes;
+	if (conns[i].end > last) {
+	    last = conns[i].end;
+	}
+    }
+    report("Total", records, bytes, last - first);
+    free(conns);
+}
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the name of Paul Mattes nor his contributors may be used
+ *       to endorse or promote products derived from this software without
+ *       specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS
+ * OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+ * IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ * Binary trace file decoder for x3270
+ *
+ * Translates a trace written with the traceBinary resource set into the
+ * same text the emulator would have written without it. The record format
+ * is described in Common/trace.c.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define LINEDUMP_MAX	32
+
+#define MAGIC		"x3trc\001\r\n"
+#define MAGIC_LEN	8
+#define HDR_LEN		13	/* type, seconds, microseconds, length */
+#define TEXT_TS		'T'
+#define TEXT		't'
+
+char *me;
+static int wrote_ts = 0;
+
+void
+usage(void)
+{
+    fprintf(stderr, "usage: %s [file]\n", me);
+    exit(1);
+}
+
+/* Fetch a 32-bit big-endian value. */
+static unsigned long
+get32(const unsigned char *p)
+{
+    return ((unsigned long)p[0] << 24) |
+	   ((unsigned long)p[1] << 16) |
+	   ((unsigned long)p[2] << 8) |
+	    (unsigned long)p[3];
+}
+
+/* Write a timestamp, in the same form as the emulator. */
+static void
+put_ts(unsigned long sec, unsigned long usec)
+{
+    time_t t = (time_t)sec;
+    struct tm *tm = localtime(&t);
+
+    printf("%d%02d%02d.%02d%02d%02d.%03d ",
+	    tm->tm_year + 1900,
+	    tm->tm_mon + 1,
+	    tm->tm_mday,
+	    tm->tm_hour,
+	    tm->tm_min,
+	    tm->tm_sec,
+	    (int)(usec / 1000L));
+}
+
+/* Write a text record, inserting timestamps at the start of lines. */
+static void
+put_text(const unsigned char *buf, size_t len, int do_ts, unsigned long sec,
+	unsigned long usec)
+{
+    while (len > 0) {
+	const unsigned char *nl;
+	size_t n;
+
+	if (do_ts && !wrote_ts) {
+	    put_ts(sec, usec);
+	    wrote_ts = 1;
+	}
+	nl = memchr(buf, '\n', len);
+	n = (nl != NULL)? (size_t)(nl - buf + 1): len;
+	fwrite(buf, n, 1, stdout);
+	if (nl != NULL) {
+	    wrote_ts = 0;
+	}
+	buf += n;
+	len -= n;
+    }
+}
+
+/* Write a network data record as a hex dump. */
+static void
+put_netdata(char direction, const unsigned char *buf, size_t len)
+{
+    size_t offset;
+
+    for (offset = 0; offset < len; offset++) {
+	if (!(offset % LINEDUMP_MAX)) {
+	    printf("%s%c 0x%-3x ", (offset? "\n": ""), direction,
+		    (unsigned)offset);
+	}
+	printf("%02x", buf[offset]);
+    }
+    printf("\n");
+    wrote_ts = 0;
+}
+
+/* Grow the record buffer to hold at least 'need' bytes. */
+static unsigned char *
+grow(unsigned char *buf, size_t *bufsize, size_t need)
+{
+    size_t size = *bufsize? *bufsize: 1024;
+
+    while (size < need) {
+	size *= 2;
+    }
+    if ((buf = realloc(buf, size)) == NULL) {
+	fprintf(stderr, "%s: out of memory\n", me);
+	exit(1);
+    }
+    *bufsize = size;
+    return buf;
+}
+
+int
+main(int argc, char *argv[])
+{
+    FILE *f;
+    unsigned char hdr[HDR_LEN];
+    unsigned char *buf = NULL;
+    size_t bufsize = 0;
+
+    if ((me = strrchr(argv[0], '/')) != NULL) {
+	me++;
+    } else {
+	me = argv[0];
+    }
+    if (argc > 2 || (argc == 2 && argv[1][0] == '-' && argv[1][1])) {
+	usage();
+    }
+    if (argc == 2 && strcmp(argv[1], "-")) {
+	if ((f = fopen(argv[1], "rb")) == NULL) {
+	    perror(argv[1]);
+	    exit(1);
+	}
+    } else {
+	f = stdin;
+    }
+
+    if (fread(hdr, MAGIC_LEN, 1, f) != 1 || memcmp(hdr, MAGIC, MAGIC_LEN)) {
+	fprintf(stderr, "%s: not a binary trace file\n", me);
+	exit(1);
+    }
+
+    for (;;) {
+	unsigned long len;
+	size_t hlen;
+
+	if (fread(hdr, 1, 1, f) != 1) {
+	    break;
+	}
+
+	/* Appending to an existing file can repeat the magic number. */
+	if (hdr[0] == MAGIC[0]) {
+	    if (fread(hdr + 1, MAGIC_LEN - 1, 1, f) != 1 ||
+		    memcmp(hdr, MAGIC, MAGIC_LEN)) {
+		fprintf(stderr, "%s: bad magic number\n", me);
+		exit(1);
+	    }
+	    continue;
+	}
+
+	/* Read the rest of the header. */
+	hlen = (hdr[0] == TEXT)? 0: ((hdr[0] == TEXT_TS)? 8: HDR_LEN - 1);
+	if (hlen && fread(hdr + 1, hlen, 1, f) != 1) {
+	    fprintf(stderr, "%s: truncated record header\n", me);
+	    exit(1);
+	}
+
+	/* Read the data: NUL-terminated text, or counted network data. */
+	len = 0;
+	if (hdr[0] == TEXT || hdr[0] == TEXT_TS) {
+	    int c;
+
+	    while ((c = getc(f)) != '\0') {
+		if (c == EOF) {
+		    fprintf(stderr, "%s: truncated record\n", me);
+		    exit(1);
+		}
+		if (len >= bufsize) {
+		    buf = grow(buf, &bufsize, len + 1);
+		}
+		buf[len++] = (unsigned char)c;
+	    }
+	} else {
+	    len = get32(hdr + 9);
+	    if (len > bufsize) {
+		buf = grow(buf, &bufsize, len);
+	    }
+	    if (len && fread(buf, len, 1, f) != 1) {
+		fprintf(stderr, "%s: truncated record\n", me);
+		exit(1);
+	    }
+	}
+
+	switch (hdr[0]) {
+	case TEXT_TS:
+	case TEXT:
+	    put_text(buf, len, hdr[0] == TEXT_TS, get32(hdr + 1),
+		    get32(hdr + 5));
+	    break;
+	case '<':
+	case '>':
+	    put_netdata((char)hdr[0], buf, len);
+	    break;
+	default:
+	    fprintf(stderr, "%s: unknown record type 0x%02x\n", me, hdr[0]);
+	    exit(1);
+	}
+    }
+
+    if (f != stdin) {
+	fclose(f);
+    }
+    free(buf);
+    return 0;
+}
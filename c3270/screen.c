@@ -44,6 +44,7 @@
 #include "ctlrc.h"
 #include "cmenubar.h"
 #include "cstatus.h"
+#include "footprint.h"
 #include "glue.h"
 #include "host.h"
 #include "keymap.h"
@@ -53,6 +54,7 @@
 #include "popups.h"
 #include "screen.h"
 #include "see.h"
+#include "startup.h"
 #include "status.h"
 #include "task.h"
 #include "telnet.h"
@@ -312,6 +314,34 @@ static curses_attr other_attr;		/* layer 3 color */
 
 static char *info_base_msg = NULL;	/* original info message (unscrolled) */
 
+/*
+ * What screen_disp() last drew into stdscr, so rows whose inputs have not
+ * changed can be skipped without touching curses.
+ */
+static struct {
+    int rows;			/* ROWS */
+    int cols;			/* cCOLS */
+    int yoffset;		/* screen_yoffset */
+    int xh_addr;		/* cursor_addr if crosshair, else -1 */
+    bool flipped;
+    bool m3279;
+    bool visible_control;
+    bool monocase;
+    bool underscore;
+    bool ascii_box_draw;
+    enum ts ab_mode;
+    curses_attr defattr;
+    curses_attr xhattr;
+} disp_key;
+static struct disp_row {	/* field state at the start of each row */
+    unsigned char fa;
+    struct ea fa_ea;
+    curses_attr field_attrs;
+} *disp_rows = NULL;
+static struct ea *disp_ea = NULL;	/* copy of ea_buf as drawn */
+static int disp_size = 0;
+static bool disp_valid = false;
+
 /* Terminfo state. */
 static struct {
     int colors;		/* number of colors */
@@ -324,7 +354,7 @@ static struct {
 
 static void kybd_input(iosrc_t fd, ioid_t id);
 static void kybd_input2(int k, ucs4_t ucs4, int alt);
-static void draw_oia(void);
+static void draw_oia(bool valid);
 static void status_connect(bool ignored);
 static void status_3270_mode(bool ignored);
 static void status_printer(bool on);
@@ -796,6 +826,7 @@ swap_screens(SCREEN *new_screen)
 {
     set_term(new_screen);
     cur_screen = new_screen;
+    disp_valid = false;
 }
 #endif /*]*/
 
@@ -1268,6 +1299,86 @@ draw_crosshair(ucs4_t u, bool acs)
 #endif /*]*/
 }
 
+/*
+ * Check the global state that affects how every row is drawn, and make sure
+ * the row shadow has room for the current screen.
+ * Returns true if rows drawn by the last screen_disp() can be trusted.
+ */
+static bool
+disp_check(void)
+{
+    bool valid = disp_valid;
+
+    disp_valid = false;
+    if (menu_is_up) {
+	/* Menus overlay the screen, so nothing can be skipped. */
+	return false;
+    }
+    if (disp_size != ROWS * cCOLS) {
+	disp_size = ROWS * cCOLS;
+	Replace(disp_ea, (struct ea *)Malloc(disp_size * sizeof(struct ea)));
+	Replace(disp_rows, (struct disp_row *)Malloc(ROWS *
+		    sizeof(struct disp_row)));
+	valid = false;
+    }
+    if (disp_key.rows != ROWS ||
+	    disp_key.cols != cCOLS ||
+	    disp_key.yoffset != screen_yoffset ||
+	    disp_key.xh_addr != (toggled(CROSSHAIR)? cursor_addr: -1) ||
+	    disp_key.flipped != flipped ||
+	    disp_key.m3279 != mode.m3279 ||
+	    disp_key.visible_control != toggled(VISIBLE_CONTROL) ||
+	    disp_key.monocase != toggled(MONOCASE) ||
+	    disp_key.underscore != toggled(UNDERSCORE) ||
+	    disp_key.ascii_box_draw != appres.c3270.ascii_box_draw ||
+	    disp_key.ab_mode != ab_mode ||
+	    disp_key.defattr != defattr ||
+	    disp_key.xhattr != xhattr) {
+	disp_key.rows = ROWS;
+	disp_key.cols = cCOLS;
+	disp_key.yoffset = screen_yoffset;
+	disp_key.xh_addr = toggled(CROSSHAIR)? cursor_addr: -1;
+	disp_key.flipped = flipped;
+	disp_key.m3279 = mode.m3279;
+	disp_key.visible_control = toggled(VISIBLE_CONTROL);
+	disp_key.monocase = toggled(MONOCASE);
+	disp_key.underscore = toggled(UNDERSCORE);
+	disp_key.ascii_box_draw = appres.c3270.ascii_box_draw;
+	disp_key.ab_mode = ab_mode;
+	disp_key.defattr = defattr;
+	disp_key.xhattr = xhattr;
+	valid = false;
+    }
+    disp_valid = true;
+    return valid;
+}
+
+/*
+ * Compare a row with what was drawn there last time, and remember what is
+ * about to be drawn.
+ * Returns true if the row is unchanged.
+ */
+static bool
+disp_row_same(int row, unsigned char fa, int fa_addr, curses_attr field_attrs,
+	bool valid)
+{
+    struct disp_row *r = &disp_rows[row];
+    struct ea *e = &disp_ea[row * cCOLS];
+
+    if (valid &&
+	    r->fa == fa &&
+	    r->field_attrs == field_attrs &&
+	    !memcmp(&r->fa_ea, &ea_buf[fa_addr], sizeof(struct ea)) &&
+	    !memcmp(e, &ea_buf[row * cCOLS], cCOLS * sizeof(struct ea))) {
+	return true;
+    }
+    r->fa = fa;
+    r->field_attrs = field_attrs;
+    memcpy(&r->fa_ea, &ea_buf[fa_addr], sizeof(struct ea));
+    memcpy(e, &ea_buf[row * cCOLS], cCOLS * sizeof(struct ea));
+    return false;
+}
+
 /* Display what's in the buffer. */
 void
 screen_disp(bool erasing _is_unused)
@@ -1279,6 +1390,10 @@ screen_disp(bool erasing _is_unused)
     enum dbcs_state d;
     int fa_addr;
     char mb[16];
+    bool valid;
+    int c_fa_addr = -2;		/* calc_attrs() cache */
+    unsigned char c_gr = 0, c_fg = 0, c_bg = 0;
+    curses_attr c_attrs = 0;
 
     /* This may be called when it isn't time. */
     if (escaped) {
@@ -1315,6 +1430,7 @@ screen_disp(bool erasing _is_unused)
 
 	/* Tell curses to forget what may be on the screen already. */
 	clear();
+	disp_valid = false;
     }
 #endif /*]*/
 
@@ -1370,9 +1486,25 @@ screen_disp(bool erasing _is_unused)
     fa = get_field_attribute(0);
     fa_addr = find_field_attribute(0);
     field_attrs = calc_attrs(fa_addr, fa_addr, fa);
+    valid = disp_check();
     for (row = 0; row < ROWS; row++) {
 	int baddr;
 
+	if (disp_valid &&
+		disp_row_same(row, fa, fa_addr, field_attrs, valid)) {
+	    /* Nothing to draw, but carry the field state past the row. */
+	    for (col = cCOLS - 1; col >= 0; col--) {
+		baddr = row*cCOLS+col;
+		if (ea_buf[baddr].fa) {
+		    fa_addr = baddr;
+		    fa = ea_buf[baddr].fa;
+		    field_attrs = calc_attrs(baddr, baddr, fa);
+		    break;
+		}
+	    }
+	    continue;
+	}
+
 	if (!flipped) {
 	    move(row + screen_yoffset, 0);
 	}
@@ -1479,7 +1611,20 @@ screen_disp(bool erasing _is_unused)
 		} else {
 		    int buf_attrs;
 
-		    buf_attrs = calc_attrs(baddr, fa_addr, fa);
+		    /* Runs of cells with the same rendition are common. */
+		    if (fa_addr == c_fa_addr &&
+			    ea_buf[baddr].gr == c_gr &&
+			    ea_buf[baddr].fg == c_fg &&
+			    ea_buf[baddr].bg == c_bg) {
+			buf_attrs = c_attrs;
+		    } else {
+			buf_attrs = calc_attrs(baddr, fa_addr, fa);
+			c_fa_addr = fa_addr;
+			c_gr = ea_buf[baddr].gr;
+			c_fg = ea_buf[baddr].fg;
+			c_bg = ea_buf[baddr].bg;
+			c_attrs = buf_attrs;
+		    }
 		    attrs = buf_attrs & attr_mask;
 		    attrset(attrs);
 		    if (buf_attrs & A_UNDERLINE) {
@@ -1579,7 +1724,7 @@ screen_disp(bool erasing _is_unused)
 	}
     }
     if (status_row) {
-	draw_oia();
+	draw_oia(valid);
     }
     attrset(defattr);
     if (menu_is_up) {
@@ -1595,6 +1740,7 @@ screen_disp(bool erasing _is_unused)
 	}
     }
     refresh();
+    startup_mark(STARTUP_SCREEN);
 }
 
 /* ESC processing. */
@@ -1636,16 +1782,11 @@ kybd_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 #else /*][*/
 	k = wgetch(stdscr);
 #endif /*]*/
-	vtrace("kbd_input: k=%d "
-# if defined(CURSES_WIDE) /*[*/
-		       "wch=%lu "
-# endif /*]*/
-				  "\n",
-					k
-# if defined(CURSES_WIDE) /*[*/
-					 , (unsigned long)wch
-# endif /*]*/
-						             );
+#if defined(CURSES_WIDE) /*[*/
+	vtrace("kbd_input: k=%d wch=%lu\n", k, (unsigned long)wch);
+#else /*][*/
+	vtrace("kbd_input: k=%d\n", k);
+#endif /*]*/
 	if (k == ERR) {
 	    if (first) {
 		if (failed_first) {
@@ -2108,6 +2249,25 @@ static char oia_timing[32]; /* :ss.s*/
 static char oia_screentrace = ' ';
 static char oia_script = ' ';
 
+/*
+ * What draw_oia() last put in each field of the status row, so fields that
+ * have not changed are not drawn again.
+ */
+static struct {
+    bool valid;
+    int row;			/* status_row */
+    int rmargin;
+    char lead[4];		/* 4, A/B and N/S/? */
+    char msg[36];		/* status message */
+    curses_attr msg_attr;
+    char flags[16];		/* compose, TRIPS, screen trace and script */
+    int secure;
+    char lu[LUCNT+1];
+    char timing[sizeof(oia_timing)];
+    int cursor_addr;
+    int cols;
+} oia_drawn;
+
 static ioid_t info_done_timeout = NULL_IOID;
 static ioid_t info_scroll_timeout = NULL_IOID;
 
@@ -2439,11 +2599,21 @@ status_script(bool on)
     oia_script = on? 's': ' ';
 }
 
+/*
+ * Draw the OIA.
+ *
+ * If what screen_disp() drew last time can be trusted (valid is true) and
+ * the crosshair is off, only the fields that have changed are drawn.
+ */
 static void
-draw_oia(void)
+draw_oia(bool valid)
 {
     static bool filled_extra[2] = { false, false };
     int i, j;
+    bool full;
+    char lead[4];
+    char msg[36];
+    char flags[16];
     int cursor_row = cursor_addr / cCOLS;
     int cursor_col = cursor_addr % cCOLS;
     int fl_cursor_col = flipped? (cursesCOLS - 1 - cursor_col): cursor_col;
@@ -2475,6 +2645,15 @@ draw_oia(void)
 	rmargin = maxCOLS - 1;
     }
 
+    full = !valid || !oia_drawn.valid || toggled(CROSSHAIR) ||
+	oia_drawn.row != status_row || oia_drawn.rmargin != rmargin;
+    oia_drawn.valid = true;
+    oia_drawn.row = status_row;
+    oia_drawn.rmargin = rmargin;
+    if (!full) {
+	goto fields;
+    }
+
     /* Black out the parts of the screen we aren't using. */
     if (!appres.interactive.mono && !filled_extra[!!curses_alt]) {
 	int r, c;
@@ -2605,23 +2784,27 @@ draw_oia(void)
 	}
     }
 
-    attrset(A_REVERSE | defattr);
-    mvprintw(status_row, 0, "4");
-    attrset(A_UNDERLINE | defattr);
-    if (oia_undera) {
-	printw("%c", IN_E? 'B': 'A');
-    } else {
-	printw(" ");
-    }
-    attrset(A_REVERSE | defattr);
+fields:
+    lead[0] = '4';
+    lead[1] = oia_undera? (IN_E? 'B': 'A'): ' ';
     if (IN_NVT) {
-	printw("N");
+	lead[2] = 'N';
     } else if (oia_boxsolid) {
-	printw(" ");
+	lead[2] = ' ';
     } else if (IN_SSCP) {
-	printw("S");
+	lead[2] = 'S';
     } else {
-	printw("?");
+	lead[2] = '?';
+    }
+    lead[3] = '\0';
+    if (full || strcmp(lead, oia_drawn.lead)) {
+	attrset(A_REVERSE | defattr);
+	mvprintw(status_row, 0, "%c", lead[0]);
+	attrset(A_UNDERLINE | defattr);
+	printw("%c", lead[1]);
+	attrset(A_REVERSE | defattr);
+	printw("%c", lead[2]);
+	strcpy(oia_drawn.lead, lead);
     }
 
     /* Figure out the status message. */
@@ -2645,34 +2828,62 @@ draw_oia(void)
 	status_msg_now = "";
     }
 
-    attrset(msg_attr);
-    mvprintw(status_row, 7, "%-35.35s", status_msg_now);
-    attrset(defattr);
-    mvprintw(status_row, rmargin-35,
-	"%c%c %c%c%c%c",
+    snprintf(msg, sizeof(msg), "%-35.35s", status_msg_now);
+    if (full || strcmp(msg, oia_drawn.msg) || msg_attr != oia_drawn.msg_attr) {
+	attrset(msg_attr);
+	mvprintw(status_row, 7, "%s", msg);
+	strcpy(oia_drawn.msg, msg);
+	oia_drawn.msg_attr = msg_attr;
+    }
+
+    snprintf(flags, sizeof(flags), "%c%c %c%c%c%c",
 	oia_compose? 'C': ' ',
 	oia_compose? oia_compose_char: ' ',
 	status_ta? 'T': ' ',
 	status_rm? 'R': ' ',
 	status_im? 'I': ' ',
 	oia_printer? 'P': ' ');
-    if (status_secure != SS_INSECURE) {
-	attrset(status_colors(defcolor_offset +
-		    ((status_secure == SS_SECURE)? COLOR_GREEN: COLOR_YELLOW))
-		| A_BOLD);
-	printw("S");
+    flags[7] = oia_screentrace;
+    flags[8] = oia_script;
+    flags[9] = '\0';
+    if (full || memcmp(flags, oia_drawn.flags, 10) ||
+	    (int)status_secure != oia_drawn.secure) {
 	attrset(defattr);
-    } else {
-	printw(" ");
+	mvprintw(status_row, rmargin-35, "%c%c%c%c%c%c%c", flags[0], flags[1],
+		flags[2], flags[3], flags[4], flags[5], flags[6]);
+	if (status_secure != SS_INSECURE) {
+	    attrset(status_colors(defcolor_offset +
+			((status_secure == SS_SECURE)? COLOR_GREEN:
+			 COLOR_YELLOW)) | A_BOLD);
+	    printw("S");
+	    attrset(defattr);
+	} else {
+	    printw(" ");
+	}
+	printw("%c%c", flags[7], flags[8]);
+	memcpy(oia_drawn.flags, flags, 10);
+	oia_drawn.secure = (int)status_secure;
     }
-    printw("%c%c", oia_screentrace,oia_script);
 
-    mvprintw(status_row, rmargin-25, "%s", oia_lu);
+    attrset(defattr);
+    if (full || strcmp(oia_lu, oia_drawn.lu)) {
+	mvprintw(status_row, rmargin-25, "%-*s", LUCNT, oia_lu);
+	strcpy(oia_drawn.lu, oia_lu);
+    }
 
-    mvprintw(status_row, rmargin-14, "%s", oia_timing);
+    /* The timing field changes at most once a second while ticking. */
+    if (full || strcmp(oia_timing, oia_drawn.timing)) {
+	mvprintw(status_row, rmargin-14, "%-5.5s", oia_timing);
+	strcpy(oia_drawn.timing, oia_timing);
+    }
 
-    mvprintw(status_row, rmargin-7, "%03d/%03d ", cursor_addr/cCOLS + 1,
-	    cursor_addr%cCOLS + 1);
+    if (full || cursor_addr != oia_drawn.cursor_addr ||
+	    cCOLS != oia_drawn.cols) {
+	mvprintw(status_row, rmargin-7, "%03d/%03d ", cursor_addr/cCOLS + 1,
+		cursor_addr%cCOLS + 1);
+	oia_drawn.cursor_addr = cursor_addr;
+	oia_drawn.cols = cCOLS;
+    }
 
     /* Draw the crosshair in the OIA. */
     if (toggled(CROSSHAIR) &&
@@ -3129,6 +3340,14 @@ enable_cursor(bool on)
     }
 }
 
+/* Footprint of the copy of the screen as drawn. */
+static size_t
+screen_footprint(void)
+{
+    return disp_size * sizeof(struct ea) +
+	((disp_rows != NULL)? ROWS * sizeof(struct disp_row): 0);
+}
+
 /**
  * Screen module registration.
  */
@@ -3146,6 +3365,9 @@ screen_register(void)
     static action_table_t screen_actions[] = {
 	{ AnRedraw,	Redraw_action,	ACTION_KE }
     };
+    static footprint_t footprints[] = {
+	{ "screen-shadow",	screen_footprint,	false }
+    };
 
     /* Register the toggles. */
     register_toggles(toggles, array_count(toggles));
@@ -3158,4 +3380,7 @@ screen_register(void)
 
     /* Register the actions. */
     register_actions(screen_actions, array_count(screen_actions));
+
+    /* Register the buffer size. */
+    register_footprints(footprints, array_count(footprints));
 }
@@ -45,10 +45,13 @@ typedef struct {
 typedef struct action_elt {
     llist_t list;		/* linkage */
     action_table_t t;		/* payload */
+    struct action_elt *hash_next; /* next in hash bucket */
+    uint64_t runs;		/* number of times run */
 } action_elt_t;
 
 extern llist_t actions_list;
 extern unsigned actions_list_count;
+extern unsigned actions_generation;
 
 extern const char       *ia_name[];
 
@@ -64,6 +67,8 @@ bool run_action_entry(action_elt_t *e, enum iaction cause, unsigned count,
 	const char **parms);
 int check_argc(const char *aname, unsigned nargs, unsigned nargs_min,
 	unsigned nargs_max);
+action_elt_t *lookup_action(const char *name);
+action_elt_t *lookup_action_prefix(const char *prefix, bool *ambiguous);
 void register_actions(action_table_t *actions, unsigned count);
 char *safe_param(const char *s);
 void disable_keyboard(bool disable, bool explicit, const char *why);
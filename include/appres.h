@@ -59,6 +59,7 @@ typedef struct {
     bool	 new_environ;
     bool	 socket;
     bool	 trace_monitor;
+    bool	 trace_binary;
     bool	 script_port_once;
     bool	 bind_unlock;
     char	*script_port;
@@ -79,6 +80,10 @@ typedef struct {
     char	*trace_dir;
     char	*trace_file;
     char	*trace_file_size;
+    int		 trace_file_generations;
+    char	*trace_file_compress;
+    char	*trace_file_total_size;
+    char	*trace_categories;
     char	*oversize;
     char	*ft_command;
     char	*connectfile_name;
@@ -86,15 +91,38 @@ typedef struct {
     bool	 idle_command_enabled;
     char	*idle_timeout;
     char	*proxy;
+    bool	 proxy_local_dns;
     int		 unlock_delay_ms;
+    int		 settle_time_ms;
+    bool	 settle_learn;
+    int		 write_cache_size;
+    int		 event_profile_ms;
+    int		 key_latency_sample;
+    char	*span_file;
+    bool	 alloc_accounting;
+    char	*shm_export;
     char	*hostname;
     bool	 utf8;
+    bool	 ui_binary;
+    int		 max_update_rate;
     int	 	 max_recent;
     bool	 nvt_mode;
     char	*suppress_actions;
     char	*min_version;
     int		 connect_timeout;
+    int		 reconnect_max_delay;
     int		 nop_seconds;
+    int		 nvt_save_size;
+    int		 hibernate_seconds;
+    int		 screen_history;
+    int		 latency_busy_poll;
+    int		 latency_dscp;
+    char	*latency_keepalive;
+    bool	 output_cork;
+    bool	 force_scalar;
+    int		 net_read_budget;
+    int		 dns_cache_ttl;
+    int		 alt_buffer_release;
     char	*alias;
 #if defined(_WIN32) /*[*/
     int		 local_cp;
@@ -134,6 +162,7 @@ typedef struct {
 	char	*printer_lu;
 	char	*printer_opts;
 	int	 save_lines;
+	char	*save_memory;
 	char	*crosshair_color;
 	char	*console;
 	bool	 print_dialog;	/* Windows only */
@@ -158,6 +187,7 @@ typedef struct {
 	char	*remap;
 	int	 secondary_space;
 	int	 dft_buffer_size;
+	bool	 dft_buffer_auto;
 #if defined(_WIN32) /*[*/
 	int	 codepage;
 #endif /*]*/
@@ -195,6 +225,11 @@ typedef struct {
 	char	*file;
 	char	*target;
 	char	*type;
+	bool	 dedup;
+	bool	 delta;
+	char	*compress;
+	int	 queue;
+	char	*drop;
     } screentrace;
 
     /* scripting-specific fields. */
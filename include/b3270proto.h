@@ -34,6 +34,21 @@
 #define DocIn		"b3270-in"
 #define DocOut		"b3270-out"
 
+/*
+ * Binary output framing (-binary). The element model is the same as the
+ * XML stream; each element is sent as a frame:
+ *   type (1 byte), payload length (4 bytes, network order), payload
+ * Element and attribute names are sent once in a define frame and then
+ * referred to by 16-bit ID. Start and leaf frames carry the element ID,
+ * an attribute count (2 bytes), then for each attribute its ID (2 bytes),
+ * value length (4 bytes) and UTF-8 value. End frames have no payload.
+ * Input is always XML.
+ */
+#define BinFrameDefine	'd'	/* ID (2 bytes), name */
+#define BinFrameStart	's'	/* container start */
+#define BinFrameLeaf	'l'	/* leaf element */
+#define BinFrameEnd	'e'	/* container end */
+
 /* Indications. */
 #define IndAttr		"attr"
 #define IndBell		"bell"
@@ -46,6 +61,7 @@
 #define IndErase	"erase"
 #define IndFlipped	"flipped"
 #define IndFont		"font"
+#define IndFootprint	"footprint"
 #define IndFormatted	"formatted"
 #define IndFt		"ft"
 #define IndHello	"hello"
@@ -78,6 +94,7 @@
 #define OperFail	"fail"
 #define OperRegister	"register"
 #define OperRun		"run"
+#define OperSubscribe	"subscribe"
 #define OperSucceed	"succeed"
 
 /* Attributes. */
@@ -88,8 +105,11 @@
 #define AttrAttribute	"attribute"
 #define AttrBack	"back"
 #define AttrBg		"bg"
+#define AttrBlocks	"blocks"
+#define AttrBufferSize	"buffer-size"
 #define AttrBuild	"build"
 #define AttrBytes	"bytes"
+#define AttrBytesPerSec	"bytes-per-sec"
 #define AttrBytesReceived "bytes-received"
 #define AttrBytesSent	"bytes-sent"
 #define AttrCause	"cause"
@@ -99,6 +119,7 @@
 #define AttrColumns	"columns"
 #define AttrCount	"count"
 #define AttrCopyright	"copyright"
+#define AttrDiskMs	"disk-ms"
 #define AttrElement	"element"
 #define AttrEnabled	"enabled"
 #define AttrError	"error"
@@ -118,6 +139,7 @@
 #define AttrLu		"lu"
 #define AttrModel	"model"
 #define AttrName	"name"
+#define AttrOia		"oia"
 #define AttrOptions	"options"
 #define AttrOverride	"override"
 #define AttrOversize	"oversize"
@@ -127,15 +149,21 @@
 #define AttrProvider	"provider"
 #define AttrRecordsReceived "records-received"
 #define AttrRecordsSent	"records-sent"
+#define AttrRetransmits	"retransmits"
 #define AttrRTag	"r-tag"
+#define AttrRttMs	"rtt-ms"
+#define AttrRttMaxMs	"rtt-max-ms"
 #define AttrRow		"row"
 #define AttrRows	"rows"
 #define AttrSaved	"saved"
 #define AttrScreen	"screen"
 #define AttrSecure	"secure"
 #define AttrSession	"session"
+#define AttrSessionBytes "session-bytes"
+#define AttrSharedBytes	"shared-bytes"
 #define AttrShown	"shown"
 #define AttrState	"state"
+#define AttrStats	"stats"
 #define AttrSuccess	"success"
 #define AttrSupported	"supported"
 #define AttrText	"text"
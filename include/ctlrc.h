@@ -42,22 +42,28 @@ extern int crm_nattr;
 extern unsigned char reply_mode;
 extern bool screen_alt;
 extern bool screen_changed;
+extern unsigned long screen_generation;
 extern int first_changed;
 extern int last_changed;
 
 void ctlr_aclear(int baddr, int count, int clear_ea);
 void ctlr_add(int baddr, unsigned char c, unsigned char cs);
 void ctlr_add_nvt(int baddr, ucs4_t ucs4, unsigned char cs);
+void ctlr_add_nvt_run(int baddr, const unsigned char *s, int len,
+	unsigned char gr, unsigned char fg, unsigned char bg);
 void ctlr_add_bg(int baddr, unsigned char color);
 void ctlr_add_cs(int baddr, unsigned char cs);
 void ctlr_add_fa(int baddr, unsigned char fa, unsigned char cs);
 void ctlr_add_fg(int baddr, unsigned char color);
 void ctlr_add_gr(int baddr, unsigned char gr);
+void ctlr_add_run(int baddr, const unsigned char *c, const unsigned char *cs,
+	int len);
 void ctlr_altbuffer(bool alt);
 bool ctlr_any_data(void);
 void ctlr_bcopy(int baddr_from, int baddr_to, int count, int move_ea);
 void ctlr_changed(int bstart, int bend);
 void ctlr_clear(bool can_snap);
+void ctlr_clear_row_changes(void);
 void ctlr_erase(bool alt);
 void ctlr_erase_all_unprotected(void);
 void ctlr_init(unsigned cmask);
@@ -71,6 +77,8 @@ const char *ctlr_query_max_size_old(void);
 void ctlr_read_buffer(unsigned char aid_byte);
 void ctlr_read_modified(unsigned char aid_byte, bool all);
 void ctlr_reinit(unsigned cmask);
+bool ctlr_row_changed(int row);
+unsigned long ctlr_row_generation(int row);
 void ctlr_reset(void);
 void ctlr_scroll(unsigned char fg, unsigned char bg);
 void ctlr_shrink(void);
@@ -78,9 +86,11 @@ void ctlr_snap_buffer(void);
 void ctlr_snap_buffer_sscp_lu(void);
 bool ctlr_snap_modes(void);
 void ctlr_wrapping_memmove(int baddr_to, int baddr_from, int count);
+void ctlr_invalidate_fa_index(void);
 enum pds ctlr_write(unsigned char buf[], size_t buflen, bool erase);
 void ctlr_write_sscp_lu(unsigned char buf[], size_t buflen);
 struct ea *fa2ea(int baddr);
+int ctlr_field_addrs(const int **addrs);
 int find_field_attribute(int baddr);
 int find_field_attribute_ea(int baddr, struct ea *ea);
 unsigned char get_field_attribute(register int baddr);
@@ -39,6 +39,7 @@
 #define FPS_OIA			0x40	/* include the OIA */
 
 typedef struct _fps *fps_t;
+typedef struct _fps_snap *fps_snap_t;
 
 typedef enum {
 	FPS_STATUS_SUCCESS = 0,
@@ -55,4 +56,8 @@ fps_status_t fprint_screen_start(FILE *f, ptype_t ptype, unsigned opts,
 	const char *caption, const char *printer_name, fps_t *fps,
 	void *wait_context);
 fps_status_t fprint_screen_body(fps_t fps);
+fps_snap_t fprint_screen_snap(fps_t fps);
+fps_status_t fprint_screen_body_snap(fps_t fps, fps_snap_t snap);
+void fprint_screen_snap_free(fps_snap_t snap);
+void fprint_screen_set_rows(fps_t fps, const unsigned char *rows);
 fps_status_t fprint_screen_done(fps_t *fps);
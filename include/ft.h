@@ -43,10 +43,43 @@ extern enum ft_state ft_state;
 extern enum iaction ft_cause;
 extern unsigned char i_ft2asc[], i_asc2ft[];
 
+/*
+ * Bulk translation tables for ASCII transfers with remapping, covering the
+ * characters that translate on their own (outside of DBCS subfields).
+ */
+#define FT_XLATE_MAX	8		/* longest host-to-local expansion */
+#define FT_XLATE_SLOW	0xff		/* needs the per-character path */
+typedef struct {
+    unsigned char from_host_len[256];	/* bytes of local output, or
+					   FT_XLATE_SLOW */
+    char from_host[256][FT_XLATE_MAX];	/* local output */
+    short to_host[256];			/* host byte, or -1 */
+} ft_xlate_t;
+extern ft_xlate_t ft_xlate;
+
+/* Statistics for the current or most recent transfer. */
+typedef struct {
+    unsigned long blocks;	/* data blocks sent or received */
+    unsigned long retransmits;	/* CUT retransmit requests */
+    unsigned long rtt_count;	/* host round trips timed */
+    double rtt_total;		/* total host round-trip time, seconds */
+    double rtt_max;		/* longest host round trip, seconds */
+    double disk_time;		/* time spent in local file I/O, seconds */
+    size_t buffer_size;		/* DFT buffer size, 0 for CUT */
+} ft_stats_t;
+extern ft_stats_t ft_stats;
+
 void ft_aborting(void);
+int ft_auto_buffersize(void);
 void ft_complete(const char *errmsg);
 void ft_init(void);
+void ft_prefetch(size_t len);
+void ft_checkpoint(size_t pending);
 void ft_running(bool is_cut);
+void ft_stats_disk(const struct timeval *start);
+double ft_stats_elapsed(void);
+void ft_stats_host_data(void);
+void ft_stats_replied(void);
 void ft_update_length(void);
 bool ft_do_cancel(void);
 void ft_register(void);
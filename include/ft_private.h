@@ -71,6 +71,7 @@ typedef struct {
     recfm_t recfm;
     units_t units;
     bool allow_overwrite;
+    bool resume_flag;
     int lrecl;
     int blksize;
     int primary_space;
@@ -95,6 +96,10 @@ bool ft_start_backend(ft_conf_t *p, enum iaction cause);
 typedef struct {
     char *resolved_local_filename;
     FILE *local_file;
+    char *local_buf;		/* stdio buffer for local_file */
+    unsigned char *map;		/* mapping of local_file, for uploads */
+    size_t map_len;		/* length of map */
+    size_t map_offset;		/* next byte to read from map */
     size_t length;
     bool is_cut;
     bool last_dbcs;
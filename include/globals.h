@@ -154,6 +154,21 @@ void Free(void *);
 void *Calloc(size_t, size_t);
 void *Realloc(void *, size_t);
 char *NewString(const char *);
+void *Malloc_at(size_t, const char *);
+void *Calloc_at(size_t, size_t, const char *);
+void *Realloc_at(void *, size_t, const char *);
+char *NewString_at(const char *, const char *);
+#if !defined(UNIT_TEST) /*[*/
+/* Tag each allocation with its source file, for allocation accounting. */
+# define Malloc(len)		Malloc_at(len, __FILE__)
+# define Calloc(nelem, elsize)	Calloc_at(nelem, elsize, __FILE__)
+# define Realloc(p, len)	Realloc_at(p, len, __FILE__)
+# define NewString(s)		NewString_at(s, __FILE__)
+#endif /*]*/
+extern uint64_t malloc_count;
+extern uint64_t malloc_bytes;
+typedef void alloc_track_t(void *old, void *p, size_t len, const char *file);
+extern alloc_track_t *alloc_track;
 
 /* Error exits. */
 void Error(const char *);
@@ -400,6 +415,38 @@ enum keytype { KT_STD, KT_GE };
 #define DFT_MIN_BUF	256
 #define DFT_MAX_BUF	32767
 
+/* Default number of bytes net_input() reads from the host per wakeup. */
+#define NET_READ_BUDGET	262144
+
+/* Default number of NVT bytes kept for Expect() and NvtText(). */
+#define NVT_SAVE_SIZE		4096
+#define NVT_SAVE_MIN		256
+#define NVT_SAVE_MAX		(16 * 1024 * 1024)
+
+/* Default number of screens the screen trace holds before writing them. */
+#define SCREENTRACE_QUEUE	16
+
+/* Default DSCP for the low-latency (Q:) host profile: Expedited Forwarding. */
+#define LATENCY_DSCP	46
+
+/* Default host quiet interval for Wait(Settled), in milliseconds. */
+#define SETTLE_TIME_MS	300
+
+/* Default keystroke latency sampling: one key event in this many. */
+#define KEY_LATENCY_SAMPLE	10
+
+/* Default lifetime of a cached host name lookup, in seconds. */
+#define DNS_CACHE_TTL	30
+
+/*
+ * Default time spent on the primary NVT screen before the alternate screen
+ * buffer is released, in seconds.
+ */
+#define ALT_BUFFER_RELEASE	300
+
+/* Default ceiling on the automatic reconnect delay, in seconds. */
+#define RECONNECT_MAX_DELAY	120
+
 /* DBCS Preedit Types */
 #define PT_ROOT		"Root"
 #define PT_OVER_THE_SPOT	"OverTheSpot"
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	hist.h
+ *		Declarations for hist.c.
+ */
+
+#define HIST_SUB_BITS	4
+#define HIST_MAX_EXP	31
+#define HIST_BUCKETS	((HIST_MAX_EXP - HIST_SUB_BITS + 2) << HIST_SUB_BITS)
+#define HIST_MAX_VALUE	0xffffffffUL	/* larger values are capped */
+
+typedef struct {
+    unsigned long count;		/* number of samples */
+    unsigned long max;			/* largest sample */
+    double total;			/* sum of samples */
+    unsigned long *buckets;		/* HIST_BUCKETS counters */
+} hist_t;
+
+void hist_add(hist_t *h, unsigned long v);
+void hist_clear(hist_t *h);
+unsigned long hist_pct(const hist_t *h, unsigned pct);
+unsigned long hist_bucket_top(unsigned b);
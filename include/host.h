@@ -38,6 +38,7 @@ struct host {
     char *loginstring;
     time_t connect_time;
     struct host *prev, *next;
+    struct host *hash_next;	/* hostfile_lookup() hash chain */
 };
 extern struct host *hosts;
 extern enum iaction connect_ia;
@@ -51,6 +52,7 @@ void host_new_connection(bool pending);
 void host_disconnect(bool disable);
 void host_in3270(enum cstate);
 void host_newfd(iosrc_t s);
+const char *host_qualified_at(const char *address);
 bool host_reconnecting(void);
 void host_register(void);
 void host_set_flag(int flag);
@@ -53,6 +53,7 @@ typedef enum {
 
 /* Registration functions. */
 typedef httpd_status_t reg_dyn_t(const char *uri, void *dhandle);
+typedef void ws_closed_t(void *dhandle);
 void *httpd_register_dir(const char *path, const char *desc);
 void *httpd_register_fixed(const char *path, const char *desc,
 	content_t content_type, const char *content_str, unsigned flags,
@@ -72,6 +73,7 @@ void httpd_set_alias(void *nhandle, const char *text);
 void *httpd_mhandle(void *dhandle);
 void *httpd_new(void *mhandle, const char *client_name);
 httpd_status_t httpd_input(void *dhandle, const char *data, size_t len);
+httpd_status_t httpd_input_held(void *dhandle);
 void httpd_close(void *dhandle, const char *why);
 
 /* Callable from methods. */
@@ -79,6 +81,11 @@ httpd_status_t httpd_dyn_complete(void *dhandle,
 	const char *format, ...);
 httpd_status_t httpd_dyn_error(void *dhandle, content_t content_type,
 	int status_code, const char *format, ...);
+httpd_status_t httpd_dyn_etag(void *dhandle, const char *etag);
 char *html_quote(const char *text);
 char *uri_quote(const char *text);
 const char *httpd_fetch_query(void *dhandle, const char *name);
+const char *httpd_fetch_field(void *dhandle, const char *name);
+httpd_status_t httpd_ws_upgrade(void *dhandle, ws_closed_t *closed);
+void httpd_ws_send(void *dhandle, const char *text, size_t len);
+bool httpd_ws_active(void *dhandle);
@@ -53,6 +53,7 @@ sendto_t hio_to3270(const char *cmd, sendto_callback_t *callback,
 	void *dhandle, content_t content_type);
 
 void hio_send(void *mhandle, const char *buf, size_t len);
+bool hio_output_full(void *mhandle);
 
 void hio_async_done(void *dhandle, httpd_status_t rv);
 
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	keylat.h
+ *		Declarations for keylat.c.
+ */
+
+/* Stages of a key event, in the order they happen. */
+typedef enum {
+    KEYLAT_KEYMAP,	/* key event to action start */
+    KEYLAT_TYPEAHEAD,	/* time on the typeahead queue */
+    KEYLAT_DISPATCH,	/* action start to key_AID() */
+    KEYLAT_ENCODE,	/* key_AID() to the end of ctlr_read_modified() */
+    KEYLAT_WRITE,	/* last stage to the bytes being written */
+    KEYLAT_TOTAL,	/* key event to the bytes being written */
+    KEYLAT_NSTAGES
+} keylat_stage_t;
+
+void keylat_key(void);
+void keylat_action(void);
+void keylat_end(void);
+bool keylat_enqueue(void);
+void keylat_dequeue(void);
+void keylat_flush(void);
+void keylat_stage(keylat_stage_t stage);
+void keylat_wire(void);
+const char *keylat_metrics(void);
+void keylat_register(void);
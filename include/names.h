@@ -72,8 +72,11 @@
 #define AnExpect	"Expect"
 #define AnFieldEnd	"FieldEnd"
 #define AnFieldMark	"FieldMark"
+#define AnFields	"Fields"
+#define AnFind		"Find"
 #define AnFlip		"Flip"
 #define AnHexString	"HexString"
+#define AnHistory	"History"
 #define AnHome		"Home"
 #define	AnHelp		"Help"
 #define Anignore	"ignore"
@@ -94,6 +97,7 @@
 #define AnNewline	"Newline"
 #define AnNextWord	"NextWord"
 #define AnNvtText	"NvtText"
+#define AnObserve	"Observe"
 #define AnOpen		"Open"
 #define AnPA		"PA"
 #define AnPaste		"Paste"
@@ -177,6 +181,7 @@
 /*  Parameters to Query(). */
 #define KwAbout		"About"
 #define KwActions	"Actions"
+#define KwAllocations	"Allocations"
 #define KwBindPluName	"BindPluName"
 #define KwBuildOptions	"BuildOptions"
 #define KwConnectionState "ConnectionState"
@@ -186,30 +191,37 @@
 #define KwCopyright	"Copyright"
 #define KwCursor	"Cursor"
 #define KwCursor1	"Cursor1"
+#define KwEventProfile	"EventProfile"
+#define KwFootprint	"Footprint"
 #define KwFormatted	"Formatted"
 #define KwHost		"Host"
+#define KwKeyLatency	"KeyLatency"
 #define KwKeymap	"Keymap"
 #define KwLocalEncoding	"LocalEncoding"
 #define KwLuName	"LuName"
 #define KwModel		"Model"
 #define KwPrefixes	"Prefixes"
 #define KwProxy		"Proxy"
+#define KwResponseTime	"ResponseTime"
 #define KwScreenCurSize	"ScreenCurSize"
 #define KwScreenMaxSize	"ScreenMaxSize"
 #define KwScreenSizeCurrent "ScreenSizeCurrent"
 #define KwScreenSizeMax	"ScreenSizeMax"
 #define KwScreenTraceFile "ScreenTraceFile"
+#define KwSimd		"Simd"
 #define KwSsl		"Ssl"
 #define KwStats		"Stats"
 #define KwStatus	"Status"
 #define KwStatsRx	"StatsRx"
 #define KwStatsTx	"StatsTx"
+#define KwTaskUsage	"TaskUsage"
 #define KwTasks		"Tasks"
 #define KwTelnetMyOptions "TelnetMyOptions"
 #define KwTelnetHostOptions "TelnetHostOptions"
 #define KwTerminalName	"TerminalName"
 #define KwTn3270eOptions "Tn3270eOptions"
 #define KwTraceFile	"TraceFile"
+#define KwTransferStats	"TransferStats"
 #define KwTls		"Tls"
 #define KwTlsCertInfo	"TlsCertInfo"
 #define KwTlsProvider	"TlsProvider"
@@ -219,11 +231,20 @@
 /*  Parameters to Quit(). */
 #define KwDashForce	"-force"
 #define KwForce		"force"
+/*  Parameters to Observe(). */
+#define KwScreen	"screen"
+#define KwNvt		"nvt"
+#define KwAll		"all"
+/*  Parameters to Expect(). */
+#define KwNew		"New"
 /*  Parameters to ReadBuffer(). */
 #define KwAscii		"ascii"
 #define KwEbcdic	"ebcdic"
 #define KwUnicode	"unicode"
 #define KwField		"field"
+/*  Parameters to Fields(). */
+#define KwUnprotected	"unprotected"
+#define KwModified	"modified"
 /*  Parameters to RequestInput(). */
 #define KwDashNoEcho	"-noecho"
 /*  Parameters to ScreenTrace(). */
@@ -265,8 +286,10 @@
 #define KwInputField	"inputfield"
 #define KwNvtMode	"nvtmode"
 #define KwOutput	"output"
+#define KwRegex		"regex"
 #define KwUnlock	"unlock"
 #define KwSeconds	"seconds"
+#define KwSettled	"settled"
 /*  Parameters to WindowState(). */
 #define KwIconic	"iconic"
 #define KwNormal	"normal"
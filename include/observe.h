@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+ *	observe.h
+ *		Host output observers.
+ */
+
+/* What an observer wants to see. */
+#define OBS_SCREEN	0x1	/* the screen after each host write */
+#define OBS_NVT		0x2	/* NVT-mode host output */
+
+/* Default limit on how far an observer may fall behind, in bytes. */
+#define OBS_LIMIT_DEFAULT	(1024 * 1024)
+
+typedef struct observer observer_t;
+
+/*
+ * Observer output function. Returns true if the text was accepted and more
+ * can be sent, false if the observer cannot take any more for now, in which
+ * case it calls observe_drain() when it can.
+ */
+typedef bool observe_send_fn(void *context, const char *buf, size_t len);
+
+extern unsigned observe_classes;
+
+observer_t *observe_add(unsigned what, size_t limit, observe_send_fn *send,
+	void *context);
+void observe_change(observer_t *o, unsigned what, size_t limit);
+void observe_remove(observer_t *o);
+void observe_drain(observer_t *o);
+void observe_screen(void);
+void observe_nvt_char(unsigned char c);
+void observe_flush(void);
+void observe_register(void);
+
+/* Pass NVT output to the observers, if there are any. */
+#define observe_nvt(c)	do { \
+    if (observe_classes & OBS_NVT) { \
+	observe_nvt_char(c); \
+    } \
+} while (false)
@@ -65,3 +65,4 @@ void proxy_close(void);
 const char *proxy_type_name(int type);
 bool proxy_takes_username(int type);
 int proxy_default_port(proxytype_t type);
+void proxy_set_local_dns(bool local);
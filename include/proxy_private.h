@@ -43,3 +43,6 @@
 #endif /*]*/
 
 typedef proxy_negotiate_ret_t continue_t(void);
+
+proxy_negotiate_ret_t proxy_recv(const char *name, socket_t fd,
+	unsigned char *buf, size_t *nread, size_t want);
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	rearm.h
+ *		Re-armable timers.
+ */
+
+typedef struct rearm rearm_t;
+typedef void (*rearm_fn_t)(rearm_t *r);
+
+/*
+ * A re-armable timer. It is embedded in its owner, which can find itself
+ * from the rearm_t pointer passed to the callback. The fields are private.
+ */
+struct rearm {
+    llist_t link;		/* list of timers with a pending timeout */
+    ioid_t id;			/* pending timeout, or NULL_IOID */
+    unsigned long long fires;	/* when the pending timeout fires, msec */
+    unsigned long long due;	/* when the callback is due, msec */
+    unsigned long slack_ms;	/* coalescing slack */
+    rearm_fn_t fn;		/* callback */
+    bool armed;			/* callback is due */
+};
+
+void rearm_init(rearm_t *r, rearm_fn_t fn);
+void rearm_set(rearm_t *r, unsigned long msec, unsigned long slack_ms);
+void rearm_cancel(rearm_t *r);
+void rearm_release(rearm_t *r);
+bool rearm_pending(const rearm_t *r);
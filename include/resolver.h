@@ -48,6 +48,8 @@ rhp_t collect_host_and_port(int slot, struct sockaddr *sa, size_t sa_len,
 	socklen_t *sa_rlen, unsigned short *pport, char **errmsg, int max,
 	int *nr);
 void cleanup_host_and_port(int slot);
+void set_resolver_cache_ttl(int seconds);
 
 bool numeric_host_and_port(const struct sockaddr *sa, socklen_t salen,
 	char *host, size_t hostlen, char *serv, size_t servlen, char **errmsg);
+bool numeric_host(const char *host);
@@ -38,7 +38,9 @@
 #define ResAidWait		"aidWait"
 #define ResAlias		"alias"
 #define ResAllBold		"allBold"
+#define ResAllocAccounting	"allocAccounting"
 #define ResAllowResize		"allowResize"
+#define ResAltBufferRelease	"altBufferRelease"
 #define ResAltCursor		"altCursor"
 #define ResAltScreen		"altScreen"
 #define ResAlwaysInsert		"alwaysInsert"
@@ -47,9 +49,11 @@
 #define ResAsciiBoxDraw		"asciiBoxDraw"
 #define ResAssocCommand		"printer.assocCommandLine"
 #define ResAutoShortcut		"autoShortcut"
+#define ResBackingPixmap	"backingPixmap"
 #define ResBaselevelTranslations	"baselevelTranslations"
 #define ResBellMode		"bellMode"
 #define ResBellVolume		"bellVolume"
+#define ResBinary		"binary"
 #define ResBindUnlock		"bindUnlock"
 #define ResBindLimit		"bindLimit"
 #define ResBlankFill		"blankFill"
@@ -93,15 +97,19 @@
 #define ResDefScreen		"defScreen"
 #define ResDevName		"devName"
 #define ResDisconnectClear	"disconnectClear"
+#define ResDnsCacheTtl		"dnsCacheTtl"
 #define ResDoConfirms		"doConfirms"
 #define ResDpi			"dpi"
 #define ResEmulatorFont		"emulatorFont"
 #define ResEof			"eof"
 #define ResErase		"erase"
+#define ResEventProfileMs	"eventProfileMs"
 #define ResFixedSize		"fixedSize"
+#define ResForceScalar		"forceScalar"
 #define ResFtAllocation		"ftAllocation"
 #define ResFtAvblock		"ftAvblock"
 #define ResFtBlksize		"ftBlksize"
+#define ResFtBufferAuto		"ftBufferAuto"
 #define ResFtBufferSize		"ftBufferSize"
 #define ResFtCr			"ftCr"
 #define ResFtDirection		"ftDirection"
@@ -116,6 +124,7 @@
 #define ResFtRemap		"ftRemap"
 #define ResFtSecondarySpace	"ftSecondarySpace"
 #define ResFtWindowsCodePage	"ftWindowsCodePage"
+#define ResHibernateSeconds	"hibernateSeconds"
 #define ResHighlightBold	"highlightBold"
 #define ResHostColorFor		"hostColorFor"
 #define ResHostColorForDefault ResHostColorFor "Default"
@@ -138,14 +147,19 @@
 #define ResIntr			"intr"
 #define ResInvertKeypadShift	"invertKeypadShift"
 #define ResKeyFile		"keyFile"
+#define ResKernelTls		"kernelTls"
 #define ResKeyFileType		"keyFileType"
 #define ResKeymap		"keymap"
+#define ResKeyLatencySample	"keyLatencySample"
 #define ResKeypad		"keypad"
 #define ResKeypadBackground	"keypadBackground"
 #define ResKeypadOn		"keypadOn"
 #define ResKeyPasswd		"keyPasswd"
 #define ResKill			"kill"
 #define ResLabelIcon		"labelIcon"
+#define ResLatencyBusyPoll	"latencyBusyPoll"
+#define ResLatencyDscp		"latencyDscp"
+#define ResLatencyKeepalive	"latencyKeepalive"
 #define ResLightPenPrimary	"lightPenPrimary"
 #define ResLineWrap		"lineWrap"
 #define ResLnext		"lnext"
@@ -156,6 +170,7 @@
 #define ResMacros		"macros"
 #define ResMarginedPaste	"marginedPaste"
 #define ResMaxRecent		"maxRecent"
+#define ResMaxUpdateRate	"maxUpdateRate"
 #define ResMenuBar		"menuBar"
 #define ResMetaEscape		"metaEscape"
 #define ResMinVersion		"minVersion"
@@ -165,6 +180,7 @@
 #define ResMono			"mono"
 #define ResMonoCase		"monoCase"
 #define ResMouse		"mouse"
+#define ResNetReadBudget	"netReadBudget"
 #define ResNewEnviron		"newEnviron"
 #define ResNoOther		"noOther"
 #define ResNoPrompt		"noPrompt"
@@ -174,10 +190,12 @@
 #define ResNormalCursor		"normalCursor"
 #define ResNumericLock		"numericLock"
 #define ResNvtMode		"nvtMode"
+#define ResNvtSaveSize		"nvtSaveSize"
 #define ResOerrLock		"oerrLock"
 #define ResOnce			"once"
 #define ResOnlcr		"onlcr"
 #define ResOverlayPaste		"overlayPaste"
+#define ResOutputCork		"outputCork"
 #define ResOversize		"oversize"
 #define ResPort			"port"
 #define ResPreeditType		"preeditType"
@@ -188,18 +206,27 @@
 #define ResPrinterOptions	"printer.options"
 #define ResPrintDialog		"printDialog"
 #define ResProxy		"proxy"
+#define ResProxyLocalDns	"proxyLocalDns"
 #define ResQuit			"quit"
 #define ResQrBgColor		"qrBgColor"
 #define ResReconnect		"reconnect"
+#define ResReconnectMaxDelay	"reconnectMaxDelay"
 #define ResRectangleSelect	"rectangleSelect"
 #define ResReverseInputMode	"reverseInputMode"
 #define ResReverseVideo		"reverseVideo"
 #define ResRightToLeftMode	"rightToLeftMode"
 #define ResRprnt		"rprnt"
 #define ResSaveLines		"saveLines"
+#define ResSaveMemory		"saveMemory"
 #define ResSchemeList		"schemeList"
+#define ResScreenHistory	"screenHistory"
 #define ResScreenTrace		"screenTrace"
+#define ResScreenTraceCompress	"screenTraceCompress"
+#define ResScreenTraceDedup	"screenTraceDedup"
+#define ResScreenTraceDelta	"screenTraceDelta"
+#define ResScreenTraceDrop	"screenTraceDrop"
 #define ResScreenTraceFile	"screenTraceFile"
+#define ResScreenTraceQueue	"screenTraceQueue"
 #define ResScreenTraceTarget	"screenTraceTarget"
 #define ResScreenTraceType	"screenTraceType"
 #define ResScripted		"scripted"
@@ -210,8 +237,12 @@
 #define ResSelectBackground	"selectBackground"
 #define ResSelectUrl		"selectUrl"
 #define ResSbcsCgcsgid		"sbcsCgcsgid"
+#define ResSettleLearn		"settleLearn"
+#define ResSettleTime		"settleTime"
+#define ResShmExport		"shmExport"
 #define ResShowTiming		"showTiming"
 #define ResSocket		"socket"
+#define ResSpanFile		"spanFile"
 #define ResStartTls		"startTls"
 #define ResSuppressActions	"suppressActions"
 #define ResSuppressHost		"suppressHost"
@@ -219,10 +250,17 @@
 #define ResSuppress		"suppress"
 #define ResTermName		"termName"
 #define ResTitle		"title"
+#define ResTlsMaxFragment	"tlsMaxFragment"
+#define ResTlsReleaseBuffers	"tlsReleaseBuffers"
 #define ResTrace		"trace"
+#define ResTraceBinary		"traceBinary"
+#define ResTraceCategories	"traceCategories"
 #define ResTraceDir		"traceDir"
 #define ResTraceFile		"traceFile"
+#define ResTraceFileCompress	"traceFileCompress"
+#define ResTraceFileGenerations	"traceFileGenerations"
 #define ResTraceFileSize	"traceFileSize"
+#define ResTraceFileTotalSize	"traceFileTotalSize"
 #define ResTraceMonitor		"traceMonitor"
 #define ResTypeahead		"typeahead"
 #define ResUnderscore		"underscore"
@@ -238,6 +276,7 @@
 #define ResVisualSelectColor	"visualSelectColor"
 #define ResWaitCursor		"waitCursor"
 #define ResWerase		"werase"
+#define ResWriteCacheSize	"writeCacheSize"
 #define ResXQuartzHack		"xQuartzHack"
 
 /* Dotted resource names. */
@@ -290,6 +329,7 @@
 #define DotTermName		"." ResTermName
 #define DotTitle		"." ResTitle
 #define DotTrace		"." ResTrace
+#define DotTraceBinary		"." ResTraceBinary
 #define DotTraceFile		"." ResTraceFile
 #define DotTraceFileSize	"." ResTraceFileSize
 #define DotUser			"." ResUser
@@ -303,10 +343,12 @@
 #define ClsAidWait		"AidWait"
 #define ClsAllBold		"AllBold"
 #define ClsAllowResize		"AllowResize"
+#define ClsAltBufferRelease	"AltBufferRelease"
 #define ClsAltCursor		"AltCursor"
 #define ClsAlwaysInsert		"AlwaysInsert"
 #define ClsAplCircledAlpha	"AplCircledAlpha"
 #define ClsAplMode		"AplMode"
+#define ClsBackingPixmap	"BackingPixmap"
 #define ClsBaselevelTranslations	"BaselevelTranslations"
 #define ClsBellVolume		"BellVolume"
 #define ClsBindLimit		"BindLimit"
@@ -339,15 +381,18 @@
 #define ClsDebugTracing		"DebugTracing"
 #define ClsDevName		"DevName"
 #define ClsDisconnectClear	"DisconnectClear"
+#define ClsDnsCacheTtl		"DnsCacheTtl"
 #define ClsDoConfirms		"DoConfirms"
 #define ClsDpi			"Dpi"
 #define ClsEmulatorFont		"EmulatorFont"
 #define ClsEof			"Eof"
 #define ClsErase		"Erase"
 #define ClsFixedSize		"FixedSize"
+#define ClsForceScalar		"ForceScalar"
 #define ClsFtAllocation		"FtAllocation"
 #define ClsFtAvblock		"FtAvblock"
 #define ClsFtBlksize		"FtBlksize"
+#define ClsFtBufferAuto		"FtBufferAuto"
 #define ClsFtBufferSize		"FtBufferSize"
 #define ClsFtCr			"FtCr"
 #define ClsFtDirection		"FtDirection"
@@ -362,6 +407,7 @@
 #define ClsFtRemap		"FtRemap"
 #define ClsFtSecondarySpace	"FtSecondarySpace"
 #define ClsFtWindowsCodePage	"ClsWindowsCodePage"
+#define ClsHibernateSeconds	"HibernateSeconds"
 #define ClsHighlightBold	"HighlightBold"
 #define ClsHostname		"Hostname"
 #define ClsHostsFile		"HostsFile"
@@ -379,14 +425,19 @@
 #define ClsIntr			"Intr"
 #define ClsInvertKeypadShift	"InvertKeypadShift"
 #define ClsKeyFile		"KeyFile"
+#define ClsKernelTls		"KernelTls"
 #define ClsKeyFileType		"KeyFileType"
 #define ClsKeymap		"Keymap"
+#define ClsKeyLatencySample	"KeyLatencySample"
 #define ClsKeypad		"Keypad"
 #define ClsKeypadBackground	"KeypadBackground"
 #define ClsKeypadOn		"KeypadOn"
 #define ClsKeyPasswd		"KeyPasswd"
 #define ClsKill			"Kill"
 #define ClsLabelIcon		"LabelIcon"
+#define ClsLatencyBusyPoll	"LatencyBusyPoll"
+#define ClsLatencyDscp		"LatencyDscp"
+#define ClsLatencyKeepalive	"LatencyKeepalive"
 #define ClsLineWrap		"LineWrap"
 #define ClsLnext		"Lnext"
 #define ClsLockedCursor		"LockedCursor"
@@ -402,6 +453,7 @@
 #define ClsModifiedSelColor	"ModifiedSelColor"
 #define ClsMono			"Mono"
 #define ClsMonoCase		"MonoCase"
+#define ClsNetReadBudget	"NetReadBudget"
 #define ClsNewEnviron		"NewEnviron"
 #define ClsNoOther		"NoOther"
 #define ClsNoTelnetInputMode	"NoTelnetInputMode"
@@ -410,10 +462,12 @@
 #define ClsNormalCursor		"NormalCursor"
 #define ClsNumericLock		"NumericLock"
 #define ClsNvtMode		"NvtMode"
+#define ClsNvtSaveSize		"NvtSaveSize"
 #define ClsOerrLock		"OerrLock"
 #define ClsOnce			"Once"
 #define ClsOnlcr		"Onlcr"
 #define ClsOverlayPaste		"OverlayPaste"
+#define ClsOutputCork		"OutputCork"
 #define ClsOversize		"Oversize"
 #define ClsPort			"Port"
 #define ClsPreeditType		"PreeditType"
@@ -421,14 +475,21 @@
 #define ClsProxy		"Proxy"
 #define ClsQuit			"Quit"
 #define ClsReconnect		"Reconnect"
+#define ClsReconnectMaxDelay	"ReconnectMaxDelay"
 #define ClsRectangleSelect	"RectangleSelect"
 #define ClsReverseInputMode	"ReverseInputMode"
 #define ClsRightToLeftMode	"RightToLeftMode"
 #define ClsRprnt		"Rprnt"
 #define ClsSaveLines		"SaveLines"
+#define ClsSaveMemory		"SaveMemory"
 #define ClsSbcsCgcsgid		"SbcsSgcsgid"
 #define ClsScreenTrace		"ScreenTrace"
+#define ClsScreenTraceCompress	"ScreenTraceCompress"
+#define ClsScreenTraceDedup	"ScreenTraceDedup"
+#define ClsScreenTraceDelta	"ScreenTraceDelta"
+#define ClsScreenTraceDrop	"ScreenTraceDrop"
 #define ClsScreenTraceFile	"ScreenTraceFile"
+#define ClsScreenTraceQueue	"ScreenTraceQueue"
 #define ClsScreenTraceTarget	"ScreenTraceTarget"
 #define ClsScreenTraceType	"ScreenTraceType"
 #define ClsScripted		"Scripted"
@@ -438,17 +499,28 @@
 #define ClsSecure		"Secure"
 #define ClsSelectBackground	"SelectBackground"
 #define ClsSelectUrl		"SelectUrl"
+#define ClsSettleLearn		"SettleLearn"
+#define ClsSettleTime		"SettleTime"
+#define ClsShmExport		"ShmExport"
 #define ClsShowTiming		"ShowTiming"
 #define ClsSocket		"Socket"
+#define ClsSpanFile		"SpanFile"
 #define ClsStartTls		"StartTls"
 #define ClsSuppressActions	"SuppressActions"
 #define ClsSuppressHost		"SuppressHost"
 #define ClsSuppressFontMenu	"SuppressFontMenu"
 #define ClsTermName		"TermName"
+#define ClsTlsMaxFragment	"TlsMaxFragment"
+#define ClsTlsReleaseBuffers	"TlsReleaseBuffers"
 #define ClsTrace		"Trace"
+#define ClsTraceBinary		"TraceBinary"
+#define ClsTraceCategories	"TraceCategories"
 #define ClsTraceDir		"TraceDir"
 #define ClsTraceFile		"TraceFile"
+#define ClsTraceFileCompress	"TraceFileCompress"
+#define ClsTraceFileGenerations	"TraceFileGenerations"
 #define ClsTraceFileSize	"TraceFileSize"
+#define ClsTraceFileTotalSize	"TraceFileTotalSize"
 #define ClsTraceMonitor		"TraceMonitor"
 #define ClsTypeahead		"Typeahead"
 #define ClsUnlockDelay		"UnlockDelay"
@@ -463,6 +535,7 @@
 #define ClsVisualSelectColor	"VisualSelectColor"
 #define ClsWaitCursor		"WaitCursor"
 #define ClsWerase		"Werase"
+#define ClsWriteCacheSize	"WriteCacheSize"
 #define ClsXQuartzHack		"XQuartzHack"
 
 /* Options. */
@@ -472,6 +545,7 @@
 #define OptAllBold		"-allbold"
 #define OptAltScreen		"-altscreen"
 #define OptAplMode		"-apl"
+#define OptBinary		"-binary"
 #define OptCaDir		"-cadir"
 #define OptCaFile		"-cafile"
 #define OptCallback		"-callback"
@@ -536,6 +610,7 @@
 #define OptNoVerifyHostCert	"-noverifycert"
 #define OptTermName		"-tn"
 #define OptTitle		"-title"
+#define OptTraceBinary		"-tracebinary"
 #define OptTraceFile		"-tracefile"
 #define OptTraceFileSize	"-tracefilesize"
 #define OptUser			"-user"
@@ -543,6 +618,7 @@
 #define OptV			"-v"
 #define OptVerifyHostCert	"-verifycert"
 #define OptVersion		"--version"
+#define OptZygote		"-zygote"
 
 /* Miscellaneous values. */
 #define ResTrue			"true"
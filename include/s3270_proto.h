@@ -35,6 +35,7 @@
 #define INPUT_ENV	"X3270INPUT"
 #define PORT_ENV	"X3270PORT"
 #define URL_ENV		"X3270URL"
+#define SHM_ENV		"X3270SHM"
 
 /* Common length for all prefixes. */
 #define PREFIX_LEN	6
@@ -53,3 +54,17 @@
 /* Action to continue or abort interactive input. */
 #define RESUME_INPUT	"ResumeInput"
 #define RESUME_INPUT_ABORT	"-Abort"
+
+/*
+ * Framed protocol for child scripts on pipes, switched on by a successful
+ * Capabilities(framed). Everything after the reply to that command is
+ * framed: a type byte, a 4-byte big-endian payload length, and the payload.
+ */
+#define FRAME_HDR_LEN	5
+#define FRAME_MAX	(1024 * 1024)	/* longest command accepted */
+#define FRAME_CMD	'C'		/* command, script to emulator */
+#define FRAME_DATA	'D'		/* data line */
+#define FRAME_INPUT	'I'		/* input request */
+#define FRAME_PWINPUT	'P'		/* password input request */
+#define FRAME_OK	'O'		/* success, payload is the prompt */
+#define FRAME_ERROR	'E'		/* failure, payload is the prompt */
@@ -33,3 +33,4 @@
 typedef void qr_single_fn_t(void);
 
 enum pds write_structured_field(unsigned char buf[], size_t buflen);
+void sf_register(void);
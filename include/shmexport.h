@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	shmexport.h
+ *		Shared-memory presentation space export.
+ *
+ * When the shmExport resource names a file, the emulator maps it and keeps
+ * a copy of the screen in it: a header followed by an array of cells, one
+ * per screen position, rows * cols of them in row-major order.
+ *
+ * Updates are bracketed by the seq field. It is odd while the emulator is
+ * writing, and is incremented again when it is done. A reader takes a
+ * consistent copy by reading seq (retrying while it is odd), copying what
+ * it needs, and checking that seq has not changed.
+ *
+ * After the cells comes a ring of events describing each update, so a
+ * reader can find out what changed without comparing whole screens. Events
+ * are numbered from 0, and event n is in slot n % ring_slots. ring_next is
+ * the number of the next event to be published. A reader keeps its own
+ * count, starting at ring_next. While its count differs from ring_next, it
+ * reads that slot: the event is valid if 'end' equals the count before the
+ * copy and 'begin' still equals it afterwards. If ring_next has moved more
+ * than ring_slots past its count, events were lost and the reader should
+ * copy the whole screen.
+ */
+
+#define SHMX_MAGIC	"x3270shm"
+#define SHMX_VERSION	1
+
+/* Header flags. */
+#define SHMX_CONNECTED	0x1	/* connected to a host */
+#define SHMX_3270	0x2	/* in 3270 mode */
+#define SHMX_NVT	0x4	/* in NVT mode */
+#define SHMX_FORMATTED	0x8	/* screen is formatted */
+
+typedef struct {
+    char magic[8];		/* SHMX_MAGIC, not NUL-terminated */
+    uint32_t version;		/* SHMX_VERSION */
+    uint32_t header_size;	/* offset of the cell array */
+    uint32_t cell_size;		/* size of each cell */
+    volatile uint32_t seq;	/* odd while an update is in progress */
+    uint32_t max_rows;		/* rows in the cell array */
+    uint32_t max_cols;		/* columns in the cell array */
+    uint32_t rows;		/* rows on the screen now */
+    uint32_t cols;		/* columns on the screen now */
+    uint32_t cursor;		/* cursor buffer address */
+    uint32_t kybdlock;		/* keyboard lock bits, 0 if unlocked */
+    uint32_t flags;		/* SHMX_xxx */
+    uint32_t reserved;
+    uint64_t generation;	/* changes whenever the screen does */
+    uint32_t ring_offset;	/* offset of the event ring */
+    uint32_t ring_slots;	/* events in the ring, a power of 2 */
+    volatile uint32_t ring_next; /* number of the next event */
+    uint32_t event_size;	/* size of each event */
+} shmx_header_t;
+
+/* Cell flags. */
+#define SHMX_CELL_FA	0x1	/* field attribute */
+#define SHMX_CELL_HIDDEN 0x2	/* in a non-display field */
+#define SHMX_CELL_LEFT	0x4	/* left half of a DBCS character */
+#define SHMX_CELL_RIGHT	0x8	/* right half of a DBCS character */
+
+typedef struct {
+    uint32_t ucs4;		/* character as displayed, 0 for DBCS right */
+    uint8_t ec;			/* EBCDIC code */
+    uint8_t fa;			/* field attribute, if SHMX_CELL_FA */
+    uint8_t fg;			/* foreground color */
+    uint8_t bg;			/* background color */
+    uint8_t gr;			/* graphic rendition */
+    uint8_t cs;			/* character set */
+    uint8_t flags;		/* SHMX_CELL_xxx */
+    uint8_t reserved;
+} shmx_cell_t;
+
+/* Event types. */
+#define SHMX_EV_ROWS	1	/* rows changed: arg1 first row, arg2 count */
+#define SHMX_EV_CURSOR	2	/* cursor moved: arg1 buffer address */
+#define SHMX_EV_KYBDLOCK 3	/* keyboard lock changed: arg1 lock bits */
+#define SHMX_EV_STATE	4	/* connection state changed: arg1 SHMX_xxx */
+#define SHMX_EV_SIZE	5	/* screen size changed: arg1 rows, arg2 cols */
+
+typedef struct {
+    volatile uint32_t begin;	/* event number, stored before the rest */
+    uint32_t type;		/* SHMX_EV_xxx */
+    uint32_t arg1;
+    uint32_t arg2;
+    volatile uint32_t end;	/* event number, stored after the rest */
+    uint32_t reserved;
+} shmx_event_t;
+
+void shmexport_register(void);
+void shmexport_update(void);
+const char *shmexport_path(void);
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Paul Mattes.
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *     * Redistributions of source code must retain the above copyright
+ *       notice, this list of conditions and the following disclaimer.
+ *     * Redistributions in binary form must reproduce the above copyright
+ *       notice, this list of conditions and the following disclaimer in the
+ *       documentation and/or other materials provided with the distribution.
+ *     * Neither the names of Paul Mattes nor the names of his contributors
+ *       may be used to endorse or promote products derived from this software
+ *       without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY PAUL MATTES "AS IS" AND ANY EXPRESS OR IMPLIED
+ * WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+ * MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO
+ * EVENT SHALL PAUL MATTES BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ * PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+ * OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+ * WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+ * OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+/*
+ *	startup.h
+ *		Startup-time markers.
+ */
+
+/* Startup stages, in the order they normally happen. */
+typedef enum {
+    STARTUP_MAIN,		/* main() entered */
+    STARTUP_RESOURCES,		/* command line and resources parsed */
+    STARTUP_CODEPAGE,		/* code page initialized */
+    STARTUP_LOOP,		/* first event loop pass complete */
+    STARTUP_CONNECT,		/* TCP connection complete */
+    STARTUP_NEGOTIATED,		/* TELNET/TN3270E negotiation complete */
+    STARTUP_HOST_WRITE,		/* first host data processed */
+    STARTUP_SCREEN,		/* first screen with host data drawn */
+    STARTUP_NSTAGES
+} startup_stage_t;
+
+extern bool startup_tracing;
+
+void startup_init(const char *product);
+void startup_mark_stage(startup_stage_t stage);
+
+/* Mark a startup stage. Costs one test when tracing is off. */
+#define startup_mark(stage) do { \
+    if (startup_tracing) { \
+	startup_mark_stage(stage); \
+    } \
+} while (false)
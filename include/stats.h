@@ -30,4 +30,39 @@
  *              Statistics interface.
  */
 
+/* Counters. */
+typedef enum {
+    /* Per-connection, cleared when a new connection starts. */
+    STAT_BYTES_RX,		/* bytes received */
+    STAT_RECORDS_RX,		/* 3270 records received */
+    STAT_BYTES_TX,		/* bytes sent */
+    STAT_RECORDS_TX,		/* 3270 records sent */
+    STAT_TLS_BYTES_RX,		/* bytes received over TLS */
+    STAT_TLS_BYTES_TX,		/* bytes sent over TLS */
+    STAT_FT_BLOCKS,		/* file transfer blocks */
+    STAT_WRITE_CACHE_HITS,	/* Erase/Writes applied from the cache */
+    STAT_WRITE_CACHE_MISSES,	/* Erase/Writes parsed and cached */
+    /* For the life of the session. */
+    STAT_RECONNECTS,		/* automatic reconnects */
+    STAT_LOOPS,			/* event loop iterations */
+    STAT_WAIT_USEC,		/* time spent waiting for events */
+    STAT_ACTIONS,		/* actions run */
+    STAT_KYBD_LOCKS,		/* keyboard lock periods while connected */
+    STAT_KYBD_LOCK_USEC,	/* time the keyboard was locked */
+    STAT_ALLOCS,		/* memory allocations */
+    STAT_ALLOC_BYTES,		/* bytes allocated */
+    STAT_MAX
+} stat_t;
+#define STAT_CONNECTION_MAX	STAT_RECONNECTS
+
+extern uint64_t stats[STAT_MAX];
+#define stats_add(s, n)	(stats[s] += (n))
+#define stats_inc(s)	(stats[s]++)
+
 void stats_poke(void);
+void stats_reset(void);
+void stats_snapshot(uint64_t *snap);
+const char *stats_name(stat_t s);
+const char *stats_dump(void);
+const char *stats_metrics(void);
+void stats_register(void);
@@ -53,6 +53,8 @@ void push_keypad_action(char *);
 void push_macro(char *);
 void push_stack_macro(char *);
 bool task_active(void);
+bool task_pending(void);
+char *dump_screen_text(struct ea *buf, int rows, int cols, bool force_utf8);
 bool task_can_kbwait(void);
 void task_connect_wait(void);
 bool run_tasks(void);
@@ -65,6 +67,7 @@ void task_passthru_done(const char *tag, bool success, const char *result);
 bool task_redirect(void);
 const char *task_set_passthru(task_cbh **ret_cbh);
 void task_store(unsigned char c);
+void task_wakeup(void);
 void task_abort_input_request_irhandle(void *irhandle);
 void task_abort_input_request(void);
 bool task_is_interactive(void);
@@ -95,6 +98,7 @@ typedef bool (*task_need_delay_cb)(task_cbh handle);
 typedef const char *(*task_command_cb)(task_cbh handle);
 typedef void (*task_reqinput_cb)(task_cbh handle, const char *buf, size_t len,
 	bool echo);
+typedef bool (*task_observe_cb)(task_cbh handle, unsigned what, size_t limit);
 typedef struct {
     const char *shortname;
     enum iaction ia;
@@ -108,21 +112,26 @@ typedef struct {
     irv_t *irv;
     task_command_cb command;
     task_reqinput_cb reqinput;
+    task_observe_cb observe;
 } tcb_t;
 #define CB_UI		0x1	/* came from the UI */
 #define CB_NEEDS_RUN	0x2	/* needs its run method called */
 #define CB_NEW_TASKQ	0x4	/* creates a new task queue */
 #define CB_PEER		0x8	/* peer script (don't abort) */
+#define CB_FRAMING	0x10	/* can switch to the framed protocol */
 
 #define CBF_INTERACTIVE	0x1	/* settable: interactive (e.g., c3270 prompt) */
 #define CBF_CONNECT_NONBLOCK 0x2 /* do not block Connect()/Open() */
 #define CBF_PWINPUT	0x4	/* can do password (no echo) input */
+#define CBF_FRAMED	0x8	/* uses the framed protocol (CB_FRAMING only) */
 char *push_cb(const char *buf, size_t len, const tcb_t *cb,
 	task_cbh handle);
 void task_activate(task_cbh handle);
 void task_register(void);
 char *task_cb_prompt(task_cbh handle);
 unsigned long task_cb_msec(task_cbh handle);
+struct span;
+void task_cb_span(task_cbh handle, struct span *span);
 
 typedef bool continue_fn(void *, const char *);
 typedef void abort_fn(void *);
@@ -146,3 +155,5 @@ typedef void xcontinue_fn(void *context, bool cancel);
 void task_xwait(void *context, xcontinue_fn *continue_fn, const char *why);
 
 char *task_get_tasks(void);
+const char *task_get_usage(void);
+bool task_observe(unsigned what, size_t limit);
@@ -37,10 +37,6 @@
 # error "Do not include this file for pr3287"
 #endif /*]*/
 
-extern int ns_brcvd;
-extern int ns_bsent;
-extern int ns_rrcvd;
-extern int ns_rsent;
 extern time_t ns_time;
 extern const char *state_name[];
 extern struct timeval net_last_recv_ts;
@@ -79,6 +75,9 @@ const char *net_server_cert_info(void);
 const char *net_server_subject_names(void);
 const char *net_session_info(void);
 void net_password_continue(const char *password);
+const char *net_peer_address(void);
+void net_flush_output(void);
+void net_busy_poll(void);
 unsigned net_sio_supported(void);
 const char *net_sio_provider(void);
 const char *net_myopts(void);
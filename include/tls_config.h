@@ -46,6 +46,9 @@ typedef struct {
     char	*key_file_type;
     char	*key_passwd;
     char	*client_cert;
+    bool	 kernel_tls;
+    bool	 release_buffers;
+    int		 max_fragment;
 } tls_config_t;
 
 /* Required options. */
@@ -65,11 +68,15 @@ typedef struct {
 #define TLS_OPT_KEY_FILE_TYPE		0x00000200
 #define TLS_OPT_KEY_PASSWD		0x00000400
 #define TLS_OPT_CLIENT_CERT		0x00000800
+#define TLS_OPT_KERNEL_TLS		0x00001000
+#define TLS_OPT_RELEASE_BUFFERS		0x00002000
+#define TLS_OPT_MAX_FRAGMENT		0x00004000
 
 #define TLS_OPTIONAL_OPTS \
     (TLS_OPT_CA_DIR | TLS_OPT_CA_FILE | TLS_OPT_CERT_FILE | \
      TLS_OPT_CERT_FILE_TYPE | TLS_OPT_CHAIN_FILE | TLS_OPT_KEY_FILE | \
-     TLS_OPT_KEY_FILE_TYPE | TLS_OPT_KEY_PASSWD | TLS_OPT_CLIENT_CERT)
+     TLS_OPT_KEY_FILE_TYPE | TLS_OPT_KEY_PASSWD | TLS_OPT_CLIENT_CERT | \
+     TLS_OPT_KERNEL_TLS | TLS_OPT_RELEASE_BUFFERS | TLS_OPT_MAX_FRAGMENT)
 
 #define TLS_ALL_OPTS	(TLS_REQUIRED_OPTS | TLS_OPTIONAL_OPTS)
 
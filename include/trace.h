@@ -43,6 +43,9 @@ const char *rcba(int baddr);
 void trace_ds(const char *fmt, ...) printflike(1, 2);
 void vtrace(const char *fmt, ...) printflike(1, 2);
 void ntvtrace(const char *fmt, ...) printflike(1, 2);
+void trace_flush(void);
+bool trace_net_record(char direction, size_t len);
+void trace_net_append(const unsigned char *buf, size_t len);
 void trace_set_trace_file(const char *path);
 void trace_rollover_check(void);
 void tracefile_ok(const char *tfn);
@@ -50,3 +53,33 @@ void tracefile_ok(const char *tfn);
 const char *default_trace_dir(void);
 #endif
 void trace_register(void);
+
+/* Trace categories, selected with the traceCategories resource. */
+typedef enum {
+    TC_TELNET,	/* TELNET negotiation and network data */
+    TC_DS,	/* 3270 data stream */
+    TC_KYBD,	/* keyboard */
+    TC_TASK,	/* tasks and actions */
+    TC_HTTP,	/* HTTP server */
+    TC_OTHER,	/* everything else */
+    TC_COUNT
+} trace_category_t;
+#define TCM(c)		(1U << (c))
+#define TCM_ALL		(TCM(TC_COUNT) - 1)
+
+/* Mask of the categories being traced, or 0 if the trace file is closed. */
+extern unsigned trace_categories;
+#define TRACING_CATEGORY(c)	((trace_categories & TCM(c)) != 0)
+
+/*
+ * Trace calls skip evaluating their arguments when their category is not
+ * being traced.
+ */
+#define vtrace(...) \
+    (TRACING_CATEGORY(TC_OTHER)? vtrace(__VA_ARGS__): (void)0)
+#define vctrace(c, ...) \
+    (TRACING_CATEGORY(c)? (vtrace)(__VA_ARGS__): (void)0)
+#define ntvtrace(...) \
+    (trace_categories? ntvtrace(__VA_ARGS__): (void)0)
+#define trace_ds(...) \
+    (TRACING_CATEGORY(TC_DS)? trace_ds(__VA_ARGS__): (void)0)
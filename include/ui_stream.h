@@ -32,9 +32,23 @@
  *		UI data stream I/O.
  */
 
+void ui_attr(const char *tag, const char *value);
+void ui_attr_bool(const char *tag, bool value);
+void ui_attr_int(const char *tag, long value);
+void ui_attr_static(const char *tag, const char *value);
+void ui_begin(const char *name);
+void ui_end_leaf(void);
+void ui_end_push(void);
 void ui_io_init(void);
 void ui_leaf(const char *name, const char *args[]);
 void ui_pop(void);
 void ui_push(const char *name, const char *args[]);
 void ui_vleaf(const char *name, ...);
 void ui_vpush(const char *name, ...);
+
+/* Output the UI has subscribed to. */
+#define UI_SUB_SCREEN	0x1	/* screen contents, cursor and scrolling */
+#define UI_SUB_OIA	0x2	/* OIA fields */
+#define UI_SUB_STATS	0x4	/* statistics */
+extern unsigned ui_subscriptions;
+#define ui_subscribed(s)	((ui_subscriptions & (s)) != 0)
@@ -78,6 +78,8 @@ ebc_t multibyte_to_ebcdic(const char *mb, size_t mb_len, int *consumedp,
 int multibyte_to_ebcdic_string(char *mb, size_t mb_len, unsigned char *ebc,
 	size_t ebc_len, enum me_fail *errorp);
 int unicode_to_multibyte(ucs4_t ucs4, char *mb, size_t mb_len);
+size_t unicode_to_multibyte_string(const ucs4_t *ucs4, size_t u_len,
+	char *mb, size_t mb_len);
 int unicode_to_multibyte_f(ucs4_t ucs4, char *mb, size_t mb_len,
 	bool force_utf8);
 bool using_iconv(void);
@@ -36,4 +36,5 @@ extern bool is_utf8;
 void set_codeset(char *codeset_name, bool force_utf8);
 int unicode_to_utf8(ucs4_t ucs4, char *utf8);
 int utf8_to_unicode(const char *utf8, int len, ucs4_t *ucs4);
+size_t utf8_ascii_run(const char *s, size_t len);
 const char *get_codeset(void);
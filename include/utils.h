@@ -66,6 +66,8 @@ ioid_t AddChild(pid_t pid, childfn_t fn);
 #endif /*]*/
 void RemoveInput(ioid_t);
 ioid_t AddTimeOut(unsigned long msec, tofn_t);
+ioid_t AddTimeOutCoalesced(unsigned long msec, unsigned long slack_msec,
+	tofn_t);
 void RemoveTimeOut(ioid_t id);
 
 ks_t string_to_key(char *s);
@@ -246,9 +246,16 @@ usage(const char *msg)
     exit(1);
 }
 
-/* Do a single command, and interpret the results. */
+/*
+ * Do a single command, and interpret the results.
+ *
+ * If 'lines' is not NULL, each line of output is appended to it as a separate
+ * object, and '*ret' is left NULL. Otherwise the output is returned in '*ret',
+ * one line per newline.
+ */
 static int
-run_s3270(const char *cmd, bool *success, char **status, char **ret)
+run_s3270_lines(const char *cmd, size_t cmd_len, bool *success, char **status,
+	char **ret, Tcl_Obj *lines)
 {
     int st;
     int nw = 0;
@@ -257,9 +264,8 @@ run_s3270(const char *cmd, bool *success, char **status, char **ret)
     int sl = 0;
     ssize_t nr;
     bool complete = false;
-    char *cmd_nl;
     size_t ret_sl = 0;
-    char *nl;
+    size_t ret_max = 0;
     int rv = -1;
 
     *success = false;
@@ -298,21 +304,16 @@ run_s3270(const char *cmd, bool *success, char **status, char **ret)
 	goto done;
     }
 
-    /* Speak to s3270. */
+    /* Speak to s3270. The command is already terminated with a newline. */
     if (verbose) {
-	fprintf(stderr, "i+ out %s\n", (cmd != NULL) ? cmd : "");
+	fprintf(stderr, "i+ out %.*s\n", (int)(cmd_len - 1), cmd);
     }
 
-    cmd_nl = Malloc(strlen(cmd) + 2);
-    sprintf(cmd_nl, "%s\n", cmd);
-
-    nw = write(s3270pipe[1], cmd_nl, strlen(cmd_nl));
+    nw = write(s3270pipe[1], cmd, cmd_len);
     if (nw < 0) {
 	perror("s3270 (back end): write");
-	Free(cmd_nl);
 	goto done;
     }
-    Free(cmd_nl);
 
     /* Get the answer. */
     while (!complete && (nr = read(s3270pipe[0], rbuf, IBS)) > 0) {
@@ -350,11 +351,23 @@ run_s3270(const char *cmd, bool *success, char **status, char **ret)
 		complete = true;
 		break;
 	    } else if (!strncmp(buf, DATA_PREFIX, strlen(DATA_PREFIX))) {
-		*ret = Realloc(*ret, ret_sl + strlen(buf +
-			    strlen(DATA_PREFIX)) + 2);
-		*(*ret + ret_sl) = '\0';
-		strcat(strcat(*ret, buf + strlen(DATA_PREFIX)), "\n");
-		ret_sl += strlen(buf + strlen(DATA_PREFIX)) + 1;
+		const char *data = buf + strlen(DATA_PREFIX);
+		size_t data_len = sl - strlen(DATA_PREFIX);
+
+		if (lines != NULL) {
+		    Tcl_ListObjAppendElement(NULL, lines,
+			    Tcl_NewStringObj(data, (int)data_len));
+		} else {
+		    /* Grow geometrically, so long output is copied once. */
+		    if (ret_sl + data_len + 2 > ret_max) {
+			ret_max = 2 * (ret_sl + data_len + 2);
+			*ret = Realloc(*ret, ret_max);
+		    }
+		    memcpy(*ret + ret_sl, data, data_len);
+		    ret_sl += data_len;
+		    (*ret)[ret_sl++] = '\n';
+		    (*ret)[ret_sl] = '\0';
+		}
 	    } else if (status != NULL) {
 		*status = NewString(buf);
 	    }
@@ -386,14 +399,16 @@ run_s3270(const char *cmd, bool *success, char **status, char **ret)
 	exit(0);
     }
 
-    /* Make sure we return someting. */
-    if (*ret == NULL) {
-	*ret = NewString("");
-    }
+    if (lines == NULL) {
+	/* Make sure we return someting. */
+	if (*ret == NULL) {
+	    *ret = NewString("");
+	}
 
-    /* Remove any trailing newline. */
-    if ((nl = strrchr(*ret, '\n')) != NULL && !*(nl + 1)) {
-	*nl = '\0';
+	/* Remove any trailing newline. */
+	if (ret_sl > 0 && (*ret)[ret_sl - 1] == '\n') {
+	    (*ret)[ret_sl - 1] = '\0';
+	}
     }
 
     rv = 0;
@@ -404,6 +419,22 @@ done:
     return rv;
 }
 
+/* Do a single command, and return the results as a string. */
+static int
+run_s3270(const char *cmd, bool *success, char **status, char **ret)
+{
+    size_t len = strlen(cmd);
+    char *cmd_nl = Malloc(len + 2);
+    int rv;
+
+    memcpy(cmd_nl, cmd, len);
+    cmd_nl[len++] = '\n';
+    cmd_nl[len] = '\0';
+    rv = run_s3270_lines(cmd_nl, len, success, status, ret, NULL);
+    Free(cmd_nl);
+    return rv;
+}
+
 /* Initialization procedure for tcl3270. */
 static int
 tcl3270_main(Tcl_Interp *interp, int argc, const char *argv[])
@@ -569,152 +600,173 @@ tcl3270_main(Tcl_Interp *interp, int argc, const char *argv[])
     return TCL_OK;
 }
 
-/* Quote a string according to Xt event map argument syntax. */
-static char *
-quoted(const char *arg)
+/*
+ * Append an argument to a command, quoted according to Xt event map argument
+ * syntax.
+ * Returns false if the argument contains a control character.
+ */
+static bool
+append_quoted(char **cmd, size_t *len, size_t *max, bool comma,
+	const char *arg, size_t arg_len)
 {
-    static char quoted_chars[] = " ,()";
-    int i;
-    bool needed = false;
-    char *ret;
+    size_t i;
+    bool needed = (arg_len == 0 || arg[0] == '"');
     char *out;
-    char c;
-    char last = '\0';
-
-    if (!*arg) {
-	/* Empty string -> quoted. */
-	return NewString("\"\"");
-    }
 
     /*
-     * Check if it contains a character that triggers requires quoting,
-     * or starts with a '"'.
+     * Check for control characters, and for characters that require
+     * quoting.
      */
-    for (i = 0; quoted_chars[i]; i++) {
-	if (strchr(arg, quoted_chars[i]) != NULL) {
+    for (i = 0; i < arg_len; i++) {
+	unsigned char uc = (unsigned char)arg[i];
+
+	if (uc < ' ' || (uc >= 0x80 && (uc & 0x7f) < ' ')) {
+	    return false;
+	}
+	if (uc == ' ' || uc == ',' || uc == '(' || uc == ')') {
 	    needed = true;
-	    break;
 	}
     }
-    if (!needed && arg[0] != '"') {
-	return NewString(arg);
-    }
 
     /*
-     * Replace double quotes with a backslash and a double quote.
-     * Replace a backslash at the end with a double backslash.
-     * Wrap the whole thing in double quotes.
-     */
-
-    /*
-     * Allocate enough memory for:
+     * Make sure there is room for:
+     *  a separating comma
      *  opening double quote
      *  every character needing a backslash in front of it
      *  trailing backslash needing to be doubled
      *  trailing double quote
-     *  terminating NUL
+     *  closing paren, newline and terminating NUL
+     */
+    if (*len + 1 + 1 + (arg_len * 2) + 1 + 1 + 3 > *max) {
+	*max = 2 * (*len + 1 + 1 + (arg_len * 2) + 1 + 1 + 3);
+	*cmd = Realloc(*cmd, *max);
+    }
+    out = *cmd + *len;
+    if (comma) {
+	*out++ = ',';
+	(*len)++;
+    }
+
+    if (!needed) {
+	memcpy(out, arg, arg_len);
+	*len += arg_len;
+	return true;
+    }
+
+    /*
+     * Replace double quotes with a backslash and a double quote.
+     * Replace a backslash at the end with a double backslash.
+     * Wrap the whole thing in double quotes.
      */
-    ret = out = Malloc(1 + (strlen(arg) * 2) + 1 + 1 + 1);
     *out++ = '"';
-    while ((c = *arg++)) {
-	last = c;
-	if (c == '"') {
+    for (i = 0; i < arg_len; i++) {
+	if (arg[i] == '"') {
 	    *out++ = '\\';
 	}
-	*out++ = c;
+	*out++ = arg[i];
     }
-    if (last == '\\') {
+    if (arg_len > 0 && arg[arg_len - 1] == '\\') {
 	*out++ = '\\';
     }
     *out++ = '"';
-    *out = '\0';
-    return ret;
+    *len = out - *cmd;
+    return true;
 }
 
-/* The Tcl "x3270" command: The root of all 3270 access. */
+/*
+ * The Tcl "x3270" command: The root of all 3270 access.
+ *
+ * The command is built in a buffer that is kept between calls, and the output
+ * lines are appended directly to the result list, so a call does not copy its
+ * output or allocate anything of its own in the common case.
+ */
 static int
 x3270_cmd(ClientData clientData, Tcl_Interp *interp, int objc,
 	Tcl_Obj *CONST objv[])
 {
-    int i;
+    static char *cmd = NULL;
+    static size_t max = 0;
     size_t len = 0;
-    char *cmd;
+    int i;
     bool success;
     int rv;
     char *ret;
-    char *rest;
-    char *nl;
-    Tcl_Obj *o = NULL;
-
-    /* Check for control characters. */
-    for (i = 0; i < objc; i++) {
-	char *s = Tcl_GetString(objv[i]);
-	char c;
-
-	while ((c = *s++) != '\0') {
-	    unsigned char uc = (unsigned char)c;
-
-	    if (uc < ' ' || (uc >= 0x80 && (uc & 0x7f) < ' ')) {
-		Tcl_SetResult(interp, "Control character in parameter",
-			TCL_STATIC);
-		return TCL_ERROR;
-	    }
-	}
-    }
+    Tcl_Obj *o;
+    int n;
 
     /* Marshal the arguments. */
     for (i = 0; i < objc; i++) {
-	len += 1 + 2 * strlen(Tcl_GetString(objv[i]));
-    }
-    len += 3; /* parens and trailing NUL */
-    cmd = Malloc(len);
-    strcpy(cmd, Tcl_GetString(objv[0]));
-    strcat(cmd, "(");
-    for (i = 1; i < objc; i++) {
-	char *q;
+	int arg_len;
+	const char *arg = Tcl_GetStringFromObj(objv[i], &arg_len);
 
-	if (i > 1) {
-	    strcat(cmd, ",");
+	if (i == 0) {
+	    if (len + arg_len + 4 > max) {
+		max = 2 * (len + arg_len + 4);
+		cmd = Realloc(cmd, max);
+	    }
+	    memcpy(cmd, arg, arg_len);
+	    len = arg_len;
+	    cmd[len++] = '(';
+	} else if (!append_quoted(&cmd, &len, &max, i > 1, arg,
+		    (size_t)arg_len)) {
+	    Tcl_SetResult(interp, "Control character in parameter",
+		    TCL_STATIC);
+	    return TCL_ERROR;
 	}
-	q = quoted(Tcl_GetString(objv[i]));
-	strcat(cmd, q);
-	Free(q);
     }
-    strcat(cmd, ")");
+    cmd[len++] = ')';
+    cmd[len++] = '\n';
+    cmd[len] = '\0';
 
     /* Run the action. */
-    rv = run_s3270(cmd, &success, NULL, &ret);
+    o = Tcl_NewListObj(0, NULL);
+    Tcl_IncrRefCount(o);
+    rv = run_s3270_lines(cmd, len, &success, NULL, &ret, o);
     if (rv < 0) {
-	Free(cmd);
+	Tcl_DecrRefCount(o);
 	Tcl_SetResult(interp, "Internal error", TCL_STATIC);
 	return TCL_ERROR;
     }
-
-    Free(cmd);
-    if (!success) {
+    if (ret != NULL) {
+	/* s3270 has exited. */
+	Tcl_DecrRefCount(o);
 	Tcl_SetResult(interp, ret, TCL_VOLATILE);
 	Free(ret);
 	return TCL_ERROR;
     }
 
-    /* If the output is on one line, return it as a string. */
-    if (strchr(ret, '\n') == NULL) {
-	Tcl_SetResult(interp, ret, TCL_VOLATILE);
-	Free(ret);
-	return TCL_OK;
+    Tcl_ListObjLength(NULL, o, &n);
+    if (!success) {
+	Tcl_Obj **elts;
+	Tcl_Obj *msg = Tcl_NewObj();
+
+	/* Return the error text as a string, one line per newline. */
+	Tcl_ListObjGetElements(NULL, o, &n, &elts);
+	for (i = 0; i < n; i++) {
+	    if (i) {
+		Tcl_AppendToObj(msg, "\n", 1);
+	    }
+	    Tcl_AppendObjToObj(msg, elts[i]);
+	}
+	Tcl_SetObjResult(interp, msg);
+	Tcl_DecrRefCount(o);
+	return TCL_ERROR;
     }
 
-    /* Return it as a list. */
-    o = Tcl_NewListObj(0, NULL);
-    rest = ret;
-    while ((nl = strchr(rest, '\n')) != NULL) {
-	*nl = '\0';
-	Tcl_ListObjAppendElement(interp, o, Tcl_NewStringObj(rest, -1));
-	rest = nl + 1;
-    }
-    Tcl_ListObjAppendElement(interp, o, Tcl_NewStringObj(rest, -1));
-    Tcl_SetObjResult(interp, o);
-    Free(ret);
+    if (n == 0) {
+	/* No output. */
+	Tcl_ResetResult(interp);
+    } else if (n == 1) {
+	/* If the output is on one line, return it as a string. */
+	Tcl_Obj *elt;
+
+	Tcl_ListObjIndex(NULL, o, 0, &elt);
+	Tcl_SetObjResult(interp, elt);
+    } else {
+	/* Return it as a list. */
+	Tcl_SetObjResult(interp, o);
+    }
+    Tcl_DecrRefCount(o);
     return TCL_OK;
 }
 
@@ -81,6 +81,23 @@ struct keymap {
 
 static struct keymap *master_keymap = NULL;
 
+/*
+ * Prefix trie of the active keymap entries, rebuilt by set_inactive().
+ * Each node is reached by one key code and modifier hint from its parent.
+ */
+struct knode {
+    int code;			/* key code that leads here */
+    int hint;			/* modifier hint (KM_HINTS) for the code */
+    struct keymap *match;	/* entry whose codes end here, or NULL */
+    struct keymap *shortest;	/* shortest entry through or ending here */
+    int order;			/* master_keymap position of 'shortest' */
+    struct keymap *longer;	/* shortest entry continuing past here */
+    int entries;		/* number of entries through or ending here */
+    struct knode *children;	/* first child */
+    struct knode *sibling;	/* next sibling */
+};
+static struct knode *trie = NULL;
+
 static bool last_3270 = false;
 static bool last_nvt = false;
 
@@ -594,30 +611,70 @@ read_one_keymap(const char *name, const char *fn, bool temp, const char *r0,
 
 /* Multi-key keymap support. */
 static struct keymap *current_match = NULL;
-static int consumed = 0;
+static struct knode *current_node = NULL;
 static char *ignore = "[ignore]";
 
-/* Find the shortest keymap with a longer match than k. */
-static struct keymap *
-longer_match(struct keymap *k, int nc)
+/* Free a trie. */
+static void
+free_trie(struct knode *n)
 {
-    struct keymap *j;
-    struct keymap *shortest = NULL;
+    while (n != NULL) {
+	struct knode *next = n->sibling;
 
-    for (j = master_keymap; j != NULL; j = j->next) {
-	if (IS_INACTIVE(j)) {
+	free_trie(n->children);
+	Free(n);
+	n = next;
+    }
+}
+
+/* Build the trie from the active entries in master_keymap. */
+static void
+build_trie(void)
+{
+    struct keymap *k;
+    int order = 0;
+
+    free_trie(trie);
+    trie = (struct knode *)Calloc(1, sizeof(struct knode));
+
+    for (k = master_keymap; k != NULL; k = k->next, order++) {
+	struct knode *n = trie;
+	int i;
+
+	if (IS_INACTIVE(k)) {
 	    continue;
 	}
-	if (j != k && j->ncodes > nc && !codecmp(j, k, nc)) {
-	    if (j->ncodes == nc+1) {
-		return j;
+	for (i = 0; i < k->ncodes; i++) {
+	    int hint = k->hints[i] & KM_HINTS;
+	    struct knode **cp;
+
+	    if (n->longer == NULL || k->ncodes < n->longer->ncodes) {
+		n->longer = k;
 	    }
-	    if (shortest == NULL || j->ncodes < shortest->ncodes) {
-		shortest = j;
+
+	    /* Find or add the child for this code. */
+	    for (cp = &n->children; *cp != NULL; cp = &(*cp)->sibling) {
+		if ((*cp)->code == k->codes[i] && (*cp)->hint == hint) {
+		    break;
+		}
+	    }
+	    if (*cp == NULL) {
+		*cp = (struct knode *)Calloc(1, sizeof(struct knode));
+		(*cp)->code = k->codes[i];
+		(*cp)->hint = hint;
+	    }
+	    n = *cp;
+
+	    n->entries++;
+	    if (n->shortest == NULL || k->ncodes < n->shortest->ncodes) {
+		n->shortest = k;
+		n->order = order;
 	    }
 	}
+	if (n->match == NULL) {
+	    n->match = k;
+	}
     }
-    return shortest;
 }
 
 /*
@@ -625,15 +682,15 @@ longer_match(struct keymap *k, int nc)
  * traces the result.  
  *
  * If s is NULL, then this is a failed initial lookup.
- * If s is 'ignore', then this is a lookup in progress (k non-NULL) or a
- *  failed multi-key lookup (k NULL).
+ * If s is 'ignore', then this is a lookup in progress (n non-NULL) or a
+ *  failed multi-key lookup (n NULL).
  * Otherwise, this is a successful lookup.
  */
 static char *
-status_ret(char *s, struct keymap *k)
+status_ret(char *s, struct knode *n)
 {
-    /* Set the compose indicator based on the new value of current_match. */
-    if (k != NULL) {
+    /* Set the compose indicator based on the new value of current_node. */
+    if (n != NULL) {
 	vstatus_compose(true, ' ', KT_STD);
     } else {
 	vstatus_compose(false, 0, KT_STD);
@@ -642,9 +699,7 @@ status_ret(char *s, struct keymap *k)
     if (s != NULL && s != ignore) {
 	vtrace(" %s:%d -> %s\n", current_match->file, current_match->line, s);
     }
-    if ((current_match = k) == NULL) {
-	consumed = 0;
-    }
+    current_node = n;
     return s;
 }
 
@@ -662,20 +717,6 @@ key_timeout(ioid_t id _is_unused)
     timeout_match = NULL;
 }
 
-static struct keymap *
-ambiguous(struct keymap *k, int nc)
-{
-    struct keymap *j;
-
-    if ((j = longer_match(k, nc)) != NULL) {
-	vtrace(" ambiguous keymap match, shortest is %s:%d, setting timeout\n",
-		j->file, j->line);
-	timeout_match = k;
-	kto = AddTimeOut(500L, key_timeout);
-    }
-    return j;
-}
-
 /*
  * Check for compatability between a keymap and a key's modifier state.
  * Returns 1 for success, 0 for failure.
@@ -717,17 +758,40 @@ compatible_hint(int hint, int state)
     return (h & s) == h;
 }
 
+/*
+ * Find the child of a trie node that matches a key code and modifier state.
+ * If more than one does, take the one with the shortest entry, and the
+ * earliest in the keymap if there is a tie.
+ */
+static struct knode *
+child_match(struct knode *n, unsigned long code, int state_match)
+{
+    struct knode *c;
+    struct knode *best = NULL;
+
+    for (c = n->children; c != NULL; c = c->sibling) {
+	if ((unsigned long)c->code == code &&
+		compatible_hint(c->hint, state_match) &&
+		(best == NULL ||
+		 c->shortest->ncodes < best->shortest->ncodes ||
+		 (c->shortest->ncodes == best->shortest->ncodes &&
+		  c->order < best->order))) {
+	    best = c;
+	}
+    }
+    return best;
+}
+
 /*
  * Look up an key in the keymap, return the matching action if there is one.
  *
  * This code implements the mutli-key lookup, by returning dummy actions for
- * partial matches.
+ * partial matches. Each key advances one node in the trie.
  */
 char *
 lookup_key(unsigned long code, unsigned long state)
 {
-    struct keymap *j, *k;
-    int n_shortest = 0;
+    struct knode *n;
     int state_match = 0;
 
     vtrace("lookup_key(0x%08lx, 0x%lx)\n", code, state);
@@ -759,83 +823,44 @@ lookup_key(unsigned long code, unsigned long state)
 	state_match |= KM_ENHANCED;
     }
 
-    /* If there's no match pending, find the shortest one. */
-    if (current_match == NULL) {
-	struct keymap *shortest = NULL;
+    if (trie == NULL) {
+	return NULL;
+    }
 
-	for (k = master_keymap; k != NULL; k = k->next) {
-	    if (IS_INACTIVE(k)) {
-		continue;
-	    }
-	    if (code == k->codes[0] &&
-		    compatible_hint(k->hints[0], state_match)) {
-		if (k->ncodes == 1) {
-		    shortest = k;
-		    break;
-		}
-		if (shortest == NULL || k->ncodes < shortest->ncodes) {
-		    shortest = k;
-		    n_shortest++;
-		}
-	    }
-	}
-	if (shortest != NULL) {
-	    current_match = shortest;
-	    consumed = 0;
-	} else {
+    /* See if this key leads anywhere from where we are. */
+    n = child_match((current_node != NULL)? current_node: trie, code,
+	    state_match);
+    if (n == NULL) {
+	if (current_node == NULL) {
 	    return NULL;
 	}
+
+	/* Complain. */
+	Beep(750, 150);
+	vtrace(" keymap lookup failure after partial match\n");
+	return status_ret(ignore, NULL);
     }
 
-    /* See if this character matches the next one we want. */
-    if (code == current_match->codes[consumed] &&
-	    compatible_hint(current_match->hints[consumed], state_match)) {
-	consumed++;
-	if (consumed == current_match->ncodes) {
+    if (n->match != NULL) {
+	current_match = n->match;
+	if (n->children == NULL) {
 	    /* Final match. */
-	    j = ambiguous(current_match, consumed);
-	    if (j == NULL) {
-		return status_ret(current_match->action, NULL);
-	    } else {
-		return status_ret(ignore, j);
-	    }
-	} else {
-	    /* Keep looking. */
-	    vtrace(" partial keymap match in %s:%d %s\n",
-		current_match->file, current_match->line,
-		(n_shortest > 1)? " and other(s)": "");
-	    return status_ret(ignore, current_match);
+	    return status_ret(n->match->action, NULL);
 	}
-    }
 
-    /* It doesn't.  Try for a better candidate. */
-    for (k = master_keymap; k != NULL; k = k->next) {
-	if (IS_INACTIVE(k))
-	    continue;
-	if (k == current_match)
-	    continue;
-	if (k->ncodes > consumed && !codecmp(k, current_match, consumed) &&
-		k->codes[consumed] == code &&
-		compatible_hint(k->hints[consumed], state_match)) {
-	    consumed++;
-	    if (k->ncodes == consumed) {
-		j = ambiguous(k, consumed);
-		if (j == NULL) {
-		    current_match = k;
-		    return status_ret(k->action, NULL);
-		} else {
-		    return status_ret(ignore, j);
-		}
-	    } else {
-		return status_ret(ignore, k);
-	    }
-	}
+	/* Ambiguous: wait a while for a longer match. */
+	vtrace(" ambiguous keymap match, shortest is %s:%d, setting timeout\n",
+		n->longer->file, n->longer->line);
+	timeout_match = n->match;
+	kto = AddTimeOut(500L, key_timeout);
+	return status_ret(ignore, n);
     }
 
-    /* Complain. */
-    Beep(750, 150);
-    vtrace(" keymap lookup failure after partial match\n");
-    return status_ret(ignore, NULL);
+    /* Keep looking. */
+    vtrace(" partial keymap match in %s:%d %s\n",
+	n->shortest->file, n->shortest->line,
+	(n->entries > 1)? " and other(s)": "");
+    return status_ret(ignore, n);
 }
 
 static struct {
@@ -1113,6 +1138,9 @@ clear_keymap(void)
 	free_keymap(k);
     }
     master_keymap = NULL;
+    free_trie(trie);
+    trie = NULL;
+    current_node = NULL;
 }
 
 /* Set the inactive flags for the current keymap. */
@@ -1152,6 +1180,15 @@ set_inactive(void)
 	    }
 	}
     }
+
+    /* Rebuild the trie, abandoning any multi-key match in progress. */
+    if (kto != NULL_IOID) {
+	RemoveTimeOut(kto);
+	kto = NULL_IOID;
+	timeout_match = NULL;
+    }
+    current_node = NULL;
+    build_trie();
 }
 
 /* 3270/NVT mode change. */
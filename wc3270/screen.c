@@ -57,6 +57,7 @@
 #include "screen.h"
 #include "see.h"
 #include "selectc.h"
+#include "startup.h"
 #include "status.h"
 #include "task.h"
 #include "telnet.h"
@@ -75,6 +76,8 @@
 #define STATUS_SCROLL_START_MS	1500
 #define STATUS_SCROLL_MS	100
 #define STATUS_PUSH_MS		5000
+#define BLINK_SLACK_MS		50
+#define KYBD_BATCH_MAX		256	/* most console records read at once */
 
 #define CM (60*10)	/* csec per minute */
 
@@ -882,12 +885,35 @@ hdraw(int row, int lrow, int col, int lcol)
     mark_done(row, lrow, col, lcol);
 }
 
+/*
+ * Check a rectangular region of 'toscreen' for anything that keeps it from
+ * being written with a single WriteConsoleOutputW call: cells that have
+ * already been drawn, or DBCS characters, which are written as pairs.
+ */
+static bool
+rect_is_plain(int pc_start, int pc_end, int pr_start, int pr_end)
+{
+    int row, col;
+
+    for (row = pr_start; row <= pr_end; row++) {
+	for (col = pc_start; col <= pc_end; col++) {
+	    if (is_done(row, col) ||
+		    (tos_a(row, col) &
+		     (COMMON_LVB_LEAD_BYTE | COMMON_LVB_TRAILING_BYTE))) {
+		return false;
+	    }
+	}
+    }
+    return true;
+}
+
 /*
  * Draw a rectanglar region from 'toscreen' onto the screen, without regard to
  * what is already there.
- * If the attributes for the entire region are the same, we can draw it in
- * one go; otherwise we will need to break it into little pieces (fairly
- * stupidly) with common attributes.
+ * WriteConsoleOutputW takes the attributes of each cell along with its text,
+ * so unless the region contains DBCS characters, we can draw it in one go;
+ * otherwise we will need to break it into little pieces (fairly stupidly)
+ * with common attributes.
  * When done, copy the region from 'toscreen' to 'onscreen'.
  */
 static void
@@ -924,6 +950,12 @@ draw_rect(const char *why, int pc_start, int pc_end, int pr_start, int pr_end)
     }
 #endif /*]*/
 
+    /* Each console call is expensive, so draw it all at once if we can. */
+    if (rect_is_plain(pc_start, pc_end, pr_start, pr_end)) {
+	hdraw(pr_start, pr_end, pc_start, pc_end);
+	return;
+    }
+
     for (ul_row = pr_start; ul_row <= pr_end; ul_row++) {
 	for (ul_col = pc_start; ul_col <= pc_end; ul_col++) {
 	    int col_found = 0;
@@ -1131,7 +1163,7 @@ refresh(void)
     /* Start blinking again. */
     if (blink_wasticking) {
 	blink_wasticking = false;
-	blink_id = AddTimeOut(750, blink_em);
+	blink_id = AddTimeOutCoalesced(750, BLINK_SLACK_MS, blink_em);
     }
 }
 
@@ -1749,7 +1781,7 @@ blinkmap(bool blinking, bool underlined, ucs4_t c)
 	return c;
     }
     if (!blink_ticking) {
-	blink_id = AddTimeOut(500, blink_em);
+	blink_id = AddTimeOutCoalesced(500, BLINK_SLACK_MS, blink_em);
 	blink_ticking = true;
     }
     return blink_on? c: (underlined? '_': ' ');
@@ -2120,6 +2152,7 @@ screen_disp(bool erasing _is_unused)
 		cursor_addr % cCOLS);
     }
     refresh();
+    startup_mark(STARTUP_SCREEN);
 
     screen_changed = false;
 }
@@ -2395,27 +2428,18 @@ decode_mflags(DWORD flags, decode_t names[])
     return lazya(vb_consume(&r));
 }
 
-/* Keyboard input. */
-static void
-kybd_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
+/*
+ * Process one console input record.
+ * Returns true if the screen needs to be redrawn.
+ */
+static bool
+kybd_input_record(INPUT_RECORD *ir)
 {
-    int rc;
-    INPUT_RECORD ir;
-    DWORD nr;
     const char *s;
 
-    /* Get the next input event. */
-    rc = ReadConsoleInputW(chandle, &ir, 1, &nr);
-    if (rc == 0) {
-	win32_perror_fatal("ReadConsoleInput failed");
-    }
-    if (nr == 0) {
-	return;
-    }
-
-    switch (ir.EventType) {
+    switch (ir->EventType) {
     case FOCUS_EVENT:
-	vtrace("Focus %s\n", ir.Event.FocusEvent.bSetFocus? "set": "unset");
+	vtrace("Focus %s\n", ir->Event.FocusEvent.bSetFocus? "set": "unset");
 	/*
 	 * When we get a focus event, the system may have (incorrectly) redrawn
 	 * our window.  Do it again ourselves.
@@ -2423,30 +2447,26 @@ kybd_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
 	 * We also want to redraw to get the crosshair cursor to appear or
 	 * disappear.
 	 */
-	in_focus = (ir.Event.FocusEvent.bSetFocus == TRUE);
+	in_focus = (ir->Event.FocusEvent.bSetFocus == TRUE);
 	screen_changed = true;
-	screen_disp(false);
-	break;
+	return true;
     case KEY_EVENT:
-	if (!ir.Event.KeyEvent.bKeyDown) {
-	    return;
+	if (!ir->Event.KeyEvent.bKeyDown) {
+	    break;
 	}
-	s = lookup_cname(ir.Event.KeyEvent.wVirtualKeyCode << 16);
+	s = lookup_cname(ir->Event.KeyEvent.wVirtualKeyCode << 16);
 	if (s == NULL) {
 	    s = "?";
 	}
 	vtrace("Key%s vkey 0x%x (%s) scan 0x%x char U+%04x state 0x%x (%s)\n",
-		ir.Event.KeyEvent.bKeyDown? "Down": "Up",
-		ir.Event.KeyEvent.wVirtualKeyCode, s,
-		ir.Event.KeyEvent.wVirtualScanCode,
-		ir.Event.KeyEvent.uChar.UnicodeChar,
-		(int)ir.Event.KeyEvent.dwControlKeyState,
-		decode_state(ir.Event.KeyEvent.dwControlKeyState, false,
+		ir->Event.KeyEvent.bKeyDown? "Down": "Up",
+		ir->Event.KeyEvent.wVirtualKeyCode, s,
+		ir->Event.KeyEvent.wVirtualScanCode,
+		ir->Event.KeyEvent.uChar.UnicodeChar,
+		(int)ir->Event.KeyEvent.dwControlKeyState,
+		decode_state(ir->Event.KeyEvent.dwControlKeyState, false,
 		    NULL));
-	if (!ir.Event.KeyEvent.bKeyDown) {
-	    return;
-	}
-	kybd_input2(&ir);
+	kybd_input2(ir);
 	break;
     case MENU_EVENT:
 	vtrace("Menu\n");
@@ -2454,23 +2474,68 @@ kybd_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
     case MOUSE_EVENT:
 	vtrace("Mouse (%d,%d) ButtonState %s "
 		"ControlKeyState %s EventFlags %s\n",
-		ir.Event.MouseEvent.dwMousePosition.X,
-		ir.Event.MouseEvent.dwMousePosition.Y,
-		decode_mflags(ir.Event.MouseEvent.dwButtonState,
+		ir->Event.MouseEvent.dwMousePosition.X,
+		ir->Event.MouseEvent.dwMousePosition.Y,
+		decode_mflags(ir->Event.MouseEvent.dwButtonState,
 		    decode_button_state),
-		decode_mflags(ir.Event.MouseEvent.dwControlKeyState,
+		decode_mflags(ir->Event.MouseEvent.dwControlKeyState,
 		    decode_control_key_state),
-		decode_mflags(ir.Event.MouseEvent.dwEventFlags,
+		decode_mflags(ir->Event.MouseEvent.dwEventFlags,
 		    decode_event_flags));
-	handle_mouse_event(&ir.Event.MouseEvent);
+	handle_mouse_event(&ir->Event.MouseEvent);
 	break;
     case WINDOW_BUFFER_SIZE_EVENT:
 	vtrace("WindowBufferSize\n");
 	break;
     default:
-	vtrace("Unknown input event %d\n", ir.EventType);
+	vtrace("Unknown input event %d\n", ir->EventType);
 	break;
     }
+    return false;
+}
+
+/*
+ * Keyboard input.
+ * All of the pending records are read at once, so a paste or a burst of
+ * typing is handled in one wakeup, with at most one redraw at the end.
+ */
+static void
+kybd_input(iosrc_t fd _is_unused, ioid_t id _is_unused)
+{
+    static INPUT_RECORD *irs = NULL;
+    static DWORD irs_size = 0;
+    DWORD avail = 0;
+    DWORD nr;
+    DWORD i;
+    bool redraw = false;
+
+    /* Size the buffer for everything that is waiting. */
+    if (!GetNumberOfConsoleInputEvents(chandle, &avail) || avail == 0) {
+	avail = 1;
+    }
+    if (avail > KYBD_BATCH_MAX) {
+	avail = KYBD_BATCH_MAX;
+    }
+    if (avail > irs_size) {
+	irs_size = avail;
+	irs = (INPUT_RECORD *)Realloc(irs, irs_size * sizeof(INPUT_RECORD));
+    }
+
+    /* Get the input events. */
+    if (ReadConsoleInputW(chandle, irs, avail, &nr) == 0) {
+	win32_perror_fatal("ReadConsoleInput failed");
+    }
+    if (nr > 1) {
+	vtrace("Console input: %u records\n", (unsigned)nr);
+    }
+    for (i = 0; i < nr; i++) {
+	if (kybd_input_record(&irs[i])) {
+	    redraw = true;
+	}
+    }
+    if (redraw) {
+	screen_disp(false);
+    }
 }
 
 static void
@@ -36,6 +36,8 @@
 #include "globals.h"
 #include "xglobals.h"
 
+#include <inttypes.h>
+
 #include <X11/Shell.h>
 #include <X11/StringDefs.h>
 #include <X11/Xaw/Command.h>
@@ -53,6 +55,7 @@
 #include "linemode.h"
 #include "popups.h"
 #include "split_host.h"
+#include "stats.h"
 #include "telnet.h"
 #include "utf8.h"
 #include "utils.h"
@@ -660,24 +663,25 @@ popup_about_status(void)
 	}
 
 	if (IN_3270) {
-	    fbuf = lazyaf("%s %d %s, %d %s\n%s %d %s, %d %s",
+	    fbuf = lazyaf("%s %" PRIu64 " %s, %" PRIu64 " %s\n"
+		    "%s %" PRIu64 " %s, %" PRIu64 " %s",
 		    get_message("sent"),
-		    ns_bsent, (ns_bsent == 1)?
+		    stats[STAT_BYTES_TX], (stats[STAT_BYTES_TX] == 1)?
 			get_message("byte"): get_message("bytes"),
-			ns_rsent, (ns_rsent == 1)?
+			stats[STAT_RECORDS_TX], (stats[STAT_RECORDS_TX] == 1)?
 		    get_message("record"): get_message("records"),
 		    get_message("Received"),
-		    ns_brcvd, (ns_brcvd == 1)?
+		    stats[STAT_BYTES_RX], (stats[STAT_BYTES_RX] == 1)?
 			get_message("byte"): get_message("bytes"),
-		    ns_rrcvd, (ns_rrcvd == 1)?
+		    stats[STAT_RECORDS_RX], (stats[STAT_RECORDS_RX] == 1)?
 			get_message("record"): get_message("records"));
 	} else {
-	    fbuf = lazyaf("%s %d %s, %s %d %s",
+	    fbuf = lazyaf("%s %" PRIu64 " %s, %s %" PRIu64 " %s",
 		    get_message("sent"),
-		    ns_bsent, (ns_bsent == 1)?
+		    stats[STAT_BYTES_TX], (stats[STAT_BYTES_TX] == 1)?
 			get_message("byte"): get_message("bytes"),
 		    get_message("received"),
-		    ns_brcvd, (ns_brcvd == 1)?
+		    stats[STAT_BYTES_RX], (stats[STAT_BYTES_RX] == 1)?
 			get_message("byte"): get_message("bytes"));
 	}
 	MAKE_LABEL(fbuf, 4);
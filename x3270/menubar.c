@@ -97,6 +97,8 @@ static Widget  *scheme_widgets;
 static Widget file_menu;
 static Widget options_menu;
 static Widget fonts_option;
+static Widget codepage_option;
+static bool options_deferred = false;
 static Pixel fm_background = 0;
 static Dimension fm_borderWidth;
 static Pixel fm_borderColor;
@@ -117,6 +119,8 @@ static Widget  *codepage_widgets;
 static void scheme_init(void);
 static void codepages_init(void);
 static void options_menu_init(bool regen, Position x, Position y);
+static void options_menu_popup(Widget w, XtPointer client_data,
+	XtPointer call_data);
 static void keypad_button_init(Position x, Position y);
 static void tls_icon_init(Position x, Position y);
 static void connect_menu_init(bool regen, Position x, Position y);
@@ -2021,11 +2025,18 @@ menubar_codepage(bool ignored _is_unused)
     struct codepage *s;
     const char *cpname;
 
-    if (!xappres.suppress_font_menu) {
+    if (options_deferred) {
+	/* The pullrights will be built with the current state. */
+	return;
+    }
+    if (fonts_option != NULL) {
 	create_font_menu(false, false);
     }
 
     /* Update the code page menu. */
+    if (codepage_widgets == NULL) {
+	return;
+    }
     cpname = get_codepage_name();
     for (i = 0, s = codepages; i < codepage_count; i++, s = s->next) {
 	XtVaSetValues(codepage_widgets[i],
@@ -2097,9 +2108,6 @@ options_menu_init(bool regen, Position x, Position y)
     struct scheme *s;
     int ix;
     static Widget options_menu_button = NULL;
-    Widget dummy_font_menu, dummy_font_element;
-    static struct menu_hier *scheme_root = NULL;
-    static struct menu_hier *codepage_root = NULL;
     bool spaced = false;
     bool any = false;
     Widget w;
@@ -2113,6 +2121,10 @@ options_menu_init(bool regen, Position x, Position y)
 	}
     }
     if (options_menu != NULL) {
+	if (options_deferred) {
+	    /* The pullrights have not been built yet. */
+	    return;
+	}
 	if (font_widgets != NULL) {
 	    /* Set the current font. */
 	    for (f = font_list, ix = 0; f; f = f->next, ix++) {
@@ -2122,8 +2134,9 @@ options_menu_init(bool regen, Position x, Position y)
 	    }
 	}
 	/* Set the current color scheme. */
-	s = schemes;
-	for (ix = 0, s = schemes; ix < scheme_count; ix++, s = s->next) {
+	for (ix = 0, s = schemes;
+		scheme_widgets != NULL && ix < scheme_count;
+		ix++, s = s->next) {
 	    XtVaSetValues(scheme_widgets[ix], XtNleftBitmap,
 		    !strcmp(xappres.color_scheme, s->scheme)?
 			diamond: no_diamond,
@@ -2137,6 +2150,11 @@ options_menu_init(bool regen, Position x, Position y)
 	    "optionsMenu", complexMenuWidgetClass, menu_parent,
 	    menubar_buttons ? XtNlabel : NULL, NULL,
 	    NULL);
+    XtAddCallback(options_menu, XtNpopupCallback, options_menu_popup, NULL);
+    options_deferred = true;
+    fonts_option = NULL;
+    scheme_button = NULL;
+    codepage_option = NULL;
     if (!menubar_buttons) {
 	XtVaCreateManagedWidget("space", cmeLineObjectClass,
 		options_menu, NULL);
@@ -2244,32 +2262,10 @@ options_menu_init(bool regen, Position x, Position y)
 
     if (!xappres.suppress_font_menu &&
 	    !item_suppressed(options_menu, "fontsOption")) {
-	/* Create the "fonts" pullright */
-
 	/*
-	 * Create a dummy menu with the well-known name, so we can get
-	 * the values of background, borderWidth, borderColor and
-	 * leftMargin from its resources.
+	 * Create the "fonts" pullright entry. The menu itself is created
+	 * by options_submenus_init().
 	 */
-	dummy_font_menu = XtVaCreatePopupShell(
-		"fontsMenu", complexMenuWidgetClass, menu_parent,
-		NULL);
-	dummy_font_element =  XtVaCreateManagedWidget(
-		"entry", cmeBSBObjectClass, dummy_font_menu,
-		XtNleftBitmap, no_diamond,
-		NULL);
-	XtRealizeWidget(dummy_font_menu);
-	XtVaGetValues(dummy_font_menu,
-		XtNborderWidth, &fm_borderWidth,
-		XtNborderColor, &fm_borderColor,
-		XtNbackground, &fm_background,
-		NULL);
-	XtVaGetValues(dummy_font_element,
-		XtNleftMargin, &fm_leftMargin,
-		XtNrightMargin, &fm_rightMargin,
-		NULL);
-	XtDestroyWidget(dummy_font_menu);
-
 	XtVaCreateManagedWidget(
 		"space", cmeLineObjectClass, options_menu,
 		NULL);
@@ -2277,7 +2273,6 @@ options_menu_init(bool regen, Position x, Position y)
 		"fontsOption", cmeBSBObjectClass, options_menu,
 		XtNrightBitmap, arrow,
 		NULL);
-	create_font_menu(regen, true);
 	any = true;
     }
 
@@ -2343,30 +2338,8 @@ options_menu_init(bool regen, Position x, Position y)
 	}
     }
 
-    /* Create the "colors" pullright */
+    /* Create the "colors" pullright entry */
     if (scheme_count && !item_suppressed(options_menu, "colorsOption")) {
-
-	scheme_widgets = (Widget *)XtCalloc(scheme_count, sizeof(Widget));
-	if (scheme_root != NULL) {
-	    free_menu_hier(scheme_root);
-	}
-	scheme_root = (struct menu_hier *)XtCalloc(1,
-		sizeof(struct menu_hier));
-	scheme_root->menu_shell = XtVaCreatePopupShell(
-		"colorsMenu", complexMenuWidgetClass, menu_parent,
-		NULL);
-	s = schemes;
-	for (ix = 0, s = schemes; ix < scheme_count; ix++, s = s->next) {
-	    scheme_widgets[ix] = XtVaCreateManagedWidget(
-		    s->label, cmeBSBObjectClass,
-		    add_menu_hier(scheme_root, s->parents, NULL, 0),
-		    XtNleftBitmap,
-			!strcmp(xappres.color_scheme, s->scheme)?
-			    diamond: no_diamond,
-		    NULL);
-		XtAddCallback(scheme_widgets[ix], XtNcallback, do_newscheme,
-			s->scheme);
-	}
 	XtVaCreateManagedWidget("space", cmeLineObjectClass,
 		options_menu,
 		NULL);
@@ -2379,36 +2352,12 @@ options_menu_init(bool regen, Position x, Position y)
 	any = true;
     }
 
-    /* Create the "code page" pullright */
+    /* Create the "code page" pullright entry */
     if (codepage_count && !item_suppressed(options_menu, "codepageOption")) {
-	struct codepage *cs;
-
-	if (codepage_root != NULL) {
-	    free_menu_hier(codepage_root);
-	}
-	codepage_root = (struct menu_hier *)XtCalloc(1,
-		sizeof(struct menu_hier));
-	codepage_root->menu_shell = XtVaCreatePopupShell(
-		"codepageMenu", complexMenuWidgetClass, menu_parent,
-		NULL);
-
-	codepage_widgets = (Widget *)XtCalloc(codepage_count, sizeof(Widget));
-	for (ix = 0, cs = codepages; ix < codepage_count; ix++, cs = cs->next) {
-	    t = add_menu_hier(codepage_root, cs->parents, NULL, 0);
-	    codepage_widgets[ix] = XtVaCreateManagedWidget(
-		    cs->label, cmeBSBObjectClass, t,
-		    XtNleftBitmap,
-			(strcmp(get_codepage_name(), cs->codepage))? no_diamond:
-								   diamond,
-		    NULL);
-	    XtAddCallback(codepage_widgets[ix], XtNcallback, do_newcodepage,
-		    cs->codepage);
-	}
-
 	XtVaCreateManagedWidget("space", cmeLineObjectClass,
 		options_menu,
 		NULL);
-	XtVaCreateManagedWidget(
+	codepage_option = XtVaCreateManagedWidget(
 		"codepageOption", cmeBSBObjectClass, options_menu,
 		XtNrightBitmap, arrow,
 		XtNmenuName, "codepageMenu",
@@ -2460,6 +2409,114 @@ options_menu_init(bool regen, Position x, Position y)
     } else {
 	XtDestroyWidget(options_menu);
 	options_menu = NULL;
+	options_deferred = false;
+    }
+}
+
+/*
+ * Create the font, color scheme and code page pullright menus.
+ *
+ * The font and code page lists can be long, so this is put off until the
+ * Options menu first pops up, instead of being done before the main window
+ * maps.
+ */
+static void
+options_submenus_init(void)
+{
+    Widget t;
+    struct scheme *s;
+    struct codepage *cs;
+    int ix;
+    Widget dummy_font_menu, dummy_font_element;
+    static struct menu_hier *scheme_root = NULL;
+    static struct menu_hier *codepage_root = NULL;
+
+    if (fonts_option != NULL) {
+	/*
+	 * Create a dummy menu with the well-known name, so we can get
+	 * the values of background, borderWidth, borderColor and
+	 * leftMargin from its resources.
+	 */
+	dummy_font_menu = XtVaCreatePopupShell(
+		"fontsMenu", complexMenuWidgetClass, menu_parent,
+		NULL);
+	dummy_font_element =  XtVaCreateManagedWidget(
+		"entry", cmeBSBObjectClass, dummy_font_menu,
+		XtNleftBitmap, no_diamond,
+		NULL);
+	XtRealizeWidget(dummy_font_menu);
+	XtVaGetValues(dummy_font_menu,
+		XtNborderWidth, &fm_borderWidth,
+		XtNborderColor, &fm_borderColor,
+		XtNbackground, &fm_background,
+		NULL);
+	XtVaGetValues(dummy_font_element,
+		XtNleftMargin, &fm_leftMargin,
+		XtNrightMargin, &fm_rightMargin,
+		NULL);
+	XtDestroyWidget(dummy_font_menu);
+
+	create_font_menu(false, true);
+    }
+
+    if (scheme_button != NULL) {
+	Free(scheme_widgets);
+	scheme_widgets = (Widget *)XtCalloc(scheme_count, sizeof(Widget));
+	if (scheme_root != NULL) {
+	    free_menu_hier(scheme_root);
+	}
+	scheme_root = (struct menu_hier *)XtCalloc(1,
+		sizeof(struct menu_hier));
+	scheme_root->menu_shell = XtVaCreatePopupShell(
+		"colorsMenu", complexMenuWidgetClass, menu_parent,
+		NULL);
+	for (ix = 0, s = schemes; ix < scheme_count; ix++, s = s->next) {
+	    scheme_widgets[ix] = XtVaCreateManagedWidget(
+		    s->label, cmeBSBObjectClass,
+		    add_menu_hier(scheme_root, s->parents, NULL, 0),
+		    XtNleftBitmap,
+			!strcmp(xappres.color_scheme, s->scheme)?
+			    diamond: no_diamond,
+		    NULL);
+		XtAddCallback(scheme_widgets[ix], XtNcallback, do_newscheme,
+			s->scheme);
+	}
+    }
+
+    if (codepage_option != NULL) {
+	if (codepage_root != NULL) {
+	    free_menu_hier(codepage_root);
+	}
+	codepage_root = (struct menu_hier *)XtCalloc(1,
+		sizeof(struct menu_hier));
+	codepage_root->menu_shell = XtVaCreatePopupShell(
+		"codepageMenu", complexMenuWidgetClass, menu_parent,
+		NULL);
+
+	Free(codepage_widgets);
+	codepage_widgets = (Widget *)XtCalloc(codepage_count, sizeof(Widget));
+	for (ix = 0, cs = codepages; ix < codepage_count; ix++, cs = cs->next) {
+	    t = add_menu_hier(codepage_root, cs->parents, NULL, 0);
+	    codepage_widgets[ix] = XtVaCreateManagedWidget(
+		    cs->label, cmeBSBObjectClass, t,
+		    XtNleftBitmap,
+			(strcmp(get_codepage_name(), cs->codepage))? no_diamond:
+								   diamond,
+		    NULL);
+	    XtAddCallback(codepage_widgets[ix], XtNcallback, do_newcodepage,
+		    cs->codepage);
+	}
+    }
+}
+
+/* Called when the Options menu pops up. */
+static void
+options_menu_popup(Widget w _is_unused, XtPointer client_data _is_unused,
+	XtPointer call_data _is_unused)
+{
+    if (options_deferred) {
+	options_deferred = false;
+	options_submenus_init();
     }
 }
 
@@ -48,8 +48,18 @@
 XtResource resources[] = {
     { ResSaveLines, ClsSaveLines, XtRInt, sizeof(int),
       offset(interactive.save_lines), XtRString, "4096" },
+    { ResSaveMemory, ClsSaveMemory, XtRString, sizeof(char *),
+      offset(interactive.save_memory), XtRString, 0 },
     { ResUnlockDelayMs, ClsUnlockDelayMs, XtRInt, sizeof(int),
       offset(unlock_delay_ms), XtRString, "350" },
+    { ResWriteCacheSize, ClsWriteCacheSize, XtRInt, sizeof(int),
+      offset(write_cache_size), XtRString, "0" },
+    { ResSettleTime, ClsSettleTime, XtRInt, sizeof(int),
+      offset(settle_time_ms), XtRString, "300" },
+    { ResKeyLatencySample, ClsKeyLatencySample, XtRInt, sizeof(int),
+      offset(key_latency_sample), XtRString, "10" },
+    { ResSpanFile, ClsSpanFile, XtRString, sizeof(String),
+      offset(span_file), XtRString, 0 },
     { ResScriptPort, ClsScriptPort, XtRString, sizeof(String),
       offset(script_port), XtRString, 0 },
     { ResHttpd, ClsHttpd, XtRString, sizeof(String),
@@ -90,8 +100,26 @@ XtResource resources[] = {
       offset(trace_file), XtRString, 0 },
     { ResTraceFileSize, ClsTraceFileSize, XtRString, sizeof(char *),
       offset(trace_file_size), XtRString, 0 },
+    { ResTraceFileGenerations, ClsTraceFileGenerations, XtRInt, sizeof(int),
+      offset(trace_file_generations), XtRString, "0" },
+    { ResTraceFileCompress, ClsTraceFileCompress, XtRString, sizeof(char *),
+      offset(trace_file_compress), XtRString, 0 },
+    { ResTraceFileTotalSize, ClsTraceFileTotalSize, XtRString, sizeof(char *),
+      offset(trace_file_total_size), XtRString, 0 },
+    { ResTraceCategories, ClsTraceCategories, XtRString, sizeof(char *),
+      offset(trace_categories), XtRString, 0 },
+    { ResScreenTraceCompress, ClsScreenTraceCompress, XtRString,
+      sizeof(char *), offset(screentrace.compress), XtRString, 0 },
+    { ResScreenTraceDedup, ClsScreenTraceDedup, XtRBoolean, sizeof(Boolean),
+      offset(screentrace.dedup), XtRString, ResFalse },
+    { ResScreenTraceDelta, ClsScreenTraceDelta, XtRBoolean, sizeof(Boolean),
+      offset(screentrace.delta), XtRString, ResFalse },
+    { ResScreenTraceDrop, ClsScreenTraceDrop, XtRString, sizeof(char *),
+      offset(screentrace.drop), XtRString, 0 },
     { ResScreenTraceFile, ClsScreenTraceFile, XtRString, sizeof(char *),
       offset(screentrace.file), XtRString, 0 },
+    { ResScreenTraceQueue, ClsScreenTraceQueue, XtRInt, sizeof(int),
+      offset(screentrace.queue), XtRString, STR(SCREENTRACE_QUEUE) },
     { ResScreenTraceTarget, ClsScreenTraceTarget, XtRString, sizeof(char *),
       offset(screentrace.target), XtRString, 0 },
     { ResScreenTraceType, ClsScreenTraceType, XtRString, sizeof(char *),
@@ -104,6 +132,8 @@ XtResource resources[] = {
       offset(idle_timeout), XtRString, 0 },
     { ResProxy, ClsProxy, XtRString, sizeof(String),
       offset(proxy), XtRString, 0 },
+    { ResShmExport, ClsShmExport, XtRString, sizeof(String),
+      offset(shm_export), XtRString, 0 },
     { ResHostname, ClsHostname, XtRString, sizeof(String),
       offset(hostname), XtRString, 0 },
     { ResMaxRecent, ClsMaxRecent, XtRInt, sizeof(int),
@@ -118,8 +148,26 @@ XtResource resources[] = {
       offset(interactive.console), XtRString, 0 },
     { ResNoTelnetInputMode, ClsNoTelnetInputMode, XtRString, sizeof(char *),
       offset(interactive.no_telnet_input_mode), XtRString, "line" },
+    { ResNvtSaveSize, ClsNvtSaveSize, XtRInt, sizeof(int),
+      offset(nvt_save_size), XtRString, STR(NVT_SAVE_SIZE) },
     { ResNopSeconds, ClsNopSeconds, XtRInt, sizeof(int),
       offset(nop_seconds), XtRString, "0" },
+    { ResLatencyBusyPoll, ClsLatencyBusyPoll, XtRInt, sizeof(int),
+      offset(latency_busy_poll), XtRString, "0" },
+    { ResLatencyDscp, ClsLatencyDscp, XtRInt, sizeof(int),
+      offset(latency_dscp), XtRString, STR(LATENCY_DSCP) },
+    { ResLatencyKeepalive, ClsLatencyKeepalive, XtRString, sizeof(char *),
+      offset(latency_keepalive), XtRString, 0 },
+    { ResOutputCork, ClsOutputCork, XtRBoolean, sizeof(Boolean),
+      offset(output_cork), XtRString, ResFalse },
+    { ResNetReadBudget, ClsNetReadBudget, XtRInt, sizeof(int),
+      offset(net_read_budget), XtRString, STR(NET_READ_BUDGET) },
+    { ResDnsCacheTtl, ClsDnsCacheTtl, XtRInt, sizeof(int),
+      offset(dns_cache_ttl), XtRString, STR(DNS_CACHE_TTL) },
+    { ResAltBufferRelease, ClsAltBufferRelease, XtRInt, sizeof(int),
+      offset(alt_buffer_release), XtRString, STR(ALT_BUFFER_RELEASE) },
+    { ResReconnectMaxDelay, ClsReconnectMaxDelay, XtRInt, sizeof(int),
+      offset(reconnect_max_delay), XtRString, STR(RECONNECT_MAX_DELAY) },
     { ResMinVersion, ClsMinVersion, XtRString, sizeof(String),
       offset(min_version), XtRString, 0 },
 
@@ -162,13 +210,19 @@ XtResource resources[] = {
       offset(tls.key_file_type), XtRString, 0 },
     { ResKeyPasswd, ClsKeyPasswd, XtRString, sizeof(char *),
       offset(tls.key_passwd), XtRString, 0 },
+    { ResTlsMaxFragment, ClsTlsMaxFragment, XtRInt, sizeof(int),
+      offset(tls.max_fragment), XtRString, "0" },
 
+    { ResForceScalar, ClsForceScalar, XtRBoolean, sizeof(Boolean),
+      offset(force_scalar), XtRString, ResFalse },
     { ResFtAllocation, ClsFtAllocation, XtRString, sizeof(char *),
       offset(ft.allocation), XtRString, 0 },
     { ResFtAvblock, ClsFtAvblock, XtRInt, sizeof(int),
       offset(ft.avblock), XtRString, "0" },
     { ResFtBlksize, ClsFtBlksize, XtRInt, sizeof(int),
       offset(ft.blksize), XtRString, "0" },
+    { ResFtBufferAuto, ClsFtBufferAuto, XtRBoolean, sizeof(Boolean),
+      offset(ft.dft_buffer_auto), XtRString, ResFalse },
     { ResFtBufferSize, ClsFtBufferSize, XtRInt, sizeof(int),
       offset(ft.dft_buffer_size), XtRString, STR(DFT_BUF) },
     { ResFtCr, ClsFtCr, XtRString, sizeof(char *),
@@ -237,6 +291,8 @@ XtResource xresources[] = {
       offset(invert_kpshift), XtRString, ResFalse },
     { ResActiveIcon, ClsActiveIcon, XtRBoolean, sizeof(Boolean),
       offset(active_icon), XtRString, ResFalse },
+    { ResBackingPixmap, ClsBackingPixmap, XtRBoolean, sizeof(Boolean),
+      offset(backing_pixmap), XtRString, ResFalse },
     { ResLabelIcon, ClsLabelIcon, XtRBoolean, sizeof(Boolean),
       offset(label_icon), XtRString, ResFalse },
     { ResKeypadBackground, ClsKeypadBackground, XtRString, sizeof(String),
@@ -299,6 +355,8 @@ XtResource xresources[] = {
       boffset(modified_sel), XtRString, ResFalse },
     { ResUnlockDelay, ClsUnlockDelay, XtRBoolean, sizeof(Boolean),
       boffset(unlock_delay), XtRString, ResFalse },
+    { ResSettleLearn, ClsSettleLearn, XtRBoolean, sizeof(Boolean),
+      boffset(settle_learn), XtRString, ResFalse },
     { ResBindLimit, ClsBindLimit, XtRBoolean, sizeof(Boolean),
       boffset(bind_limit), XtRString, ResTrue },
     { ResBindUnlock, ClsBindUnlock, XtRBoolean, sizeof(Boolean),
@@ -327,6 +385,8 @@ XtResource xresources[] = {
       boffset(bsd_tm), XtRString, ResFalse },
     { ResTraceMonitor, ClsTraceMonitor, XtRBoolean, sizeof(Boolean),
       boffset(trace_monitor), XtRString, ResTrue },
+    { ResTraceBinary, ClsTraceBinary, XtRBoolean, sizeof(Boolean),
+      boffset(trace_binary), XtRString, ResFalse },
     { ResIdleCommandEnabled, ClsIdleCommandEnabled, XtRBoolean, sizeof(Boolean),
       boffset(idle_command_enabled), XtRString, ResFalse },
     { ResNvtMode, ClsNvtMode, XtRBoolean, sizeof(Boolean),
@@ -392,6 +452,10 @@ XtResource xresources[] = {
       boffset(tls.starttls), XtRString, ResTrue },
     { ResVerifyHostCert, ClsVerifyHostCert, XtRBoolean, sizeof(Boolean),
       boffset(tls.verify_host_cert), XtRString, ResTrue },
+    { ResKernelTls, ClsKernelTls, XtRBoolean, sizeof(Boolean),
+      boffset(tls.kernel_tls), XtRString, ResFalse },
+    { ResTlsReleaseBuffers, ClsTlsReleaseBuffers, XtRBoolean, sizeof(Boolean),
+      boffset(tls.release_buffers), XtRString, ResFalse },
 };
 
 Cardinal num_xresources = XtNumber(xresources);
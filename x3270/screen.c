@@ -79,6 +79,7 @@
 #include "screen.h"
 #include "scroll.h"
 #include "see.h"
+#include "startup.h"
 #include "status.h"
 #include "tables.h"
 #include "telnet.h"
@@ -87,6 +88,7 @@
 #include "unicodec.h"
 #include "unicode_dbcs.h"
 #include "utils.h"
+#include "varbuf.h"
 #include "vstatus.h"
 #include "xactions.h"
 #include "xappres.h"
@@ -117,6 +119,9 @@
 #define BPW	(NBBY * sizeof(unsigned long))
 
 #define MAX_FONTS	50000
+#define FONT_CACHE	"~/.x3270fonts"	/* font name cache */
+#define FONT_CACHE_MAGIC "x3270 font cache 1"
+#define FONT_REFRESH_MS	2000		/* delay before refreshing the cache */
 
 #define SELECTED(baddr)		(selected[(baddr)/8] & (1 << ((baddr)%8)))
 #define SET_SELECT(baddr)	(selected[(baddr)/8] |= (1 << ((baddr)%8)))
@@ -193,6 +198,13 @@ static bool     text_blinking_on = true;
 static bool     text_blinkers_exist = false;
 static bool     text_blink_scheduled = false;
 static XtIntervalId text_blink_id;
+static struct blink_span {		/* blinking cells, one row at most */
+    int baddr;
+    int len;
+} *blink_spans = NULL;
+static int	n_blink_spans = 0;
+static int	blink_spans_size = 0;
+static bool	blink_spans_valid = false;
 static XtTranslations screen_t00 = NULL;
 static XtTranslations screen_t0 = NULL;
 static XtTranslations container_t00 = NULL;
@@ -282,6 +294,11 @@ static int crosshair_color = HOST_COLOR_PURPLE;
 struct sstate {
     Widget          widget;	/* the widget */
     Window          window;	/* the window */
+    Drawable        drawable;	/* where drawing goes: window or backing */
+    Pixmap          backing;	/* backing pixmap, or None */
+    bool            damaged;	/* backing has changes not yet copied */
+    int             dx0, dy0;	/* damaged area of the backing */
+    int             dx1, dy1;
     struct sp       *image;	/* what's on the X display */
     int             cursor_daddr;	/* displayed cursor address */
     bool	    xh_alt;	/* crosshair was drawn in alt area */
@@ -335,7 +352,7 @@ static struct sstate *ss = &nss;
 
 /* Globals based on nss, used mostly by status and select routines. */
 Widget         *screen = &nss.widget;
-Window         *screen_window = &nss.window;
+Drawable       *screen_window = &nss.drawable;
 int            *char_width = &nss.char_width;
 int            *char_height = &nss.char_height;
 int            *ascent = &nss.ascent;
@@ -366,6 +383,17 @@ typedef struct dfc {
 	bool good;
 } dfc_t;
 
+/* Metrics of fonts on the resize menu, kept across menu rebuilds. */
+typedef struct rsmetrics {
+    struct rsmetrics *next;
+    char *name;
+    bool found;
+    int width;
+    int height;
+    int descent;
+} rsmetrics_t;
+static rsmetrics_t *rsmetrics = NULL;
+
 static void aicon_init(void);
 static void aicon_reinit(unsigned cmask);
 static void screen_focus(bool in);
@@ -374,6 +402,7 @@ static void make_gcs(struct sstate *s);
 static void put_cursor(int baddr, bool on);
 static void resync_display(struct sp *buffer, int first, int last);
 static void draw_fields(struct sp *buffer, int first, int last);
+static bool draw_region(struct sp *buffer, int first, int last, bool collect);
 static void render_text(struct sp *buffer, int baddr, int len,
     bool block_cursor, struct sp *attrs);
 static void cursor_on(const char *why);
@@ -386,6 +415,7 @@ static bool cursor_off(const char *why, bool including_lower_crosshair,
 	bool *xwo);
 static void draw_aicon_label(void);
 static void set_mcursor(void);
+static void backing_init(void);
 static void scrollbar_init(bool is_reset);
 static void init_rsfonts(char *charset_name);
 static void allocate_pixels(void);
@@ -467,6 +497,36 @@ save_00translations(Widget w, XtTranslations *t00)
 	*t00 = w->core.tm.translations;
 }
 
+/*
+ * Merged translation cache.
+ *
+ * Each distinct combination of 00 translations and keymap list is merged
+ * once. Switching back to a combination seen before (such as going in and
+ * out of 3270 mode) installs the saved result with a single merge, instead
+ * of merging each keymap in the list again. The first call for a widget,
+ * which merges onto whatever the widget has installed, is not cached.
+ */
+typedef struct merged_tt {
+	struct merged_tt *next;
+	XtTranslations t00;		/* 00 translations */
+	char *names;			/* keymap names, comma-separated */
+	XtTranslations trans;		/* merged result */
+} merged_tt_t;
+static merged_tt_t *merged_tts = NULL;
+
+/* Returns the names in the current keymap list, comma-separated. */
+static char *
+trans_list_names(void)
+{
+	struct trans_list *t;
+	varbuf_t r;
+
+	vb_init(&r);
+	for (t = trans_list; t != NULL; t = t->next)
+		vb_appendf(&r, "%s%s", (t == trans_list)? "": ",", t->name);
+	return vb_consume(&r);
+}
+
 /* 
  * Define our event translations
  */
@@ -474,6 +534,20 @@ void
 set_translations(Widget w, XtTranslations *t00, XtTranslations *t0)
 {
 	struct trans_list *t;
+	char *names = NULL;
+	merged_tt_t *m;
+
+	if (t00 != NULL) {
+		names = trans_list_names();
+		for (m = merged_tts; m != NULL; m = m->next) {
+			if (m->t00 == *t00 && !strcmp(m->names, names)) {
+				Free(names);
+				XtOverrideTranslations(w, m->trans);
+				*t0 = w->core.tm.translations;
+				return;
+			}
+		}
+	}
 
 	if (t00 != NULL)
 		XtOverrideTranslations(w, *t00);
@@ -482,6 +556,15 @@ set_translations(Widget w, XtTranslations *t00, XtTranslations *t0)
 		XtOverrideTranslations(w, lookup_tt(t->name, NULL));
 
 	*t0 = w->core.tm.translations;
+
+	if (t00 != NULL) {
+		m = (merged_tt_t *)Malloc(sizeof(merged_tt_t));
+		m->t00 = *t00;
+		m->names = names;
+		m->trans = *t0;
+		m->next = merged_tts;
+		merged_tts = m;
+	}
 }
 
 /*
@@ -943,6 +1026,7 @@ screen_reinit(unsigned cmask)
 
     XtRealizeWidget(toplevel);
     nss.window = XtWindow(nss.widget);
+    backing_init();
     set_mcursor();
 
     /* Reinitialize the active icon. */
@@ -1290,6 +1374,46 @@ blink_start(void)
     }
 }
 
+/*
+ * Redraw just the blinking cells found by the last full pass of draw_fields.
+ * Returns false if that is not possible and the whole screen must be redrawn.
+ */
+static bool
+blink_redraw(void)
+{
+    int i;
+    int last_row = -1;
+    int fca;
+
+    if (!blink_spans_valid || screen_changed || flipped || !ss->exposed_yet) {
+	return false;
+    }
+
+    /* If the cursor is on a blinking cell, let screen_disp handle it. */
+    fca = fl_baddr(cursor_addr);
+    for (i = 0; i < n_blink_spans; i++) {
+	if (fca >= blink_spans[i].baddr &&
+		fca < blink_spans[i].baddr + blink_spans[i].len) {
+	    return false;
+	}
+    }
+
+    /* Draw the spans into temp_image, then push each affected row. */
+    for (i = 0; i < n_blink_spans; i++) {
+	draw_region(temp_image, blink_spans[i].baddr,
+		blink_spans[i].baddr + blink_spans[i].len, false);
+    }
+    for (i = 0; i < n_blink_spans; i++) {
+	int row = blink_spans[i].baddr / COLS;
+
+	if (row != last_row) {
+	    resync_display(temp_image, row * COLS, (row + 1) * COLS);
+	    last_row = row;
+	}
+    }
+    return true;
+}
+
 /*
  * Restore blanked blinking text
  */
@@ -1299,8 +1423,10 @@ text_blink_it(XtPointer closure _is_unused, XtIntervalId *id _is_unused)
     /* Flip the state. */
     text_blinking_on = !text_blinking_on;
 
-    /* Force a screen redraw. */
-    ctlr_changed(0, ROWS*COLS);
+    /* Redraw the blinking text, or the whole screen if we must. */
+    if (!blink_redraw()) {
+	ctlr_changed(0, ROWS*COLS);
+    }
 
     /* If there is still blinking text, schedule the next iteration */
     if (text_blinkers_exist) {
@@ -1360,11 +1486,135 @@ screen_crosshair_gc(void)
     return screen_gc(CROSS_COLOR);
 }
 
+/*
+ * Backing pixmap.
+ *
+ * With the backingPixmap resource set, drawing on the normal screen goes
+ * into a server-side pixmap, and the changed area is copied to the window
+ * when the update is done. Expose events are answered by copying the
+ * exposed area from the pixmap, without rendering any text.
+ */
+static XtWorkProcId backing_wp = 0;
+static GC backing_gc = (GC)None;
+
+/* Copy the damaged area of the backing pixmap to the window. */
+static void
+backing_flush(void)
+{
+    if (!nss.damaged) {
+	return;
+    }
+    XCopyArea(display, nss.backing, nss.window, backing_gc,
+	    nss.dx0, nss.dy0, nss.dx1 - nss.dx0, nss.dy1 - nss.dy0,
+	    nss.dx0, nss.dy0);
+    nss.damaged = false;
+}
+
+/* Work procedure to copy any damage left over after drawing. */
+static Boolean
+backing_work(XtPointer closure _is_unused)
+{
+    backing_wp = 0;
+    backing_flush();
+    return True;
+}
+
+/* Note that part of the backing pixmap has been drawn on. */
+static void
+backing_damage(struct sstate *s, int x, int y, int width, int height)
+{
+    int x1 = x + width;
+    int y1 = y + height;
+
+    if (s->backing == None) {
+	return;
+    }
+    if (x < 0) {
+	x = 0;
+    }
+    if (y < 0) {
+	y = 0;
+    }
+    if (x1 > s->screen_width) {
+	x1 = s->screen_width;
+    }
+    if (y1 > s->screen_height) {
+	y1 = s->screen_height;
+    }
+    if (x1 <= x || y1 <= y) {
+	return;
+    }
+
+    if (!s->damaged) {
+	s->dx0 = x;
+	s->dy0 = y;
+	s->dx1 = x1;
+	s->dy1 = y1;
+	s->damaged = true;
+    } else {
+	if (x < s->dx0) {
+	    s->dx0 = x;
+	}
+	if (y < s->dy0) {
+	    s->dy0 = y;
+	}
+	if (x1 > s->dx1) {
+	    s->dx1 = x1;
+	}
+	if (y1 > s->dy1) {
+	    s->dy1 = y1;
+	}
+    }
+    if (backing_wp == 0) {
+	backing_wp = XtAppAddWorkProc(appcontext, backing_work, NULL);
+    }
+}
+
+/*
+ * Note that part of the normal screen has been drawn on, for the status
+ * line.
+ */
+void
+screen_damage(int x, int y, int width, int height)
+{
+    backing_damage(&nss, x, y, width, height);
+}
+
+/* (Re)create the backing pixmap after the screen window changes size. */
+static void
+backing_init(void)
+{
+    if (nss.backing != None) {
+	XFreePixmap(display, nss.backing);
+	nss.backing = None;
+	nss.damaged = false;
+    }
+    nss.drawable = nss.window;
+    if (!xappres.backing_pixmap) {
+	return;
+    }
+
+    if (backing_gc == (GC)None) {
+	XGCValues xgcv;
+
+	/* The source is always complete, so there is nothing to expose. */
+	xgcv.graphics_exposures = False;
+	backing_gc = XtGetGC(toplevel, GCGraphicsExposures, &xgcv);
+    }
+    nss.backing = XCreatePixmap(display, nss.window, nss.screen_width,
+	    nss.screen_height, screen_depth);
+    XFillRectangle(display, nss.backing, get_gc(&nss, INVERT_COLOR(0)), 0, 0,
+	    nss.screen_width, nss.screen_height);
+    nss.drawable = nss.backing;
+}
+
 /* Draw the line at the top of the OIA. */
 static void
 draw_oia_line(void)
 {
-    XDrawLine(display, ss->window,
+    backing_damage(ss, 0, nss.screen_height - nss.char_height - 3,
+	    ssCOL_TO_X(maxCOLS) + hhalo + 1, 1);
+    XDrawLine(display, ss->drawable,
 	    get_gc(ss, GC_NONDEFAULT | DEFAULT_PIXEL),
 	    0,
 	    nss.screen_height - nss.char_height - 3,
@@ -1388,6 +1638,8 @@ crosshair_margin(bool draw, const char *why)
 	    draw? cursor_addr: ss->cursor_daddr);
 #endif /*]*/
 
+    backing_damage(ss, 0, 0, ss->screen_width, ss->screen_height);
+
     /* Compute the number of halo characters. */
     if (hhalo > HHALO) {
 	hhalo_chars = (hhalo + (ss->char_width - 1)) / ss->char_width;
@@ -1428,7 +1680,7 @@ crosshair_margin(bool draw, const char *why)
 	    text1.nchars = maxCOLS - cCOLS;
 	    text1.delta = 0;
 	    text1.font = ss->fid;
-	    XDrawText16(display, ss->window, get_gc(ss, CROSS_COLOR),
+	    XDrawText16(display, ss->drawable, get_gc(ss, CROSS_COLOR),
 		    ssCOL_TO_X(cCOLS),
 		    ssROW_TO_Y(BA_TO_ROW(cursor_addr)),
 		    &text1, 1);
@@ -1447,7 +1699,7 @@ crosshair_margin(bool draw, const char *why)
 	    text1.delta = 0;
 	    text1.font = ss->fid;
 	    for (i = ROWS; i < maxROWS; i++) {
-		XDrawText16(display, ss->window, get_gc(ss, CROSS_COLOR),
+		XDrawText16(display, ss->drawable, get_gc(ss, CROSS_COLOR),
 			ssCOL_TO_X(column), ssROW_TO_Y(i), &text1, 1);
 	    }
 
@@ -1466,13 +1718,13 @@ crosshair_margin(bool draw, const char *why)
 	    text1.font = ss->fid;
 
 	    for (i = -vhalo_chars; i < 0; i++) {
-		XDrawText16(display, ss->window, get_gc(ss, CROSS_COLOR),
+		XDrawText16(display, ss->drawable, get_gc(ss, CROSS_COLOR),
 			ssCOL_TO_X(column), ssROW_TO_Y(i), &text1, 1);
 	    }
 	    for (i = maxROWS;
 		 i < maxROWS + (2 * vhalo_chars);
 		 i++) {
-		XDrawText16(display, ss->window, get_gc(ss, CROSS_COLOR),
+		XDrawText16(display, ss->drawable, get_gc(ss, CROSS_COLOR),
 			ssCOL_TO_X(column), ssROW_TO_Y(i), &text1, 1);
 	    }
 	}
@@ -1483,11 +1735,11 @@ crosshair_margin(bool draw, const char *why)
 	    text1.nchars = hhalo_chars;
 	    text1.delta = 0;
 	    text1.font = ss->fid;
-	    XDrawText16(display, ss->window, get_gc(ss, CROSS_COLOR),
+	    XDrawText16(display, ss->drawable, get_gc(ss, CROSS_COLOR),
 		    ssCOL_TO_X(-hhalo_chars),
 		    ssROW_TO_Y(BA_TO_ROW(cursor_addr)),
 		    &text1, 1);
-	    XDrawText16(display, ss->window, get_gc(ss, CROSS_COLOR),
+	    XDrawText16(display, ss->drawable, get_gc(ss, CROSS_COLOR),
 		    ssCOL_TO_X(maxCOLS),
 		    ssROW_TO_Y(BA_TO_ROW(cursor_addr)),
 		    &text1, 1);
@@ -1509,12 +1761,12 @@ crosshair_margin(bool draw, const char *why)
 
     if (vhalo_chars) {
 	/* Vertical halo. */
-	XFillRectangle(display, ss->window, get_gc(ss, INVERT_COLOR(0)),
+	XFillRectangle(display, ss->drawable, get_gc(ss, INVERT_COLOR(0)),
 		ssCOL_TO_X(column), /* x */
 		ssROW_TO_Y(-vhalo_chars) - ss->ascent, /* y */
 		ss->char_width + 1, /* width */
 		ss->char_height * vhalo_chars /* height */);
-	XFillRectangle(display, ss->window, get_gc(ss, INVERT_COLOR(0)),
+	XFillRectangle(display, ss->drawable, get_gc(ss, INVERT_COLOR(0)),
 		ssCOL_TO_X(column), /* x */
 		ssROW_TO_Y(maxROWS) - ss->ascent, /* y */
 		ss->char_width + 1, /* width */
@@ -1522,11 +1774,11 @@ crosshair_margin(bool draw, const char *why)
     }
     if (hhalo_chars) {
 	/* Horizontal halo. */
-	XFillRectangle(display, ss->window, get_gc(ss, INVERT_COLOR(0)),
+	XFillRectangle(display, ss->drawable, get_gc(ss, INVERT_COLOR(0)),
 		ssCOL_TO_X(-hhalo_chars),
 		ssROW_TO_Y(BA_TO_ROW(ss->cursor_daddr)) - ss->ascent,
 		(ss->char_width * hhalo_chars) + 1, ss->char_height);
-	XFillRectangle(display, ss->window, get_gc(ss, INVERT_COLOR(0)),
+	XFillRectangle(display, ss->drawable, get_gc(ss, INVERT_COLOR(0)),
 		ssCOL_TO_X(maxCOLS),
 		ssROW_TO_Y(BA_TO_ROW(ss->cursor_daddr)) - ss->ascent,
 		(ss->char_width * hhalo_chars) + 1, ss->char_height);
@@ -1544,7 +1796,7 @@ crosshair_margin(bool draw, const char *why)
 
     /* To the right. */
     if (maxCOLS > defCOLS) {
-	XFillRectangle(display, ss->window, get_gc(ss, INVERT_COLOR(0)),
+	XFillRectangle(display, ss->drawable, get_gc(ss, INVERT_COLOR(0)),
 		ssCOL_TO_X(defCOLS),
 		ssROW_TO_Y(BA_TO_ROW(ss->cursor_daddr)) - ss->ascent,
 		(ss->char_width * (maxCOLS - defCOLS)) + 1, ss->char_height);
@@ -1552,7 +1804,7 @@ crosshair_margin(bool draw, const char *why)
 
     /* Down the bottom. */
     if (maxROWS > defROWS) {
-	XFillRectangle(display, ss->window, get_gc(ss, INVERT_COLOR(0)),
+	XFillRectangle(display, ss->drawable, get_gc(ss, INVERT_COLOR(0)),
 		ssCOL_TO_X(column), ssROW_TO_Y(defROWS) - ss->ascent,
 		ss->char_width + 1, ss->char_height * (maxROWS - defROWS));
     }
@@ -1842,6 +2094,16 @@ do_redraw(Widget w, XEvent *event, String *params _is_unused,
 	return;
     }
 
+    /* Answer an expose event from the backing pixmap, if there is one. */
+    if (event && event->type == Expose && ss->backing != None &&
+	    ss->exposed_yet) {
+	XCopyArea(display, ss->backing, ss->window, backing_gc,
+		event->xexpose.x, event->xexpose.y,
+		event->xexpose.width, event->xexpose.height,
+		event->xexpose.x, event->xexpose.y);
+	return;
+    }
+
     /* Only redraw as necessary for an expose event */
     if (event && event->type == Expose) {
 	ss->exposed_yet = true;
@@ -1890,7 +2152,8 @@ do_redraw(Widget w, XEvent *event, String *params _is_unused,
 	;
 
     } else {
-	XFillRectangle(display, ss->window, get_gc(ss, INVERT_COLOR(0)), 0, 0,
+	backing_damage(ss, 0, 0, ss->screen_width, ss->screen_height);
+	XFillRectangle(display, ss->drawable, get_gc(ss, INVERT_COLOR(0)), 0, 0,
 		ss->screen_width, ss->screen_height);
 	memset((char *) ss->image, 0,
 		(maxROWS*maxCOLS) * sizeof(struct sp));
@@ -1931,6 +2194,33 @@ PA_Expose_xaction(Widget w, XEvent *event, String *params, Cardinal *num_params)
     do_redraw(w, event, params, num_params);
 }
 
+/*
+ * Deferred redraw.
+ *
+ * Changes to the screen image from the event loop are drawn from a work
+ * procedure, which Xt runs only once there are no X events, timers or
+ * inputs pending. A burst of host records is thus drawn in one pass. The
+ * timeout limits the delay when the host is sending continuously.
+ */
+#define DISP_DEFER_MS	100	/* longest time a redraw is deferred */
+static XtWorkProcId disp_wp = 0;
+static XtIntervalId disp_id;
+static bool disp_ticking = false;
+
+/* Cancel a deferred redraw. */
+static void
+disp_cancel(void)
+{
+    if (disp_wp != 0) {
+	XtRemoveWorkProc(disp_wp);
+	disp_wp = 0;
+    }
+    if (disp_ticking) {
+	XtRemoveTimeOut(disp_id);
+	disp_ticking = false;
+    }
+}
+
 /*
  * Redraw the changed parts of the screen.
  */
@@ -1943,6 +2233,9 @@ screen_disp(bool erasing)
 	return;
     }
 
+    /* Anything deferred is drawn now. */
+    disp_cancel();
+
     /*
      * We don't set "cursor_changed" when the host moves the cursor,
      * 'cause he might just move it back later.  Set it here if the cursor
@@ -2039,6 +2332,63 @@ screen_disp(bool erasing)
 	}
     }
     draw_aicon_label();
+
+    /* Copy what was drawn to the window. */
+    backing_flush();
+    startup_mark(STARTUP_SCREEN);
+}
+
+/* Work procedure for a deferred redraw. */
+static Boolean
+disp_work(XtPointer closure _is_unused)
+{
+    disp_wp = 0;
+    screen_disp(false);
+    return True;
+}
+
+/* Timeout for a deferred redraw. */
+static void
+disp_timeout(XtPointer closure _is_unused, XtIntervalId *id _is_unused)
+{
+    disp_ticking = false;
+    screen_disp(false);
+}
+
+/*
+ * Redraw the screen from the event loop.
+ *
+ * Cursor motion is drawn immediately, so typing is not delayed. Changes
+ * to the screen image are drawn when the event queue drains.
+ */
+void
+screen_disp_idle(void)
+{
+    if (!ss->exposed_yet) {
+	return;
+    }
+    if (!screen_changed) {
+	screen_disp(false);
+	return;
+    }
+
+    /* Move the cursor now. */
+    if (cursor_addr != ss->cursor_daddr && !toggled(CROSSHAIR)) {
+	if (cursor_off("disp", false, NULL)) {
+	    cursor_on("disp");
+	}
+	backing_flush();
+    }
+
+    /* Draw the rest later. */
+    if (disp_wp == 0) {
+	disp_wp = XtAppAddWorkProc(appcontext, disp_work, NULL);
+    }
+    if (!disp_ticking) {
+	disp_id = XtAppAddTimeOut(appcontext, DISP_DEFER_MS, disp_timeout,
+		NULL);
+	disp_ticking = true;
+    }
 }
 
 /*
@@ -2056,7 +2406,9 @@ render_blanks(int baddr, int height, struct sp *buffer)
     x = ssCOL_TO_X(BA_TO_COL(baddr));
     y = ssROW_TO_Y(BA_TO_ROW(baddr));
 
-    XFillRectangle(display, ss->window,
+    backing_damage(ss, x, y - ss->ascent, (ss->char_width * COLS) + 1,
+	    ss->char_height * height);
+    XFillRectangle(display, ss->drawable,
 	get_gc(ss, INVERT_COLOR(0)),
 	x, y - ss->ascent,
 	(ss->char_width * COLS) + 1, (ss->char_height * height));
@@ -2163,7 +2515,9 @@ resync_text(int baddr, int len, struct sp *buffer)
 #if defined(_ST) /*[*/
 	printf("FillRectangle(baddr=%s, len=%d)\n", rcba(baddr), len);
 #endif /*]*/
-	XFillRectangle(display, ss->window, get_gc(ss, INVERT_COLOR(0)), x,
+	backing_damage(ss, x, y - ss->ascent, (ss->char_width * len) + 1,
+		ss->char_height);
+	XFillRectangle(display, ss->drawable, get_gc(ss, INVERT_COLOR(0)), x,
 		y - ss->ascent, (ss->char_width * len) + 1, ss->char_height);
     } else {
 	unsigned long attrs, attrs2;
@@ -2634,8 +2988,10 @@ render_text(struct sp *buffer, int baddr, int len, bool block_cursor,
 	cleargc = get_gc(ss, INVERT_COLOR(color));
     }
 
-    /* Draw the text */
-    XFillRectangle(display, ss->window, cleargc, x, y - ss->ascent, clear_len,
+    /* Draw the text, allowing for glyphs that spill into the neighbors. */
+    backing_damage(ss, x - ss->char_width, y - ss->ascent,
+	    clear_len + (2 * ss->char_width), ss->char_height);
+    XFillRectangle(display, ss->drawable, cleargc, x, y - ss->ascent, clear_len,
 	    ss->char_height);
 #if defined(_ST) /*[*/
     {
@@ -2667,12 +3023,12 @@ render_text(struct sp *buffer, int baddr, int len, bool block_cursor,
 			text1.nchars = 1;
 			text1.delta = 0;
 			text1.font = ss->fid;
-			XDrawText16(display, ss->window, dgc, xn, y, &text1,
+			XDrawText16(display, ss->drawable, dgc, xn, y, &text1,
 				1);
 			xn += ss->char_width;
 		    }
 		} else {
-		    XDrawText16(display, ss->window, dgc, xn, y, &text[i], 1);
+		    XDrawText16(display, ss->drawable, dgc, xn, y, &text[i], 1);
 			xn += ss->char_width * text[i].nchars;
 		}
 	    } else {
@@ -2682,28 +3038,28 @@ render_text(struct sp *buffer, int baddr, int len, bool block_cursor,
 			text1.nchars = 1;
 			text1.delta = 0;
 			text1.font = dbcs_font.font;
-			XDrawText16(display, ss->window, dgc, xn, y, &text1,
+			XDrawText16(display, ss->drawable, dgc, xn, y, &text1,
 				1);
 			xn += dbcs_font.char_width;
 		    }
 		} else {
-		    XDrawText16(display, ss->window, dgc, xn, y, &text[i], 1);
+		    XDrawText16(display, ss->drawable, dgc, xn, y, &text[i], 1);
 		    xn += dbcs_font.char_width * text[i].nchars;
 		}
 	    }
 	}
     } else {
-	XDrawText16(display, ss->window, dgc, x, y, text, n_texts);
+	XDrawText16(display, ss->drawable, dgc, x, y, text, n_texts);
 	if (ss->overstrike && ((attrs->u.bits.gr & GR_INTENSIFY) ||
 		    ((appres.interactive.mono ||
 		      (!mode.m3279 && highlight_bold)) &&
 		     ((color & BASE_MASK) == FA_INT_HIGH_SEL)))) {
-	    XDrawText16(display, ss->window, dgc, x+1, y, text, n_texts);
+	    XDrawText16(display, ss->drawable, dgc, x+1, y, text, n_texts);
 	}
     }
 
     if (attrs->u.bits.gr & GR_UNDERLINE) {
-	XDrawLine(display, ss->window, dgc, x,
+	XDrawLine(display, ss->drawable, dgc, x,
 		y - ss->ascent + ss->char_height - 1, x + clear_len,
 		y - ss->ascent + ss->char_height - 1);
     }
@@ -2741,7 +3097,9 @@ screen_scroll(unsigned char fg, unsigned char bg)
 		  COLS * sizeof(struct sp));
     memset((char *)&temp_image[(ROWS - 1) * COLS], 0,
 		  COLS * sizeof(struct sp));
-    XCopyArea(display, ss->window, ss->window, get_gc(ss, 0),
+    backing_damage(ss, ssCOL_TO_X(0), ssROW_TO_Y(0) - ss->ascent,
+	    (ss->char_width * COLS) + 1, ss->char_height * ROWS);
+    XCopyArea(display, ss->drawable, ss->drawable, get_gc(ss, 0),
 	ssCOL_TO_X(0),
 	ssROW_TO_Y(1) - ss->ascent,
 	ss->char_width * COLS,
@@ -2749,7 +3107,7 @@ screen_scroll(unsigned char fg, unsigned char bg)
 	ssCOL_TO_X(0),
 	ssROW_TO_Y(0) - ss->ascent);
     ss->copied = true;
-    XFillRectangle(display, ss->window, get_gc(ss, INVERT_COLOR(0)),
+    XFillRectangle(display, ss->drawable, get_gc(ss, INVERT_COLOR(0)),
 	ssCOL_TO_X(0),
 	ssROW_TO_Y(ROWS - 1) - ss->ascent,
 	(ss->char_width * COLS) + 1,
@@ -2853,6 +3211,51 @@ map_crosshair(int baddr)
  */
 static void
 draw_fields(struct sp *buffer, int first, int last)
+{
+    /* If there is any blinking text, override the suggested boundaries. */
+    if (text_blinkers_exist) {
+	first = -1;
+	last = -1;
+    }
+
+    /* Cancel blink timeouts if none were seen this pass. */
+    if (!draw_region(buffer, first, last,
+		first <= 0 && (last == -1 || last >= ROWS*COLS))) {
+	text_blinkers_exist = false;
+    }
+}
+
+/* Note a blinking cell in the span list. */
+static void
+add_blink_span(int baddr)
+{
+    struct blink_span *s;
+
+    if (n_blink_spans) {
+	s = &blink_spans[n_blink_spans - 1];
+	if (s->baddr + s->len == baddr && baddr % COLS) {
+	    s->len++;
+	    return;
+	}
+    }
+    if (n_blink_spans >= blink_spans_size) {
+	blink_spans_size = blink_spans_size? blink_spans_size * 2: 16;
+	blink_spans = (struct blink_span *)Realloc(blink_spans,
+		blink_spans_size * sizeof(struct blink_span));
+    }
+    s = &blink_spans[n_blink_spans++];
+    s->baddr = baddr;
+    s->len = 1;
+}
+
+/*
+ * "Draw" a region of ea_buf into a buffer.
+ * If 'collect' is set, the region is the whole screen, and the blinking
+ * cells are recorded for blink_redraw().
+ * Returns true if any blinking text was seen.
+ */
+static bool
+draw_region(struct sp *buffer, int first, int last, bool collect)
 {
     int	baddr = 0;
     int	faddr;
@@ -2872,10 +3275,9 @@ draw_fields(struct sp *buffer, int first, int last)
 	cursor_row = BA_TO_ROW(cursor_addr);
     }
 
-    /* If there is any blinking text, override the suggested boundaries. */
-    if (text_blinkers_exist) {
-	first = -1;
-	last = -1;
+    if (collect) {
+	n_blink_spans = 0;
+	blink_spans_valid = true;
     }
 
     /* Adjust pointers to start of region. */
@@ -2945,6 +3347,9 @@ draw_fields(struct sp *buffer, int first, int last)
 		}
 		if (gr & GR_BLINK) {
 		    any_blink = true;
+		    if (collect) {
+			add_blink_span(baddr);
+		    }
 		}
 		if (highlight_bold && FA_IS_HIGH(fa)) {
 		    gr |= GR_INTENSIFY;
@@ -3118,10 +3523,7 @@ draw_fields(struct sp *buffer, int first, int last)
 	INC_BA(baddr);
     } while (baddr != last);
 
-    /* Cancel blink timeouts if none were seen this pass. */
-    if (!any_blink) {
-	text_blinkers_exist = false;
-    }
+    return any_blink;
 }
 
 
@@ -3478,8 +3880,11 @@ hollow_cursor(int baddr)
 	break;
     }
 
+    backing_damage(ss, ssCOL_TO_X(BA_TO_COL(fl_baddr(baddr))),
+	    ssROW_TO_Y(BA_TO_ROW(baddr)) - ss->ascent, cwidth + 1,
+	    ss->char_height);
     XDrawRectangle(display,
-	    ss->window,
+	    ss->drawable,
 	    cursor_gc(baddr),
 	    ssCOL_TO_X(BA_TO_COL(fl_baddr(baddr))),
 	    ssROW_TO_Y(BA_TO_ROW(baddr)) - ss->ascent +
@@ -3512,8 +3917,11 @@ underscore_cursor(int baddr)
 	break;
     }
 
+    backing_damage(ss, ssCOL_TO_X(BA_TO_COL(fl_baddr(baddr))),
+	    ssROW_TO_Y(BA_TO_ROW(baddr)) - ss->ascent, cwidth + 1,
+	    ss->char_height);
     XDrawRectangle(display,
-	    ss->window,
+	    ss->drawable,
 	    cursor_gc(baddr),
 	    ssCOL_TO_X(BA_TO_COL(fl_baddr(baddr))),
 	    ssROW_TO_Y(BA_TO_ROW(baddr)) - ss->ascent +
@@ -3530,8 +3938,11 @@ small_inv_cursor(int baddr)
 {
     /* XXX: DBCS? */
 
+    backing_damage(ss, ssCOL_TO_X(BA_TO_COL(fl_baddr(baddr))),
+	    ssROW_TO_Y(BA_TO_ROW(baddr)) - ss->ascent, ss->char_width,
+	    ss->char_height);
     XFillRectangle(display,
-	    ss->window,
+	    ss->drawable,
 	    ss->mcgc,
 	    ssCOL_TO_X(BA_TO_COL(fl_baddr(baddr))),
 	    ssROW_TO_Y(BA_TO_ROW(baddr)) - ss->ascent + 1,
@@ -5299,6 +5710,7 @@ aicon_init(void)
 
     iss.widget = icon_shell;
     iss.window = XtWindow(iss.widget);
+    iss.drawable = iss.window;
     iss.cursor_daddr = 0;
     iss.exposed_yet = false;
     if (xappres.label_icon) {
@@ -5517,6 +5929,7 @@ init_rsfonts(char *charset_name)
 	bool resize;
 	char **matches;
 	int count;
+	rsmetrics_t *m;
 
 	ns = ms = NewString(ms);
 	while (split_lresource(&ms, &line) == 1) {
@@ -5542,17 +5955,34 @@ init_rsfonts(char *charset_name)
 	    if (!resize) {
 		continue;
 	    }
-	    matches = XListFontsWithInfo(display, NO_BANG(font), 1, &count,
-		    &fs);
-	    if (matches == NULL) {
+	    for (m = rsmetrics; m != NULL; m = m->next) {
+		if (!strcmp(m->name, font)) {
+		    break;
+		}
+	    }
+	    if (m == NULL) {
+		m = (rsmetrics_t *)Calloc(1, sizeof(*m));
+		m->name = NewString(font);
+		matches = XListFontsWithInfo(display, NO_BANG(font), 1, &count,
+			&fs);
+		if (matches != NULL) {
+		    m->found = true;
+		    m->width = fCHAR_WIDTH(fs);
+		    m->height = fCHAR_HEIGHT(fs);
+		    m->descent = fs->max_bounds.descent;
+		    XFreeFontInfo(matches, fs, count);
+		}
+		m->next = rsmetrics;
+		rsmetrics = m;
+	    }
+	    if (!m->found) {
 		continue;
 	    }
 	    r = (struct rsfont *)XtMalloc(sizeof(*r));
 	    r->name = XtNewString(font);
-	    r->width = fCHAR_WIDTH(fs);
-	    r->height = fCHAR_HEIGHT(fs);
-	    r->descent = fs->max_bounds.descent;
-	    XFreeFontInfo(matches, fs, count);
+	    r->width = m->width;
+	    r->height = m->height;
+	    r->descent = m->descent;
 	    r->next = rsfonts;
 	    rsfonts = r;
 	}
@@ -6303,11 +6733,193 @@ split_name(const char *name, char res[15][256])
     return ns;
 }
 
-/* Initialize the dumb font cache. */
+/*
+ * Compute the key for the font name cache: the server vendor and release,
+ * the display and the font path. If any of them changes, the list of fonts
+ * might have changed.
+ */
+static char *
+dfc_cache_key(void)
+{
+    char **path;
+    int npaths;
+    int i;
+    varbuf_t r;
+
+    vb_init(&r);
+    vb_appendf(&r, "%s|%d|%s|", ServerVendor(display), VendorRelease(display),
+	    DisplayString(display));
+    path = XGetFontPath(display, &npaths);
+    for (i = 0; i < npaths; i++) {
+	vb_appendf(&r, "%s%s", i? ",": "", path[i]);
+    }
+    if (path != NULL) {
+	XFreeFontPath(path);
+    }
+    return vb_consume(&r);
+}
+
+/*
+ * Read a line from the font name cache, without its newline.
+ *
+ * @return false for EOF or a line that does not fit
+ */
+static bool
+dfc_cache_line(FILE *f, char *buf, size_t size)
+{
+    size_t sl;
+
+    if (fgets(buf, (int)size, f) == NULL ||
+	    (sl = strlen(buf)) == 0 || buf[sl - 1] != '\n') {
+	return false;
+    }
+    buf[sl - 1] = '\0';
+    return true;
+}
+
+/*
+ * Read the font name cache.
+ *
+ * @param[in] key	Cache key
+ * @param[out] countp	Returned number of names
+ *
+ * @return Array of names, or NULL if the cache is missing or out of date
+ */
+static char **
+dfc_cache_read(const char *key, int *countp)
+{
+    char *fname = do_subst(FONT_CACHE, DS_VARS | DS_TILDE);
+    FILE *f = fopen(fname, "r");
+    char buf[4096];
+    char **names = NULL;
+    int count = 0;
+    int i;
+
+    Free(fname);
+    if (f == NULL) {
+	return NULL;
+    }
+
+    /* Check the header. */
+    if (!dfc_cache_line(f, buf, sizeof(buf)) ||
+	    strcmp(buf, FONT_CACHE_MAGIC) ||
+	    !dfc_cache_line(f, buf, sizeof(buf)) ||
+	    strcmp(buf, key) ||
+	    !dfc_cache_line(f, buf, sizeof(buf)) ||
+	    (count = atoi(buf)) <= 0 || count > MAX_FONTS) {
+	fclose(f);
+	return NULL;
+    }
+
+    /* Read the names. */
+    names = (char **)Malloc(count * sizeof(char *));
+    for (i = 0; i < count; i++) {
+	if (!dfc_cache_line(f, buf, sizeof(buf))) {
+	    break;
+	}
+	names[i] = NewString(buf);
+    }
+    fclose(f);
+    if (i < count) {
+	/* Truncated. */
+	while (i--) {
+	    Free(names[i]);
+	}
+	Free(names);
+	return NULL;
+    }
+
+    *countp = count;
+    return names;
+}
+
+/*
+ * Write the font name cache.
+ *
+ * @param[in] key	Cache key
+ * @param[in] names	Font names
+ * @param[in] count	Number of names
+ */
+static void
+dfc_cache_write(const char *key, char **names, int count)
+{
+    char *fname = do_subst(FONT_CACHE, DS_VARS | DS_TILDE);
+    char *tmp = xs_buffer("%s.%d", fname, (int)getpid());
+    FILE *f = fopen(tmp, "w");
+    int i;
+    bool ok;
+
+    if (f == NULL) {
+	Free(tmp);
+	Free(fname);
+	return;
+    }
+    fprintf(f, "%s\n%s\n%d\n", FONT_CACHE_MAGIC, key, count);
+    for (i = 0; i < count; i++) {
+	fprintf(f, "%s\n", names[i]);
+    }
+    ok = !ferror(f);
+    if (fclose(f) != 0) {
+	ok = false;
+    }
+
+    /* Replace the cache in one step, so a concurrent reader sees old or new. */
+    if (!ok || rename(tmp, fname) < 0) {
+	unlink(tmp);
+    }
+    Free(tmp);
+    Free(fname);
+}
+
+/* Refresh the font name cache, after the window is up. */
+static void
+dfc_refresh(XtPointer closure _is_unused, XtIntervalId *id _is_unused)
+{
+    char *key = dfc_cache_key();
+    char **cached;
+    int ncached = 0;
+    char **namelist;
+    int count;
+    int i;
+    bool same;
+
+    namelist = XListFonts(display, "*", MAX_FONTS, &count);
+    if (namelist == NULL) {
+	Free(key);
+	return;
+    }
+    cached = dfc_cache_read(key, &ncached);
+    same = (cached != NULL && ncached == count);
+    for (i = 0; i < ncached; i++) {
+	if (same && strcmp(cached[i], namelist[i])) {
+	    same = false;
+	}
+	Free(cached[i]);
+    }
+    Free(cached);
+
+    /* The new list will be used the next time x3270 starts. */
+    if (!same) {
+	vtrace("Font cache out of date, rewriting\n");
+	dfc_cache_write(key, namelist, count);
+    }
+    XFreeFontNames(namelist);
+    Free(key);
+}
+
+/*
+ * Initialize the dumb font cache.
+ *
+ * Listing every font can take seconds on a remote display with a long font
+ * path, so the names are kept on disk. If the cache matches this display,
+ * it is used, and refreshed once the window is up.
+ */
 static void
 dfc_init(void)
 {
     char **namelist;
+    char **cached;
+    char *key;
     int count;
     int i;
     dfc_t *d, *e;
@@ -6318,10 +6930,19 @@ dfc_init(void)
     dfc_t *m_last = NULL;
 
     /* Get all of the font names. */
-    namelist = XListFonts(display, "*", MAX_FONTS, &count);
-    if (namelist == NULL) {
-	Error("No fonts"); 
+    key = dfc_cache_key();
+    namelist = cached = dfc_cache_read(key, &count);
+    if (cached != NULL) {
+	vtrace("Using %d cached font names\n", count);
+	XtAppAddTimeOut(appcontext, FONT_REFRESH_MS, dfc_refresh, 0);
+    } else {
+	namelist = XListFonts(display, "*", MAX_FONTS, &count);
+	if (namelist == NULL) {
+	    Error("No fonts"); 
+	}
+	dfc_cache_write(key, namelist, count);
     }
+    Free(key);
     for (i = 0; i < count; i++) {
 	/* Pick apart the font names. */
 	int nf = split_name(namelist[i], nl_arr);
@@ -6386,6 +7007,15 @@ dfc_init(void)
 	dfc = m_first;
 	dfc_last = m_last;
     }
+
+    if (cached != NULL) {
+	for (i = 0; i < count; i++) {
+	    Free(cached[i]);
+	}
+	Free(cached);
+    } else {
+	XFreeFontNames(namelist);
+    }
 }
 
 /* Search iteratively for fonts whose names specify a given character set. */
@@ -1153,6 +1153,19 @@ init_select_buf(void)
     sb_ptr = select_buf;
 }
 
+/* Make sure the select buffer can hold 'n' more bytes without growing. */
+static void
+reserve_sel(size_t n)
+{
+    size_t used = sb_ptr - select_buf;
+
+    if (used + n > (size_t)sb_size) {
+	sb_size = (int)(used + n);
+	select_buf = XtRealloc(select_buf, sb_size);
+	sb_ptr = select_buf + used;
+    }
+}
+
 static void
 store_sel(char c)
 {
@@ -1175,6 +1188,7 @@ store_icccm_string(XtPointer value, const char *buf)
 {
     char *dst = (char *)value;
     unsigned long len = 0;
+    size_t left = strlen(buf);
     bool skip = false;
 
     while (*buf) {
@@ -1186,10 +1200,11 @@ store_icccm_string(XtPointer value, const char *buf)
 	    *dst++ = ' ';
 	    len++;
 	    buf++;
+	    left--;
 	    skip = true;
 	    continue;
 	}
-	nw = utf8_to_unicode(buf, strlen(buf), &ucs);
+	nw = utf8_to_unicode(buf, left, &ucs);
 	if (nw <= 0) {
 	    return len;
 	}
@@ -1204,6 +1219,7 @@ store_icccm_string(XtPointer value, const char *buf)
 	    len++;
 	}
 	buf += nw;
+	left -= nw;
     }
     return len;
 }
@@ -1575,6 +1591,14 @@ grab_sel(int start, int end, bool really, Time t, bool as_url)
     init_select_buf();	/* prime the store_sel() routine */
     osc_start();	/* prime the onscreen_char() routine */
 
+    /*
+     * Size the buffer for the worst case up front: every cell a 4-byte
+     * UTF-8 sequence, a newline per row, plus the newline extension and NUL.
+     */
+    if (really) {
+	reserve_sel((size_t)(end_row - start_row + 1) * (COLS * 4 + 1) + 2);
+    }
+
     if (!ever_3270 && !toggled(RECTANGLE_SELECT)) {
 	/* Continuous selections */
 	bool last_wrap = false;
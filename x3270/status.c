@@ -66,6 +66,7 @@ static bool  status_changed = false;
 static struct status_line {
     bool         changed;
     int             start, len, color;
+    int             drawn_color;	/* color last drawn, or -1 */
     XChar2b        *s2b;
     unsigned char  *s1b;
     XChar2b        *d2b;
@@ -494,6 +495,7 @@ status_reinit(unsigned cmask)
 
     for (i = 0; i < SSZ; i++) {
 	status_line[i].changed = true;
+	status_line[i].drawn_color = -1;
     }
     status_changed = true;
 
@@ -537,9 +539,12 @@ status_disp(void)
     if (!status_changed) {
 	return;
     }
+    screen_damage(0, status_y - *ascent, COL_TO_X(maxCOLS) + *char_width,
+	    *char_height);
     for (i = 0; i < SSZ; i++) {
 	if (status_line[i].changed) {
 	    status_render(i);
+	    status_line[i].drawn_color = status_line[i].color;
 	    memmove(status_line[i].d2b, status_line[i].s2b,
 		    status_line[i].len * sizeof(XChar2b));
 	    status_line[i].changed = false;
@@ -582,6 +587,7 @@ status_touch(void)
 
     for (i = 0; i < SSZ; i++) {
 	status_line[i].changed = true;
+	status_line[i].drawn_color = -1;
 	memset(status_line[i].d2b, 0, status_line[i].len * sizeof(XChar2b));
     }
     status_changed = true;
@@ -1034,6 +1040,59 @@ status_crosshair_off(void)
     }
 }
 
+/*
+ * Changed runs in a status line region, accumulated by status_run() and
+ * drawn by status_flush_runs() with one fill and one text request.
+ */
+#define MAX_RUNS	64
+static XRectangle run_rects[MAX_RUNS];
+static XTextItem16 run_items[MAX_RUNS];
+static int n_runs;
+static int run_x0;		/* x of the first run */
+static int run_xend;		/* x just past the last run */
+
+/* Draw the accumulated runs. */
+static void
+status_flush_runs(struct status_line *sl)
+{
+    if (!n_runs) {
+	return;
+    }
+    XFillRectangles(display, *screen_window, screen_invgc(sl->color),
+	    run_rects, n_runs);
+    XDrawText16(display, *screen_window, screen_gc(sl->color), run_x0,
+	    status_y, run_items, n_runs);
+    n_runs = 0;
+}
+
+/* Add a run of nd changed characters, starting at i0, to the batch. */
+static void
+status_run(struct status_line *sl, int i0, int nd)
+{
+    int x = COL_TO_X(sl->start + i0);
+
+    if (n_runs == MAX_RUNS) {
+	status_flush_runs(sl);
+    }
+    run_rects[n_runs].x = x;
+    run_rects[n_runs].y = status_y - *ascent;
+    run_rects[n_runs].width = *char_width * nd;
+    run_rects[n_runs].height = *char_height;
+    run_items[n_runs].chars = sl->s2b + i0;
+    run_items[n_runs].nchars = nd;
+    if (n_runs) {
+	/* Skip over the unchanged characters since the last run. */
+	run_items[n_runs].delta = x - run_xend;
+	run_items[n_runs].font = None;
+    } else {
+	run_x0 = x;
+	run_items[n_runs].delta = 0;
+	run_items[n_runs].font = *fid;
+    }
+    run_xend = x + *char_width * nd;
+    n_runs++;
+}
+
 /*
  * Render a region of the status line onto the display, the idea being to
  * minimize the number of redundant X drawing operations performed.
@@ -1050,8 +1109,13 @@ status_render(int region)
     int i0 = -1;
     XTextItem16 text1;
 
-    /* The status region may change colors; don't be so clever */
-    if (region == WAIT_REGION) {
+    /*
+     * The status region may change colors. When it does, or when the font
+     * needs characters drawn one at a time, redraw all of it; otherwise
+     * only the characters that changed are drawn.
+     */
+    if (region == WAIT_REGION &&
+	    (sl->color != sl->drawn_color || *funky_font || *xtra_width)) {
 	XFillRectangle(display, *screen_window,
 		screen_invgc(sl->color),
 		COL_TO_X(sl->start), status_y - *ascent,
@@ -1087,16 +1151,7 @@ status_render(int region)
 	    if (sl->s2b[i].byte1 == sl->d2b[i].byte1 &&
 		sl->s2b[i].byte2 == sl->d2b[i].byte2) {
 		if (nd) {
-		    XFillRectangle(display, *screen_window,
-			    screen_invgc(sl->color), COL_TO_X(sl->start + i0),
-			    status_y - *ascent, *char_width * nd,
-			    *char_height);
-		    text1.chars = sl->s2b + i0;
-		    text1.nchars = nd;
-		    text1.delta = 0;
-		    text1.font = *fid;
-		    XDrawText16(display, *screen_window, screen_gc(sl->color),
-			    COL_TO_X(sl->start + i0), status_y, &text1, 1);
+		    status_run(sl, i0, nd);
 		    nd = 0;
 		    i0 = -1;
 		}
@@ -1107,18 +1162,9 @@ status_render(int region)
 	    }
 	}
 	if (nd) {
-	    XFillRectangle(display, *screen_window, screen_invgc(sl->color),
-		    COL_TO_X(sl->start + i0), status_y - *ascent,
-		    *char_width * nd, *char_height);
-	    text1.chars = sl->s2b + i0;
-	    text1.nchars = nd;
-	    text1.delta = 0;
-	    text1.font = *fid;
-	    XDrawText16(display, *screen_window,
-		screen_gc(sl->color),
-		COL_TO_X(sl->start + i0), status_y,
-		&text1, 1);
+	    status_run(sl, i0, nd);
 	}
+	status_flush_runs(sl);
     }
 
     /* Leftmost region has unusual attributes */
@@ -1233,8 +1279,13 @@ paint_msg(enum msg t)
     oia_msg = t;
     (*msg_proc[(int)t])();
     if (!appres.interactive.mono) {
-	status_line[WAIT_REGION].color = mode.m3279 ?
-	    msg_color3279[(int)t] : msg_color[(int)t];
+	int color = mode.m3279? msg_color3279[(int)t]: msg_color[(int)t];
+
+	if (color != status_line[WAIT_REGION].color) {
+	    status_line[WAIT_REGION].color = color;
+	    status_line[WAIT_REGION].changed = true;
+	    status_changed = true;
+	}
     }
 }
 
@@ -48,10 +48,12 @@
 #include "resources.h"
 
 #include "actions.h"
+#include "allocs.h"
 #include "bind-opt.h"
 #include "boolstr.h"
 #include "codepage.h"
 #include "ctlrc.h"
+#include "footprint.h"
 #include "ft.h"
 #include "host.h"
 #include "httpd-core.h"
@@ -65,6 +67,7 @@
 #include "min_version.h"
 #include "model.h"
 #include "nvt.h"
+#include "observe.h"
 #include "opts.h"
 #include "popups.h"
 #include "pr3287_session.h"
@@ -75,14 +78,19 @@
 #include "query.h"
 #include "resourcesc.h"
 #include "screen.h"
+#include "screenhist.h"
 #include "selectc.h"
 #include "sio.h"
+#include "stats.h"
+#include "startup.h"
+#include "simd_glue.h"
 #include "status.h"
 #include "task.h"
 #include "telnet.h"
 #include "toggles.h"
 #include "trace.h"
 #include "screentrace.h"
+#include "shmexport.h"
 #include "utils.h"
 #include "vstatus.h"
 #include "xactions.h"
@@ -187,6 +195,7 @@ XrmOptionDescRec base_options[]= {
     { OptScriptPort,	DotScriptPort,	XrmoptionSepArg,	NULL },
     { OptScriptPortOnce,DotScriptPortOnce,XrmoptionNoArg,	ResTrue },
     { OptTermName,	DotTermName,	XrmoptionSepArg,	NULL },
+    { OptTraceBinary,	DotTraceBinary,	XrmoptionNoArg,		ResTrue },
     { OptTraceFile,	DotTraceFile,	XrmoptionSepArg,	NULL },
     { OptTraceFileSize,	DotTraceFileSize,XrmoptionSepArg,	NULL },
     { OptInputMethod,	DotInputMethod,	XrmoptionSepArg,	NULL },
@@ -269,6 +278,7 @@ static struct option_help {
     { OptSecure, NULL, "Set secure mode" },
     { OptTermName, "<name>", "Send <name> as TELNET terminal name" },
     { OptTrace, NULL, "Enable tracing" },
+    { OptTraceBinary, NULL, "Write traces in binary form" },
     { OptTraceFile, "<file>", "Write traces to <file>" },
     { OptTraceFileSize, "<n>[KM]", "Limit trace file to <n> bytes" },
     { OptInputMethod, "<name>", "Multi-byte input method" },
@@ -450,6 +460,8 @@ main(int argc, char *argv[])
     assert(True == true);
     assert(False == false);
 
+    startup_init("x3270");
+
     /* Figure out who we are */
     programname = strrchr(argv[0], '/');
     if (programname) {
@@ -490,6 +502,9 @@ main(int argc, char *argv[])
     kybd_register();
     task_register();
     query_register();
+    stats_register();
+    allocs_register();
+    footprint_register();
     menubar_register();
     nvt_register();
     popups_register();
@@ -503,6 +518,9 @@ main(int argc, char *argv[])
     toggles_register();
     trace_register();
     screentrace_register();
+    observe_register();
+    screenhist_register();
+    shmexport_register();
     x3270_register();
     xio_register();
     hio_register();
@@ -512,6 +530,7 @@ main(int argc, char *argv[])
     xkybd_register();
     login_macro_register();
     vstatus_register();
+    simd_glue_register();
 
     /* Translate and validate -set and -clear toggle options. */
 #if defined(DEBUG_SET_CLEAR) /*[*/
@@ -638,6 +657,7 @@ main(int argc, char *argv[])
     XtGetApplicationResources(toplevel, (XtPointer)&xappres, xresources,
 	    num_xresources, 0, 0);
     XtAppSetWarningMsgHandler(appcontext, old_emh);
+    startup_mark(STARTUP_RESOURCES);
 
     /* Copy bool values from xres to appres. */
     copy_xres_to_res_bool();
@@ -781,6 +801,7 @@ main(int argc, char *argv[])
 	codepage_init(NULL);
 	break;
     }
+    startup_mark(STARTUP_CODEPAGE);
 
     /* Initialize fonts. */
     font_init();
@@ -869,8 +890,11 @@ main(int argc, char *argv[])
 	    }
 	    XtAppProcessEvent(appcontext, XtIMXEvent | XtIMTimer);
 	}
-	screen_disp(false);
+	screen_disp_idle();
+	net_flush_output();
+	trace_flush();
 	XtAppProcessEvent(appcontext, XtIMAll);
+	startup_mark(STARTUP_LOOP);
 
 	/* Poll for exited children. */
 	poll_children();
@@ -880,6 +904,9 @@ main(int argc, char *argv[])
 
 	/* Flush the lazy allocation ring. */
 	lazya_flush();
+
+	/* Bring the shared-memory screen up to date. */
+	shmexport_update();
     }
 }
 
@@ -1298,6 +1325,7 @@ copy_xres_to_res_bool(void)
     copy_bool(scripted);
     copy_bool(modified_sel);
     copy_bool(unlock_delay);
+    copy_bool(settle_learn);
     copy_bool(bind_limit);
     copy_bool(bind_unlock);
     copy_bool(new_environ);
@@ -1310,6 +1338,7 @@ copy_xres_to_res_bool(void)
     copy_bool(highlight_bold);
     copy_bool(bsd_tm);
     copy_bool(trace_monitor);
+    copy_bool(trace_binary);
     copy_bool(idle_command_enabled);
     copy_bool(nvt_mode);
     copy_bool(script_port_once);
@@ -1331,6 +1360,8 @@ copy_xres_to_res_bool(void)
 
     copy_bool(tls.starttls);
     copy_bool(tls.verify_host_cert);
+    copy_bool(tls.kernel_tls);
+    copy_bool(tls.release_buffers);
 }
 
 /* Child exit callbacks. */
@@ -55,6 +55,7 @@ typedef struct {
     Boolean	 keypad_on;
     Boolean	 apl_circled_alpha;
     Boolean	 xquartz_hack;
+    Boolean	 backing_pixmap;
     char	*keypad;
     char	*efontname;
     char	*fixed_size;
@@ -90,6 +91,7 @@ typedef struct {
 	Boolean scripted;
 	Boolean modified_sel;
 	Boolean unlock_delay;
+	Boolean settle_learn;
 	Boolean bind_limit;
 	Boolean bind_unlock;
 	Boolean new_environ;
@@ -102,6 +104,7 @@ typedef struct {
 	Boolean highlight_bold;
 	Boolean bsd_tm;
 	Boolean trace_monitor;
+	Boolean trace_binary;
 	Boolean idle_command_enabled;
 	Boolean nvt_mode;
 	Boolean script_port_once;
@@ -122,6 +125,8 @@ typedef struct {
 	struct {
 	    Boolean starttls;
 	    Boolean verify_host_cert;
+	    Boolean kernel_tls;
+	    Boolean release_buffers;
 	} tls;
     } bools;
 } xappres_t, *xappresptr_t;
@@ -110,7 +110,7 @@ extern Dimension main_width;
 extern bool model_changed;
 extern bool oversize_changed;
 extern bool scheme_changed;
-extern Window *screen_window;
+extern Drawable *screen_window;
 extern bool scrollbar_changed;
 extern char *efont_charset_dbcs;
 extern XIM im;
@@ -143,7 +143,9 @@ void Redraw_xaction(Widget w, XEvent *event, String *params,
 void save_00translations(Widget w, XtTranslations *t00);
 void screen_change_model(int mn, int ovc, int ovr);
 GC screen_crosshair_gc(void);
+void screen_damage(int x, int y, int width, int height);
 void screen_disp(bool erasing);
+void screen_disp_idle(void);
 void screen_extended(bool extended);
 GC screen_gc(int color);
 GC screen_invgc(int color);
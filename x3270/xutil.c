@@ -235,6 +235,14 @@ AddTimeOut(unsigned long msec, tofn_t fn)
     return torec->id;
 }
 
+ioid_t
+AddTimeOutCoalesced(unsigned long msec, unsigned long slack_msec _is_unused,
+	tofn_t fn)
+{
+    /* Xt does its own timer management. */
+    return AddTimeOut(msec, fn);
+}
+
 void
 RemoveTimeOut(ioid_t cookie)
 {